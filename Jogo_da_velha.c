@@ -3,7 +3,6 @@
 #include "pico/stdlib.h"
 #include "hardware/i2c.h"
 #include "inc/ssd1306.h"
-#include "inc/font.h"
 #include "hardware/pio.h"
 #include "hardware/clocks.h"
 #include "ws2812.pio.h"
@@ -33,13 +32,33 @@ static volatile uint32_t LAST_TIME_A = 0;
 static volatile uint32_t LAST_TIME_B = 0;
 static volatile bool button_a_pressed = false;
 static volatile bool button_b_pressed = false;
-static volatile int button_a_press_count = 0; // Contador de pressões do botão A
+
+// Estado do jogo compactado: um bit por célula para cada jogador (bit i * 3 + j para a célula [i][j])
+typedef struct {
+    uint16_t x_cells; // Células ocupadas pelo X
+    uint16_t o_cells; // Células ocupadas pelo O
+    uint8_t cursor_x : 2, cursor_y : 2; // Posição do cursor no tabuleiro
+    uint8_t player_o : 1; // Jogador atual (0 = X, 1 = O)
+    uint8_t game_over : 1; // Indica se o jogo terminou
+    uint8_t button_a_press_count : 2; // Contador de pressões do botão A
+} game_state_t;
+
+#define CELL_BIT(i, j) (1u << ((i) * 3 + (j)))
+#define FULL_BOARD 0x1FF
 
 ssd1306_t ssd; // Estrutura para o display OLED
-char board[3][3] = {{' ', ' ', ' '}, {' ', ' ', ' '}, {' ', ' ', ' '}}; // Matriz do jogo
-int cursor_x = 0, cursor_y = 0; // Posição do cursor no tabuleiro
-char current_player = 'X'; // Jogador atual
-bool game_over = false; // Indica se o jogo terminou
+static game_state_t game; // Estado do jogo (tabuleiro vazio, cursor em 0, vez do X)
+
+// Linhas vencedoras: três linhas, três colunas e as duas diagonais
+static const uint16_t winning_lines[8] = {0x007, 0x038, 0x1C0, 0x049, 0x092, 0x124, 0x111, 0x054};
+
+// Função para ler o símbolo de uma célula do tabuleiro
+static inline char cell_at(int i, int j) {
+    if (game.x_cells & CELL_BIT(i, j)) {
+        return 'X';
+    }
+    return (game.o_cells & CELL_BIT(i, j)) ? 'O' : ' ';
+}
 
 // Função para desenhar o tabuleiro no display
 void draw_board() {
@@ -54,14 +73,14 @@ void draw_board() {
     // Desenha os símbolos do jogo
     for (int y = 0; y < 3; y++) {
         for (int x = 0; x < 3; x++) {
-            if (board[x][y] != ' ') {
-                ssd1306_draw_char(&ssd, board[x][y], x * 40 + 16, y * 20 + 6);
+            if (cell_at(x, y) != ' ') {
+                ssd1306_draw_char(&ssd, cell_at(x, y), x * 40 + 16, y * 20 + 6);
             }
         }
     }
 
     // Desenha o cursor
-    ssd1306_rect(&ssd, cursor_x * 20 + 2, cursor_y * 40 + 2, 36, 16, true, false);
+    ssd1306_rect(&ssd, game.cursor_x * 20 + 2, game.cursor_y * 40 + 2, 36, 16, true, false);
 
     ssd1306_send_data(&ssd); // Envia os dados para o display
 }
@@ -77,7 +96,7 @@ static inline uint32_t urgb_u32(uint8_t r, uint8_t g, uint8_t b) {
 }
 
 // Matriz de LEDs para representar os símbolos do jogo
-const bool matriz_led[NUM_PLAYERS][NUM_PIXELS] = {
+static const bool matriz_led[NUM_PLAYERS][NUM_PIXELS] = {
     {1,0,0,0,1, 0,1,0,1,0, 0,0,1,0,0, 0,1,0,1,0, 1,0,0,0,1}, // X
     {0,1,1,1,0, 1,0,0,0,1, 1,0,0,0,1, 1,0,0,0,1, 0,1,1,1,0}, // O
     {0,0,1,0,0, 0,1,0,1,0, 1,0,0,0,1, 1,0,0,0,1, 1,0,0,0,1}, // V
@@ -109,41 +128,23 @@ void play_sound(int frequency, int duration_ms) {
 
 // Função para verificar se há um vencedor
 char check_winner() {
-    // Verifica linhas
-    for (int y = 0; y < 3; y++) {
-        if (board[y][0] != ' ' && board[y][0] == board[y][1] && board[y][1] == board[y][2]) {
-            return board[y][0]; // Retorna o jogador que venceu
+    // Verifica linhas, colunas e diagonais
+    for (int i = 0; i < 8; i++) {
+        if ((game.x_cells & winning_lines[i]) == winning_lines[i]) {
+            return 'X'; // Retorna o jogador que venceu
         }
-    }
-
-    // Verifica colunas
-    for (int x = 0; x < 3; x++) {
-        if (board[0][x] != ' ' && board[0][x] == board[1][x] && board[1][x] == board[2][x]) {
-            return board[0][x]; // Retorna o jogador que venceu
+        if ((game.o_cells & winning_lines[i]) == winning_lines[i]) {
+            return 'O'; // Retorna o jogador que venceu
         }
     }
 
-    // Verifica diagonais
-    if (board[0][0] != ' ' && board[0][0] == board[1][1] && board[1][1] == board[2][2]) {
-        return board[0][0]; // Retorna o jogador que venceu
-    }
-    if (board[0][2] != ' ' && board[0][2] == board[1][1] && board[1][1] == board[2][0]) {
-        return board[0][2]; // Retorna o jogador que venceu
-    }
-
     return ' '; // Nenhum vencedor
 }
 
 // Função para verificar se o jogo empatou
 bool check_draw() {
-    for (int y = 0; y < 3; y++) {
-        for (int x = 0; x < 3; x++) {
-            if (board[y][x] == ' ') {
-                return false; // Ainda há espaços vazios, o jogo não empatou
-            }
-        }
-    }
-    return true; // Todos os espaços estão preenchidos, o jogo empatou
+    // Todos os espaços estão preenchidos quando os dois jogadores ocupam as 9 células
+    return (game.x_cells | game.o_cells) == FULL_BOARD;
 }
 
 // Função de interrupção para os botões
@@ -160,18 +161,8 @@ void gpio_irq_handler(uint gpio, uint32_t events) {
 
 // Função para reiniciar o jogo
 void reset_game() {
-    // Limpa o tabuleiro
-    for (int y = 0; y < 3; y++) {
-        for (int x = 0; x < 3; x++) {
-            board[y][x] = ' ';
-        }
-    }
-
-    // Reinicia as variáveis de estado
-    cursor_x = 0;
-    cursor_y = 0;
-    current_player = 'X';
-    game_over = false;
+    // Limpa o tabuleiro e reinicia as variáveis de estado
+    game = (game_state_t){0};
 
     // Desliga os LEDs
     gpio_put(BLUE_LED, false);
@@ -190,14 +181,13 @@ void reset_game() {
 
 // Função para atualizar o estado do jogo
 void update_game() {
-    if (game_over) {
+    if (game.game_over) {
         // Verifica se o botão A foi pressionado duas vezes para reiniciar
         if (button_a_pressed) {
             button_a_pressed = false;
-            button_a_press_count++;
-            if (button_a_press_count == 2) {
-                button_a_press_count = 0; // Reinicia o contador
-                reset_game(); // Reinicia o jogo
+            game.button_a_press_count++;
+            if (game.button_a_press_count == 2) {
+                reset_game(); // Reinicia o jogo e o contador
             }
         }
         return; // Se o jogo terminou, não faz nada além de verificar o reinício
@@ -206,8 +196,12 @@ void update_game() {
     // Insere o símbolo do jogador atual na matriz ao pressionar o botão A
     if (button_a_pressed) {
         button_a_pressed = false;
-        if (board[cursor_y][cursor_x] == ' ') {
-            board[cursor_y][cursor_x] = current_player;
+        if (cell_at(game.cursor_y, game.cursor_x) == ' ') {
+            if (game.player_o) {
+                game.o_cells |= CELL_BIT(game.cursor_y, game.cursor_x);
+            } else {
+                game.x_cells |= CELL_BIT(game.cursor_y, game.cursor_x);
+            }
 
             // Desenha o tabuleiro antes de verificar o vencedor
             draw_board();
@@ -215,7 +209,7 @@ void update_game() {
             // Verifica se há um vencedor
             char winner = check_winner();
             if (winner != ' ') {
-                game_over = true;
+                game.game_over = true;
                 printf("Jogador %c venceu!\n", winner);
                 printf("Pressione o botão A duas vezes para reiniciar o jogo.\n"); // Instrução para reiniciar
                 if (winner == 'X') {
@@ -232,7 +226,7 @@ void update_game() {
 
             // Verifica se o jogo empatou
             if (check_draw()) {
-                game_over = true;
+                game.game_over = true;
                 printf("Deu velha!\n");
                 printf("Pressione o botão A duas vezes para reiniciar o jogo.\n"); // Instrução para reiniciar
                 gpio_put(RED_LED, true); // Acende o LED vermelho para indicar empate
@@ -242,11 +236,7 @@ void update_game() {
             }
 
             // Alterna o jogador
-            if (current_player == 'X') {
-                current_player = 'O';
-            } else {
-                current_player = 'X';
-            }
+            game.player_o = !game.player_o;
         
         // Caso o jogador tente usar um espaço já ocupado
         } else {
@@ -261,9 +251,9 @@ void update_game() {
     // Se locomove por entre as células da matriz ao pressionar o botão B
     if (button_b_pressed) {
         button_b_pressed = false;
-        cursor_x = (cursor_x + 1) % 3; // Move horizontalmente
-        if (cursor_x == 0) {
-            cursor_y = (cursor_y + 1) % 3; // Move verticalmente apenas quando cursor_x volta a 0
+        game.cursor_x = (game.cursor_x + 1) % 3; // Move horizontalmente
+        if (game.cursor_x == 0) {
+            game.cursor_y = (game.cursor_y + 1) % 3; // Move verticalmente apenas quando cursor_x volta a 0
         }
     }
     
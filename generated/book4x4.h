@@ -0,0 +1,8577 @@
+// ------------------------------------------------------ //
+// This file is autogenerated by book_gen; do not edit!  //
+// ------------------------------------------------------ //
+
+#pragma once
+
+#include "pico.h"
+
+#define book4x4_win_length 4
+#define book4x4_count 68505
+
+static const uint32_t __in_flash("book4x4") book4x4_entries[] = {
+    0x00000001, 0x00000045, 0x000000c1, 0x000001c9, 0x0000038d, 0x0000040d, 0x000004c5, 0x00000745,
+    0x00000809, 0x00000889, 0x00000b11, 0x00000c91, 0x00001589, 0x00001609, 0x00001705, 0x00001b85,
+    0x00001f55, 0x00001f81, 0x000020d5, 0x00002155, 0x00002401, 0x00002555, 0x000025d5, 0x00002b05,
+    0x00002c8d, 0x00002e0d, 0x00002f41, 0x00002f85, 0x00003089, 0x00003109, 0x00003301, 0x00003355,
+    0x00003405, 0x00003481, 0x00003885, 0x00003cc1, 0x00003e09, 0x00003e89, 0x00003f85, 0x00004405,
+    0x000047d1, 0x00004801, 0x00004951, 0x000049d1, 0x00004c81, 0x00004dd1, 0x00004e51, 0x0000554d,
+    0x000056cd, 0x0000574d, 0x000059c9, 0x00005cc5, 0x00006145, 0x0000694d, 0x00006dc9, 0x000079c5,
+    0x00007d8d, 0x00007f0d, 0x00008041, 0x00008189, 0x00008209, 0x00008401, 0x00008505, 0x00008581,
+    0x00008809, 0x00008985, 0x00008f89, 0x00009285, 0x000098d9, 0x00009a59, 0x00009b85, 0x00009f59,
+    0x0000a0d9, 0x0000a905, 0x0000ac59, 0x0000acd9, 0x0000ae59, 0x0000b2d9, 0x0000cb05, 0x0000cecd,
+    0x0000d04d, 0x0000d0cd, 0x0000d349, 0x0000d645, 0x0000d741, 0x0000d801, 0x0000d949, 0x0000d9c9,
+    0x0000dac5, 0x0000dbc1, 0x0000dcc5, 0x0000dd41, 0x0000df05, 0x0000e2cd, 0x0000e749, 0x0000f385,
+    0x0000f74d, 0x0000f8cd, 0x0000f94d, 0x0000fbc9, 0x0000fec5, 0x000101c9, 0x0001095d, 0x0001149d,
+    0x0001155d, 0x0001191d, 0x0001195d, 0x00011a9d, 0x00011b1d, 0x00011d49, 0x0001269d, 0x00012821,
+    0x0001289d, 0x00012c9d, 0x00012d29, 0x00014f1d, 0x0001509d, 0x00015121, 0x0001551d, 0x0001559d,
+    0x0001631d, 0x00018bd5, 0x00018d55, 0x00019c05, 0x00019e01, 0x00019f55, 0x00019fd5, 0x0001a155,
+    0x0001a5d5, 0x0001e709, 0x0001ed05, 0x0001f051, 0x0001f0d1, 0x0001fa85, 0x0001fe4d, 0x0001ffcd,
+    0x000208c9, 0x000211ce, 0x0002164a, 0x000217c6, 0x00021842, 0x00023785, 0x00023b4d, 0x00023ccd,
+    0x00023d4d, 0x00023fc9, 0x000242c5, 0x000245c9, 0x00024b85, 0x00024f4d, 0x000253c9, 0x00025cd5,
+    0x00025e55, 0x000275d9, 0x00028119, 0x000281d9, 0x00028599, 0x000285d9, 0x00028719, 0x00028799,
+    0x000289c9, 0x00029319, 0x00029499, 0x00029529, 0x00029919, 0x00029999, 0x0002bb99, 0x0002bd19,
+    0x0002bd99, 0x0002c199, 0x0002c219, 0x0002cf99, 0x00030349, 0x00030e95, 0x00031315, 0x0003428d,
+    0x0003448d, 0x00034709, 0x00034d09, 0x00034e85, 0x00035085, 0x00035101, 0x00036b0d, 0x00036f89,
+    0x00037589, 0x00037705, 0x00037905, 0x00037981, 0x00038ca1, 0x00038e21, 0x0003be81, 0x0003c049,
+    0x0003c145, 0x0003c241, 0x0003c345, 0x0003c3c1, 0x0003ffa1, 0x00040121, 0x00040621, 0x000407a1,
+    0x00043845, 0x00043a41, 0x00043ba1, 0x00043c21, 0x00043da1, 0x00044221, 0x00047505, 0x00047855,
+    0x000478d5, 0x0004ef4a, 0x0004f0c6, 0x0005a821, 0x0005a8a1, 0x0005aa21, 0x0005aea1, 0x00067381,
+    0x000674d1, 0x00067551, 0x00067801, 0x00067951, 0x000679d1, 0x000680cd, 0x0006824d, 0x000682f1,
+    0x00068549, 0x00068845, 0x00068cc5, 0x000694cd, 0x00069585, 0x000698c9, 0x00069949, 0x00069e85,
+    0x0006a3d5, 0x0006a94d, 0x0006aacd, 0x0006ab4d, 0x0006adc9, 0x0006b0c5, 0x0006b545, 0x0006c699,
+    0x0006cb19, 0x0006cc99, 0x0006cd31, 0x0006d4c5, 0x0006d899, 0x0006da19, 0x0006da99, 0x0006de99,
+    0x0006df19, 0x00070119, 0x00070299, 0x00070331, 0x00070719, 0x000707b1, 0x00070fcd, 0x00071519,
+    0x000718c9, 0x00072a45, 0x00072b41, 0x00072c01, 0x00072d49, 0x00072dc9, 0x00072ec5, 0x00072fc1,
+    0x000730c5, 0x00073141, 0x000734c9, 0x00074015, 0x000740c5, 0x00074495, 0x00074615, 0x000746b1,
+    0x00074849, 0x000748c9, 0x00075395, 0x00075415, 0x00075815, 0x00075895, 0x00075d49, 0x00076891,
+    0x00076945, 0x00076d11, 0x00076d41, 0x00076e91, 0x00076f11, 0x0007760e, 0x00077f0a, 0x00078206,
+    0x00078445, 0x0007880d, 0x0007898d, 0x00078a0d, 0x00078c89, 0x0007fd85, 0x000802cd, 0x00080bc9,
+    0x00084d26, 0x000877dd, 0x0008831d, 0x0008879d, 0x000896c5, 0x000897c1, 0x00089881, 0x000899c9,
+    0x00089a49, 0x00089b45, 0x00089c41, 0x00089d45, 0x00089dc1, 0x0008a149, 0x0008ac95, 0x0008ad45,
+    0x0008b115, 0x0008b141, 0x0008b295, 0x0008b331, 0x0008b4c9, 0x0008b549, 0x0008c015, 0x0008c095,
+    0x0008c495, 0x0008c515, 0x0008d511, 0x0008d5c5, 0x0008d991, 0x0008d9c1, 0x0008db11, 0x0008db91,
+    0x0008e28e, 0x0008eb8a, 0x0008ee86, 0x0008f0c5, 0x0008f48d, 0x0008f60d, 0x0008f68d, 0x0008f909,
+    0x00094ea5, 0x00094f45, 0x00095311, 0x00095491, 0x00095511, 0x00095c0e, 0x0009650a, 0x00096806,
+    0x00096f8d, 0x0009700d, 0x0009848e, 0x00098d8a, 0x00099086, 0x0009a889, 0x0009b3e5, 0x0009b485,
+    0x0009b865, 0x0009b881, 0x0009b9e5, 0x0009ba65, 0x0009d109, 0x0009dc65, 0x0009dd05, 0x0009e0e5,
+    0x0009e101, 0x0009e265, 0x0009e2f1, 0x0009efe5, 0x0009f065, 0x0009f465, 0x0009f4e5, 0x000a0411,
+    0x000a0491, 0x000a0891, 0x000a0911, 0x000a0a91, 0x000a4a89, 0x000a55e5, 0x000a5685, 0x000a5a65,
+    0x000a5a81, 0x000a5be5, 0x000a5c71, 0x000a67e5, 0x000a6965, 0x000a69e9, 0x000a6de5, 0x000a6e65,
+    0x000a6fe5, 0x000a9065, 0x000a91ea, 0x000a9271, 0x000a9665, 0x000a96f1, 0x000a9871, 0x000a9f0d,
+    0x000aa465, 0x000aa809, 0x000ab481, 0x000ab5c9, 0x000ab745, 0x000ab945, 0x000ab9c1, 0x000ac945,
+    0x000acd15, 0x000acd41, 0x000ace95, 0x000acf31, 0x000ad685, 0x000adbcd, 0x000ae4c9, 0x000af1c5,
+    0x000af591, 0x000af5c1, 0x000af711, 0x000af791, 0x000b0789, 0x000b0a85, 0x000b0b81, 0x000b2626,
+    0x000b50d9, 0x000b5c19, 0x000b6099, 0x000b6b45, 0x000b6f25, 0x000b7091, 0x000b7111, 0x000b7511,
+    0x000b7591, 0x000b7711, 0x000b8109, 0x000b8405, 0x000b8501, 0x000ba989, 0x000bac85, 0x000bad81,
+    0x000bb709, 0x000bc265, 0x000bc305, 0x000bc6e5, 0x000bc701, 0x000bc865, 0x000bc8f1, 0x000bd465,
+    0x000bd5e5, 0x000bd665, 0x000bda65, 0x000bdae9, 0x000bdc65, 0x000bfce5, 0x000bfe65, 0x000c02fe,
+    0x000c0371, 0x000c04f1, 0x000c0b8d, 0x000c10e5, 0x000c1489, 0x000c2691, 0x000c43d5, 0x000c4f15,
+    0x000c5395, 0x000c77e5, 0x000c7871, 0x000c8526, 0x000c8be5, 0x000c8e26, 0x000cb471, 0x000cd60d,
+    0x000cd741, 0x000cd889, 0x000cd909, 0x000cdb01, 0x000cdc05, 0x000cdc81, 0x000ce085, 0x000cecc9,
+    0x000cefd5, 0x000cf155, 0x000cf285, 0x000cf655, 0x000cf7d5, 0x000d0005, 0x000d00c9, 0x000d0371,
+    0x000d03d5, 0x000d0555, 0x000d09d5, 0x000d28c5, 0x000d2c99, 0x000d2e19, 0x000d3cc5, 0x000d4099,
+    0x000d4219, 0x000d4699, 0x000d5105, 0x000d5451, 0x000d54d1, 0x000d5651, 0x000d5ad1, 0x000d63cd,
+    0x000d6cc9, 0x000d7a4a, 0x000d9c49, 0x000da795, 0x000db049, 0x000dbb95, 0x000dc015, 0x000dd85d,
+    0x000ddd9d, 0x000de09d, 0x000dec45, 0x000df029, 0x000df18d, 0x000df489, 0x000e1fa5, 0x000e211d,
+    0x000e261d, 0x000e279d, 0x000e3331, 0x000e339d, 0x000e351d, 0x000e399d, 0x000e4405, 0x000e4601,
+    0x000e4751, 0x000e47d1, 0x000e4951, 0x000e4dd1, 0x000e5185, 0x000e554d, 0x000e56cd, 0x000e5fc9,
+    0x000e6d4a, 0x000e6ec6, 0x000e991d, 0x000e9a9d, 0x000e9f9d, 0x000ea125, 0x000eacb1, 0x000ead1d,
+    0x000eae9d, 0x000eb31d, 0x000eb9ce, 0x000ebe4a, 0x000ebfc6, 0x000ec042, 0x000ecbc9, 0x000ed51d,
+    0x000ed59d, 0x000ed71d, 0x000edb9d, 0x000f04d1, 0x000f0651, 0x000f08c9, 0x000f1415, 0x000f1cc9,
+    0x000f2815, 0x000f2c95, 0x000f44d9, 0x000f4a19, 0x000f4d19, 0x000f58c5, 0x000f5c8d, 0x000f5e0d,
+    0x000f6129, 0x000f6a19, 0x000f6b99, 0x000f9299, 0x000f9419, 0x000fc395, 0x000fd78d, 0x00101089,
+    0x00101b72, 0x00101be9, 0x00102069, 0x001021e5, 0x00103491, 0x00103611, 0x001043e5, 0x00104465,
+    0x001057e5, 0x00105c65, 0x00106681, 0x00106849, 0x00106945, 0x00106a41, 0x00106b45, 0x00106bc1,
+    0x00108595, 0x00108725, 0x00108f45, 0x001092b1, 0x00109315, 0x00109495, 0x0010a791, 0x0010a911,
+    0x0010ae11, 0x0010afa5, 0x0010b209, 0x0010b385, 0x0010b805, 0x0010bbe5, 0x0010bd65, 0x0010cfe9,
+    0x0010d169, 0x0010d5e5, 0x0010e045, 0x0010e241, 0x0010e391, 0x0010e411, 0x0010e591, 0x0010ea11,
+    0x0011098a, 0x00110b06, 0x00111d05, 0x00112051, 0x001120d1, 0x00112251, 0x001126d1, 0x00112a85,
+    0x00112e4d, 0x00112fcd, 0x001138c9, 0x0011464a, 0x001147c6, 0x00117219, 0x00117399, 0x00117899,
+    0x00117a19, 0x001185b1, 0x00118619, 0x00118799, 0x00118c19, 0x0011974a, 0x001198c6, 0x0011a4c9,
+    0x0011aac5, 0x0011ae19, 0x0011ae99, 0x0011b019, 0x0011b499, 0x0011eb95, 0x0011ed15, 0x00120115,
+    0x00120595, 0x00121e89, 0x00122005, 0x00122485, 0x00122865, 0x001229e5, 0x00125011, 0x00125091,
+    0x00125211, 0x00125691, 0x00128a4a, 0x00128bc6, 0x001297c9, 0x0012a115, 0x0012a195, 0x0012a315,
+    0x0012a7a5, 0x0012c991, 0x0012ca11, 0x0012cb91, 0x0012d025, 0x0013138e, 0x0013180a, 0x00131986,
+    0x00134401, 0x00134551, 0x001345d1, 0x00134881, 0x001349d1, 0x00134a51, 0x001355c9, 0x001358c5,
+    0x00135d45, 0x00136949, 0x001369c9, 0x00137e49, 0x00138145, 0x001385c5, 0x00139719, 0x00139b99,
+    0x00139d35, 0x00139da1, 0x0013a545, 0x0013a919, 0x0013aab5, 0x0013ab19, 0x0013af35, 0x0013af99,
+    0x0013d199, 0x0013d319, 0x0013d399, 0x0013d799, 0x0013d819, 0x0013e599, 0x0013faf1, 0x0013fbf1,
+    0x0013fc81, 0x0013fdc9, 0x0013fe49, 0x0013ff45, 0x00140041, 0x00140145, 0x001401c1, 0x00140549,
+    0x001410b1, 0x00141145, 0x00141515, 0x00141695, 0x00141715, 0x00141949, 0x00142431, 0x001424b1,
+    0x00142895, 0x00142915, 0x00142dc9, 0x00143931, 0x001439c5, 0x00143d91, 0x00143dc1, 0x00143f35,
+    0x00143f91, 0x0014468e, 0x00144f8a, 0x00145286, 0x0014588d, 0x00145a8d, 0x00145d31, 0x00156745,
+    0x00156841, 0x00156a49, 0x00156ac9, 0x00156bc5, 0x00156cc1, 0x00156dc5, 0x00156e41, 0x001571c9,
+    0x00157d15, 0x00158195, 0x001581c1, 0x00158315, 0x00158395, 0x00158549, 0x001585c9, 0x00159095,
+    0x00159115, 0x00159515, 0x00159595, 0x0015a591, 0x0015a645, 0x0015aa11, 0x0015aa41, 0x0015abb5,
+    0x0015ac11, 0x0015b30e, 0x0015bc0a, 0x0015bf06, 0x0015c145, 0x0015c50d, 0x0015c6b5, 0x0015c70d,
+    0x0015c989, 0x00161f31, 0x00161fc5, 0x00162391, 0x00162511, 0x00162591, 0x00162c8e, 0x0016358a,
+    0x00163886, 0x0016400d, 0x0016408d, 0x0016550e, 0x00165e0a, 0x00166106, 0x00167909, 0x00168471,
+    0x00168505, 0x001688e1, 0x00168901, 0x00168a75, 0x00168ae1, 0x0016a189, 0x0016acf1, 0x0016ad85,
+    0x0016b161, 0x0016b181, 0x0016b2e1, 0x0016b361, 0x0016c071, 0x0016c0f1, 0x0016c4e1, 0x0016c561,
+    0x0016d491, 0x0016d511, 0x0016d911, 0x0016d991, 0x0016db11, 0x00171b09, 0x00172661, 0x00172705,
+    0x00172ae1, 0x00172b01, 0x00172c75, 0x00172ce1, 0x00173861, 0x001739f5, 0x00173a69, 0x00173e75,
+    0x00173ee1, 0x00174075, 0x001760e1, 0x0017626a, 0x001762e1, 0x001766e1, 0x00176761, 0x001768e1,
+    0x001774e1, 0x001789c5, 0x00178a41, 0x00179dc1, 0x00179f15, 0x00179f99, 0x0017c641, 0x0017c7b5,
+    0x0017c811, 0x0017db05, 0x0017dc01, 0x00184131, 0x001841b1, 0x00184591, 0x00184611, 0x00184791,
+    0x001854b1, 0x001855b1, 0x00187d31, 0x00187e31, 0x00188789, 0x001892f1, 0x00189385, 0x00189761,
+    0x00189781, 0x001898f5, 0x00189961, 0x0018a4f1, 0x0018a6f1, 0x0018aaf5, 0x0018ab69, 0x0018acf5,
+    0x0018cd71, 0x0018cef1, 0x0018d37e, 0x0018d3e1, 0x0018d561, 0x0018e171, 0x0018f711, 0x00194875,
+    0x001948e1, 0x00195c75, 0x001984e1, 0x0019acc5, 0x0019b145, 0x0019c295, 0x0019c715, 0x0019c895,
+    0x0019d615, 0x0019d695, 0x0019da95, 0x0019db15, 0x0019eb11, 0x0019ef91, 0x0019f135, 0x0019f1a9,
+    0x001a0f09, 0x001a64b1, 0x001a6545, 0x001a6929, 0x001a6a91, 0x001a6b11, 0x001a720e, 0x001a7b0a,
+    0x001a858d, 0x001a860d, 0x001a9a8e, 0x001aa38a, 0x001aa686, 0x001ac9f1, 0x001ace69, 0x001acff5,
+    0x001ad069, 0x001af271, 0x001af6e9, 0x001af85d, 0x001af8f1, 0x001b05f1, 0x001b0671, 0x001b0a69,
+    0x001b0ae9, 0x001b6bdd, 0x001b705d, 0x001b71f5, 0x001b7ddd, 0x001b7f75, 0x001b7fe9, 0x001b83f5,
+    0x001b8469, 0x001ba65d, 0x001ba7ea, 0x001ba871, 0x001bac5d, 0x001bacf1, 0x001bba5e, 0x001bd129,
+    0x001bd1c5, 0x001bd591, 0x001bd711, 0x001bd791, 0x001bde8e, 0x001be78a, 0x001bea86, 0x001bf20d,
+    0x001bf28d, 0x001c100a, 0x001c1306, 0x001c2b09, 0x001c3669, 0x001c3ad9, 0x001c3c75, 0x001c3ce9,
+    0x001c5ee9, 0x001c6359, 0x001c64d9, 0x001c6571, 0x001c7269, 0x001c72e9, 0x001c76d9, 0x001c7759,
+    0x001c898a, 0x001cb469, 0x001cb5d5, 0x001cb655, 0x001ce5ce, 0x001ceeca, 0x001cf1c6, 0x001d0e4e,
+    0x001d174a, 0x001d1a46, 0x001d6569, 0x001d65e9, 0x001d69d5, 0x001d6a55, 0x001d6bd5, 0x001d87ce,
+    0x001d90ca, 0x001d93c6, 0x001dedc5, 0x001df199, 0x001df311, 0x001df391, 0x001e0389, 0x001e0685,
+    0x001e2c09, 0x001e2f05, 0x001e44d9, 0x001e56d9, 0x001e5875, 0x001e58e9, 0x001e7f59, 0x001e80d9,
+    0x001ea5b1, 0x001ebe71, 0x001ed1f1, 0x001ed271, 0x001ed669, 0x001ed6e9, 0x001ed855, 0x001ee6f1,
+    0x001ef44e, 0x001efd4a, 0x001f0046, 0x001f7255, 0x001f7471, 0x001f87d6, 0x001f9ad1, 0x001fcb76,
+    0x00202895, 0x00202a15, 0x00202a95, 0x00203c32, 0x00203c95, 0x00203e15, 0x00204295, 0x00206319,
+    0x00207709, 0x00207832, 0x0020d995, 0x0020da0d, 0x0020f032, 0x0020f0b1, 0x0021245d, 0x00212c32,
+    0x00213172, 0x002131f1, 0x002137f5, 0x00215871, 0x002159f1, 0x00215a71, 0x00216c71, 0x00216df1,
+    0x0021725d, 0x0021d1dd, 0x0021d375, 0x0021e5dd, 0x0021e775, 0x0021ebf5, 0x0022448d, 0x00224615,
+    0x0022468d, 0x00225832, 0x0022588d, 0x00225a0d, 0x00228ed9, 0x002290d9, 0x00229309, 0x00229432,
+    0x00229e69, 0x0022a2d9, 0x0022a475, 0x0022c4d9, 0x0022c659, 0x0022c6d9, 0x0022d8d9, 0x0022da59,
+    0x0022ded9, 0x00230855, 0x00230a55, 0x00230c32, 0x00230c89, 0x002317f1, 0x00231c55, 0x00231dd5,
+    0x00234832, 0x00234dcd, 0x002375cd, 0x0023ea05, 0x0023edcd, 0x0023ef75, 0x0023f249, 0x002410f6,
+    0x00243969, 0x00255685, 0x00255a4d, 0x00255bf5, 0x00255ef1, 0x00259df2, 0x00261f76, 0x00263176,
+    0x002659e9, 0x00267841, 0x00267989, 0x00267a09, 0x00267c01, 0x00267d05, 0x00267d81, 0x00268185,
+    0x002690d5, 0x00269255, 0x00269755, 0x002698d5, 0x0026a105, 0x0026a455, 0x0026a4d5, 0x0026a655,
+    0x0026aad5, 0x0026f205, 0x0026f551, 0x0026f5f5, 0x0026f751, 0x0026fbd1, 0x00270dc9, 0x00271b4a,
+    0x0027c0b5, 0x0027c21d, 0x0027c735, 0x0027c89d, 0x0027d421, 0x0027d4b5, 0x0027d61d, 0x0027da9d,
+    0x0027e505, 0x0027e701, 0x0027e851, 0x0027e8d1, 0x0027ea51, 0x0027eef1, 0x0027f64d, 0x0027f7cd,
+    0x00280e4a, 0x00280fc6, 0x00283a1d, 0x00283b9d, 0x002840b1, 0x00284231, 0x00284d9d, 0x00284e1d,
+    0x00284f9d, 0x00285431, 0x00285ace, 0x00285f4a, 0x002860c6, 0x00286142, 0x00286cc9, 0x0028761d,
+    0x002876b5, 0x0028781d, 0x00287cb1, 0x0028a5d1, 0x0028a751, 0x00290b19, 0x00290c99, 0x002933b5,
+    0x00293519, 0x0029d5b5, 0x0029d711, 0x002a0a45, 0x002a0b41, 0x002a0cc1, 0x002a26b1, 0x002a2831,
+    0x002a3045, 0x002a3395, 0x002a3415, 0x002a3595, 0x002a4891, 0x002a4a11, 0x002a4f31, 0x002a50b1,
+    0x002a8341, 0x002a8491, 0x002a8535, 0x002a8691, 0x002a8b31, 0x002aaa8a, 0x002aac06, 0x002abe05,
+    0x002ac151, 0x002ac1d1, 0x002ac351, 0x002ac7d1, 0x002acf4d, 0x002ad0cd, 0x002ae74a, 0x002ae8c6,
+    0x002b1319, 0x002b1499, 0x002b1999, 0x002b1b19, 0x002b2699, 0x002b2719, 0x002b2899, 0x002b2d19,
+    0x002b384a, 0x002b39c6, 0x002b45c9, 0x002b4bc5, 0x002b4f19, 0x002b4fb5, 0x002b5119, 0x002b5599,
+    0x002b8c95, 0x002b8e15, 0x002ba215, 0x002ba695, 0x002bcae1, 0x002bcb61, 0x002bf111, 0x002bf1b5,
+    0x002bf311, 0x002bf791, 0x002c2b4a, 0x002c2cc6, 0x002c4215, 0x002c4295, 0x002c4415, 0x002c48b1,
+    0x002c6a91, 0x002c6b11, 0x002c6c91, 0x002c7131, 0x002cb48e, 0x002cb90a, 0x002cba86, 0x002d10c9,
+    0x002d5219, 0x002d7572, 0x002d7ab2, 0x002d8819, 0x002d8c99, 0x002e7b15, 0x002e7fb1, 0x002ed9b2,
+    0x002ee2b2, 0x002fd455, 0x002ffcd1, 0x00306675, 0x003067e9, 0x0030d969, 0x0030dae9, 0x0030dff1,
+    0x0030e171, 0x00310c09, 0x00311569, 0x003115f5, 0x00311769, 0x00311bf1, 0x003148c9, 0x00315415,
+    0x00315895, 0x0031ad72, 0x0031b2b2, 0x0031c48e, 0x0031f4d5, 0x0031f6f1, 0x00321d51, 0x00321ed1,
+    0x00324de9, 0x00327889, 0x003281e9, 0x00328275, 0x003283e9, 0x00328869, 0x0032b78e, 0x0032f209,
+    0x0032fd69, 0x003301f1, 0x00331ab2, 0x00334905, 0x00334c51, 0x00334cd1, 0x00334e51, 0x003352d1,
+    0x003364c9, 0x0033724a, 0x00339e19, 0x00339f99, 0x0033a49a, 0x0033a619, 0x0033b1b1, 0x0033b219,
+    0x0033b399, 0x0033b819, 0x0033c34a, 0x0033da29, 0x0033dab5, 0x0033dc19, 0x0033e099, 0x0034b64a,
+    0x0034b7c6, 0x0034cd15, 0x0034cd95, 0x0034cf29, 0x0034d3b1, 0x00358a95, 0x00358c19, 0x003691ea,
+    0x00369369, 0x0036b569, 0x0036ba75, 0x0036bbe9, 0x0036c7f5, 0x0036c969, 0x0036cde9, 0x0036d845,
+    0x0036db91, 0x0036dc11, 0x0036dda9, 0x0037018a, 0x00372d69, 0x00372ee9, 0x003733f1, 0x003740f1,
+    0x0037417e, 0x003742fe, 0x00374771, 0x0037528a, 0x00375406, 0x00376969, 0x003769f5, 0x00376b69,
+    0x00376ff1, 0x00378f4a, 0x00379cc9, 0x0037a615, 0x0037a695, 0x0037a815, 0x0037aca9, 0x0038188e,
+    0x00381d0a, 0x003899e9, 0x00389b69, 0x0038a06a, 0x0038a1e9, 0x0038ad71, 0x0038adea, 0x0038af69,
+    0x0038b3ea, 0x0038d5e9, 0x0038d675, 0x0038d7e9, 0x0038dc69, 0x00390b8e, 0x00394f69, 0x00394fe9,
+    0x00395169, 0x00401e45, 0x00402149, 0x004021c9, 0x004022c5, 0x00403415, 0x00403895, 0x00403a15,
+    0x00403ab1, 0x00404795, 0x00404815, 0x00404c15, 0x00404c95, 0x00405c91, 0x00405d45, 0x00406111,
+    0x004062a5, 0x0040633d, 0x0040730a, 0x00407606, 0x00408089, 0x0040d625, 0x0040d6c5, 0x0040dab9,
+    0x0040dc11, 0x0040dc91, 0x0040e38e, 0x0040ec8a, 0x0040ef86, 0x0040f70d, 0x0040f78d, 0x00410089,
+    0x00410c0e, 0x0041150a, 0x00411806, 0x00411902, 0x00413009, 0x00413b65, 0x00413ff9, 0x00414165,
+    0x004141fd, 0x004163e5, 0x00416879, 0x004169dd, 0x00417765, 0x004177e5, 0x00417bf9, 0x00417c79,
+    0x0041dd5d, 0x0041e1dd, 0x0041e365, 0x0041ef5d, 0x0041f0e5, 0x0041f17d, 0x0041f565, 0x0041f5fd,
+    0x004217dd, 0x0042195d, 0x00421ddd, 0x00422bde, 0x004242a5, 0x00424345, 0x00424711, 0x00424891,
+    0x00424911, 0x0042500e, 0x0042590a, 0x00425c06, 0x00425d02, 0x0042638d, 0x0042640d, 0x00426d09,
+    0x0042818a, 0x00428486, 0x00428582, 0x00429c89, 0x0042a7e5, 0x0042ac59, 0x0042ade5, 0x0042ae7d,
+    0x0042d065, 0x0042d4d9, 0x0042d659, 0x0042e3e5, 0x0042e465, 0x0042e859, 0x0042e8d9, 0x0042fb0a,
+    0x004325f9, 0x00432755, 0x004327d5, 0x0043574e, 0x0043604a, 0x00436346, 0x00436442, 0x00437851,
+    0x004378d1, 0x00437fce, 0x004388ca, 0x00438bc6, 0x00438cc2, 0x0043c365, 0x0043c7d5, 0x0043c955,
+    0x0043c9f1, 0x0043d6e5, 0x0043d76d, 0x0043db55, 0x0043dbd5, 0x0043dd55, 0x0043ebe5, 0x0043f051,
+    0x0043f1e5, 0x0043f94e, 0x0044024a, 0x00440546, 0x00440642, 0x004427e5, 0x00442865, 0x00442c51,
+    0x00442ce6, 0x00442e51, 0x00445f45, 0x00446319, 0x00446341, 0x00446491, 0x00446511, 0x004467c1,
+    0x00446911, 0x00446991, 0x00447509, 0x00447805, 0x00447901, 0x00447c85, 0x00447d81, 0x00449d89,
+    0x0044a085, 0x0044a181, 0x0044a505, 0x0044b659, 0x0044bad9, 0x0044bc65, 0x0044c859, 0x0044c9e5,
+    0x0044ca7d, 0x0044ce65, 0x0044cefd, 0x0044f0d9, 0x0044f259, 0x0044f2f1, 0x0044f6d9, 0x0044f771,
+    0x004504da, 0x00451725, 0x00451a25, 0x00451b25, 0x00451bc1, 0x00451d09, 0x00451eb9, 0x00452085,
+    0x00452101, 0x00452fe5, 0x00453085, 0x00453479, 0x00453481, 0x004535d5, 0x00453671, 0x00454365,
+    0x004543e5, 0x004547f9, 0x00454879, 0x004549d5, 0x00455865, 0x00455905, 0x00455cf9, 0x00455e65,
+    0x00455efd, 0x004565ce, 0x00456eca, 0x004571c6, 0x004572c2, 0x00459465, 0x004594e5, 0x00459ad1,
+    0x0045e3d5, 0x0045e555, 0x0045e5f1, 0x0045e9d5, 0x0045ea71, 0x0045f956, 0x00460c51, 0x00460de5,
+    0x00461265, 0x00464a52, 0x00469b95, 0x0046af95, 0x0046b415, 0x0046d489, 0x0046e8bd, 0x00474b0d,
+    0x00475f0d, 0x00478f5d, 0x0047955d, 0x0047983d, 0x0047a2f2, 0x0047a37d, 0x0047a97d, 0x0047cb5d,
+    0x0047cbdd, 0x0047df5d, 0x0047e3f9, 0x0048435d, 0x004844dd, 0x0048577d, 0x004858fd, 0x00485d7d,
+    0x0048b78d, 0x0048cb8d, 0x0048fbd9, 0x004901d9, 0x004904bd, 0x0049147d, 0x004915fd, 0x004937d9,
+    0x00494bd9, 0x00495059, 0x00497b55, 0x00498f55, 0x0049bf7d, 0x0049e74d, 0x004a5b85, 0x004a5f4d,
+    0x004a60cd, 0x004a63c9, 0x004bc805, 0x004bcbf9, 0x004bcd4d, 0x004bd049, 0x004ceec5, 0x004cf1c9,
+    0x004d0495, 0x004d0915, 0x004d0a95, 0x004d0b21, 0x004d1815, 0x004d1895, 0x004d1c95, 0x004d1d15,
+    0x004d2d11, 0x004d2dc5, 0x004d3191, 0x004d3335, 0x004d33bd, 0x004d438a, 0x004d4686, 0x004d5109,
+    0x004db40e, 0x004dbd0a, 0x004dc006, 0x004dc80d, 0x004dd109, 0x004ddc8e, 0x004de58a, 0x004e0bf1,
+    0x004e1079, 0x004e127d, 0x004e3471, 0x004e38f9, 0x004e3a5d, 0x004e3ae1, 0x004e47f1, 0x004e4871,
+    0x004e4c79, 0x004e4cf9, 0x004eaddd, 0x004eb25d, 0x004ebfdd, 0x004ec1fd, 0x004ec67d, 0x004ee85d,
+    0x004ee9dd, 0x004eea61, 0x004eee5d, 0x004eeee1, 0x004efc5e, 0x004f208e, 0x004f298a, 0x004f340d,
+    0x004f348d, 0x004f3d89, 0x004f6d09, 0x004f7861, 0x004f7cd9, 0x004f7e75, 0x004f7efd, 0x004fa0e1,
+    0x004fa559, 0x004fa6d9, 0x004fa761, 0x004fb461, 0x004fb4e1, 0x004fb8d9, 0x004fb959, 0x004ff679,
+    0x004ff7d5, 0x004ff855, 0x005027ce, 0x005030ca, 0x005033c6, 0x005034c2, 0x0050504e, 0x0050594a,
+    0x00505c46, 0x00505d42, 0x0050a761, 0x0050a7ed, 0x0050abd5, 0x0050ac55, 0x0050add5, 0x005198d9,
+    0x00519a75, 0x00519afd, 0x00519ef5, 0x0051d55a, 0x005358ad, 0x00535d2d, 0x00535ead, 0x00535f2d,
+    0x0053978a, 0x0053bded, 0x0053c26d, 0x0053e66d, 0x0053eaed, 0x0053ec6d, 0x0053f9ed, 0x0053fa6d,
+    0x0053fe6d, 0x0053feed, 0x0054110a, 0x00541406, 0x00543d6d, 0x00543ded, 0x00546d4e, 0x00557d8a,
+    0x0055a86d, 0x0055a9ed, 0x0055aa6d, 0x0055d9ce, 0x0056d9ad, 0x0056da2d, 0x0056ec6d, 0x0056eded,
+    0x0056ee6d, 0x005751ad, 0x00577a2d, 0x00577bad, 0x00578dad, 0x00578e2d, 0x00578fad, 0x005799ad,
+    0x00579cad, 0x0057a12d, 0x0057b26d, 0x0057b6ed, 0x0057c5ed, 0x0057c66d, 0x0057ca6d, 0x0057caed,
+    0x0057daed, 0x0057df6d, 0x0058552d, 0x00585a6d, 0x00585aed, 0x00586aca, 0x00586dc6, 0x00586ec2,
+    0x0058934a, 0x0058e82d, 0x0058fc2d, 0x0059086d, 0x005909ed, 0x00590a6d, 0x00590e6d, 0x00590eed,
+    0x00595bad, 0x0059602d, 0x00596dad, 0x0059962d, 0x005997ad, 0x00599c2d, 0x005a11d9, 0x005a187d,
+    0x005a23f2, 0x005a25fd, 0x005a4c59, 0x005a4dd9, 0x005a4e59, 0x005a6059, 0x005a61d9, 0x005a6659,
+    0x005a9155, 0x005a91d5, 0x005aa555, 0x005afd4d, 0x005b79c9, 0x005bfc55, 0x005bfdd5, 0x005bfe55,
+    0x005c1055, 0x005c11d5, 0x005c3ff2, 0x005c41fd, 0x005c69cd, 0x005cbb4d, 0x005cff32, 0x005d03b2,
+    0x005d05bd, 0x005d27b1, 0x005d2c39, 0x005d2dad, 0x005d2e2d, 0x005d3b32, 0x005d3bb1, 0x005d3fb2,
+    0x005d4039, 0x005d41ad, 0x005d95c9, 0x005da12d, 0x005da5ad, 0x005da735, 0x005da7bd, 0x005db332,
+    0x005db4b2, 0x005db9bd, 0x005ddbad, 0x005ddd2d, 0x005dddad, 0x005de1ad, 0x005de22d, 0x005de3ad,
+    0x005defad, 0x005df12d, 0x005df5ad, 0x005f0249, 0x005f0db1, 0x005f1239, 0x005f13b5, 0x005f143d,
+    0x005f49b1, 0x005f4a31, 0x005f4eb9, 0x005f502d, 0x005f5db1, 0x005f6239, 0x005fc1ad, 0x005fc335,
+    0x005fc3bd, 0x005fd5bd, 0x005fffad, 0x006538d5, 0x006560d1, 0x0066e859, 0x00675bd5, 0x00678451,
+    0x00678a51, 0x0068c855, 0x0068f0d1, 0x0068f6d1, 0x00696a51, 0x0069cfad, 0x0069d439, 0x0069d5ad,
+    0x0069d63d, 0x0069f836, 0x0069fcb6, 0x0069fe2d, 0x006a0bad, 0x006a0c36, 0x006a1039, 0x006a10b6,
+    0x006a71ad, 0x006a7632, 0x006a77b2, 0x006a83ad, 0x006a852d, 0x006a89b2, 0x006a8a32, 0x006a8bb2,
+    0x006aac36, 0x006aadad, 0x006aae36, 0x006ab232, 0x006ab2b2, 0x006ac036, 0x006b8af9, 0x006b8c51,
+    0x006b8cd1, 0x006b9cc9, 0x006b9fc5, 0x006ba0c1, 0x006bc549, 0x006bc845, 0x006bc941, 0x006bde2d,
+    0x006be2b9, 0x006be42d, 0x006bf039, 0x006bf1ad, 0x006bf23d, 0x006bf639, 0x006bf83d, 0x006c18b6,
+    0x006c1a2d, 0x006c1ab6, 0x006c2cb6, 0x006c93ad, 0x006c9832, 0x006ca7bd, 0x006ef0dd, 0x006ef2dd,
+    0x00703dbd, 0x00705fad, 0x00706036, 0x007073ad, 0x00707839, 0x0070b07e, 0x0070d7ad, 0x0070d92d,
+    0x0070f1b2, 0x00710151, 0x0071c9d9, 0x0071d059, 0x00724439, 0x007245ad, 0x0072463d, 0x0072bed5,
+    0x0072c371, 0x0079eacd, 0x0079f3c9, 0x007a3519, 0x007a6b19, 0x007a6f99, 0x007ae9dd, 0x007b52c9,
+    0x007b5e39, 0x007b6295, 0x007bce8e, 0x007c51d9, 0x007d4965, 0x007d4ae5, 0x007dbc65, 0x007dbdf9,
+    0x007dc2e5, 0x007dc479, 0x007def09, 0x007df87d, 0x007df8e5, 0x007dfa79, 0x007dfee5, 0x007e2bc9,
+    0x007e3715, 0x007e3b95, 0x007ea78e, 0x007f30e5, 0x007f5b89, 0x007f64fd, 0x007f6565, 0x007f66e5,
+    0x007f6b65, 0x007f9a8e, 0x007fd509, 0x007fe079, 0x007fe4e5, 0x00802c05, 0x00802f51, 0x00802fd1,
+    0x00803151, 0x008035d1, 0x008047c9, 0x0080554a, 0x008056c6, 0x00808119, 0x0080829a, 0x00808799,
+    0x00808919, 0x00809519, 0x00809699, 0x00809b19, 0x0080a64a, 0x0080a7c6, 0x0080bd3d, 0x0080bda5,
+    0x0080bf19, 0x0080c399, 0x00814b5d, 0x0081994a, 0x00819ac6, 0x0081a6c9, 0x0081b015, 0x0081b095,
+    0x0081b239, 0x0081b6a5, 0x0082228e, 0x0082270a, 0x00825241, 0x008253c1, 0x00826715, 0x00826895,
+    0x00826d95, 0x00826f19, 0x00827ab1, 0x00827b15, 0x00827c95, 0x00828115, 0x0082b7d9, 0x0082cc25,
+    0x0082cd91, 0x0082d211, 0x00830911, 0x00830a91, 0x00830f91, 0x00831111, 0x0083674d, 0x00836bc9,
+    0x00836e71, 0x00836ff1, 0x008374e5, 0x00837665, 0x008396fd, 0x0083987d, 0x00839d65, 0x00839ee5,
+    0x0083aae5, 0x0083ac65, 0x0083b0e5, 0x0083bb45, 0x0083bd41, 0x0083be91, 0x0083bf11, 0x0083c0b9,
+    0x0083c525, 0x0083e48a, 0x0083e606, 0x0083e682, 0x00841065, 0x008411f9, 0x008416e5, 0x008423f1,
+    0x00842465, 0x008425f9, 0x00842a65, 0x0084358a, 0x00843706, 0x00843782, 0x00844c7d, 0x00844ce5,
+    0x00844e79, 0x008452e5, 0x0084724a, 0x008473c6, 0x00847fc9, 0x00848915, 0x00848995, 0x00848b15,
+    0x00848fa5, 0x0084fb8e, 0x0085000a, 0x00850186, 0x00852b11, 0x00852b91, 0x00852d11, 0x008531a5,
+    0x00857ce5, 0x00857e66, 0x00858365, 0x008584e5, 0x00859071, 0x008590e5, 0x00859266, 0x008596e5,
+    0x0085b8fd, 0x0085b965, 0x0085bae5, 0x0085bf65, 0x0085ee8e, 0x00863265, 0x008632e5, 0x00863479,
+    0x008d5a71, 0x008d67d9, 0x008dd1d5, 0x008dfa51, 0x008dfc51, 0x008e174d, 0x008eda76, 0x008f39d5,
+    0x008f6251, 0x008f68d1, 0x008f83cd, 0x008fdbf1, 0x008fe051, 0x00904131, 0x009045ad, 0x009047ad,
+    0x009069be, 0x00906e3e, 0x00907d3e, 0x00907db1, 0x009081be, 0x0090822d, 0x0090f6ba, 0x0090f73a,
+    0x0090fbad, 0x00911f3a, 0x0091b376, 0x009263b1, 0x009267b5, 0x0092682d, 0x00931276, 0x00931b76,
+    0x0094acf2, 0x00952e76, 0x009562dd, 0x009568dd, 0x0095ee49, 0x00962d59, 0x0096a931, 0x0096adad,
+    0x00971479, 0x00972655, 0x00973cf6, 0x00975d2d, 0x00975eba, 0x00977151, 0x00977751, 0x00983bd9,
+    0x009841d9, 0x009892d5, 0x0098c9b1, 0x0098e3d1, 0x009934d5, 0x00995d76, 0x0099cd05, 0x0099d051,
+    0x0099d0d1, 0x0099f64a, 0x0099f7c6, 0x009a2219, 0x009a2399, 0x009a2899, 0x009a2a19, 0x009a35a1,
+    0x009a3619, 0x009a3799, 0x009a3c19, 0x009a474a, 0x009a48c6, 0x009a5e3d, 0x009a5eb5, 0x009a6019,
+    0x009a6499, 0x009b5115, 0x009b5195, 0x009b5339, 0x009bc38e, 0x009bc80a, 0x009c0815, 0x009c0995,
+    0x009c1ba1, 0x009c1c15, 0x009c1d95, 0x009c2215, 0x009d0f61, 0x009d10e1, 0x009d15e1, 0x009d1761,
+    0x009d397d, 0x009d3e75, 0x009d3fe1, 0x009d4bf5, 0x009d4d61, 0x009d51e1, 0x009d858a, 0x009d8706,
+    0x009d8782, 0x009dc4e1, 0x009dc561, 0x009dc6f9, 0x009dcb71, 0x009ded7d, 0x009dedf5, 0x009f3161,
+    0x009f31e1, 0x00a05432, 0x00a055b2, 0x00a06315, 0x00a06795, 0x00a15cdd, 0x00a190fd, 0x00a192dd,
+    0x00a1975d, 0x00a1b332, 0x00a1b4b2, 0x00a20a5d, 0x00a20c79, 0x00a210f1, 0x00a2fd7d, 0x00a3f055,
+    0x00a462ce, 0x00a48c32, 0x00a48db2, 0x00a49f8e, 0x00a4e359, 0x00a4e559, 0x00a4e9d9, 0x00a5cf4e,
+    0x00a648ce, 0x00a69e4a, 0x00a69fc6, 0x00a6b52d, 0x00a6b5ad, 0x00a6b72d, 0x00a6bbad, 0x00a7a8de,
+    0x00a7aa5e, 0x00a7af5e, 0x00a7b0de, 0x00a7bced, 0x00a7be6d, 0x00a7c2ed, 0x00a7e6ed, 0x00a7eb6d,
+    0x00a85e6d, 0x00a85eed, 0x00a8c42d, 0x00a8c5ad, 0x00a8ca2d, 0x00a9155a, 0x00a916da, 0x00a91bda,
+    0x00a9296d, 0x00a92aed, 0x00a92f6d, 0x00a9536d, 0x00a957ed, 0x00a98ed6, 0x00a99056, 0x00a99556,
+    0x00a996d6, 0x00a9b752, 0x00a9b8d2, 0x00a9bdd2, 0x00a9bf52, 0x00a9f56d, 0x00a9f9ed, 0x00aa2d8a,
+    0x00aa2f06, 0x00aa446d, 0x00aa44ed, 0x00aa6ced, 0x00aa6d6d, 0x00aaf38e, 0x00ab376d, 0x00ab37ed,
+    0x00ab396d, 0x00abb0ed, 0x00abb16d, 0x00abb2ed, 0x00abd96d, 0x00abd9ed, 0x00abdb6d, 0x00b372c5,
+    0x00b375c9, 0x00b38895, 0x00b38945, 0x00b38d15, 0x00b38e95, 0x00b38f31, 0x00b390c9, 0x00b39149,
+    0x00b39c15, 0x00b39c95, 0x00b39d45, 0x00b3a095, 0x00b3a115, 0x00b3a295, 0x00b3b111, 0x00b3b1c5,
+    0x00b3b591, 0x00b3b725, 0x00b3b7a5, 0x00b3c78a, 0x00b3ca86, 0x00b3ccc5, 0x00b3d08d, 0x00b3d225,
+    0x00b3d2a5, 0x00b3d509, 0x00b3dba5, 0x00b3dea5, 0x00b4380e, 0x00b4410a, 0x00b44406, 0x00b44b8d,
+    0x00b44c0d, 0x00b45509, 0x00b45805, 0x00b4608e, 0x00b4698a, 0x00b48489, 0x00b48fe5, 0x00b49465,
+    0x00b495e5, 0x00b49665, 0x00b4b865, 0x00b4bce5, 0x00b4be5d, 0x00b4cbe5, 0x00b4cc65, 0x00b4d065,
+    0x00b4d0e5, 0x00b4d25d, 0x00b531dd, 0x00b5365d, 0x00b537e5, 0x00b543dd, 0x00b54565, 0x00b545e9,
+    0x00b549e5, 0x00b54a65, 0x00b56c5d, 0x00b56dea, 0x00b5725d, 0x00b5805e, 0x00b5a48e, 0x00b5ad8a,
+    0x00b5b80d, 0x00b5b88d, 0x00b5c189, 0x00b5c485, 0x00b5f109, 0x00b5fc7d, 0x00b600d9, 0x00b60265,
+    0x00b602e5, 0x00b624fd, 0x00b62959, 0x00b62ad9, 0x00b6387d, 0x00b638fd, 0x00b63cd9, 0x00b63d59,
+    0x00b63ed9, 0x00b67a65, 0x00b67bd5, 0x00b67c55, 0x00b6abce, 0x00b6b4ca, 0x00b6b7c6, 0x00b6b8c2,
+    0x00b6d44e, 0x00b6dd4a, 0x00b6e046, 0x00b6e142, 0x00b72b7d, 0x00b72bfd, 0x00b72fd5, 0x00b73055,
+    0x00b731d5, 0x00b81cd9, 0x00b81e65, 0x00b81ee5, 0x00b822e5, 0x00b82365, 0x00b8595a, 0x00b9e4c9,
+    0x00b9f015, 0x00b9f8c9, 0x00ba0415, 0x00ba0895, 0x00ba20c5, 0x00ba248d, 0x00ba260d, 0x00ba2919,
+    0x00ba34c5, 0x00ba388d, 0x00ba3a0d, 0x00ba3d1d, 0x00ba9f8d, 0x00bab38d, 0x00bad89d, 0x00bae85d,
+    0x00bae9dd, 0x00baec89, 0x00baf772, 0x00baf7dd, 0x00bafc69, 0x00bafddd, 0x00bb1fdd, 0x00bb205d,
+    0x00bb33dd, 0x00bb385d, 0x00bb97dd, 0x00bb995d, 0x00bbabdd, 0x00bbad5d, 0x00bbb1dd, 0x00bc0c0d,
+    0x00bc200d, 0x00bc4519, 0x00bc54d9, 0x00bc5659, 0x00bc590d, 0x00bc68d9, 0x00bc6a59, 0x00bc8c7d,
+    0x00bca07d, 0x00bca4d9, 0x00bccfd5, 0x00bce3d5, 0x00bd13cd, 0x00bd1cc9, 0x00bd3bcd, 0x00bdb005,
+    0x00bdb3cd, 0x00bdb54d, 0x00bdb87d, 0x00be1b81, 0x00be1d49, 0x00be1e45, 0x00be1f41, 0x00be2045,
+    0x00be4445, 0x00be4641, 0x00be47b1, 0x00be4815, 0x00be4995, 0x00be84d9, 0x00be9545, 0x00be9741,
+    0x00be9891, 0x00be9911, 0x00be9a91, 0x00bebe8a, 0x00bec006, 0x00bed611, 0x00bf1c85, 0x00bf204d,
+    0x00bf21cd, 0x00bf24c9, 0x00bf38c9, 0x00bf63e5, 0x00bf6565, 0x00bf6a65, 0x00bf6be5, 0x00bf7601,
+    0x00bf7771, 0x00bf77e5, 0x00bf8845, 0x00bf8a41, 0x00bf8b91, 0x00bf8c11, 0x00bf8d91, 0x00bfb18a,
+    0x00bfb306, 0x00bfdd65, 0x00bfdee5, 0x00bfef81, 0x00bff0f1, 0x00bff165, 0x00bff2e5, 0x00bff765,
+    0x00c0028a, 0x00c00406, 0x00c01801, 0x00c01965, 0x00c019e5, 0x00c01b65, 0x00c01fe5, 0x00c6ad29,
+    0x00c6b1a9, 0x00c6b329, 0x00c6b3a9, 0x00c6c38a, 0x00c6c686, 0x00c6ce29, 0x00c6cea9, 0x00c6d729,
+    0x00c6d7a9, 0x00c6daa9, 0x00c6ec0a, 0x00c6ef06, 0x00c70729, 0x00c71269, 0x00c71329, 0x00c716e9,
+    0x00c73ae9, 0x00c73f69, 0x00c740e9, 0x00c74e69, 0x00c74ee9, 0x00c752e9, 0x00c75369, 0x00c754e9,
+    0x00c7658a, 0x00c76886, 0x00c791e9, 0x00c79269, 0x00c7c1ce, 0x00c7cdc6, 0x00c8d20a, 0x00c8d506,
+    0x00c8fce9, 0x00c8fe69, 0x00c8fee9, 0x00c92e4e, 0x00c9374a, 0x00c93a46, 0x00ca2e29, 0x00ca2ea9,
+    0x00ca40e9, 0x00ca4269, 0x00ca42e9, 0x00caa629, 0x00cacea9, 0x00cad02a, 0x00cae229, 0x00cae2a9,
+    0x00cae429, 0x00caee29, 0x00caf129, 0x00caf229, 0x00caf6a9, 0x00cb06e9, 0x00cb0b69, 0x00cb0ce9,
+    0x00cb1a69, 0x00cb1ae9, 0x00cb1ee9, 0x00cb1f69, 0x00cb2f69, 0x00cb33e9, 0x00cbada9, 0x00cbaee9,
+    0x00cbaf69, 0x00cbc342, 0x00cbebc2, 0x00cc3ca9, 0x00cc50a9, 0x00cc5ce9, 0x00cc5e6a, 0x00cc5ee9,
+    0x00cc62e9, 0x00cc6369, 0x00ccb029, 0x00ccb4a9, 0x00ccc229, 0x00cceaa9, 0x00ccec2a, 0x00ccf0a9,
+    0x00cd208d, 0x00cd220d, 0x00cd228d, 0x00cd3432, 0x00cd348d, 0x00cd360d, 0x00cd5b09, 0x00cd6659,
+    0x00cd6ad9, 0x00cd6c75, 0x00cd6cd9, 0x00cd6f09, 0x00cd7032, 0x00cd7a5d, 0x00cd7ed9, 0x00cd8075,
+    0x00cda0d9, 0x00cda259, 0x00cda2d9, 0x00cdb4d9, 0x00cdb659, 0x00cdbad9, 0x00cde455, 0x00cde5d5,
+    0x00cde655, 0x00cde832, 0x00cde889, 0x00cdf3f1, 0x00cdf855, 0x00cdf9d5, 0x00ce15ce, 0x00ce2432,
+    0x00ce29cd, 0x00ce51cd, 0x00cece49, 0x00cf50d5, 0x00cf5255, 0x00cf52d5, 0x00cf64d5, 0x00cf6655,
+    0x00cf824e, 0x00cf964d, 0x00cf9f49, 0x00cfbe4d, 0x00d00fcd, 0x00d05832, 0x00d05a29, 0x00d080a9,
+    0x00d08229, 0x00d082a9, 0x00d09432, 0x00d094a9, 0x00d09629, 0x00d0ea49, 0x00d0f5bd, 0x00d0fa29,
+    0x00d0fbb5, 0x00d0fc29, 0x00d107b2, 0x00d10e29, 0x00d10fb5, 0x00d1303d, 0x00d131bd, 0x00d1323d,
+    0x00d13629, 0x00d136a9, 0x00d13829, 0x00d1443d, 0x00d145bd, 0x00d14a29, 0x00d1bb49, 0x00d256c9,
+    0x00d26231, 0x00d266a9, 0x00d26835, 0x00d268a9, 0x00d27631, 0x00d27c35, 0x00d29e31, 0x00d29eb1,
+    0x00d2a329, 0x00d2a4a9, 0x00d2b231, 0x00d2b6a9, 0x00d31629, 0x00d317b5, 0x00d31829, 0x00d32a29,
+    0x00d32bb5, 0x00d33035, 0x00d35429, 0x00da3cd9, 0x00da3d71, 0x00da4a59, 0x00da4add, 0x00da4f59,
+    0x00da50d9, 0x00daded1, 0x00dadf51, 0x00daf9cd, 0x00dafa4d, 0x00db0349, 0x00db0645, 0x00dc4b51,
+    0x00dc4bd1, 0x00dc664d, 0x00dc66cd, 0x00dc6fc9, 0x00dc72c5, 0x00dcbefd, 0x00dd243d, 0x00dd28a9,
+    0x00dd2a29, 0x00dd2aa9, 0x00dd4cb6, 0x00dd5136, 0x00dd52a9, 0x00dd603d, 0x00dd60b6, 0x00dd64a9,
+    0x00dd6536, 0x00ddc63d, 0x00ddcab2, 0x00ddcc32, 0x00ddd83d, 0x00ddd9bd, 0x00ddde32, 0x00dddeb2,
+    0x00dde032, 0x00de00b6, 0x00de06b2, 0x00de0732, 0x00de14b6, 0x00dedf51, 0x00df32a9, 0x00df3729,
+    0x00df38a9, 0x00df44a9, 0x00df4629, 0x00df46a9, 0x00df4aa9, 0x00df4b29, 0x00df4ca9, 0x00df6d36,
+    0x00df6ea9, 0x00df6f36, 0x00df8136, 0x00dfe829, 0x00dffc29, 0x00e39229, 0x00e3b43d, 0x00e3b4b6,
+    0x00e3c83d, 0x00e3cca9, 0x00e42c3d, 0x00e42dbd, 0x00e44632, 0x00e48d45, 0x00e49091, 0x00e49111,
+    0x00e49291, 0x00e4b68a, 0x00e4b806, 0x00e4b882, 0x00e4f659, 0x00e4f7d9, 0x00e5078a, 0x00e50906,
+    0x00e50982, 0x00e51e59, 0x00e51ef5, 0x00e52059, 0x00e55bd5, 0x00e56f71, 0x00e56fd5, 0x00e58451,
+    0x00e598a9, 0x00e59a29, 0x00e59aa9, 0x00e5c051, 0x00e5e7c6, 0x00e5e842, 0x00e5fa8a, 0x00e5fc06,
+    0x00e61155, 0x00e611d5, 0x00e61355, 0x00e639d1, 0x00e63a51, 0x00e66146, 0x00e661c2, 0x00e689c6,
+    0x00e68a42, 0x00f3938d, 0x00f3a78d, 0x00f3cc89, 0x00f3d7d9, 0x00f3dc59, 0x00f3ddd9, 0x00f3e0bd,
+    0x00f3f07d, 0x00f3f1fd, 0x00f413d9, 0x00f427d9, 0x00f42c59, 0x00f45755, 0x00f46b55, 0x00f4874e,
+    0x00f49b7d, 0x00f53fc9, 0x00f5c3d5, 0x00f5d7d5, 0x00f5f3ce, 0x00f610fd, 0x00f6cbbd, 0x00f6f3a5,
+    0x00f707a5, 0x00f75bc9, 0x00f7673d, 0x00f76ba5, 0x00f76d25, 0x00f77fbd, 0x00f7813d, 0x00f7a33d,
+    0x00f7b73d, 0x00f7bba5, 0x00f82cfd, 0x00f8a8fa, 0x00f8c849, 0x00f8d3a5, 0x00f8d839, 0x00f8d9a5,
+    0x00f8e7bd, 0x00f8edbd, 0x00f8f9fa, 0x00f90fa5, 0x00f91025, 0x00f920fa, 0x00f921fa, 0x00f923a5,
+    0x00f92839, 0x00f987a5, 0x00f98925, 0x00f99bbd, 0x00f99d3d, 0x00f9a1bd, 0x0106d3d5, 0x0106d855,
+    0x0106d9d5, 0x0106da55, 0x0106ebf2, 0x0106ec55, 0x0106edd5, 0x0106fc51, 0x010700d1, 0x01070275,
+    0x010702fd, 0x010709ce, 0x01071bf2, 0x01071dfd, 0x01072672, 0x010726fd, 0x010727f2, 0x010729fd,
+    0x010775f1, 0x01077a79, 0x01077bd1, 0x01077c51, 0x0107974d, 0x01079ff2, 0x0107a049, 0x0107a345,
+    0x0107db32, 0x0107dbf2, 0x0107dfb2, 0x0107e132, 0x0107e1bd, 0x010803b1, 0x01080839, 0x0108099d,
+    0x01080a1d, 0x01081732, 0x010817b1, 0x01081bb2, 0x01081c39, 0x01081d9d, 0x01087d1d, 0x0108819d,
+    0x01088335, 0x010883bd, 0x010895bd, 0x0108b79d, 0x0108b91d, 0x0108b99d, 0x0108be1d, 0x0108cb9e,
+    0x0108cd1e, 0x0108d19e, 0x0108e27d, 0x0108e6d1, 0x0108e851, 0x0108e8d1, 0x01090c72, 0x01090cc9,
+    0x01090fc5, 0x010947b2, 0x01094872, 0x01094c32, 0x01094db2, 0x01094e3d, 0x0109703d, 0x01097499,
+    0x01097619, 0x01097699, 0x010983b2, 0x0109843d, 0x01098832, 0x01098899, 0x01098a19, 0x0109c5b2,
+    0x0109c732, 0x0109c795, 0x010a6795, 0x010a6915, 0x010a6995, 0x010a76b2, 0x010a9011, 0x010a91b5,
+    0x010a923d, 0x010a990e, 0x010b5619, 0x010b5a99, 0x010b5c35, 0x010b69b2, 0x010b6a3d, 0x010b6e32,
+    0x010b6ebd, 0x010b9299, 0x010bcfb1, 0x010bd439, 0x010bd595, 0x010bd615, 0x010be332, 0x010be3b1,
+    0x010be7b2, 0x010be839, 0x010bf831, 0x010bfcb9, 0x010bfe35, 0x010bfebd, 0x010c058e, 0x010c8515,
+    0x010c8595, 0x010c8995, 0x010c8a15, 0x010cadb5, 0x010cae3d, 0x010cb235, 0x010cb2bd, 0x0113a455,
+    0x0113a8d5, 0x0113aa55, 0x0113aaf1, 0x0113b7d5, 0x0113b855, 0x0113bcd6, 0x0113be55, 0x0113ccd1,
+    0x0113d151, 0x0113d2d1, 0x0113d37d, 0x0113ec4d, 0x0113edcd, 0x0113ee7d, 0x0113f0c9, 0x0113f77d,
+    0x0113fa7d, 0x01144651, 0x01144af9, 0x01144c51, 0x01144cd1, 0x0114674d, 0x011467cd, 0x011470c9,
+    0x011473c5, 0x0114a049, 0x0114ab9d, 0x0114b039, 0x0114b19d, 0x0114b23d, 0x0114d436, 0x0114d8b6,
+    0x0114da1d, 0x0114e79d, 0x0114e836, 0x0114ec39, 0x0114ecb6, 0x0114ee1d, 0x011553b2, 0x0115611d,
+    0x011565b2, 0x01156632, 0x011567b2, 0x0115b2fd, 0x0115b751, 0x0115b8d1, 0x0115b951, 0x0115d3cd,
+    0x0115d44d, 0x0115dd49, 0x0115e045, 0x01160cc9, 0x0116183d, 0x01161c99, 0x01161e19, 0x01161ebd,
+    0x011640b6, 0x01164536, 0x01164699, 0x0116543d, 0x011654b6, 0x01165899, 0x01165936, 0x01165a99,
+    0x011691bd, 0x01169639, 0x01169795, 0x01169815, 0x0116c78e, 0x011733bd, 0x01173832, 0x011739b2,
+    0x01173a32, 0x0117473d, 0x01175c3d, 0x011760b2, 0x01176232, 0x011762b2, 0x0117983d, 0x011798b6,
+    0x01179d32, 0x0117d351, 0x0117d4d1, 0x0117d551, 0x0117d951, 0x0117d9d6, 0x0117e549, 0x0117e845,
+    0x0117e941, 0x0117ecc5, 0x0117edc1, 0x01180dc9, 0x011810c5, 0x011811c1, 0x01181545, 0x01181641,
+    0x01182699, 0x01182b19, 0x01182c99, 0x01183899, 0x01183a19, 0x01183abd, 0x01183e99, 0x01183f3d,
+    0x01186336, 0x011867b6, 0x01188749, 0x01188a45, 0x01188b41, 0x01188d49, 0x01188ef9, 0x01188ff9,
+    0x011890c5, 0x01189141, 0x0118a015, 0x0118a0c5, 0x0118a4b9, 0x0118a4c1, 0x0118a615, 0x0118a6b1,
+    0x0118b239, 0x0118b395, 0x0118b415, 0x0118b839, 0x0118b8b9, 0x0118c891, 0x0118c945, 0x0118cd39,
+    0x0118cd41, 0x0118ce91, 0x0118cf3d, 0x0118df0a, 0x0118e206, 0x01190491, 0x01190536, 0x011909b6,
+    0x01195415, 0x01195595, 0x01195631, 0x01195a32, 0x01195ab2, 0x01197c91, 0x01197e11, 0x01197ebd,
+    0x011982b2, 0x01198332, 0x011f573a, 0x011f8131, 0x011f87b1, 0x011f933a, 0x011ff931, 0x011ffab1,
+    0x01200cb1, 0x01200d3e, 0x01200ebe, 0x01203531, 0x01203731, 0x012e434d, 0x012fb47d, 0x01306f3d,
+    0x013073a5, 0x0130b9fe, 0x0130bdbe, 0x0131233d, 0x013124ba, 0x013135be, 0x01317045, 0x01317391,
+    0x01317411, 0x01317591, 0x0131998a, 0x01319b06, 0x01319b82, 0x0131d959, 0x0131dad9, 0x0131ea8a,
+    0x0131ec06, 0x0132017d, 0x013201d9, 0x01320359, 0x01323ed5, 0x01325271, 0x013252d5, 0x01326751,
+    0x01328fa5, 0x0132a3d1, 0x0132cac6, 0x0132cb42, 0x0132dd8a, 0x0132df06, 0x0132f455, 0x0132f4d5,
+    0x0132f679, 0x01331cd1, 0x01331d51, 0x01332351, 0x01334446, 0x013344c2, 0x01336cc6, 0x01336d42,
+    0x0141899d, 0x0142f1bd, 0x0145c8b2, 0x0145f132, 0x0145f2b2, 0x0145f7b1, 0x0145f931, 0x01460532,
+    0x01466ab1, 0x01466c36, 0x01467e36, 0x01467eb1, 0x01468036, 0x014684b6, 0x0146a6bd, 0x0146a731,
+    0x0146a8b9, 0x0146ad31, 0x01542d7d, 0x01542df5, 0x01542f59, 0x015433d9, 0x01552055, 0x015520d5,
+    0x01552279, 0x015526f1, 0x0155c2be, 0x0155c43e, 0x0155eb7e, 0x0155ecfe, 0x0155f155, 0x01563c7e,
+    0x01563dfe, 0x01564251, 0x01571cbe, 0x01572131, 0x01572f7e, 0x015730fe, 0x01573571, 0x015780be,
+    0x0157943e, 0x015794be, 0x0157963e, 0x01579ab1, 0x0157bcbe, 0x0157bd3e, 0x0157bebe, 0x0157c331,
+    0x0157e28a, 0x0157f955, 0x0157f9d5, 0x0157fb55, 0x0157ffd5, 0x01589b51, 0x01589bd1, 0x0158a1d1,
+    0x0158ed31, 0x0158eeb1, 0x0158f3b1, 0x0158f531, 0x015900b1, 0x01590131, 0x015902b1, 0x01590731,
+    0x0159293d, 0x015929b5, 0x01592b31, 0x01592fb1, 0x0159a2b1, 0x0159a331, 0x0159a4b9, 0x0159a931,
+    0x0166d505, 0x0166d851, 0x0166d8d1, 0x0166e285, 0x0166e64d, 0x0166e7cd, 0x0166f0c9, 0x0166fe4a,
+    0x0166ffc6, 0x01672a19, 0x01672b9a, 0x01673099, 0x01673219, 0x01673e19, 0x01673f99, 0x01674419,
+    0x01674f4a, 0x016750c6, 0x01675cc9, 0x016762c5, 0x01676625, 0x016766a5, 0x01676819, 0x01676c99,
+    0x01684fc9, 0x01685915, 0x01685995, 0x01685b25, 0x01685fa5, 0x0168cb8e, 0x0168d00a, 0x0168d186,
+    0x01691015, 0x01691195, 0x01692241, 0x016923b1, 0x01692415, 0x01692595, 0x01692a15, 0x01699c06,
+    0x01699c82, 0x016a1771, 0x016a18f1, 0x016a1dea, 0x016a1f65, 0x016a4165, 0x016a4665, 0x016a47e5,
+    0x016a53e5, 0x016a5565, 0x016a59e5, 0x016a8d8a, 0x016a8f06, 0x016a8f82, 0x016accf1, 0x016acd65,
+    0x016acee5, 0x016ad365, 0x016af565, 0x016af5e5, 0x016c3971, 0x016c39ea, 0x017b55f2, 0x017bd776,
+    0x017c0b5d, 0x017c0bdd, 0x017c0d5d, 0x017c11dd, 0x017dbd55, 0x017de5f6, 0x017ee459, 0x017ee4d9,
+    0x017fd955, 0x017fddfd, 0x01800676, 0x018d474a, 0x018d48c6, 0x018d54e9, 0x018d5e29, 0x018d5ea9,
+    0x018d6029, 0x018d64a9, 0x018dd08e, 0x018dd50a, 0x018dd686, 0x018e51de, 0x018e535e, 0x018e585e,
+    0x018e59de, 0x018e65ea, 0x018e6769, 0x018e6bea, 0x018e8fe9, 0x018e9469, 0x018ec38e, 0x018f0769,
+    0x018f07e9, 0x018f6b69, 0x018f6ca9, 0x018f6d29, 0x018f6ea9, 0x018f7329, 0x018f9406, 0x018f9482,
+    0x018fbe5a, 0x018fbfda, 0x018fc4da, 0x018fc65a, 0x018fd269, 0x018fd3e9, 0x018fd869, 0x018fe582,
+    0x018ffc69, 0x019000e9, 0x01903956, 0x01903e56, 0x01903fd6, 0x01904be9, 0x01904d69, 0x019051e9,
+    0x01906052, 0x019061d2, 0x019066d2, 0x01906852, 0x01909e69, 0x0190a2e9, 0x0190d68a, 0x0190d806,
+    0x0190d882, 0x0190ed69, 0x0190ede9, 0x019115e9, 0x01911669, 0x01919c8e, 0x0191a10a, 0x0191e069,
+    0x0191e0e9, 0x0191e269, 0x019259e9, 0x01925a69, 0x01925be9, 0x01928269, 0x019282ea, 0x01928469,
+    0x01b7d931, 0x01b7ecb1, 0x01c7038d, 0x01c70c89, 0x01c75971, 0x01c77889, 0x01c781d9, 0x01c78275,
+    0x01c783d9, 0x01c78859, 0x01c86b89, 0x01c874d5, 0x01c87555, 0x01c876d5, 0x01c87b71, 0x01c8e74e,
+    0x01c91605, 0x01c91701, 0x01c93e01, 0x01c93f71, 0x01c93fd5, 0x01c94155, 0x01c945d5, 0x01c98f01,
+    0x01c99051, 0x01c990f5, 0x01c99251, 0x01c996d1, 0x01c9b7c6, 0x01ca333a, 0x01ca34b1, 0x01ca39ba,
+    0x01ca3b3e, 0x01ca5bba, 0x01ca5d31, 0x01ca63b1, 0x01ca6f3a, 0x01ca6fba, 0x01ca7131, 0x01ca75ba,
+    0x01ca8201, 0x01ca8351, 0x01ca83d1, 0x01ca8551, 0x01ca89f1, 0x01caaac6, 0x01cad531, 0x01cad6b1,
+    0x01cadbbe, 0x01cae8b1, 0x01cae93e, 0x01caeabe, 0x01caef3e, 0x01cafbc6, 0x01cb1131, 0x01cb11b5,
+    0x01cb1331, 0x01cb17b1, 0x01cb4489, 0x01cb4dd5, 0x01cb4e55, 0x01cb4fd5, 0x01cb547d, 0x01cbc04e,
+    0x01cc41ba, 0x01cc4331, 0x01cc483a, 0x01cc49be, 0x01cc553a, 0x01cc55ba, 0x01cc573e, 0x01cc5bba,
+    0x01cc7dba, 0x01cc7e3a, 0x01cc7fb1, 0x01cc843a, 0x01ccb34e, 0x01ccf731, 0x01ccf7be, 0x01ccf93e,
+    0x02070781, 0x020708d1, 0x02070951, 0x020709c1, 0x02070b89, 0x02070c01, 0x02070d51, 0x02070dd1,
+    0x02070e85, 0x02071949, 0x02071c45, 0x02071e85, 0x020720c5, 0x020723d5, 0x02072462, 0x02072d49,
+    0x02073285, 0x02073655, 0x020737d5, 0x020741c9, 0x020744c5, 0x02074945, 0x02075a99, 0x02075f19,
+    0x02076099, 0x02076121, 0x02076c99, 0x02076e19, 0x02076e99, 0x02077299, 0x02077319, 0x02078385,
+    0x02078751, 0x020788d1, 0x02079519, 0x02079699, 0x02079721, 0x020798c9, 0x02079962, 0x02079b19,
+    0x02079ba1, 0x02079c62, 0x0207a919, 0x0207acc9, 0x0207be65, 0x0207bf65, 0x0207c001, 0x0207c149,
+    0x0207c1c9, 0x0207c2c5, 0x0207c3c1, 0x0207c4c5, 0x0207c541, 0x0207d425, 0x0207d4c5, 0x0207d895,
+    0x0207da15, 0x0207daa1, 0x0207e7a5, 0x0207e825, 0x0207ec15, 0x0207ec95, 0x0207fca5, 0x0207fd45,
+    0x02080111, 0x02080141, 0x02080291, 0x02080311, 0x0208130a, 0x02081606, 0x020820a5, 0x02087685,
+    0x02087a51, 0x02087bd1, 0x02088bc9, 0x02088c62, 0x02088f62, 0x02089fc9, 0x0208cd1d, 0x0208df9d,
+    0x0208e136, 0x0208f0c9, 0x02090462, 0x0209079d, 0x02090822, 0x020909a2, 0x02091b9d, 0x02092ac5,
+    0x02092bc1, 0x02092dc9, 0x02092e49, 0x02092f45, 0x02093041, 0x02093145, 0x020931c1, 0x02093549,
+    0x02094095, 0x02094515, 0x02094541, 0x02094695, 0x02094721, 0x020948c9, 0x02094949, 0x02095415,
+    0x02095495, 0x02095895, 0x02095915, 0x02096911, 0x020969c5, 0x02096d91, 0x02096dc1, 0x02096f11,
+    0x02096f91, 0x0209768e, 0x02097f8a, 0x02098286, 0x020984c5, 0x0209888d, 0x02098a0d, 0x02098a8d,
+    0x02098d09, 0x0209e2a5, 0x0209e345, 0x0209e711, 0x0209e891, 0x0209e911, 0x0209f00e, 0x0209f90a,
+    0x0209fc06, 0x020a038d, 0x020a040d, 0x020a218a, 0x020a2486, 0x020a3c89, 0x020a47e5, 0x020a4885,
+    0x020a4c61, 0x020a4c81, 0x020a4de1, 0x020a4e61, 0x020a6509, 0x020a7065, 0x020a7105, 0x020a74e1,
+    0x020a7501, 0x020a7661, 0x020a76e1, 0x020a83e5, 0x020a8465, 0x020a8861, 0x020a88e1, 0x020a9811,
+    0x020a9891, 0x020a9c91, 0x020a9d11, 0x020a9e91, 0x020ade89, 0x020ae9e1, 0x020aea85, 0x020aee61,
+    0x020aee81, 0x020aefe1, 0x020af061, 0x020afbe1, 0x020afd65, 0x020afde9, 0x020b01e1, 0x020b0261,
+    0x020b03e5, 0x020b2461, 0x020b25ea, 0x020b2661, 0x020b2a61, 0x020b2ae1, 0x020b2c61, 0x020b3861,
+    0x020b4389, 0x020b4685, 0x020b4d45, 0x020b4dc1, 0x020b4f85, 0x020b5351, 0x020b54d1, 0x020b5685,
+    0x020b5bcd, 0x020b5c62, 0x020b6141, 0x020b6295, 0x020b6321, 0x020b64c9, 0x020b6e4d, 0x020b6fcd,
+    0x020b78c9, 0x020b89c1, 0x020b8b19, 0x020b8b91, 0x020b9e85, 0x020b9f81, 0x020ba619, 0x020bb899,
+    0x020bba36, 0x020bbb85, 0x020bbf4d, 0x020bc0cd, 0x020bc9c9, 0x020bd0c9, 0x020bd162, 0x020bd462,
+    0x020bdc19, 0x020be0a9, 0x020be122, 0x020be2a2, 0x020be4d9, 0x020bee99, 0x020bf019, 0x020bf499,
+    0x020c04a5, 0x020c0525, 0x020c0911, 0x020c0991, 0x020c0b11, 0x020c1825, 0x020c1925, 0x020c40a5,
+    0x020c41a5, 0x020c4b09, 0x020c5665, 0x020c5705, 0x020c5ae1, 0x020c5b01, 0x020c5c61, 0x020c5ce1,
+    0x020c6865, 0x020c6a65, 0x020c6e65, 0x020c6ee9, 0x020c7065, 0x020c90e5, 0x020c9265, 0x020c96fe,
+    0x020c9761, 0x020c98e1, 0x020c9f8d, 0x020ca4e5, 0x020ca889, 0x020cae85, 0x020cb24d, 0x020cb3cd,
+    0x020cba91, 0x020cbcc9, 0x020cc3c9, 0x020cc462, 0x020cc762, 0x020ccf15, 0x020cd395, 0x020cd422,
+    0x020cd5a2, 0x020cd7d5, 0x020ce195, 0x020ce315, 0x020ce795, 0x020d0be1, 0x020d0c61, 0x020d1936,
+    0x020d1fe5, 0x020d2236, 0x020d28d1, 0x020d3291, 0x020d3411, 0x020d3891, 0x020d3c62, 0x020d3f8d,
+    0x020d41a2, 0x020d4861, 0x020d4aa2, 0x020d7045, 0x020d74c5, 0x020d8615, 0x020d8849, 0x020d8a95,
+    0x020d8b45, 0x020d8c15, 0x020d9995, 0x020d9a15, 0x020d9a81, 0x020d9bc9, 0x020d9c49, 0x020d9e15,
+    0x020d9e95, 0x020d9f45, 0x020dae91, 0x020db311, 0x020db491, 0x020db511, 0x020ddd19, 0x020ddd99,
+    0x020dff99, 0x020e0045, 0x020e0419, 0x020e0599, 0x020e1445, 0x020e1799, 0x020e1819, 0x020e1999,
+    0x020e2825, 0x020e28c5, 0x020e2c91, 0x020e2e11, 0x020e2e91, 0x020e3e8a, 0x020e670a, 0x020e6a06,
+    0x020e8d65, 0x020e91dd, 0x020e935d, 0x020e93dd, 0x020eb5e5, 0x020eba5d, 0x020ebbdd, 0x020ec965,
+    0x020ec9e5, 0x020ecddd, 0x020ece5d, 0x020ef295, 0x020ef345, 0x020ef715, 0x020ef895, 0x020f0745,
+    0x020f0a95, 0x020f0b15, 0x020f0c95, 0x020f2f5d, 0x020f3189, 0x020f33dd, 0x020f355d, 0x020f415d,
+    0x020f42dd, 0x020f435d, 0x020f4509, 0x020f4589, 0x020f475d, 0x020f47dd, 0x020f69dd, 0x020f6b6a,
+    0x020f6d89, 0x020f6fdd, 0x020f7dde, 0x020f819d, 0x020f9499, 0x020f9545, 0x020f9911, 0x020f9a91,
+    0x020f9b11, 0x020fa20e, 0x020fab0a, 0x020fae06, 0x020fb58d, 0x020fb60d, 0x020fd38a, 0x020fd686,
+    0x020fee89, 0x020ff9d9, 0x020ffe59, 0x020fffd9, 0x02100059, 0x02102259, 0x021026d9, 0x02102859,
+    0x02102a89, 0x02102b09, 0x021035d9, 0x02103659, 0x02103a59, 0x02103ad9, 0x02104d0a, 0x021077d5,
+    0x02107955, 0x021079d5, 0x0210a94e, 0x0210b24a, 0x0210b546, 0x0210d1ce, 0x0210daca, 0x0210ddc6,
+    0x0210e54d, 0x0210e5cd, 0x02111555, 0x021128d5, 0x02112955, 0x02112d55, 0x02112dd5, 0x02112f55,
+    0x02113dd1, 0x02114b4e, 0x0211544a, 0x02115746, 0x02119789, 0x02119a85, 0x0211a385, 0x0211a765,
+    0x0211a8e5, 0x0211b145, 0x0211b511, 0x0211b691, 0x0211b711, 0x0211c049, 0x0211c345, 0x0211c709,
+    0x0211ca05, 0x0211cb95, 0x0211d015, 0x0211d195, 0x0211d3c9, 0x0211d449, 0x0211d745, 0x0211e045,
+    0x0211e395, 0x0211e415, 0x0211e595, 0x0211ef89, 0x0211f285, 0x02120859, 0x0212150d, 0x0212158d,
+    0x02121a59, 0x02121bd9, 0x02121c59, 0x02123845, 0x02123c0d, 0x02123d8d, 0x021242d9, 0x02124459,
+    0x021246a9, 0x02124c59, 0x02124f99, 0x02125019, 0x02125199, 0x02125a99, 0x02126925, 0x021281e5,
+    0x021293e5, 0x02129565, 0x021295e5, 0x021299d5, 0x02129a55, 0x02129bd5, 0x0212aa65, 0x0212b7ce,
+    0x0212c0ca, 0x0212c3c6, 0x0212d8e5, 0x0212d965, 0x0212fb66, 0x0212ffe9, 0x02130169, 0x02130409,
+    0x02130705, 0x02131005, 0x02131369, 0x021313e5, 0x02131565, 0x02132b45, 0x02132f0d, 0x0213308d,
+    0x02133989, 0x02133f55, 0x02134295, 0x02134315, 0x02134495, 0x02134b56, 0x02134d95, 0x02135fd1,
+    0x02136989, 0x021374e5, 0x02137965, 0x02137ae5, 0x02137d09, 0x02137d89, 0x02138085, 0x02138865,
+    0x021388e5, 0x02138985, 0x02138ce5, 0x02138d65, 0x02138ee6, 0x0213a589, 0x0213af65, 0x0213b0e9,
+    0x0213b569, 0x0213da85, 0x0213de51, 0x0213dfd1, 0x0213ed95, 0x0213ee15, 0x0213ee81, 0x0213efc9,
+    0x0213f049, 0x0213f345, 0x021403c9, 0x02140615, 0x02143119, 0x02143199, 0x02144399, 0x02144536,
+    0x021454c9, 0x02146845, 0x02146b99, 0x02146c19, 0x02146d99, 0x02147f99, 0x02148a65, 0x0214a025,
+    0x0214b3a5, 0x0214b425, 0x0214b525, 0x0214e7dd, 0x0214efa5, 0x0214f365, 0x0214f4e5, 0x0214f565,
+    0x0214fb65, 0x02151be6, 0x02151d65, 0x02151de5, 0x0215225d, 0x02152f65, 0x02152fe5, 0x02153165,
+    0x021535dd, 0x021547c9, 0x02155b45, 0x02155e95, 0x02155f15, 0x02156095, 0x02156c15, 0x02157295,
+    0x0215955d, 0x021596dd, 0x02159909, 0x02159989, 0x0215a95d, 0x0215aae5, 0x0215af65, 0x0215c391,
+    0x0215d589, 0x0215f0c9, 0x0215f245, 0x0215f6c5, 0x0215fa95, 0x0215fc15, 0x02160445, 0x0216080d,
+    0x0216098d, 0x02160a0d, 0x02160c95, 0x02161845, 0x02161b8d, 0x02161c0d, 0x02161d8d, 0x02162015,
+    0x02162089, 0x02162199, 0x02162cc5, 0x0216308d, 0x0216320d, 0x02163511, 0x02164299, 0x02165259,
+    0x021653d9, 0x02165459, 0x02165609, 0x02165689, 0x02165785, 0x02165c05, 0x02165fd9, 0x02166165,
+    0x021661e9, 0x021665d9, 0x02166659, 0x021667e5, 0x02167e89, 0x02168866, 0x021689d9, 0x02168a59,
+    0x02168ed9, 0x02169289, 0x02169bd9, 0x02169c59, 0x02169dd9, 0x0216a259, 0x0216a645, 0x0216aa0d,
+    0x0216ab8d, 0x0216aea5, 0x0216bc15, 0x0216cbd5, 0x0216cd55, 0x0216cdd5, 0x0216cf89, 0x0216d009,
+    0x0216d10d, 0x0216dae5, 0x0216db65, 0x0216df55, 0x0216dfd5, 0x0216e155, 0x0216e491, 0x0216f451,
+    0x0216f5d1, 0x02170b85, 0x02170f4d, 0x021710cd, 0x0217114d, 0x021713e5, 0x02171b45, 0x02172a66,
+    0x02172be5, 0x021737e6, 0x0217394d, 0x021739cd, 0x02173c66, 0x02174b4d, 0x02174bcd, 0x02174d4d,
+    0x02174fe5, 0x02178ed5, 0x0217ad85, 0x0217b14d, 0x0217b2cd, 0x0217b5c9, 0x0217c065, 0x0217cac5,
+    0x0217d2e5, 0x0217fae5, 0x02180865, 0x02180ee5, 0x0218164d, 0x021817cd, 0x021820c9, 0x021827c9,
+    0x02182849, 0x02182b45, 0x02183315, 0x02183445, 0x02183795, 0x02183815, 0x02183995, 0x02184515,
+    0x02184595, 0x02184715, 0x02184b95, 0x0218690d, 0x0218698d, 0x02187059, 0x02188cc9, 0x02189691,
+    0x02189811, 0x02189c91, 0x0218a045, 0x0218a38d, 0x0218a40d, 0x0218a58d, 0x0218ae89, 0x0218b78e,
+    0x0218e9e5, 0x02191a05, 0x02191dcd, 0x02191f4d, 0x02192265, 0x02192ce5, 0x02192d65, 0x02193f6a,
+    0x021962e6, 0x02196769, 0x021967e5, 0x02196965, 0x02196b8e, 0x021974e6, 0x02197566, 0x021976e6,
+    0x02197b65, 0x02197fc9, 0x02198991, 0x02198b11, 0x02198f91, 0x02199345, 0x0219968d, 0x0219970d,
+    0x0219988d, 0x0219a189, 0x0219aa8e, 0x0219d109, 0x0219d189, 0x0219dc65, 0x0219dce5, 0x0219e0e5,
+    0x0219e165, 0x0219e2f6, 0x0219e536, 0x0219ee65, 0x0219eee5, 0x0219f076, 0x0219f4f6, 0x0219fb8e,
+    0x021a0d89, 0x021a16e5, 0x021a1765, 0x021a18e5, 0x021a1d65, 0x021a4545, 0x021a5b15, 0x021a6e95,
+    0x021a6f15, 0x021a8391, 0x021af945, 0x021afd11, 0x021afe91, 0x021aff11, 0x021b0f0a, 0x021b378a,
+    0x021b3a86, 0x021b625d, 0x021b63f5, 0x021b645d, 0x021b8add, 0x021b8c5d, 0x021b8ce1, 0x021b9e5d,
+    0x021b9edd, 0x021bae11, 0x021bc185, 0x021bea05, 0x021bffdd, 0x021c045d, 0x021c05f5, 0x021c11dd,
+    0x021c1375, 0x021c13dd, 0x021c17f5, 0x021c185d, 0x021c3a5d, 0x021c3bea, 0x021c3c61, 0x021c405d,
+    0x021c40e1, 0x021c4e5e, 0x021c6519, 0x021c6991, 0x021c6b11, 0x021c6b91, 0x021c728e, 0x021c7e86,
+    0x021c860d, 0x021c868d, 0x021ca40a, 0x021ca706, 0x021cbf09, 0x021cca59, 0x021cced9, 0x021cd075,
+    0x021cd0d9, 0x021cf2d9, 0x021cf759, 0x021cf8d9, 0x021cf961, 0x021d0659, 0x021d06d9, 0x021d0ad9,
+    0x021d0b59, 0x021d1d8a, 0x021d4855, 0x021d49d5, 0x021d4a55, 0x021d79ce, 0x021d82ca, 0x021d85c6,
+    0x021da24e, 0x021dab4a, 0x021dae46, 0x021dd005, 0x021de5d5, 0x021df955, 0x021df9d5, 0x021dfdd5,
+    0x021dfe55, 0x021dffd5, 0x021e0e51, 0x021e1bce, 0x021e24ca, 0x021e27c6, 0x021e3249, 0x021e8719,
+    0x021e8799, 0x021e9a99, 0x021ec319, 0x021ed8d9, 0x021eecd9, 0x021f14d9, 0x021f6a55, 0x021f6ad5,
+    0x021f6c55, 0x021f884e, 0x021f914a, 0x021f9446, 0x022007d5, 0x02200861, 0x02201bd6, 0x02203075,
+    0x022030d1, 0x022043c5, 0x0220af11, 0x02211459, 0x022115f5, 0x02211669, 0x02213a89, 0x02213cd9,
+    0x02213e59, 0x02214e19, 0x02214e89, 0x0221505e, 0x022150d9, 0x0221630a, 0x02218de9, 0x02218f55,
+    0x02218fd5, 0x0221c84a, 0x022208dd, 0x02221585, 0x02222b55, 0x02223ed6, 0x02223f55, 0x022253d1,
+    0x022277c9, 0x02228276, 0x022282ea, 0x0222a4e9, 0x0222a95d, 0x0222bd5d, 0x0222cf8a, 0x0222fa55,
+    0x0222fbd5, 0x0222fc55, 0x02232bce, 0x022367cd, 0x0223684d, 0x02242a29, 0x02242ba9, 0x02242c29,
+    0x022439e9, 0x02249f29, 0x0224a3a9, 0x0224a535, 0x0224a5a9, 0x0224c7aa, 0x0224cc29, 0x0224cdaa,
+    0x0224d469, 0x0224d4cd, 0x0224db2a, 0x0224dba9, 0x0224dd49, 0x0224ddc9, 0x0224dfa9, 0x0224e029,
+    0x0224e1a9, 0x0224eb99, 0x02250459, 0x02251659, 0x022517d9, 0x02251859, 0x02252cd9, 0x02257289,
+    0x02257dda, 0x02258269, 0x02258619, 0x02258699, 0x02259659, 0x02261029, 0x022611b5, 0x02261229,
+    0x022638be, 0x02263a3e, 0x022640ce, 0x0226414e, 0x022649e9, 0x02264a49, 0x02264c3e, 0x02264ca9,
+    0x02264e29, 0x02265a51, 0x02265bd6, 0x02265c51, 0x02266c49, 0x02266f45, 0x022694c9, 0x022697c5,
+    0x0226ada9, 0x0226b229, 0x0226b3b5, 0x0226ba76, 0x0226baea, 0x0226bfa9, 0x0226c135, 0x0226c1a9,
+    0x0226c5b5, 0x0226c629, 0x0226e14d, 0x0226e829, 0x0226e9aa, 0x0226ee3e, 0x02276a59, 0x0227a209,
+    0x0227a289, 0x0227a4d9, 0x0227b859, 0x0227ca89, 0x0227cc05, 0x0227de05, 0x0227e1d5, 0x0227e355,
+    0x0227e3d5, 0x0227f205, 0x0227f281, 0x0227f401, 0x0227f555, 0x0227f5d5, 0x02280685, 0x02280a51,
+    0x02280bf5, 0x02281c4a, 0x02282e81, 0x02282ff5, 0x02283049, 0x02283145, 0x02287a09, 0x02287b85,
+    0x02288d85, 0x02289155, 0x022892d5, 0x0228a185, 0x0228a201, 0x0228a381, 0x0228a4d5, 0x0228a555,
+    0x0228b605, 0x0228b9d1, 0x0228bb75, 0x0228cbc9, 0x0228d676, 0x0228d6dd, 0x0228de01, 0x0228df75,
+    0x0228dfc9, 0x0228e0c5, 0x022910dd, 0x0229115d, 0x022912dd, 0x02291e5d, 0x02292c8d, 0x02292e0d,
+    0x02293119, 0x02293e89, 0x022949d9, 0x02294e55, 0x02294fd5, 0x02295055, 0x0229520d, 0x02295289,
+    0x02295385, 0x02295bd9, 0x02295dd9, 0x022961d5, 0x02296255, 0x022963d5, 0x02296709, 0x02297259,
+    0x022976d1, 0x02297875, 0x02297fce, 0x02298e05, 0x022991cd, 0x02299375, 0x022993cd, 0x02299659,
+    0x02299c75, 0x0229acd9, 0x0229ae59, 0x0229ba4d, 0x0229bbcd, 0x0229bc4d, 0x0229bed9, 0x0229cdcd,
+    0x0229ce4d, 0x0229cfcd, 0x0229d259, 0x0229e08d, 0x0229ec85, 0x0229f051, 0x0229f1d1, 0x0229f94e,
+    0x022a024a, 0x022a0b4d, 0x022a0ccd, 0x022a0d4d, 0x022a1481, 0x022a15c9, 0x022a1649, 0x022a1745,
+    0x022a21ce, 0x022a2aca, 0x022a45cd, 0x022a51c5, 0x022a55a9, 0x022a5735, 0x022a57a9, 0x022a6e4d,
+    0x022a7e29, 0x022a7fa9, 0x022a8029, 0x022a91a9, 0x022a9229, 0x022a93a9, 0x022a9c05, 0x022a9fd1,
+    0x022aa155, 0x022ab1c9, 0x022ac401, 0x022ac555, 0x022ac5c9, 0x022ac6c5, 0x022ada49, 0x022ae7c9,
+    0x022af329, 0x022af7a9, 0x022af935, 0x022af9a9, 0x022b0145, 0x022b0529, 0x022b0729, 0x022b0b35,
+    0x022b0ba9, 0x022b2da9, 0x022b2f2a, 0x022b2fa9, 0x022b33a9, 0x022b3429, 0x022b35a9, 0x022b4129,
+    0x022b41a9, 0x022b4329, 0x022b47a9, 0x022b6c59, 0x022bda09, 0x022bda89, 0x022be9e9, 0x022bea59,
+    0x022bf75a, 0x022c544d, 0x022c6429, 0x022c65b5, 0x022c6629, 0x022ca0a9, 0x022ca229, 0x022cb429,
+    0x022d0e76, 0x022d0ecd, 0x022d13a9, 0x022d1535, 0x022d15a9, 0x022d27a9, 0x022d48cd, 0x022d494d,
+    0x022d4acd, 0x022d51a9, 0x022d7b85, 0x022d7f51, 0x022d80d1, 0x022d90c9, 0x022d9162, 0x022d9462,
+    0x022da4c9, 0x022dd219, 0x022de499, 0x022de619, 0x022df5c9, 0x022e0962, 0x022e0c99, 0x022e0d22,
+    0x022e0ea2, 0x022e2099, 0x022ee8c9, 0x022efc62, 0x022eff95, 0x022f0022, 0x022f01a2, 0x022f1395,
+    0x022f6491, 0x02305285, 0x02305381, 0x02306855, 0x02307bd5, 0x02307c55, 0x023090d1, 0x0230b1cd,
+    0x0230b4c9, 0x0230b7c5, 0x02316161, 0x023173e1, 0x02317561, 0x02319be1, 0x02319c62, 0x02319de2,
+    0x0231afe1, 0x0231b385, 0x0231b74d, 0x0231b8cd, 0x0231c1c9, 0x0231c8c9, 0x0231c962, 0x0231cc62,
+    0x0231d415, 0x0231d895, 0x0231d922, 0x0231daa2, 0x0231dcc9, 0x0231e695, 0x0231e815, 0x0231ec95,
+    0x02322dc9, 0x023237b5, 0x02323911, 0x02323d91, 0x02324162, 0x0232448d, 0x0232588e, 0x02328a55,
+    0x02328ae1, 0x0232b2d1, 0x0232b351, 0x0232c645, 0x0232c741, 0x0232cde1, 0x0232e06a, 0x0232e1e1,
+    0x023303e1, 0x02330869, 0x02330c89, 0x02331675, 0x023317e1, 0x02331c61, 0x023320c9, 0x02332a91,
+    0x02332c11, 0x02333091, 0x02333462, 0x0233378d, 0x02334b8e, 0x02337d61, 0x023381e1, 0x02338262,
+    0x023383e2, 0x02338609, 0x02338fe1, 0x02339161, 0x023395e1, 0x02339c8e, 0x0233aea2, 0x0233b7e1,
+    0x0233b862, 0x0233b9e2, 0x0233be62, 0x0233e381, 0x0233e552, 0x0233e852, 0x0233f845, 0x0233fc15,
+    0x0233fd95, 0x02340c45, 0x02340f95, 0x02341015, 0x02341195, 0x02343689, 0x02344a09, 0x02344a89,
+    0x02345d52, 0x02347142, 0x02347289, 0x02348689, 0x023504dd, 0x0235055d, 0x02352bf5, 0x02352d5d,
+    0x02353f5d, 0x02353ff5, 0x0235415d, 0x02355052, 0x02356589, 0x02357989, 0x0235a0dd, 0x0235a55d,
+    0x0235a6dd, 0x0235b8dd, 0x0235b95d, 0x0235badd, 0x0235e15d, 0x0235f55d, 0x0236624d, 0x023663cd,
+    0x0236644d, 0x023666c9, 0x02369e4d, 0x02369ef6, 0x0236a2c9, 0x0236a376, 0x0236bc51, 0x0236e345,
+    0x02371649, 0x023721a9, 0x02372629, 0x023727a9, 0x02372829, 0x02374a36, 0x02374eb6, 0x02375029,
+    0x02375249, 0x023752f6, 0x02375da9, 0x02375e36, 0x02376229, 0x023762b6, 0x0237c3a9, 0x0237c829,
+    0x0237c9a9, 0x0237d5a9, 0x0237d729, 0x0237dba9, 0x0237dc29, 0x0237dda9, 0x0237fe36, 0x02380429,
+    0x02380785, 0x02380b75, 0x02380ccd, 0x02381236, 0x023815c9, 0x02381d52, 0x02382052, 0x02382952,
+    0x02383045, 0x0238340d, 0x0238358d, 0x02383e89, 0x02384445, 0x0238478d, 0x02384815, 0x0238498d,
+    0x02385289, 0x02386e89, 0x023879d9, 0x02387e59, 0x02387fd9, 0x02388209, 0x02388289, 0x02388d59,
+    0x02388dd9, 0x023891d9, 0x02389259, 0x023893d9, 0x02389552, 0x0238aa89, 0x0238b475, 0x0238b5d9,
+    0x0238ba69, 0x0238be99, 0x0238c7d9, 0x0238c9d9, 0x0238ce59, 0x0238dcd1, 0x0238de51, 0x0238ded1,
+    0x0238eec9, 0x0238f1c5, 0x0238f2c1, 0x02391749, 0x02391a45, 0x02391b41, 0x02393029, 0x023934a9,
+    0x02393629, 0x02394229, 0x023943a9, 0x02394429, 0x02394829, 0x02394a29, 0x02396ab6, 0x02396c29,
+    0x02397405, 0x0239774d, 0x023977f5, 0x0239794d, 0x02397eb6, 0x02398249, 0x02398852, 0x02399d89,
+    0x0239a755, 0x0239a8d5, 0x0239ad55, 0x0239b195, 0x0239bad5, 0x0239bcd5, 0x0239c155, 0x0239dd4d,
+    0x0239decd, 0x0239e5a9, 0x0239ed85, 0x0239f0cd, 0x0239f14d, 0x0239f2cd, 0x0239f9a9, 0x0239fbc9,
+    0x023a194d, 0x023a4cc9, 0x023a6045, 0x023a6395, 0x023a6415, 0x023a6595, 0x023a7795, 0x023a9e09,
+    0x023a9e89, 0x023ac891, 0x023ada89, 0x023b58de, 0x023b595e, 0x023b6b6a, 0x023b6cdd, 0x023b9369,
+    0x023b93f5, 0x023b955d, 0x023ba75d, 0x023bbb91, 0x023bcd89, 0x023c0cdd, 0x023c0d5d, 0x023c0ee9,
+    0x023c20dd, 0x023c495d, 0x023cb659, 0x023cb7d9, 0x023cb859, 0x023cbad9, 0x023cc9cd, 0x023cca4d,
+    0x023cce49, 0x023ccee9, 0x023cf26a, 0x023cf6ea, 0x023d1e85, 0x023d2256, 0x023d3456, 0x023d3755,
+    0x023d47c9, 0x023d4849, 0x023d4945, 0x023d5cd1, 0x023d7dc9, 0x023d7e49, 0x023d83c5, 0x023d87a9,
+    0x023d8929, 0x023d89a9, 0x023d8da9, 0x023d8e29, 0x023d8fa9, 0x023da66a, 0x023db036, 0x023db1aa,
+    0x023db236, 0x023dba49, 0x023dc3aa, 0x023dc436, 0x023dc5a9, 0x023dca29, 0x023df355, 0x023df4e9,
+    0x023e0055, 0x023e1bd1, 0x023e1d69, 0x023e29a9, 0x023e2b2a, 0x023e2baa, 0x023e3f2a, 0x023e43a9,
+    0x023e57d1, 0x023e84c9, 0x023e8e91, 0x023e9011, 0x023e94a9, 0x023e9845, 0x023e9b8d, 0x023e9c0d,
+    0x023e9d8d, 0x023ea6a9, 0x023eaf8e, 0x023ed609, 0x023ed689, 0x023ee159, 0x023ee1d9, 0x023ee5e9,
+    0x023ee669, 0x023ee7e9, 0x023ef359, 0x023ef3d9, 0x023ef559, 0x023ef9e9, 0x023f008e, 0x023f1289,
+    0x023f1be9, 0x023f1c75, 0x023f1dd9, 0x023f2269, 0x023f9629, 0x023f97a9, 0x023f9829, 0x023fdf4e,
+    0x023fe3ca, 0x023ff38e, 0x02400589, 0x02400ed5, 0x02400f55, 0x024010e9, 0x02401569, 0x02403de9,
+    0x024044cd, 0x0240454d, 0x024058ce, 0x0240814e, 0x0240b245, 0x0240b549, 0x0240b5c9, 0x0240b6c5,
+    0x0240c815, 0x0240cc95, 0x0240ce15, 0x0240cea1, 0x0240db95, 0x0240dc15, 0x0240e015, 0x0240e095,
+    0x0240f091, 0x0240f145, 0x0240f511, 0x0240f691, 0x0240f73d, 0x0241070a, 0x02410a06, 0x02416a25,
+    0x02416ac5, 0x02416eb9, 0x02417011, 0x02417091, 0x0241808a, 0x02418386, 0x02419489, 0x0241a90a,
+    0x0241ac06, 0x0241ad02, 0x0241cf65, 0x0241d3f9, 0x0241d55d, 0x0241d5fd, 0x0241f7e5, 0x0241fc79,
+    0x0241fddd, 0x02420b65, 0x02420be5, 0x02420ff9, 0x02421079, 0x0242715d, 0x024275dd, 0x0242775d,
+    0x0242835d, 0x024284dd, 0x0242857d, 0x0242895d, 0x024289fd, 0x0242abdd, 0x0242ad5d, 0x0242b1dd,
+    0x0242bfde, 0x0242d699, 0x0242db11, 0x0242dc91, 0x0242dd11, 0x0242e40e, 0x0242ed0a, 0x0242f006,
+    0x0242f102, 0x0242f78d, 0x0242f80d, 0x02430109, 0x0243158a, 0x02431886, 0x02431982, 0x02433089,
+    0x02433bd9, 0x02434059, 0x024341d9, 0x0243427d, 0x02436459, 0x024368d9, 0x02436a59, 0x024377d9,
+    0x02437859, 0x02437c59, 0x02437cd9, 0x02438f0a, 0x0243b9f9, 0x0243bb55, 0x0243bbd5, 0x0243eb4e,
+    0x0243f44a, 0x0243f746, 0x0243f842, 0x02440c51, 0x02440cd1, 0x024413ce, 0x02441cca, 0x02441fc6,
+    0x024420c2, 0x02445755, 0x02445bd5, 0x02445d55, 0x02445de1, 0x02446ad5, 0x02446b55, 0x02446f55,
+    0x02446fd5, 0x02447155, 0x02447fd1, 0x02448451, 0x024485d1, 0x02448d4e, 0x0244964a, 0x02449946,
+    0x02449a42, 0x0244bbd1, 0x0244bc51, 0x0244c051, 0x0244c0d1, 0x0244c251, 0x0244f891, 0x0244f911,
+    0x0244fd11, 0x0244fd91, 0x02450c05, 0x02450d01, 0x02451181, 0x02453485, 0x02453581, 0x02454a59,
+    0x02454ed9, 0x02455059, 0x02455c59, 0x02455dd9, 0x02455e7d, 0x02456259, 0x024562fd, 0x024584d9,
+    0x02458659, 0x024586e1, 0x02458ad9, 0x02458b61, 0x024598da, 0x0245af25, 0x0245b485, 0x0245b501,
+    0x0245c3e5, 0x0245c879, 0x0245c881, 0x0245c9d5, 0x0245ca61, 0x0245d765, 0x0245d7e5, 0x0245dbf9,
+    0x0245dc79, 0x0245ddd5, 0x0245ec65, 0x0245f251, 0x0245f2fd, 0x0245f9ce, 0x024602ca, 0x024605c6,
+    0x024606c2, 0x02462865, 0x024628e5, 0x02462ed1, 0x02467955, 0x024679e1, 0x02467dd5, 0x02467e61,
+    0x02468d56, 0x0246a1d1, 0x0246a651, 0x0246de52, 0x0246f761, 0x02471c19, 0x02472091, 0x02472211,
+    0x02472291, 0x02475b0a, 0x02478159, 0x024785d9, 0x02478765, 0x024787fd, 0x0247a9d9, 0x0247ae59,
+    0x0247afd9, 0x0247bd59, 0x0247bdd9, 0x0247c1d9, 0x0247c259, 0x0247d48a, 0x0247ff79, 0x024800d5,
+    0x02480155, 0x02489cd5, 0x0248c551, 0x02491c5d, 0x0249410a, 0x02496bd5, 0x02496d55, 0x02496dd5,
+    0x02499d4e, 0x0249d94d, 0x0249d9cd, 0x024a9bb9, 0x024a9d25, 0x024a9da5, 0x024aab65, 0x024b10a5,
+    0x024b1525, 0x024b16a5, 0x024b173d, 0x024b3925, 0x024b3da5, 0x024b3f25, 0x024b4ca5, 0x024b4d25,
+    0x024b5125, 0x024b51a5, 0x024b5325, 0x024b5d19, 0x024b6019, 0x024b6485, 0x024b75d9, 0x024b7a55,
+    0x024b87d9, 0x024b8955, 0x024b89d5, 0x024b8dd5, 0x024b8e55, 0x024b9e59, 0x024ba2d1, 0x024bf559,
+    0x024c1885, 0x024c1c79, 0x024c1dd1, 0x024c1e51, 0x024c2e4a, 0x024c3146, 0x024c56ca, 0x024c81b9,
+    0x024c8325, 0x024c83bd, 0x024caa39, 0x024caba5, 0x024cb925, 0x024cb9a5, 0x024cbdb9, 0x024cbe39,
+    0x024cbfa5, 0x024ccbd1, 0x024ccd51, 0x024cddc9, 0x024ce0c5, 0x024d0649, 0x024d0945, 0x024d1f25,
+    0x024d23a5, 0x024d2525, 0x024d3125, 0x024d32a5, 0x024d333d, 0x024d3725, 0x024d37bd, 0x024d544d,
+    0x024d59a5, 0x024d5b25, 0x024d5d49, 0x024d5fa5, 0x024dd559, 0x024ddbfd, 0x024e1159, 0x024e11d9,
+    0x024e1659, 0x024e29d9, 0x024e54d5, 0x024e5555, 0x024e5d25, 0x024e68d5, 0x024e9b65, 0x024ec3e5,
+    0x024ed765, 0x024ed7e5, 0x024f9e0d, 0x024f9f8d, 0x024fa289, 0x024fb009, 0x024fbb55, 0x024fbfd5,
+    0x024fc155, 0x024fc1d5, 0x024fc389, 0x024fc409, 0x024fc505, 0x024fc989, 0x024fcd59, 0x024fced5,
+    0x024fcf55, 0x024fd355, 0x024fd3d5, 0x024fd555, 0x024fd889, 0x024fe3d1, 0x024fe851, 0x024fe9d1,
+    0x024ff14e, 0x024fff85, 0x0250034d, 0x025004cd, 0x0250057d, 0x025007c9, 0x02500ac5, 0x02501e59,
+    0x02501fd1, 0x02502bcd, 0x02502d4d, 0x02502dcd, 0x02503049, 0x02503f4d, 0x02503fcd, 0x0250414d,
+    0x025043c9, 0x02504449, 0x02505209, 0x02505d65, 0x025061f9, 0x02506351, 0x02506ace, 0x02507909,
+    0x02507cf9, 0x02507e4d, 0x02507ecd, 0x02508465, 0x025088f9, 0x0250934e, 0x0250b749, 0x0250ba45,
+    0x0250c2a5, 0x0250c739, 0x0250c8a5, 0x0250c93d, 0x0250dfc9, 0x0250eb25, 0x0250efb9, 0x0250f125,
+    0x0250f1a5, 0x0250f349, 0x0250f3c9, 0x0250fea5, 0x0250ff25, 0x02510339, 0x025103b9, 0x02510525,
+    0x02513845, 0x02515949, 0x025164a5, 0x02516925, 0x02516aa5, 0x02516b3d, 0x025176a5, 0x02517ca5,
+    0x02517d3d, 0x02519f25, 0x0251a0a5, 0x0251a125, 0x0251a525, 0x0251a5a5, 0x0251a725, 0x0251b2a5,
+    0x0251b325, 0x0251b4a5, 0x0251b925, 0x0251ddd5, 0x02525b59, 0x0252c5c9, 0x0252d125, 0x0252d5b9,
+    0x0252d725, 0x0252d7bd, 0x02530d25, 0x02530da5, 0x02531239, 0x025313a5, 0x02532125, 0x025325b9,
+    0x02538525, 0x025386a5, 0x0253873d, 0x02538bbd, 0x0253993d, 0x0253c325, 0x0253f111, 0x0253f291,
+    0x0253f311, 0x02542b8a, 0x02545659, 0x025457f5, 0x0254587d, 0x02547ed9, 0x02548059, 0x02549259,
+    0x025492d9, 0x0254a50a, 0x0254a806, 0x0254cff9, 0x0254d155, 0x0254d1d5, 0x02550a4a, 0x02555785,
+    0x02556d55, 0x025580d5, 0x02558155, 0x025595d1, 0x0255b9c9, 0x02563c55, 0x02563dd5, 0x02563e55,
+    0x02566dce, 0x02576c39, 0x02576da1, 0x02576e21, 0x02577be1, 0x02578051, 0x025781d1, 0x02578251,
+    0x0257e121, 0x0257e5a1, 0x0257e735, 0x0257e7bd, 0x025809a1, 0x02580e21, 0x02580fa1, 0x02581d21,
+    0x02581da1, 0x025821a1, 0x02582221, 0x025823a1, 0x02584659, 0x02584ad5, 0x025859d9, 0x02585a59,
+    0x02585e55, 0x02585ed5, 0x02586ed9, 0x0258ee51, 0x0258eed1, 0x025901c6, 0x025902c2, 0x02595239,
+    0x025953b5, 0x0259543d, 0x02597ab9, 0x02597c21, 0x02598e39, 0x02598eb9, 0x02599021, 0x02599dd1,
+    0x02599e51, 0x0259a251, 0x0259a2d1, 0x0259b145, 0x0259d9c5, 0x0259efa1, 0x0259f421, 0x0259f5b5,
+    0x025a01a1, 0x025a0335, 0x025a03bd, 0x025a07b5, 0x025a083d, 0x025a2a21, 0x025a2ba1, 0x025a3021,
+    0x025a81ed, 0x025a836d, 0x025a83ed, 0x025bb32d, 0x025bb3ad, 0x025bc16d, 0x025c26ad, 0x025c2b2d,
+    0x025c4f2d, 0x025c53ad, 0x025c552d, 0x025c629e, 0x025c631e, 0x025c671e, 0x025c679e, 0x025d1e2d,
+    0x025d1fad, 0x025d202d, 0x025e112d, 0x025e12ad, 0x025e132d, 0x025e8c2e, 0x025e9eed, 0x025f042d,
+    0x025f2cad, 0x025f3b9a, 0x025f3c1a, 0x025f401a, 0x025f409a, 0x025f52ca, 0x025f7f2d, 0x025f7fad,
+    0x025ff8ae, 0x0260026d, 0x0260056d, 0x02601b2d, 0x02602d16, 0x02602e96, 0x02602f16, 0x02603316,
+    0x02603396, 0x026043ad, 0x026072ae, 0x02607f92, 0x026094ae, 0x0260992e, 0x0260d7d5, 0x02617405,
+    0x026177f9, 0x02617951, 0x026189ca, 0x02619c01, 0x02619d49, 0x02619dc9, 0x02619ef9, 0x0261b24a,
+    0x0261d945, 0x0261dd39, 0x0261deb5, 0x0261df3d, 0x026205b9, 0x0262071d, 0x0262079d, 0x02621939,
+    0x026219b9, 0x02621b1d, 0x02622385, 0x02622751, 0x026228d1, 0x02623949, 0x02624b81, 0x02624cc9,
+    0x02624d49, 0x02624e45, 0x026261c9, 0x02627a9d, 0x0262813d, 0x026288c5, 0x02628c9d, 0x02628e35,
+    0x02628ebd, 0x0262b51d, 0x0262b69d, 0x0262b71d, 0x0262bb9d, 0x0262c89e, 0x0262c91e, 0x0262ca9e,
+    0x0262cf1e, 0x0262dfd9, 0x0262e451, 0x0262e5d1, 0x0262ed4e, 0x0262ff4d, 0x026300cd, 0x0263014d,
+    0x026306d9, 0x026309c9, 0x026315ce, 0x026339c9, 0x02634519, 0x02634999, 0x02634b35, 0x02634bbd,
+    0x02636d99, 0x02637219, 0x02637399, 0x02637419, 0x02638119, 0x02638199, 0x02638599, 0x02638619,
+    0x02638799, 0x02638f4e, 0x0263984a, 0x0263b64d, 0x0263bf45, 0x0263c339, 0x0263c495, 0x0263c515,
+    0x0263f48e, 0x0263fd8a, 0x02640086, 0x02641d0e, 0x0264260a, 0x0264308d, 0x0264310d, 0x02643989,
+    0x02643a09, 0x026447c9, 0x02646095, 0x02646715, 0x02646a45, 0x02646ec5, 0x02647295, 0x02647415,
+    0x02647495, 0x02648911, 0x0264968e, 0x0264a88d, 0x0264ad09, 0x0264b005, 0x0264c391, 0x0264c511,
+    0x0264d10d, 0x0264d589, 0x0264e48d, 0x0264e50d, 0x0264e909, 0x0264e989, 0x02659019, 0x02659499,
+    0x0265d395, 0x0266030e, 0x02660c0a, 0x02668315, 0x02668795, 0x026700ad, 0x0269fe51, 0x026a2545,
+    0x026a63a1, 0x026a69a1, 0x026a8c36, 0x026a9fa1, 0x026aa036, 0x026b1921, 0x026b1fbd, 0x026b46b6,
+    0x026bfc59, 0x026c2051, 0x026c20d1, 0x026c33c5, 0x026c34c1, 0x026c5c45, 0x026c5d41, 0x026c7221,
+    0x026c8439, 0x026c85a1, 0x026c863d, 0x026c8a39, 0x026c8c3d, 0x026cacb6, 0x026cae21, 0x026caeb6,
+    0x026cc0b6, 0x026d3bbd, 0x026dd051, 0x026eaf1d, 0x026f511d, 0x026f5e9d, 0x026f631d, 0x026fb051,
+    0x02701599, 0x02701a19, 0x02701b99, 0x02701c3d, 0x02703e36, 0x02705199, 0x02705236, 0x02705619,
+    0x02708f15, 0x0270c50e, 0x0271010d, 0x027101b6, 0x02713115, 0x02714495, 0x02715991, 0x02715f91,
+    0x02719591, 0x02719636, 0x02719ab6, 0x0271b0ad, 0x02722a19, 0x02723799, 0x02723c19, 0x02726249,
+    0x027284c9, 0x027287c5, 0x027288c1, 0x02729d95, 0x0272afb9, 0x0272b115, 0x0272b195, 0x0272c611,
+    0x0272cc11, 0x02730211, 0x027302b6, 0x02731bba, 0x02731d2d, 0x02732f3a, 0x02737b91, 0x02738011,
+    0x0273ccad, 0x0273d12d, 0x0275173d, 0x027551b9, 0x02757c55, 0x0275b33d, 0x0275cb3d, 0x02763d59,
+    0x02767b99, 0x02767d19, 0x02768199, 0x0276823d, 0x027683bd, 0x0276a436, 0x0276a599, 0x0276b799,
+    0x0276b836, 0x0276b999, 0x0276ca49, 0x0276e315, 0x0276f149, 0x0276f539, 0x0276f695, 0x0276f715,
+    0x02770b91, 0x02772c8d, 0x02772d3d, 0x02772f89, 0x02773285, 0x02774636, 0x02774791, 0x027753b6,
+    0x0277550d, 0x027755b6, 0x02775836, 0x02775b05, 0x0277690d, 0x02776b89, 0x02776c36, 0x0277aa95,
+    0x0277cd0d, 0x0277ce8d, 0x0277cf3d, 0x0277d189, 0x0277e685, 0x0277f03e, 0x027818ad, 0x02785555,
+    0x02786755, 0x0278b851, 0x0278ca49, 0x02790595, 0x027939b9, 0x02793b0d, 0x02793bbd, 0x02793e09,
+    0x02794105, 0x02795b3a, 0x0279833a, 0x027990ba, 0x0279ab51, 0x0279b44d, 0x0279bd49, 0x0279fcad,
+    0x0279fd3e, 0x0279febe, 0x027a10be, 0x027a32ad, 0x027a34ad, 0x027a392d, 0x027a5e85, 0x027a6251,
+    0x027a63d1, 0x027a73c9, 0x027a7762, 0x027a87c9, 0x027ab519, 0x027ac799, 0x027ac919, 0x027ad8c9,
+    0x027aec62, 0x027aefbd, 0x027af022, 0x027af1a2, 0x027b0399, 0x027b7ddd, 0x027bcbc9, 0x027bdf62,
+    0x027be295, 0x027be322, 0x027be4a2, 0x027bf695, 0x027c4791, 0x027ce5d9, 0x027e4479, 0x027e56e1,
+    0x027e7efd, 0x027e92e1, 0x027e9685, 0x027e9a4d, 0x027e9bcd, 0x027ea4c9, 0x027eabc9, 0x027eaf62,
+    0x027eb715, 0x027ebb95, 0x027ebc22, 0x027ebda2, 0x027ebfc9, 0x027ec995, 0x027ecb15, 0x027ecf95,
+    0x027f10c9, 0x027f1a91, 0x027f1c11, 0x027f2091, 0x027f2462, 0x027f27bd, 0x027f3b8e, 0x027fb0e1,
+    0x027fc361, 0x027fc4e1, 0x027fe6e6, 0x027fef8e, 0x027ff966, 0x027ffae6, 0x027fff61, 0x028003c9,
+    0x02800d91, 0x02800f39, 0x02801391, 0x02801762, 0x02801a8d, 0x02802e8e, 0x02806079, 0x028064e1,
+    0x02806909, 0x028072e1, 0x02807479, 0x028078e1, 0x02807f8e, 0x028091a2, 0x02809afd, 0x02809b62,
+    0x02809ce2, 0x0280a162, 0x0280c852, 0x0280da95, 0x0280db45, 0x0280df15, 0x0280e095, 0x0280ef45,
+    0x0280f295, 0x0280f315, 0x0280f495, 0x02814052, 0x028155bd, 0x02816989, 0x0281e7dd, 0x0281e85d,
+    0x02820a66, 0x02820efd, 0x0282107d, 0x0282227d, 0x028222dd, 0x0282245d, 0x02823352, 0x02824889,
+    0x02825c89, 0x028283f9, 0x0282885d, 0x028289f9, 0x02829bdd, 0x02829c5d, 0x02829df9, 0x0282c47d,
+    0x0282d85d, 0x0284baba, 0x0284e2ba, 0x0284ea85, 0x0284ee4d, 0x0284eff9, 0x0284f8c9, 0x02850052,
+    0x02851345, 0x0285170d, 0x0285188d, 0x02852195, 0x02852745, 0x02852a95, 0x02852b0d, 0x02852c95,
+    0x02853589, 0x02855cd9, 0x02856159, 0x028562d9, 0x02857066, 0x028570d9, 0x028574d9, 0x02857559,
+    0x028576d9, 0x02857852, 0x02858dbd, 0x0285977d, 0x028598fd, 0x0285a199, 0x0285ab59, 0x0285b159,
+    0x02862ba5, 0x02865705, 0x02865a7d, 0x02865acd, 0x02865c4d, 0x02866549, 0x02866b52, 0x02868089,
+    0x02868a55, 0x02868bf9, 0x02869055, 0x02869495, 0x02869e55, 0x0286a455, 0x0286c04d, 0x0286cac9,
+    0x0286d085, 0x0286d3cd, 0x0286d44d, 0x0286d5f9, 0x0286dec9, 0x0286fc7d, 0x02872fc9, 0x02874345,
+    0x02874695, 0x02874715, 0x02874895, 0x02875a95, 0x0287ab91, 0x0287bd89, 0x02883bde, 0x02883c5e,
+    0x02884e5d, 0x02884fdd, 0x0288767d, 0x028876e5, 0x0288785d, 0x028883e6, 0x02888a5d, 0x02889e91,
+    0x0288b089, 0x0288efdd, 0x0288f05d, 0x0288f1f9, 0x0288fd5d, 0x028903dd, 0x02892c5d, 0x0289b1c9,
+    0x0289f07d, 0x028a6ca5, 0x028a7125, 0x028ae355, 0x028b20a5, 0x028b223a, 0x028b67c9, 0x028b7191,
+    0x028b7311, 0x028b77a5, 0x028b7b45, 0x028b7e8d, 0x028b7f0d, 0x028b808d, 0x028b89a5, 0x028b928e,
+    0x028bc466, 0x028bc4d9, 0x028bc8e5, 0x028bc965, 0x028bcae5, 0x028bd666, 0x028bd6d9, 0x028bd866,
+    0x028bdce5, 0x028be38e, 0x028bf589, 0x028bfefd, 0x028bff65, 0x028c00d9, 0x028c0565, 0x028c8d25,
+    0x028cc6ca, 0x028cd68e, 0x028ce889, 0x028cf1d5, 0x028cf255, 0x028cf3f9, 0x028cf865, 0x028d27cd,
+    0x028d284d, 0x028d3bce, 0x028d644e, 0x02918b3a, 0x0291b33a, 0x0292fc21, 0x02944251, 0x02946a76,
+    0x02946ad9, 0x0294917d, 0x0294a559, 0x0294b9d1, 0x02951f1d, 0x0295211d, 0x029547be, 0x029558fd,
+    0x02955b3e, 0x02955b9d, 0x0295d0ba, 0x0295d276, 0x0295d2c9, 0x0295d51d, 0x0295f8ba, 0x029621d9,
+    0x02968719, 0x02968d99, 0x0296afbe, 0x0296c33e, 0x0296c399, 0x02970515, 0x0297803d, 0x0297a2ba,
+    0x0297b63a, 0x0297b6ba, 0x0297cb3a, 0x029820bd, 0x0298247d, 0x029824c9, 0x02983039, 0x0298343d,
+    0x029834ad, 0x02983639, 0x0298a276, 0x0298a2cd, 0x0298a999, 0x0298c97d, 0x0299273e, 0x02992795,
+    0x02996636, 0x029966ad, 0x029990ce, 0x0299914e, 0x0299a12d, 0x0299a2ad, 0x029a0239, 0x029a06ad,
+    0x029a0836, 0x029a0a76, 0x029a0ac9, 0x029a15b6, 0x029a1639, 0x029a1a36, 0x029a1aad, 0x029a1c36,
+    0x029a3cbd, 0x029abe76, 0x029abed9, 0x029af8fd, 0x029af959, 0x029afad9, 0x029c2676, 0x029c26c9,
+    0x029c62c9, 0x029cef19, 0x029e4db6, 0x029e4e39, 0x029e602d, 0x029e883d, 0x029e88ad, 0x029e8a39,
+    0x029e95bd, 0x029e9c2d, 0x029ec6d5, 0x029ed8d5, 0x029ef676, 0x029ef6cd, 0x029f29d1, 0x029f30fd,
+    0x029f314d, 0x029f32cd, 0x029f3bc9, 0x029fba36, 0x029fbaad, 0x029ff52d, 0x029ff6ad, 0x02a008ad,
+    0x02a01cd1, 0x02a02ec9, 0x02a05e76, 0x02a05ec9, 0x02a069b6, 0x02a06a39, 0x02a06e36, 0x02a06ead,
+    0x02a07036, 0x02a07bb6, 0x02a07c2d, 0x02a07db6, 0x02a08236, 0x02a09ac9, 0x02a0a43d, 0x02a0a4ad,
+    0x02a0a639, 0x02a0aaad, 0x02a0d0c9, 0x02a0e795, 0x02a0e822, 0x02a0e9a2, 0x02a0fb95, 0x02a14c91,
+    0x02a15ea2, 0x02a1dcde, 0x02a1ef5d, 0x02a1f0dd, 0x02a2177d, 0x02a22b5d, 0x02a23f91, 0x02a290dd,
+    0x02a29162, 0x02a292e2, 0x02a2a4dd, 0x02a2cd62, 0x02a47762, 0x02a478e2, 0x02a48ad5, 0x02a49fd1,
+    0x02a4a179, 0x02a4dbd1, 0x02a508c9, 0x02a51291, 0x02a51411, 0x02a51891, 0x02a51f8d, 0x02a5338e,
+    0x02a56559, 0x02a569e1, 0x02a577d9, 0x02a57959, 0x02a57de1, 0x02a5848e, 0x02a596a2, 0x02a59ffd,
+    0x02a5a062, 0x02a5a1e2, 0x02a5a662, 0x02a6634e, 0x02a667ca, 0x02a6778e, 0x02a692d5, 0x02a69362,
+    0x02a694e2, 0x02a69962, 0x02a6c1d1, 0x02a6dcce, 0x02a73852, 0x02a74d89, 0x02a76189, 0x02a78d59,
+    0x02a78ed9, 0x02a7a0d9, 0x02a7a159, 0x02a7a2d9, 0x02a7c97d, 0x02a7dd59, 0x02a8bc55, 0x02a8d055,
+    0x02a8f6c9, 0x02a90ac9, 0x02aa7c2d, 0x02aa7cad, 0x02aaa4bd, 0x02aab6bd, 0x02aab735, 0x02aab8ad,
+    0x02ab1839, 0x02ab1cad, 0x02ab1e39, 0x02ab302d, 0x02ab30ad, 0x02ab3239, 0x02ab58bd, 0x02ab5cc9,
+    0x02ab66b5, 0x02ab6839, 0x02ab6cad, 0x02ab7052, 0x02ab8589, 0x02ab8f55, 0x02ab90d5, 0x02ab9555,
+    0x02ab9989, 0x02aba2d5, 0x02aba355, 0x02aba4d5, 0x02aba955, 0x02abc54d, 0x02abc6cd, 0x02abcfc9,
+    0x02abd8cd, 0x02abd94d, 0x02abdacd, 0x02ac017d, 0x02ac154e, 0x02ac84ad, 0x02ac892d, 0x02ac8aad,
+    0x02ac982d, 0x02ac98ad, 0x02ac9cad, 0x02ac9d2d, 0x02ac9ead, 0x02acc0bd, 0x02acc949, 0x02acd2bd,
+    0x02acd335, 0x02acd4ad, 0x02acd92d, 0x02acf44d, 0x02ad084e, 0x02ad2ec9, 0x02ad38ad, 0x02ad3a39,
+    0x02ad3ead, 0x02ad42c9, 0x02ad4c2d, 0x02ad4cad, 0x02ad4e39, 0x02ad52ad, 0x02ad74bd, 0x02ada3ad,
+    0x02adb5ad, 0x02adf4ed, 0x02adf56d, 0x02adf6ed, 0x02ae08ed, 0x02ae316d, 0x02af246d, 0x02afe86d,
+    0x02b025ae, 0x02b04dae, 0x02b0d52e, 0x02b0d9ae, 0x02b0dc2d, 0x02b0ddad, 0x02b0e2ad, 0x02b0e42d,
+    0x02b0fd2e, 0x02b101ae, 0x02b10cad, 0x02b11ead, 0x02b132ed, 0x02b1842d, 0x02b184ad, 0x02b191ad,
+    0x02b1982d, 0x02b1c0ad, 0x02b1db8e, 0x02b1edad, 0x02b1f6ed, 0x02b1f76d, 0x02b1f8ed, 0x02b1fd6d,
+    0x02b22ced, 0x02b22d6d, 0x02b2694e, 0x02b2ec2d, 0x02b2ecad, 0x02b2fe2d, 0x02b2fead, 0x02b3002d,
+    0x02b328ad, 0x02b35c4e, 0x02b3a02d, 0x02b3a0ad, 0x02b3a6ad, 0x02b406c5, 0x02b409c9, 0x02b40a49,
+    0x02b40b45, 0x02b41c95, 0x02b41d45, 0x02b42115, 0x02b42295, 0x02b42321, 0x02b424c9, 0x02b42549,
+    0x02b43015, 0x02b43095, 0x02b43145, 0x02b43495, 0x02b43515, 0x02b43695, 0x02b44511, 0x02b445c5,
+    0x02b44991, 0x02b44b11, 0x02b44b91, 0x02b45b8a, 0x02b45e86, 0x02b460c5, 0x02b4648d, 0x02b4660d,
+    0x02b4668d, 0x02b46909, 0x02b46f89, 0x02b47285, 0x02b4bea5, 0x02b4bf45, 0x02b4c311, 0x02b4c491,
+    0x02b4c511, 0x02b4d50a, 0x02b4d806, 0x02b4df8d, 0x02b4e00d, 0x02b4e909, 0x02b4ec05, 0x02b4fd8a,
+    0x02b50086, 0x02b50182, 0x02b51889, 0x02b523e5, 0x02b5285d, 0x02b529dd, 0x02b52a5d, 0x02b54c65,
+    0x02b550dd, 0x02b5525d, 0x02b55fe5, 0x02b56065, 0x02b5645d, 0x02b564dd, 0x02b5665d, 0x02b5c5dd,
+    0x02b5ca5d, 0x02b5cbdd, 0x02b5d7dd, 0x02b5d95d, 0x02b5d9dd, 0x02b5dddd, 0x02b5de5d, 0x02b6005d,
+    0x02b601ea, 0x02b6065d, 0x02b6145e, 0x02b62b3d, 0x02b62f91, 0x02b63111, 0x02b63191, 0x02b6388e,
+    0x02b6418a, 0x02b64486, 0x02b64582, 0x02b64c0d, 0x02b64c8d, 0x02b65589, 0x02b65885, 0x02b66a0a,
+    0x02b66d06, 0x02b66e02, 0x02b68509, 0x02b6907d, 0x02b694d9, 0x02b69659, 0x02b696d9, 0x02b6b8fd,
+    0x02b6bd59, 0x02b6bed9, 0x02b6cc7d, 0x02b6ccfd, 0x02b6d0d9, 0x02b6d159, 0x02b6d2d9, 0x02b6e38a,
+    0x02b70e55, 0x02b70fd5, 0x02b71055, 0x02b73fce, 0x02b748ca, 0x02b74bc6, 0x02b74cc2, 0x02b75f51,
+    0x02b760d1, 0x02b76151, 0x02b7684e, 0x02b7714a, 0x02b77446, 0x02b77542, 0x02b7b055, 0x02b7b1d5,
+    0x02b7b261, 0x02b7bf7d, 0x02b7bffd, 0x02b7c3d5, 0x02b7c455, 0x02b7c5d5, 0x02b7d8d1, 0x02b7da51,
+    0x02b7dad1, 0x02b7e1ce, 0x02b7eaca, 0x02b7edc6, 0x02b7eec2, 0x02b814d1, 0x02b81551, 0x02b816d1,
+    0x02b84d11, 0x02b84d91, 0x02b85191, 0x02b85211, 0x02b86085, 0x02b86181, 0x02b86601, 0x02b88905,
+    0x02b88a01, 0x02b88e81, 0x02b89ed9, 0x02b8a359, 0x02b8a4d9, 0x02b8b0d9, 0x02b8b259, 0x02b8b2d9,
+    0x02b8b6d9, 0x02b8b759, 0x02b8d959, 0x02b8dad9, 0x02b8db61, 0x02b8df59, 0x02b8dfe1, 0x02b8ed5a,
+    0x02b90905, 0x02b91865, 0x02b91cd5, 0x02b91d01, 0x02b91e55, 0x02b91ee1, 0x02b92be5, 0x02b92c65,
+    0x02b93055, 0x02b930d5, 0x02b93255, 0x02b940e5, 0x02b94551, 0x02b946d1, 0x02b94751, 0x02b94e4e,
+    0x02b9574a, 0x02b95a46, 0x02b95b42, 0x02b97ce5, 0x02b97d65, 0x02b98151, 0x02b981d1, 0x02b98351,
+    0x02b9cdd5, 0x02b9ce61, 0x02b9d255, 0x02b9d2e1, 0x02b9e1d6, 0x02b9f651, 0x02b9f6d1, 0x02b9fad1,
+    0x02b9fb51, 0x02ba32d2, 0x02ba7099, 0x02ba7511, 0x02ba7691, 0x02ba7711, 0x02ba870a, 0x02ba918d,
+    0x02ba920d, 0x02ba9b09, 0x02baaf8a, 0x02baca89, 0x02bad5d9, 0x02bada59, 0x02badbe5, 0x02badc65,
+    0x02bafe59, 0x02bb02d9, 0x02bb0459, 0x02bb0689, 0x02bb0709, 0x02bb11d9, 0x02bb1259, 0x02bb1659,
+    0x02bb16d9, 0x02bb1859, 0x02bb290a, 0x02bb2c06, 0x02bb53e5, 0x02bb5555, 0x02bb55d5, 0x02bb854e,
+    0x02bbc14d, 0x02bbc1cd, 0x02bbf155, 0x02bc19d1, 0x02bc958a, 0x02bc9886, 0x02bcc055, 0x02bcc1d5,
+    0x02bcc255, 0x02bcf1ce, 0x02bd2dcd, 0x02bd2e4d, 0x02bdf025, 0x02bdf1a5, 0x02bdf225, 0x02bdfffd,
+    0x02be0451, 0x02be05d1, 0x02be0651, 0x02be653d, 0x02be69a5, 0x02be6b25, 0x02be6ba5, 0x02be8dbd,
+    0x02be9225, 0x02be93aa, 0x02bea13d, 0x02bea1bd, 0x02bea5a5, 0x02bea625, 0x02bea7a5, 0x02beb199,
+    0x02beb499, 0x02beb599, 0x02beba01, 0x02beca59, 0x02beced5, 0x02bedc55, 0x02beddd5, 0x02bede55,
+    0x02bee255, 0x02bee2d5, 0x02bef2d9, 0x02bef751, 0x02bf70e5, 0x02bf7101, 0x02bf7251, 0x02bf72d1,
+    0x02bf85c6, 0x02bf86c2, 0x02bfae46, 0x02bfaf42, 0x02bfd625, 0x02bfd7a5, 0x02bfd825, 0x02bffea5,
+    0x02c00025, 0x02c00c25, 0x02c00da5, 0x02c00e25, 0x02c01225, 0x02c012a5, 0x02c01425, 0x02c02051,
+    0x02c021d6, 0x02c02251, 0x02c02651, 0x02c026d1, 0x02c03249, 0x02c03545, 0x02c03641, 0x02c05ac9,
+    0x02c05dc5, 0x02c05ec1, 0x02c073a5, 0x02c07825, 0x02c079a5, 0x02c085a5, 0x02c08725, 0x02c087a5,
+    0x02c08ba5, 0x02c08c25, 0x02c0ae25, 0x02c0afaa, 0x02c0b425, 0x02c0ccc9, 0x02c0ce45, 0x02c0d2c5,
+    0x02c0d695, 0x02c0d815, 0x02c0e045, 0x02c0e40d, 0x02c0e58d, 0x02c0e60d, 0x02c0e895, 0x02c0f78d,
+    0x02c0f80d, 0x02c0f98d, 0x02c0fc15, 0x02c0fc89, 0x02c0fd99, 0x02c108c5, 0x02c10c8d, 0x02c10e0d,
+    0x02c11111, 0x02c11e89, 0x02c129d9, 0x02c12e59, 0x02c12fd9, 0x02c13059, 0x02c13209, 0x02c13289,
+    0x02c13385, 0x02c13805, 0x02c13bd9, 0x02c13d65, 0x02c13ddd, 0x02c141d9, 0x02c14259, 0x02c143e5,
+    0x02c15a89, 0x02c16459, 0x02c165d9, 0x02c16659, 0x02c16ad9, 0x02c16e89, 0x02c177d9, 0x02c17859,
+    0x02c179d9, 0x02c17e59, 0x02c18245, 0x02c1860d, 0x02c1878d, 0x02c18aa5, 0x02c1980d, 0x02c1a7d5,
+    0x02c1a955, 0x02c1a9d5, 0x02c1ab89, 0x02c1ac09, 0x02c1ad0d, 0x02c1b6e5, 0x02c1b765, 0x02c1bb55,
+    0x02c1bbd5, 0x02c1bd55, 0x02c1c08d, 0x02c1d051, 0x02c1d1d1, 0x02c1d94e, 0x02c1e24a, 0x02c1e785,
+    0x02c1eb4d, 0x02c1eccd, 0x02c1ed4d, 0x02c1efe5, 0x02c1f745, 0x02c20665, 0x02c207e5, 0x02c213cd,
+    0x02c2154d, 0x02c215cd, 0x02c21865, 0x02c2274d, 0x02c227cd, 0x02c2294d, 0x02c22be5, 0x02c26ad5,
+    0x02c291c9, 0x02c2a6c5, 0x02c2f28d, 0x02c2f40d, 0x02c2f73d, 0x02c3048d, 0x02c31455, 0x02c315d5,
+    0x02c31655, 0x02c31889, 0x02c323fd, 0x02c327d5, 0x02c32855, 0x02c329d5, 0x02c32d0d, 0x02c33cd1,
+    0x02c33e51, 0x02c345ce, 0x02c34eca, 0x02c357cd, 0x02c3594d, 0x02c359cd, 0x02c35c7d, 0x02c362c9,
+    0x02c372fd, 0x02c3747d, 0x02c381cd, 0x02c384fd, 0x02c395cd, 0x02c3987d, 0x02c3a68d, 0x02c3b651,
+    0x02c3b7d1, 0x02c3c84a, 0x02c3d2cd, 0x02c3d34d, 0x02c3dd45, 0x02c3f0ca, 0x02c40bcd, 0x02c41ba5,
+    0x02c41d25, 0x02c41da5, 0x02c4344d, 0x02c44425, 0x02c445a5, 0x02c44625, 0x02c457a5, 0x02c45825,
+    0x02c459a5, 0x02c48cfd, 0x02c4adc9, 0x02c4b93d, 0x02c4bda5, 0x02c4bf25, 0x02c4bfa5, 0x02c4cb3d,
+    0x02c4d125, 0x02c4d1a5, 0x02c4d325, 0x02c4f3bd, 0x02c4f53d, 0x02c4f5bd, 0x02c4f9a5, 0x02c4fa25,
+    0x02c4fba5, 0x02c5073d, 0x02c507bd, 0x02c5093d, 0x02c50da5, 0x02c53255, 0x02c57ec9, 0x02c5bd59,
+    0x02c61a49, 0x02c625a5, 0x02c62a25, 0x02c62ba5, 0x02c62c25, 0x02c639a5, 0x02c63fa5, 0x02c661a5,
+    0x02c66225, 0x02c666a5, 0x02c66825, 0x02c675a5, 0x02c67a25, 0x02c6b055, 0x02c6d9a5, 0x02c6db25,
+    0x02c6dba5, 0x02c6e025, 0x02c6eda5, 0x02c6ef25, 0x02c6f3a5, 0x02c717a5, 0x02c74119, 0x02c74591,
+    0x02c74711, 0x02c74791, 0x02c7578a, 0x02c75a86, 0x02c7620d, 0x02c7628d, 0x02c76b09, 0x02c76b89,
+    0x02c76e85, 0x02c7800a, 0x02c78306, 0x02c79b09, 0x02c7a659, 0x02c7a705, 0x02c7aad9, 0x02c7ac75,
+    0x02c7ace1, 0x02c7ced9, 0x02c7d359, 0x02c7d4d9, 0x02c7e259, 0x02c7e2d9, 0x02c7e6d9, 0x02c7e759,
+    0x02c7e8d9, 0x02c7f98a, 0x02c7fc86, 0x02c82461, 0x02c825d5, 0x02c82655, 0x02c855ce, 0x02c85eca,
+    0x02c861c6, 0x02c8ac05, 0x02c8c1d5, 0x02c8d56a, 0x02c8d5d5, 0x02c8ea51, 0x02c90e49, 0x02c990d5,
+    0x02c99255, 0x02c992d5, 0x02c9c24e, 0x02c9cb4a, 0x02c9ce46, 0x02cac0a1, 0x02cac221, 0x02cac2a1,
+    0x02cad07d, 0x02cad4d1, 0x02cad651, 0x02cad6d1, 0x02cb35bd, 0x02cb3a21, 0x02cb3bb5, 0x02cb3c21,
+    0x02cb5e3d, 0x02cb62a1, 0x02cb642a, 0x02cb71bd, 0x02cb723d, 0x02cb7621, 0x02cb76a1, 0x02cb7821,
+    0x02cb9ad9, 0x02cb9f55, 0x02cba0d5, 0x02cbae59, 0x02cbaed9, 0x02cbb2d5, 0x02cbb355, 0x02cbc359,
+    0x02cbc7d1, 0x02cc42d1, 0x02cc4351, 0x02cc5646, 0x02cc5742, 0x02cc7fc2, 0x02cca6a1, 0x02cca835,
+    0x02cca8a1, 0x02cccf21, 0x02ccd0a1, 0x02cce2a1, 0x02cce321, 0x02cce4a1, 0x02ccf256, 0x02ccf2d1,
+    0x02ccf6d1, 0x02ccf751, 0x02cd05c5, 0x02cd2e45, 0x02cd4421, 0x02cd48a1, 0x02cd4a35, 0x02cd5621,
+    0x02cd57b5, 0x02cd5821, 0x02cd5c35, 0x02cd5ca1, 0x02cd7ea1, 0x02cd802a, 0x02cd84a1, 0x02cdd669,
+    0x02cdd7e9, 0x02cdd869, 0x02ce07ce, 0x02ce10ca, 0x02ce43ea, 0x02ce4469, 0x02cf07a9, 0x02cf0829,
+    0x02cf15e9, 0x02cf7b29, 0x02cf7fa9, 0x02cfa3aa, 0x02cfa829, 0x02cfa9aa, 0x02cfb71e, 0x02cfb79e,
+    0x02cfbb9e, 0x02cfbc1e, 0x02cfbd9e, 0x02d072a9, 0x02d07429, 0x02d074a9, 0x02d165a9, 0x02d16729,
+    0x02d167a9, 0x02d1f369, 0x02d258a9, 0x02d28129, 0x02d282a9, 0x02d28e9a, 0x02d2901a, 0x02d2909a,
+    0x02d2949a, 0x02d2951a, 0x02d2aa46, 0x02d2d3a9, 0x02d2d429, 0x02d356e9, 0x02d359ea, 0x02d35ae9,
+    0x02d36fa9, 0x02d38196, 0x02d38316, 0x02d38396, 0x02d38796, 0x02d38816, 0x02d39829, 0x02d3d412,
+    0x02d4088d, 0x02d40a0d, 0x02d40d19, 0x02d41a89, 0x02d425d9, 0x02d42a55, 0x02d42bd5, 0x02d42c55,
+    0x02d42e0d, 0x02d42e89, 0x02d42f85, 0x02d437d9, 0x02d439d9, 0x02d43dd5, 0x02d43e55, 0x02d43fd5,
+    0x02d44309, 0x02d44e59, 0x02d452d1, 0x02d45475, 0x02d45bce, 0x02d46a05, 0x02d46dcd, 0x02d46f75,
+    0x02d46fcd, 0x02d47259, 0x02d47875, 0x02d488d9, 0x02d48a59, 0x02d4964d, 0x02d497cd, 0x02d4984d,
+    0x02d49ad9, 0x02d4a9cd, 0x02d4aa4d, 0x02d4abcd, 0x02d4ae59, 0x02d4bc8d, 0x02d4c885, 0x02d4cc51,
+    0x02d4cdd1, 0x02d4d54e, 0x02d4de4a, 0x02d4e74d, 0x02d4e8cd, 0x02d4e94d, 0x02d4f081, 0x02d4f1c9,
+    0x02d4f249, 0x02d4f345, 0x02d4fdce, 0x02d506ca, 0x02d521cd, 0x02d52dc5, 0x02d5319d, 0x02d53335,
+    0x02d5339d, 0x02d55a1d, 0x02d55b9d, 0x02d55c1d, 0x02d56d9d, 0x02d56e1d, 0x02d56f9d, 0x02d57805,
+    0x02d57bd1, 0x02d57d51, 0x02d58dc9, 0x02d5a001, 0x02d5a149, 0x02d5a1c9, 0x02d5a2c5, 0x02d5b649,
+    0x02d5cf1d, 0x02d5d39d, 0x02d5d535, 0x02d5d59d, 0x02d5dd45, 0x02d5e11d, 0x02d5e2b5, 0x02d5e31d,
+    0x02d5e735, 0x02d5e79d, 0x02d6099d, 0x02d60b2a, 0x02d60b9d, 0x02d6101d, 0x02d61d1e, 0x02d61d9e,
+    0x02d61f1e, 0x02d6239e, 0x02d638d1, 0x02d63a51, 0x02d641ce, 0x02d64aca, 0x02d653cd, 0x02d655cd,
+    0x02d65e49, 0x02d66a4e, 0x02d6734a, 0x02d68e4d, 0x02d69e19, 0x02d69fb5, 0x02d6a019, 0x02d6c699,
+    0x02d6c819, 0x02d6c899, 0x02d6da19, 0x02d6da99, 0x02d6dc19, 0x02d6ecca, 0x02d713c5, 0x02d71795,
+    0x02d71915, 0x02d71995, 0x02d7520a, 0x02d77a8a, 0x02d79c7d, 0x02d7b53d, 0x02d7bb95, 0x02d7c37d,
+    0x02d7c73d, 0x02d7c8bd, 0x02d7c93d, 0x02d7ddbd, 0x02d7eb0e, 0x02d801bd, 0x02d8183d, 0x02d819bd,
+    0x02d82a3d, 0x02d83dbd, 0x02d8bc19, 0x02d8e499, 0x02d8e919, 0x02d92815, 0x02d9578e, 0x02d9608a,
+    0x02d9d795, 0x02d9dc15, 0x02db2e85, 0x02db2f81, 0x02db4455, 0x02db57d5, 0x02db5855, 0x02db6cd1,
+    0x02db8dcd, 0x02db90c9, 0x02db93c5, 0x02dd52fd, 0x02ddb83d, 0x02ddbe21, 0x02dde0b6, 0x02ddf43d,
+    0x02ddf4b6, 0x02de6dbd, 0x02de7421, 0x02de9b36, 0x02df74d1, 0x02df7551, 0x02df8845, 0x02df8941,
+    0x02dfb0c5, 0x02dfb1c1, 0x02dfc6a1, 0x02dfd8a1, 0x02dfda21, 0x02dfdaa1, 0x02dfdea1, 0x02dfe0a1,
+    0x02e00136, 0x02e002a1, 0x02e00336, 0x02e01536, 0x02e09021, 0x02e124d1, 0x02e12551, 0x02e13e4d,
+    0x02e13fcd, 0x02e1404d, 0x02e142c9, 0x02e14949, 0x02e14c45, 0x02e17a4d, 0x02e17af6, 0x02e17ec9,
+    0x02e17f76, 0x02e19851, 0x02e1bf45, 0x02e1f249, 0x02e1fd9d, 0x02e2021d, 0x02e2039d, 0x02e2041d,
+    0x02e22636, 0x02e22ab6, 0x02e22e49, 0x02e22ef6, 0x02e2399d, 0x02e23a36, 0x02e23e1d, 0x02e23eb6,
+    0x02e2a59d, 0x02e2b31d, 0x02e2b79d, 0x02e2b81d, 0x02e2b99d, 0x02e36a3d, 0x02e36e99, 0x02e37019,
+    0x02e37099, 0x02e3a63d, 0x02e3aa99, 0x02e3e3bd, 0x02e3e815, 0x02e4198e, 0x02e4558d, 0x02e4ef36,
+    0x02e58c19, 0x02e58c99, 0x02e59099, 0x02e59119, 0x02e5d949, 0x02e5f215, 0x02e5f695, 0x02e60415,
+    0x02e60595, 0x02e60615, 0x02e61a91, 0x02e61f11, 0x02e65691, 0x02e65736, 0x02e7924d, 0x02e793cd,
+    0x02e7944d, 0x02e796d9, 0x02e7a5cd, 0x02e7a64d, 0x02e7aa49, 0x02e7aadd, 0x02e7ce4d, 0x02e7d2c9,
+    0x02e7fa85, 0x02e7fe55, 0x02e81055, 0x02e81355, 0x02e823c9, 0x02e82449, 0x02e8255d, 0x02e838d1,
+    0x02e8561d, 0x02e8579d, 0x02e8581d, 0x02e859c9, 0x02e85a49, 0x02e85fc5, 0x02e8639d, 0x02e8651d,
+    0x02e8659d, 0x02e8699d, 0x02e86a29, 0x02e86b9d, 0x02e88249, 0x02e88c36, 0x02e88d9d, 0x02e88e36,
+    0x02e8921d, 0x02e89649, 0x02e89f9d, 0x02e8a036, 0x02e8a19d, 0x02e8a61d, 0x02e9059d, 0x02e9079d,
+    0x02e91b1d, 0x02e91f9d, 0x02e9c299, 0x02e9c419, 0x02e9c499, 0x02e9d1bd, 0x02e9d619, 0x02e9d699,
+    0x02e9d819, 0x02e9f8b6, 0x02e9fa3d, 0x02e9fe99, 0x02ea1efd, 0x02ea49bd, 0x02ea4b3d, 0x02ea4bbd,
+    0x02ea810d, 0x02ea818d, 0x02ea843d, 0x02ea9ab6, 0x02ea9c3d, 0x02eaa836, 0x02eaa98d, 0x02eaacb6,
+    0x02eaafbd, 0x02eabd8d, 0x02eac03d, 0x02eb218d, 0x02eb230d, 0x02eb238d, 0x02eb263d, 0x02ebb555,
+    0x02ebf299, 0x02ec5a15, 0x02ec6b95, 0x02ec8e0d, 0x02ec8f8d, 0x02ec900d, 0x02ec9289, 0x02ec9585,
+    0x02eca689, 0x02eca785, 0x02ece529, 0x02ed5ea9, 0x02ed6529, 0x02ed8da9, 0x02edb299, 0x02edb711,
+    0x02edb891, 0x02edb911, 0x02edc90a, 0x02edcc06, 0x02edd38d, 0x02edd40d, 0x02eddd09, 0x02ede005,
+    0x02edf18a, 0x02edf486, 0x02ee0c89, 0x02ee17d9, 0x02ee1c59, 0x02ee1de1, 0x02ee1e7d, 0x02ee4059,
+    0x02ee44d9, 0x02ee4659, 0x02ee53d9, 0x02ee5459, 0x02ee5859, 0x02ee58d9, 0x02ee5a59, 0x02ee6b0a,
+    0x02ee95f9, 0x02ee9755, 0x02ee97d5, 0x02eec74e, 0x02ef3355, 0x02ef5bd1, 0x02f00255, 0x02f003d5,
+    0x02f00455, 0x02f033ce, 0x02f13239, 0x02f133a1, 0x02f13421, 0x02f141fd, 0x02f14651, 0x02f147d1,
+    0x02f14851, 0x02f1a73d, 0x02f1aba1, 0x02f1ad21, 0x02f1adbd, 0x02f1cfbd, 0x02f1d421, 0x02f1d5a1,
+    0x02f1e33d, 0x02f1e3bd, 0x02f1e7a1, 0x02f1e821, 0x02f1e9a1, 0x02f20c59, 0x02f210d5, 0x02f21255,
+    0x02f21fd5, 0x02f22055, 0x02f22455, 0x02f224d5, 0x02f234d9, 0x02f23951, 0x02f2b451, 0x02f2b4d1,
+    0x02f2c7c6, 0x02f2c8c2, 0x02f31839, 0x02f319a1, 0x02f31a3d, 0x02f340b9, 0x02f34221, 0x02f34fa5,
+    0x02f35025, 0x02f35439, 0x02f354b9, 0x02f35621, 0x02f363d1, 0x02f36451, 0x02f36851, 0x02f368d1,
+    0x02f3b5a1, 0x02f3ba21, 0x02f3bba1, 0x02f3c7a1, 0x02f3c921, 0x02f3c9bd, 0x02f3cda1, 0x02f3ce3d,
+    0x02f3f021, 0x02f3f1a1, 0x02f3f621, 0x02f447e5, 0x02f44965, 0x02f449e5, 0x02f4794e, 0x02f4b565,
+    0x02f4b5e5, 0x02f57925, 0x02f579a5, 0x02f58765, 0x02f5eca5, 0x02f5f125, 0x02f61525, 0x02f619a5,
+    0x02f61b25, 0x02f6289e, 0x02f6291e, 0x02f62d1e, 0x02f62d9e, 0x02f62f1e, 0x02f6e425, 0x02f6e5a5,
+    0x02f6e625, 0x02f7d725, 0x02f7d8a5, 0x02f7d925, 0x02f864e5, 0x02f8ca25, 0x02f8f2a5, 0x02f8f425,
+    0x02f9001a, 0x02f9019a, 0x02f9021a, 0x02f9061a, 0x02f9069a, 0x02f918ca, 0x02f91bc6, 0x02f94525,
+    0x02f945a5, 0x02f9c865, 0x02f9cb65, 0x02f9cc65, 0x02f9e125, 0x02f9f316, 0x02f9f496, 0x02f9f516,
+    0x02f9f916, 0x02f9f996, 0x02fa09a5, 0x02fa4592, 0x02fa7a0d, 0x02fa7b8d, 0x02fa7e89, 0x02fa8c09,
+    0x02fa9755, 0x02fa9bd5, 0x02fa9d55, 0x02fa9dd5, 0x02fa9f89, 0x02faa009, 0x02faa105, 0x02faa589,
+    0x02faa959, 0x02faaad5, 0x02faab55, 0x02faaf55, 0x02faafd5, 0x02fab155, 0x02fab489, 0x02fabfd1,
+    0x02fac451, 0x02fac5d1, 0x02facd4e, 0x02fadb85, 0x02fadf4d, 0x02fae0cd, 0x02fae17d, 0x02fae3c9,
+    0x02fae6c5, 0x02fafa59, 0x02fafbd1, 0x02fb07cd, 0x02fb094d, 0x02fb09cd, 0x02fb0c49, 0x02fb1b4d,
+    0x02fb1bcd, 0x02fb1d4d, 0x02fb1fc9, 0x02fb2049, 0x02fb2e09, 0x02fb3965, 0x02fb3df9, 0x02fb3f51,
+    0x02fb46ce, 0x02fb4fca, 0x02fb5509, 0x02fb58f9, 0x02fb5a4d, 0x02fb5acd, 0x02fb6065, 0x02fb64f9,
+    0x02fb6f4e, 0x02fb784a, 0x02fb9349, 0x02fb9645, 0x02fb9ea5, 0x02fba339, 0x02fba49d, 0x02fba53d,
+    0x02fbbbc9, 0x02fbc725, 0x02fbcbb9, 0x02fbcd1d, 0x02fbcd9d, 0x02fbcf49, 0x02fbcfc9, 0x02fbdaa5,
+    0x02fbdb25, 0x02fbdf39, 0x02fbdfb9, 0x02fbe11d, 0x02fc1445, 0x02fc409d, 0x02fc451d, 0x02fc469d,
+    0x02fc473d, 0x02fc529d, 0x02fc589d, 0x02fc593d, 0x02fc7b1d, 0x02fc7c9d, 0x02fc7d1d, 0x02fc819d,
+    0x02fc8e9e, 0x02fc8f1e, 0x02fc909e, 0x02fc951e, 0x02fca5fd, 0x02fcaa51, 0x02fcabd1, 0x02fcb34e,
+    0x02fcbc4a, 0x02fcc54d, 0x02fcc6cd, 0x02fcc74d, 0x02fcccfd, 0x02fcdbce, 0x02fce4ca, 0x02fcffc9,
+    0x02fd0b3d, 0x02fd0f99, 0x02fd1119, 0x02fd11bd, 0x02fd33bd, 0x02fd3819, 0x02fd3999, 0x02fd3a19,
+    0x02fd473d, 0x02fd47bd, 0x02fd4b99, 0x02fd4c19, 0x02fd4d99, 0x02fd554e, 0x02fd5e4a, 0x02fd7c4d,
+    0x02fd8939, 0x02fd8a95, 0x02fd8b15, 0x02fdba8e, 0x02fdc38a, 0x02fdc686, 0x02fde30e, 0x02fdec0a,
+    0x02fdf68d, 0x02fdf70d, 0x02fe2d15, 0x02fe38bd, 0x02fe5c8e, 0x02fe89bd, 0x02ff2dbd, 0x02ff5619,
+    0x02ff5a99, 0x02ff9995, 0x02ffc90e, 0x03004915, 0x03004d95, 0x03011861, 0x030119e1, 0x03011a61,
+    0x030149ce, 0x030152ca, 0x030249a1, 0x03024a21, 0x030257e1, 0x0302bd21, 0x0302c1a1, 0x0302e5a1,
+    0x0302ea21, 0x0302eba1, 0x0302f91e, 0x0302f99e, 0x0302fd9e, 0x0302fe1e, 0x0302ff9e, 0x0303b4a1,
+    0x0303b621, 0x0303b6a1, 0x0304a7a1, 0x0304a921, 0x0304a9a1, 0x03059aa1, 0x0305c321, 0x0305c4a1,
+    0x0305d21a, 0x0305d29a, 0x0305d69a, 0x0305d71a, 0x030615a1, 0x03061621, 0x0306b1a1, 0x0306c516,
+    0x0306c596, 0x0306c996, 0x0306ca16, 0x0306da21, 0x03071612, 0x030dbbd9, 0x030dc051, 0x030dc1d1,
+    0x030dc251, 0x030dc94e, 0x030ddb4d, 0x030ddccd, 0x030ddd4d, 0x030de2d9, 0x030de5c9, 0x030de649,
+    0x030de945, 0x030df1ce, 0x030e15c9, 0x030e2119, 0x030e21c5, 0x030e2599, 0x030e2735, 0x030e27bd,
+    0x030e4999, 0x030e4e19, 0x030e4f99, 0x030e5019, 0x030e5d19, 0x030e5d99, 0x030e6199, 0x030e6219,
+    0x030e6399, 0x030e6b4e, 0x030e744a, 0x030e924d, 0x030e9b45, 0x030e9f39, 0x030ea095, 0x030ea115,
+    0x030ed08e, 0x030ed98a, 0x030edc86, 0x030ef90e, 0x030f020a, 0x030f0c8d, 0x030f0d0d, 0x030f1589,
+    0x030f1609, 0x030f23c9, 0x030f3c95, 0x030f4645, 0x030f4ac5, 0x030f4e95, 0x030f5015, 0x030f5095,
+    0x030f6511, 0x030f848d, 0x030f8909, 0x030f8c05, 0x030f9f91, 0x030fa111, 0x030fad0d, 0x030fb189,
+    0x030fc09e, 0x030fc11e, 0x030fc51e, 0x030fc59e, 0x03100b95, 0x03100d15, 0x03100d95, 0x03103d0e,
+    0x0310460a, 0x0310bf8a, 0x0310c286, 0x03113b79, 0x03113cf5, 0x03113d75, 0x03114b3d, 0x03114f91,
+    0x03115111, 0x03115191, 0x03116a8d, 0x03116f3d, 0x0311723d, 0x0311b07d, 0x0311b4f5, 0x0311b675,
+    0x0311b6fd, 0x0311d8fd, 0x0311dd75, 0x0311def5, 0x0311df75, 0x0311eafd, 0x0311ec7d, 0x0311ecfd,
+    0x0311f0f5, 0x0311f175, 0x0311f2f5, 0x03121599, 0x03121a15, 0x03121b95, 0x03122919, 0x03122999,
+    0x03122d95, 0x03122e15, 0x03123e19, 0x03124291, 0x0312bd91, 0x0312be11, 0x03132179, 0x031322f5,
+    0x0313237d, 0x031349f9, 0x03134b75, 0x03134bf5, 0x03135d79, 0x03135df9, 0x03135f75, 0x03136d11,
+    0x03136d91, 0x03137191, 0x03137211, 0x0313bef5, 0x0313c375, 0x0313c4f5, 0x0313c57d, 0x0313d0f5,
+    0x0313d275, 0x0313d2fd, 0x0313d6f5, 0x0313d77d, 0x0313f975, 0x0313faf5, 0x0313fb75, 0x0313ff75,
+    0x0313fff5, 0x03143ee1, 0x031466d1, 0x0314da51, 0x03150145, 0x03153f9d, 0x0315459d, 0x03156836,
+    0x03157b9d, 0x03157c36, 0x0316b219, 0x031725bd, 0x0317ce21, 0x0317f611, 0x03183136, 0x0318c099,
+    0x0318ce19, 0x0318d299, 0x0318f736, 0x0318fbb6, 0x03191f41, 0x03193415, 0x03193aa1, 0x03194795,
+    0x03194815, 0x03195c91, 0x03196291, 0x03199891, 0x03199936, 0x0319ea21, 0x0319eea1, 0x031a1211,
+    0x031a1691, 0x031a8c51, 0x031a90d1, 0x031a9251, 0x031a92d1, 0x031aad4d, 0x031aadcd, 0x031ab6c9,
+    0x031ab9c5, 0x031ae649, 0x031af199, 0x031af619, 0x031af799, 0x031af83d, 0x031b1a36, 0x031b1eb6,
+    0x031b2019, 0x031b2d99, 0x031b2e36, 0x031b3219, 0x031b32b6, 0x031b3419, 0x031b6b15, 0x031b6fb9,
+    0x031b7115, 0x031b7195, 0x031ba10e, 0x031bdd0d, 0x031bddb6, 0x031c0d15, 0x031c3591, 0x031cd7bd,
+    0x031cdc15, 0x031cdd95, 0x031cde15, 0x031d0d8e, 0x031d498d, 0x031d4a36, 0x031e0776, 0x031e0bf6,
+    0x031e0d75, 0x031e0df6, 0x031e1bbd, 0x031e2011, 0x031e2191, 0x031e2211, 0x031e80fd, 0x031e8575,
+    0x031e86f5, 0x031e877d, 0x031ea976, 0x031eadf6, 0x031eaf75, 0x031ebcfd, 0x031ebd76, 0x031ec175,
+    0x031ec1f6, 0x031ec375, 0x031ecd49, 0x031ed045, 0x031ed141, 0x031ed4c5, 0x031ed5c1, 0x031ee615,
+    0x031eea95, 0x031eec15, 0x031ef816, 0x031ef995, 0x031efa16, 0x031efe15, 0x031efe96, 0x031f0e91,
+    0x031f1311, 0x031f4fb6, 0x031f8811, 0x031f88c5, 0x031f8cb9, 0x031f8cc1, 0x031f8e11, 0x031f8e91,
+    0x031f9e8a, 0x031fa186, 0x031fc70a, 0x031fca06, 0x031fed75, 0x031ff1f9, 0x031ff375, 0x031ff3fd,
+    0x032015f6, 0x03201a76, 0x03201bf5, 0x032027f6, 0x03202975, 0x032029f6, 0x03202df9, 0x03202e76,
+    0x03202ff5, 0x03203c16, 0x03203d91, 0x03203e11, 0x03204211, 0x03204291, 0x03204e09, 0x03205105,
+    0x03205201, 0x03207689, 0x03207985, 0x03207a81, 0x03208f75, 0x032093f5, 0x03209575, 0x0320a175,
+    0x0320a2f5, 0x0320a37d, 0x0320a775, 0x0320a7fd, 0x0320a97d, 0x0320c9f6, 0x0320cb75, 0x0320cff5,
+    0x03211955, 0x03214a19, 0x03214b99, 0x03214c3d, 0x03215799, 0x03215919, 0x03215d99, 0x03215e3d,
+    0x03215fbd, 0x03218036, 0x03218199, 0x03218619, 0x03219399, 0x03219436, 0x03219599, 0x0321a649,
+    0x0321bf15, 0x0321c595, 0x0321cd49, 0x0321d295, 0x0321d315, 0x0321e791, 0x0322088d, 0x0322093d,
+    0x03220b89, 0x03220e85, 0x03222236, 0x03222391, 0x0322310d, 0x032231b6, 0x03223436, 0x03223705,
+    0x0322450d, 0x03224789, 0x03224836, 0x03224939, 0x0322a90d, 0x0322ad89, 0x03233215, 0x0323b5bd,
+    0x0323cdbd, 0x0323f4bd, 0x032432fd, 0x03243779, 0x032438f5, 0x0324397d, 0x03245b76, 0x03245ff6,
+    0x03246175, 0x032461f6, 0x03246efd, 0x03246f76, 0x03247379, 0x032473f6, 0x03247575, 0x0324a8bd,
+    0x0324d4fd, 0x0324d975, 0x0324daf5, 0x0324db7d, 0x0324e6fd, 0x0324e87d, 0x0324ecf5, 0x0324ed7d,
+    0x0324eefd, 0x03250f76, 0x032510fd, 0x03251176, 0x03251575, 0x032515f6, 0x03251775, 0x032522fd,
+    0x03252376, 0x032524fd, 0x03252975, 0x03259abd, 0x03261539, 0x03264175, 0x032645f9, 0x03264775,
+    0x032647fd, 0x03265379, 0x032654f5, 0x0326557d, 0x03265979, 0x03265b7d, 0x03267d75, 0x03267df6,
+    0x032681f9, 0x03268276, 0x032683f5, 0x03268f79, 0x03269175, 0x032695f9, 0x0326f575, 0x0326f6f5,
+    0x0326f77d, 0x0326fbfd, 0x0327097d, 0x03270afd, 0x03270f7d, 0x03273375, 0x0327b461, 0x0327c7d9,
+    0x032a9fa1, 0x032aa121, 0x032aa1a1, 0x032ac83e, 0x032ac9be, 0x032aca21, 0x032adc21, 0x032b41a1,
+    0x032b433a, 0x032b43ba, 0x032b513a, 0x032b55a1, 0x032b573a, 0x032b793a, 0x032b7dbe, 0x032b7fba,
+    0x032ca9a5, 0x032cae21, 0x032cafa1, 0x032cb021, 0x032cbba5, 0x032cbda5, 0x032cc1a1, 0x032cc221,
+    0x032cc3a1, 0x032ce43e, 0x032ce5be, 0x032cea3e, 0x032ceaa1, 0x032cec21, 0x032cf825, 0x032d5f3a,
+    0x032d5fba, 0x032d63a1, 0x032d6421, 0x032d733a, 0x032d9bba, 0x032e7b65, 0x032e7fd1, 0x032ee51d,
+    0x032f96ba, 0x032f9cba, 0x032fbeba, 0x0330cb15, 0x03311c3e, 0x0331973a, 0x033197ba, 0x03326199,
+    0x03327599, 0x0332bc65, 0x0332bf65, 0x0332c065, 0x0332c4c1, 0x0332d525, 0x0332d995, 0x0332e8a5,
+    0x0332e925, 0x0332ed15, 0x0332ed95, 0x0332fda5, 0x03330211, 0x03330391, 0x03330411, 0x0333383e,
+    0x033339be, 0x03333e3e, 0x03333e91, 0x0333b33a, 0x0333b3ba, 0x0333b791, 0x0333b811, 0x03353b1d,
+    0x03354d1d, 0x0336a799, 0x0336b53d, 0x03389855, 0x0339c826, 0x033a41a5, 0x033ab061, 0x033ad8d1,
+    0x033af3cd, 0x033afcc9, 0x033affc5, 0x033b5051, 0x033bb59d, 0x033bb79d, 0x033bde3e, 0x033be021,
+    0x033bf1be, 0x033bf21d, 0x033c66ba, 0x033c673a, 0x033c6b9d, 0x033c6d3a, 0x033c8f3a, 0x033c8fba,
+    0x033c9421, 0x033d2419, 0x033d4ca1, 0x033d9b95, 0x033decbe, 0x033e3fba, 0x033e4cba, 0x033e683a,
+    0x033f32a1, 0x033f4019, 0x033f4499, 0x033f6d21, 0x033faa15, 0x033fac21, 0x033fbd95, 0x033fbe15,
+    0x033fd291, 0x033fd491, 0x03400ebe, 0x03400f11, 0x03405bba, 0x03406021, 0x0340843a, 0x03408891,
+    0x0340fdd9, 0x03410251, 0x034103d1, 0x03410451, 0x03411ed6, 0x03411f4d, 0x034127c9, 0x03412849,
+    0x03412b45, 0x034157c9, 0x03416319, 0x034163c5, 0x03416799, 0x03416935, 0x03416999, 0x03418bbe,
+    0x0341903e, 0x034191be, 0x03419f3e, 0x03419f9a, 0x0341a3be, 0x0341a419, 0x0341a59a, 0x0341e115,
+    0x0341e295, 0x0341e315, 0x0342128e, 0x03421b8a, 0x03421e86, 0x03424ebe, 0x03424f0d, 0x03427eba,
+    0x0342923a, 0x0342a73a, 0x03434d95, 0x03434f15, 0x03434f95, 0x03437f0e, 0x0343880a, 0x03438b06,
+    0x0343bb3e, 0x0343bb8d, 0x03447d7e, 0x03447efe, 0x03447f75, 0x03448d3a, 0x03449191, 0x0344933a,
+    0x034493ba, 0x0344f27a, 0x0344f6f5, 0x0344f87a, 0x0344f8fa, 0x03451afa, 0x03451f7e, 0x034520fa,
+    0x03452e7a, 0x03452efa, 0x034532fe, 0x03453375, 0x034534fa, 0x03453ed9, 0x034541da, 0x034542d9,
+    0x03454741, 0x03455799, 0x03455c15, 0x03455d95, 0x03456b1a, 0x03456b9a, 0x03456f96, 0x03457015,
+    0x0345719a, 0x03458019, 0x03458491, 0x03458691, 0x0345fe11, 0x0345fe41, 0x0345ff91, 0x03460011,
+    0x03461306, 0x03461402, 0x03463b86, 0x03463c82, 0x03466375, 0x034664f5, 0x03466575, 0x03468bfe,
+    0x03468d7e, 0x03469f7e, 0x03469ff5, 0x0346a175, 0x0346ad96, 0x0346af3a, 0x0346afba, 0x0346b396,
+    0x0346b411, 0x0346bf89, 0x0346c2ba, 0x0346c3ba, 0x0346e809, 0x0346eb3a, 0x0346ec3a, 0x034700fa,
+    0x03470575, 0x034706fa, 0x034712f5, 0x0347147a, 0x034714fa, 0x034718f5, 0x03471975, 0x03471afa,
+    0x03473b7e, 0x03473cfa, 0x0347417e, 0x0347bd99, 0x03483715, 0x0349a395, 0x034aa8f5, 0x034aaa75,
+    0x034aaaf5, 0x034ad17e, 0x034ad2fe, 0x034ad375, 0x034ae4fe, 0x034ae575, 0x034ae6f5, 0x034b467a,
+    0x034b4af5, 0x034b4cfa, 0x034b587d, 0x034b5a7a, 0x034b5ef5, 0x034b80fe, 0x034b827a, 0x034b82fa,
+    0x034b86fe, 0x034b8775, 0x034b88fa, 0x034b947e, 0x034b94fd, 0x034b967a, 0x034b9af5, 0x034cb775,
+    0x034cb8f5, 0x034cb975, 0x034ccaf5, 0x034ccb75, 0x034cccf5, 0x034cf3f5, 0x034cf575, 0x034d0775,
+    0x034d66f5, 0x034d68fa, 0x034d6cf5, 0x034d6d75, 0x034d7af5, 0x034da4fa, 0x0353e921, 0x035411a2,
+    0x03550116, 0x03552991, 0x03570fbd, 0x035774fd, 0x03577975, 0x03577af5, 0x03577b75, 0x03579d76,
+    0x0357a37e, 0x0357b0fe, 0x0357b57e, 0x0357b5f6, 0x035816fa, 0x03581b75, 0x03581cfa, 0x035828fd,
+    0x03582a7a, 0x03582ef5, 0x03582f75, 0x035830fa, 0x0358577e, 0x03593016, 0x03593191, 0x03593211,
+    0x03594216, 0x03594505, 0x03594601, 0x03596a89, 0x03596d85, 0x03596e81, 0x03598375, 0x035987f5,
+    0x03598975, 0x03599575, 0x035996f5, 0x03599775, 0x03599b75, 0x03599bf5, 0x03599d75, 0x0359bdf6,
+    0x0359bf7e, 0x0359d1f6, 0x035a38fa, 0x035a3d75, 0x035a4cfa, 0x035aa789, 0x035aaa85, 0x035ab385,
+    0x035ab755, 0x035ab8d5, 0x035acad5, 0x035ae84d, 0x035ae8cd, 0x035af149, 0x035af1c9, 0x035b1bd1,
+    0x035b2375, 0x035b24cd, 0x035b29be, 0x035b2dc9, 0x035bb10d, 0x035bd93e, 0x035bddbe, 0x035c0ed1,
+    0x035c164d, 0x035c17f9, 0x035c20c9, 0x035c5049, 0x035c50c9, 0x035c5bb9, 0x035c5c39, 0x035c601d,
+    0x035c609d, 0x035c6239, 0x035c6d9d, 0x035c741d, 0x035c8cc9, 0x035c96b5, 0x035c9839, 0x035c9c9d,
+    0x035d223d, 0x035d45be, 0x035d4a3e, 0x035d60be, 0x035ddafd, 0x035ddc7d, 0x035ddcfd, 0x035de0f5,
+    0x035de175, 0x035de2f5, 0x035df9be, 0x035e04fe, 0x035e16fe, 0x035e18fd, 0x035e1d75, 0x035e53be,
+    0x035e5a15, 0x035e7cfd, 0x035e7e7a, 0x035e7efa, 0x035e90fd, 0x035e927a, 0x035e96f5, 0x035eab11,
+    0x035ee7d1, 0x035eeb85, 0x035eef4d, 0x035ef0cd, 0x035ef9c9, 0x035f2949, 0x035f29c9, 0x035f3499,
+    0x035f3519, 0x035f3919, 0x035f3999, 0x035f3b19, 0x035f4699, 0x035f4d19, 0x035f65c9, 0x035f6f3d,
+    0x035f6fb5, 0x035f7119, 0x035f7599, 0x035fc015, 0x035fe975, 0x035feaf5, 0x035feb75, 0x035ffd75,
+    0x036058c9, 0x03606215, 0x03606295, 0x03606439, 0x03606895, 0x03609111, 0x0360980d, 0x0360988d,
+    0x0360d48e, 0x0360fb89, 0x0360fe85, 0x03610785, 0x03610b51, 0x03610cd1, 0x03610e85, 0x036113cd,
+    0x03611462, 0x03611cc9, 0x0361264d, 0x036127cd, 0x036130c9, 0x03615e19, 0x03617099, 0x03617236,
+    0x0361774d, 0x036178cd, 0x036181c9, 0x036188c9, 0x03618962, 0x03618c62, 0x03619419, 0x0361989d,
+    0x03619922, 0x03619aa2, 0x0361a699, 0x0361a819, 0x0361ac99, 0x03626a4d, 0x03626bcd, 0x036274c9,
+    0x03627bc9, 0x03627c62, 0x03627f62, 0x03628715, 0x03628b95, 0x03628c22, 0x03628da2, 0x03629995,
+    0x03629b15, 0x03629f95, 0x0362ea91, 0x0362ec11, 0x0362f091, 0x0362f78d, 0x03632e11, 0x03634201,
+    0x03636a81, 0x03637f59, 0x03639359, 0x0363e511, 0x0363f8d5, 0x03640cd5, 0x03640e55, 0x03642151,
+    0x03644581, 0x036446c9, 0x03644845, 0x03644941, 0x03644a45, 0x03644ac1, 0x03645dd1, 0x03645f51,
+    0x03646e01, 0x03646f49, 0x036470c5, 0x036471c1, 0x036472e1, 0x03647341, 0x0364aee1, 0x0364d2d1,
+    0x0364d751, 0x0364eb41, 0x0364ed61, 0x0364ffe1, 0x036527e1, 0x03653be1, 0x0365434d, 0x036544cd,
+    0x03654991, 0x03654a11, 0x03654dfd, 0x036554c9, 0x03655e01, 0x03656015, 0x036564bd, 0x03656522,
+    0x036566a2, 0x03657295, 0x03657415, 0x036578bd, 0x03658681, 0x03659b59, 0x0365aed9, 0x0365af59,
+    0x0365b9c9, 0x0365c391, 0x0365c511, 0x0365c9bd, 0x0365d08d, 0x0365e48e, 0x03660125, 0x036614e5,
+    0x03661525, 0x03661665, 0x03662865, 0x036628e5, 0x03663d65, 0x03663f65, 0x036643fe, 0x03665365,
+    0x036659fd, 0x03666c7d, 0x03667965, 0x036679e5, 0x03667b65, 0x03668fe6, 0x0366988e, 0x0366a266,
+    0x0366a3e6, 0x0366a87d, 0x0366acc9, 0x0366b691, 0x0366b811, 0x0366bcbd, 0x0366c38d, 0x0366ca55,
+    0x0366cae1, 0x0366d78e, 0x0366f2d1, 0x0366f351, 0x03670961, 0x03670dfd, 0x03671236, 0x03671be1,
+    0x03671d76, 0x036721fe, 0x0367288e, 0x03673aa2, 0x036743e1, 0x03674462, 0x036745e2, 0x03674a62,
+    0x03677849, 0x03677b45, 0x03678395, 0x03678815, 0x03678995, 0x03678bc9, 0x03678c49, 0x03678f45,
+    0x03679845, 0x03679b95, 0x03679c15, 0x03679d95, 0x0367cd0d, 0x0367cd8d, 0x0367f045, 0x0367f40d,
+    0x0367f58d, 0x0367fe9d, 0x0368078d, 0x0368080d, 0x0368098d, 0x03681299, 0x036890dd, 0x0368915d,
+    0x0368b366, 0x0368b7dd, 0x0368b95d, 0x0368cb5d, 0x0368cbdd, 0x0368cd5d, 0x0368e345, 0x0368e70d,
+    0x0368e88d, 0x0368f189, 0x0368fa8d, 0x0368fb0d, 0x0368fc8d, 0x03690595, 0x03692189, 0x03692cdd,
+    0x0369315d, 0x036932dd, 0x03693509, 0x03693589, 0x0369405d, 0x036940dd, 0x036944dd, 0x0369455d,
+    0x036946f6, 0x03695d89, 0x0369675d, 0x036968e9, 0x03696d5d, 0x03697add, 0x03697b5d, 0x03697cdd,
+    0x03699601, 0x0369aad5, 0x0369bed5, 0x0369d351, 0x036a25d9, 0x036a4cd1, 0x036a4d01, 0x036a4e51,
+    0x036a61c6, 0x036a75c5, 0x036a8a46, 0x036aae45, 0x036ab225, 0x036ab241, 0x036ab3a5, 0x036ab425,
+    0x036ac6d1, 0x036ad6c5, 0x036adaa5, 0x036adac1, 0x036adc25, 0x036aeea5, 0x036af025, 0x036b02d1,
+    0x036b5425, 0x036b63a5, 0x036b6825, 0x036b8dc9, 0x036b974d, 0x036b98cd, 0x036ba1c9, 0x036bb201,
+    0x036bc00d, 0x036bc18d, 0x036bc6d5, 0x036bd38d, 0x036bd40d, 0x036bd58d, 0x036bda55, 0x036bdad5,
+    0x036bdebd, 0x036bef51, 0x036c05d9, 0x036c0a7d, 0x036c0bfd, 0x036c1966, 0x036c19d9, 0x036c1dfd,
+    0x036c1e7d, 0x036c1ffe, 0x036c368d, 0x036c4059, 0x036c41d9, 0x036c53d9, 0x036c5459, 0x036c55d9,
+    0x036c68e5, 0x036c6925, 0x036c6a65, 0x036c7de5, 0x036c91e5, 0x036ca765, 0x036cbc25, 0x036cce25,
+    0x036cd025, 0x036cf6a5, 0x036cf825, 0x036d0005, 0x036d034d, 0x036d03cd, 0x036d054d, 0x036d0a25,
+    0x036d0aa5, 0x036d0c25, 0x036d0e7d, 0x036d1e51, 0x036d1ed1, 0x036d2989, 0x036d3355, 0x036d34d5,
+    0x036d397d, 0x036d46d5, 0x036d4755, 0x036d48d5, 0x036d694d, 0x036d7025, 0x036d7985, 0x036d7ccd,
+    0x036d7d4d, 0x036d7ef6, 0x036d83a5, 0x036d8425, 0x036d87fe, 0x036da54d, 0x036da9c9, 0x036dac25,
+    0x036dce4d, 0x036dcfcd, 0x036dd8c9, 0x036ddfc9, 0x036de049, 0x036de345, 0x036deb15, 0x036dec45,
+    0x036def95, 0x036df015, 0x036df195, 0x036dfd15, 0x036dfd95, 0x036dff15, 0x036e0395, 0x036e211a,
+    0x036e218d, 0x036e4ea5, 0x036e5011, 0x036e5491, 0x036e5ba5, 0x036e5c25, 0x036e5d8d, 0x036e6689,
+    0x036ee4de, 0x036ee55e, 0x036ef76a, 0x036f1ae6, 0x036f1f69, 0x036f1fe5, 0x036f215d, 0x036f2ce6,
+    0x036f2d66, 0x036f2ee6, 0x036f335d, 0x036f4191, 0x036f4325, 0x036f4791, 0x036f4e8d, 0x036f4f0d,
+    0x036f50a5, 0x036f5989, 0x036f8909, 0x036f8989, 0x036f9465, 0x036f94e5, 0x036f98dd, 0x036f995d,
+    0x036f9ae5, 0x036fa65d, 0x036fa6dd, 0x036fa865, 0x036facdd, 0x036fc589, 0x036fcee5, 0x036fcf65,
+    0x036fd0e5, 0x036fd55d, 0x03708be5, 0x03709959, 0x03714425, 0x03718c55, 0x0371bc25, 0x03721a91,
+    0x03721c11, 0x037220bd, 0x0372278d, 0x0372280d, 0x0372298d, 0x037232bd, 0x03726d66, 0x03726dd9,
+    0x037271fd, 0x0372727d, 0x037273fd, 0x03727f66, 0x03727fda, 0x03728166, 0x037285fd, 0x03728c8e,
+    0x03729e89, 0x0372a7d9, 0x0372a865, 0x0372a9d9, 0x0372ae7d, 0x03731ce6, 0x03736fca, 0x03737f8e,
+    0x03739189, 0x03739ad5, 0x03739b55, 0x03739ce5, 0x0373a17d, 0x0373d0cd, 0x0373d14d, 0x0373d825,
+    0x03740d4e, 0x03767b55, 0x03768f55, 0x0376a3d1, 0x03771f51, 0x03774645, 0x03777ec5, 0x037782a1,
+    0x037782c1, 0x03778435, 0x037784a1, 0x0377a745, 0x0377ab21, 0x0377ab41, 0x0377aca1, 0x0377ad21,
+    0x0377bf21, 0x0377c0a1, 0x0377d351, 0x037824a1, 0x03783421, 0x037838a1, 0x03786121, 0x03789759,
+    0x0378aad9, 0x0378ab59, 0x0378bfd9, 0x0379eed1, 0x0379ef51, 0x037a40a1, 0x037a5435, 0x037a54a1,
+    0x037a7ca1, 0x037a7d21, 0x037b2a89, 0x037b35da, 0x037b3a5d, 0x037b3e0d, 0x037b3e89, 0x037b495a,
+    0x037b4e59, 0x037bf8ce, 0x037c01dd, 0x037c7276, 0x037c72cd, 0x037c994d, 0x037cad5d, 0x037cb15d,
+    0x037ccf51, 0x037d3499, 0x037d5d19, 0x037d7119, 0x037d8646, 0x037d8742, 0x037dae15, 0x037daf95,
+    0x037db015, 0x037de88a, 0x037deb86, 0x037dec82, 0x037dff11, 0x037e0091, 0x037e0111, 0x037e110a,
+    0x037e1406, 0x037e1502, 0x037e2805, 0x037e2929, 0x037e5015, 0x037e6415, 0x037e7891, 0x037eb511,
+    0x037ec9a9, 0x037ecd49, 0x037ecdc9, 0x037ed8a9, 0x037ed929, 0x037edd29, 0x037edda9, 0x037edf29,
+    0x037eeb59, 0x037f5099, 0x037f724d, 0x037f7919, 0x037f8659, 0x037f8a5a, 0x037f8c9a, 0x037f8d1a,
+    0x03800f36, 0x03800fbd, 0x038039ce, 0x03803a4e, 0x03804a3d, 0x03804bbd, 0x03806c15, 0x03807f96,
+    0x03808016, 0x03809491, 0x0380ab29, 0x0380afbd, 0x0380b136, 0x0380beb6, 0x0380bf29, 0x0380c336,
+    0x0380c3bd, 0x0380c536, 0x0380d092, 0x0380d112, 0x0380e5a9, 0x03819209, 0x03819289, 0x0381a1dd,
+    0x0381a259, 0x0381af5a, 0x0381afda, 0x038296d5, 0x0382a455, 0x0382c676, 0x0382c6cd, 0x0382f3d1,
+    0x0382f551, 0x038300cd, 0x0383014d, 0x038302cd, 0x03847c05, 0x0384b815, 0x0384f6b6, 0x0384f729,
+    0x03850929, 0x03853129, 0x038531a9, 0x03853329, 0x03853ea9, 0x03854529, 0x0385ccda, 0x0385d9cd,
+    0x0385da4d, 0x03866336, 0x038663bd, 0x03869e3d, 0x03869fbd, 0x0386b1bd, 0x0386c151, 0x0386cecd,
+    0x0386d415, 0x038712b6, 0x03871329, 0x03871736, 0x038717bd, 0x03871936, 0x038724b6, 0x03872529,
+    0x038726b6, 0x03874d29, 0x03874da9, 0x03874f29, 0x038753bd, 0x03876f4d, 0x038770cd, 0x038779c9,
+    0x038780c9, 0x03878162, 0x03878462, 0x03878c15, 0x03879095, 0x03879122, 0x038792a2, 0x03879e95,
+    0x0387a015, 0x0387a495, 0x0387efb5, 0x0387f111, 0x0387f591, 0x0387fca1, 0x038885de, 0x0388986a,
+    0x038899dd, 0x0388bbe1, 0x0388c069, 0x0388ce75, 0x0388cfdd, 0x0388d45d, 0x0388e291, 0x0388e411,
+    0x0388e891, 0x0388ef8d, 0x03893561, 0x038939dd, 0x03893a62, 0x03893be2, 0x038947dd, 0x03894961,
+    0x03894ddd, 0x03896fe1, 0x03897062, 0x038971e2, 0x03897662, 0x038a2ce1, 0x038b2062, 0x038b21e2,
+    0x038b33d5, 0x038b48d1, 0x038b4a51, 0x038b84d1, 0x038bb1c9, 0x038bbb91, 0x038bbd11, 0x038bc1bd,
+    0x038bc88d, 0x038bdc8e, 0x038c0e59, 0x038c12fd, 0x038c20d9, 0x038c2259, 0x038c26fd, 0x038c2d8e,
+    0x038c48e1, 0x038c4962, 0x038c4ae2, 0x038c4f62, 0x038c6e05, 0x038c71d1, 0x038c7351, 0x038c83e1,
+    0x038c86e1, 0x038c8741, 0x038cac49, 0x038caf45, 0x038cc321, 0x038cc341, 0x038cc4a1, 0x038cc521,
+    0x038cd6a1, 0x038cd729, 0x038cd8a1, 0x038cff2a, 0x038cffb6, 0x038d0121, 0x038d0c4e, 0x038d10ca,
+    0x038d208e, 0x038d3bd5, 0x038d3c62, 0x038d3de2, 0x038d4262, 0x038d6afd, 0x038d85ce, 0x038dd552,
+    0x038dd852, 0x038de152, 0x038de845, 0x038dec0d, 0x038ded8d, 0x038df689, 0x038dff8d, 0x038e000d,
+    0x038e018d, 0x038e0a89, 0x038e2689, 0x038e31d9, 0x038e3659, 0x038e37d9, 0x038e3a09, 0x038e3a89,
+    0x038e4559, 0x038e45d9, 0x038e49d9, 0x038e4a59, 0x038e4bd9, 0x038e6289, 0x038e6c75, 0x038e6dd9,
+    0x038e725d, 0x038e7689, 0x038e7fd9, 0x038e8075, 0x038e81d9, 0x038e8659, 0x038f3a49, 0x038f5589,
+    0x038f5f55, 0x038f60d5, 0x038f6555, 0x038f6989, 0x038f72d5, 0x038f7355, 0x038f74d5, 0x038f7955,
+    0x038f954d, 0x038f96cd, 0x038fa8cd, 0x038fa94d, 0x038faacd, 0x038fb3c9, 0x038fd14d, 0x038fe54e,
+    0x039092c9, 0x03912529, 0x039125a9, 0x03914c35, 0x03914da9, 0x03915fa9, 0x03916035, 0x039161a9,
+    0x0391c129, 0x0391c5a9, 0x0391c729, 0x0391d4a9, 0x0391d529, 0x0391d929, 0x0391d9a9, 0x0391db29,
+    0x0391fbb5, 0x039201a9, 0x039205c9, 0x03920f29, 0x03920fb5, 0x03921129, 0x039215a9, 0x03922e89,
+    0x03923855, 0x039239d5, 0x03923e7d, 0x03924289, 0x03924bd5, 0x03924c55, 0x03924dd5, 0x0392527d,
+    0x03926e4d, 0x039281cd, 0x0392824d, 0x0392aa4d, 0x0392aec9, 0x0392be4e, 0x0392d7d1, 0x0392dad1,
+    0x0392db41, 0x0392ee95, 0x0392eec1, 0x0392f015, 0x03930215, 0x03930295, 0x03930415, 0x03931711,
+    0x03931741, 0x03931891, 0x03931911, 0x03932c05, 0x03932d01, 0x03932da9, 0x0393323d, 0x039333bd,
+    0x03933d09, 0x03934005, 0x03934129, 0x039341a9, 0x039345bd, 0x0393463d, 0x039347bd, 0x03935311,
+    0x039353b6, 0x03935511, 0x03936835, 0x039369a9, 0x03937249, 0x03937ba9, 0x03937c35, 0x03937da9,
+    0x0393823d, 0x03939d4d, 0x0393b14e, 0x0393e1a9, 0x0393e329, 0x0393e7bd, 0x0393ebc9, 0x0393f529,
+    0x0393f5a9, 0x0393f729, 0x0393fbbd, 0x03941da9, 0x039446a9, 0x03944829, 0x03944ca9, 0x039453a9,
+    0x03945429, 0x039455a9, 0x03945ea9, 0x03948e29, 0x03948ea9, 0x03949969, 0x039499e9, 0x03949de9,
+    0x03949e69, 0x03949fe9, 0x0394ab69, 0x0394abe9, 0x0394ad69, 0x0394b1e9, 0x0394caa9, 0x0394d5e9,
+    0x0394da69, 0x039548de, 0x0395bda9, 0x0395c6e9, 0x0395c769, 0x0395c8e9, 0x0395cd69, 0x0395fce9,
+    0x0395fd69, 0x0396394e, 0x03969169, 0x03978529, 0x039786a9, 0x03978d29, 0x0397b5a9, 0x0397c129,
+    0x0397c329, 0x0397c7a9, 0x0397dbe9, 0x03982d29, 0x03982da9, 0x03982f29, 0x03983aa9, 0x03983b29,
+    0x03984129, 0x039869a9, 0x0398848e, 0x039896a9, 0x03989fe9, 0x0398a069, 0x0398a1e9, 0x0398d5e9,
+    0x0398d669, 0x0399124e, 0x039956aa, 0x0399582a, 0x0399912a, 0x0399942a, 0x03999529, 0x039995a9,
+    0x0399a729, 0x0399a7aa, 0x0399a929, 0x0399cfa9, 0x0399d1a9, 0x039a054e, 0x039a4929, 0x039a49a9,
+    0x039ce855, 0x039cecd5, 0x039cee55, 0x039d00d5, 0x039d10d1, 0x039d1551, 0x039d8a65, 0x039db7c5,
+    0x039defa5, 0x039df045, 0x039df439, 0x039df441, 0x039df5a1, 0x039df63d, 0x039e08c5, 0x039e1825,
+    0x039e18c5, 0x039e1cb9, 0x039e1cc1, 0x039e1e21, 0x039e1ea1, 0x039e2c25, 0x039e30b9, 0x039e3221,
+    0x039e4051, 0x039e44d1, 0x039e4651, 0x039e58c1, 0x039e8141, 0x039e91a1, 0x039e9621, 0x039e97a1,
+    0x039ea3a1, 0x039ea521, 0x039ea5bd, 0x039eaa3d, 0x039eabbd, 0x039ecc21, 0x039ecda1, 0x039ece21,
+    0x039ed221, 0x039ed2a1, 0x039ed421, 0x039ee021, 0x039f08d9, 0x039f0a55, 0x039f1c59, 0x039f1cd9,
+    0x039f3159, 0x039f4741, 0x039f887d, 0x039face5, 0x039fc0e5, 0x039ffe25, 0x03a0043e, 0x03a03a25,
+    0x03a040be, 0x03a04e25, 0x03a06051, 0x03a060d1, 0x03a06251, 0x03a0b221, 0x03a0b3a1, 0x03a0b83e,
+    0x03a0c5a1, 0x03a0c63d, 0x03a0c7bd, 0x03a0ee21, 0x03a0eea1, 0x03a0f021, 0x03a30c4d, 0x03a33c51,
+    0x03a340d1, 0x03a34251, 0x03a3a199, 0x03a3a619, 0x03a3a799, 0x03a3ca19, 0x03a3ce99, 0x03a3d019,
+    0x03a3e299, 0x03a3f7c6, 0x03a3f8c2, 0x03a41b25, 0x03a41fb9, 0x03a42115, 0x03a42195, 0x03a45a0a,
+    0x03a45d06, 0x03a45e02, 0x03a46c25, 0x03a47211, 0x03a47291, 0x03a4828a, 0x03a48586, 0x03a48682,
+    0x03a49985, 0x03a4bd15, 0x03a4c195, 0x03a4c315, 0x03a4d115, 0x03a4d595, 0x03a4d715, 0x03a4e591,
+    0x03a4ea11, 0x03a4eb91, 0x03a52211, 0x03a52691, 0x03a52811, 0x03a53ca5, 0x03a55cd9, 0x03a55e51,
+    0x03a59b41, 0x03a5b019, 0x03a5c219, 0x03a5c399, 0x03a5ea99, 0x03a5ec19, 0x03a5ee7d, 0x03a5fe1a,
+    0x03a5fe9a, 0x03a614e5, 0x03a629a5, 0x03a63d25, 0x03a63da5, 0x03a65225, 0x03a68e25, 0x03a6a7ba,
+    0x03a6a93d, 0x03a6bb3a, 0x03a6dd95, 0x03a6df15, 0x03a6f116, 0x03a6f196, 0x03a6f316, 0x03a70611,
+    0x03a70791, 0x03a74212, 0x03a74292, 0x03a74412, 0x03a758a5, 0x03a75d3d, 0x03aaed85, 0x03ab2995,
+    0x03abb025, 0x03ace73a, 0x03ad0f3a, 0x03ad4595, 0x03b00cd9, 0x03b07219, 0x03b07699, 0x03b09a99,
+    0x03b09f19, 0x03b0a099, 0x03b0b319, 0x03b0f215, 0x03b12a8a, 0x03b12d86, 0x03b12e82, 0x03b14311,
+    0x03b1530a, 0x03b15606, 0x03b15702, 0x03b18d95, 0x03b19215, 0x03b19395, 0x03b19421, 0x03b1a195,
+    0x03b1a615, 0x03b1a795, 0x03b1b611, 0x03b1ba91, 0x03b1f211, 0x03b1f291, 0x03b1f711, 0x03b1f891,
+    0x03b28099, 0x03b2bc99, 0x03b2c1be, 0x03b300be, 0x03b3ae15, 0x03b3af95, 0x03b3b021, 0x03b3b4be,
+    0x03b3c196, 0x03b3c216, 0x03b3c396, 0x03b3d691, 0x03b41292, 0x03b41312, 0x03b41492, 0x03b45259,
+    0x03b456d1, 0x03b45851, 0x03b458d1, 0x03b4b799, 0x03b4bc19, 0x03b4bdb5, 0x03b4be3d, 0x03b4e019,
+    0x03b4e499, 0x03b4e619, 0x03b4f399, 0x03b4f419, 0x03b4f81e, 0x03b4f89e, 0x03b535b9, 0x03b53715,
+    0x03b53795, 0x03b5d315, 0x03b5fb91, 0x03b62abe, 0x03b64c9d, 0x03b69d99, 0x03b6a215, 0x03b6a395,
+    0x03b6a415, 0x03b7d1f9, 0x03b7d375, 0x03b7d3f5, 0x03b7e191, 0x03b7e611, 0x03b7e791, 0x03b7e811,
+    0x03b846f5, 0x03b84b75, 0x03b84cf5, 0x03b84d7d, 0x03b86f75, 0x03b873f5, 0x03b87575, 0x03b87c0d,
+    0x03b882f5, 0x03b88375, 0x03b88775, 0x03b887f5, 0x03b88975, 0x03b89359, 0x03b89659, 0x03b89afe,
+    0x03b8ac19, 0x03b8b0be, 0x03b8b23e, 0x03b8bf99, 0x03b8c019, 0x03b8c43e, 0x03b8c4be, 0x03b8d499,
+    0x03b8d93e, 0x03b92a3d, 0x03b94efe, 0x03b952be, 0x03b9543e, 0x03b954be, 0x03b9b7fe, 0x03b9b97e,
+    0x03b9b9fe, 0x03b9e07e, 0x03b9e1fe, 0x03b9f1bd, 0x03b9f3fe, 0x03b9f47e, 0x03b9f5fe, 0x03ba0211,
+    0x03ba0391, 0x03ba0411, 0x03ba083e, 0x03ba08be, 0x03ba1409, 0x03ba1705, 0x03ba3c89, 0x03ba3f85,
+    0x03ba5575, 0x03ba59fe, 0x03ba62be, 0x03ba6775, 0x03ba68f5, 0x03ba697d, 0x03ba8ff5, 0x03ba9175,
+    0x03ba95fe, 0x03bdfd79, 0x03bdfef5, 0x03bdff7d, 0x03be25f9, 0x03be2775, 0x03be27f5, 0x03be39f9,
+    0x03be3b75, 0x03be9af5, 0x03be9f75, 0x03bea0f5, 0x03bea17d, 0x03beacf5, 0x03beae75, 0x03beaefd,
+    0x03beb37d, 0x03bed575, 0x03bed6f5, 0x03bed775, 0x03bedb75, 0x03bedbf5, 0x03bedd75, 0x03bee975,
+    0x03beeaf5, 0x03beef75, 0x03bf91bd, 0x03c049fe, 0x03c0bb75, 0x03c0bcf5, 0x03c0bd7d, 0x03c0cef5,
+    0x03c0cf7d, 0x03c0f775, 0x03c0f7f5, 0x03c0f975, 0x03c41015, 0x03c43891, 0x03c619c9, 0x03c61cc5,
+    0x03c630b9, 0x03c630c1, 0x03c63215, 0x03c632a1, 0x03c64439, 0x03c644b9, 0x03c64615, 0x03c65939,
+    0x03c65b3d, 0x03c66e05, 0x03c66f01, 0x03c6883a, 0x03c69539, 0x03c695b6, 0x03c69711, 0x03c6b03a,
+    0x03c9849d, 0x03ca6411, 0x03cac975, 0x03cacdf9, 0x03cacf75, 0x03cacffd, 0x03caf1f6, 0x03caf676,
+    0x03caf7f5, 0x03cb0575, 0x03cb05f6, 0x03cb0a76, 0x03cb0bf5, 0x03cb6b75, 0x03cb6ff5, 0x03cb7175,
+    0x03cb7d75, 0x03cb7ef5, 0x03cb7f7d, 0x03cb83fd, 0x03cba5f6, 0x03cba775, 0x03cbabf5, 0x03cbb9f6,
+    0x03cc623d, 0x03cc84b9, 0x03cc84c1, 0x03cc8611, 0x03cc8691, 0x03cc9985, 0x03cc9a81, 0x03ccaa89,
+    0x03ccad85, 0x03ccc205, 0x03ccc301, 0x03ccd7f5, 0x03ccddfe, 0x03cce9f9, 0x03cceb75, 0x03ccebfd,
+    0x03cd1276, 0x03cd13f5, 0x03cd25f9, 0x03cd2676, 0x03cd27f5, 0x03cd8bf5, 0x03cd8d75, 0x03cd9f75,
+    0x03cd9ffd, 0x03cdc7f5, 0x03cdfc09, 0x03cdff05, 0x03ce0805, 0x03ce0b55, 0x03ce0bda, 0x03ce0d55,
+    0x03ce197a, 0x03ce1ad5, 0x03ce1f7a, 0x03ce3ccd, 0x03ce3d7e, 0x03ce45c9, 0x03ce467e, 0x03ce6a75,
+    0x03ce6bd1, 0x03ce7051, 0x03ce774d, 0x03ce77f5, 0x03ce794d, 0x03ce8249, 0x03cf133a, 0x03cf3b3a,
+    0x03cf3bba, 0x03cf48ba, 0x03cf5d51, 0x03cf5ed1, 0x03cf6351, 0x03cf6a4d, 0x03cf6acd, 0x03cf6c4d,
+    0x03cf7549, 0x03cfa4c9, 0x03cfa57e, 0x03cfb01d, 0x03cfb0be, 0x03cfb49d, 0x03cfb53e, 0x03cfb6be,
+    0x03cfc21d, 0x03cfc2be, 0x03cfc43e, 0x03cfc8be, 0x03cfe149, 0x03cfea9d, 0x03cfeb35, 0x03cfec9d,
+    0x03cff11d, 0x03d0b519, 0x03d15975, 0x03d15ff5, 0x03d16d75, 0x03d19c95, 0x03d1a815, 0x03d1ae95,
+    0x03d1c53e, 0x03d1d175, 0x03d1d2f5, 0x03d1d7fd, 0x03d1ff91, 0x03d2367a, 0x03d237d1, 0x03d23c7e,
+    0x03d2434d, 0x03d243fa, 0x03d2454d, 0x03d24e7d, 0x03d27dc9, 0x03d27e7e, 0x03d28919, 0x03d289be,
+    0x03d28dbd, 0x03d28e3e, 0x03d28fbe, 0x03d29b19, 0x03d29bbe, 0x03d29d3e, 0x03d2a1be, 0x03d2ba49,
+    0x03d2c399, 0x03d2c435, 0x03d2c599, 0x03d2ca3d, 0x03d2fe89, 0x03d30185, 0x03d307ba, 0x03d33df9,
+    0x03d33f75, 0x03d33ffd, 0x03d35179, 0x03d3537d, 0x03d37bf5, 0x03d3ad49, 0x03d3b695, 0x03d3b715,
+    0x03d3b895, 0x03d3bd3d, 0x03d3e5be, 0x03d3ec8d, 0x03d3ed3e, 0x03d3f3fd, 0x03d4290e, 0x03d4524d,
+    0x03d453cd, 0x03d45cc9, 0x03d463c9, 0x03d46762, 0x03d46f15, 0x03d47395, 0x03d47422, 0x03d475a2,
+    0x03d48195, 0x03d48315, 0x03d48795, 0x03d4d291, 0x03d4d411, 0x03d4d891, 0x03d4dfbd, 0x03d568de,
+    0x03d57b5d, 0x03d57cdd, 0x03d59ee6, 0x03d5b166, 0x03d5b2e6, 0x03d5b75d, 0x03d5c591, 0x03d5c739,
+    0x03d5cb91, 0x03d5d28d, 0x03d61879, 0x03d61cdd, 0x03d62add, 0x03d62c79, 0x03d630dd, 0x03d652fd,
+    0x03d65362, 0x03d654e2, 0x03d65962, 0x03d70ffd, 0x03d799a5, 0x03d79e21, 0x03d79fa1, 0x03d7c6a1,
+    0x03d7c821, 0x03d83bba, 0x03d84021, 0x03d894c9, 0x03d89e91, 0x03d8a011, 0x03d8a4bd, 0x03d8ab8d,
+    0x03d8bf8e, 0x03d8f166, 0x03d8f5fd, 0x03d903d9, 0x03d90566, 0x03d909fd, 0x03d9108e, 0x03d92bfd,
+    0x03d92c62, 0x03d92de2, 0x03d93262, 0x03d9a625, 0x03d9e23e, 0x03d9f3ca, 0x03da038e, 0x03da1ed5,
+    0x03da1f62, 0x03da20e2, 0x03da2562, 0x03da5ba1, 0x03da5c21, 0x03da68ce, 0x03dab852, 0x03dacb45,
+    0x03dacf0d, 0x03dad08d, 0x03dad995, 0x03dae28d, 0x03dae30d, 0x03dae48d, 0x03daed89, 0x03db14da,
+    0x03db1959, 0x03db1ad9, 0x03db2866, 0x03db28d9, 0x03db2cd9, 0x03db2d59, 0x03db2ed9, 0x03db45bd,
+    0x03db4f7d, 0x03db50fd, 0x03db5989, 0x03db62fd, 0x03db6359, 0x03db64d9, 0x03db6959, 0x03dc144d,
+    0x03dc1d49, 0x03dc3889, 0x03dc4255, 0x03dc43f9, 0x03dc4855, 0x03dc4c89, 0x03dc55d5, 0x03dc5655,
+    0x03dc57f9, 0x03dc5c55, 0x03dc784d, 0x03dc82c9, 0x03dc8bcd, 0x03dc8c4d, 0x03dc96c9, 0x03dcb47d,
+    0x03dcc84e, 0x03dd75fd, 0x03de0825, 0x03de08a5, 0x03de2f3d, 0x03de30bd, 0x03de42bd, 0x03de4325,
+    0x03de44a5, 0x03dea439, 0x03dea8a5, 0x03deaa39, 0x03deb7b9, 0x03deb839, 0x03debc25, 0x03debca5,
+    0x03dedebd, 0x03dee4bd, 0x03dee8c9, 0x03def23d, 0x03def2a5, 0x03def439, 0x03def8a5, 0x03df118d,
+    0x03df1b55, 0x03df1cd5, 0x03df2589, 0x03df2ed5, 0x03df2f55, 0x03df30d5, 0x03df357d, 0x03df5bfd,
+    0x03df64cd, 0x03df66cd, 0x03df91fd, 0x03dfa14e, 0x03e010a6, 0x03e0153d, 0x03e016bd, 0x03e024a6,
+    0x03e028bd, 0x03e0293d, 0x03e02abd, 0x03e04b26, 0x03e04ca6, 0x03e0554e, 0x03e05ea6, 0x03e05f26,
+    0x03e060a6, 0x03e0653d, 0x03e0804d, 0x03e084c9, 0x03e0944e, 0x03e0c4a5, 0x03e0c639, 0x03e0cabd,
+    0x03e0cec9, 0x03e0d825, 0x03e0d8a5, 0x03e0da39, 0x03e0debd, 0x03e100bd, 0x03e129a5, 0x03e12b25,
+    0x03e12fa5, 0x03e136a5, 0x03e13725, 0x03e138a5, 0x03e141a5, 0x03e17c66, 0x03e17ce5, 0x03e180e5,
+    0x03e18165, 0x03e182e5, 0x03e18e66, 0x03e18ee5, 0x03e19066, 0x03e194e5, 0x03e1ada5, 0x03e1b765,
+    0x03e1b8e5, 0x03e1bd65, 0x03e22bde, 0x03e2a9e5, 0x03e2aa65, 0x03e2b065, 0x03e2dfe5, 0x03e2e065,
+    0x03e31c4e, 0x03e37465, 0x03e46826, 0x03e469a6, 0x03e46ea5, 0x03e47025, 0x03e498a5, 0x03e4a426,
+    0x03e4aaa5, 0x03e51025, 0x03e510a5, 0x03e51da5, 0x03e51e25, 0x03e52425, 0x03e54ca5, 0x03e5678e,
+    0x03e579a5, 0x03e582e5, 0x03e58365, 0x03e584e5, 0x03e5f54e, 0x03e678a6, 0x03e68a26, 0x03e68aa6,
+    0x03e6b2a6, 0x03e6b326, 0x03e6b4a6, 0x03e6e84e, 0x03e72c25, 0x03e72ca5, 0x03ed96b6, 0x03edaab6,
+    0x03edd1a2, 0x03ee5a76, 0x03ee5acd, 0x03ee817d, 0x03ee954d, 0x03ee995a, 0x03ef1e9d, 0x03ef591d,
+    0x03efc276, 0x03efc2c9, 0x03efcdb6, 0x03efce39, 0x03efd29d, 0x03eff4bd, 0x03f0089d, 0x03f0b1bd,
+    0x03f13f75, 0x03f14175, 0x03f167fe, 0x03f1697e, 0x03f1793d, 0x03f17bf5, 0x03f17d75, 0x03f1e175,
+    0x03f1f0fa, 0x03f1f575, 0x03f2243d, 0x03f2248d, 0x03f228bd, 0x03f2a69a, 0x03f2a71a, 0x03f2cd9a,
+    0x03f2e19a, 0x03f361fe, 0x03f3910e, 0x03f3fd75, 0x03f40a8d, 0x03f41175, 0x03f4397e, 0x03f46d89,
+    0x03f47085, 0x03f47985, 0x03f47cd5, 0x03f47d55, 0x03f47ed5, 0x03f48ada, 0x03f48c5a, 0x03f490d5,
+    0x03f4ae76, 0x03f4aeda, 0x03f4dbda, 0x03f4dd5a, 0x03f4e1d1, 0x03f4e8fd, 0x03f4e94d, 0x03f4eacd,
+    0x03f4f3c9, 0x03f5729e, 0x03f5ad1d, 0x03f5ae9d, 0x03f5ced1, 0x03f5d079, 0x03f5d4d1, 0x03f5dbcd,
+    0x03f5dc4d, 0x03f5ddf9, 0x03f5e6c9, 0x03f61676, 0x03f616c9, 0x03f621b6, 0x03f62239, 0x03f62636,
+    0x03f6269d, 0x03f62836, 0x03f633b6, 0x03f6341d, 0x03f635b6, 0x03f63a36, 0x03f652c9, 0x03f65c3d,
+    0x03f65c9d, 0x03f65e39, 0x03f6629d, 0x03f7193d, 0x03f7269a, 0x03f7a775, 0x03f7a8f5, 0x03f7cff5,
+    0x03f7d175, 0x03f81995, 0x03f84975, 0x03f856f5, 0x03f8a7da, 0x03f8a95a, 0x03f8adfd, 0x03f8b4cd,
+    0x03f8b54d, 0x03f8b6cd, 0x03f8bffd, 0x03f8fa9a, 0x03f8fb1a, 0x03f8ff36, 0x03f8ffbd, 0x03f90136,
+    0x03f90c9a, 0x03f90d1a, 0x03f90e9a, 0x03f91336, 0x03f92bce, 0x03f9351a, 0x03f9359a, 0x03f9371a,
+    0x03f93bbd, 0x03f9aa0e, 0x03f9aa8e, 0x03fa1ec9, 0x03fa2815, 0x03fa2895, 0x03fa2a39, 0x03fa2ebd,
+    0x03fa5e36, 0x03fa5e8d, 0x03fa64f5, 0x03fa6575, 0x03fa9a8e, 0x03fa9f0a, 0x03facaa1, 0x03facc21,
+    0x03fad0a1, 0x03fad7a1, 0x03fb1d61, 0x03fb21e1, 0x03fb2fe1, 0x03fb3161, 0x03fb35e1, 0x03fb4ea2,
+    0x03fb5862, 0x03fb59e2, 0x03fb5e62, 0x03fc4ae1, 0x03fc4b62, 0x03fc4ce2, 0x03fc5162, 0x03fe0fa1,
+    0x03fe1121, 0x03fe4721, 0x03fe4ba1, 0x03fe5fe1, 0x03feb121, 0x03feb1a2, 0x03feb322, 0x03febf21,
+    0x03fec521, 0x03feeda2, 0x03ff088e, 0x03ff23e1, 0x03ff2462, 0x03ff25e2, 0x03ff2a62, 0x04001921,
+    0x04002ba1, 0x04002d21, 0x04005422, 0x040055a2, 0x0400cd21, 0x0400d3a2, 0x04013d89, 0x04014755,
+    0x040148d5, 0x04014d55, 0x04015ad5, 0x04015b55, 0x04015cd5, 0x04016155, 0x04017d4d, 0x04017ecd,
+    0x040187c9, 0x040190cd, 0x0401914d, 0x040192cd, 0x0401ac52, 0x0401add2, 0x0401b252, 0x0401b97d,
+    0x0401cd4e, 0x04023c9e, 0x0402411e, 0x0402429e, 0x0402501d, 0x0402509d, 0x0402549d, 0x0402551d,
+    0x0402569d, 0x040278bd, 0x04028abd, 0x04028b35, 0x04028c9d, 0x0402911d, 0x04029f52, 0x0402a0d2,
+    0x0402a552, 0x0402ac4d, 0x0402c04e, 0x0402e6c9, 0x0402f09d, 0x0402f239, 0x0402f69d, 0x0402fac9,
+    0x0403041d, 0x0403049d, 0x04030639, 0x04030a9d, 0x04032cbd, 0x0403e9bd, 0x04047375, 0x040477f5,
+    0x04047975, 0x0404f095, 0x04054192, 0x04055c8e, 0x04057852, 0x040579d2, 0x04057e52, 0x0405854d,
+    0x040589c9, 0x0405994e, 0x0405c999, 0x0405cb19, 0x0405cfbd, 0x0405dd19, 0x0405dd99, 0x0405df19,
+    0x0405e3bd, 0x040605bd, 0x04067ff5, 0x04068175, 0x040693f5, 0x04069575, 0x0406bbfe, 0x0406c90e,
+    0x0406cd8a, 0x0406f895, 0x04072e8d, 0x04073575, 0x0407428e, 0x040e0885, 0x040e1e55, 0x040e1fd5,
+    0x040e31d5, 0x040e82d1, 0x040e94c9, 0x040f4e1d, 0x040f4f9d, 0x040f619d, 0x040f75e5, 0x040fc7a5,
+    0x040fc925, 0x040fdb25, 0x041003a5, 0x04102cd1, 0x04102e51, 0x04109219, 0x04109399, 0x0410ba99,
+    0x0410bc19, 0x04115c91, 0x04115e11, 0x04119145, 0x04119241, 0x041193c1, 0x0411ada5, 0x0411af25,
+    0x0411b745, 0x0411baa1, 0x0411bb15, 0x0411bc95, 0x0411cf91, 0x0411d111, 0x0411d625, 0x0411d7a5,
+    0x04120a41, 0x04120b91, 0x04120c11, 0x04120d91, 0x04121225, 0x0412318a, 0x04123306, 0x04124505,
+    0x04124851, 0x041248d1, 0x04124a51, 0x04124ed1, 0x0412564d, 0x041257cd, 0x04125a49, 0x04125ac9,
+    0x04125dc5, 0x04126e4a, 0x04126fc6, 0x0412a099, 0x0412a219, 0x0412ada1, 0x0412ae19, 0x0412b419,
+    0x0412bf4a, 0x0412c0c6, 0x0412ccc9, 0x0412d2c5, 0x0412d619, 0x0412d699, 0x0412d819, 0x0412dc99,
+    0x04131395, 0x04131515, 0x04132915, 0x04132d95, 0x04137811, 0x04137891, 0x04137a11, 0x04137e91,
+    0x0413b24a, 0x0413b3c6, 0x0413c5c5, 0x0413c915, 0x0413c995, 0x0413cb15, 0x0413cfa5, 0x0413f191,
+    0x0413f211, 0x0413f391, 0x0413f825, 0x04143b8e, 0x0414400a, 0x04144186, 0x04148745, 0x0414c599,
+    0x0414d926, 0x04150019, 0x04150199, 0x04157bdd, 0x0415b65d, 0x0415c9dd, 0x0415ef65, 0x0415f325,
+    0x0415f4a5, 0x041606a5, 0x04162da5, 0x04164126, 0x041669a5, 0x041684c9, 0x04168645, 0x04168ac5,
+    0x04168e91, 0x04169011, 0x04169845, 0x04169c0d, 0x04169d8d, 0x04169e0d, 0x0416a089, 0x0416af8d,
+    0x0416b00d, 0x0416b409, 0x0416b489, 0x0416b585, 0x0416c0c5, 0x0416c48d, 0x0416c60d, 0x0416c909,
+    0x0416d699, 0x0416e1d9, 0x0416e659, 0x0416e7d9, 0x0416e859, 0x0416ea09, 0x0416ea89, 0x0416eb85,
+    0x0416f005, 0x0416f3d9, 0x0416f565, 0x0416f5e9, 0x0416f9d9, 0x0416fa59, 0x04171289, 0x04171c76,
+    0x04171dd9, 0x04171e59, 0x041722e6, 0x04172689, 0x04172fd9, 0x04173059, 0x041731d9, 0x04173659,
+    0x04173a45, 0x04173e0d, 0x04173f8d, 0x04174289, 0x04175015, 0x04175b55, 0x04175fd5, 0x04176155,
+    0x041761d5, 0x04176389, 0x04176409, 0x04176505, 0x04176985, 0x04176d65, 0x04176ed5, 0x04176f55,
+    0x04177355, 0x041773d5, 0x04177891, 0x041783d1, 0x04178851, 0x041789d1, 0x04179f85, 0x0417a34d,
+    0x0417a4cd, 0x0417a54d, 0x0417a7c9, 0x0417cbf6, 0x0417cd4d, 0x0417cdcd, 0x0417d076, 0x0417df4d,
+    0x0417dfcd, 0x0417e14d, 0x0417e3c9, 0x0417e449, 0x0417ed65, 0x0417eee5, 0x0418454d, 0x041849c9,
+    0x04186065, 0x041861e6, 0x041866e5, 0x04186866, 0x04189309, 0x04189c65, 0x04189ce5, 0x04189e65,
+    0x0418a2e5, 0x0418bc49, 0x0418bf45, 0x0418c595, 0x0418c715, 0x0418c795, 0x0418c845, 0x0418cc15,
+    0x0418cd95, 0x0418cfc9, 0x0418d5c5, 0x0418d915, 0x0418d995, 0x0418db15, 0x0418df95, 0x0418fd8d,
+    0x04190459, 0x04190689, 0x04191126, 0x04191409, 0x04191a26, 0x0419380d, 0x0419398d, 0x04193c09,
+    0x04193c89, 0x04193f85, 0x04194289, 0x04194b8e, 0x0419500a, 0x04197dd5, 0x0419b1cd, 0x0419b649,
+    0x0419c165, 0x0419f6e5, 0x0419fbe5, 0x0419fd65, 0x0419ff89, 0x041a08e5, 0x041a0965, 0x041a0ae5,
+    0x041a0f65, 0x041a2b0d, 0x041a2c8d, 0x041a2f09, 0x041a2f89, 0x041a3285, 0x041a35a5, 0x041a3e8e,
+    0x041a430a, 0x041a6589, 0x041a6ee5, 0x041a7065, 0x041a70e5, 0x041a7565, 0x041a76e6, 0x041a7926,
+    0x041a8265, 0x041a82e5, 0x041a8466, 0x041a88e6, 0x041aa189, 0x041aa785, 0x041aaae5, 0x041aab65,
+    0x041aace5, 0x041ab165, 0x041b2d19, 0x041bf569, 0x041c5aa5, 0x041c9525, 0x041d038d, 0x041d1195,
+    0x041d1315, 0x041d3e19, 0x041d3f99, 0x041d47d9, 0x041d4dd9, 0x041d5209, 0x041d5385, 0x041d5be9,
+    0x041d5d69, 0x041d61d9, 0x041d83d9, 0x041dc755, 0x041e0b69, 0x041e0ccd, 0x041e18ea, 0x041e1a65,
+    0x041e334d, 0x041e3c65, 0x041e4165, 0x041e42e5, 0x041e4ee5, 0x041e5065, 0x041e54e5, 0x041e5f45,
+    0x041e6291, 0x041e6311, 0x041e6491, 0x041e888a, 0x041eaccd, 0x041eb149, 0x041eb2c5, 0x041eb465,
+    0x041eb5e5, 0x041eb67e, 0x041ebae5, 0x041ebc65, 0x041ec87e, 0x041ec9fe, 0x041ece65, 0x041ed98a,
+    0x041edb06, 0x041ef065, 0x041ef0e5, 0x041ef265, 0x041ef6e5, 0x041f164a, 0x041f23c9, 0x041f29c5,
+    0x041f2d15, 0x041f2d95, 0x041f2f15, 0x041f3399, 0x041f638d, 0x041f650d, 0x041f6789, 0x041f6809,
+    0x041f6e19, 0x041f9f8e, 0x041fa40a, 0x0420194d, 0x04201dc9, 0x04201f45, 0x042020e5, 0x04202265,
+    0x0420276a, 0x042028e5, 0x042034ea, 0x04203665, 0x04203aea, 0x04205ce5, 0x04205d65, 0x04205ee5,
+    0x04206365, 0x0420928e, 0x0420970a, 0x0420cd09, 0x0420d665, 0x0420d6e5, 0x0420d865, 0x0420dce5,
+    0x0422d715, 0x04232811, 0x04235549, 0x042356c5, 0x04235b45, 0x04235f11, 0x04236091, 0x042368c5,
+    0x04236c8d, 0x04236e15, 0x04237109, 0x04238022, 0x042384a2, 0x04238622, 0x0423950d, 0x042396b5,
+    0x04239989, 0x0423a719, 0x0423b259, 0x0423b6d9, 0x0423bc22, 0x0423c0a2, 0x0423c462, 0x0423c5e2,
+    0x0423ee59, 0x04240ac5, 0x04240e8d, 0x04241011, 0x04241309, 0x04241605, 0x04241701, 0x04242095,
+    0x04242bd5, 0x04243055, 0x04243422, 0x042435a2, 0x04243a22, 0x04243de2, 0x04243f62, 0x04243fd5,
+    0x04244911, 0x04245451, 0x042458d1, 0x04247022, 0x042473e2, 0x04247562, 0x04247862, 0x04247b62,
+    0x04249c4d, 0x04249dcd, 0x0424a0c9, 0x042515cd, 0x04251a49, 0x04253761, 0x042538f6, 0x04255fe1,
+    0x04256161, 0x04257361, 0x04264dd5, 0x04264e55, 0x04267675, 0x042676d1, 0x042689c5, 0x04268ac1,
+    0x0426c5e1, 0x0426f411, 0x042745e1, 0x04274776, 0x04275976, 0x042781e1, 0x042877d5, 0x04292989,
+    0x04292c85, 0x04296aea, 0x04297e76, 0x0429a185, 0x0429a55d, 0x0429a6dd, 0x0429b8dd, 0x0429c08d,
+    0x0429c20d, 0x0429c529, 0x0429d289, 0x0429dde9, 0x0429e255, 0x0429e3d5, 0x0429e455, 0x0429e609,
+    0x0429e689, 0x0429e785, 0x0429ec29, 0x0429efe9, 0x0429f169, 0x0429f1e9, 0x0429f5d5, 0x0429f655,
+    0x0429fb09, 0x042a0669, 0x042a0ad1, 0x042a0c75, 0x042a13ce, 0x042a2205, 0x042a25cd, 0x042a2775,
+    0x042a27e9, 0x042a2a69, 0x042a4e4d, 0x042a4fcd, 0x042a504d, 0x042a52e9, 0x042a61cd, 0x042a624d,
+    0x042a63cd, 0x042a6669, 0x042a66e9, 0x042a7489, 0x042a7fe9, 0x042a8469, 0x042a85d1, 0x042a8d4e,
+    0x042a9b85, 0x042a9f69, 0x042aa0cd, 0x042aa14d, 0x042aa3e9, 0x042aa6e9, 0x042ab5ce, 0x042ad9c9,
+    0x042ae529, 0x042ae9a9, 0x042aeb35, 0x042aeba9, 0x042b0249, 0x042b0da9, 0x042b1229, 0x042b13a9,
+    0x042b1429, 0x042b15c9, 0x042b1649, 0x042b2129, 0x042b21a9, 0x042b25a9, 0x042b2629, 0x042b27a9,
+    0x042b7bc9, 0x042b8729, 0x042b8ba9, 0x042b8d35, 0x042b8da9, 0x042b9929, 0x042b9f35, 0x042b9fa9,
+    0x042bc32a, 0x042bc3a9, 0x042bc829, 0x042bc9a9, 0x042bd04d, 0x042bd529, 0x042bd5a9, 0x042bd729,
+    0x042bd949, 0x042bdba9, 0x042c0055, 0x042c516a, 0x042c5776, 0x042c6e89, 0x042c77d9, 0x042c7959,
+    0x042c79d9, 0x042c7e59, 0x042c8219, 0x042c8b59, 0x042c8bd9, 0x042c8d59, 0x042c91d9, 0x042ca069,
+    0x042ca1d1, 0x042ca251, 0x042cb249, 0x042cb545, 0x042cb641, 0x042cdac9, 0x042cddc5, 0x042cdec1,
+    0x042ce849, 0x042cf3a9, 0x042cf829, 0x042cfa29, 0x042d05a9, 0x042d0735, 0x042d07a9, 0x042d2e29,
+    0x042d2fa9, 0x042d3029, 0x042d34a9, 0x042d3629, 0x042d3ccd, 0x042d4229, 0x042d45c9, 0x042d4829,
+    0x042d6d85, 0x042d7155, 0x042d72d6, 0x042d84d6, 0x042da2ea, 0x042da9a9, 0x042dabea, 0x042db676,
+    0x042db96a, 0x042dbf76, 0x042ddd4d, 0x042ddecd, 0x042de149, 0x042de1c9, 0x042de5a9, 0x042de7c9,
+    0x042f7f11, 0x042fd0dd, 0x042fd276, 0x042fe476, 0x04300cdd, 0x04303a15, 0x04303b85, 0x04304005,
+    0x043043d5, 0x043049d5, 0x04304e09, 0x04304f85, 0x04305405, 0x043057d5, 0x04305955, 0x04305dd5,
+    0x04306412, 0x04306892, 0x04307619, 0x043079d9, 0x04307bd9, 0x04307e59, 0x04308dcd, 0x04308f75,
+    0x04309269, 0x0430b5cd, 0x0430ba49, 0x0430ef95, 0x0430f355, 0x0430f7d5, 0x0430fad5, 0x0431074d,
+    0x043108cd, 0x04310bc9, 0x04311812, 0x043141c9, 0x04314d29, 0x043151a9, 0x04315335, 0x043169c9,
+    0x04316b45, 0x04316fc5, 0x043173a9, 0x04317529, 0x043175a9, 0x043179a9, 0x04317dc9, 0x043187a9,
+    0x04318929, 0x04318da9, 0x0431b6d5, 0x0431b855, 0x0431df51, 0x0431e0f6, 0x0431e375, 0x0431e4c5,
+    0x0431e945, 0x0431ed29, 0x0431eeb5, 0x0431ef29, 0x0431f335, 0x04320735, 0x04321b51, 0x04322929,
+    0x0432a359, 0x0432a4f6, 0x0432ab76, 0x0432b759, 0x0432b8f6, 0x0432bd76, 0x0432d609, 0x0432df59,
+    0x0432dfd9, 0x0432e159, 0x0432e5d9, 0x04334ff5, 0x04335145, 0x043355c5, 0x043359a9, 0x04335b35,
+    0x04335ba9, 0x04335fb5, 0x0433d8d5, 0x04340176, 0x043408cd, 0x04340a76, 0x04340cf6, 0x04340d49,
+    0x04341376, 0x043444ce, 0x0436b299, 0x0436b419, 0x0437b9ea, 0x0437bb61, 0x0437dd61, 0x0437e275,
+    0x0437e3e1, 0x0437f161, 0x0437f5e1, 0x04380391, 0x04380411, 0x04380591, 0x0438298a, 0x04385561,
+    0x043856e1, 0x043868e1, 0x0438697e, 0x04386afe, 0x04387c06, 0x04389161, 0x043891f5, 0x04389361,
+    0x0438b74a, 0x0438cac5, 0x0438ce15, 0x0438ce95, 0x0438d015, 0x0438d499, 0x0439408e, 0x0439450a,
+    0x04397691, 0x0439c1e1, 0x0439c361, 0x0439c86a, 0x0439c9e1, 0x0439d561, 0x0439d5ea, 0x0439d761,
+    0x0439dbea, 0x0439fde1, 0x0439fe75, 0x0439ffe1, 0x043a0461, 0x043a380a, 0x043a7761, 0x043a77e1,
+    0x043a7961, 0x043d4a59, 0x043d4c59, 0x043d4ed9, 0x043d5dcd, 0x043d5e4d, 0x043d6249, 0x043d62e9,
+    0x043d864d, 0x043d8ac9, 0x043e11c9, 0x043e1249, 0x043e1ba9, 0x043e1d29, 0x043e1da9, 0x043e21a9,
+    0x043e2229, 0x043e3a49, 0x043e45a9, 0x043e4636, 0x043e4a29, 0x043e4ab6, 0x043e4e49, 0x043e57a9,
+    0x043e5836, 0x043e59a9, 0x043e5e29, 0x043e9455, 0x043ebda9, 0x043ebfa9, 0x043f06ce, 0x043f300d,
+    0x043f318d, 0x043f3409, 0x043f3489, 0x043f3785, 0x043f3a99, 0x043f438e, 0x043f480a, 0x043f6a89,
+    0x043f73d9, 0x043f7559, 0x043f75d9, 0x043f7a59, 0x043f7bd9, 0x043f8759, 0x043f87d9, 0x043f8959,
+    0x043f8dd9, 0x043fa689, 0x043fac85, 0x043fafd9, 0x043fb075, 0x043fb1d9, 0x043fb659, 0x043ff005,
+    0x043ff3d5, 0x043ff555, 0x04400755, 0x04402a29, 0x04402c29, 0x04402e49, 0x044041c9, 0x04406a49,
+    0x0440734e, 0x04409f85, 0x0440a2d5, 0x0440a355, 0x0440a4d5, 0x0440d94d, 0x0440dd49, 0x0440ddc9,
+    0x0440ecce, 0x0440f14a, 0x0441154e, 0x044119ca, 0x0443b1d9, 0x0443b659, 0x0443bb5a, 0x0443bfda,
+    0x0443c15a, 0x04443956, 0x04443ad6, 0x04448529, 0x0444abaa, 0x0444d18a, 0x0444e855, 0x0444e8d5,
+    0x0444ea69, 0x0445237e, 0x04452529, 0x0445978e, 0x04459c0a, 0x0445db59, 0x0445dbd9, 0x0445dd59,
+    0x04465b69, 0x04468b6a, 0x04468ccd, 0x044691a9, 0x044695e9, 0x044740ce, 0x0447454a, 0x0449da45,
+    0x0449de15, 0x0449e289, 0x044a02c5, 0x044a0691, 0x044a0b09, 0x044a1899, 0x044a23d9, 0x044a2da2,
+    0x044a3222, 0x044a35e2, 0x044a5e59, 0x044a9215, 0x044a9d55, 0x044aba91, 0x044ac5d1, 0x044ae1a2,
+    0x044ae562, 0x044ae9e2, 0x044b0df9, 0x044b1249, 0x044b874d, 0x044b8bc9, 0x044e6ffd, 0x044eaa66,
+    0x044ee955, 0x0450320d, 0x0450338d, 0x045036a5, 0x04504409, 0x04504f65, 0x045053d5, 0x04505555,
+    0x045055d5, 0x04505789, 0x0450580d, 0x04505905, 0x04505da5, 0x04506165, 0x045062e5, 0x0450636d,
+    0x04506755, 0x045067d5, 0x04506c89, 0x045077e5, 0x04507c51, 0x04507de5, 0x0450854e, 0x04509385,
+    0x0450974d, 0x045098e5, 0x0450997d, 0x04509be5, 0x0450a27d, 0x0450bfcd, 0x0450c14d, 0x0450c1cd,
+    0x0450c465, 0x0450d34d, 0x0450d3cd, 0x0450d54d, 0x0450d7e5, 0x0450d865, 0x0450e609, 0x0450f165,
+    0x0450f5f9, 0x0450f751, 0x0450fece, 0x04510d05, 0x045110f9, 0x0451124d, 0x045112cd, 0x04511565,
+    0x04511bc9, 0x0451274e, 0x04514b49, 0x045156a5, 0x04515b39, 0x04515ca5, 0x04515d3d, 0x045173c9,
+    0x04517f25, 0x045183b9, 0x04518525, 0x045185a5, 0x04518749, 0x045187c9, 0x045192a5, 0x04519325,
+    0x04519739, 0x045197b9, 0x04519925, 0x0451ed4e, 0x0451f8a5, 0x0451fd26, 0x0451fea6, 0x0451ff26,
+    0x04520aa5, 0x045210a6, 0x04521126, 0x04523325, 0x045234a5, 0x04523525, 0x045239a6, 0x04523b26,
+    0x045246a5, 0x04524725, 0x045248a5, 0x04524d26, 0x045271d5, 0x045359c9, 0x04536525, 0x045369b9,
+    0x04536bbd, 0x0453a1a5, 0x0453a639, 0x0453a7a5, 0x0453b9b9, 0x04541b3d, 0x04541fa6, 0x04545725,
+    0x045562f9, 0x0456ab89, 0x0456ad15, 0x0456b185, 0x0456b555, 0x0456b6d5, 0x0456bb55, 0x0456bf89,
+    0x0456c105, 0x0456c595, 0x0456c955, 0x0456cad5, 0x0456cf55, 0x0456d412, 0x0456e799, 0x0456ecd9,
+    0x0456efd9, 0x0456ff7d, 0x045700fd, 0x0457274d, 0x04572bc9, 0x04572d45, 0x04573fc9, 0x04574145,
+    0x04576115, 0x04576655, 0x04576955, 0x045778f9, 0x04577a4d, 0x04577d55, 0x0457c4bd, 0x0457db49,
+    0x0457dcf9, 0x0457e145, 0x0457e539, 0x0457e6a5, 0x0457eb39, 0x0457f545, 0x0457f939, 0x0457faa5,
+    0x0457ff39, 0x045854c9, 0x04585645, 0x04585ac5, 0x04585ea5, 0x04586025, 0x045864a6, 0x045878a6,
+    0x04589aa5, 0x0459c149, 0x0459c2f9, 0x0459c745, 0x0459cb39, 0x0459cca5, 0x0459d139, 0x045d028d,
+    0x045d040d, 0x045d0711, 0x045d1489, 0x045d1fe1, 0x045d2455, 0x045d25d5, 0x045d2822, 0x045d288d,
+    0x045d29a2, 0x045d2e22, 0x045d31e2, 0x045d3362, 0x045d3855, 0x045d3d09, 0x045d4851, 0x045d4cd1,
+    0x045d4e75, 0x045d55ce, 0x045d6422, 0x045d67e2, 0x045d6c62, 0x045d72fd, 0x045d904d, 0x045d91cd,
+    0x045db689, 0x045dc1d1, 0x045dc679, 0x045dc7d1, 0x045dcf4e, 0x045de2e2, 0x045de5e2, 0x045de8e2,
+    0x045dec49, 0x045df7ce, 0x045e1be2, 0x045e2722, 0x045e2ba2, 0x045e2d22, 0x045e2dbd, 0x045e4449,
+    0x045e4fa1, 0x045e5439, 0x045e55a1, 0x045e6322, 0x045e63a1, 0x045e6839, 0x045ebdc9, 0x045ec921,
+    0x045ecda1, 0x045ee122, 0x045f03a1, 0x045f0521, 0x045fe3d1, 0x045fe451, 0x045ff745, 0x045ff841,
+    0x04601fc5, 0x046020c1, 0x046035a1, 0x046047a2, 0x04604922, 0x046049bd, 0x04607039, 0x046071a1,
+    0x04607221, 0x04608439, 0x04629bad, 0x04634fad, 0x0463631e, 0x0463786d, 0x046379ed, 0x0463814e,
+    0x0463936d, 0x046394ed, 0x0463956d, 0x046397ed, 0x04639e6d, 0x0463a9ce, 0x0463cded, 0x0463d92d,
+    0x0463ddad, 0x0464062d, 0x046407ad, 0x0464082d, 0x046419ad, 0x04641a2d, 0x04641bad, 0x0464234e,
+    0x0464476d, 0x046452ad, 0x046458ad, 0x0464592d, 0x0464888e, 0x0464b10e, 0x0464c4ad, 0x0464c52d,
+    0x0464fb2d, 0x04652a8e, 0x0465338a, 0x0466242d, 0x046628ad, 0x0466486d, 0x04664c6d, 0x0466612d,
+    0x046667ad, 0x046674ad, 0x0466752d, 0x046689ad, 0x0466970e, 0x0466c5ad, 0x0466c62d, 0x0467172d,
+    0x04671bad, 0x04675aae, 0x0467682e, 0x0467902e, 0x0469d012, 0x0469e385, 0x0469e755, 0x0469e8d5,
+    0x0469e955, 0x0469ebc9, 0x0469fb4d, 0x0469fcd5, 0x0469ffd5, 0x046a0c12, 0x046a21d9, 0x046a2d19,
+    0x046a45bd, 0x046a5dc9, 0x046a5f45, 0x046a6799, 0x046a6919, 0x046a6999, 0x046a6d99, 0x046a77c5,
+    0x046a7b99, 0x046a7d19, 0x046a8199, 0x046a8592, 0x046a9b55, 0x046aa695, 0x046aaf49, 0x046aba95,
+    0x046abf39, 0x046ac095, 0x046af0bd, 0x046b1345, 0x046b1739, 0x046b188d, 0x046b190d, 0x046b1b89,
+    0x046b1e85, 0x046b2c8d, 0x046b2f89, 0x046b8cc5, 0x046b908d, 0x046b9235, 0x046b92bd, 0x046b9509,
+    0x046bdc2d, 0x046cf945, 0x046cfd39, 0x046cfeb5, 0x046cff3d, 0x046d0189, 0x046d0485, 0x046dfcad,
+    0x0476aa51, 0x0476bc49, 0x0476cfc9, 0x0476d145, 0x0476e4c9, 0x0476fd99, 0x0477039a, 0x04770bc5,
+    0x04770f99, 0x04771119, 0x0477159a, 0x0477161a, 0x04773836, 0x04773999, 0x04773a36, 0x04773e1a,
+    0x04773e9a, 0x04774b99, 0x04774c36, 0x04774d99, 0x04775e49, 0x04777715, 0x04778545, 0x04778939,
+    0x04778a95, 0x04779f91, 0x0477a591, 0x0477c08d, 0x0477c13d, 0x0477c389, 0x0477e90d, 0x0477e9b6,
+    0x0477ec36, 0x0477fd0d, 0x0477ff89, 0x04780036, 0x04780aad, 0x0478610e, 0x0478630e, 0x04786589,
+    0x04787c2d, 0x04787dad, 0x0478b82d, 0x0478ba2d, 0x04799995, 0x0479cdb9, 0x0479cfbd, 0x0479d209,
+    0x0479f0be, 0x047a24ba, 0x047a26ad, 0x047a2b3a, 0x047aa03e, 0x047d9f99, 0x047e34ba, 0x047e363e,
+    0x047e5389, 0x047e582d, 0x047e5ead, 0x047e6c2d, 0x047e70ba, 0x047e807e, 0x047ec88e, 0x047ecd09,
+    0x047ed02d, 0x047ed1ad, 0x047f0c2d, 0x047f0e2d, 0x047f4f59, 0x04803539, 0x04803989, 0x04803cba,
+    0x04803e2d, 0x0480433a, 0x048044be, 0x048050ba, 0x0480523e, 0x048056ba, 0x048078ba, 0x04807aad,
+    0x04807f3a, 0x0480f22d, 0x0480f2be, 0x0480f43e, 0x04815dd1, 0x0481af99, 0x0481b119, 0x0481c319,
+    0x0481eb99, 0x0482dea5, 0x04837a41, 0x04837bc1, 0x04838f15, 0x04839095, 0x04839595, 0x04839719,
+    0x0483a2a1, 0x0483a315, 0x0483a495, 0x0483a915, 0x0483f411, 0x0483f591, 0x0483fa11, 0x04843111,
+    0x04843291, 0x04843791, 0x04843911, 0x04849661, 0x048497e1, 0x04849ce1, 0x04849e61, 0x0484befd,
+    0x0484c07d, 0x0484c561, 0x0484c6e1, 0x0484d2e1, 0x0484d461, 0x0484d8e1, 0x0484e691, 0x0484e711,
+    0x0484e8b9, 0x0484ed25, 0x04850c8a, 0x04850e06, 0x04850e82, 0x04853861, 0x048539f9, 0x04853ee5,
+    0x04854be1, 0x04854c61, 0x04854df9, 0x04855265, 0x04855f06, 0x04855f82, 0x0485747d, 0x048574e1,
+    0x04857679, 0x04857ae5, 0x04859a4a, 0x04859bc6, 0x0485adc5, 0x0485b115, 0x0485b195, 0x0485b315,
+    0x0485b799, 0x0486238e, 0x0486280a, 0x04862986, 0x04865311, 0x04865391, 0x04865511, 0x04865991,
+    0x0486a4e1, 0x0486a661, 0x0486ab61, 0x0486ace1, 0x0486b861, 0x0486b8e1, 0x0486ba61, 0x0486bee1,
+    0x0486e0fd, 0x0486e161, 0x0486e2e1, 0x0486e761, 0x04871b0a, 0x04875a61, 0x04875ae1, 0x04875c79,
+    0x0487db15, 0x0487dc99, 0x0488d05e, 0x0488e3dd, 0x04890add, 0x04890c5d, 0x04891e5d, 0x048944a5,
+    0x04898465, 0x048997e5, 0x048a847d, 0x048b00a5, 0x048b7755, 0x048be9ce, 0x048c130d, 0x048c148d,
+    0x048c1709, 0x048c1789, 0x048c1a85, 0x048c1d89, 0x048c268e, 0x048c2b0a, 0x048c56d9, 0x048c5859,
+    0x048c58d9, 0x048c5d59, 0x048c5ed9, 0x048c6a59, 0x048c6ad9, 0x048c6c59, 0x048c70d9, 0x048c8989,
+    0x048c8f85, 0x048c92fd, 0x048c9359, 0x048c94d9, 0x048c9959, 0x048cd855, 0x048d564e, 0x048d8285,
+    0x048d85d5, 0x048d8655, 0x048d87f9, 0x048d8c65, 0x048dbc4d, 0x048dc049, 0x048dc0c9, 0x048dcfce,
+    0x048df84e, 0x048dfcca, 0x048f365e, 0x048f37de, 0x048f49dd, 0x048f725d, 0x04904b11, 0x04904c91,
+    0x04909c5a, 0x04909dda, 0x04909e5a, 0x0490a2da, 0x0490a45a, 0x0490b059, 0x0490b1d9, 0x0490b659,
+    0x0490d8e5, 0x0490da59, 0x0490ded9, 0x049115d6, 0x04911756, 0x04911c56, 0x04911dd6, 0x04915e45,
+    0x049166a5, 0x04916825, 0x04916ca5, 0x0491b48a, 0x0491b606, 0x0491cb55, 0x0491cbd5, 0x0491cd79,
+    0x04927a8e, 0x04927f0a, 0x0492be59, 0x0492bed9, 0x0492c059, 0x049337d5, 0x04933855, 0x049339d5,
+    0x04933e65, 0x049378e5, 0x049423ce, 0x04960311, 0x049654dd, 0x04965676, 0x04966876, 0x049690dd,
+    0x04983ad5, 0x04983c79, 0x04984e55, 0x04986351, 0x049864f6, 0x04989f51, 0x049a5cd5, 0x049a8576,
+    0x049c091d, 0x049c7c85, 0x049c8055, 0x049c81f9, 0x049c93d5, 0x049cbac9, 0x049cce76, 0x049cf6c9,
+    0x049d1bd1, 0x049d2dc9, 0x049d4149, 0x049d42c5, 0x049d5649, 0x049d6f19, 0x049d7599, 0x049d77c9,
+    0x049d7d45, 0x049d8119, 0x049d82b5, 0x049d8319, 0x049da9be, 0x049dbd3e, 0x049dbd99, 0x049dcfc9,
+    0x049de895, 0x049ded15, 0x049df245, 0x049df6c5, 0x049dfa95, 0x049dfc15, 0x049dfc95, 0x049e1111,
+    0x049e1591, 0x049e308d, 0x049e328d, 0x049e3509, 0x049e3805, 0x049e593e, 0x049e5dbe, 0x049e6cbe,
+    0x049e6d0d, 0x049e713e, 0x049e7189, 0x049e7aad, 0x049e7c2d, 0x049eedad, 0x049eef36, 0x049ef42d,
+    0x049ef5b6, 0x049f1cad, 0x049f1e39, 0x049f2049, 0x049f29bd, 0x049f2a2d, 0x049f2bb9, 0x049f302d,
+    0x049f8acd, 0x049f93c9, 0x049f9e76, 0x049fa149, 0x049fa776, 0x049fc54d, 0x049fc6cd, 0x049fc9c9,
+    0x049fcfc9, 0x04a00915, 0x04a03191, 0x04a04ead, 0x04a06236, 0x04a082bd, 0x04a0843d, 0x04a084ad,
+    0x04a0892d, 0x04a08aad, 0x04a08cc9, 0x04a0963d, 0x04a096ad, 0x04a0982d, 0x04a09cad, 0x04a0c2c9,
+    0x04a0f2c9, 0x04a0fc2d, 0x04a0fdb6, 0x04a0fe39, 0x04a102ad, 0x04a10436, 0x04a10676, 0x04a10fb6,
+    0x04a1102d, 0x04a111b6, 0x04a11636, 0x04a12ec9, 0x04a1383d, 0x04a138ad, 0x04a13a39, 0x04a13ead,
+    0x04a2e7d5, 0x04a32276, 0x04a3e919, 0x04a3eab5, 0x04a3fd51, 0x04a4988d, 0x04a49d09, 0x04a4a62d,
+    0x04a4a7b6, 0x04a4c9bd, 0x04a4cead, 0x04a4d02d, 0x04a4dc2d, 0x04a4ddad, 0x04a4e22d, 0x04a4f651,
+    0x04a541ad, 0x04a54336, 0x04a5482d, 0x04a549b6, 0x04a555ad, 0x04a55bb6, 0x04a57dbd, 0x04a57e2d,
+    0x04a57fb9, 0x04a5842d, 0x04a5c0d5, 0x04a5f0cd, 0x04a5f276, 0x04a5f4f6, 0x04a5f549, 0x04a5fb76,
+    0x04a62cce, 0x04a662d1, 0x04a6ae2d, 0x04a6afb6, 0x04a6b4ad, 0x04a6b636, 0x04a6c22d, 0x04a6c3b6,
+    0x04a6c836, 0x04a6ea3d, 0x04a6eaad, 0x04a6ec2d, 0x04a6f0ad, 0x04a75a76, 0x04a763b6, 0x04a7642d,
+    0x04a765b6, 0x04a76a36, 0x04a9ec11, 0x04a9ed91, 0x04a9f219, 0x04aa3d5a, 0x04aa3eda, 0x04aa43da,
+    0x04aa5159, 0x04aa52d9, 0x04aa5759, 0x04aa79f5, 0x04aa7b59, 0x04aa7fd9, 0x04aab6d6, 0x04aab856,
+    0x04aabd56, 0x04aabed6, 0x04aad0d5, 0x04aadf52, 0x04aae0d2, 0x04aae5d2, 0x04aae752, 0x04ab1d51,
+    0x04ab21d1, 0x04ab6c55, 0x04ab6cd5, 0x04ab6e79, 0x04ab94d1, 0x04ab9551, 0x04ac200a, 0x04ac5f59,
+    0x04ac5fd9, 0x04ac6159, 0x04acd8d5, 0x04acd955, 0x04acdad5, 0x04acdf61, 0x04ad0151, 0x04ad01d1,
+    0x04ad0351, 0x04b07c55, 0x04b0b999, 0x04b1690d, 0x04b16d89, 0x04b1702d, 0x04b171ad, 0x04b176ad,
+    0x04b1782d, 0x04b19a3d, 0x04b19f35, 0x04b1a0ad, 0x04b1acb5, 0x04b1ae2d, 0x04b1b2ad, 0x04b2122d,
+    0x04b213b9, 0x04b225ad, 0x04b2262d, 0x04b24e3d, 0x04b24eb5, 0x04b25039, 0x04b28785, 0x04b28ad5,
+    0x04b28b55, 0x04b28cd5, 0x04b29159, 0x04b2c14d, 0x04b2c549, 0x04b2c5c9, 0x04b2fd4e, 0x04b301ca,
+    0x04b33c4d, 0x04b34549, 0x04b37ead, 0x04b3802d, 0x04b380ad, 0x04b3852d, 0x04b386ad, 0x04b3922d,
+    0x04b392ad, 0x04b3942d, 0x04b398ad, 0x04b3babd, 0x04b3bb35, 0x04b3bcad, 0x04b3c12d, 0x04b3f4ca,
+    0x04b4342d, 0x04b434ad, 0x04b43639, 0x04b6d0ed, 0x04b6d26d, 0x04b70b5a, 0x04b778ed, 0x04b7d82d,
+    0x04b7d9ad, 0x04b7de2d, 0x04b8022d, 0x04b806ad, 0x04b879ad, 0x04b87a2d, 0x04b9e62d, 0x04b9e6ad,
+    0x04b9e82d, 0x04bf4645, 0x04bf4741, 0x04bf6e41, 0x04bf6fa1, 0x04bf7015, 0x04bfc091, 0x04bfc111,
+    0x04bfe806, 0x04bffe11, 0x04c08be1, 0x04c08d61, 0x04c09261, 0x04c093e1, 0x04c09e01, 0x04c09f61,
+    0x04c09fe1, 0x04c0b391, 0x04c0b411, 0x04c0db06, 0x04c10561, 0x04c106e1, 0x04c11781, 0x04c118e1,
+    0x04c11961, 0x04c11ae6, 0x04c11f66, 0x04c14001, 0x04c14161, 0x04c141e1, 0x04c14361, 0x04c147e5,
+    0x04c160c9, 0x04c16245, 0x04c166c5, 0x04c16a91, 0x04c16c11, 0x04c1780d, 0x04c1798d, 0x04c17a0d,
+    0x04c17c89, 0x04c18b8d, 0x04c18c0d, 0x04c19009, 0x04c19095, 0x04c19185, 0x04c1a08d, 0x04c1a225,
+    0x04c1a509, 0x04c1b289, 0x04c1bdd9, 0x04c1c259, 0x04c1c3e5, 0x04c1c459, 0x04c1c625, 0x04c1c6a5,
+    0x04c1c785, 0x04c1cc05, 0x04c1cfd9, 0x04c1d165, 0x04c1d5e5, 0x04c1d659, 0x04c1ee89, 0x04c1f859,
+    0x04c1f9d9, 0x04c1fa59, 0x04c1fee6, 0x04c20289, 0x04c20bd9, 0x04c20c59, 0x04c20dd9, 0x04c2125a,
+    0x04c21a25, 0x04c21b8d, 0x04c21e89, 0x04c22c09, 0x04c23755, 0x04c23be5, 0x04c23d55, 0x04c23dd5,
+    0x04c23f89, 0x04c24009, 0x04c24125, 0x04c24585, 0x04c24965, 0x04c24ad5, 0x04c24b55, 0x04c24f65,
+    0x04c24fe5, 0x04c25fd1, 0x04c26465, 0x04c265e5, 0x04c26d4e, 0x04c27f65, 0x04c280e5, 0x04c28165,
+    0x04c283c9, 0x04c2a7e5, 0x04c2a94d, 0x04c2a9cd, 0x04c2ac49, 0x04c2bb65, 0x04c2bbe5, 0x04c2bd4d,
+    0x04c2bfc9, 0x04c2c049, 0x04c3868d, 0x04c3880d, 0x04c38b3d, 0x04c39889, 0x04c3a3fd, 0x04c3a855,
+    0x04c3a9d5, 0x04c3aa55, 0x04c3b5fd, 0x04c3b77d, 0x04c3b7fd, 0x04c3bbd5, 0x04c3bc55, 0x04c3c109,
+    0x04c3cc7d, 0x04c3d0d1, 0x04c3d265, 0x04c3d9ce, 0x04c3ebcd, 0x04c3ed65, 0x04c3ede9, 0x04c3f07d,
+    0x04c415cd, 0x04c429cd, 0x04c42cfd, 0x04c43a89, 0x04c445fd, 0x04c44a65, 0x04c44bd1, 0x04c4534e,
+    0x04c46565, 0x04c466cd, 0x04c4674d, 0x04c469fd, 0x04c47bce, 0x04c49fc9, 0x04c4ab3d, 0x04c4afa5,
+    0x04c4b125, 0x04c4b1a5, 0x04c4c849, 0x04c4d3bd, 0x04c4d825, 0x04c4d9a5, 0x04c4da25, 0x04c4e73d,
+    0x04c4e7bd, 0x04c4eba5, 0x04c4ec25, 0x04c4eda5, 0x04c541ce, 0x04c54d3d, 0x04c551a6, 0x04c55326,
+    0x04c553a6, 0x04c55f3d, 0x04c56526, 0x04c565a6, 0x04c587bd, 0x04c5893d, 0x04c589bd, 0x04c58e26,
+    0x04c58fa6, 0x04c59b3d, 0x04c59bbd, 0x04c59d3d, 0x04c5a1a6, 0x04c5c655, 0x04c65159, 0x04c6ae49,
+    0x04c6b9a5, 0x04c6be25, 0x04c6c025, 0x04c6f625, 0x04c6faa5, 0x04c6fc25, 0x04c70e25, 0x04c74455,
+    0x04c76fa5, 0x04c77426, 0x04c7aba5, 0x04c7df8d, 0x04c81a09, 0x04c81b85, 0x04c823d9, 0x04c82559,
+    0x04c829d9, 0x04c82e09, 0x04c82f85, 0x04c837dd, 0x04c8395d, 0x04c83dd9, 0x04c85fd9, 0x04c8a355,
+    0x04c8d35d, 0x04c8d4dd, 0x04c8e769, 0x04c8e8cd, 0x04c90f4d, 0x04ca0fd5, 0x04ca3fd9, 0x04ca4159,
+    0x04ca53cd, 0x04ca554d, 0x04cb17a9, 0x04cb1925, 0x04cb3fa5, 0x04cba949, 0x04cbaac5, 0x04cbb33d,
+    0x04cbb4bd, 0x04cbb926, 0x04cbcd26, 0x04cbef3d, 0x04cc1445, 0x04cc1791, 0x04cc1811, 0x04cc1991,
+    0x04cc3d8a, 0x04cc3f06, 0x04cc7d59, 0x04cc7ed9, 0x04cc8e8a, 0x04cc9006, 0x04cca559, 0x04cca5d9,
+    0x04cca759, 0x04cce2d5, 0x04cd15c9, 0x04cd1745, 0x04cd1fa5, 0x04cd2125, 0x04cd25a5, 0x04cd33a9,
+    0x04cd3525, 0x04cd6ec6, 0x04cd818a, 0x04cd8306, 0x04cd9855, 0x04cd98d5, 0x04cd9a55, 0x04cde846,
+    0x04ce10c6, 0x04ce3149, 0x04ce32c5, 0x04ce3745, 0x04ce3b11, 0x04ce3c91, 0x04ce488d, 0x04ce4a0d,
+    0x04ce4d09, 0x04ce5c22, 0x04ce60a2, 0x04ce6222, 0x04ce710d, 0x04ce72b5, 0x04ce7589, 0x04ce8e59,
+    0x04ce92d9, 0x04ce9475, 0x04ce9822, 0x04ce9ca2, 0x04cea062, 0x04cea1e2, 0x04ceea91, 0x04ceec0d,
+    0x04ceef09, 0x04cef205, 0x04cef301, 0x04cf07d5, 0x04cf0c61, 0x04cf0dd5, 0x04cf1022, 0x04cf11a2,
+    0x04cf1622, 0x04cf19e2, 0x04cf1b62, 0x04cf1bd5, 0x04cf3051, 0x04cf34d1, 0x04cf3675, 0x04cf4fe2,
+    0x04cf5462, 0x04cf5762, 0x04d0570d, 0x04d0588d, 0x04d05bbd, 0x04d06909, 0x04d0747d, 0x04d078d5,
+    0x04d07a55, 0x04d08662, 0x04d087e2, 0x04d09cfd, 0x04d0a151, 0x04d0a2f5, 0x04d0aa4e, 0x04d0e64d,
+    0x04d10b09, 0x04d1167d, 0x04d11ad1, 0x04d11c51, 0x04d123ce, 0x04d135e2, 0x04d13762, 0x04d14c4e,
+    0x04d17062, 0x04d17ba2, 0x04d18022, 0x04d181a2, 0x04d198c9, 0x04d1a43d, 0x04d1a8a1, 0x04d1aa21,
+    0x04d1b7a2, 0x04d1b83d, 0x04d21249, 0x04d21dbd, 0x04d22221, 0x04d235a2, 0x04d259bd, 0x04d33851,
+    0x04d338d1, 0x04d34bc5, 0x04d34cc1, 0x04d37445, 0x04d37541, 0x04d38a21, 0x04d39c22, 0x04d39da2,
+    0x04d39e21, 0x04d3c4a1, 0x04d3c621, 0x04d3c6a1, 0x04d3d8a1, 0x04d49ca9, 0x04d49e29, 0x04d4a129,
+    0x04d4b9e9, 0x04d4be69, 0x04d4bfe9, 0x04d4c069, 0x04d4c229, 0x04d4c2a9, 0x04d4c3a9, 0x04d4c829,
+    0x04d4cbe9, 0x04d4cd69, 0x04d4d1e9, 0x04d4d269, 0x04d4e269, 0x04d4e6e9, 0x04d4efce, 0x04d501e9,
+    0x04d50669, 0x04d52a69, 0x04d52be9, 0x04d52c69, 0x04d52ee9, 0x04d53de9, 0x04d53e69, 0x04d53fe9,
+    0x04d54269, 0x04d542e9, 0x04d55be9, 0x04d561e9, 0x04d5694e, 0x04d57b69, 0x04d57ce9, 0x04d57d69,
+    0x04d57fe9, 0x04d582e9, 0x04d5b5e9, 0x04d5c129, 0x04d5c5a9, 0x04d5de69, 0x04d5e9a9, 0x04d5efa9,
+    0x04d5f029, 0x04d5f1e9, 0x04d5f269, 0x04d5fd29, 0x04d5fda9, 0x04d603a9, 0x04d66329, 0x04d667a9,
+    0x04d669a9, 0x04d67529, 0x04d67ba9, 0x04d69da9, 0x04d69f2a, 0x04d69fa9, 0x04d6a429, 0x04d6b11e,
+    0x04d6b19e, 0x04d6b31e, 0x04d6b79e, 0x04d6cce9, 0x04d6ce69, 0x04d6d5ce, 0x04d6e7e9, 0x04d6e969,
+    0x04d6e9e9, 0x04d6fe4e, 0x04d72269, 0x04d73229, 0x04d75aa9, 0x04d75c29, 0x04d75ca9, 0x04d76e29,
+    0x04d76ea9, 0x04d77029, 0x04d777ce, 0x04d79be9, 0x04d7aba9, 0x04d7ad29, 0x04d7ada9, 0x04d7dd0e,
+    0x04d8058e, 0x04d81929, 0x04d819a9, 0x04d84fa9, 0x04d87f0e, 0x04d8880a, 0x04d978a9, 0x04d97d29,
+    0x04d99ce9, 0x04d9b5a9, 0x04d9bc29, 0x04d9c929, 0x04d9c9a9, 0x04d9de29, 0x04d9eb8e, 0x04da1a29,
+    0x04da1aa9, 0x04da6ba9, 0x04da7029, 0x04db1609, 0x04db1785, 0x04db1c05, 0x04db1fd5, 0x04db2155,
+    0x04db25d5, 0x04db2a09, 0x04db2b85, 0x04db3005, 0x04db33d5, 0x04db3555, 0x04db39d5, 0x04db4012,
+    0x04db4492, 0x04db55cd, 0x04db5775, 0x04db57cd, 0x04db5a59, 0x04db69cd, 0x04db6b75, 0x04db6e5d,
+    0x04db91cd, 0x04db9649, 0x04dbcf4d, 0x04dbd0d5, 0x04dbd3d5, 0x04dbd6d5, 0x04dbe34d, 0x04dbe4cd,
+    0x04dbe7c9, 0x04dc199d, 0x04dc1b9d, 0x04dc1dc9, 0x04dc291d, 0x04dc2da9, 0x04dc2f35, 0x04dc45c9,
+    0x04dc4f9d, 0x04dc511d, 0x04dc519d, 0x04dc559d, 0x04dc59c9, 0x04dc639d, 0x04dc651d, 0x04dc699d,
+    0x04dcc91d, 0x04dccab5, 0x04dccb1d, 0x04dccf35, 0x04dce335, 0x04dd051d, 0x04dd3bcd, 0x04dd3d55,
+    0x04dd407d, 0x04dd4fcd, 0x04dd514d, 0x04dd547d, 0x04dd8619, 0x04dd8819, 0x04dd9a19, 0x04dd9bb5,
+    0x04ddb249, 0x04ddbc3d, 0x04ddbdbd, 0x04ddc219, 0x04ddd03d, 0x04ddd1bd, 0x04ddd619, 0x04ddff95,
+    0x04de0f3d, 0x04de1395, 0x04de1515, 0x04de450d, 0x04de67c5, 0x04de6b8d, 0x04de6d0d, 0x04de703d,
+    0x04de733d, 0x04de810d, 0x04dee145, 0x04dee50d, 0x04dee6b5, 0x04dee70d, 0x04dee9bd, 0x04dfb619,
+    0x04dfb7b5, 0x04e04dc5, 0x04e0518d, 0x04e05335, 0x04e0538d, 0x04e05609, 0x04e05905, 0x04e06a09,
+    0x04e09529, 0x04e096a9, 0x04e09ba9, 0x04e09d29, 0x04e0a929, 0x04e10ea9, 0x04e11036, 0x04e122a9,
+    0x04e12436, 0x04e128b6, 0x04e14aa9, 0x04e14b29, 0x04e14ca9, 0x04e15129, 0x04e5b891, 0x04e5b911,
+    0x04e5e006, 0x04e5e082, 0x04e61e59, 0x04e63182, 0x04e64659, 0x04e646f5, 0x04e683d5, 0x04e69761,
+    0x04e697d5, 0x04e6ac51, 0x04e6e851, 0x04e70fc6, 0x04e71042, 0x04e73955, 0x04e739d5, 0x04e761d1,
+    0x04e76251, 0x04e78946, 0x04e789c2, 0x04e7b1c6, 0x04e7b242, 0x04e81a51, 0x04e8264d, 0x04e827cd,
+    0x04e8284d, 0x04e82ad9, 0x04e839cd, 0x04e83a4d, 0x04e83e49, 0x04e83edd, 0x04e8624d, 0x04e866c9,
+    0x04e89251, 0x04e89fcd, 0x04e8b34d, 0x04e8b945, 0x04e8c84d, 0x04e8c9cd, 0x04e8ea1d, 0x04e8eb9d,
+    0x04e8ec1d, 0x04e8edc9, 0x04e8ee49, 0x04e8ef45, 0x04e8f79d, 0x04e8f91d, 0x04e8f99d, 0x04e8fd9d,
+    0x04e8fe29, 0x04e91649, 0x04e92036, 0x04e9219d, 0x04e92236, 0x04e9261d, 0x04e926b6, 0x04e92a49,
+    0x04e9339d, 0x04e93436, 0x04e9359d, 0x04e93a1d, 0x04e9999d, 0x04e99b9d, 0x04ea364d, 0x04ea569a,
+    0x04ea581a, 0x04ea589a, 0x04ea5a49, 0x04ea5acd, 0x04ea65bd, 0x04ea6a1a, 0x04ea6a9a, 0x04ea8e3d,
+    0x04ea929a, 0x04ea931a, 0x04eaae4d, 0x04ead015, 0x04ead545, 0x04eaddbd, 0x04eae395, 0x04eae415,
+    0x04eaf891, 0x04eafa11, 0x04eb138d, 0x04eb150d, 0x04eb158d, 0x04eb1e89, 0x04eb3c36, 0x04eb3d8d,
+    0x04eb4f8d, 0x04eb5036, 0x04eb518d, 0x04ebb58e, 0x04ebb78e, 0x04ebba3d, 0x04ec4955, 0x04ec8699,
+    0x04ecee15, 0x04ed220d, 0x04ed240d, 0x04ed2689, 0x04ed3a89, 0x04ed65b5, 0x04ed6729, 0x04ed6c35,
+    0x04ed6da9, 0x04ed7929, 0x04ed79b5, 0x04eddf29, 0x04ede0a9, 0x04edf2a9, 0x04edf329, 0x04ee1b29,
+    0x04ee1bb5, 0x04ee1d29, 0x04ee8dcd, 0x04ee9259, 0x04ef519d, 0x04ef611d, 0x04ef879d, 0x04f0011d,
+    0x04f0be1a, 0x04f21d0e, 0x04f221bd, 0x04f2868a, 0x04f29d55, 0x04f29dd5, 0x04f29f55, 0x04f3898d,
+    0x04f38e09, 0x04f39129, 0x04f3a52a, 0x04f3a6a9, 0x04f3cd29, 0x04f3cdb5, 0x04f3cf29, 0x04f446a9,
+    0x04f44729, 0x04f448a9, 0x04f509a2, 0x04f50e22, 0x04f6da89, 0x04f6e5fd, 0x04f70309, 0x04f70e7d,
+    0x04f71bce, 0x04f72de2, 0x04f7564d, 0x04f7954e, 0x04f7bdce, 0x04f7e1e2, 0x04f7ed22, 0x04f80a49,
+    0x04f815bd, 0x04f81a39, 0x04f883ce, 0x04f88f3d, 0x04f893a6, 0x04f8a722, 0x04f8c9bd, 0x04f9d0fa,
+    0x04fa21fa, 0x04fa48fa, 0x04fa49fa, 0x04fb0e25, 0x04fb0fa5, 0x04fb12a5, 0x04fb2b65, 0x04fb2fe5,
+    0x04fb3165, 0x04fb31e5, 0x04fb33a5, 0x04fb3425, 0x04fb3525, 0x04fb39a5, 0x04fb3d65, 0x04fb3ee5,
+    0x04fb4365, 0x04fb43e5, 0x04fb53e5, 0x04fb5865, 0x04fb614e, 0x04fb7365, 0x04fb77e5, 0x04fb9be5,
+    0x04fb9d65, 0x04fb9de5, 0x04fba065, 0x04fbaf65, 0x04fbafe6, 0x04fbb165, 0x04fbb3e5, 0x04fbb465,
+    0x04fbcd65, 0x04fbd365, 0x04fbdace, 0x04fbee65, 0x04fbeee5, 0x04fbf165, 0x04fc2765, 0x04fc32a5,
+    0x04fc4fe5, 0x04fc5b25, 0x04fc6125, 0x04fc61a5, 0x04fc6365, 0x04fc63e5, 0x04fc6ea5, 0x04fc6f25,
+    0x04fc7525, 0x04fcd4a5, 0x04fcd926, 0x04fcdb26, 0x04fce6a5, 0x04fced26, 0x04fd0f25, 0x04fd10a5,
+    0x04fd1125, 0x04fd229e, 0x04fd231e, 0x04fd249e, 0x04fd291e, 0x04fd3e65, 0x04fd3fe5, 0x04fd474e,
+    0x04fd5965, 0x04fd5ae5, 0x04fd6465, 0x04fd6fce, 0x04fd93e5, 0x04fda3a5, 0x04fdcc26, 0x04fdcda5,
+    0x04fdce26, 0x04fddfa5, 0x04fde026, 0x04fde1a5, 0x04fde94e, 0x04fe0d65, 0x04fe1ea5, 0x04fe1f25,
+    0x04fe4e8e, 0x04fe770e, 0x04fe8aa5, 0x04fe8b25, 0x04fec126, 0x04fef98a, 0x04ffea25, 0x04ffeea6,
+    0x05002da5, 0x05005d0e, 0x0500dd25, 0x0500e1a6, 0x05018789, 0x05018905, 0x05018d85, 0x05019155,
+    0x050192d5, 0x05019755, 0x05019b89, 0x05019d05, 0x0501a195, 0x0501a555, 0x0501a6d5, 0x0501ab55,
+    0x0501b012, 0x0501c759, 0x0501c8cd, 0x0501cbd9, 0x0501db7d, 0x0501dcfd, 0x0502034d, 0x050207c9,
+    0x05021bc9, 0x05021d45, 0x050240f9, 0x0502424d, 0x05024555, 0x050254f9, 0x0502564d, 0x05025955,
+    0x05028c9d, 0x0502a0bd, 0x0502b749, 0x0502c139, 0x0502c29d, 0x0502c739, 0x0502d145, 0x0502d539,
+    0x0502d69d, 0x0502db39, 0x05033245, 0x05033a9d, 0x05033c1d, 0x050340a6, 0x050354a6, 0x0503769d,
+    0x0503ad55, 0x0503aecd, 0x0503b1fd, 0x0503c14d, 0x0503c2cd, 0x0503f919, 0x05040bbd, 0x05040d3d,
+    0x05042545, 0x05042dbd, 0x05042f3d, 0x05043399, 0x05043dfd, 0x050441bd, 0x0504433d, 0x05044799,
+    0x05047295, 0x05048539, 0x05048695, 0x0504d945, 0x0504dd39, 0x0504de8d, 0x0504e1bd, 0x0504f5bd,
+    0x050552c5, 0x0505568d, 0x0505580d, 0x05055b3d, 0x050627bd, 0x0506293d, 0x0506bf45, 0x0506c339,
+    0x0506c48d, 0x0506c789, 0x0507dea1, 0x0507e021, 0x0507e321, 0x0507fbe1, 0x05080061, 0x050801e1,
+    0x05080422, 0x050804a1, 0x050805a2, 0x05080a22, 0x05080de2, 0x05080f62, 0x05082461, 0x050828e1,
+    0x05089de1, 0x0508a3e1, 0x0508bd62, 0x0508c4e2, 0x05090322, 0x050907a2, 0x05092ba1, 0x050931a1,
+    0x05093f22, 0x05093fa1, 0x0509a521, 0x0509a9a1, 0x050a0ee1, 0x050a1061, 0x050a17ce, 0x050a2e62,
+    0x050a34e1, 0x050a404e, 0x050a6fa2, 0x050a7422, 0x050a9ca1, 0x050a9e21, 0x050ab0a1, 0x050ab9ce,
+    0x050ae922, 0x050aeda2, 0x050aef22, 0x050aefa1, 0x050b478e, 0x050bc10e, 0x050bca0a, 0x050ce2e1,
+    0x050cf7a1, 0x050d0b22, 0x050d0ba1, 0x050d2021, 0x050d5c21, 0x050d5ca1, 0x0514ac12, 0x0514b5d2,
+    0x0514b752, 0x0514c34d, 0x0514c4cd, 0x0514c54d, 0x0514c7c9, 0x0514d74d, 0x0514d8d5, 0x0514dbd5,
+    0x0514ebd2, 0x0514ed52, 0x0514f052, 0x05150919, 0x05150d99, 0x05150f35, 0x05150fbd, 0x051511fd,
+    0x051521bd, 0x05154399, 0x05154519, 0x05154599, 0x05154999, 0x051553c5, 0x05155799, 0x05155919,
+    0x05155d99, 0x05156552, 0x051566d2, 0x051569d2, 0x05158295, 0x05158739, 0x05158895, 0x05158915,
+    0x05158b49, 0x05159695, 0x05159b39, 0x05159c95, 0x0515ab12, 0x0515af92, 0x0515b112, 0x0515ccbd,
+    0x0515f48d, 0x0515f50d, 0x0515f789, 0x0515fa85, 0x0516088d, 0x05160b89, 0x05166c8d, 0x05167109,
+    0x0516d1d2, 0x0516d352, 0x0516d652, 0x0516e3c9, 0x0516ef3d, 0x0516f395, 0x0516f515, 0x0516f595,
+    0x0516f7cd, 0x05170795, 0x05170915, 0x05171792, 0x05171c12, 0x05171d92, 0x0517250e, 0x0517423d,
+    0x05175f8d, 0x0517610d, 0x0517618d, 0x0517750d, 0x0517783d, 0x05179112, 0x05179592, 0x05179712,
+    0x05179e8e, 0x0517b28d, 0x0517bb89, 0x0517fcfd, 0x05181389, 0x05181efd, 0x05182379, 0x051824f5,
+    0x05182575, 0x051832fd, 0x05183779, 0x051838f5, 0x05188d09, 0x0518987d, 0x05189cf5, 0x05189e75,
+    0x05189efd, 0x0518b0fd, 0x0518d2fd, 0x0518d47d, 0x0518d4fd, 0x0518d8f5, 0x0518e6fd, 0x0518e87d,
+    0x0518ecf5, 0x05195e3d, 0x0519b391, 0x0519c781, 0x0519f001, 0x0519f989, 0x051a04f5, 0x051a0979,
+    0x051a0af5, 0x051a0b7d, 0x051a18fd, 0x051a3f79, 0x051a40f5, 0x051a4175, 0x051a4579, 0x051a5379,
+    0x051a54f5, 0x051a5979, 0x051ab8f5, 0x051aba75, 0x051abafd, 0x051accfd, 0x051af4f5, 0x05207f3a,
+    0x0520a921, 0x0520afa1, 0x0520bb3a, 0x05212121, 0x052122a1, 0x052134a1, 0x0521353e, 0x052136be,
+    0x05215d21, 0x05215f21, 0x05218651, 0x052187d1, 0x052193cd, 0x0521954d, 0x05219849, 0x0521a74d,
+    0x0521a7d6, 0x0521abc9, 0x0521ac55, 0x0521ad45, 0x0521bc4d, 0x0521bdcd, 0x0521c0c9, 0x0521d999,
+    0x0521de1a, 0x0521df9a, 0x0521e01a, 0x0521e1c9, 0x0521e27d, 0x0521e345, 0x0521e7c5, 0x0521eb99,
+    0x0521ed19, 0x0521f19a, 0x0521f21a, 0x05221436, 0x05221599, 0x05221636, 0x05221a1a, 0x05221a9a,
+    0x05222799, 0x05222836, 0x05222999, 0x052235f9, 0x0522374d, 0x05223a49, 0x05225315, 0x052257b9,
+    0x05225915, 0x05225995, 0x05225b49, 0x05225bc9, 0x05225cf9, 0x05226145, 0x05226539, 0x05226695,
+    0x05226715, 0x05226b39, 0x05226bb9, 0x05227b91, 0x05228039, 0x05228191, 0x05229b39, 0x05229c8d,
+    0x05229d3d, 0x05229f89, 0x0522c3b6, 0x0522c50d, 0x0522c5b6, 0x0522c836, 0x0522d739, 0x0522d7b6,
+    0x0522d90d, 0x0522db89, 0x0522dc36, 0x05233d0e, 0x05234189, 0x0523a24d, 0x0523a3cd, 0x0523a6fd,
+    0x0523bfbd, 0x0523c41a, 0x0523c59a, 0x0523c61a, 0x0523c7c9, 0x0523c84d, 0x0523c945, 0x0523cdfd,
+    0x0523d1bd, 0x0523d33d, 0x0523d79a, 0x0523d81a, 0x0523e83d, 0x0523ec9a, 0x0523ee1a, 0x0524078d,
+    0x0524090d, 0x05240c3d, 0x0524129a, 0x05243036, 0x0524318d, 0x05243236, 0x052434b6, 0x0524438d,
+    0x05244436, 0x0524458d, 0x0524483d, 0x052448b6, 0x052461bd, 0x05246639, 0x05246791, 0x05248139,
+    0x0524828d, 0x0524830d, 0x052485bd, 0x05248c09, 0x0524bb89, 0x0524c6fd, 0x0524cb79, 0x0524ccf5,
+    0x0524cd7d, 0x0524e436, 0x0524ef76, 0x0524f3f6, 0x0524f575, 0x0524f5f6, 0x0524f789, 0x0524f836,
+    0x052502fd, 0x05250376, 0x05250779, 0x052507f6, 0x05250975, 0x052568fd, 0x05257afd, 0x05257c7d,
+    0x0525a376, 0x0525a4fd, 0x0525a576, 0x0525b6fd, 0x0525b776, 0x0525b8fd, 0x05262ebd, 0x0526d575,
+    0x0526d9f9, 0x0526db75, 0x0526dbfd, 0x0526e779, 0x0526e8f5, 0x0526e97d, 0x0526ed79, 0x05271175,
+    0x052711f6, 0x052715f9, 0x05271676, 0x052717f5, 0x05272379, 0x05272575, 0x052729f9, 0x05278975,
+    0x05278b7d, 0x05279d7d, 0x0527c775, 0x0528459a, 0x05287b99, 0x05292f89, 0x0529a48e, 0x0529a909,
+    0x052b34fd, 0x052b56fd, 0x052b5b79, 0x052b6afd, 0x052bcefd, 0x052bd07d, 0x052c0afd, 0x052d3b79,
+    0x052d3cf5, 0x052d4179, 0x052d50fd, 0x052d7779, 0x052df0f5, 0x0531e5be, 0x05329b91, 0x05329c11,
+    0x0532c306, 0x0532c382, 0x05330159, 0x0533297d, 0x053329d9, 0x053366d5, 0x05337a61, 0x05337ad5,
+    0x05338f51, 0x0533cbd1, 0x0533f2c6, 0x0533f342, 0x05341c55, 0x05341cd5, 0x053444d1, 0x05344551,
+    0x05344b65, 0x05346c46, 0x05346cc2, 0x053494c6, 0x05349542, 0x0535cf1d, 0x05373b9a, 0x0537493d,
+    0x0537f88d, 0x05392c55, 0x053a48bd, 0x053a4a3d, 0x053a4f25, 0x053a50a5, 0x053a5c3d, 0x053a5ca5,
+    0x053ac225, 0x053ac3b9, 0x053ad5a5, 0x053ad625, 0x053afe3d, 0x053afea5, 0x053b0039, 0x053c3a45,
+    0x053c429d, 0x053c489d, 0x053daf3d, 0x053db0bd, 0x053e5e8d, 0x053f698a, 0x053f8055, 0x053f80d5,
+    0x053f8255, 0x05407425, 0x05408825, 0x054089a5, 0x0540b03d, 0x0540b0a5, 0x0540b225, 0x054129a5,
+    0x05412a25, 0x05412bb9, 0x05413025, 0x0546f0a1, 0x05471fa1, 0x05472121, 0x05472d21, 0x054792a1,
+    0x0547a636, 0x0547a6a1, 0x0547a836, 0x0547acb6, 0x0547cf21, 0x0547d521, 0x0547f7d1, 0x0547f97a,
+    0x0548054d, 0x054806fa, 0x054809c9, 0x05481601, 0x05481781, 0x054818cd, 0x0548194d, 0x05481d49,
+    0x05481dc9, 0x05481ec5, 0x05482dcd, 0x05482f75, 0x05483249, 0x05484b19, 0x05484f99, 0x05485135,
+    0x05485199, 0x05485375, 0x054853c9, 0x054854c5, 0x05485945, 0x05485d19, 0x05485eb5, 0x05485f19,
+    0x05486335, 0x05486399, 0x054885be, 0x0548873e, 0x05488799, 0x0548993e, 0x05489999, 0x05489b1a,
+    0x0548a74d, 0x0548a8cd, 0x0548abc9, 0x0548c495, 0x0548c915, 0x0548ca95, 0x0548cb15, 0x0548ccc9,
+    0x0548cd49, 0x0548ce45, 0x0548d2c5, 0x0548d695, 0x0548d815, 0x0548d895, 0x0548dc95, 0x0548dd15,
+    0x0548ed11, 0x0548f191, 0x0548f335, 0x05490c8d, 0x05490e35, 0x05490e8d, 0x05491109, 0x05491405,
+    0x0549353e, 0x054936be, 0x0549370d, 0x054939be, 0x054948be, 0x0549490d, 0x05494a8d, 0x05494d3e,
+    0x05494d89, 0x054a13cd, 0x054a157a, 0x054a187d, 0x054a313d, 0x054a3595, 0x054a3715, 0x054a3795,
+    0x054a3949, 0x054a39c9, 0x054a3ac5, 0x054a3f7d, 0x054a433d, 0x054a44bd, 0x054a453d, 0x054a4915,
+    0x054a4995, 0x054a59bd, 0x054a5e11, 0x054a5fb5, 0x054a790d, 0x054a7ab5, 0x054a7b0d, 0x054a7dbd,
+    0x054aa1be, 0x054aa33e, 0x054aa38d, 0x054aa63e, 0x054ab53e, 0x054ab58d, 0x054ab70d, 0x054ab9be,
+    0x054aba3d, 0x054ad33d, 0x054ad791, 0x054ad911, 0x054af28d, 0x054af40d, 0x054af48d, 0x054af73d,
+    0x054afa3d, 0x054b2d09, 0x054b387d, 0x054b3cf5, 0x054b3e75, 0x054b3ef5, 0x054b55be, 0x054b60fe,
+    0x054b657e, 0x054b66fe, 0x054b6775, 0x054b693e, 0x054b6989, 0x054b72fe, 0x054b747e, 0x054b74fd,
+    0x054b78fe, 0x054b7975, 0x054b7af5, 0x054bda7a, 0x054bdef5, 0x054be0fa, 0x054bec7d, 0x054bee7a,
+    0x054bf2f5, 0x054c14fe, 0x054c167a, 0x054c16fa, 0x054c1b75, 0x054c1cfa, 0x054c287e, 0x054c28fd,
+    0x054c2a7a, 0x054c2ef5, 0x054cf391, 0x054cf511, 0x054cf591, 0x054d0589, 0x054d0885, 0x054d0981,
+    0x054d2e09, 0x054d3105, 0x054d3201, 0x054d46f5, 0x054d4b75, 0x054d4d75, 0x054d58f5, 0x054d5a75,
+    0x054d5af5, 0x054d817e, 0x054d82fe, 0x054d8375, 0x054d87f5, 0x054d8975, 0x054d9575, 0x054d9b75,
+    0x054dfcfa, 0x054e0175, 0x054e38fa, 0x054f748d, 0x0550e5bd, 0x0551a07d, 0x0551a4f5, 0x0551c6fe,
+    0x0551c87e, 0x0551c8fd, 0x0551ccfe, 0x0551dafd, 0x0551dc7d, 0x0551e0f5, 0x0552407d, 0x0552427a,
+    0x0552547d, 0x05527c7e, 0x0553acf5, 0x0553aef5, 0x0553c0f5, 0x0553c6f5, 0x055454b6, 0x0556eabe,
+    0x0558a8be, 0x05592155, 0x055921d5, 0x055927d9, 0x0559c351, 0x0559c3d1, 0x0559c9d1, 0x055a1521,
+    0x055a16a1, 0x055a1ba1, 0x055a1d21, 0x055a28a1, 0x055a2921, 0x055a2aa1, 0x055a2f21, 0x055a513d,
+    0x055a51b5, 0x055a5321, 0x055a57a1, 0x055acaa1, 0x055acb21, 0x055c450d, 0x055db63d, 0x055e6efd,
+    0x055e707d, 0x055e70fd, 0x055e74f5, 0x055e7575, 0x055e98fe, 0x055e9d7e, 0x055eaafe, 0x055eacfd,
+    0x055eb175, 0x055f10fd, 0x055f12fa, 0x055f24fd, 0x055fda99, 0x05605415, 0x05607d75, 0x05607f75,
+    0x0561ac55, 0x0561acd5, 0x0561ae55, 0x0561b2d9, 0x0562b41d, 0x0562b59d, 0x0562ba1d, 0x0562de1d,
+    0x0562e29d, 0x0563559d, 0x0563561d, 0x056357b9, 0x0563bb7e, 0x0563bcfe, 0x0563c159, 0x056420be,
+    0x0564223e, 0x05642699, 0x0564493e, 0x05644abe, 0x05644f19, 0x0564a015, 0x0564d6fd, 0x0564d87d,
+    0x0564dcf5, 0x0564ecbe, 0x0564f111, 0x0564fefe, 0x05653bbe, 0x05653c3e, 0x05653dbe, 0x0565643e,
+    0x056564be, 0x0565787d, 0x05662e99, 0x05662f19, 0x05663099, 0x05663519, 0x0566a815, 0x0566a895,
+    0x0566aa15, 0x0566ae95, 0x0566d091, 0x0566d111, 0x0566d291, 0x0566e4f5, 0x0567fd05, 0x05680051,
+    0x056800d1, 0x05680251, 0x056806d1, 0x05680e4d, 0x05680fcd, 0x05681249, 0x056812c9, 0x056815c5,
+    0x0568264a, 0x056827c6, 0x05685899, 0x05685a19, 0x05686c19, 0x0568774a, 0x056878c6, 0x056884c9,
+    0x05688ac5, 0x05688e19, 0x05688e99, 0x05689019, 0x05689499, 0x05696a4a, 0x05696bc6, 0x05697dc5,
+    0x05698115, 0x05698195, 0x05698315, 0x056987a5, 0x0569f38e, 0x0569f80a, 0x0569f986, 0x056a2245,
+    0x056a3815, 0x056a3995, 0x056a3e95, 0x056a4015, 0x056a4a41, 0x056a4ba1, 0x056a4c15, 0x056a4d95,
+    0x056a5215, 0x056a9c91, 0x056a9d11, 0x056a9e91, 0x056aa311, 0x056ac406, 0x056ac482, 0x056ada11,
+    0x056adb91, 0x056ae096, 0x056ae211, 0x056b3f61, 0x056b40e1, 0x056b45ea, 0x056b4761, 0x056b67e5,
+    0x056b6961, 0x056b6e61, 0x056b6fe1, 0x056b7be1, 0x056b7d61, 0x056b81e1, 0x056b8f91, 0x056b9011,
+    0x056b9191, 0x056b9625, 0x056bb58a, 0x056bb706, 0x056bb782, 0x056be161, 0x056be2e1, 0x056be7e5,
+    0x056be965, 0x056bf4e1, 0x056bf561, 0x056bf6e1, 0x056bfb65, 0x056c0806, 0x056c1d61, 0x056c1de1,
+    0x056c1f61, 0x056c23e5, 0x056c434a, 0x056c44c6, 0x056c5a15, 0x056c5a95, 0x056c5c15, 0x056c60bd,
+    0x056ccc8e, 0x056cd10a, 0x056cd286, 0x056cfc11, 0x056cfc91, 0x056cfe11, 0x056d4de1, 0x056d4f61,
+    0x056d547d, 0x056d55fd, 0x056d6161, 0x056d61ea, 0x056d6361, 0x056d67fd, 0x056d89e1, 0x056d8a61,
+    0x056d8be1, 0x056d907d, 0x056dc40a, 0x056e0361, 0x056e03e1, 0x056e0561, 0x056e7449, 0x056e7745,
+    0x056e7d95, 0x056e7f15, 0x056e7f95, 0x056e8045, 0x056e8415, 0x056e8595, 0x056e8dc5, 0x056e9115,
+    0x056e9195, 0x056e9315, 0x056e9795, 0x056eb58d, 0x056ebe89, 0x056ec90d, 0x056ecc09, 0x056ed209,
+    0x056ef00d, 0x056ef18d, 0x056ef409, 0x056ef489, 0x056ef785, 0x056efa89, 0x056f080a, 0x056f0986,
+    0x056f795e, 0x056faedd, 0x056fb3dd, 0x056fb55d, 0x056fc0dd, 0x056fc15d, 0x056fc2dd, 0x056fe30d,
+    0x056fe48d, 0x056fe709, 0x056fe789, 0x056fea85, 0x056feda5, 0x056ffb0a, 0x056ffc86, 0x05701d89,
+    0x057026dd, 0x0570285d, 0x057028dd, 0x05702d65, 0x05702ee5, 0x05703109, 0x05703a5d, 0x05703add,
+    0x05703c5d, 0x057040e5, 0x05705989, 0x05705f85, 0x057062dd, 0x0570635d, 0x057064dd, 0x05706965,
+    0x0570f959, 0x05712d59, 0x05712dd9, 0x05712f59, 0x057133d9, 0x0571d825, 0x05722055, 0x057220d5,
+    0x05722255, 0x057226e5, 0x05725026, 0x057292ce, 0x0572974a, 0x0572bc0d, 0x0572bd8d, 0x0572c6bd,
+    0x0572cf8e, 0x0572d40a, 0x0572d586, 0x0572ffd9, 0x05730159, 0x057301d9, 0x0573067d, 0x057307fd,
+    0x05731359, 0x057313d9, 0x05731559, 0x057319fd, 0x05733bd9, 0x05733c59, 0x05733dd9, 0x0573427d,
+    0x05738d55, 0x05738ed5, 0x0573ff4e, 0x057403ca, 0x05742ed5, 0x05742f55, 0x057430d5, 0x0574654d,
+    0x05746c25, 0x057478ce, 0x05747d4a, 0x0574a14e, 0x0574a5ca, 0x0574ce4a, 0x0574cfc6, 0x0574dbc9,
+    0x0574e1c5, 0x0574e515, 0x0574e595, 0x0574e715, 0x0574eb99, 0x05751b9a, 0x05751d0d, 0x05751f89,
+    0x05752009, 0x05752619, 0x0575578e, 0x05755c0a, 0x0575d8de, 0x0575da5e, 0x0575df5e, 0x0575e0de,
+    0x0575ecea, 0x0575ee5d, 0x0575f2ea, 0x057614e5, 0x05761565, 0x057616dd, 0x05761b5d, 0x05764a8e,
+    0x05764f0a, 0x05768509, 0x05768e5d, 0x05768edd, 0x05769065, 0x057694e5, 0x0576f241, 0x0576f391,
+    0x0576f411, 0x0576f591, 0x0576fa19, 0x05771b06, 0x0577455a, 0x057746da, 0x0577475a, 0x05774bda,
+    0x05774d5a, 0x05775959, 0x05775ad9, 0x05775f59, 0x05776c06, 0x05776c82, 0x05778165, 0x057781e5,
+    0x05778359, 0x057787d9, 0x0577bed6, 0x0577c056, 0x0577c556, 0x0577c6d6, 0x0577d8d5, 0x0577e752,
+    0x0577e8d2, 0x0577edd2, 0x0577ef52, 0x05782551, 0x057829d1, 0x05785d8a, 0x05785f06, 0x05785f82,
+    0x05787455, 0x057874d5, 0x05787665, 0x05789cd1, 0x05789d51, 0x0579238e, 0x0579280a, 0x05796759,
+    0x057967d9, 0x05796959, 0x0579e0d5, 0x0579e155, 0x0579e2d5, 0x0579e77d, 0x057a0951, 0x057a09ea,
+    0x057a0b51, 0x057a176a, 0x057a21fd, 0x057accce, 0x057c7ddd, 0x057cac11, 0x057cfddd, 0x057cff76,
+    0x057d1176, 0x057d39dd, 0x057ee3d5, 0x057ee555, 0x057ef755, 0x057f0c51, 0x057f0df6, 0x057f4851,
+    0x05803185, 0x05803551, 0x058036d1, 0x05804749, 0x05804a45, 0x05804ac1, 0x05806fc9, 0x058072c5,
+    0x058086a1, 0x058086c1, 0x05808835, 0x058088a1, 0x05809aa9, 0x05809c35, 0x0580c2a1, 0x0580c321,
+    0x0580c4a1, 0x058105fd, 0x05812e76, 0x05820959, 0x05820f76, 0x05822689, 0x05822fd9, 0x05823159,
+    0x058231d9, 0x05823659, 0x05823a09, 0x05824359, 0x058243d9, 0x05824559, 0x058249d9, 0x05832585,
+    0x05832955, 0x05832ad5, 0x05833cd5, 0x05835acd, 0x058363c9, 0x05836e76, 0x05837149, 0x05837776,
+    0x0583954d, 0x058396cd, 0x05839949, 0x058399c9, 0x05839fc9, 0x0583a8ce, 0x05851005, 0x058523a9,
+    0x05852529, 0x05854c15, 0x058596a9, 0x05859836, 0x05859d29, 0x05859eb6, 0x0585c5a9, 0x0585c729,
+    0x0585c949, 0x0585d2a9, 0x0585d329, 0x0585d4a9, 0x0585d929, 0x05864776, 0x05865076, 0x05866e4d,
+    0x058681ce, 0x05869b49, 0x05869e45, 0x05869ec1, 0x0586b215, 0x0586b241, 0x0586b395, 0x0586b415,
+    0x0586c615, 0x0586c795, 0x0586da91, 0x0586dac1, 0x0586dc35, 0x0586dc91, 0x0586ef85, 0x0586f081,
+    0x0586f7bd, 0x05870385, 0x05870529, 0x05871691, 0x05871711, 0x05871891, 0x05872ba9, 0x05872d29,
+    0x05872da9, 0x0587323d, 0x058733bd, 0x058735c9, 0x05873f29, 0x05873fa9, 0x05874129, 0x058745bd,
+    0x05876815, 0x05876bfd, 0x0587a529, 0x0587a6b6, 0x0587a729, 0x0587abbd, 0x0587ad36, 0x0587af76,
+    0x0587b8b6, 0x0587b929, 0x0587bab6, 0x0587bf36, 0x0587e129, 0x0587e1a9, 0x0587e329, 0x0587e7bd,
+    0x05885b59, 0x05885cf6, 0x05886376, 0x05886f59, 0x058870f6, 0x05887576, 0x05888e09, 0x05889759,
+    0x058897d9, 0x05889959, 0x05889dd9, 0x05898c55, 0x058990d5, 0x0589c0cd, 0x0589c276, 0x0589c4f6,
+    0x0589c549, 0x0589cb76, 0x0589fcce, 0x058b50b6, 0x058b7129, 0x058b72a9, 0x058b77a9, 0x058b7929,
+    0x058b8529, 0x058b86a9, 0x058b8b29, 0x058b9f51, 0x058beaa9, 0x058bec36, 0x058bf129, 0x058bf2b6,
+    0x058bfea9, 0x058c0036, 0x058c04b6, 0x058c26a9, 0x058c2729, 0x058c28a9, 0x058c2d29, 0x058cd5ce,
+    0x058d5729, 0x058d58b6, 0x058d5f36, 0x058d6b2a, 0x058d6cb6, 0x058d9329, 0x058d93a9, 0x058d9529,
+    0x058d99bd, 0x058e0cb6, 0x058e0d29, 0x058e0eb6, 0x058e1336, 0x058e6f4a, 0x058e70c6, 0x058e82c5,
+    0x058e8615, 0x058e8695, 0x058e8815, 0x058e8c99, 0x058ef88e, 0x058efd0a, 0x058efe86, 0x058f2e91,
+    0x058f805e, 0x058f81de, 0x058f93ea, 0x058fb5e1, 0x058fb675, 0x058fb7dd, 0x058fbc5d, 0x058ff00a,
+    0x05902f5d, 0x05902fdd, 0x05903161, 0x05909491, 0x05909511, 0x05909691, 0x05909b19, 0x0590bc06,
+    0x0590bc82, 0x0590e65a, 0x0590e7da, 0x0590ecda, 0x0590ee5a, 0x0590fa59, 0x0590fbd9, 0x05910059,
+    0x05912261, 0x059122f5, 0x05912459, 0x059128d9, 0x05915fd6, 0x05916156, 0x05916656, 0x059167d6,
+    0x059173d5, 0x05917555, 0x059179d5, 0x05918852, 0x059189d2, 0x05918ed2, 0x05919052, 0x0591c651,
+    0x0591cad1, 0x05921555, 0x059215d5, 0x05921761, 0x05923dd1, 0x05923e51, 0x0592c90a, 0x05930859,
+    0x059308d9, 0x05930a59, 0x059381d5, 0x05938255, 0x059383d5, 0x0593887d, 0x0593aa51, 0x0593aaea,
+    0x0593ac51, 0x0594e80d, 0x0594e98d, 0x0594ec09, 0x0594ec89, 0x0594ef85, 0x0594f299, 0x0595000a,
+    0x05950186, 0x05952289, 0x05952bd9, 0x05952d59, 0x05952dd9, 0x05953259, 0x059533d9, 0x05953f59,
+    0x05953fd9, 0x05954159, 0x059545d9, 0x05955e89, 0x05956485, 0x059567d9, 0x05956875, 0x059569d9,
+    0x05956e59, 0x0595a805, 0x0595abea, 0x0595ad55, 0x0595bf55, 0x0595e65e, 0x0595f9c9, 0x05962249,
+    0x05965785, 0x05965ad5, 0x05965b55, 0x05965cd5, 0x0596914d, 0x05969549, 0x059695c9, 0x0596a4ce,
+    0x0596a94a, 0x0596cd4e, 0x0596d1ca, 0x05972555, 0x059725d5, 0x05972755, 0x05972bd9, 0x05981929,
+    0x05981aa9, 0x05982129, 0x05984329, 0x05984835, 0x059849a9, 0x05985529, 0x059855b5, 0x05985729,
+    0x05985ba9, 0x0598bb29, 0x0598bca9, 0x0598bd29, 0x0598cea9, 0x0598cf29, 0x0598d0a9, 0x0598f729,
+    0x0598f7b5, 0x0598f929, 0x059933d5, 0x05993455, 0x059935d5, 0x05996a4d, 0x0599a64e, 0x0599aaca,
+    0x0599ec15, 0x0599ee7d, 0x059a27a9, 0x059a2805, 0x059a2929, 0x059a29a9, 0x059a2e3d, 0x059a2fbd,
+    0x059a3b29, 0x059a3baa, 0x059a3d29, 0x059a41bd, 0x059a63a9, 0x059a6435, 0x059a65a9, 0x059a6a3d,
+    0x059a9dca, 0x059add29, 0x059adda9, 0x059adf29, 0x059b4f8e, 0x059b540a, 0x059b9369, 0x059b93ea,
+    0x059b9569, 0x059c136a, 0x059c435e, 0x059c44de, 0x059c4dde, 0x059cf8ce, 0x059cfd4a, 0x059d6406,
+    0x059d7969, 0x059d79e9, 0x059d7b69, 0x059db45a, 0x059e21ea, 0x059e812a, 0x059e82a9, 0x059e872a,
+    0x059eab29, 0x059eafa9, 0x059f22a9, 0x059f2329, 0x05a08f29, 0x05a08faa, 0x05a09129, 0x05a2ef7a,
+    0x05a302fa, 0x05a45bd9, 0x05a46f61, 0x05a4fdfa, 0x05a57f7e, 0x05aa9dbd, 0x05ab1715, 0x05ab8185,
+    0x05ab953a, 0x05ab96a5, 0x05abbda6, 0x05ac0825, 0x05ac09a5, 0x05ac0ebe, 0x05ac103e, 0x05ac4425,
+    0x05ac44a5, 0x05ac4625, 0x05ac4aa5, 0x05adb0ba, 0x05adb13a, 0x05adb2a5, 0x05add995, 0x05ae2c3e,
+    0x05b11751, 0x05b117d1, 0x05b1c0ba, 0x05b1e2ba, 0x05b1f6ba, 0x05b20c51, 0x05b210e5, 0x05b25c25,
+    0x05b25da5, 0x05b262be, 0x05b271be, 0x05b2763e, 0x05b29825, 0x05b298a5, 0x05b29a25, 0x05b29ea5,
+    0x05b3c8ba, 0x05b3cf3a, 0x05b3dcba, 0x05b3e2ba, 0x05b404ba, 0x05b4053a, 0x05b406a5, 0x05b47e25,
+    0x05b47ebe, 0x05b4803e, 0x05b7d395, 0x05b7fc11, 0x05b90121, 0x05b914a1, 0x05b9dd49, 0x05b9e045,
+    0x05b9f439, 0x05b9f441, 0x05b9f595, 0x05b9f615, 0x05ba0839, 0x05ba0995, 0x05ba1cb9, 0x05ba1ebd,
+    0x05ba3185, 0x05ba3281, 0x05ba58b9, 0x05ba5939, 0x05ba5a91, 0x05bb6a81, 0x05bb6c01, 0x05bb6d4d,
+    0x05bb6dcd, 0x05bb71c9, 0x05bb7249, 0x05bb7345, 0x05bba63d, 0x05bba7f5, 0x05bba87d, 0x05bba945,
+    0x05bbadc5, 0x05bbb199, 0x05bbb335, 0x05bbb3bd, 0x05bbb7b5, 0x05bbb83d, 0x05bbda19, 0x05bbdc19,
+    0x05bbed99, 0x05bbee19, 0x05bc1915, 0x05bc1f95, 0x05bc2149, 0x05bc21c9, 0x05bc22f9, 0x05bc2745,
+    0x05bc2b39, 0x05bc2c95, 0x05bc2d15, 0x05bc3139, 0x05bc31b9, 0x05bc4191, 0x05bc6139, 0x05bc62b5,
+    0x05bc633d, 0x05bc6589, 0x05bc6885, 0x05bc89b9, 0x05bc8b8d, 0x05bc8e09, 0x05bc9d39, 0x05bc9db9,
+    0x05bca189, 0x05bca209, 0x05bd12be, 0x05bd203e, 0x05bd481d, 0x05bd8a15, 0x05bd8b95, 0x05bd8c15,
+    0x05bd8dc9, 0x05bd8e49, 0x05bd8f45, 0x05bd93c5, 0x05bd9795, 0x05bd9915, 0x05bd9995, 0x05bd9d95,
+    0x05bd9e15, 0x05bdb291, 0x05bdb435, 0x05bdcd8d, 0x05bdcf35, 0x05bdcfbd, 0x05bdd209, 0x05bdd8bd,
+    0x05bdf60d, 0x05bdf80d, 0x05bdfa89, 0x05be098d, 0x05be0a0d, 0x05be0e09, 0x05be0e89, 0x05be2791,
+    0x05be2c39, 0x05be2d91, 0x05be4739, 0x05be488d, 0x05be490d, 0x05be4b89, 0x05be4e85, 0x05be5209,
+    0x05be8189, 0x05be8cf5, 0x05be9179, 0x05be92f5, 0x05be937d, 0x05beaa09, 0x05beb575, 0x05beb9f9,
+    0x05bebb75, 0x05bebbf5, 0x05bebd89, 0x05bebe09, 0x05bec779, 0x05bec8f5, 0x05bec975, 0x05becd79,
+    0x05becdf9, 0x05becf75, 0x05bf357d, 0x05bf40f5, 0x05bf6975, 0x05bf6b75, 0x05bf6ff5, 0x05bf7175,
+    0x05bf7cf5, 0x05bf7d75, 0x05bff93e, 0x05c04839, 0x05c04841, 0x05c04991, 0x05c04a11, 0x05c05a09,
+    0x05c05d05, 0x05c05e01, 0x05c07105, 0x05c08289, 0x05c08585, 0x05c08681, 0x05c09b75, 0x05c0a1fe,
+    0x05c0ad79, 0x05c0aef5, 0x05c0af7d, 0x05c0d5f9, 0x05c0d775, 0x05c0d7f5, 0x05c0dc7e, 0x05c0e979,
+    0x05c0e9f9, 0x05c0eb75, 0x05c14abe, 0x05c1517d, 0x05c153be, 0x05c155fe, 0x05c1613e, 0x05c18bf5,
+    0x05c18d75, 0x05c57216, 0x05c5c311, 0x05c70179, 0x05c7037d, 0x05c73d79, 0x05c73df9, 0x05c73f75,
+    0x05c88161, 0x05c8a9d9, 0x05c99ed5, 0x05ca6761, 0x05cab851, 0x05cb5b3a, 0x05cb5ca1, 0x05cb61ba,
+    0x05cb633e, 0x05cb83ba, 0x05cb8521, 0x05cb8ba1, 0x05cb973a, 0x05cb9921, 0x05cb9dba, 0x05cbad51,
+    0x05cbfd21, 0x05cbfea1, 0x05cc10a1, 0x05cc113e, 0x05cc12be, 0x05cc3921, 0x05cc3b21, 0x05cd69ba,
+    0x05cd6b21, 0x05cd703a, 0x05cd7d3a, 0x05cd7dba, 0x05cd7f3e, 0x05cd83ba, 0x05cda5ba, 0x05cda7a1,
+    0x05ce1f21, 0x05ce1fbe, 0x05ce213e, 0x05cfcfba, 0x05d0561d, 0x05d14919, 0x05d1f3f5, 0x05d23c15,
+    0x05d32f19, 0x05d39585, 0x05d39bba, 0x05d3d3fd, 0x05d40ff5, 0x05d487fd, 0x05d4f79a, 0x05d500d5,
+    0x05d50156, 0x05d502d5, 0x05d5075a, 0x05d5734e, 0x05d5b256, 0x05d5bb56, 0x05d5fc9e, 0x05d608ba,
+    0x05d60a3e, 0x05d60eba, 0x05d6274a, 0x05d630ba, 0x05d6329d, 0x05d6373a, 0x05d6664e, 0x05d6aa1d,
+    0x05d6aabe, 0x05d6ac3e, 0x05d70e02, 0x05d70f51, 0x05d70fd6, 0x05d71151, 0x05d715da, 0x05d736c6,
+    0x05d7753e, 0x05d776be, 0x05d77b3e, 0x05d787c6, 0x05d79d19, 0x05d79db5, 0x05d79f19, 0x05d7a399,
+    0x05d7eeba, 0x05d7f015, 0x05d7f4ba, 0x05d84111, 0x05d845ba, 0x05d87ac6, 0x05d89015, 0x05d89095,
+    0x05d89215, 0x05d8b891, 0x05d8b93e, 0x05d93f4e, 0x05d98319, 0x05d983be, 0x05d9853e, 0x05d9f34a,
+    0x05d9fcba, 0x05d9fd3a, 0x05d9fe95, 0x05da033a, 0x05da253a, 0x05da25ba, 0x05da273e, 0x05da333a,
+    0x05da34be, 0x05da3dbe, 0x05da6f0e, 0x05db524a, 0x05db53c6, 0x05db65c5, 0x05db6915, 0x05db6995,
+    0x05db6b15, 0x05db6f99, 0x05dbdb8e, 0x05dbe00a, 0x05dbe186, 0x05dc635e, 0x05dc64de, 0x05dc76dd,
+    0x05dc98fd, 0x05dc9961, 0x05dc9add, 0x05dc9f5d, 0x05dcd30a, 0x05dd125d, 0x05dd12dd, 0x05dd1479,
+    0x05dd7791, 0x05dd7811, 0x05dd7991, 0x05dd7e19, 0x05dd9f06, 0x05dd9f82, 0x05ddc95a, 0x05ddcada,
+    0x05ddcfda, 0x05ddd15a, 0x05dddd59, 0x05ddded9, 0x05dde359, 0x05de057d, 0x05de05e1, 0x05de0759,
+    0x05de0bd9, 0x05de42d6, 0x05de4456, 0x05de4956, 0x05de4ad6, 0x05de56d5, 0x05de5855, 0x05de5cd5,
+    0x05de6b52, 0x05de6cd2, 0x05de71d2, 0x05de7352, 0x05dea951, 0x05deadd1, 0x05def855, 0x05def8d5,
+    0x05defa79, 0x05df20d1, 0x05df2151, 0x05dfac0a, 0x05dfeb59, 0x05dfebd9, 0x05dfed59, 0x05e064d5,
+    0x05e06555, 0x05e066d5, 0x05e06b7d, 0x05e08d51, 0x05e08dd1, 0x05e08f51, 0x05e1cb0d, 0x05e1cc8d,
+    0x05e1cf09, 0x05e1cf89, 0x05e1d285, 0x05e1d589, 0x05e1e30a, 0x05e1e486, 0x05e20ed9, 0x05e21059,
+    0x05e210d9, 0x05e21559, 0x05e216d9, 0x05e22259, 0x05e222d9, 0x05e22459, 0x05e228d9, 0x05e24189,
+    0x05e24785, 0x05e24afd, 0x05e24b59, 0x05e24cd9, 0x05e25159, 0x05e29055, 0x05e33a85, 0x05e33dd5,
+    0x05e33e55, 0x05e33ff9, 0x05e34465, 0x05e3744d, 0x05e37849, 0x05e378c9, 0x05e387ce, 0x05e3b04e,
+    0x05e3b4ca, 0x05e40855, 0x05e408d5, 0x05e40a55, 0x05e40ed5, 0x05e4fc25, 0x05e4fda5, 0x05e502a5,
+    0x05e50425, 0x05e5263d, 0x05e52b25, 0x05e52ca5, 0x05e5383d, 0x05e538a5, 0x05e53a25, 0x05e53ea5,
+    0x05e59e25, 0x05e59fb9, 0x05e5a039, 0x05e5b1a5, 0x05e5b225, 0x05e5b3b9, 0x05e5b825, 0x05e5da3d,
+    0x05e5daa5, 0x05e5dc39, 0x05e616d5, 0x05e61755, 0x05e618d5, 0x05e61d7d, 0x05e6894e, 0x05e68dca,
+    0x05e70aa5, 0x05e70c25, 0x05e70ca5, 0x05e7113d, 0x05e712bd, 0x05e71e25, 0x05e71ea5, 0x05e72025,
+    0x05e724bd, 0x05e746bd, 0x05e74725, 0x05e748a5, 0x05e74d3d, 0x05e780ca, 0x05e7c025, 0x05e7c0a5,
+    0x05e7c239, 0x05e8328e, 0x05e8370a, 0x05e87665, 0x05e876e5, 0x05e87865, 0x05e8f665, 0x05e9265e,
+    0x05e930de, 0x05e9dbce, 0x05ea4706, 0x05ea5c65, 0x05ea5ce5, 0x05ea5e65, 0x05eb04e5, 0x05eb6425,
+    0x05eb65a5, 0x05eb6a25, 0x05eb8e25, 0x05eb92a5, 0x05ec05a5, 0x05ec0625, 0x05ed7225, 0x05ed72a5,
+    0x05ed7425, 0x05ef1bd9, 0x05f014d5, 0x05f0d8e1, 0x05f12a51, 0x05f1cca1, 0x05f1ce36, 0x05f1d321,
+    0x05f1d4b6, 0x05f1f53d, 0x05f1fba1, 0x05f1fd21, 0x05f20921, 0x05f20aa1, 0x05f20f21, 0x05f22351,
+    0x05f26ea1, 0x05f27521, 0x05f276b6, 0x05f28236, 0x05f282a1, 0x05f288b6, 0x05f2ab21, 0x05f2b121,
+    0x05f3db21, 0x05f3dcb6, 0x05f3eeb6, 0x05f3ef21, 0x05f3f0b6, 0x05f417a1, 0x05f490b6, 0x05f49121,
+    0x05f49736, 0x05f542cd, 0x05f54bc9, 0x05f55676, 0x05f55949, 0x05f55f76, 0x05f57d4d, 0x05f57ecd,
+    0x05f581c9, 0x05f587c9, 0x05f590ce, 0x05f6141d, 0x05f63abd, 0x05f63c3d, 0x05f63c9d, 0x05f6411d,
+    0x05f64e3d, 0x05f64e9d, 0x05f6501d, 0x05f6549d, 0x05f67ac9, 0x05f6aac9, 0x05f6b41d, 0x05f6b639,
+    0x05f6ba9d, 0x05f6bc36, 0x05f6be76, 0x05f6c7b6, 0x05f6c81d, 0x05f6ce36, 0x05f6e6c9, 0x05f6f03d,
+    0x05f6f09d, 0x05f6f239, 0x05f6f69d, 0x05f7babd, 0x05f836f5, 0x05f863f5, 0x05f86575, 0x05f8ad95,
+    0x05f8b415, 0x05f8dd75, 0x05f9200e, 0x05f98f19, 0x05f993bd, 0x05f9a119, 0x05f9c999, 0x05f9cb19,
+    0x05f9cfbd, 0x05fa4375, 0x05fa5775, 0x05fa8c8e, 0x05fac2bd, 0x05faf28d, 0x05faf975, 0x05fb2e8e,
+    0x05fb6909, 0x05fb7255, 0x05fb72d5, 0x05fb7455, 0x05fb78d5, 0x05fba8cd, 0x05fbaa76, 0x05fbacf6,
+    0x05fbad49, 0x05fbb376, 0x05fbe4ce, 0x05fbe94a, 0x05fc661e, 0x05fc7a1d, 0x05fc7bb6, 0x05fc8036,
+    0x05fca23d, 0x05fca29d, 0x05fca41d, 0x05fca89d, 0x05fcd7ce, 0x05fcdc4a, 0x05fd1276, 0x05fd1bb6,
+    0x05fd1c1d, 0x05fd1db6, 0x05fd2236, 0x05fd7f81, 0x05fd80d1, 0x05fd8151, 0x05fd82d1, 0x05fd8751,
+    0x05fda846, 0x05fda8c2, 0x05fde699, 0x05fde836, 0x05fdecb6, 0x05fdf946, 0x05fdf9c2, 0x05fe0ebd,
+    0x05fe0f19, 0x05fe1099, 0x05fe1519, 0x05fe6015, 0x05fe6195, 0x05fe6615, 0x05feb111, 0x05feb291,
+    0x05feb711, 0x05feec46, 0x05feecc2, 0x05ff0195, 0x05ff0215, 0x05ff03b9, 0x05ff0815, 0x05ff2a36,
+    0x05ff2a91, 0x05ff30b6, 0x05ffb0ce, 0x05ffb54a, 0x05fff4b6, 0x05fff519, 0x05fff6b6, 0x05fffb36,
+    0x06006e15, 0x06006e95, 0x06007015, 0x060074bd, 0x060096b6, 0x06009711, 0x060098b6, 0x0600af36,
+    0x0601d80a, 0x06021761, 0x060217e1, 0x06021961, 0x06029761, 0x0603fd61, 0x0603fde1, 0x0603ff61,
+    0x0604a5e1, 0x06050521, 0x060506a1, 0x06050b21, 0x06052f21, 0x060533a1, 0x0605a6a1, 0x0605a721,
+    0x06071321, 0x060713a1, 0x06071521, 0x06083f85, 0x060842d5, 0x06084355, 0x060844d5, 0x06084959,
+    0x0608794d, 0x06087d49, 0x06087dc9, 0x0608b54e, 0x0608b9ca, 0x0608f44d, 0x0608fd49, 0x0609369e,
+    0x0609381e, 0x0609389e, 0x06093d1e, 0x06093e9e, 0x06094a1d, 0x06094a9d, 0x06094c1d, 0x0609509d,
+    0x060972bd, 0x06097335, 0x0609749d, 0x0609791d, 0x0609acca, 0x0609ec1d, 0x0609ec9d, 0x0609ee39,
+    0x060a5151, 0x060a51d1, 0x060a5351, 0x060a57d9, 0x060ab699, 0x060ab719, 0x060ab899, 0x060abd19,
+    0x060adf3d, 0x060adfb5, 0x060ae119, 0x060ae599, 0x060b3015, 0x060b3095, 0x060b3215, 0x060b3695,
+    0x060b8311, 0x060b8791, 0x060bd215, 0x060bd295, 0x060bd439, 0x060bfa91, 0x060bfb11, 0x060c85ca,
+    0x060cc519, 0x060cc599, 0x060cc719, 0x060d3e95, 0x060d3f15, 0x060d4095, 0x060d453d, 0x060d6711,
+    0x060d6791, 0x060d6911, 0x06172dc9, 0x06173915, 0x06173d95, 0x06173dc1, 0x06173f15, 0x06173f95,
+    0x061741c9, 0x06174c95, 0x06174d15, 0x06175115, 0x06175195, 0x06176f0e, 0x06177b06, 0x0617810d,
+    0x0617830d, 0x06178589, 0x06178885, 0x06178d05, 0x0617e88e, 0x0617f486, 0x0617fc8d, 0x06180509,
+    0x06183509, 0x06184065, 0x06184105, 0x061844e1, 0x06184501, 0x06184665, 0x061846e1, 0x06185d89,
+    0x061868e5, 0x06186985, 0x06186d61, 0x06186d81, 0x06186ee1, 0x06186f61, 0x06187c65, 0x06187ce5,
+    0x061880e1, 0x06188161, 0x0618d709, 0x0618e261, 0x0618e305, 0x0618e6e1, 0x0618e701, 0x0618e865,
+    0x0618e8e1, 0x0618f461, 0x0618f5e5, 0x0618fa65, 0x0618fae1, 0x0618fc65, 0x06191ce1, 0x06191e6a,
+    0x06191ee1, 0x061922e1, 0x06192361, 0x061924e1, 0x061930e1, 0x061959c1, 0x06195b15, 0x06195b95,
+    0x06196015, 0x06199705, 0x06199801, 0x061a1085, 0x061a1181, 0x061a1409, 0x061a1601, 0x061a1705,
+    0x061a1781, 0x061a4389, 0x061a4ee1, 0x061a4f85, 0x061a5361, 0x061a5381, 0x061a54e5, 0x061a5561,
+    0x061a60e5, 0x061a62e5, 0x061a66e5, 0x061a68e5, 0x061a8965, 0x061a8ae1, 0x061a8b61, 0x061a8f7e,
+    0x061a8fe1, 0x061a9161, 0x061a9d65, 0x061b0465, 0x061b04e1, 0x061b1865, 0x061b40e1, 0x061d8d11,
+    0x061d8dc5, 0x061d9191, 0x061d9311, 0x061d9391, 0x061d9a8e, 0x061da38a, 0x061da686, 0x061dae0d,
+    0x061dae8d, 0x061db405, 0x061db885, 0x061dcc0a, 0x061dcf06, 0x061df259, 0x061df6d9, 0x061df865,
+    0x061df8d9, 0x061e1ad9, 0x061e1f59, 0x061e20d9, 0x061e2171, 0x061e2e59, 0x061e2ed9, 0x061e32d9,
+    0x061e3359, 0x061e458a, 0x061e6be5, 0x061e6c85, 0x061e7055, 0x061e71d5, 0x061e7255, 0x061ea1ce,
+    0x061eaaca, 0x061eadc6, 0x061ec2d1, 0x061eca4e, 0x061ed34a, 0x061ed646, 0x061f2155, 0x061f21d5,
+    0x061f25d5, 0x061f2655, 0x061f27d5, 0x061f43ce, 0x061f4cca, 0x061f4fc6, 0x061fa9c5, 0x061fad91,
+    0x061faf11, 0x061faf91, 0x061fb411, 0x061fbf89, 0x061fc285, 0x061fe809, 0x061feb05, 0x062000d9,
+    0x062012d9, 0x06201465, 0x062014d9, 0x06201959, 0x06203b59, 0x06203cd9, 0x06203d71, 0x062041f1,
+    0x06206189, 0x06206581, 0x06206809, 0x06206a01, 0x06206b05, 0x06206b81, 0x06207a55, 0x06207ed5,
+    0x06208055, 0x062080f1, 0x06208c65, 0x06208dd5, 0x06208e55, 0x06209255, 0x062092d5, 0x06209455,
+    0x0620a2d1, 0x0620a751, 0x0620a8e5, 0x0620a951, 0x0620b04e, 0x0620b94a, 0x0620bc46, 0x0620ded1,
+    0x062143d6, 0x06240215, 0x0624028d, 0x06240515, 0x06240815, 0x06240c85, 0x062418b2, 0x06241909,
+    0x06244659, 0x06244ad9, 0x06244cd9, 0x06245872, 0x06245a69, 0x06245ed9, 0x06246065, 0x062480d9,
+    0x06248259, 0x062482d9, 0x062486d9, 0x06248759, 0x062494d9, 0x06249659, 0x06249ad9, 0x0624b495,
+    0x0624c095, 0x0624c455, 0x0624c655, 0x0624c832, 0x0624c889, 0x0624d372, 0x0624d3e5, 0x0624d7f2,
+    0x0624d855, 0x0624d9d5, 0x062507f2, 0x062509cd, 0x06250c72, 0x06250f72, 0x062513f2, 0x0625304d,
+    0x062531cd, 0x062534e5, 0x062537e5, 0x06253ac9, 0x06253c45, 0x0625a9cd, 0x0625ab65, 0x0625ae49,
+    0x0627164d, 0x062717e5, 0x06271ac9, 0x062720e5, 0x06272245, 0x062a7706, 0x062a8499, 0x062a8905,
+    0x062ac2d9, 0x062ac759, 0x062ac959, 0x062aeb59, 0x062aefd9, 0x062af159, 0x062af1d9, 0x062afed9,
+    0x062aff59, 0x062b0359, 0x062b03d9, 0x062b3d05, 0x062b40d5, 0x062b4255, 0x062b42d5, 0x062b724e,
+    0x062b7b4a, 0x062b7e46, 0x062b9ace, 0x062ba3ca, 0x062ba6c6, 0x062bae4d, 0x062bb749, 0x062bf1d5,
+    0x062bf255, 0x062bf655, 0x062bf6d5, 0x062bf855, 0x062c144e, 0x062c1d4a, 0x062c2046, 0x062c2dc5,
+    0x062c9305, 0x062cd159, 0x062ce559, 0x062d0d59, 0x062d0dd9, 0x062d1259, 0x062d4af1, 0x062d4f55,
+    0x062d50d5, 0x062d5155, 0x062d62d5, 0x062d6355, 0x062d64d5, 0x062d80ce, 0x062d89ca, 0x062d8cc6,
+    0x062dc9c1, 0x062e00d5, 0x062e1456, 0x0630c80a, 0x0630ee6d, 0x0630f2d5, 0x0630f455, 0x0630f4d5,
+    0x06314551, 0x0631a6ca, 0x063222a9, 0x06322429, 0x063224a9, 0x06325969, 0x063297a9, 0x06329c29,
+    0x06329e29, 0x0632c02a, 0x0632c4a9, 0x0632c62a, 0x0632c6b1, 0x0632d3aa, 0x0632d429, 0x0632d829,
+    0x0632d8a9, 0x0632da29, 0x0632e409, 0x0632fcd5, 0x06330ed9, 0x06331055, 0x063310d5, 0x06331555,
+    0x06332551, 0x0633615a, 0x06339ef1, 0x0633a369, 0x0633a4d5, 0x0633a551, 0x06340431, 0x063408a9,
+    0x06340aa9, 0x06341dc1, 0x06342cb1, 0x0634313e, 0x063432be, 0x06343331, 0x06344031, 0x063440b1,
+    0x063444be, 0x06344529, 0x063446a9, 0x063452d1, 0x0634a629, 0x0634aaa9, 0x0634b829, 0x0634ba29,
+    0x0634bea9, 0x0634e0a9, 0x0634e22a, 0x0634e2b1, 0x0634e6be, 0x0634e731, 0x06374259, 0x063746d5,
+    0x063748d5, 0x06375659, 0x06375ad5, 0x06375c55, 0x06378ef2, 0x0637b759, 0x0637ba59, 0x0637caf2,
+    0x0637faca, 0x063805cd, 0x06380ff2, 0x06384e32, 0x06385029, 0x063872c5, 0x063876a9, 0x06387829,
+    0x063878a9, 0x06388a32, 0x06388aa9, 0x06388c29, 0x0638e049, 0x0638eba9, 0x0638f029, 0x0638f229,
+    0x0638fdb2, 0x0638ffa9, 0x06390429, 0x06392629, 0x063927aa, 0x06392829, 0x06392c29, 0x06392ca9,
+    0x06392e29, 0x06393a29, 0x06393ba9, 0x06394029, 0x063a4cc9, 0x063a5831, 0x063a58c5, 0x063a5ca9,
+    0x063a5ea9, 0x063a9431, 0x063a94b1, 0x063a9929, 0x063a9aa9, 0x063aaca9, 0x063b0c29, 0x063b0e29,
+    0x063b2029, 0x063b4a29, 0x063ded59, 0x063dfad9, 0x063dff72, 0x063eb349, 0x063ef2e1, 0x063f94f1,
+    0x063fa261, 0x06400959, 0x06403d8d, 0x06408355, 0x0640c5c1, 0x0640fae1, 0x06410172, 0x06410ee1,
+    0x0641b0e1, 0x06444151, 0x0644b4d1, 0x06451a29, 0x06451ea9, 0x06452029, 0x064520a9, 0x064542a9,
+    0x06454729, 0x064548a9, 0x06455629, 0x064556a9, 0x06455aa9, 0x06455b29, 0x0645bc29, 0x0645c0b2,
+    0x0645c232, 0x0645ce29, 0x0645cfa9, 0x0645d432, 0x0645d4b2, 0x0645d632, 0x0645f6a9, 0x0645fcb2,
+    0x06460aa9, 0x06465d51, 0x0646b372, 0x0646c0d9, 0x0646d551, 0x064719c1, 0x064728a9, 0x06472d29,
+    0x06472ea9, 0x06473aa9, 0x06473c29, 0x06473ca9, 0x064740a9, 0x064742a9, 0x06476329, 0x064764a9,
+    0x06476531, 0x06477729, 0x0647de29, 0x0647f229, 0x06481272, 0x064ac6f2, 0x064af8d9, 0x064b81b2,
+    0x064b8229, 0x064b8632, 0x064b8829, 0x064b9ad1, 0x064ba8aa, 0x064baa2a, 0x064baaa9, 0x064bbe29,
+    0x064bc2a9, 0x064c2229, 0x064c23aa, 0x064c37aa, 0x064c3c32, 0x064c4a51, 0x064d14d9, 0x064d8ea9,
+    0x064d9029, 0x064d90a9, 0x064d94ae, 0x064db6d1, 0x0650dc8e, 0x0650e58a, 0x0650e886, 0x0650e982,
+    0x0650f08d, 0x0650f909, 0x0650f989, 0x06513459, 0x06513505, 0x065138d9, 0x06513a65, 0x06513afd,
+    0x06515cd9, 0x06516159, 0x065162d9, 0x06516359, 0x06517059, 0x065170d9, 0x065174d9, 0x06517559,
+    0x0651b3d5, 0x0651b455, 0x0651e3ce, 0x0651ecca, 0x0651efc6, 0x0651f0c2, 0x06520c4e, 0x0652154a,
+    0x06521846, 0x06521942, 0x06524fd5, 0x06525455, 0x065255d5, 0x06525655, 0x06526855, 0x065285ce,
+    0x06528eca, 0x065291c6, 0x065292c2, 0x06530485, 0x06530581, 0x06530815, 0x06530a01, 0x065342d9,
+    0x06534759, 0x065348e5, 0x065354d9, 0x06535665, 0x06535ae5, 0x06537d59, 0x06537ed9, 0x06537f59,
+    0x06538359, 0x065383d9, 0x0653915a, 0x0653bc55, 0x0653c0f9, 0x0653c101, 0x0653c255, 0x0653c2d5,
+    0x0653d055, 0x0653f24e, 0x0653fb4a, 0x0653fe46, 0x0653ff42, 0x065437c9, 0x065471d5, 0x06547255,
+    0x06547655, 0x065476d5, 0x0657398a, 0x06575fe5, 0x06576455, 0x065765d5, 0x06576655, 0x065795ce,
+    0x06579eca, 0x0657b6d1, 0x0657dac9, 0x0658184a, 0x06589439, 0x065895a5, 0x06589625, 0x06590925,
+    0x06590da5, 0x06590fbd, 0x065931a5, 0x06593625, 0x065937a5, 0x06593831, 0x06594525, 0x065945a5,
+    0x065949a5, 0x06594a25, 0x06594ba5, 0x06595589, 0x06595885, 0x06595c11, 0x06595d05, 0x06596e55,
+    0x065972d5, 0x06598059, 0x065981d5, 0x06598255, 0x06598655, 0x065986d5, 0x065996d1, 0x06599b51,
+    0x0659c17d, 0x0659e9f1, 0x065a1065, 0x065a1105, 0x065a14f9, 0x065a1655, 0x065a16d1, 0x065a26ca,
+    0x065a29c6, 0x065a3ac9, 0x065a4f4a, 0x065a75a5, 0x065a7a39, 0x065a7c3d, 0x065a9e25, 0x065aa2b9,
+    0x065aa425, 0x065aa4b1, 0x065ab1a5, 0x065ab225, 0x065ab639, 0x065ab6b9, 0x065ab825, 0x065ac451,
+    0x065b17a5, 0x065b1c25, 0x065b29a5, 0x065b2bbd, 0x065b303d, 0x065b5225, 0x065b53a5, 0x065b5431,
+    0x065b5825, 0x065b58b1, 0x065db3d5, 0x065db855, 0x065db9d5, 0x065dba55, 0x065dc772, 0x065dc7d5,
+    0x065dcbf2, 0x065dcdd5, 0x065e0072, 0x065e0372, 0x065e07f2, 0x065e25cd, 0x065e28c9, 0x065e2bc5,
+    0x065e774d, 0x065e7ff2, 0x065eaff2, 0x065ebb32, 0x065ebbf2, 0x065ebfb2, 0x065ec1bd, 0x065ed849,
+    0x065ee3a5, 0x065ee445, 0x065ee839, 0x065ee9a5, 0x065eea25, 0x065ef7a5, 0x065efbb2, 0x065efc39,
+    0x065efda5, 0x065f51c9, 0x065f5d25, 0x065f61a5, 0x065f6325, 0x065f63bd, 0x065f6f32, 0x065f75bd,
+    0x065f97a5, 0x065f9925, 0x065f99a5, 0x065f9da5, 0x065f9e25, 0x065f9fa5, 0x065faba5, 0x065fad25,
+    0x065fb1a5, 0x0660be49, 0x0660c9a5, 0x0660ca45, 0x0660ce39, 0x0660cfa5, 0x0660d03d, 0x066105a5,
+    0x06610625, 0x06610ab9, 0x06610c25, 0x066119a5, 0x06617da5, 0x06617f25, 0x06617fbd, 0x0661bba5,
+    0x066434d5, 0x06643655, 0x066436d5, 0x06646f4a, 0x0664ab49, 0x0664e8ca, 0x066564b9, 0x06656621,
+    0x066566a1, 0x06659b61, 0x0665d9a1, 0x0665de21, 0x0665e03d, 0x06660221, 0x066606a1, 0x06660821,
+    0x066608a1, 0x066615a1, 0x06661621, 0x06661a21, 0x06661aa1, 0x06661c21, 0x06663ed5, 0x06664355,
+    0x0666ba61, 0x0666fa46, 0x0666fb42, 0x06676eb1, 0x06677339, 0x066774a1, 0x06677521, 0x066782b1,
+    0x066786b9, 0x06678739, 0x066788a1, 0x0667e821, 0x0667eca1, 0x0667fa21, 0x0667fc3d, 0x066822a1,
+    0x06682421, 0x066824a1, 0x066828a1, 0x06682921, 0x066b16ad, 0x066b182d, 0x066b18ad, 0x066c5c2d,
+    0x066c92ed, 0x066c976d, 0x066cbd6d, 0x066cf82d, 0x066cfcad, 0x066d20ad, 0x066d252d, 0x066d341a,
+    0x066d349a, 0x066d389a, 0x066d391a, 0x066d4b4a, 0x066d782d, 0x066dc8ad, 0x066e2596, 0x066e7812,
+    0x066e7c92, 0x0670d859, 0x0670ff72, 0x067103f2, 0x06713db2, 0x06714232, 0x06716619, 0x06716a99,
+    0x06716c19, 0x06716c99, 0x067179b2, 0x06717a19, 0x06717e32, 0x06717e99, 0x06718019, 0x0671b7f2,
+    0x0671bd95, 0x0672158e, 0x06721e8a, 0x06723232, 0x06725915, 0x06726cb2, 0x06726d15, 0x06728191,
+    0x06728f0e, 0x0672a8b2, 0x0672ce09, 0x0672d105, 0x06738899, 0x06738d19, 0x0673fb8e, 0x0674048a,
+    0x06744109, 0x0677a772, 0x06785c21, 0x06786221, 0x067884a1, 0x06789821, 0x067898a1, 0x06790432,
+    0x067911a1, 0x06791632, 0x06791832, 0x06793f32, 0x067a70a1, 0x067a7cb9, 0x067a7e21, 0x067a7ebd,
+    0x067a82b9, 0x067a84bd, 0x067aa539, 0x067aa721, 0x067ab939, 0x067b2021, 0x067b24b2, 0x067b343d,
+    0x067da8d1, 0x067e0e19, 0x067e1419, 0x067e3699, 0x067e4a19, 0x067e4a99, 0x067e8795, 0x067f2995,
+    0x067f3d15, 0x067f5211, 0x067f5832, 0x067f8e11, 0x067f8e91, 0x067f9332, 0x06802299, 0x06803019,
+    0x06803499, 0x06807d49, 0x06808045, 0x06808141, 0x06809615, 0x0680a839, 0x0680a995, 0x0680aa15,
+    0x0680be91, 0x0680c491, 0x0680fa91, 0x0680fb11, 0x06817411, 0x068178b2, 0x06846819, 0x068475b2,
+    0x06847c3d, 0x0684ef95, 0x06852e32, 0x06855089, 0x06855385, 0x0685c70d, 0x0687338d, 0x06873c89,
+    0x068775ba, 0x068ade59, 0x0692b33a, 0x0692db3a, 0x06942425, 0x0697aa49, 0x06986525, 0x069869a5,
+    0x06991925, 0x06991aba, 0x069a85a5, 0x069f83ba, 0x069fabba, 0x06a0f4a1, 0x06a41a59, 0x06a47f99,
+    0x06a48619, 0x06a4a83e, 0x06a4bbbe, 0x06a4bc19, 0x06a4fd95, 0x06a59b3a, 0x06a5aeba, 0x06a5af3a,
+    0x06a5c3ba, 0x06a5eaba, 0x06a6a219, 0x06a70c3e, 0x06a71f95, 0x06a72015, 0x06a73491, 0x06aae799,
+    0x06b17cd9, 0x06b18a59, 0x06b398d9, 0x06b8afad, 0x06b95f2d, 0x06b9fa72, 0x06bab7bd, 0x06babe32,
+    0x06bacbad, 0x06bb6db2, 0x06be326d, 0x06bf03ad, 0x06bf112d, 0x06bfb32d, 0x06c11fad, 0x06c21515,
+    0x06c215c5, 0x06c21995, 0x06c21b15, 0x06c21b95, 0x06c22895, 0x06c22915, 0x06c229c5, 0x06c22d15,
+    0x06c22d95, 0x06c22f15, 0x06c2540a, 0x06c25706, 0x06c25d0d, 0x06c25f0d, 0x06c26189, 0x06c26485,
+    0x06c26809, 0x06c26905, 0x06c26b05, 0x06c2cd8a, 0x06c2d086, 0x06c2e109, 0x06c2e189, 0x06c2e485,
+    0x06c31c5d, 0x06c320dd, 0x06c32265, 0x06c322dd, 0x06c344dd, 0x06c3495d, 0x06c34add, 0x06c34b5d,
+    0x06c3585d, 0x06c358dd, 0x06c35cdd, 0x06c35d5d, 0x06c35edd, 0x06c4310e, 0x06c43a0a, 0x06c43d06,
+    0x06c43e02, 0x06c4450d, 0x06c44e09, 0x06c45105, 0x06c488fd, 0x06c48d59, 0x06c48f59, 0x06c4b17d,
+    0x06c4b5d9, 0x06c4b759, 0x06c4b7d9, 0x06c4c4fd, 0x06c4c57d, 0x06c4c959, 0x06c4c9d9, 0x06c4cb59,
+    0x06c50855, 0x06c508d5, 0x06c5384e, 0x06c5414a, 0x06c54446, 0x06c54542, 0x06c560ce, 0x06c569ca,
+    0x06c56cc6, 0x06c56dc2, 0x06c5a8d5, 0x06c5aa55, 0x06c5aad5, 0x06c5bcd5, 0x06c5be55, 0x06c5da4e,
+    0x06c5e34a, 0x06c5e646, 0x06c5e742, 0x06c65905, 0x06c65a01, 0x06c65c09, 0x06c65c89, 0x06c65e81,
+    0x06c69759, 0x06c69805, 0x06c69bd9, 0x06c69d65, 0x06c69de1, 0x06c6a959, 0x06c6aae5, 0x06c6ab59,
+    0x06c6af65, 0x06c6afd9, 0x06c6d1d9, 0x06c6d359, 0x06c6d3d9, 0x06c6d7d9, 0x06c6d859, 0x06c6e5da,
+    0x06c710d5, 0x06c71555, 0x06c716d5, 0x06c71755, 0x06c724d5, 0x06c72955, 0x06c72ad5, 0x06c746ce,
+    0x06c74fca, 0x06c752c6, 0x06c753c2, 0x06c7c655, 0x06c7c6d5, 0x06c7cad5, 0x06c7cb55, 0x06c86919,
+    0x06c86d91, 0x06c86f15, 0x06c86f91, 0x06c87f8a, 0x06c88a15, 0x06c88a8d, 0x06c89015, 0x06c89389,
+    0x06c89485, 0x06c8a80a, 0x06c8ce59, 0x06c8d2d9, 0x06c8d4e5, 0x06c8f6d9, 0x06c8fb59, 0x06c8fcd9,
+    0x06c8fd71, 0x06c90a59, 0x06c90ad9, 0x06c90ed9, 0x06c90f59, 0x06c910d9, 0x06c92486, 0x06c947e5,
+    0x06c94885, 0x06c94c65, 0x06c94dd5, 0x06c94e55, 0x06c97dce, 0x06c986ca, 0x06c99ed1, 0x06c9b9cd,
+    0x06c9bfe5, 0x06c9e9d5, 0x06ca1251, 0x06ca8e0a, 0x06ca9106, 0x06cab47d, 0x06cab8d5, 0x06caba55,
+    0x06cabad5, 0x06caea4e, 0x06cb0b51, 0x06cb264d, 0x06cb2c7d, 0x06cb6cca, 0x06cbe8a5, 0x06cbea25,
+    0x06cbeaa5, 0x06cbf87d, 0x06cbfcd1, 0x06cbfe55, 0x06cbfed1, 0x06cc5dbd, 0x06cc6225, 0x06cc6425,
+    0x06cc863d, 0x06cc8aa5, 0x06cc8c2a, 0x06cc8cb1, 0x06cc99bd, 0x06cc9a3d, 0x06cc9e25, 0x06cc9ea5,
+    0x06cca025, 0x06ccaa09, 0x06ccad05, 0x06ccae01, 0x06ccb015, 0x06ccb091, 0x06ccb281, 0x06ccc2d5,
+    0x06ccc755, 0x06ccc8d5, 0x06ccc971, 0x06ccd4d5, 0x06ccd655, 0x06ccd6d5, 0x06ccdb55, 0x06cceb51,
+    0x06ccec05, 0x06ccefd1, 0x06ccf1e9, 0x06cd01ca, 0x06cd15e5, 0x06cd2bd1, 0x06cd3dc9, 0x06cd64e5,
+    0x06cd6965, 0x06cd6ad5, 0x06cd6b51, 0x06cd7f42, 0x06cd8f49, 0x06cda3ca, 0x06cda7c2, 0x06cdca25,
+    0x06cdcea5, 0x06cdd0a5, 0x06cddfc9, 0x06cdf2a5, 0x06cdf725, 0x06cdf8a5, 0x06cdf931, 0x06ce04a5,
+    0x06ce0625, 0x06ce06a5, 0x06ce0aa5, 0x06ce0b25, 0x06ce0ca5, 0x06ce18d1, 0x06ce1a56, 0x06ce1ad1,
+    0x06ce1ed1, 0x06ce1f51, 0x06ce6c25, 0x06ce70a5, 0x06ce7e25, 0x06ce8025, 0x06ce8425, 0x06ce84a5,
+    0x06cea6a5, 0x06cea82a, 0x06cea8b1, 0x06ceaca5, 0x06cead31, 0x06cede0d, 0x06cede8d, 0x06cee109,
+    0x06cee405, 0x06cee885, 0x06cef20d, 0x06cef4b2, 0x06cef509, 0x06cf2259, 0x06cf26d9, 0x06cf2865,
+    0x06cf28d9, 0x06cf3472, 0x06cf365d, 0x06cf3ad9, 0x06cf3c65, 0x06cf5cd9, 0x06cf5e59, 0x06cf5ed9,
+    0x06cf62d9, 0x06cf6359, 0x06cf70d9, 0x06cf7259, 0x06cf76d9, 0x06cf9bdd, 0x06cf9c85, 0x06cfa055,
+    0x06cfa1d5, 0x06cfa255, 0x06cfaf72, 0x06cfafdd, 0x06cfb3f2, 0x06cfb455, 0x06cfb5d5, 0x06cfdaca,
+    0x06cfe3f2, 0x06cfe5cd, 0x06cfe872, 0x06cfeb72, 0x06cfeff2, 0x06d00dcd, 0x06d016c9, 0x06d08a49,
+    0x06d1087d, 0x06d10cd5, 0x06d10e55, 0x06d10ed5, 0x06d110b2, 0x06d11109, 0x06d11c7d, 0x06d12255,
+    0x06d1524d, 0x06d15b49, 0x06d17a4d, 0x06d17d7d, 0x06d1807d, 0x06d1c0ca, 0x06d1cbcd, 0x06d21432,
+    0x06d21625, 0x06d22cc9, 0x06d2383d, 0x06d238c5, 0x06d23ca5, 0x06d23e25, 0x06d23ea5, 0x06d25032,
+    0x06d250a5, 0x06d25225, 0x06d2a649, 0x06d2b1bd, 0x06d2b625, 0x06d2b7a5, 0x06d2b825, 0x06d2c3b2,
+    0x06d2ca25, 0x06d2cba5, 0x06d2ec3d, 0x06d2edbd, 0x06d2ee3d, 0x06d2f225, 0x06d2f2a5, 0x06d2f425,
+    0x06d3003d, 0x06d301bd, 0x06d30625, 0x06d37749, 0x06d412c9, 0x06d41e25, 0x06d41ec5, 0x06d422a5,
+    0x06d42425, 0x06d424a5, 0x06d43225, 0x06d43825, 0x06d45a25, 0x06d45aa5, 0x06d45f25, 0x06d460a5,
+    0x06d46e25, 0x06d472a5, 0x06d4d225, 0x06d4d3a5, 0x06d4d425, 0x06d4e625, 0x06d4e7a5, 0x06d4ec25,
+    0x06d51025, 0x06d5500a, 0x06d55306, 0x06d56095, 0x06d56395, 0x06d56409, 0x06d56505, 0x06d56705,
+    0x06d59ed9, 0x06d59f85, 0x06d5a359, 0x06d5a561, 0x06d5c759, 0x06d5cbd9, 0x06d5cd59, 0x06d5cde1,
+    0x06d5dad9, 0x06d5db59, 0x06d5df59, 0x06d5dfd9, 0x06d5e159, 0x06d61905, 0x06d61ce1, 0x06d61e55,
+    0x06d61ed5, 0x06d6574a, 0x06d65a46, 0x06d69071, 0x06d69349, 0x06d78955, 0x06d78ad5, 0x06d78b55,
+    0x06d7c3ca, 0x06d7c6c6, 0x06d7f6cd, 0x06d7fcfd, 0x06d7ffc9, 0x06d83d4a, 0x06d8b921, 0x06d8baa1,
+    0x06d8bb21, 0x06d8effd, 0x06d92e3d, 0x06d932a1, 0x06d934a1, 0x06d956bd, 0x06d95b21, 0x06d95caa,
+    0x06d95d21, 0x06d96a3d, 0x06d96abd, 0x06d96ea1, 0x06d96f21, 0x06d970a1, 0x06d99355, 0x06d997d5,
+    0x06d99955, 0x06d999e1, 0x06d9a6d5, 0x06d9a755, 0x06d9ab55, 0x06d9abd5, 0x06d9d24a, 0x06da0e49,
+    0x06da4fc2, 0x06da9ab1, 0x06da9f21, 0x06daa121, 0x06dac331, 0x06dac7a1, 0x06dac921, 0x06dac9a1,
+    0x06dad6b1, 0x06dad731, 0x06dadb21, 0x06dadba1, 0x06dadd21, 0x06db3ca1, 0x06db4121, 0x06db4ea1,
+    0x06db50a1, 0x06db5521, 0x06db7721, 0x06db78aa, 0x06db7921, 0x06db7d21, 0x06db7da1, 0x06dbcee9,
+    0x06dbd0e9, 0x06dc094a, 0x06dc2169, 0x06dc3c6a, 0x06dc4269, 0x06dc4569, 0x06dc82ca, 0x06dd0029,
+    0x06dd00a9, 0x06dd0e69, 0x06dd73a9, 0x06dd7829, 0x06dd9c2a, 0x06dda0a9, 0x06dda22a, 0x06ddaf9e,
+    0x06ddb01e, 0x06ddb41e, 0x06ddb49e, 0x06ddb61e, 0x06de6b29, 0x06de6ca9, 0x06de6d29, 0x06df5e29,
+    0x06df6029, 0x06dfb0aa, 0x06dfe769, 0x06dfebe9, 0x06dfede9, 0x06e011e9, 0x06e0264a, 0x06e04ca9,
+    0x06e05129, 0x06e06269, 0x06e07529, 0x06e079a9, 0x06e07b29, 0x06e0871a, 0x06e0889a, 0x06e0891a,
+    0x06e08d1a, 0x06e08d9a, 0x06e0cca9, 0x06e11d29, 0x06e17a16, 0x06e17c16, 0x06e18016, 0x06e18096,
+    0x06e1cc92, 0x06e1d112, 0x06e21e59, 0x06e222d5, 0x06e22455, 0x06e224d5, 0x06e23255, 0x06e236d5,
+    0x06e23855, 0x06e2544e, 0x06e2684d, 0x06e26af2, 0x06e2904d, 0x06e2a6f2, 0x06e2d6ca, 0x06e2e1cd,
+    0x06e2ebf2, 0x06e32a32, 0x06e32c1d, 0x06e3529d, 0x06e3541d, 0x06e3549d, 0x06e36231, 0x06e36632,
+    0x06e3669d, 0x06e3681d, 0x06e3c79d, 0x06e3cc1d, 0x06e3ce1d, 0x06e3d9b2, 0x06e3db9d, 0x06e3e01d,
+    0x06e4021d, 0x06e403aa, 0x06e4041d, 0x06e4081d, 0x06e4089d, 0x06e4161e, 0x06e4179e, 0x06e41c1e,
+    0x06e44e4d, 0x06e486f2, 0x06e49899, 0x06e4bf19, 0x06e4c099, 0x06e4c119, 0x06e4c2f2, 0x06e4cebd,
+    0x06e4d319, 0x06e4d499, 0x06e51032, 0x06e51215, 0x06e56a0e, 0x06e5730a, 0x06e5adbd, 0x06e5c1bd,
+    0x06e5e38e, 0x06e622bd, 0x06e625bd, 0x06e6a719, 0x06e6b499, 0x06e6dd19, 0x06e71a31, 0x06e72095,
+    0x06e72e31, 0x06e7500e, 0x06e7590a, 0x06e8c959, 0x06e8d6d9, 0x06e8db72, 0x06e9864d, 0x06e98f49,
+    0x06ebb0bd, 0x06ebb6a1, 0x06ebd93d, 0x06ebecbd, 0x06ebed3d, 0x06ec58b2, 0x06ec663d, 0x06ec6ab2,
+    0x06ec6cb2, 0x06ec93b2, 0x06ed0a49, 0x06ed5759, 0x06edc521, 0x06edd121, 0x06edd2a1, 0x06edd321,
+    0x06edd721, 0x06edd921, 0x06edf9a1, 0x06edfba1, 0x06ee0da1, 0x06ee74a1, 0x06ee7932, 0x06ee88a1,
+    0x06ef1d51, 0x06ef1dd1, 0x06ef384d, 0x06ef38cd, 0x06ef41c9, 0x06ef44c5, 0x06eff61d, 0x06effa9d,
+    0x06effc1d, 0x06effc9d, 0x06f01e9d, 0x06f0231d, 0x06f0321d, 0x06f0329d, 0x06f0369d, 0x06f0371d,
+    0x06f09e32, 0x06f0ab9d, 0x06f0b032, 0x06f0b0b2, 0x06f0b232, 0x06f16899, 0x06f16919, 0x06f1dc3d,
+    0x06f1e095, 0x06f2543d, 0x06f2acb2, 0x06f2e7b2, 0x06f35e49, 0x06f37719, 0x06f38499, 0x06f38519,
+    0x06f38919, 0x06f38999, 0x06f3ea95, 0x06f3ef15, 0x06f3fc95, 0x06f41311, 0x06f41791, 0x06f41911,
+    0x06f43d89, 0x06f44f91, 0x06f4c891, 0x06f4cd32, 0x06f58c4d, 0x06f5a2f2, 0x06f6501d, 0x06f65db2,
+    0x06f66232, 0x06f6641d, 0x06f6ff9d, 0x06f7139d, 0x06f71832, 0x06f7bc99, 0x06f7bef2, 0x06f7d099,
+    0x06f8443d, 0x06f879b2, 0x06f8a53d, 0x06f8a83d, 0x06f91b8d, 0x06f9ff51, 0x06fa880d, 0x06fa9109,
+    0x06faca29, 0x06fad0a9, 0x06fade29, 0x06fb8029, 0x06fbc18a, 0x06fbc486, 0x06fbd515, 0x06fbd589,
+    0x06fbd885, 0x06fc1059, 0x06fc1105, 0x06fc14d9, 0x06fc16fd, 0x06fc38d9, 0x06fc3d59, 0x06fc3ed9,
+    0x06fc3f61, 0x06fc4c59, 0x06fc4cd9, 0x06fc50da, 0x06fc5159, 0x06fc52d9, 0x06fc8fd5, 0x06fc9055,
+    0x06fcc8ca, 0x06fd04c9, 0x06fdfc55, 0x06fdfcd5, 0x06fe354a, 0x06fe7149, 0x06ff2c21, 0x06ff2ca1,
+    0x06ff9fbd, 0x06ffa432, 0x06ffa63d, 0x06ffc83d, 0x06ffcca1, 0x06ffce21, 0x06ffcea1, 0x06ffdbbd,
+    0x06ffdc3d, 0x06ffe032, 0x06ffe0a1, 0x06ffe221, 0x070004d5, 0x07000955, 0x07000ad5, 0x07000b61,
+    0x070018d5, 0x07001d55, 0x070043ca, 0x070046c6, 0x07007fc9, 0x07008061, 0x0700c046, 0x07010c21,
+    0x070110b9, 0x070112bd, 0x070134a1, 0x07013939, 0x07013aa1, 0x07013b21, 0x07014821, 0x070148a1,
+    0x07014cb9, 0x07014d39, 0x07014ea1, 0x0701ae21, 0x0701b2a1, 0x0701c021, 0x0701c23d, 0x0701c6bd,
+    0x0701e8a1, 0x0701ea21, 0x0701eaa1, 0x0701eea1, 0x0701ef21, 0x07023be5, 0x07024065, 0x07024265,
+    0x07027aca, 0x070292e5, 0x0702ade5, 0x0702b3e5, 0x0702b6e5, 0x0702f44a, 0x070371a5, 0x07037225,
+    0x07037fe5, 0x0703e525, 0x0703e9a5, 0x07040da5, 0x07041225, 0x070413a5, 0x0704211e, 0x0704219e,
+    0x0704259e, 0x0704261e, 0x0704279e, 0x0704dca5, 0x0704de25, 0x0704dea5, 0x0705cfa5, 0x0705d1a5,
+    0x07062225, 0x070658e5, 0x07065d65, 0x07068365, 0x070697ca, 0x07069ac6, 0x0706be25, 0x0706c2a5,
+    0x0706d3e5, 0x0706e6a5, 0x0706eb25, 0x0706eca5, 0x0706f89a, 0x0706fa1a, 0x0706fa9a, 0x0706fe9a,
+    0x0706ff1a, 0x0707114a, 0x07073e25, 0x07078ea5, 0x0707eb96, 0x0707ed96, 0x0707f196, 0x0707f216,
+    0x07083e12, 0x07084292, 0x07088fd5, 0x07089455, 0x070895d5, 0x07089655, 0x0708a372, 0x0708a3d5,
+    0x0708a7f2, 0x0708a9d5, 0x0708c5ce, 0x0708dc72, 0x0708df72, 0x0708e3f2, 0x0709484a, 0x07095bf2,
+    0x07099732, 0x070997f2, 0x07099dbd, 0x0709bf9d, 0x0709c439, 0x0709c59d, 0x0709c61d, 0x0709d39d,
+    0x0709d839, 0x0709d99d, 0x070a391d, 0x070a3d9d, 0x070a3f25, 0x070a3fbd, 0x070a51bd, 0x070a739d,
+    0x070a751d, 0x070a759d, 0x070a799d, 0x070a7a1d, 0x070a879e, 0x070a891e, 0x070a8d9e, 0x070abfcd,
+    0x070b0a3d, 0x070b2c3d, 0x070b3099, 0x070b3219, 0x070b3299, 0x070b403d, 0x070b4619, 0x070b8395,
+    0x070bdb8e, 0x070be48a, 0x070c550e, 0x070d18bd, 0x070d263d, 0x070d5319, 0x070d8b95, 0x070d9215,
+    0x070d9f95, 0x070dc18e, 0x070dca8a, 0x070e0709, 0x070f10e1, 0x070f12e1, 0x070f4b4a, 0x070f8461,
+    0x070f8761, 0x070fc4ca, 0x07104221, 0x071042a1, 0x0710b5a1, 0x0710ba21, 0x0710de21, 0x0710e2a1,
+    0x0710e421, 0x0710f19e, 0x0710f21e, 0x0710f61e, 0x0710f69e, 0x0710f81e, 0x0711ad21, 0x0711aea1,
+    0x0711af21, 0x0713b721, 0x0713bba1, 0x0713bd21, 0x0713ca9a, 0x0713cb1a, 0x0713cf1a, 0x0713cf9a,
+    0x071bb459, 0x071bb8d1, 0x071bba55, 0x071bbad1, 0x071bdb72, 0x071bde72, 0x071bdec9, 0x071bdff2,
+    0x071be1c5, 0x071c19b2, 0x071c1a72, 0x071c1e32, 0x071c203d, 0x071c4219, 0x071c4699, 0x071c4819,
+    0x071c4899, 0x071c55b2, 0x071c5619, 0x071c5a32, 0x071c5a99, 0x071c5c19, 0x071c93f2, 0x071c97b2,
+    0x071c9932, 0x071c9995, 0x071cea11, 0x071d0b32, 0x071d0e32, 0x071d3515, 0x071d5d91, 0x071e0432,
+    0x071e05b2, 0x071e0615, 0x071e5691, 0x071e71b2, 0x071e77b2, 0x071e7ab2, 0x071f33f2, 0x071f3572,
+    0x071f35f1, 0x071f43bd, 0x071f4811, 0x071f4995, 0x071f4a11, 0x071f6ab2, 0x071fa8f2, 0x071fad72,
+    0x071faf7d, 0x071fd17d, 0x071fd5f1, 0x071fd771, 0x071fd7f1, 0x071fe4f2, 0x071fe57d, 0x071fe972,
+    0x071fe9f1, 0x071feb71, 0x07200e15, 0x07201295, 0x07201415, 0x07201495, 0x072021b2, 0x07202215,
+    0x07202632, 0x07202695, 0x07203691, 0x07203b11, 0x07203d3d, 0x07207712, 0x07208909, 0x07208989,
+    0x0720b031, 0x0720b4b9, 0x0720b615, 0x0720b691, 0x07211572, 0x072119f2, 0x07211bfd, 0x07212b09,
+    0x07213df1, 0x07214279, 0x072143f1, 0x07214471, 0x07215172, 0x072151f1, 0x072155f2, 0x07215679,
+    0x072157f1, 0x07216595, 0x07216611, 0x07216a15, 0x07216a91, 0x0721b771, 0x0721bbf1, 0x0721bdfd,
+    0x0721c972, 0x0721cb7d, 0x0721cffd, 0x0721f1f1, 0x0721f371, 0x0721f3f1, 0x0721f7f1, 0x0721f871,
+    0x07223755, 0x07227a4d, 0x07228372, 0x07233e1d, 0x0723671d, 0x0723e032, 0x0723ed9d, 0x0724aab2,
+    0x0724d399, 0x0725c6b2, 0x0726b919, 0x0726c699, 0x0726cb32, 0x0726ef99, 0x0726f419, 0x07272c95,
+    0x07273315, 0x07274095, 0x0727e295, 0x0727e732, 0x072884d1, 0x07288951, 0x07288ad1, 0x07288b51,
+    0x0728a5cd, 0x0728a64d, 0x0728af49, 0x0728b245, 0x0728ea19, 0x0728ee99, 0x0728f019, 0x0728f0bd,
+    0x07291299, 0x07291719, 0x07291899, 0x07291931, 0x07292619, 0x07292699, 0x07292a9a, 0x07292b1a,
+    0x07292c9a, 0x07296395, 0x07296839, 0x07296995, 0x07296a15, 0x0729998e, 0x0729ba91, 0x0729d58d,
+    0x0729db85, 0x0729de89, 0x072a0595, 0x072a2e11, 0x072ad03d, 0x072ad495, 0x072ad615, 0x072ad695,
+    0x072b060e, 0x072b2711, 0x072b420d, 0x072b483d, 0x072b4b09, 0x072bfffd, 0x072c0479, 0x072c05f1,
+    0x072c0671, 0x072c143d, 0x072c18b2, 0x072c1a32, 0x072c1ab2, 0x072c797d, 0x072c7df2, 0x072c7f72,
+    0x072c7ff2, 0x072ca1fd, 0x072ca672, 0x072ca7f2, 0x072ca872, 0x072cb57d, 0x072cb5fd, 0x072cb9f2,
+    0x072cba72, 0x072cbbf2, 0x072cc5c9, 0x072cc8c5, 0x072cc9c1, 0x072ccd45, 0x072cce41, 0x072cde95,
+    0x072ce315, 0x072ce495, 0x072cf095, 0x072cf215, 0x072cf295, 0x072cf69a, 0x072cf71a, 0x072d0711,
+    0x072d0b91, 0x072d0d11, 0x072d31bd, 0x072d479a, 0x072d481a, 0x072d5989, 0x072d8091, 0x072d8145,
+    0x072d8539, 0x072d8691, 0x072d8711, 0x072d970a, 0x072d9a06, 0x072dab09, 0x072dbf8a, 0x072dc286,
+    0x072de5f1, 0x072dea79, 0x072debf1, 0x072dec7d, 0x072dfb89, 0x072e0e71, 0x072e12f9, 0x072e1471,
+    0x072e14f1, 0x072e2079, 0x072e21f1, 0x072e2271, 0x072e2679, 0x072e26f9, 0x072e2871, 0x072e3491,
+    0x072e3611, 0x072e3691, 0x072e3ab2, 0x072e3b32, 0x072e87f1, 0x072e8c72, 0x072e8df2, 0x072e99f1,
+    0x072e9b71, 0x072e9bfd, 0x072e9ff2, 0x072ea072, 0x072ec271, 0x072ec3f1, 0x072ec471, 0x072ec872,
+    0x072ec8f2, 0x072f4419, 0x072f51b2, 0x072f583d, 0x07300132, 0x07300a32, 0x07316db2, 0x07322b72,
+    0x07323172, 0x073231fd, 0x073253fd, 0x07325879, 0x073259f1, 0x07325a71, 0x07326772, 0x073267fd,
+    0x07326c79, 0x07326df1, 0x0732cd7d, 0x0732d1f2, 0x0732d372, 0x0732d3f2, 0x0732e0f2, 0x0732e5f2,
+    0x0732e772, 0x073307fd, 0x0733097d, 0x073309fd, 0x07330df2, 0x07330e72, 0x07330ff2, 0x07331bfd,
+    0x07331d7d, 0x073321f2, 0x073439f1, 0x07343e79, 0x07343ff1, 0x0734407d, 0x07344bf2, 0x07344d72,
+    0x07344dfd, 0x073451f2, 0x073453fd, 0x07347479, 0x073475f1, 0x07347671, 0x07347af9, 0x07347c71,
+    0x07348879, 0x073489f1, 0x07348e79, 0x0734edf1, 0x0734ef71, 0x0734effd, 0x073501fd, 0x0735037d,
+    0x073507f2, 0x07352bf1, 0x0735acd9, 0x0735c065, 0x07389821, 0x073899a5, 0x07389a21, 0x0738c0be,
+    0x0738c23e, 0x0738c2a1, 0x0738d4a1, 0x07393a21, 0x07393bba, 0x07393c3a, 0x073949ba, 0x07394e21,
+    0x07394fba, 0x073971ba, 0x0739763e, 0x0739783a, 0x073aa221, 0x073aa6a1, 0x073aa825, 0x073aa8a1,
+    0x073ab421, 0x073ab621, 0x073aba25, 0x073abaa1, 0x073abc25, 0x073adcbe, 0x073ade3e, 0x073ae2be,
+    0x073ae321, 0x073ae4a1, 0x073af0a1, 0x073b57ba, 0x073b583a, 0x073b5c25, 0x073b5ca1, 0x073b6bba,
+    0x073b943a, 0x073c73dd, 0x073c7851, 0x073cdd9d, 0x073d81ba, 0x073d8f3a, 0x073db73a, 0x073ec395,
+    0x073f14be, 0x073f8fba, 0x073f903a, 0x07405a25, 0x07405ab1, 0x07406e25, 0x0740b4c9, 0x0740b7c5,
+    0x0740b8c1, 0x0740bd41, 0x0740cd95, 0x0740d215, 0x0740e115, 0x0740e195, 0x0740e595, 0x0740e615,
+    0x0740f611, 0x0740fa91, 0x0740fc25, 0x0740fc91, 0x074130be, 0x0741323e, 0x074136be, 0x07413711,
+    0x0741abba, 0x0741ac3a, 0x0741b025, 0x0741b091, 0x0743459d, 0x0744adbd, 0x0748a8d5, 0x0748ec4d,
+    0x0748f549, 0x0748f845, 0x0749ae1d, 0x0749b01d, 0x0749d6be, 0x0749d89d, 0x0749ea3e, 0x0749ea9d,
+    0x074a523a, 0x074a5fba, 0x074a641d, 0x074a87ba, 0x074a883a, 0x074a8c9d, 0x074b1c99, 0x074b4519,
+    0x074b9415, 0x074c383a, 0x074d2b19, 0x074d3899, 0x074d3d19, 0x074d6599, 0x074da295, 0x074da495,
+    0x074db615, 0x074db695, 0x074e543a, 0x074e5895, 0x074ef659, 0x074efad1, 0x074efc55, 0x074efcd1,
+    0x074f1756, 0x074f17cd, 0x074f2055, 0x074f20c9, 0x074f23c5, 0x074f5b99, 0x074f5c45, 0x074f6019,
+    0x074f6219, 0x074f843e, 0x074f88be, 0x074f8a3e, 0x074f8ab1, 0x074f97be, 0x074f981a, 0x074f9c3e,
+    0x074f9c99, 0x074f9e1a, 0x074fd995, 0x074fdb15, 0x074fdb95, 0x0750140a, 0x07501706, 0x07502c3e,
+    0x0750473e, 0x07504d3e, 0x0750503e, 0x0750773a, 0x07508aba, 0x07509fba, 0x07514615, 0x07514795,
+    0x07514815, 0x0751808a, 0x07518386, 0x075198be, 0x0751b3be, 0x0751b9be, 0x0751bcbe, 0x075275fe,
+    0x0752777e, 0x075277f1, 0x075285ba, 0x07528a11, 0x07528bba, 0x07528c3a, 0x0752acba, 0x0752eafa,
+    0x0752ef71, 0x0752f17a, 0x0753137a, 0x075317fe, 0x0753197a, 0x075319fa, 0x075326fa, 0x0753277a,
+    0x07532b7e, 0x07532bf1, 0x07532d7a, 0x07533749, 0x07533a56, 0x07533b41, 0x07533fc1, 0x07535015,
+    0x07535495, 0x07535615, 0x075356b1, 0x07536396, 0x0753641a, 0x07536816, 0x07536895, 0x07536a15,
+    0x07537891, 0x07537d11, 0x07537f11, 0x0753a309, 0x0753b4be, 0x0753b93e, 0x0753c83e, 0x0753cb3e,
+    0x0753f231, 0x0753f691, 0x0753f815, 0x0753f891, 0x07540c82, 0x07541c89, 0x07543502, 0x07545771,
+    0x07545bf1, 0x07545df1, 0x07546a3e, 0x07546d3e, 0x07547ffe, 0x0754847e, 0x075485fe, 0x07548671,
+    0x0754937e, 0x075493f1, 0x075497fe, 0x07549871, 0x075499f1, 0x0754a616, 0x0754a7ba, 0x0754a83a,
+    0x0754ac16, 0x0754ac91, 0x0754f97a, 0x0754fdf1, 0x0754fffa, 0x07550b71, 0x07550d7a, 0x075511f1,
+    0x075533fe, 0x0755357a, 0x075539fe, 0x07553a71, 0x0758a172, 0x0758a371, 0x0758c9fe, 0x0758cb7e,
+    0x0758cbf1, 0x0758ddf1, 0x0758df71, 0x07593efa, 0x07594371, 0x0759457a, 0x075952fa, 0x07595771,
+    0x0759797e, 0x07597afa, 0x07597b7a, 0x07597f7e, 0x07597ff1, 0x0759817a, 0x07598d7d, 0x07598efa,
+    0x07599371, 0x075aab71, 0x075aaff1, 0x075ab1f1, 0x075abd72, 0x075abf71, 0x075ac3f1, 0x075aec71,
+    0x075aedf1, 0x075af9f1, 0x075afff1, 0x075b5f71, 0x075b617a, 0x075b65f1, 0x075b7371, 0x075b9d7a,
+    0x075ce81d, 0x075e549a, 0x075f4621, 0x075ff5be, 0x07614e3d, 0x076154a1, 0x07616221, 0x07620421,
+    0x07629a1a, 0x07656d7d, 0x076571f1, 0x07657371, 0x076573f1, 0x076595fe, 0x07659a7e, 0x07659bfe,
+    0x0765a97e, 0x0765a9fd, 0x0765adfe, 0x0765ae71, 0x07660f7a, 0x076613f2, 0x0766217d, 0x076622fa,
+    0x076627f2, 0x07662972, 0x076649fe, 0x07665dfd, 0x07677bf1, 0x07678071, 0x076781f1, 0x07678df1,
+    0x07678f71, 0x07678ff1, 0x076793f1, 0x07679471, 0x076795f1, 0x0767b67e, 0x0767b7fe, 0x0767ca71,
+    0x0768317a, 0x076835f2, 0x0768457a, 0x076a8f1d, 0x076b59be, 0x076bd57d, 0x076bd9f1, 0x076bdb71,
+    0x076bee11, 0x076bfbfe, 0x076bfd7e, 0x076bfdfd, 0x076c117d, 0x076c15f1, 0x076c757d, 0x076c76fa,
+    0x076c897d, 0x076c8afa, 0x076c9dbe, 0x076d6819, 0x076de1f1, 0x076de371, 0x076de3f1, 0x076df5f1,
+    0x076e0a11, 0x07713815, 0x07713895, 0x07713b95, 0x07717359, 0x07717419, 0x077177d9, 0x0771b3d9,
+    0x0771b459, 0x0771b5d9, 0x0771ecd5, 0x0771f155, 0x0771f355, 0x07723f65, 0x077240c5, 0x077241c1,
+    0x077242c5, 0x07724365, 0x077267c9, 0x07726849, 0x07726b45, 0x0772a255, 0x0772a2d5, 0x0772a6d5,
+    0x0772a755, 0x0772a8ea, 0x0772e165, 0x0772e2c5, 0x07735785, 0x077393d9, 0x077395e1, 0x07739a7e,
+    0x07740d61, 0x07740ed5, 0x07740f61, 0x0774137e, 0x077413fe, 0x0774157e, 0x07744e7e, 0x0774517e,
+    0x0774c2d5, 0x0774c355, 0x0774c4d5, 0x07778a01, 0x07778c09, 0x07778c89, 0x07778e81, 0x07778f85,
+    0x07779ed5, 0x0777a355, 0x0777a4d5, 0x0777a571, 0x0777c751, 0x0777c805, 0x0777cbd1, 0x0777cd65,
+    0x0777cdd1, 0x0777ddca, 0x077819c9, 0x07781a71, 0x07781d71, 0x077840d1, 0x07784551, 0x077846d1,
+    0x07784751, 0x07787fca, 0x0778a625, 0x0778a6c5, 0x0778aaa5, 0x0778aac1, 0x0778ac25, 0x0778aca5,
+    0x0778bbc9, 0x0778bf45, 0x0778cea5, 0x0778d325, 0x0778d341, 0x0778d4a5, 0x0778d531, 0x0778e725,
+    0x0778e8a5, 0x0778f651, 0x0778f6d1, 0x0778fad1, 0x0778fb51, 0x0778fcd1, 0x077910c1, 0x07794825,
+    0x077948c5, 0x07794ca5, 0x07794e25, 0x07795ba5, 0x07795c25, 0x07796025, 0x077960a5, 0x07796225,
+    0x0779842a, 0x077984b1, 0x077988a5, 0x07798931, 0x07798ab1, 0x0779ab85, 0x0779bf55, 0x0779c171,
+    0x0779e7d1, 0x0779e9d1, 0x0779ee7e, 0x077a6165, 0x077a62d5, 0x077a6351, 0x077a677e, 0x077a67fe,
+    0x077a697e, 0x077a7645, 0x077a8a45, 0x077a9fc1, 0x077aa27e, 0x077aa47e, 0x077aa57e, 0x077ab4a5,
+    0x077ac6a5, 0x077ac8a5, 0x077aef25, 0x077af0a5, 0x077b02a5, 0x077b0325, 0x077b04a5, 0x077b16d1,
+    0x077b1751, 0x077b18d1, 0x077b68a5, 0x077b7c25, 0x077b7ca5, 0x077b7e25, 0x077ba4a5, 0x077ba531,
+    0x077ba6b1, 0x07811aa5, 0x07811ca5, 0x07846f55, 0x078473d5, 0x078475d5, 0x0784ae4a, 0x0784ea49,
+    0x0784eac9, 0x0784edc5, 0x078576b1, 0x07857745, 0x07857b21, 0x07857b45, 0x07857d21, 0x07859f31,
+    0x0785a3a1, 0x0785a521, 0x0785a5a1, 0x0785b7a1, 0x0785b921, 0x078618a1, 0x07861945, 0x07861d21,
+    0x07862ca1, 0x07863121, 0x078654aa, 0x07865521, 0x07865921, 0x078659a1, 0x07865b21, 0x07868fd5,
+    0x078691d9, 0x0786967e, 0x07874a7e, 0x07874d7e, 0x07878bbe, 0x0787bfb1, 0x0787c131, 0x0787c7be,
+    0x07883921, 0x07883b21, 0x07884d21, 0x07887521, 0x078875a1, 0x07887721, 0x078ac351, 0x078ac7d1,
+    0x078ac955, 0x078ac9d1, 0x078b024a, 0x078b2899, 0x078b2d19, 0x078b2f19, 0x078b3e49, 0x078b5119,
+    0x078b5599, 0x078b5719, 0x078b57b1, 0x078b7fc2, 0x078ba231, 0x078ba695, 0x078ba815, 0x078ba895,
+    0x078be10a, 0x078be406, 0x078be502, 0x078bf791, 0x078bf911, 0x078bf991, 0x078c0c86, 0x078c0d82,
+    0x078c4895, 0x078c4a15, 0x078c5795, 0x078c5815, 0x078c5c15, 0x078c5c95, 0x078c5e15, 0x078c6c91,
+    0x078c7111, 0x078c830a, 0x078ca8aa, 0x078cad11, 0x078cad91, 0x078caf11, 0x078cc301, 0x078ce3d1,
+    0x078ce5d1, 0x078cea7e, 0x078d4919, 0x078d4b19, 0x078d7199, 0x078d9e7e, 0x078da17e, 0x078db0b1,
+    0x078dc2b1, 0x078dc4b1, 0x078dd931, 0x078ddfbe, 0x078e1531, 0x078e1bbe, 0x078e6495, 0x078e66b1,
+    0x078e7816, 0x078e7896, 0x078e7a16, 0x078e8d11, 0x078ec912, 0x078ec992, 0x078ecb12, 0x07939f19,
+    0x079416b1, 0x079418b1, 0x0795f58d, 0x0796b2e1, 0x0796b95d, 0x0796c6dd, 0x079768dd, 0x0797e659,
+    0x079825d9, 0x07983359, 0x0798b322, 0x0798b521, 0x079950aa, 0x07995532, 0x07995732, 0x079a41d9,
+    0x079a7f45, 0x079abd21, 0x079abda1, 0x079ac3be, 0x079ad121, 0x079af821, 0x079af9a1, 0x079b7121,
+    0x079b732a, 0x079c6b72, 0x079c78d9, 0x079dca72, 0x079e3a49, 0x079e5319, 0x079ef511, 0x079f1909,
+    0x079f1d01, 0x079f58a9, 0x079fa491, 0x079fa932, 0x079fab32, 0x079fbb32, 0x079fbf32, 0x07a00829,
+    0x07a0e715, 0x07a0e931, 0x07a10f91, 0x07a11111, 0x07a117be, 0x07a160a9, 0x07a174a9, 0x07a1c511,
+    0x07a1c711, 0x07a216b2, 0x07a2cce9, 0x07a4b92a, 0x07a4db69, 0x07a55b2a, 0x07a5aca9, 0x07a5ba29,
+    0x07a65c29, 0x07a7c8a9, 0x07aae0d5, 0x07aae6d5, 0x07aae755, 0x07ab5bc9, 0x07ab5c49, 0x07ab5f45,
+    0x07abe821, 0x07abe8c5, 0x07abecb9, 0x07abecc1, 0x07abee25, 0x07abeebd, 0x07ac10a1, 0x07ac1539,
+    0x07ac16a1, 0x07ac1721, 0x07ac24a1, 0x07ac2aa1, 0x07ac8a21, 0x07ac8ac5, 0x07ac8ea1, 0x07ac9025,
+    0x07ac9c21, 0x07ac9da5, 0x07acc4a1, 0x07acc621, 0x07acc6a1, 0x07accaa1, 0x07accb21, 0x07accca1,
+    0x07acd8a1, 0x07ad0155, 0x07ad02d5, 0x07ad0355, 0x07ad077e, 0x07adbefe, 0x07adf6a1, 0x07adfcbe,
+    0x07ae3139, 0x07ae32a1, 0x07ae3321, 0x07ae393e, 0x07ae46a1, 0x07aeaaa1, 0x07aeac25, 0x07aeb0be,
+    0x07aebe25, 0x07aee6a1, 0x07aee721, 0x07aee8a1, 0x07b134d1, 0x07b13951, 0x07b13ad1, 0x07b13b51,
+    0x07b173ca, 0x07b19a19, 0x07b19e99, 0x07b1a025, 0x07b1a0bd, 0x07b1c299, 0x07b1c719, 0x07b1c899,
+    0x07b1c931, 0x07b21395, 0x07b21839, 0x07b21995, 0x07b21a15, 0x07b2528a, 0x07b25586, 0x07b25682,
+    0x07b26491, 0x07b26a91, 0x07b26b11, 0x07b27e06, 0x07b27f02, 0x07b2b595, 0x07b2ba15, 0x07b2bb95,
+    0x07b2c915, 0x07b2c995, 0x07b2cd95, 0x07b2ce15, 0x07b2cf95, 0x07b2de11, 0x07b2e291, 0x07b2e425,
+    0x07b2f48a, 0x07b31a11, 0x07b31a91, 0x07b31e91, 0x07b31f11, 0x07b32091, 0x07b35551, 0x07b356d1,
+    0x07b35751, 0x07b35b7e, 0x07b393c1, 0x07b3a899, 0x07b3ba99, 0x07b3bc25, 0x07b3bcbd, 0x07b3e319,
+    0x07b3e499, 0x07b3e531, 0x07b412fe, 0x07b42215, 0x07b43439, 0x07b43595, 0x07b43615, 0x07b44a91,
+    0x07b48691, 0x07b48711, 0x07b48d3e, 0x07b4d615, 0x07b4d795, 0x07b4e996, 0x07b4ea16, 0x07b4eb96,
+    0x07b4fe91, 0x07b50025, 0x07b53a92, 0x07b53b12, 0x07b53c92, 0x07ba10bd, 0x07ba8839, 0x07ba8a15,
+    0x07bbfd55, 0x07bd2d1d, 0x07be9319, 0x07be9799, 0x07be9919, 0x07be9999, 0x07bf230a, 0x07bf2606,
+    0x07bf2702, 0x07bf8615, 0x07bf8a95, 0x07bf8c15, 0x07bf8c95, 0x07bf9a15, 0x07bfc50a, 0x07c03e7e,
+    0x07c07919, 0x07c0b399, 0x07c0b519, 0x07c0b599, 0x07c0ba3e, 0x07c0f93e, 0x07c1a695, 0x07c1a815,
+    0x07c1a895, 0x07c1ad3e, 0x07c24ad1, 0x07c24f51, 0x07c250d5, 0x07c25151, 0x07c2b019, 0x07c2b499,
+    0x07c2b6bd, 0x07c2d899, 0x07c2dd19, 0x07c2de99, 0x07c2df31, 0x07c2ec19, 0x07c2ec99, 0x07c2f09e,
+    0x07c2f11e, 0x07c329b1, 0x07c32e39, 0x07c32f95, 0x07c33015, 0x07c38091, 0x07c3a489, 0x07c49615,
+    0x07c49a95, 0x07c49c15, 0x07c49c95, 0x07c4ed11, 0x07c51109, 0x07c5c5f1, 0x07c5ca79, 0x07c5cbf1,
+    0x07c5cc71, 0x07c5da11, 0x07c5de91, 0x07c5e015, 0x07c5e091, 0x07c63f71, 0x07c643f1, 0x07c645fd,
+    0x07c667f1, 0x07c66c71, 0x07c66df1, 0x07c66e71, 0x07c67b71, 0x07c67bf1, 0x07c67ff1, 0x07c68071,
+    0x07c681f1, 0x07c68bc9, 0x07c68ec5, 0x07c6927e, 0x07c6937e, 0x07c6a495, 0x07c6a93e, 0x07c6aabe,
+    0x07c6b699, 0x07c6b815, 0x07c6b895, 0x07c6bcbe, 0x07c6bd3e, 0x07c6cd11, 0x07c6d1be, 0x07c6f7be,
+    0x07c70911, 0x07c746b1, 0x07c7477e, 0x07c74b3e, 0x07c74cbe, 0x07c74d3e, 0x07c7713e, 0x07c7abf1,
+    0x07c7b07e, 0x07c7b27e, 0x07c7d471, 0x07c7d8fe, 0x07c7da7e, 0x07c7dafe, 0x07c7e7f1, 0x07c7e871,
+    0x07c7ec7e, 0x07c7ecfe, 0x07c7ee7e, 0x07c7fa91, 0x07c7fc15, 0x07c7fc91, 0x07c800be, 0x07c8013e,
+    0x07c84df1, 0x07c8527e, 0x07c85ff1, 0x07c861fd, 0x07c88871, 0x07c889f1, 0x07c88a71, 0x07c88e7e,
+    0x07cbf172, 0x07cbf5f2, 0x07cbf7fd, 0x07cc19f1, 0x07cc1e79, 0x07cc1ff1, 0x07cc2071, 0x07cc2df1,
+    0x07cc3279, 0x07cc33f1, 0x07cc9371, 0x07cc97f1, 0x07cca572, 0x07cca77d, 0x07ccabfd, 0x07cccdf1,
+    0x07cccf71, 0x07cccff1, 0x07ccd3f1, 0x07ccd471, 0x07ccd5f1, 0x07cce1f1, 0x07cce371, 0x07cce7f1,
+    0x07cdfff1, 0x07ce3bf1, 0x07ce3c71, 0x07ce427e, 0x07ce4ff1, 0x07ceb3f1, 0x07ceb5fd, 0x07cec7fd,
+    0x07ceeff1, 0x07cef071, 0x07cef1f1, 0x07d19519, 0x07d25b09, 0x07d25f01, 0x07d2fd32, 0x07d33621,
+    0x07d3b119, 0x07d42b15, 0x07d7e911, 0x07d8c1f1, 0x07d8c679, 0x07d8c7f1, 0x07d8c87d, 0x07d8ea71,
+    0x07d8eef9, 0x07d8f071, 0x07d8fdf1, 0x07d8fe71, 0x07d902f9, 0x07d90471, 0x07d963f1, 0x07d96872,
+    0x07d969f2, 0x07d975f1, 0x07d97771, 0x07d977fd, 0x07d97bf2, 0x07d97c72, 0x07d97df2, 0x07d99e71,
+    0x07d99ff1, 0x07d9a472, 0x07d9b271, 0x07da0511, 0x07da7d39, 0x07dad071, 0x07dad67e, 0x07dae279,
+    0x07dae3f1, 0x07dae47d, 0x07db0af9, 0x07db0c71, 0x07db0cf1, 0x07db1e79, 0x07db1ef9, 0x07db2071,
+    0x07db8471, 0x07db85f1, 0x07db97f1, 0x07db987d, 0x07db99fd, 0x07dbc071, 0x07dd2dba, 0x07dde39d,
+    0x07de4f32, 0x07de9a19, 0x07deae19, 0x07df2df2, 0x07df2ffd, 0x07df51f1, 0x07df65f1, 0x07dfc9f1,
+    0x07dfcb71, 0x07dff211, 0x07e0bc99, 0x07e13679, 0x07e137f1, 0x07e1387d, 0x07e13c7e, 0x07e14bfd,
+    0x07e172f9, 0x07e17471, 0x07e1ebf1, 0x07e59221, 0x07e596a1, 0x07e59825, 0x07e5bf21, 0x07e5c0a1,
+    0x07e6343a, 0x07e638a6, 0x07e63a3a, 0x07e79ea1, 0x07e7dabe, 0x07e85425, 0x07e854a1, 0x07ec65ba,
+    0x07f9363a, 0x07ff37f1, 0x07ff39f1, 0x07ff607e, 0x07ff61fe, 0x07ff7471, 0x07ff75f1, 0x07ffd9f1,
+    0x07ffe97a, 0x07ffedf1, 0x0800117a, 0x08015a7e, 0x0801f5f1, 0x080209f1, 0x080231fe, 0x08059b71,
+    0x08059ff1, 0x0805c871, 0x0805c9f1, 0x080641f1, 0x08064f71, 0x0807a7f1, 0x08085df1, 0x080950e1,
+    0x080c30a1, 0x080c3e21, 0x080ce021, 0x080e4ca1, 0x080fb272, 0x08106fbd, 0x08107632, 0x0810839d,
+    0x081125b2, 0x0811f019, 0x08126bf1, 0x08127071, 0x081271f1, 0x08130d7a, 0x08131272, 0x08133411,
+    0x0813feb2, 0x08147871, 0x081479f1, 0x08148df1, 0x08152df1, 0x08152ffa, 0x081e212d, 0x081e2591,
+    0x081e2711, 0x081e2791, 0x081e3a86, 0x081e482d, 0x081e4c85, 0x081e600a, 0x081e6306, 0x081e866d,
+    0x081e8ad9, 0x081e8c65, 0x081e8ce9, 0x081eaeed, 0x081eb359, 0x081eb4d9, 0x081eb561, 0x081ec26d,
+    0x081ec2ed, 0x081ec6d9, 0x081ec759, 0x081ed98a, 0x081f0085, 0x081f0469, 0x081f05d5, 0x081f0655,
+    0x081f3eca, 0x081f41c6, 0x081f56d1, 0x081f674a, 0x081f6a46, 0x081fb569, 0x081fb5e9, 0x081fb9d5,
+    0x081fba55, 0x081fbbd5, 0x081fe0ca, 0x081fe3c6, 0x08204315, 0x08204391, 0x08204811, 0x08205685,
+    0x08207f05, 0x082094d9, 0x0820a8e9, 0x0820ad69, 0x0820d0d9, 0x0820d161, 0x0820d5e1, 0x0820fc09,
+    0x0820ff05, 0x08210e65, 0x082112e9, 0x08211455, 0x082114e1, 0x08212265, 0x08212669, 0x082126e9,
+    0x08212855, 0x082136e5, 0x08213d69, 0x0821444e, 0x08214d4a, 0x08215046, 0x082172e5, 0x0821d7d6,
+    0x0821ec65, 0x08221b66, 0x08248b8a, 0x0824b1ed, 0x0824b655, 0x0824b7d5, 0x0824b855, 0x082529ed,
+    0x08256a4a, 0x0825e629, 0x0825e7a5, 0x0825e825, 0x0825f5e9, 0x08265b29, 0x08265fa5, 0x08266125,
+    0x082661a9, 0x082683aa, 0x08268825, 0x082689aa, 0x0826972a, 0x082697a9, 0x08269ba5, 0x08269c25,
+    0x08269da5, 0x0826a789, 0x0826c055, 0x0826c8c1, 0x0826cbc1, 0x0826cd8d, 0x0826d259, 0x0826d3d5,
+    0x0826d455, 0x0826d689, 0x0826d8d5, 0x0826d985, 0x0826e8d1, 0x082724da, 0x08274299, 0x08274599,
+    0x08274dd9, 0x08275259, 0x082753d9, 0x08276265, 0x082766e9, 0x08276851, 0x082768d1, 0x0827c7a5,
+    0x0827cc29, 0x0827cda5, 0x0827ce29, 0x0827f025, 0x0827f4be, 0x0827f63e, 0x0827f8aa, 0x0827fb81,
+    0x0827fd4d, 0x082803a5, 0x08280425, 0x08280649, 0x0828083e, 0x082808a9, 0x08280945, 0x08280a25,
+    0x08283595, 0x08283895, 0x082840d5, 0x08284555, 0x082846d6, 0x082869a5, 0x08286e25, 0x08286fa5,
+    0x08287201, 0x0828752a, 0x082876fe, 0x08287ba5, 0x08287d25, 0x08287da9, 0x08287ffe, 0x082881a5,
+    0x08288229, 0x082882fe, 0x0828a425, 0x0828a5aa, 0x0828aa3e, 0x082b0a55, 0x082b0bd5, 0x082b0c55,
+    0x082b19ed, 0x082b1dd5, 0x082b1e55, 0x082b1fd5, 0x082b32d1, 0x082b3465, 0x082b59c5, 0x082b6a6d,
+    0x082bac69, 0x082badd1, 0x082bbe4a, 0x082bd1c9, 0x082bd369, 0x082c0dc5, 0x082c11a9, 0x082c1325,
+    0x082c13a9, 0x082c3645, 0x082c3a29, 0x082c3ba5, 0x082c3c25, 0x082c4da9, 0x082c4e29, 0x082c4fa5,
+    0x082c82ed, 0x082caf29, 0x082cb3a5, 0x082cb525, 0x082cb5a9, 0x082cc12d, 0x082cc725, 0x082cc7a9,
+    0x082ce9ad, 0x082ceb2a, 0x082ceba9, 0x082cefa5, 0x082cf025, 0x082cf1a5, 0x082cfd2d, 0x082cfdad,
+    0x082cff29, 0x082d03a5, 0x082d2855, 0x082d7f66, 0x082e1049, 0x082e1ba5, 0x082e1c45, 0x082e2029,
+    0x082e21a5, 0x082e2229, 0x082e57a5, 0x082e5825, 0x082e5ca9, 0x082e5e25, 0x082e7029, 0x082ecfa5,
+    0x082ed125, 0x082ed1a9, 0x082ede66, 0x082ee3a9, 0x082ee766, 0x082f0da5, 0x083186d5, 0x08318855,
+    0x083188d5, 0x0831d951, 0x08323aca, 0x0832b6a9, 0x0832b821, 0x0832b8a1, 0x0832c669, 0x0832ed69,
+    0x08332ba9, 0x08333021, 0x08333229, 0x0833542a, 0x083358a1, 0x08335a2a, 0x08335aa1, 0x083367aa,
+    0x08336829, 0x08336c21, 0x08336ca1, 0x08336e21, 0x083390d9, 0x0833a4d9, 0x0833a955, 0x0833b959,
+    0x0833f55a, 0x08343951, 0x08349ca9, 0x08349ea9, 0x0834c53e, 0x0834c6be, 0x0834c721, 0x0834d8be,
+    0x0834d929, 0x0834daa1, 0x0834e856, 0x0834e8d1, 0x0834fbc5, 0x08352445, 0x08353a21, 0x08353ea1,
+    0x08354c21, 0x08354e29, 0x083552a9, 0x083574a1, 0x0835762a, 0x083576a1, 0x08357abe, 0x08357b21,
+    0x08386899, 0x08386a19, 0x08386a99, 0x08395729, 0x08395b95, 0x0839cf2a, 0x0839d729, 0x0839e4d9,
+    0x083a4a19, 0x083a7299, 0x083a7fd9, 0x083a861a, 0x083a869a, 0x083a8a9a, 0x083a8b1a, 0x083ac995,
+    0x083aca15, 0x083b1abe, 0x083b43a9, 0x083b4cc9, 0x083b6595, 0x083b7796, 0x083b7916, 0x083b7996,
+    0x083b8e11, 0x083bca12, 0x083e2ed1, 0x083e3055, 0x083e5455, 0x083e55c5, 0x083e9419, 0x083e9629,
+    0x083ebc99, 0x083ebe19, 0x083ebe99, 0x083ed019, 0x083ed099, 0x083ed219, 0x083ee2ca, 0x083f09c5,
+    0x083f0da9, 0x083f0f15, 0x083f0f95, 0x083f480a, 0x083f6011, 0x083f708a, 0x083f8409, 0x083f8489,
+    0x083f926d, 0x083fab29, 0x083fb96d, 0x083fbd2d, 0x083fbf29, 0x083fd3a9, 0x083ff7ad, 0x08400e2d,
+    0x08400faa, 0x0840202d, 0x0840232a, 0x084033ad, 0x0840342d, 0x0840d34d, 0x0840d3cd, 0x0840da99,
+    0x0840df19, 0x08411e15, 0x08414d8e, 0x0841568a, 0x08419729, 0x084197a9, 0x0841cd95, 0x08423b49,
+    0x08423bc9, 0x084246a9, 0x08424729, 0x08424b29, 0x08424ba9, 0x0844d551, 0x0845b421, 0x08465621,
+    0x084663a9, 0x08466821, 0x08466a29, 0x0846a9c9, 0x0846acc5, 0x0846b991, 0x0846bb11, 0x0846c2a2,
+    0x0846cba2, 0x0846cea2, 0x0846d48d, 0x0846d60d, 0x0846f151, 0x0847207e, 0x0847258d, 0x0847270d,
+    0x084737a2, 0x08473aa2, 0x08474762, 0x084748e2, 0x084754d9, 0x08475659, 0x08476ad1, 0x08476b51,
+    0x08477e45, 0x08477f41, 0x0847a6c5, 0x0847bca1, 0x0847c2a1, 0x0847cea9, 0x0847d021, 0x0847d0a9,
+    0x0847d4a9, 0x0847d6a9, 0x0847f729, 0x0847f8a1, 0x0847f921, 0x08480b29, 0x0848188d, 0x08481a0d,
+    0x08482aa2, 0x08482da2, 0x08483a62, 0x08483be2, 0x084847d5, 0x08484955, 0x08487221, 0x08487f7e,
+    0x08488629, 0x0848887e, 0x084898d1, 0x08489a51, 0x084b6499, 0x084b6619, 0x084b66a9, 0x084b8d19,
+    0x084b8e99, 0x084ba099, 0x084ba119, 0x084d09c5, 0x084d0da9, 0x084d0f29, 0x084d2689, 0x084d2985,
+    0x084d31d5, 0x084d3285, 0x084d3655, 0x084d37d5, 0x084d3a89, 0x084d3d85, 0x084d45d5, 0x084d4685,
+    0x084d4a55, 0x084d4bd5, 0x084d79cd, 0x084d7b4d, 0x084d7bfe, 0x084d8219, 0x084d8449, 0x084d84fe,
+    0x084d8b92, 0x084d8e92, 0x084d9792, 0x084da24d, 0x084da3cd, 0x084dace9, 0x084db659, 0x084db7d9,
+    0x084dc0d9, 0x084dcf49, 0x084dd341, 0x084de815, 0x084dfa29, 0x084dfb95, 0x084dfc15, 0x084e1091,
+    0x084e1691, 0x084e3dba, 0x084e3f29, 0x084e4c91, 0x084e61a9, 0x084e663a, 0x084e67a9, 0x084e6a49,
+    0x084e6d45, 0x084e75a9, 0x084e7645, 0x084e7a3a, 0x084e7ba9, 0x084e954d, 0x084e96cd, 0x084e9fc9,
+    0x084ea955, 0x084eaad5, 0x084eb3d5, 0x084ec611, 0x084ecfc9, 0x084edb29, 0x084edfa9, 0x084ee129,
+    0x084ee349, 0x084ee3fe, 0x084ee6fe, 0x084eed29, 0x084eeea9, 0x084eef3e, 0x084eeffe, 0x084ef329,
+    0x084ef3be, 0x084ef53e, 0x084f0bc9, 0x084f15a9, 0x084f1729, 0x084f1ba9, 0x0851ba19, 0x0851cc19,
+    0x0851cca9, 0x0851ce29, 0x0851f4aa, 0x0851f519, 0x08520899, 0x08525c11, 0x08528009, 0x0852a8aa,
+    0x085361a9, 0x08537c8d, 0x08537e0d, 0x08538e89, 0x08539185, 0x08539aa9, 0x08539e69, 0x08539fe9,
+    0x0853abd5, 0x0853ad55, 0x0853cdcd, 0x0853cf4d, 0x0853cffe, 0x0853d869, 0x0853d8fe, 0x0853fcd1,
+    0x0853fe51, 0x08540a4d, 0x08540bcd, 0x085414e9, 0x08545015, 0x08548429, 0x0854858d, 0x08548629,
+    0x08548889, 0x08548b85, 0x08548eae, 0x085491ba, 0x08549329, 0x0854ce3a, 0x0854cfa9, 0x0854dbba,
+    0x0854dd29, 0x0854efd1, 0x0854f169, 0x0854fd4d, 0x0854fee9, 0x085507e9, 0x08553749, 0x085537fe,
+    0x08554129, 0x085542a9, 0x08554729, 0x0855493e, 0x08554b7e, 0x085554a9, 0x0855553e, 0x085556be,
+    0x08555b3e, 0x085573c9, 0x08557da9, 0x08557f29, 0x085583a9, 0x0857f859, 0x0857f9d5, 0x0857fa55,
+    0x085832ca, 0x08584b51, 0x0858ac4a, 0x085929a1, 0x08592a21, 0x085937ed, 0x08593c51, 0x08596345,
+    0x08599d2d, 0x0859a1a1, 0x0859a325, 0x0859c5ad, 0x0859ca21, 0x0859cba1, 0x0859cc21, 0x0859d92d,
+    0x0859d9ad, 0x0859dda1, 0x0859de21, 0x0859dfa1, 0x0859f015, 0x085a0255, 0x085a06d9, 0x085a15d5,
+    0x085a1655, 0x085a1a55, 0x085a1ad5, 0x085a2ad1, 0x085a66d1, 0x085a6bd1, 0x085a7de1, 0x085aaa51,
+    0x085aaad5, 0x085abdc6, 0x085b09a5, 0x085b0fa5, 0x085b1fc9, 0x085b3225, 0x085b3821, 0x085b38a1,
+    0x085b45a5, 0x085b4625, 0x085b4a39, 0x085b4ab9, 0x085b4c21, 0x085baba1, 0x085bb021, 0x085bb1a5,
+    0x085bbda1, 0x085bbf25, 0x085bc3a5, 0x085be621, 0x085be7a1, 0x085be821, 0x085bec21, 0x085beca1,
+    0x085eda19, 0x085edb99, 0x085edc19, 0x085fcd15, 0x08605659, 0x08605ad9, 0x086080d5, 0x0860bb99,
+    0x0860c019, 0x0860d1d1, 0x0860e419, 0x0860e899, 0x0860f79a, 0x0860f81a, 0x0860fc1a, 0x0860fc9a,
+    0x08610eca, 0x08613b15, 0x08613b95, 0x08618c11, 0x08618c91, 0x0861a366, 0x0861a666, 0x0861a766,
+    0x0861af7a, 0x0861b07a, 0x0861b089, 0x0861be49, 0x0861c145, 0x0861d715, 0x0861db95, 0x0861e916,
+    0x0861ea96, 0x0861ff91, 0x08620411, 0x08621fe6, 0x086220fe, 0x08622ce6, 0x08623b92, 0x08649bed,
+    0x0864a059, 0x0864a1d1, 0x0864c5c9, 0x0865012d, 0x086501c5, 0x08650599, 0x08650725, 0x086529ad,
+    0x08652e19, 0x08652f99, 0x08653019, 0x08653dad, 0x08654199, 0x08654219, 0x08654399, 0x08658095,
+    0x08658115, 0x0865b98a, 0x0865e20a, 0x08662115, 0x08662315, 0x08662ead, 0x08663495, 0x08664991,
+    0x08667085, 0x08667fad, 0x08674c19, 0x08675099, 0x08678f95, 0x0867bf0e, 0x0867c80a, 0x08680489,
+    0x08683f15, 0x08684395, 0x086baa99, 0x086bac19, 0x086bac99, 0x086c9d95, 0x086c9f15, 0x086c9f95,
+    0x086cf011, 0x086d8c19, 0x086da251, 0x086db499, 0x086db919, 0x086dc81a, 0x086dc89a, 0x086dcc9a,
+    0x086dcd1a, 0x086e0b95, 0x086e0c15, 0x086e5c91, 0x086e5d11, 0x086e8109, 0x086ea795, 0x086eac15,
+    0x086ebb16, 0x086ebb96, 0x086ebf96, 0x086ec016, 0x086ed011, 0x086f0c12, 0x086f1092, 0x08737f6d,
+    0x087380ed, 0x0873816d, 0x0874331a, 0x0874e08e, 0x0874e9ae, 0x0874ecae, 0x0874ed6d, 0x0874edae,
+    0x0874eded, 0x0874fbad, 0x0875002d, 0x08755a2e, 0x087560ed, 0x0875656d, 0x08756606, 0x0875672e,
+    0x0875896d, 0x08758ded, 0x08780199, 0x08780315, 0x08780395, 0x08783c0a, 0x08785411, 0x08787809,
+    0x0878b58a, 0x0878b886, 0x087932ed, 0x0879336d, 0x0879412d, 0x08794591, 0x0879652d, 0x0879682d,
+    0x08796c85, 0x0879a66d, 0x0879aaed, 0x0879ceed, 0x0879d36d, 0x0879d4ed, 0x0879d56d, 0x0879e0ed,
+    0x0879e26d, 0x0879e2ed, 0x0879e6ed, 0x0879e76d, 0x0879e8ed, 0x087a8709, 0x087b416d, 0x087b41ed,
+    0x087b556d, 0x087bb4ed, 0x087bb96d, 0x087bc6ed, 0x087bea0d, 0x087bea8d, 0x087bef6d, 0x087bf0ed,
+    0x087bf16d, 0x087bf56d, 0x087bf5ed, 0x087ea819, 0x087fec11, 0x0880b699, 0x0880c419, 0x0880c899,
+    0x08812a15, 0x08813d95, 0x08813e15, 0x08815291, 0x08815891, 0x08818e91, 0x08818f11, 0x08820811,
+    0x08820c91, 0x08854889, 0x0886036d, 0x088603ed, 0x088611ad, 0x088676ed, 0x08867b6d, 0x08867ced,
+    0x08869f6d, 0x0886a3ed, 0x0886a56d, 0x0886b2ed, 0x0886b36d, 0x0886b76d, 0x0886b7ed, 0x0886b96d,
+    0x08875b99, 0x08877e11, 0x0887e36d, 0x0887e96d, 0x08880bed, 0x088811ed, 0x0888147a, 0x08881f6d,
+    0x08881fed, 0x088825ed, 0x0888856d, 0x088889ed, 0x08888b6d, 0x0888908d, 0x088890fe, 0x0888920d,
+    0x0888976d, 0x088898ed, 0x08889d6d, 0x0888b90d, 0x0888ba8d, 0x0888bfed, 0x0888c16d, 0x0888c389,
+    0x0888c5ed, 0x088b5011, 0x088b7409, 0x088c2eed, 0x088c576d, 0x088c57ed, 0x088c6b6d, 0x088ccaed,
+    0x088ccf6d, 0x088cd0ed, 0x088ce2ed, 0x088d06ed, 0x088d076d, 0x088d0b6d, 0x088d0bed, 0x088d0d6d,
+    0x088d1f6d, 0x088d467e, 0x088d497e, 0x088d8719, 0x088dbe45, 0x088dc23a, 0x088dc399, 0x088e2c09,
+    0x088e376d, 0x088e3d6d, 0x088e4aed, 0x088e736d, 0x088e73ed, 0x088e79ed, 0x088e876d, 0x088ea87e,
+    0x088eb17e, 0x088eb53e, 0x088eb6be, 0x088ec415, 0x088ee48d, 0x088ee60d, 0x088eeb6d, 0x088eeced,
+    0x088eef09, 0x088f1511, 0x088f210d, 0x088f228d, 0x088f296d, 0x088f2b89, 0x08923051, 0x08925745,
+    0x089295a1, 0x089297a1, 0x0892be3e, 0x0892d1be, 0x0892d221, 0x089346ba, 0x0893473a, 0x08934ba1,
+    0x08936f3a, 0x08940366, 0x0894a421, 0x0894a621, 0x0894b3a5, 0x0894b7a5, 0x0894b821, 0x08956266,
+    0x08956b66, 0x08984999, 0x0898c115, 0x08995eba, 0x0899723a, 0x089972ba, 0x0899873a, 0x0899ecc5,
+    0x0899f239, 0x089a0989, 0x089a14d5, 0x089a1955, 0x089a1d15, 0x089a1d89, 0x089a2095, 0x089a28d5,
+    0x089a2985, 0x089a2d55, 0x089a2ed5, 0x089a5e66, 0x089a5ecd, 0x089a6599, 0x089a6766, 0x089a67c9,
+    0x089a6a19, 0x089a6ac5, 0x089a857d, 0x089a9959, 0x089aa3d9, 0x089acfbe, 0x089ae33e, 0x089ae395,
+    0x089af811, 0x089afa11, 0x089b4d49, 0x089b5045, 0x089b58a6, 0x089b5945, 0x089b5d25, 0x089b5ea5,
+    0x089b784d, 0x089b8c55, 0x089b96d5, 0x089bbe39, 0x089bc2a5, 0x089bc666, 0x089bc6c9, 0x089bc9f9,
+    0x089bd239, 0x089bd6a5, 0x089bd826, 0x089bf8bd, 0x089e9d99, 0x089eab19, 0x089eaf99, 0x089f1515,
+    0x089f2895, 0x089f2915, 0x089f3d91, 0x089f6485, 0x08a07109, 0x08a07189, 0x08a07485, 0x08a07da5,
+    0x08a080d5, 0x08a08165, 0x08a082d5, 0x08a0b266, 0x08a0b2cd, 0x08a0bb66, 0x08a0bbe5, 0x08a0ecfd,
+    0x08a0ed4d, 0x08a0eecd, 0x08a0f7e5, 0x08a1dfcd, 0x08a1e04d, 0x08a1e1f9, 0x08a1ead5, 0x08a21a66,
+    0x08a21ac9, 0x08a22639, 0x08a22a26, 0x08a22aa5, 0x08a22c26, 0x08a22e66, 0x08a239a6, 0x08a23e26,
+    0x08a2603d, 0x08a260a5, 0x08a26239, 0x08a51a19, 0x08a59195, 0x08a62f3a, 0x08a642ba, 0x08a6433a,
+    0x08a657ba, 0x08a67eba, 0x08a73619, 0x08a73a99, 0x08a7a03e, 0x08a7b395, 0x08a7b415, 0x08a7ca91,
+    0x08ac737e, 0x08ac74fe, 0x08ac756d, 0x08ac833a, 0x08acaa3a, 0x08ace87a, 0x08aceced, 0x08aceefa,
+    0x08ad10fa, 0x08ad157e, 0x08ad16fa, 0x08ad247a, 0x08ad24fa, 0x08ad2709, 0x08ad28fe, 0x08ad296d,
+    0x08ad2afa, 0x08ad5a56, 0x08ad6356, 0x08ad9349, 0x08ad9e9a, 0x08ada319, 0x08ada519, 0x08adcfd9,
+    0x08addf99, 0x08adf43e, 0x08ae596d, 0x08ae5b6d, 0x08ae8a8e, 0x08ae9389, 0x08ae957e, 0x08ae95ed,
+    0x08ae976d, 0x08aef6fa, 0x08aefb6d, 0x08af020d, 0x08af08ed, 0x08af0afa, 0x08af0d09, 0x08af0f6d,
+    0x08af317e, 0x08af32fa, 0x08b23991, 0x08b26085, 0x08b29eed, 0x08b2a0ed, 0x08b2c77e, 0x08b2c8fe,
+    0x08b2c96d, 0x08b2dafe, 0x08b2db6d, 0x08b2dced, 0x08b33c7a, 0x08b340ed, 0x08b342fa, 0x08b34e6d,
+    0x08b3507a, 0x08b354ed, 0x08b376fe, 0x08b3787a, 0x08b378fa, 0x08b37cfe, 0x08b37d6d, 0x08b37efa,
+    0x08b38a7e, 0x08b38aed, 0x08b38c7a, 0x08b390ed, 0x08b3ae56, 0x08b3b756, 0x08b3b7c9, 0x08b3bac5,
+    0x08b3e749, 0x08b3f29a, 0x08b3f719, 0x08b3f919, 0x08b423c9, 0x08b42e9a, 0x08b42f1a, 0x08b42fc5,
+    0x08b43399, 0x08b43519, 0x08b4ad6d, 0x08b4af6d, 0x08b4c16d, 0x08b4de8e, 0x08b4e9ed, 0x08b4eb6d,
+    0x08b4fd6d, 0x08b522c5, 0x08b52695, 0x08b52816, 0x08b5560d, 0x08b55ced, 0x08b55efa, 0x08b56109,
+    0x08b570ed, 0x08b5923d, 0x08b5928d, 0x08b59afa, 0x08b59d09, 0x08b9e5a2, 0x08ba008d, 0x08ba020d,
+    0x08ba15a2, 0x08ba2262, 0x08ba23e2, 0x08ba2fd5, 0x08ba3155, 0x08ba80d1, 0x08ba8251, 0x08bb5222,
+    0x08bb5fa1, 0x08bb6121, 0x08bb73d1, 0x08bb7579, 0x08bbd921, 0x08bbdab9, 0x08bc01a2, 0x08bc0322,
+    0x08bf6f6d, 0x08bf70ed, 0x08bf716d, 0x08bf97fe, 0x08bf997e, 0x08bfab7e, 0x08bfabed, 0x08c00cfa,
+    0x08c0116d, 0x08c012fa, 0x08c01eed, 0x08c0207a, 0x08c020fa, 0x08c024ed, 0x08c0256d, 0x08c026fa,
+    0x08c0477e, 0x08c04d7e, 0x08c05b6d, 0x08c05f09, 0x08c06692, 0x08c06992, 0x08c07a82, 0x08c07d4d,
+    0x08c07ecd, 0x08c087d5, 0x08c0914d, 0x08c092d5, 0x08c09bc9, 0x08c0b7c9, 0x08c0c319, 0x08c0c799,
+    0x08c0c919, 0x08c0cb49, 0x08c0cbc9, 0x08c0cec5, 0x08c0d519, 0x08c0d699, 0x08c0d719, 0x08c0db19,
+    0x08c0db99, 0x08c0dd19, 0x08c0fdbd, 0x08c0ff3d, 0x08c107d9, 0x08c11199, 0x08c11799, 0x08c1796d,
+    0x08c17ded, 0x08c17f6d, 0x08c1848d, 0x08c1860d, 0x08c1868d, 0x08c18b6d, 0x08c18ced, 0x08c18d6d,
+    0x08c1916d, 0x08c191ed, 0x08c1936d, 0x08c1b3fe, 0x08c1b57e, 0x08c1c10d, 0x08c1c28d, 0x08c1c7ed,
+    0x08c1cb89, 0x08c1f095, 0x08c1f239, 0x08c1f695, 0x08c20495, 0x08c20a95, 0x08c2268d, 0x08c22efa,
+    0x08c23109, 0x08c23a0d, 0x08c23a8d, 0x08c23c39, 0x08c242fa, 0x08c24509, 0x08c262bd, 0x08c5d6ee,
+    0x08c5d76e, 0x08c5d8ee, 0x08c5ff6e, 0x08c5ffee, 0x08c6136e, 0x08c6746e, 0x08c674ee, 0x08c68cee,
+    0x08c6d7ed, 0x08c6d96d, 0x08c6e4ed, 0x08c6e56d, 0x08c6e6ed, 0x08c7292d, 0x08c72aad, 0x08c72b2d,
+    0x08c72f2d, 0x08c7312d, 0x08c73d2d, 0x08c73ead, 0x08c765ad, 0x08c7672d, 0x08c7df6e, 0x08c7e0ee,
+    0x08c7e16e, 0x08c7f36e, 0x08c8582d, 0x08c858ad, 0x08c88e2d, 0x08c88ead, 0x08c8992d, 0x08c8ca8e,
+    0x08c8fd1d, 0x08c90191, 0x08c90311, 0x08c90391, 0x08c9138a, 0x08c9241d, 0x08c92789, 0x08c92885,
+    0x08c93c0a, 0x08c9625d, 0x08c966d9, 0x08c96865, 0x08c968e9, 0x08c98add, 0x08c98f59, 0x08c990d9,
+    0x08c99161, 0x08c99e59, 0x08c99ed9, 0x08c9a2d9, 0x08c9a359, 0x08c9a4d9, 0x08c9b58a, 0x08c9dc85,
+    0x08c9e069, 0x08c9e1d5, 0x08c9e255, 0x08ca1aca, 0x08cb4cd5, 0x08cb4e55, 0x08cb4ed5, 0x08cb7e4e,
+    0x08cbba4d, 0x08cc00ca, 0x08cc7ca9, 0x08cc7e21, 0x08cc7ea1, 0x08ccf621, 0x08ccf7a5, 0x08ccf829,
+    0x08cd1ea1, 0x08cd202a, 0x08cd20a1, 0x08cd2dbd, 0x08cd2e3d, 0x08cd3221, 0x08cd32a1, 0x08cd3421,
+    0x08cd4409, 0x08cd4491, 0x08cd56d5, 0x08cd5b55, 0x08cd5cd5, 0x08cd5d61, 0x08cd6a55, 0x08cd6ad5,
+    0x08cd6ed5, 0x08cd6f55, 0x08cd7f51, 0x08cd8005, 0x08cd83d1, 0x08cd8565, 0x08cd85e9, 0x08cd95ca,
+    0x08cda645, 0x08cda9e9, 0x08cdbb5a, 0x08cdf8e5, 0x08cdfd69, 0x08cdfed1, 0x08cdff51, 0x08ce1246,
+    0x08ce1fe5, 0x08ce2349, 0x08ce37ca, 0x08ce5e25, 0x08ce62a9, 0x08ce6425, 0x08ce64a9, 0x08ce86a5,
+    0x08ce8b29, 0x08ce8ca1, 0x08ce8d21, 0x08ce9a25, 0x08ce9aa5, 0x08ce9ea9, 0x08ce9f29, 0x08cea0a1,
+    0x08cf0021, 0x08cf04a1, 0x08cf0625, 0x08cf1221, 0x08cf13a5, 0x08cf1429, 0x08cf1825, 0x08cf18a9,
+    0x08cf3aa1, 0x08cf3c2a, 0x08cf3ca1, 0x08cf40a1, 0x08cf4121, 0x08cf9259, 0x08cf93d5, 0x08cf9455,
+    0x08cfe4d1, 0x08d005d9, 0x08d0464a, 0x08d0c39d, 0x08d0c41d, 0x08d0d1dd, 0x08d1371d, 0x08d13b9d,
+    0x08d15faa, 0x08d1641d, 0x08d165aa, 0x08d1731e, 0x08d1739e, 0x08d1779e, 0x08d1781e, 0x08d1799e,
+    0x08d22e99, 0x08d23019, 0x08d23099, 0x08d32195, 0x08d32315, 0x08d32395, 0x08d3742a, 0x08d38f2a,
+    0x08d3953d, 0x08d3aad9, 0x08d3af59, 0x08d3b0d5, 0x08d3d1d5, 0x08d3d555, 0x08d3e9ca, 0x08d41019,
+    0x08d41499, 0x08d425c9, 0x08d43899, 0x08d43d19, 0x08d43e99, 0x08d44a9a, 0x08d44c1a, 0x08d44c9a,
+    0x08d4509a, 0x08d4511a, 0x08d46646, 0x08d48f95, 0x08d49015, 0x08d4e091, 0x08d501a5, 0x08d50509,
+    0x08d512c9, 0x08d515d6, 0x08d516c1, 0x08d52b95, 0x08d53015, 0x08d53d96, 0x08d53f96, 0x08d54396,
+    0x08d54416, 0x08d55411, 0x08d55891, 0x08d59012, 0x08d5a3aa, 0x08d5c91d, 0x08d5e1dd, 0x08d5e655,
+    0x08d5e7d5, 0x08d5e855, 0x08d5f01d, 0x08d5f3f9, 0x08d5f5dd, 0x08d5f9d5, 0x08d5fa55, 0x08d5fbd5,
+    0x08d60ed1, 0x08d61065, 0x08d62e5d, 0x08d635c5, 0x08d644f9, 0x08d6465d, 0x08d656dd, 0x08d659dd,
+    0x08d66a59, 0x08d66ad9, 0x08d68869, 0x08d689d1, 0x08d69a4a, 0x08d6adc9, 0x08d6af69, 0x08d6c2ca,
+    0x08d6e9c5, 0x08d6eda9, 0x08d6ef25, 0x08d6efa9, 0x08d71629, 0x08d7179d, 0x08d7181d, 0x08d729a9,
+    0x08d72a29, 0x08d72b9d, 0x08d75ed5, 0x08d78b1d, 0x08d78f9d, 0x08d79125, 0x08d791a9, 0x08d79d1d,
+    0x08d7a325, 0x08d7a3a9, 0x08d7c59d, 0x08d7c72a, 0x08d7c79d, 0x08d7cb9d, 0x08d7cc1d, 0x08d7d91e,
+    0x08d7d99e, 0x08d7db1e, 0x08d7df9e, 0x08d7f4d1, 0x08d7f651, 0x08d806ca, 0x08d80fcd, 0x08d811cd,
+    0x08d82f4a, 0x08d84a49, 0x08d855bd, 0x08d85a19, 0x08d85ba5, 0x08d85c29, 0x08d8624d, 0x08d872c9,
+    0x08d87e3d, 0x08d88299, 0x08d88419, 0x08d88499, 0x08d8864d, 0x08d886cd, 0x08d89619, 0x08d89699,
+    0x08d89819, 0x08d8a8ca, 0x08d8d3a9, 0x08d8d515, 0x08d8d595, 0x08d9050e, 0x08d90e0a, 0x08d92611,
+    0x08d92d8e, 0x08d9368a, 0x08d94a09, 0x08d94a89, 0x08d97795, 0x08d9a70e, 0x08d9f9bd, 0x08d9fa3d,
+    0x08d9fb3d, 0x08da10d9, 0x08da22c9, 0x08da3655, 0x08da37d9, 0x08da4b49, 0x08da6419, 0x08da6aa9,
+    0x08da7245, 0x08da7619, 0x08da7829, 0x08da9e99, 0x08daa019, 0x08daa099, 0x08daa519, 0x08dab21a,
+    0x08dac4e5, 0x08dadda5, 0x08dae415, 0x08daebe5, 0x08daf1a5, 0x08db0625, 0x08db138e, 0x08db1c8a,
+    0x08db2a25, 0x08db4225, 0x08db52a5, 0x08db55a5, 0x08db6625, 0x08db9195, 0x08db9395, 0x08db9815,
+    0x08dba516, 0x08dbba11, 0x08dbe105, 0x08dc62d9, 0x08dc6455, 0x08dc64d5, 0x08dc9d4a, 0x08dcb551,
+    0x08dcd659, 0x08dcd949, 0x08dd16ca, 0x08dd941d, 0x08dd949d, 0x08dda25d, 0x08ddc955, 0x08de079d,
+    0x08de0c1d, 0x08de302a, 0x08de349d, 0x08de362a, 0x08de439e, 0x08de441e, 0x08de481e, 0x08de489e,
+    0x08de4a1e, 0x08deff19, 0x08df0099, 0x08df0119, 0x08dff215, 0x08dff395, 0x08dff415, 0x08e044aa,
+    0x08e05faa, 0x08e065bd, 0x08e07b59, 0x08e07fd9, 0x08e08155, 0x08e081e1, 0x08e0a259, 0x08e0a5d5,
+    0x08e0ba4a, 0x08e0e099, 0x08e0e519, 0x08e0f649, 0x08e10919, 0x08e10d99, 0x08e10f19, 0x08e11c9a,
+    0x08e11d1a, 0x08e1211a, 0x08e1219a, 0x08e16015, 0x08e16095, 0x08e1b111, 0x08e1d589, 0x08e1fc15,
+    0x08e20095, 0x08e20f96, 0x08e21016, 0x08e21416, 0x08e21496, 0x08e22491, 0x08e22911, 0x08e24b85,
+    0x08e26092, 0x08e26512, 0x08e34629, 0x08e346a9, 0x08e43329, 0x08e437a9, 0x08e4ab1e, 0x08e6d3e9,
+    0x08e6d56a, 0x08e6d5e9, 0x08e76329, 0x08e7841a, 0x08e7879a, 0x08e841e9, 0x08e84269, 0x08e85029,
+    0x08e854a9, 0x08e87716, 0x08e8b569, 0x08e8b9e9, 0x08e8c812, 0x08e8ddea, 0x08e8e269, 0x08e8e3ea,
+    0x08e90ad1, 0x08e90c55, 0x08e93055, 0x08e931c5, 0x08e97019, 0x08e97229, 0x08e99899, 0x08e99a19,
+    0x08e99a99, 0x08e9a819, 0x08e9ac19, 0x08e9ac99, 0x08e9ae19, 0x08e9beca, 0x08e9e5c5, 0x08e9e9a9,
+    0x08e9eb15, 0x08e9eb95, 0x08ea240a, 0x08ea3c11, 0x08ea4c8a, 0x08ea6009, 0x08ea6089, 0x08ea6e5d,
+    0x08ea871d, 0x08ea9555, 0x08ea9915, 0x08ea9a95, 0x08ea9b15, 0x08eaaf9d, 0x08ead39d, 0x08eaea11,
+    0x08eaebaa, 0x08eafc1d, 0x08eaff2a, 0x08eb0f9e, 0x08eb101e, 0x08eb111e, 0x08eb5615, 0x08eb5795,
+    0x08eb5815, 0x08eb878e, 0x08eb908a, 0x08eba891, 0x08ebb00e, 0x08ebcc89, 0x08ebcd09, 0x08ec0a0a,
+    0x08ec85e9, 0x08ec8769, 0x08ec87e9, 0x08ecb50d, 0x08ecb70d, 0x08ecef89, 0x08ecfafd, 0x08ecff69,
+    0x08ed0169, 0x08ed07aa, 0x08ed1809, 0x08ed237d, 0x08ed27e9, 0x08ed296a, 0x08ed29e9, 0x08ed2b8d,
+    0x08ed2c0d, 0x08ed2d0d, 0x08ed31bd, 0x08ed357d, 0x08ed36fd, 0x08ed377d, 0x08ed3b69, 0x08ed3be9,
+    0x08ed3d69, 0x08ed4759, 0x08ed6019, 0x08ed6695, 0x08ed6e59, 0x08ed7419, 0x08ed8899, 0x08ed8f29,
+    0x08edac99, 0x08edc49a, 0x08edd519, 0x08edd819, 0x08ede89a, 0x08ee0891, 0x08ee6be9, 0x08ee6de9,
+    0x08ee9469, 0x08ee95e9, 0x08ee9669, 0x08eea7e9, 0x08eea869, 0x08eea9e9, 0x08eeb611, 0x08eec809,
+    0x08eedb96, 0x08eedd16, 0x08eef089, 0x08ef0969, 0x08ef0de9, 0x08ef0fe9, 0x08ef1785, 0x08ef1b69,
+    0x08ef1d69, 0x08ef21e9, 0x08ef43e9, 0x08ef456a, 0x08ef45e9, 0x08ef49e9, 0x08ef4a69, 0x08ef965d,
+    0x08efb151, 0x08f024dd, 0x08f04bdd, 0x08f08a1d, 0x08f0901d, 0x08f0b29d, 0x08f0c61d, 0x08f0c69d,
+    0x08f1321d, 0x08f13f9d, 0x08f1441d, 0x08f1b24d, 0x08f1fc99, 0x08f27615, 0x08f2e20d, 0x08f34091,
+    0x08f3f249, 0x08f40b19, 0x08f41899, 0x08f41d19, 0x08f47e95, 0x08f49215, 0x08f49295, 0x08f4a711,
+    0x08f4ad11, 0x08f4ce05, 0x08f4e311, 0x08f4e391, 0x08f55c91, 0x08f56111, 0x08f5d6dd, 0x08f63c1d,
+    0x08f64099, 0x08f64219, 0x08f642a9, 0x08f6649d, 0x08f66919, 0x08f66a99, 0x08f67819, 0x08f67899,
+    0x08f67c99, 0x08f67d19, 0x08f6b59d, 0x08f6ba29, 0x08f72d9d, 0x08f82815, 0x08f8580e, 0x08f8940d,
+    0x08f8948d, 0x08f95669, 0x08f957e9, 0x08f95869, 0x08f9cfe9, 0x08f9d169, 0x08f9d1e9, 0x08f9f869,
+    0x08f9f9ea, 0x08fa077d, 0x08fa07fd, 0x08fa0be9, 0x08fa0c69, 0x08fa0de9, 0x08fa3095, 0x08fa4415,
+    0x08fa5911, 0x08fa5f11, 0x08fa83a9, 0x08fad291, 0x08fad729, 0x08faf985, 0x08fb37e9, 0x08fb3c69,
+    0x08fb3de9, 0x08fb3e69, 0x08fb6069, 0x08fb64e9, 0x08fb6669, 0x08fb7269, 0x08fb73e9, 0x08fb7469,
+    0x08fb7869, 0x08fb78e9, 0x08fb7a69, 0x08fbd9e9, 0x08fbde69, 0x08fbdfe9, 0x08fbebe9, 0x08fbed69,
+    0x08fbede9, 0x08fbf1e9, 0x08fbf269, 0x08fbf3e9, 0x08fc1469, 0x08fc1a69, 0x08fc3e5d, 0x08fc4edd,
+    0x08fc625d, 0x08fc62dd, 0x08fc63dd, 0x08fc9499, 0x08fc9619, 0x08fc96a9, 0x08fca21d, 0x08fca39d,
+    0x08fca819, 0x08fca8a9, 0x08fcaa29, 0x08fcca9d, 0x08fccc1d, 0x08fccc9d, 0x08fcd099, 0x08fcd119,
+    0x08fcde19, 0x08fcde99, 0x08fce019, 0x08fce499, 0x08fcf0dd, 0x08fd17dd, 0x08fd1d1d, 0x08fd1d9d,
+    0x08fd3811, 0x08fd561d, 0x08fd591d, 0x08fd5c09, 0x08fd6cb9, 0x08fd6e1d, 0x08fd7e9d, 0x08fd819d,
+    0x08fd8489, 0x08fd921d, 0x08fd929d, 0x08fdf81d, 0x08fe5a4d, 0x08fe6ac9, 0x08fe763d, 0x08fe7c15,
+    0x08fe7e4d, 0x08fe7ecd, 0x08fe7fcd, 0x08fe8e15, 0x08fe8e95, 0x08fea491, 0x08feac0e, 0x08febe0d,
+    0x08febf8d, 0x08fec889, 0x08fec929, 0x08feca05, 0x08fee68d, 0x08fee80d, 0x08fee88d, 0x08fefa0d,
+    0x08fefa8d, 0x08fefc0d, 0x08ff0cc9, 0x08ff183d, 0x08ff1e11, 0x08ff258e, 0x08ff390d, 0x08ff398d,
+    0x08ff4209, 0x08ff4289, 0x08ff43a9, 0x08ff4e0e, 0x08ff7209, 0x08ff7d7d, 0x08ff81e9, 0x08ff8369,
+    0x08ff83e9, 0x08ff8a0d, 0x08ff9a89, 0x08ffa5fd, 0x08ffaa69, 0x08ffabe9, 0x08ffac69, 0x08ffae0d,
+    0x08ffae8d, 0x08ffbde9, 0x08ffbe69, 0x08ffbfe9, 0x09001409, 0x09001f7d, 0x090023e9, 0x09002569,
+    0x090025e9, 0x09003769, 0x090037e9, 0x09003969, 0x09005fe9, 0x09006069, 0x090061e9, 0x09006d7d,
+    0x09006dfd, 0x09006f7d, 0x090073e9, 0x09009695, 0x09009815, 0x0900aa15, 0x0900aa95, 0x0900c091,
+    0x0900d109, 0x0900e489, 0x0900e529, 0x0900e605, 0x090138a9, 0x09013a11, 0x09014a89, 0x09015e09,
+    0x09015e89, 0x09015fa9, 0x09017309, 0x09018089, 0x09018be9, 0x09019069, 0x090191e9, 0x09019269,
+    0x09019a05, 0x09019de9, 0x09019f69, 0x09019fe9, 0x0901a3e9, 0x0901a5e9, 0x0901c669, 0x0901c7e9,
+    0x0901c869, 0x0901cc69, 0x0901cce9, 0x0901ce69, 0x0901d9e9, 0x0901da69, 0x0901dbe9, 0x0901e069,
+    0x09023fe9, 0x09024169, 0x090241e9, 0x09024669, 0x090253e9, 0x09025569, 0x090259e9, 0x09027de9,
+    0x0902d459, 0x0902d5d5, 0x0902d655, 0x09030eca, 0x090326d1, 0x09032751, 0x09034ac9, 0x0903884a,
+    0x0904059d, 0x0904061d, 0x090413dd, 0x09041851, 0x09043f45, 0x0904791d, 0x09047d9d, 0x0904a19d,
+    0x0904a61d, 0x0904a79d, 0x0904b51e, 0x0904b59e, 0x0904b99e, 0x0904ba1e, 0x0904bb9e, 0x09057099,
+    0x09057219, 0x09057299, 0x09066395, 0x09066515, 0x09066595, 0x0906b611, 0x0906ecd9, 0x0906f2d5,
+    0x090713d5, 0x09071755, 0x09072bca, 0x09072ec6, 0x09075219, 0x09075699, 0x090767c9, 0x09076851,
+    0x09077a99, 0x09077f19, 0x09078099, 0x09078e1a, 0x09078e9a, 0x0907929a, 0x0907931a, 0x0907d195,
+    0x0907d215, 0x09082291, 0x09082311, 0x090843a5, 0x09084709, 0x09086d95, 0x09087215, 0x09088116,
+    0x09088196, 0x09088596, 0x09088616, 0x09089611, 0x0908d212, 0x0908d692, 0x0909b7a5, 0x0909b825,
+    0x090aa925, 0x090b1c9e, 0x090d4565, 0x090d46e5, 0x090d4765, 0x090dd4a5, 0x090df59a, 0x090df91a,
+    0x090eb365, 0x090eb3e5, 0x090ec1a5, 0x090ec625, 0x090f26e5, 0x090f2b65, 0x090f3992, 0x090f4f65,
+    0x090f53e5, 0x090f5565, 0x090f77dd, 0x090f7c59, 0x090f7dd1, 0x090f9edd, 0x090fa1c9, 0x090fdd1d,
+    0x090fddc5, 0x090fe199, 0x090fe325, 0x0910059d, 0x09100a19, 0x09100b99, 0x09100c19, 0x09101919,
+    0x09101999, 0x09101d99, 0x09101e19, 0x09101f99, 0x09105c95, 0x09105d15, 0x0910958a, 0x0910fd15,
+    0x09110a95, 0x09111095, 0x09112591, 0x09114c85, 0x09115b91, 0x0911811e, 0x0911819e, 0x0911829e,
+    0x0911c799, 0x0911c915, 0x0911c995, 0x0911f90e, 0x0912020a, 0x09121a11, 0x0912218e, 0x0912350d,
+    0x0912358d, 0x09123e09, 0x09123e89, 0x09127e86, 0x0912f8e5, 0x0912f965, 0x09130b91, 0x0913268d,
+    0x091370e5, 0x09137265, 0x09139965, 0x09139ae5, 0x09139b65, 0x0913a6fd, 0x0913a87d, 0x0913a8fd,
+    0x0913ace5, 0x0913ad65, 0x0913aee5, 0x0913b8c9, 0x0913d195, 0x0913d815, 0x0913dfc9, 0x0913e515,
+    0x0913e595, 0x0913fa11, 0x09141e09, 0x09142105, 0x09143611, 0x09144689, 0x09144985, 0x09144d09,
+    0x09145a1a, 0x091473a5, 0x09149aa5, 0x0914d8e5, 0x0914dee5, 0x09150165, 0x09150765, 0x091507e5,
+    0x091514e5, 0x09151565, 0x09151b65, 0x09152791, 0x09154e96, 0x09157ae5, 0x09157f65, 0x091580e5,
+    0x09158ce5, 0x09158e65, 0x091592e5, 0x0915b565, 0x0915b6e5, 0x0915b765, 0x0915bb65, 0x0915bbe5,
+    0x09168821, 0x091688a1, 0x091779a1, 0x0917ed1e, 0x091a15e1, 0x091a1761, 0x091a17e1, 0x091aa521,
+    0x091ac61a, 0x091ac99a, 0x091b83e1, 0x091b8461, 0x091b9221, 0x091b96a1, 0x091bb916, 0x091bf761,
+    0x091bfbe1, 0x091c1fe1, 0x091c2461, 0x091c25e1, 0x0922dd99, 0x0922df15, 0x0922df95, 0x0923180a,
+    0x09233011, 0x09235119, 0x09235409, 0x0923918a, 0x09239486, 0x09240edd, 0x09240f5d, 0x09241d1d,
+    0x09242191, 0x09244115, 0x09244415, 0x09244885, 0x0924825d, 0x092486dd, 0x0924aadd, 0x0924af5d,
+    0x0924b0dd, 0x0924b15d, 0x0924b91e, 0x0924bcde, 0x0924be5e, 0x0924bede, 0x0924c2de, 0x0924c35e,
+    0x0924c4de, 0x092579d9, 0x09257b59, 0x09257bd9, 0x09266cd5, 0x09266e55, 0x09266ed5, 0x09269e4e,
+    0x0926bf51, 0x0926c6ce, 0x0926d8cd, 0x0926da4d, 0x0926dacd, 0x0926dd7d, 0x0926e07d, 0x0926e349,
+    0x0926e3c9, 0x0926e4c5, 0x0926f619, 0x0926fa99, 0x0926fc95, 0x09271d19, 0x09275b59, 0x09275fd9,
+    0x09277109, 0x092783d9, 0x09278859, 0x092789d9, 0x09278a59, 0x0927975a, 0x092797da, 0x09279bda,
+    0x09279c5a, 0x0927dad5, 0x0927db55, 0x09282bd1, 0x09282c51, 0x09285e09, 0x092876d5, 0x09287b55,
+    0x09288516, 0x092888d6, 0x09288a56, 0x09288ad6, 0x09288ed6, 0x09288f56, 0x09289f51, 0x0928a3d1,
+    0x0928c349, 0x0928c645, 0x0928db52, 0x0928dfd2, 0x0928ebc9, 0x0928eec5, 0x09298419, 0x0929ad21,
+    0x0929f79d, 0x092b6a15, 0x092c99e1, 0x092d1361, 0x092d3c61, 0x092d8615, 0x092da111, 0x092e1491,
+    0x092e3b85, 0x092e79e1, 0x092e7fe1, 0x092ea261, 0x092ea8e1, 0x092eb5e1, 0x092eb661, 0x092f21e1,
+    0x092f2f61, 0x092f33e1, 0x092f5861, 0x092f5ce1, 0x092fa99d, 0x092fae19, 0x092faf95, 0x092fb015,
+    0x09300091, 0x09302199, 0x09302489, 0x0930d95d, 0x0930df5d, 0x0930dfdd, 0x0930ed9d, 0x093152dd,
+    0x0931575d, 0x093158dd, 0x09317b5d, 0x09317fdd, 0x0931815d, 0x09318ede, 0x09318f5e, 0x0931935e,
+    0x093193de, 0x0931955e, 0x09324a59, 0x09324bd9, 0x09324c59, 0x09333d55, 0x09333ed5, 0x09333f55,
+    0x09338fd1, 0x0933aacd, 0x0933ab4d, 0x0933b0fd, 0x0933c691, 0x0933cb19, 0x0933f115, 0x09342bd9,
+    0x09343059, 0x093431d9, 0x09344189, 0x09345459, 0x093458d9, 0x09345a59, 0x0934665a, 0x093467da,
+    0x0934685a, 0x09346c5a, 0x09346cda, 0x09347f0a, 0x09348206, 0x0934a555, 0x0934ab55, 0x0934abd5,
+    0x0934fc51, 0x09351d45, 0x093520c9, 0x09352e89, 0x09353185, 0x09353281, 0x09354755, 0x09354bd5,
+    0x09355956, 0x09355ad6, 0x09355b56, 0x09355f56, 0x09355fd6, 0x09356fd1, 0x09357451, 0x0935aa52,
+    0x0935b052, 0x0935b0d2, 0x09360415, 0x09360bdd, 0x0936111d, 0x09362c11, 0x09364a1d, 0x09365009,
+    0x0936729d, 0x09368619, 0x09368699, 0x09368799, 0x09369f9d, 0x0936c69d, 0x093704dd, 0x09370add,
+    0x09372d5d, 0x0937335d, 0x093733dd, 0x093740dd, 0x0937415d, 0x0937475d, 0x09377a95, 0x0937a6dd,
+    0x0937ab5d, 0x0937acdd, 0x0937b8dd, 0x0937ba5d, 0x0937bedd, 0x0937e15d, 0x0937e2dd, 0x0937e35d,
+    0x0937e75d, 0x0937e7dd, 0x0937f4de, 0x0937f55e, 0x0937f6de, 0x0937fb5e, 0x09381211, 0x0938198e,
+    0x09382d0d, 0x09383609, 0x09383695, 0x09383799, 0x09386609, 0x0938717d, 0x093875d9, 0x09387759,
+    0x09388e89, 0x093899fd, 0x09389e59, 0x09389fd9, 0x0938a059, 0x0938a20d, 0x0938a28d, 0x0938b1d9,
+    0x0938b259, 0x0938b3d9, 0x0938bb8e, 0x0938e285, 0x0938eafd, 0x0938f0d5, 0x0938f155, 0x093920ce,
+    0x093941d1, 0x0939494e, 0x09395ccd, 0x09395d4d, 0x093965c9, 0x09396649, 0x09399355, 0x0939968d,
+    0x0939a4d5, 0x0939c2ce, 0x0939d4cd, 0x0939d64d, 0x0939e0c5, 0x0939fd4d, 0x0939fecd, 0x0939ff4d,
+    0x093a10cd, 0x093a114d, 0x093a12cd, 0x093a157d, 0x093a15fd, 0x093a16fd, 0x093a2e11, 0x093a3e89,
+    0x093a5209, 0x093a5295, 0x093a5395, 0x093a7fd9, 0x093a8e05, 0x093a91d9, 0x093a9359, 0x093aba59,
+    0x093abbd9, 0x093abc59, 0x093acdda, 0x093ace5a, 0x093ae089, 0x093af955, 0x093affd5, 0x093b0789,
+    0x093b0cd5, 0x093b0d55, 0x093b21d1, 0x093b2f4e, 0x093b45c9, 0x093b48c5, 0x093b5dd1, 0x093b6e49,
+    0x093b7145, 0x093b81c9, 0x093b8249, 0x093b8379, 0x093baf55, 0x093bb3d5, 0x093be7c9, 0x093d0c51,
+    0x093d3345, 0x093d719d, 0x093d739d, 0x093d9a3e, 0x093dadbe, 0x093dae1d, 0x093e15ba, 0x093e233a,
+    0x093e279d, 0x093e293a, 0x093e4b3a, 0x093ee019, 0x093f5795, 0x094008ba, 0x0940093a, 0x0940eea1,
+    0x0940fc19, 0x09410099, 0x09416615, 0x09417995, 0x09417a15, 0x09418e91, 0x09419091, 0x0941b489,
+    0x09432599, 0x09439d15, 0x0946397e, 0x0946493a, 0x0946ae7a, 0x0946b4fa, 0x0946d6fa, 0x0946dcfa,
+    0x0946ea7a, 0x0946eafa, 0x09474291, 0x09476689, 0x0947b5a5, 0x0947ba11, 0x09481ae5, 0x09481f65,
+    0x094820e5, 0x09482165, 0x0948437e, 0x094847fe, 0x094856fe, 0x09485765, 0x09485b7e, 0x09485be5,
+    0x0948c2fa, 0x0948d0fa, 0x0948d4e5, 0x0948d565, 0x0948d6fa, 0x0948f8fa, 0x09497999, 0x09498719,
+    0x09498b99, 0x0949f115, 0x094a0495, 0x094a0515, 0x094a1991, 0x094a4085, 0x094ba30d, 0x094bff91,
+    0x094c2685, 0x094c64e5, 0x094c6665, 0x094c66e5, 0x094c8d7e, 0x094c8f65, 0x094ca0fe, 0x094ca165,
+    0x094d027a, 0x094d06e5, 0x094d08fa, 0x094d167a, 0x094d1ae5, 0x094d3e7a, 0x094d3efa, 0x094d527a,
+    0x094e6ee5, 0x094e7365, 0x094e74e5, 0x094e7565, 0x094e80e5, 0x094e82e5, 0x094e86e5, 0x094e8765,
+    0x094e88e5, 0x094eafe5, 0x094eb165, 0x094ebd65, 0x094ec365, 0x094f24fa, 0x094f28e5, 0x094f2965,
+    0x094f36e5, 0x094ff619, 0x09501ea1, 0x09506d95, 0x09511eba, 0x095309fe, 0x095319ba, 0x095340ba,
+    0x09537efa, 0x0953857a, 0x0953a77a, 0x0953ad7a, 0x0953adfa, 0x0953bafa, 0x0953bb7a, 0x09541311,
+    0x09543709, 0x09548a91, 0x0954efe1, 0x0954f1e1, 0x0955187e, 0x09551a61, 0x09552bfe, 0x09552c61,
+    0x095593fa, 0x0955a17a, 0x0955a5e1, 0x0955c97a, 0x0955ce61, 0x09561f95, 0x09562115, 0x09562195,
+    0x09565a0a, 0x0956723e, 0x0956933e, 0x0956963e, 0x09574f7e, 0x095750fe, 0x0957515d, 0x09575f3a,
+    0x0957c47a, 0x0957c8dd, 0x0957cafa, 0x0957ecfa, 0x0957f17e, 0x0957f2fa, 0x095800de, 0x0958055e,
+    0x095806de, 0x0958bbfe, 0x0958bd7e, 0x0958bdd9, 0x0959aa7a, 0x0959aed5, 0x0959b07a, 0x0959b0fa,
+    0x095a017a, 0x095a1c7a, 0x095a1cfa, 0x095a227a, 0x095a3819, 0x095a3c91, 0x095a3e91, 0x095a6289,
+    0x095a9d59, 0x095aa1d9, 0x095aa3d9, 0x095ab03e, 0x095ab33e, 0x095ac5fe, 0x095aca7e, 0x095acbfe,
+    0x095ad95a, 0x095addda, 0x095ade5a, 0x095adfda, 0x095af386, 0x095b1b55, 0x095b1cd5, 0x095b1d55,
+    0x095b6dfe, 0x095ba016, 0x095ba33a, 0x095ba43a, 0x095bb8fa, 0x095bbd55, 0x095bcc56, 0x095bccd6,
+    0x095bd156, 0x095bd2d6, 0x095be17a, 0x095be5d1, 0x095c1bd2, 0x095c21d2, 0x095c2dfe, 0x095c30fa,
+    0x095c7595, 0x095d1591, 0x095d3c85, 0x095d7add, 0x095d7cdd, 0x095da37e, 0x095da4fe, 0x095da55d,
+    0x095db6fe, 0x095db75d, 0x095db8dd, 0x095e187a, 0x095e1cdd, 0x095e1efa, 0x095e2a5d, 0x095e2c7a,
+    0x095e30dd, 0x095e52fe, 0x095e547a, 0x095e54fa, 0x095e58fe, 0x095e595d, 0x095ee959, 0x095f11d9,
+    0x095f60d5, 0x095ffe7a, 0x0960127a, 0x096026fa, 0x0960464d, 0x0960487a, 0x096062fa, 0x09606efe,
+    0x0960707a, 0x096070fa, 0x0960767a, 0x0960827e, 0x096082cd, 0x0960847a, 0x0960f7d9, 0x09610559,
+    0x09613259, 0x09617155, 0x096199d1, 0x09622555, 0x09632e19, 0x09660761, 0x0966b6fa, 0x0966bd7a,
+    0x09680fe1, 0x096815e1, 0x096821e1, 0x096823e1, 0x096827e1, 0x096829e1, 0x09684a7e, 0x09685e61,
+    0x0968c9e1, 0x0968d97a, 0x0969e19d, 0x096a46dd, 0x096a4b5d, 0x096a4cdd, 0x096a4d5d, 0x096a6f7e,
+    0x096a73fe, 0x096a757e, 0x096a82fe, 0x096a835d, 0x096a87dd, 0x096aeefa, 0x096afadd, 0x096afc7a,
+    0x096afcfa, 0x096b00dd, 0x096b015d, 0x096b02fa, 0x096bb9d9, 0x096c3155, 0x096c9efe, 0x096c9f4d,
+    0x096d16cd, 0x096d187a, 0x096d18fa, 0x096d52fe, 0x096d534d, 0x096dc7d9, 0x096dda59, 0x096ddbd9,
+    0x096e2289, 0x096e2585, 0x096e2681, 0x096e3b55, 0x096e3fd5, 0x096e4d55, 0x096e4ed5, 0x096e4f55,
+    0x096e63d1, 0x096e6851, 0x096e69d1, 0x096e8e49, 0x096e9e7e, 0x096eb07e, 0x096f1dd1, 0x096fa949,
+    0x096fa9c9, 0x096facc5, 0x096fe545, 0x096fe919, 0x096fea99, 0x096feb19, 0x096ff41d, 0x09701c3e,
+    0x097021c5, 0x0970253d, 0x09702599, 0x09702719, 0x09706e9d, 0x0970a15d, 0x0970acdd, 0x0970ae5d,
+    0x0970aedd, 0x0970b2dd, 0x0970b35d, 0x0970b4dd, 0x0970d57e, 0x0970d6fe, 0x0970d75d, 0x0970db7e,
+    0x0970dbdd, 0x0970e8fe, 0x0970e95d, 0x0970eadd, 0x0970ef5d, 0x097114c5, 0x09711815, 0x09711895,
+    0x09711a39, 0x09714edd, 0x0971507a, 0x097150fa, 0x09715289, 0x09715309, 0x0971625d, 0x0971647a,
+    0x097168dd, 0x09718f09, 0x0971c63d, 0x0971da3d, 0x0971db3d, 0x09720dd9, 0x0972100d, 0x0972197d,
+    0x09721afd, 0x09721b7d, 0x09721fd9, 0x09722159, 0x0972383e, 0x097241fe, 0x0972437e, 0x097243fd,
+    0x097247fe, 0x0972557e, 0x097255fd, 0x0972577d, 0x0972638d, 0x0972683d, 0x09728555, 0x09728a8d,
+    0x09728f3d, 0x097292fd, 0x0972947d, 0x097294fd, 0x097298d5, 0x0972add1, 0x0972c8cd, 0x0972ca4d,
+    0x0972cacd, 0x0972cd7d, 0x0972d07d, 0x0972d3c9, 0x0972d4c5, 0x0972e3fe, 0x0972e57e, 0x0972f17e,
+    0x0972f2fe, 0x0972f34d, 0x0972f5fe, 0x0972f8fe, 0x0972fbfe, 0x097304fe, 0x0973054d, 0x097306cd,
+    0x0973097e, 0x097309fd, 0x09736acd, 0x09736c7a, 0x09736cfa, 0x09736f7d, 0x09737e4d, 0x0973e149,
+    0x0973e1c9, 0x0973e4c5, 0x0973edc5, 0x0973f115, 0x0973f195, 0x0973f315, 0x0973ff15, 0x09740095,
+    0x0974210d, 0x0974228d, 0x0974230d, 0x09742b89, 0x09742c09, 0x09743bd9, 0x09745011, 0x09745191,
+    0x09745d3d, 0x09745d8d, 0x09745f0d, 0x09746809, 0x0974a155, 0x0974b4d5, 0x0974c9d1, 0x0974d74d,
+    0x0974d94d, 0x0974e4f9, 0x0974e679, 0x0974e6f9, 0x0974efc9, 0x0974f0c5, 0x09752179, 0x097522f9,
+    0x09752ef9, 0x09754311, 0x097544b9, 0x0975500d, 0x0975508d, 0x09755239, 0x09755b09, 0x09758a89,
+    0x09758b09, 0x09759479, 0x097595f9, 0x09759679, 0x09759a79, 0x09759af9, 0x09759c79, 0x0975a7f9,
+    0x0975a879, 0x0975a9f9, 0x0975c709, 0x0975d07d, 0x0975d0f9, 0x0975d279, 0x0975d6f9, 0x097669c9,
+    0x09766cc5, 0x097675c5, 0x09767991, 0x09767b11, 0x0976948d, 0x0976960d, 0x09769f19, 0x097759dd,
+    0x09775cc9, 0x09775fc5, 0x097768c5, 0x09776c91, 0x09776e16, 0x0977878d, 0x09778916, 0x09779216,
+    0x0977d366, 0x0977d88d, 0x0977da0d, 0x0977e311, 0x0977fa62, 0x0977fbe2, 0x097807dd, 0x0978095d,
+    0x09782009, 0x09782091, 0x09782391, 0x097832d5, 0x09783755, 0x097838d5, 0x09784655, 0x09784b55,
+    0x09784cd5, 0x09785b51, 0x09785c05, 0x09785fd1, 0x09786165, 0x097871ca, 0x09788245, 0x097885e9,
+    0x097888e9, 0x0978adc9, 0x0978ae61, 0x0978b161, 0x0978d4e5, 0x0978d969, 0x0978dad1, 0x0978db51,
+    0x0978fbe5, 0x0978ff49, 0x09790245, 0x097913ca, 0x09793a25, 0x09793ac5, 0x09793ea9, 0x09794025,
+    0x097940a9, 0x09794fc9, 0x097962a5, 0x09796345, 0x09796729, 0x097968a1, 0x09796921, 0x09797625,
+    0x097976a5, 0x09797b29, 0x09797ca1, 0x09798a51, 0x09798ad1, 0x09798ed1, 0x09798f51, 0x097990d5,
+    0x0979a4c1, 0x0979dc21, 0x0979dcc5, 0x0979e0a1, 0x0979e225, 0x0979efa5, 0x0979f029, 0x0979f425,
+    0x0979f4a9, 0x097a182a, 0x097a18a1, 0x097a1ca1, 0x097a1d21, 0x097a1ea1, 0x097a3f85, 0x097a5359,
+    0x097a5561, 0x097a66d9, 0x097a6759, 0x097a7bd9, 0x097a7de9, 0x097a827e, 0x097aac66, 0x097ab18d,
+    0x097ab30d, 0x097abc3d, 0x097ad362, 0x097ad4e2, 0x097ae0da, 0x097ae259, 0x097af765, 0x097afb7e,
+    0x097afbfe, 0x097afd7e, 0x097b367e, 0x097b397e, 0x097b84a5, 0x097b9afd, 0x097ba48d, 0x097ba616,
+    0x097bacd5, 0x097baf3e, 0x097bc0c1, 0x097bc662, 0x097bd3d5, 0x097bf066, 0x097bfca1, 0x097bfe25,
+    0x097c0b66, 0x097c1025, 0x097c10a9, 0x097c1466, 0x097c24d1, 0x097c2651, 0x097c38a1, 0x097c3921,
+    0x097c3aa1, 0x097c3ce2, 0x097c80c1, 0x097c83c1, 0x097c858d, 0x097c8e89, 0x097c9185, 0x097cfa89,
+    0x097cfd85, 0x097d05d9, 0x097d0699, 0x097d0a59, 0x097d0bd9, 0x097dbe49, 0x097dc145, 0x097ded89,
+    0x097df085, 0x097df8d5, 0x097df995, 0x097dfd55, 0x097dfed6, 0x097e37fe, 0x097e3afe, 0x097e695d,
+    0x097e6add, 0x097e86d1, 0x097e8b51, 0x097e8cd1, 0x097e8d51, 0x097eadc5, 0x097eb149, 0x097eb445,
+    0x097ec5ca, 0x097eec19, 0x097ef099, 0x097ef225, 0x097ef2a9, 0x097f1499, 0x097f1919, 0x097f1a99,
+    0x097f2819, 0x097f2899, 0x097f2d19, 0x097f2e99, 0x097f4246, 0x097f65a5, 0x097f6a29, 0x097f6b95,
+    0x097f6c15, 0x097fa48a, 0x097fa786, 0x097fbc91, 0x097fbd11, 0x097fcd0a, 0x097fd006, 0x097fdda5,
+    0x097fe405, 0x09800d95, 0x09801b15, 0x09801b95, 0x09801f95, 0x09802015, 0x09802195, 0x0980468a,
+    0x09807291, 0x098089c9, 0x09808cc5, 0x098095c5, 0x098099a5, 0x09809b25, 0x0980a759, 0x0980a951,
+    0x0980c689, 0x0980c985, 0x0980d1d5, 0x0980d67d, 0x0980d7fe, 0x09810c99, 0x09810ea9, 0x09813519,
+    0x09814259, 0x098143d9, 0x0981489a, 0x0981491a, 0x09817425, 0x09818825, 0x09819ca5, 0x0981d8a5,
+    0x0981f649, 0x0981f945, 0x098201a6, 0x0982027d, 0x0982063d, 0x098207bd, 0x09822815, 0x09822995,
+    0x09823555, 0x098236d6, 0x09823b96, 0x09823c16, 0x09823d96, 0x09825091, 0x09826ffe, 0x098272fe,
+    0x09827b3e, 0x09827bfe, 0x09827fbe, 0x09828126, 0x09828e92, 0x0982d4c1, 0x0982d7c1, 0x0982d98d,
+    0x0982e289, 0x0982e585, 0x09833766, 0x09833c8d, 0x09833e0d, 0x09834709, 0x09834e89, 0x09835185,
+    0x098359d9, 0x09835a85, 0x09835e59, 0x09835fd9, 0x09836bfa, 0x09836d59, 0x098371d9, 0x098425c9,
+    0x09842f8d, 0x09843115, 0x09843a3e, 0x09844189, 0x098444a5, 0x09844ce5, 0x09844d85, 0x09845155,
+    0x098452d5, 0x09845ed5, 0x09847b66, 0x09849666, 0x09849f66, 0x0984afd1, 0x0984b165, 0x0984b5d1,
+    0x0984bd4d, 0x0984bee5, 0x0984c7c9, 0x09855425, 0x09857c2a, 0x09858119, 0x09858299, 0x0985cda5,
+    0x09861e25, 0x09863509, 0x09863805, 0x09864d25, 0x09867415, 0x09868115, 0x0986bd05, 0x0986fb25,
+    0x0986fca5, 0x09871a89, 0x09871d85, 0x098725d5, 0x09872a7d, 0x09872bfe, 0x098762a5, 0x098788fa,
+    0x09878a51, 0x09878efd, 0x0987964d, 0x098797cd, 0x0987a0fd, 0x0987da25, 0x0987dc25, 0x098855a6,
+    0x09885a3d, 0x09885bbd, 0x098867a6, 0x09886926, 0x09886dbd, 0x09887bd1, 0x0988894d, 0x09888ad5,
+    0x09889015, 0x098893fe, 0x0988b366, 0x0988cf3e, 0x0988d3be, 0x0988d526, 0x0988d766, 0x0988e13e,
+    0x0988e2a6, 0x0988e726, 0x098909a5, 0x09890b25, 0x09890fbd, 0x098b5759, 0x098b5bd1, 0x098b5d55,
+    0x098b5dd1, 0x098b7e59, 0x098b81c9, 0x098b84c5, 0x098b964a, 0x098bbc99, 0x098bc119, 0x098bc329,
+    0x098bd249, 0x098be519, 0x098be999, 0x098beb19, 0x098beba1, 0x098bf899, 0x098bf919, 0x098bfd99,
+    0x098bff19, 0x098c3aa9, 0x098c3c15, 0x098c3c95, 0x098c750a, 0x098c7806, 0x098c7902, 0x098c8d11,
+    0x098c9d8a, 0x098ca086, 0x098cd815, 0x098cde15, 0x098ceb95, 0x098cec15, 0x098cf015, 0x098cf095,
+    0x098d0091, 0x098d170a, 0x098d2785, 0x098d3caa, 0x098d4111, 0x098d4311, 0x098d5701, 0x098d79d9,
+    0x098d7e7e, 0x098e0599, 0x098e327e, 0x098e357e, 0x098e73be, 0x098eafbe, 0x098ef895, 0x098efa15,
+    0x098efaa1, 0x098f0c16, 0x098f0c96, 0x098f2111, 0x098f2329, 0x098f5d12, 0x098f5f12, 0x098f7301,
+    0x099037cd, 0x0990fb9d, 0x0991ab1d, 0x0991e819, 0x0991ec95, 0x0991ee15, 0x0991ee95, 0x09923f11,
+    0x09926019, 0x09931c69, 0x09931de9, 0x09931e69, 0x09932c11, 0x09935305, 0x09939169, 0x099395e9,
+    0x099397e9, 0x0993b9ea, 0x0993be69, 0x0993bfea, 0x0993c70d, 0x0993cd6a, 0x0993cde9, 0x0993d1e9,
+    0x0993d269, 0x0993d3e9, 0x09940899, 0x09940a99, 0x0994841a, 0x0995338e, 0x09954c91, 0x09954e91,
+    0x0995b1e9, 0x0995b3e9, 0x0995da69, 0x0995dbea, 0x09968b4d, 0x09968bcd, 0x09974f1d, 0x09974f9d,
+    0x09977ecd, 0x09978ad6, 0x0997c93e, 0x0997f349, 0x0997f3c9, 0x0997f6c5, 0x0997fea9, 0x0997ff1d,
+    0x0998031d, 0x0998039d, 0x0998051d, 0x0998129d, 0x09985019, 0x0998a099, 0x0998b789, 0x0998ba85,
+    0x099947e9, 0x099949e9, 0x09997069, 0x099971e9, 0x09997269, 0x09998469, 0x099985e9, 0x09999211,
+    0x0999a409, 0x0999b795, 0x0999b905, 0x0999cc89, 0x0999e569, 0x0999e9e9, 0x0999f385, 0x0999f769,
+    0x0999f969, 0x0999fde9, 0x099a1fe9, 0x099a216a, 0x099a21e9, 0x099a25e9, 0x099a2669, 0x099a27e9,
+    0x099a3369, 0x099a33e9, 0x099a5e99, 0x099ad79a, 0x099ad81a, 0x099bc2d6, 0x099bcb15, 0x099c013e,
+    0x099c05e9, 0x099c07e9, 0x099c0d06, 0x099c19e9, 0x099c2f91, 0x099c3b0d, 0x099c3b8d, 0x099c3d0d,
+    0x099c41e9, 0x099c4269, 0x099c43e9, 0x099c61c9, 0x099c64c5, 0x099c6dc5, 0x099c7191, 0x099c7311,
+    0x099c7aa2, 0x099c83a2, 0x099c86a2, 0x099c8c8d, 0x099c8e0d, 0x099c9709, 0x099cd87e, 0x099cdd8d,
+    0x099cdf0d, 0x099ce809, 0x099cefa2, 0x099cf2a2, 0x099cff62, 0x099d00e2, 0x099d0cd9, 0x099d0e59,
+    0x099d12d9, 0x099dc6c9, 0x099dd08d, 0x099dd211, 0x099ddb09, 0x099de2a2, 0x099de5a2, 0x099df262,
+    0x099df3e2, 0x099dffd5, 0x099e0161, 0x099e05d5, 0x099e1c7e, 0x099e377e, 0x099e407e, 0x099e50d1,
+    0x099e5251, 0x099e56d1, 0x099e5fe2, 0x099e68e2, 0x099ece49, 0x099ee719, 0x099f5a95, 0x099f6e15,
+    0x099f8311, 0x099f8911, 0x099faa05, 0x099fad09, 0x099fb101, 0x099fee21, 0x09a038aa, 0x09a03d11,
+    0x09a03f2a, 0x09a04f09, 0x09a0532a, 0x09a08ea2, 0x09a09c21, 0x09a09da1, 0x09a0a98d, 0x09a0ab0d,
+    0x09a0b43d, 0x09a0cb62, 0x09a0cce2, 0x09a0d8d5, 0x09a0da55, 0x09a0defd, 0x09a129d1, 0x09a12b51,
+    0x09a12ffd, 0x09a16449, 0x09a16745, 0x09a17b21, 0x09a17b41, 0x09a17c95, 0x09a17d21, 0x09a18ea1,
+    0x09a18f21, 0x09a19095, 0x09a1a3a1, 0x09a1a511, 0x09a1a5a1, 0x09a1abbe, 0x09a1b885, 0x09a1b981,
+    0x09a1dfaa, 0x09a1e021, 0x09a1e191, 0x09a1f581, 0x09a1fb22, 0x09a208ba, 0x09a20a21, 0x09a20ebd,
+    0x09a21cd1, 0x09a21e51, 0x09a222fd, 0x09a22be2, 0x09a2547e, 0x09a25911, 0x09a25b2a, 0x09a26f2a,
+    0x09a2787e, 0x09a2823e, 0x09a283be, 0x09a2883e, 0x09a2aaa2, 0x09a2ac22, 0x09a2b0a2, 0x09a2de89,
+    0x09a2e185, 0x09a2e9d5, 0x09a2ea85, 0x09a2ee55, 0x09a2efd5, 0x09a2f289, 0x09a2f585, 0x09a2fdd5,
+    0x09a2fe85, 0x09a30255, 0x09a303d5, 0x09a331cd, 0x09a3334d, 0x09a333fe, 0x09a33c49, 0x09a33cfe,
+    0x09a34392, 0x09a34692, 0x09a34f92, 0x09a35a4d, 0x09a35bcd, 0x09a364dd, 0x09a36e4d, 0x09a36fcd,
+    0x09a378d9, 0x09a3f5ba, 0x09a3f71d, 0x09a4199d, 0x09a41e3a, 0x09a41f9d, 0x09a42d9d, 0x09a42e45,
+    0x09a4323a, 0x09a4339d, 0x09a44d4d, 0x09a44ecd, 0x09a457c9, 0x09a4614d, 0x09a462cd, 0x09a46bd5,
+    0x09a487c9, 0x09a4931d, 0x09a4979d, 0x09a4991d, 0x09a49b49, 0x09a49bfe, 0x09a4a51d, 0x09a4a69d,
+    0x09a4a73e, 0x09a4a7fe, 0x09a4ab1d, 0x09a4abbe, 0x09a4ad3e, 0x09a4c3c9, 0x09a4cd9d, 0x09a4cf29,
+    0x09a4d39d, 0x09a4e19d, 0x09a4e31d, 0x09a53b11, 0x09a58c19, 0x09a5ae91, 0x09a5d585, 0x09a613e9,
+    0x09a61869, 0x09a619e9, 0x09a61a69, 0x09a63c69, 0x09a640e9, 0x09a64269, 0x09a64fe9, 0x09a65069,
+    0x09a654e9, 0x09a65669, 0x09a6b5e9, 0x09a6ba69, 0x09a6bbe9, 0x09a6c969, 0x09a6c9e9, 0x09a6cde9,
+    0x09a6ce69, 0x09a6cfe9, 0x09a6f409, 0x09a6f669, 0x09a6fd8d, 0x09a6ff0d, 0x09a70809, 0x09a7264d,
+    0x09a727cd, 0x09a730fd, 0x09a73a4d, 0x09a73bcd, 0x09a744fd, 0x09a76c19, 0x09a770bd, 0x09a7723d,
+    0x09a77e19, 0x09a77f99, 0x09a7803e, 0x09a7843d, 0x09a784be, 0x09a7863e, 0x09a7a699, 0x09a7a819,
+    0x09a7ba99, 0x09a7bc19, 0x09a7cf29, 0x09a7d091, 0x09a7d111, 0x09a7e405, 0x09a7f509, 0x09a7f805,
+    0x09a80c85, 0x09a80d81, 0x09a82269, 0x09a83469, 0x09a835e9, 0x09a83669, 0x09a85ce9, 0x09a85e69,
+    0x09a86a3a, 0x09a86b8d, 0x09a87069, 0x09a870e9, 0x09a87269, 0x09a874bd, 0x09a89995, 0x09a89b15,
+    0x09a89fbd, 0x09a8ad95, 0x09a8af15, 0x09a8cf8d, 0x09a8d669, 0x09a8d7e9, 0x09a8e30d, 0x09a8e3be,
+    0x09a8e53e, 0x09a8e9e9, 0x09a8ea69, 0x09a8ebe9, 0x09a8ee3e, 0x09a90b8d, 0x09a91269, 0x09a934a9,
+    0x09a93629, 0x09a93f29, 0x09a946a9, 0x09a949a9, 0x09a951e9, 0x09a952a9, 0x09a95669, 0x09a957e9,
+    0x09a963e9, 0x09a96569, 0x09a969e9, 0x09a985e9, 0x09a98769, 0x09a987e9, 0x09a99069, 0x09a990e9,
+    0x09a9b4e9, 0x09a9b669, 0x09a9bae9, 0x09a9c269, 0x09a9c3e9, 0x09a9cce9, 0x09aa499e, 0x09aa4b1e,
+    0x09aa81a9, 0x09aa8629, 0x09aa87a9, 0x09aa93a9, 0x09aa9529, 0x09aa99a9, 0x09aaa7e9, 0x09aaade9,
+    0x09aab569, 0x09aab6e9, 0x09aabfe9, 0x09aadf69, 0x09aaef69, 0x09aaefe9, 0x09aaff29, 0x09aaffa9,
+    0x09ab0129, 0x09ab0ca9, 0x09ab0d29, 0x09ab1329, 0x09ab35a9, 0x09ab3729, 0x09ab3ba9, 0x09aba12a,
+    0x09ac7bea, 0x09ac7fea, 0x09ac81ea, 0x09aca3ea, 0x09acaa6a, 0x09ad226a, 0x09ad80e9, 0x09ad8269,
+    0x09ad8e69, 0x09ad8fe9, 0x09add229, 0x09add3a9, 0x09add429, 0x09ade629, 0x09ade7a9, 0x09ae0ea9,
+    0x09ae1029, 0x09ae492a, 0x09ae4c2a, 0x09ae886a, 0x09ae89ea, 0x09ae8a6a, 0x09ae8e6a, 0x09ae9bea,
+    0x09ae9c6a, 0x09ae9dea, 0x09aec4ea, 0x09aec66a, 0x09af01a9, 0x09af0329, 0x09af3729, 0x09af3929,
+    0x09af3dea, 0x09af3e6a, 0x09af738e, 0x09b1c8d1, 0x09b1ced1, 0x09b1cf55, 0x09b1efc5, 0x09b1f355,
+    0x09b1f655, 0x09b207ca, 0x09b22e19, 0x09b23299, 0x09b23425, 0x09b25699, 0x09b25b19, 0x09b25c99,
+    0x09b25d21, 0x09b26a19, 0x09b26a99, 0x09b26f19, 0x09b27099, 0x09b2a7a5, 0x09b2ad95, 0x09b2ae15,
+    0x09b2e68a, 0x09b2e986, 0x09b2fe91, 0x09b2ff11, 0x09b30f0a, 0x09b31206, 0x09b32309, 0x09b32605,
+    0x09b34995, 0x09b34e15, 0x09b34f95, 0x09b35d15, 0x09b35d95, 0x09b36195, 0x09b36215, 0x09b36395,
+    0x09b37211, 0x09b37691, 0x09b3888a, 0x09b3ae11, 0x09b3ae91, 0x09b3b291, 0x09b3b311, 0x09b3b491,
+    0x09b3ead5, 0x09b3eb55, 0x09b3ef7e, 0x09b43c99, 0x09b47719, 0x09b47899, 0x09b47921, 0x09b4a6fe,
+    0x09b4dea5, 0x09b51aa5, 0x09b51b25, 0x09b5213e, 0x09b56a15, 0x09b56b95, 0x09b57d96, 0x09b57e16,
+    0x09b57f96, 0x09b59291, 0x09b5d092, 0x09b85995, 0x09b85e19, 0x09b85f95, 0x09b86015, 0x09b8b111,
+    0x09b8d185, 0x09b8d509, 0x09b8d805, 0x09b98965, 0x09b98f65, 0x09b98fe5, 0x09b99d91, 0x09ba02e5,
+    0x09ba0765, 0x09ba08e5, 0x09ba2b65, 0x09ba2fe5, 0x09ba3165, 0x09ba3ee5, 0x09ba3f65, 0x09ba4365,
+    0x09ba43e5, 0x09ba4565, 0x09ba7a19, 0x09ba7b95, 0x09ba7c15, 0x09ba9091, 0x09bacc91, 0x09bacd11,
+    0x09bb6f65, 0x09bb97e5, 0x09bba07a, 0x09bbab65, 0x09bbabe5, 0x09bbbe11, 0x09bc1165, 0x09bc1cfe,
+    0x09bc2365, 0x09bc24e5, 0x09bc4be5, 0x09bc4d65, 0x09bead95, 0x09bec195, 0x09bed611, 0x09bf1211,
+    0x09bf2909, 0x09bf2c05, 0x09bf4fa5, 0x09bfb4e5, 0x09bfbae5, 0x09bfdd65, 0x09bfe365, 0x09bfe3e5,
+    0x09bff0e5, 0x09bff165, 0x09bff765, 0x09c02a85, 0x09c056e5, 0x09c05b65, 0x09c05ce5, 0x09c068e5,
+    0x09c06a65, 0x09c09165, 0x09c092e5, 0x09c09365, 0x09c09765, 0x09c097e5, 0x09c09965, 0x09c0a4e5,
+    0x09c0a565, 0x09c0d015, 0x09c1c365, 0x09c1ff65, 0x09c1ffe5, 0x09c21365, 0x09c27765, 0x09c278e5,
+    0x09c28ae5, 0x09c2b365, 0x09c2b3e5, 0x09c2b565, 0x09c2e555, 0x09c37321, 0x09c41511, 0x09c52a19,
+    0x09c52e99, 0x09c53015, 0x09c53095, 0x09c58111, 0x09c58191, 0x09c5a589, 0x09c5a885, 0x09c65fe1,
+    0x09c66061, 0x09c66e11, 0x09c67291, 0x09c67495, 0x09c69505, 0x09c6d361, 0x09c6d7e1, 0x09c6fbe1,
+    0x09c70061, 0x09c701e1, 0x09c70261, 0x09c70f61, 0x09c70fe1, 0x09c713e1, 0x09c71461, 0x09c715e1,
+    0x09c7267e, 0x09c76119, 0x09c79d19, 0x09c79d99, 0x09c7e13e, 0x09c86efe, 0x09c89091, 0x09c8953e,
+    0x09c8e1e1, 0x09c8f3e1, 0x09c8f5fd, 0x09c91c61, 0x09c91de1, 0x09c91e61, 0x09c96f99, 0x09c97419,
+    0x09c97595, 0x09c97615, 0x09c9c691, 0x09c9c711, 0x09c9ea9e, 0x09caa55d, 0x09caa5dd, 0x09cab391,
+    0x09cb18dd, 0x09cb1d5d, 0x09cb415d, 0x09cb45dd, 0x09cb475d, 0x09cb54de, 0x09cb555e, 0x09cc0bd9,
+    0x09cc1059, 0x09cc11d9, 0x09cc1259, 0x09ccfed5, 0x09cd0355, 0x09cd04d5, 0x09cd0555, 0x09cd55d1,
+    0x09cd5651, 0x09cd76c5, 0x09cd7ef9, 0x09cd8c99, 0x09cd913e, 0x09cdb73e, 0x09cdf1d9, 0x09cdf67e,
+    0x09ce1a59, 0x09ce1efe, 0x09ce2dda, 0x09ce2e5a, 0x09ce325a, 0x09ce32da, 0x09ce717e, 0x09ce71fe,
+    0x09cec27e, 0x09ced98e, 0x09cedc8e, 0x09cedd8e, 0x09cee67e, 0x09ceeb7d, 0x09cef489, 0x09cef785,
+    0x09cf0d55, 0x09cf11fe, 0x09cf1f56, 0x09cf20d6, 0x09cf2156, 0x09cf35d1, 0x09cf3a7e, 0x09cf5606,
+    0x09cf6306, 0x09cf71d2, 0x09cf7252, 0x09d0f9dd, 0x09d1a20d, 0x09d1a28d, 0x09d1d219, 0x09d23759,
+    0x09d25fd9, 0x09d26659, 0x09d27359, 0x09d273d9, 0x09d33a09, 0x09d352d5, 0x09d35955, 0x09d36105,
+    0x09d364d5, 0x09d36655, 0x09d366d5, 0x09d37b51, 0x09d39f49, 0x09d3a245, 0x09d3b5d1, 0x09d3b751,
+    0x09d3c7c9, 0x09d3db49, 0x09d3dbc9, 0x09d48259, 0x09d53efd, 0x09d53f7d, 0x09d57555, 0x09d5ee79,
+    0x09d5eef9, 0x09d5f2fd, 0x09d5f37d, 0x09d87d11, 0x09d8f091, 0x09d91785, 0x09d955e1, 0x09d95be1,
+    0x09d97e61, 0x09d991e1, 0x09d99261, 0x09d9fde1, 0x09da0b61, 0x09da0fe1, 0x09da9911, 0x09db1315,
+    0x09db2605, 0x09db2701, 0x09db6461, 0x09db77e1, 0x09dba061, 0x09dba0e1, 0x09dbb461, 0x09dc19e1,
+    0x09dc2be1, 0x09de488d, 0x09de4a0d, 0x09de710d, 0x09de728d, 0x09df0dd9, 0x09df8155, 0x09dfd251,
+    0x09dff945, 0x09e02355, 0x09e04bd1, 0x09e051d1, 0x09e0b579, 0x09e0b6f9, 0x09e129d9, 0x09e154bd,
+    0x09e17a05, 0x09e18fd5, 0x09e1a355, 0x09e1a3d5, 0x09e1b851, 0x09e1e6fd, 0x09e1f451, 0x09e1f4d1,
+    0x09e20979, 0x09e20f7d, 0x09e21d79, 0x09e2237d, 0x09e26dd1, 0x09e282f9, 0x09e2877d, 0x09e288fd,
+    0x09e294f9, 0x09e29679, 0x09e29afd, 0x09e2bd79, 0x09e2bef9, 0x09e2c37d, 0x09e2dcbe, 0x09e2dfbe,
+    0x09e2e8be, 0x09e2ec7a, 0x09e2edfe, 0x09e2f081, 0x09e2f381, 0x09e2f57e, 0x09e2fe7e, 0x09e3017e,
+    0x09e3077a, 0x09e308fe, 0x09e311fe, 0x09e32dda, 0x09e330c5, 0x09e339c5, 0x09e33d9a, 0x09e33f19,
+    0x09e33fbe, 0x09e3587a, 0x09e359cd, 0x09e362c9, 0x09e36a49, 0x09e36d45, 0x09e37599, 0x09e37645,
+    0x09e37a3a, 0x09e37b99, 0x09e387ba, 0x09e38919, 0x09e38dba, 0x09e3e89e, 0x09e3f19e, 0x09e44b7e,
+    0x09e44cfe, 0x09e455fe, 0x09e45d7e, 0x09e4607e, 0x09e468be, 0x09e4697e, 0x09e46d3e, 0x09e46ebe,
+    0x09e47abe, 0x09e47c3e, 0x09e480be, 0x09e4973e, 0x09e49c8d, 0x09e49e0d, 0x09e49ebe, 0x09e4a709,
+    0x09e4a7be, 0x09e4b23e, 0x09e4cb91, 0x09e4cd11, 0x09e4d191, 0x09e4d90d, 0x09e4da8d, 0x09e4e389,
+    0x09e56ffd, 0x09e5d555, 0x09e5e955, 0x09e5fdd1, 0x09e639d1, 0x09e70979, 0x09e7247a, 0x09e725fe,
+    0x09e72efe, 0x09e7367e, 0x09e7397e, 0x09e741be, 0x09e7427e, 0x09e7463e, 0x09e747be, 0x09e753ba,
+    0x09e7553e, 0x09e759be, 0x09e775ba, 0x09e7770d, 0x09e777be, 0x09e77e7d, 0x09e7803d, 0x09e780be,
+    0x09e7a4ba, 0x09e7a611, 0x09e7aabd, 0x09e7b23a, 0x09e7b38d, 0x09e7bcbd, 0x09e7f5f9, 0x09e7f7d5,
+    0x09e80979, 0x09e809f9, 0x09e81e79, 0x09e8207d, 0x09e829ba, 0x09e8367e, 0x09e8397a, 0x09e83afd,
+    0x09e85af9, 0x09e87179, 0x09e875fa, 0x09e8777d, 0x09e8837a, 0x09e884f9, 0x09e8897a, 0x09e897be,
+    0x09e8993e, 0x09e89dbe, 0x09e8a53e, 0x09e8a6be, 0x09e8afbe, 0x09e8cf3e, 0x09e8df09, 0x09e8dfbe,
+    0x09e8e8f9, 0x09e8ea79, 0x09e8eafe, 0x09e8eefd, 0x09e8ef7e, 0x09e8f0fe, 0x09e8fc79, 0x09e8fcfe,
+    0x09e8fe7e, 0x09e902fe, 0x09e91b89, 0x09e92579, 0x09e926f9, 0x09e92b7d, 0x09e944c9, 0x09e947c5,
+    0x09e950c5, 0x09e95491, 0x09e95611, 0x09e96f8d, 0x09e9710d, 0x09e97a09, 0x09e9bb66, 0x09e9c08d,
+    0x09e9c20d, 0x09e9cb09, 0x09e9e262, 0x09e9e3e2, 0x09e9efd9, 0x09e9f159, 0x09e9f5d9, 0x09eaa9c9,
+    0x09eab38d, 0x09eab539, 0x09eabe09, 0x09ead562, 0x09ead6e2, 0x09eae2d5, 0x09eae479, 0x09eae8d5,
+    0x09eaff66, 0x09eb1a66, 0x09eb2366, 0x09eb33d1, 0x09eb3579, 0x09eb39d1, 0x09eb4be2, 0x09ebdc99,
+    0x09ebde25, 0x09ec4215, 0x09ec6a91, 0x09ec9089, 0x09ec9385, 0x09ecd121, 0x09ecf9ba, 0x09ed7f21,
+    0x09ed80b9, 0x09ed8c8d, 0x09ed8e0d, 0x09ed973d, 0x09edae62, 0x09edafe2, 0x09edbbd5, 0x09edbd66,
+    0x09edc1fd, 0x09ede6a1, 0x09ee0cd1, 0x09ee0e51, 0x09ee12fd, 0x09ee88a5, 0x09eeeba6, 0x09eeed26,
+    0x09eef1bd, 0x09eeffd1, 0x09ef0179, 0x09ef05fd, 0x09ef3766, 0x09ef5b66, 0x09ef6521, 0x09ef66a6,
+    0x09ef6b26, 0x09ef8da2, 0x09ef8f22, 0x09ef93a2, 0x09efc189, 0x09efccd5, 0x09efd155, 0x09efd509,
+    0x09efd589, 0x09efd885, 0x09efe0d5, 0x09efe185, 0x09efe4d5, 0x09efe555, 0x09efe6d5, 0x09f01666,
+    0x09f016cd, 0x09f01f66, 0x09f01fc9, 0x09f03d7d, 0x09f050fd, 0x09f0514d, 0x09f052d9, 0x09f05bd9,
+    0x09f10845, 0x09f110a6, 0x09f11145, 0x09f1151d, 0x09f1169d, 0x09f1304d, 0x09f143d5, 0x09f1444d,
+    0x09f145f9, 0x09f14ed5, 0x09f17639, 0x09f17a9d, 0x09f17e66, 0x09f17ec9, 0x09f18a39, 0x09f18ac5,
+    0x09f18e26, 0x09f18e9d, 0x09f19026, 0x09f1b0bd, 0x09f1c49d, 0x09f24289, 0x09f24585, 0x09f29611,
+    0x09f2fb65, 0x09f2fd65, 0x09f323fe, 0x09f337e5, 0x09f3acfa, 0x09f3b165, 0x09f3d4fa, 0x09f3e08d,
+    0x09f3e239, 0x09f3eb09, 0x09f4094d, 0x09f41cd5, 0x09f41d4d, 0x09f41ed5, 0x09f427fd, 0x09f43a91,
+    0x09f44f19, 0x09f453bd, 0x09f45766, 0x09f45ac5, 0x09f46319, 0x09f46726, 0x09f467bd, 0x09f46926,
+    0x09f489bd, 0x09f49d99, 0x09f51965, 0x09f54d0d, 0x09f54e8d, 0x09f557bd, 0x09f57c95, 0x09f59095,
+    0x09f5c626, 0x09f5c68d, 0x09f5c826, 0x09f5cd65, 0x09f5d126, 0x09f617a5, 0x09f61925, 0x09f62225,
+    0x09f62925, 0x09f629a5, 0x09f62ca5, 0x09f634e5, 0x09f635a5, 0x09f63965, 0x09f63ae5, 0x09f646e5,
+    0x09f64866, 0x09f64ce5, 0x09f66a66, 0x09f66ae5, 0x09f67366, 0x09f673e5, 0x09f697e5, 0x09f69965,
+    0x09f69de5, 0x09f6a565, 0x09f6a6e5, 0x09f6afe5, 0x09f764a6, 0x09f76925, 0x09f76aa5, 0x09f776a6,
+    0x09f77826, 0x09f77ca5, 0x09f78ae5, 0x09f790e5, 0x09f79865, 0x09f7a2e5, 0x09f7c266, 0x09f7d266,
+    0x09f7d2e5, 0x09f7e2a5, 0x09f7e426, 0x09f7f025, 0x09f7f626, 0x09f818a5, 0x09f81ea5, 0x09f95ee6,
+    0x09f96366, 0x09f964e6, 0x09f986e6, 0x09f98be6, 0x09f98d66, 0x09fa0566, 0x09fa63e5, 0x09fa6566,
+    0x09fa70e5, 0x09fa7165, 0x09fa72e5, 0x09fab725, 0x09fabb26, 0x09fabd26, 0x09fac925, 0x09faf1a5,
+    0x09faf325, 0x09fb6b66, 0x09fb6d66, 0x09fbe425, 0x09fbe4a5, 0x09fc1aa5, 0x09fc1c26, 0x09fc20e6,
+    0x09fc2166, 0x09fc2526, 0x09ff1309, 0x09ff1605, 0x09ff6691, 0x09ffcbe1, 0x09ffcde1, 0x09fff47e,
+    0x0a000861, 0x0a007d7a, 0x0a0081e1, 0x0a00a57a, 0x0a010b19, 0x0a016f9a, 0x0a026296, 0x0a028bfa,
+    0x0a029de1, 0x0a031256, 0x0a031b56, 0x0a034b49, 0x0a03569a, 0x0a035b19, 0x0a035d19, 0x0a0387c9,
+    0x0a03931a, 0x0a039799, 0x0a04428e, 0x0a04ba0d, 0x0a04c509, 0x0a04f69d, 0x0a057fd9, 0x0a05f755,
+    0x0a0672f9, 0x0a06f97a, 0x0a071709, 0x0a072279, 0x0a0726f9, 0x0a072879, 0x0a07930d, 0x0a079bd9,
+    0x0a07cf99, 0x0a0856fd, 0x0a0858fd, 0x0a08838e, 0x0a08937d, 0x0a0894fd, 0x0a08dffa, 0x0a08f8fd,
+    0x0a090679, 0x0a090cfd, 0x0a094e09, 0x0a095105, 0x0a095a05, 0x0a095dd1, 0x0a095f56, 0x0a096201,
+    0x0a096516, 0x0a096656, 0x0a0966cd, 0x0a096f56, 0x0a096fc9, 0x0a0972c5, 0x0a0978cd, 0x0a097a56,
+    0x0a098356, 0x0a099f5a, 0x0a09a246, 0x0a09a35a, 0x0a09aa9a, 0x0a09ab46, 0x0a09af19, 0x0a09af46,
+    0x0a09b119, 0x0a09c9cd, 0x0a09cb4d, 0x0a09d449, 0x0a09db7d, 0x0a09dbc9, 0x0a09dec5, 0x0a09e69a,
+    0x0a09e71a, 0x0a09e7c5, 0x0a09eb99, 0x0a09ed19, 0x0a09f91a, 0x0a09fa9a, 0x0a09ff19, 0x0a0a5a0e,
+    0x0a0a631e, 0x0a0a671e, 0x0a0a968e, 0x0a0abccd, 0x0a0abe56, 0x0a0ac756, 0x0a0ace56, 0x0a0acec9,
+    0x0a0ad1f9, 0x0a0ada39, 0x0a0adac5, 0x0a0ade95, 0x0a0ae016, 0x0a0aec15, 0x0a0aed96, 0x0a0af216,
+    0x0a0b0e0d, 0x0a0b0e46, 0x0a0b1039, 0x0a0b1909, 0x0a0b1c06, 0x0a0b3d11, 0x0a0b3eb9, 0x0a0b4311,
+    0x0a0b4a3d, 0x0a0b4a8d, 0x0a0b4c39, 0x0a0b5509, 0x0a0b628a, 0x0a0c097e, 0x0a0cc67d, 0x0a0cc6f9,
+    0x0a0cda79, 0x0a0d7679, 0x0a0d7a7d, 0x0a0d7af9, 0x0a0d7c79, 0x0a0d8879, 0x0a0d89f9, 0x0a0d95cd,
+    0x0a0d9756, 0x0a0da056, 0x0a0da756, 0x0a0da7c9, 0x0a0daac5, 0x0a0db31a, 0x0a0db3fd, 0x0a0db716,
+    0x0a0db7bd, 0x0a0db916, 0x0a0dc51a, 0x0a0dc696, 0x0a0dcb16, 0x0a0de70d, 0x0a0de746, 0x0a0de90d,
+    0x0a0defd9, 0x0a0df23d, 0x0a0e161a, 0x0a0e179a, 0x0a0e1c3d, 0x0a0e233d, 0x0a0e238d, 0x0a0e250d,
+    0x0a0e2e3d, 0x0a0e3b8a, 0x0a0e9b0e, 0x0a0e9f0e, 0x0a0eaafd, 0x0a0eacfd, 0x0a0ee77d, 0x0a0ee8fd,
+    0x0a0efafd, 0x0a0f0911, 0x0a0f0a96, 0x0a0f0f16, 0x0a0f1616, 0x0a0f168d, 0x0a0f1816, 0x0a0f2116,
+    0x0a0f5109, 0x0a0f5406, 0x0a0f5a79, 0x0a0f5c79, 0x0a0f60fd, 0x0a0f6e79, 0x0a0f7f8a, 0x0a0f967d,
+    0x0a0f96f9, 0x0a0f9879, 0x0a0f9cfd, 0x0a0fb8a1, 0x0a0fba21, 0x0a0fc321, 0x0a0fcda2, 0x0a0fda62,
+    0x0a0fdbe2, 0x0a0fe7e1, 0x0a0fe961, 0x0a0fede1, 0x0a1038e1, 0x0a103a61, 0x0a103ee1, 0x0a1117a1,
+    0x0a111921, 0x0a111da1, 0x0a112be1, 0x0a1131e1, 0x0a113ae2, 0x0a119121, 0x0a119721, 0x0a11b9a2,
+    0x0a11bb22, 0x0a11bfa2, 0x0a12ffe2, 0x0a1305e2, 0x0a13a162, 0x0a13a662, 0x0a13a7e2, 0x0a1404e1,
+    0x0a140661, 0x0a146a21, 0x0a146ba1, 0x0a1492a2, 0x0a149422, 0x0a150c62, 0x0a150e62, 0x0a152062,
+    0x0a154862, 0x0a1585a2, 0x0a158722, 0x0a15c1e2, 0x0a15c3e2, 0x0a161e92, 0x0a162192, 0x0a162a92,
+    0x0a162e52, 0x0a162fd2, 0x0a163282, 0x0a16354d, 0x0a1636cd, 0x0a163fd5, 0x0a1648cd, 0x0a16494d,
+    0x0a164acd, 0x0a1653c9, 0x0a166fc9, 0x0a167b19, 0x0a167f99, 0x0a168119, 0x0a168349, 0x0a1683c9,
+    0x0a168d19, 0x0a168e99, 0x0a168f19, 0x0a169319, 0x0a169399, 0x0a169519, 0x0a169a52, 0x0a169bd2,
+    0x0a16a4d2, 0x0a16b5bd, 0x0a16b73d, 0x0a16c93d, 0x0a16c999, 0x0a16cb19, 0x0a16cf99, 0x0a173c8d,
+    0x0a173e0d, 0x0a173e8d, 0x0a17790d, 0x0a177a8d, 0x0a178389, 0x0a178d52, 0x0a178ed2, 0x0a1797d2,
+    0x0a17a895, 0x0a17aa39, 0x0a17ae95, 0x0a17bc15, 0x0a17bc95, 0x0a17be39, 0x0a17c295, 0x0a17de8d,
+    0x0a17e909, 0x0a17f20d, 0x0a17f28d, 0x0a17fd09, 0x0a180d92, 0x0a180f12, 0x0a181392, 0x0a181abd,
+    0x0a18b7d9, 0x0a18dc3d, 0x0a196e79, 0x0a1990fd, 0x0a19957d, 0x0a1996fd, 0x0a19a4f9, 0x0a19a979,
+    0x0a19aaf9, 0x0a19f57a, 0x0a19fbfa, 0x0a1a0a79, 0x0a1a0ef9, 0x0a1a0ffa, 0x0a1a1079, 0x0a1a1c79,
+    0x0a1a1df9, 0x0a1a2279, 0x0a1a22f9, 0x0a1a44fd, 0x0a1a4afd, 0x0a1a58f9, 0x0a1a5a79, 0x0a1a5ef9,
+    0x0a1a6652, 0x0a1a67d2, 0x0a1a70d2, 0x0a1a8195, 0x0a1a8315, 0x0a1a9515, 0x0a1a9595, 0x0a1a9715,
+    0x0a1a9bbd, 0x0a1ab78d, 0x0a1ac23d, 0x0a1acb0d, 0x0a1acb8d, 0x0a1acd0d, 0x0a1ae692, 0x0a1ae812,
+    0x0a1aec92, 0x0a1b37d5, 0x0a1b6051, 0x0a1b6251, 0x0a1b76f9, 0x0a1b7b7d, 0x0a1b7cfd, 0x0a1b88f9,
+    0x0a1b8a79, 0x0a1b8af9, 0x0a1b8efd, 0x0a1b8f7d, 0x0a1b90fd, 0x0a1b9c7e, 0x0a1bb17d, 0x0a1bb2fd,
+    0x0a1bc579, 0x0a1bc6f9, 0x0a1bcb7d, 0x0a1bd992, 0x0a1bdb12, 0x0a1bdf92, 0x0a1c17fa, 0x0a1c2af9,
+    0x0a1c2bfa, 0x0a1c2c79, 0x0a1c30fd, 0x0a1c3e79, 0x0a1c3ef9, 0x0a1c4079, 0x0a1c44fd, 0x0a1c66fd,
+    0x0a2b9e55, 0x0a2b9fd5, 0x0a2ba055, 0x0a2bb255, 0x0a2bc6d1, 0x0a2bc865, 0x0a2c4051, 0x0a2c41d1,
+    0x0a2c65c9, 0x0a2c6745, 0x0a2ca1c5, 0x0a2ca5a5, 0x0a2ca725, 0x0a2ca7a5, 0x0a2cce25, 0x0a2ccfa5,
+    0x0a2cd025, 0x0a2ce1a5, 0x0a2ce225, 0x0a2ce3a5, 0x0a2d47a6, 0x0a2d4926, 0x0a2d49a6, 0x0a2d5b26,
+    0x0a2d5ba6, 0x0a2d83a6, 0x0a2d8426, 0x0a2d85a6, 0x0a2d9565, 0x0a2d97a6, 0x0a2d9cc9, 0x0a2d9fc5,
+    0x0a2da8c5, 0x0a2dac91, 0x0a2dae11, 0x0a2dbc55, 0x0a2dc78d, 0x0a2dc90d, 0x0a2dd215, 0x0a2e0209,
+    0x0a2e11d9, 0x0a2e1366, 0x0a2e188d, 0x0a2e1a0d, 0x0a2e2311, 0x0a2e2a89, 0x0a2e2d85, 0x0a2e3685,
+    0x0a2e3a59, 0x0a2e3bd9, 0x0a2e47d9, 0x0a2e4959, 0x0a2ea449, 0x0a2eafa5, 0x0a2eb425, 0x0a2eb625,
+    0x0a2eec25, 0x0a2ef0a5, 0x0a2ef225, 0x0a2f0425, 0x0a2f0b8d, 0x0a2f0d0d, 0x0a2f1625, 0x0a2f1d89,
+    0x0a2f2085, 0x0a2f29a5, 0x0a2f2d65, 0x0a2f2ee5, 0x0a2f3ad5, 0x0a2f3c55, 0x0a2f65a5, 0x0a2f70cd,
+    0x0a2f7266, 0x0a2f7b66, 0x0a2f8bd1, 0x0a2f8d51, 0x0a2f994d, 0x0a2f9acd, 0x0a2fa1a5, 0x0a2fa3e5,
+    0x0a32bb55, 0x0a330f25, 0x0a3335a5, 0x0a333625, 0x0a3349a5, 0x0a33af26, 0x0a33c326, 0x0a341d0d,
+    0x0a342619, 0x0a345609, 0x0a3465d9, 0x0a346766, 0x0a349d59, 0x0a34e0d5, 0x0a350be5, 0x0a350d45,
+    0x0a3511c5, 0x0a3515a5, 0x0a351725, 0x0a3517a5, 0x0a351ba5, 0x0a3555c9, 0x0a359055, 0x0a35c4cd,
+    0x0a3910d1, 0x0a397622, 0x0a399ea1, 0x0a39a021, 0x0a3a1821, 0x0a3b2e55, 0x0a3b2ed1, 0x0a3b41c5,
+    0x0a3b42c1, 0x0a3b6a45, 0x0a3b8021, 0x0a3b9222, 0x0a3b9421, 0x0a3bbaa1, 0x0a3bbc21, 0x0a3bbca1,
+    0x0a3bcea1, 0x0a3fa1a9, 0x0a3fa315, 0x0a3fa395, 0x0a3ff411, 0x0a407e0a, 0x0a40cd45, 0x0a40d129,
+    0x0a40d2a9, 0x0a413f6a, 0x0a41486a, 0x0a4167cd, 0x0a416e99, 0x0a4170c9, 0x0a417319, 0x0a4179d9,
+    0x0a417b59, 0x0a418459, 0x0a4192c9, 0x0a4196c1, 0x0a41ab95, 0x0a41b215, 0x0a41bf15, 0x0a41bf95,
+    0x0a41d411, 0x0a41e18e, 0x0a421011, 0x0a422ba9, 0x0a422dc9, 0x0a4230c5, 0x0a4239c5, 0x0a423daa,
+    0x0a423f29, 0x0a425356, 0x0a426195, 0x0a4263c9, 0x0a4266d6, 0x0a427756, 0x0a42a52a, 0x0a42a76a,
+    0x0a42c851, 0x0a42cfc9, 0x0a42d929, 0x0a42db29, 0x0a42dbc5, 0x0a42dfa9, 0x0a42e129, 0x0a45f795,
+    0x0a46e705, 0x0a47934d, 0x0a479c49, 0x0a47cdcd, 0x0a47cf4d, 0x0a47d849, 0x0a48478d, 0x0a48498d,
+    0x0a484c09, 0x0a484f05, 0x0a485385, 0x0a485729, 0x0a488b29, 0x0a4891a9, 0x0a489329, 0x0a48c256,
+    0x0a48cb56, 0x0a48fb49, 0x0a4904a9, 0x0a4906a9, 0x0a490b29, 0x0a4918a9, 0x0a4940a9, 0x0a494129,
+    0x0a4942a9, 0x0a494729, 0x0a4e3cd9, 0x0a4eded1, 0x0a54108d, 0x0a54120d, 0x0a541b19, 0x0a542289,
+    0x0a542585, 0x0a542e99, 0x0a543259, 0x0a5433d9, 0x0a543fd5, 0x0a544155, 0x0a5463cd, 0x0a5475cd,
+    0x0a54774d, 0x0a547a49, 0x0a548059, 0x0a5490d1, 0x0a549251, 0x0a549e4d, 0x0a549fcd, 0x0a54a249,
+    0x0a54a2c9, 0x0a54a8d9, 0x0a54d5d1, 0x0a54e415, 0x0a54e649, 0x0a54e945, 0x0a54f9c9, 0x0a55180d,
+    0x0a551a0d, 0x0a551c89, 0x0a5527a9, 0x0a553529, 0x0a5535c5, 0x0a5539aa, 0x0a553b29, 0x0a554ac9,
+    0x0a555ba9, 0x0a555d29, 0x0a555da9, 0x0a555e45, 0x0a556229, 0x0a5563a9, 0x0a556f29, 0x0a556fa9,
+    0x0a557129, 0x0a5575a9, 0x0a5583d1, 0x0a558551, 0x0a55914d, 0x0a5592cd, 0x0a5595c9, 0x0a5598c5,
+    0x0a55a94a, 0x0a55d529, 0x0a55d6a9, 0x0a55d729, 0x0a55e545, 0x0a55e8a9, 0x0a55e929, 0x0a55eaa9,
+    0x0a560dc5, 0x0a561129, 0x0a5611a9, 0x0a561329, 0x0a5a9555, 0x0a5ac9cd, 0x0a5acdc9, 0x0a5b44cd,
+    0x0a5b4de9, 0x0a5b7f8d, 0x0a5b8029, 0x0a5b80c5, 0x0a5b8409, 0x0a5b8489, 0x0a5b88a9, 0x0a5b89e9,
+    0x0a5b8daa, 0x0a5b8f29, 0x0a5b9ca9, 0x0a5bc3a9, 0x0a5bc529, 0x0a5bc9a9, 0x0a5bfd4a, 0x0a5c3945,
+    0x0a5c3ca9, 0x0a5c3d29, 0x0a5c3ea9, 0x0a5ef455, 0x0a5fa849, 0x0a5fe9bd, 0x0a602439, 0x0a6089a6,
+    0x0a609d22, 0x0a61f1a1, 0x0a653451, 0x0a6535d5, 0x0a659999, 0x0a65c219, 0x0a65c399, 0x0a65c419,
+    0x0a65d619, 0x0a65d799, 0x0a660f45, 0x0a661339, 0x0a661495, 0x0a661515, 0x0a664d8a, 0x0a666591,
+    0x0a668989, 0x0a668a09, 0x0a66b726, 0x0a66ef8a, 0x0a67e019, 0x0a67e499, 0x0a682395, 0x0a68530e,
+    0x0a689889, 0x0a68d315, 0x0a68d7a6, 0x0a6c6355, 0x0a6c7c95, 0x0a6cdd89, 0x0a6cdf39, 0x0a6d58a6,
+    0x0a6eb939, 0x0a6ebaa5, 0x0a6ebb3d, 0x0a6ebd89, 0x0a6ec085, 0x0a6ec3a5, 0x0a6ec539, 0x0a72e3a2,
+    0x0a72e522, 0x0a72e595, 0x0a733611, 0x0a73c00a, 0x0a74ed95, 0x0a750122, 0x0a750195, 0x0a751611,
+    0x0a755211, 0x0a755291, 0x0a79c6ed, 0x0a79c76d, 0x0a7a3eed, 0x0a7a676d, 0x0a7a68ed, 0x0a7a696d,
+    0x0a7a7aed, 0x0a7a7b6d, 0x0a7a7ced, 0x0a7af72e, 0x0a7b1b2d, 0x0a7b41ad, 0x0a7ba6ed, 0x0a7bcf6d,
+    0x0a7bd5ed, 0x0a7be2ed, 0x0a7be36d, 0x0a7c562e, 0x0a7c5f2e, 0x0a7c7eae, 0x0a7c856d, 0x0a7c89ed,
+    0x0a801aed, 0x0a801b6d, 0x0a8092ed, 0x0a8094fd, 0x0a80a6fd, 0x0a80ceed, 0x0a80cf6d, 0x0a80e2ed,
+    0x0a81ef89, 0x0a81faed, 0x0a81fb85, 0x0a81ff79, 0x0a82017d, 0x0a820efd, 0x0a823579, 0x0a8236ed,
+    0x0a82376d, 0x0a824979, 0x0a824aed, 0x0a82aa3e, 0x0a82e48d, 0x0a82e60d, 0x0a8ec009, 0x0a8ecb6d,
+    0x0a8ecff9, 0x0a8ed16d, 0x0a8ed1fd, 0x0a8f07ed, 0x0a8f0c79, 0x0a8f0ded, 0x0a8f1ff9, 0x0a8f817d,
+    0x0a8fbd6d, 0x0a94b719, 0x0a94fc95, 0x0a952789, 0x0a95283d, 0x0a952939, 0x0a952d85, 0x0a953179,
+    0x0a9532ed, 0x0a95337d, 0x0a9535be, 0x0a953779, 0x0a9538be, 0x0a95688d, 0x0a957189, 0x0a95ac15,
+    0x0a95e83e, 0x0aa0f38d, 0x0aa0f50d, 0x0aa0fe09, 0x0aa10589, 0x0aa10885, 0x0aa11185, 0x0aa11555,
+    0x0aa116d5, 0x0aa122d5, 0x0aa12455, 0x0aa128d5, 0x0aa146cd, 0x0aa14fc9, 0x0aa158cd, 0x0aa15a66,
+    0x0aa16366, 0x0aa173d1, 0x0aa17551, 0x0aa179d1, 0x0aa1814d, 0x0aa182cd, 0x0aa18bc9, 0x0aa21ca5,
+    0x0aa24525, 0x0aa246a5, 0x0aa252a5, 0x0aa25425, 0x0aa266d1, 0x0aa26879, 0x0aa26ce5, 0x0aa2744d,
+    0x0aa275f9, 0x0aa27ee5, 0x0aa2aec9, 0x0aa2ba39, 0x0aa2bea5, 0x0aa2c026, 0x0aa2cc25, 0x0aa2cda6,
+    0x0aa2d226, 0x0aa2f4a5, 0x0aa2f639, 0x0aa2faa5, 0x0aa77855, 0x0aa7accd, 0x0aa830d5, 0x0aa870a5,
+    0x0aa87226, 0x0aa8a825, 0x0aa8aca5, 0x0aa92025, 0x0aa921a6, 0x0ab2cd91, 0x0ab332ed, 0x0ab334ed,
+    0x0ab35b7e, 0x0ab35cfe, 0x0ab35d6d, 0x0ab36f6d, 0x0ab370ed, 0x0ab3d4ed, 0x0ab3d6fa, 0x0ab3e8ed,
+    0x0ab410fe, 0x0ab4116d, 0x0ab412fa, 0x0ab42289, 0x0ab424ed, 0x0ab45656, 0x0ab45f56, 0x0ab48d19,
+    0x0ab48f49, 0x0ab49a99, 0x0ab49f19, 0x0ab4b7c9, 0x0ab4c319, 0x0ab4c799, 0x0ab4c919, 0x0ab4d519,
+    0x0ab4db19, 0x0ab4e991, 0x0ab53ced, 0x0ab5416d, 0x0ab5436d, 0x0ab54a0d, 0x0ab54eed, 0x0ab550ed,
+    0x0ab5728d, 0x0ab5777e, 0x0ab578fe, 0x0ab5796d, 0x0ab57ded, 0x0ab57f6d, 0x0ab5848d, 0x0ab5860d,
+    0x0ab58b6d, 0x0ab58f09, 0x0ab5916d, 0x0ab5a356, 0x0ab5b6c5, 0x0ab5ba95, 0x0ab5bc16, 0x0ab5ce16,
+    0x0ab5f2fa, 0x0ab5f509, 0x0ab5f806, 0x0ab5fe0d, 0x0ab60289, 0x0ab61f11, 0x0ab6268d, 0x0ab62b09,
+    0x0ab62efa, 0x0ab63109, 0x0abaaa56, 0x0abab356, 0x0abae349, 0x0abaec99, 0x0abaee99, 0x0abaf319,
+    0x0abb0099, 0x0abb2919, 0x0abb2a99, 0x0abb2f19, 0x0abb9e0d, 0x0abba2ed, 0x0abba4ed, 0x0abbb6ed,
+    0x0abbd88d, 0x0abbda0d, 0x0abc520d, 0x0abc5689, 0x0abc8e0e, 0x0ac247a1, 0x0ac76bd1, 0x0ac76d51,
+    0x0ac771d9, 0x0ac7794d, 0x0ac77acd, 0x0ac783d9, 0x0ac7b3c9, 0x0ac7bd19, 0x0ac7be99, 0x0ac7bf19,
+    0x0ac7c399, 0x0ac7c519, 0x0ac7d099, 0x0ac7d119, 0x0ac7d299, 0x0ac7d719, 0x0ac7f93d, 0x0ac7f999,
+    0x0ac7fb19, 0x0ac7ff99, 0x0ac825c9, 0x0ac83045, 0x0ac83945, 0x0ac83d15, 0x0ac83e95, 0x0ac85095,
+    0x0ac86e8d, 0x0ac8736d, 0x0ac8756d, 0x0ac87789, 0x0ac8808d, 0x0ac8820d, 0x0ac88b09, 0x0ac8a191,
+    0x0ac8a90d, 0x0ac8aa8d, 0x0ac8b389, 0x0ac8e8c5, 0x0ac8ec95, 0x0ac8ee39, 0x0ac9228d, 0x0ac92689,
+    0x0ac92709, 0x0ac93a8a, 0x0ac9630a, 0x0ace24ad, 0x0ace252d, 0x0ace26ad, 0x0acea02d, 0x0aced62d,
+    0x0acedaee, 0x0acedb6e, 0x0acedf2d, 0x0acf8e8a, 0x0ad01ca2, 0x0ad01d09, 0x0ad01e22, 0x0ad058a2,
+    0x0ad05e5d, 0x0ad0c3d5, 0x0ad0d7d5, 0x0ad11062, 0x0ad238a2, 0x0ad23909, 0x0ad23a22, 0x0ad2447d,
+    0x0ad27a4d, 0x0ad2f3cd, 0x0ad32c62, 0x0ad33e21, 0x0ad3603d, 0x0ad3743d, 0x0ad3f1a2, 0x0ad54621,
+    0x0ad55a21, 0x0ad65d09, 0x0ad675d5, 0x0ad67a55, 0x0ad67bd5, 0x0ad67c55, 0x0ad68405, 0x0ad687d5,
+    0x0ad68955, 0x0ad689d5, 0x0ad68dd5, 0x0ad68e55, 0x0ad69e51, 0x0ad6a2d1, 0x0ad6c249, 0x0ad6c545,
+    0x0ad6c9c5, 0x0ad6eac9, 0x0ad6fe49, 0x0ad6fec9, 0x0ad717d1, 0x0ad71dd5, 0x0ad73bc9, 0x0ad73ec5,
+    0x0ad741d5, 0x0ad74365, 0x0ad77d1d, 0x0ad77dc5, 0x0ad781a5, 0x0ad783a5, 0x0ad7a59d, 0x0ad7aa25,
+    0x0ad7ab9d, 0x0ad7ac1d, 0x0ad7b7a5, 0x0ad7b91d, 0x0ad7b99d, 0x0ad7bda5, 0x0ad7be25, 0x0ad7bf9d,
+    0x0ad81f1d, 0x0ad823a6, 0x0ad825a6, 0x0ad8311d, 0x0ad83329, 0x0ad837a6, 0x0ad8599d, 0x0ad85b2a,
+    0x0ad85b9d, 0x0ad85fa6, 0x0ad86d1e, 0x0ad86d9e, 0x0ad86f1e, 0x0ad8739e, 0x0ad8847d, 0x0ad888d1,
+    0x0ad88a55, 0x0ad891ce, 0x0ad8a3cd, 0x0ad8a555, 0x0ad8a5cd, 0x0ad8a87d, 0x0ad8ba4e, 0x0ad8de49,
+    0x0ad8e9bd, 0x0ad8ee19, 0x0ad8f019, 0x0ad906c9, 0x0ad9123d, 0x0ad91699, 0x0ad9181a, 0x0ad91899,
+    0x0ad91a49, 0x0ad91ac9, 0x0ad9243d, 0x0ad925bd, 0x0ad9263d, 0x0ad92a19, 0x0ad92a99, 0x0ad92c19,
+    0x0ad933ce, 0x0ad957c9, 0x0ad9633d, 0x0ad967a5, 0x0ad96915, 0x0ad96995, 0x0ad9990e, 0x0ad9a20a,
+    0x0ad9ba11, 0x0ad9c18e, 0x0ad9d3a5, 0x0ad9d50d, 0x0ad9d58d, 0x0ad9d83d, 0x0ad9de09, 0x0ada0ba6,
+    0x0ada440a, 0x0adafe99, 0x0adb0c25, 0x0adb3499, 0x0adb3919, 0x0adb7815, 0x0adba78e, 0x0adc2795,
+    0x0adc2c26, 0x0adcc492, 0x0adcc612, 0x0adcd805, 0x0adcdbd5, 0x0adcdd55, 0x0adcddd5, 0x0adce1d5,
+    0x0adcec05, 0x0adcec82, 0x0adcefd5, 0x0adcf155, 0x0adcf5d5, 0x0add0092, 0x0add1659, 0x0add1959,
+    0x0add1dc5, 0x0add2a5d, 0x0add5249, 0x0add8fd5, 0x0add92d5, 0x0add9745, 0x0adda3c9, 0x0addd59d,
+    0x0adde51d, 0x0addeb25, 0x0ade0b9d, 0x0ade0d1d, 0x0ade0d9d, 0x0ade119d, 0x0ade121d, 0x0ade1f9d,
+    0x0ade211d, 0x0ade259d, 0x0ade851d, 0x0ade86a5, 0x0ade871d, 0x0ade8b26, 0x0ade991d, 0x0ade9f26,
+    0x0adec11d, 0x0adee212, 0x0adef7cd, 0x0adefc7d, 0x0adf0bcd, 0x0adf0d4d, 0x0adf107d, 0x0adf3259,
+    0x0adf4219, 0x0adf464d, 0x0adf5619, 0x0adf57a5, 0x0adf6e49, 0x0adf783d, 0x0adf79bd, 0x0adf7a3d,
+    0x0adf7e19, 0x0adf8c3d, 0x0adf8dbd, 0x0adf9219, 0x0adfabd5, 0x0adfbb95, 0x0adfbfc9, 0x0adfcb3d,
+    0x0adfcf95, 0x0adfd115, 0x0ae0010d, 0x0ae00a09, 0x0ae0278d, 0x0ae0290d, 0x0ae0298d, 0x0ae02c3d,
+    0x0ae02f3d, 0x0ae03385, 0x0ae03b8d, 0x0ae03d0d, 0x0ae0403d, 0x0ae0a10d, 0x0ae0a2a5, 0x0ae0a30d,
+    0x0ae0a5bd, 0x0ae0a8bd, 0x0ae0ad26, 0x0ae17219, 0x0ae173a5, 0x0ae20d8d, 0x0ae20f25, 0x0ae20f8d,
+    0x0ae21209, 0x0ae21505, 0x0ae21985, 0x0ae22609, 0x0ae32d89, 0x0ae34655, 0x0ae34ad5, 0x0ae34c55,
+    0x0ae354a2, 0x0ae35862, 0x0ae359e2, 0x0ae35a55, 0x0ae36ed1, 0x0ae37351, 0x0ae392e2, 0x0ae3aad1,
+    0x0ae3cee2, 0x0ae3e851, 0x0ae3ee55, 0x0ae40f62, 0x0ae44da2, 0x0ae45222, 0x0ae4761d, 0x0ae47aa1,
+    0x0ae47c1d, 0x0ae489a2, 0x0ae48a1d, 0x0ae4ef9d, 0x0ae4f41d, 0x0ae554fd, 0x0ae55951, 0x0ae55ad5,
+    0x0ae5624e, 0x0ae57462, 0x0ae5764d, 0x0ae578e2, 0x0ae5aee2, 0x0ae5ba22, 0x0ae5bea2, 0x0ae5c0a1,
+    0x0ae5c6cd, 0x0ae5e2bd, 0x0ae5e719, 0x0ae5e899, 0x0ae5eae2, 0x0ae5f622, 0x0ae5f6bd, 0x0ae6044e,
+    0x0ae62862, 0x0ae633a2, 0x0ae63822, 0x0ae639a2, 0x0ae63a15, 0x0ae68a91, 0x0ae6920e, 0x0ae6a5a2,
+    0x0ae6aba2, 0x0ae70b8e, 0x0ae7dca1, 0x0ae84215, 0x0ae855a2, 0x0ae85615, 0x0ae86a91, 0x0ae8a691,
+    0x0ae8a711, 0x0ae99a69, 0x0ae9be69, 0x0ae9c169, 0x0ae9c5e9, 0x0ae9ffa9, 0x0aea0429, 0x0aea2829,
+    0x0aea2ca9, 0x0aea2e29, 0x0aea2ea9, 0x0aea3a29, 0x0aea3ba9, 0x0aea3c29, 0x0aea4029, 0x0aea40a9,
+    0x0aea7929, 0x0aea79e9, 0x0aea7fa9, 0x0aeab80a, 0x0aead029, 0x0aeaee29, 0x0aeaf129, 0x0aeaf429,
+    0x0aebea29, 0x0aebec29, 0x0aec1b8e, 0x0aec3ca9, 0x0aec440e, 0x0aec5629, 0x0aec57a9, 0x0aec5829,
+    0x0aec950e, 0x0aec9e0a, 0x0aed0a29, 0x0aed1b69, 0x0aed1be9, 0x0aed9369, 0x0aed9569, 0x0aedbbe9,
+    0x0aedbd6a, 0x0aedbde9, 0x0aedcf69, 0x0aedcfe9, 0x0aedd169, 0x0aedfaa9, 0x0aee9629, 0x0aeefb69,
+    0x0aef23e9, 0x0aef29e9, 0x0aef2a69, 0x0aef3769, 0x0aef37e9, 0x0aef3de9, 0x0aef9d69, 0x0aefa1e9,
+    0x0aefa3e9, 0x0aefaf69, 0x0aefd7e9, 0x0aefd9e9, 0x0aefde69, 0x0af00052, 0x0af01249, 0x0af01545,
+    0x0af019c5, 0x0af02649, 0x0af03ad2, 0x0af05399, 0x0af05819, 0x0af05a19, 0x0af062c2, 0x0af0679d,
+    0x0af06c19, 0x0af076d2, 0x0af08e19, 0x0af08f99, 0x0af09019, 0x0af09419, 0x0af09499, 0x0af09ec2,
+    0x0af0a219, 0x0af0a399, 0x0af0a819, 0x0af0cd15, 0x0af0d195, 0x0af0d395, 0x0af0e115, 0x0af0e595,
+    0x0af0e715, 0x0af13192, 0x0af14209, 0x0af14505, 0x0af14809, 0x0af15609, 0x0af1bb89, 0x0af1be85,
+    0x0af21c52, 0x0af22e49, 0x0af239bd, 0x0af23e15, 0x0af24249, 0x0af24dbd, 0x0af25215, 0x0af25395,
+    0x0af256d2, 0x0af26f8e, 0x0af27ec2, 0x0af2838d, 0x0af28c89, 0x0af292d2, 0x0af2aa0d, 0x0af2ab8d,
+    0x0af2ac0d, 0x0af2aebd, 0x0af2be0d, 0x0af2bf8d, 0x0af2c2bd, 0x0af2e90e, 0x0af2fd0d, 0x0af34769,
+    0x0af34d92, 0x0af35e09, 0x0af3697d, 0x0af36de9, 0x0af36f69, 0x0af36fe9, 0x0af37209, 0x0af37d7d,
+    0x0af381e9, 0x0af38369, 0x0af3d789, 0x0af3e2fd, 0x0af3e769, 0x0af3e969, 0x0af3fb69, 0x0af41d7d,
+    0x0af41efd, 0x0af41f7d, 0x0af42369, 0x0af423e9, 0x0af4317d, 0x0af432fd, 0x0af43769, 0x0af4a889,
+    0x0af54409, 0x0af54f69, 0x0af553e9, 0x0af555e9, 0x0af56369, 0x0af589e9, 0x0af58b69, 0x0af58be9,
+    0x0af58fe9, 0x0af59069, 0x0af59de9, 0x0af59f69, 0x0af5a3e9, 0x0af60369, 0x0af60569, 0x0af61769,
+    0x0af63f69, 0x0af6cae2, 0x0af78a22, 0x0af8f69a, 0x0afb2751, 0x0afbf221, 0x0afbf8a1, 0x0afc0621,
+    0x0afca821, 0x0afcd251, 0x0afce2c9, 0x0afcf649, 0x0afcf6c9, 0x0afcf7c5, 0x0afd2419, 0x0afd289a,
+    0x0afd2a1a, 0x0afd2a9a, 0x0afd3245, 0x0afd3619, 0x0afd3799, 0x0afd381d, 0x0afd3c1a, 0x0afd3c9a,
+    0x0afd5e99, 0x0afd6019, 0x0afd6099, 0x0afd649a, 0x0afd651a, 0x0afd7219, 0x0afd7299, 0x0afd7419,
+    0x0afd789a, 0x0afd9d95, 0x0afda215, 0x0afdaf95, 0x0afdb115, 0x0afdb195, 0x0afdb595, 0x0afdb615,
+    0x0afdca91, 0x0afdcc11, 0x0afddc8a, 0x0afdea09, 0x0afdf009, 0x0afdf185, 0x0afe1289, 0x0afe2609,
+    0x0afe2689, 0x0afe2785, 0x0afe8c09, 0x0afedc1e, 0x0afeee4d, 0x0aff0a3d, 0x0aff101a, 0x0aff12c9,
+    0x0aff13c5, 0x0aff1c3d, 0x0aff1dbd, 0x0aff1e3d, 0x0aff389a, 0x0aff490a, 0x0aff520d, 0x0aff538d,
+    0x0aff540d, 0x0aff56bd, 0x0aff5d1a, 0x0aff7a8d, 0x0aff7c0d, 0x0aff7c8d, 0x0aff7f3d, 0x0aff8e0d,
+    0x0aff8e8d, 0x0aff900d, 0x0aff92bd, 0x0aff933d, 0x0affb091, 0x0affb211, 0x0affcb8d, 0x0affcd0d,
+    0x0affcd8d, 0x0affd785, 0x0b000609, 0x0b00117d, 0x0b0015e9, 0x0b001769, 0x0b0017e9, 0x0b002e89,
+    0x0b0039fd, 0x0b003e69, 0x0b003fe9, 0x0b004069, 0x0b004209, 0x0b004289, 0x0b004385, 0x0b004bfd,
+    0x0b004d7d, 0x0b004dfd, 0x0b0051e9, 0x0b005269, 0x0b0053e9, 0x0b00a80e, 0x0b00b37d, 0x0b00c57d,
+    0x0b00c6fd, 0x0b00edfd, 0x0b00ef7d, 0x0b00effd, 0x0b01017d, 0x0b0101fd, 0x0b01037d, 0x0b017909,
+    0x0b021489, 0x0b021fe9, 0x0b022469, 0x0b0225e9, 0x0b022669, 0x0b0231e9, 0x0b023369, 0x0b0233e9,
+    0x0b0237e9, 0x0b025be9, 0x0b025c69, 0x0b026069, 0x0b0260e9, 0x0b026269, 0x0b026de9, 0x0b026fe9,
+    0x0b027469, 0x0b02d3e9, 0x0b02d5e9, 0x0b02e7e9, 0x0b0311e9, 0x0b034a49, 0x0b034ac9, 0x0b034bc5,
+    0x0b035e49, 0x0b035fc5, 0x0b0372d2, 0x0b038a19, 0x0b038b99, 0x0b038c1d, 0x0b03901a, 0x0b039ac2,
+    0x0b039e1d, 0x0b039f9d, 0x0b03a41a, 0x0b03c619, 0x0b03c699, 0x0b03c819, 0x0b03cc9a, 0x0b040395,
+    0x0b040515, 0x0b040595, 0x0b041795, 0x0b041915, 0x0b041d95, 0x0b04521d, 0x0b047a09, 0x0b047a89,
+    0x0b047b85, 0x0b048e09, 0x0b048f85, 0x0b04f389, 0x0b04f41d, 0x0b0567c5, 0x0b05703d, 0x0b0571bd,
+    0x0b05723d, 0x0b057bc5, 0x0b05843d, 0x0b0585bd, 0x0b058a1a, 0x0b05a619, 0x0b05a799, 0x0b05ba0d,
+    0x0b05bb8d, 0x0b05e20d, 0x0b05e28d, 0x0b05e40d, 0x0b05e6bd, 0x0b05e73d, 0x0b061f95, 0x0b062195,
+    0x0b06338d, 0x0b06350d, 0x0b066e0d, 0x0b067de9, 0x0b067f69, 0x0b069609, 0x0b069689, 0x0b069785,
+    0x0b069ffd, 0x0b06a17d, 0x0b06a1fd, 0x0b06a5e9, 0x0b06a669, 0x0b06a7e9, 0x0b06ab85, 0x0b06b3fd,
+    0x0b06b57d, 0x0b06b9e9, 0x0b070f8e, 0x0b07100e, 0x0b07197d, 0x0b071afd, 0x0b07557d, 0x0b0755fd,
+    0x0b07577d, 0x0b080c19, 0x0b087c09, 0x0b087c89, 0x0b0885e9, 0x0b088769, 0x0b0887e9, 0x0b088be9,
+    0x0b0899e9, 0x0b089b69, 0x0b08c1e9, 0x0b093b69, 0x0b093be9, 0x0b09cbd5, 0x0b09d055, 0x0b0a8449,
+    0x0b0ac5bd, 0x0b0ae79d, 0x0b0afb9d, 0x0b0b0039, 0x0b0bd3ce, 0x0b0be7cd, 0x0b0bfc4e, 0x0b0c2062,
+    0x0b0c2ba2, 0x0b0c323d, 0x0b0c5899, 0x0b0c683d, 0x0b0c6c99, 0x0b0cab95, 0x0b0d038e, 0x0b0d860a,
+    0x0b0e4e3d, 0x0b100be5, 0x0b102fe5, 0x0b1032e5, 0x0b103765, 0x0b107125, 0x0b1075a5, 0x0b1099a5,
+    0x0b109e25, 0x0b109fa5, 0x0b10a025, 0x0b10aba5, 0x0b10ad25, 0x0b10ada5, 0x0b10b1a5, 0x0b10b225,
+    0x0b10eaa5, 0x0b10eb65, 0x0b10f125, 0x0b11298a, 0x0b1141a5, 0x0b115fa5, 0x0b1165a5, 0x0b116625,
+    0x0b125ba5, 0x0b125da5, 0x0b128d0e, 0x0b12ae25, 0x0b12b58e, 0x0b12c7a5, 0x0b12c925, 0x0b12c9a5,
+    0x0b12d2a5, 0x0b13068e, 0x0b130f8a, 0x0b137ba5, 0x0b138ce5, 0x0b138d65, 0x0b1404e6, 0x0b1406e6,
+    0x0b142d66, 0x0b142ee6, 0x0b142f66, 0x0b1440e6, 0x0b144166, 0x0b1442e6, 0x0b146c25, 0x0b14e125,
+    0x0b156ce5, 0x0b159565, 0x0b159b65, 0x0b159be5, 0x0b15a8e5, 0x0b15a965, 0x0b15af65, 0x0b160ee5,
+    0x0b161566, 0x0b1620e5, 0x0b164965, 0x0b164b65, 0x0b164fe6, 0x0b1683c9, 0x0b1686c5, 0x0b168b45,
+    0x0b1697d5, 0x0b16c519, 0x0b16c999, 0x0b16cb25, 0x0b16ff99, 0x0b170119, 0x0b170199, 0x0b170599,
+    0x0b170619, 0x0b170fc5, 0x0b171399, 0x0b171519, 0x0b17199a, 0x0b173e95, 0x0b173f45, 0x0b174339,
+    0x0b174495, 0x0b175295, 0x0b175895, 0x0b177d8a, 0x0b17b389, 0x0b17b685, 0x0b17b989, 0x0b17c789,
+    0x0b182d09, 0x0b183005, 0x0b1834a6, 0x0b189fc9, 0x0b18ab3d, 0x0b18af95, 0x0b18b115, 0x0b18b3cd,
+    0x0b18c395, 0x0b18c515, 0x0b18e10e, 0x0b18fe3d, 0x0b191b8d, 0x0b191d0d, 0x0b191d8d, 0x0b19203d,
+    0x0b192785, 0x0b192f8d, 0x0b19310d, 0x0b19343d, 0x0b195a8e, 0x0b19638a, 0x0b196e8d, 0x0b197789,
+    0x0b19b8fd, 0x0b19cf89, 0x0b19dafd, 0x0b19db85, 0x0b19df79, 0x0b19e0e5, 0x0b19e165, 0x0b19e389,
+    0x0b19eefd, 0x0b19f379, 0x0b19f4e5, 0x0b1a490e, 0x0b1a547d, 0x0b1a58e6, 0x0b1a5a66, 0x0b1a5ae6,
+    0x0b1a6ce6, 0x0b1a8efd, 0x0b1a907d, 0x0b1a90fd, 0x0b1a94e6, 0x0b1a9566, 0x0b1aa2fd, 0x0b1aa47d,
+    0x0b1aa8e6, 0x0b1b1a3d, 0x0b1bb589, 0x0b1bc0e5, 0x0b1bc185, 0x0b1bc579, 0x0b1bc6e5, 0x0b1bc77d,
+    0x0b1bd4fd, 0x0b1bfb79, 0x0b1bfce5, 0x0b1bfd65, 0x0b1c0179, 0x0b1c01f9, 0x0b1c0f79, 0x0b1c10e5,
+    0x0b1c1579, 0x0b1c74e5, 0x0b1c7665, 0x0b1c76fd, 0x0b1c88fd, 0x0b1cb0e5, 0x0b1cdc61, 0x0b1d41a2,
+    0x0b1d4622, 0x0b1d6a21, 0x0b1d6ea1, 0x0b1d7021, 0x0b1d7da2, 0x0b1d7e21, 0x0b1d82a1, 0x0b1dbb22,
+    0x0b1dc1a1, 0x0b1e1221, 0x0b1e3322, 0x0b1f2c22, 0x0b1f2e21, 0x0b1f7ea1, 0x0b1f99a2, 0x0b205d62,
+    0x0b205de1, 0x0b20d562, 0x0b20fde1, 0x0b20ff61, 0x0b211162, 0x0b2111e1, 0x0b21d821, 0x0b223d62,
+    0x0b2265e1, 0x0b226be1, 0x0b227962, 0x0b2279e1, 0x0b22df61, 0x0b22e3e1, 0x0b29a852, 0x0b29c115,
+    0x0b29c595, 0x0b29c715, 0x0b29c795, 0x0b29d515, 0x0b29d995, 0x0b29e992, 0x0b29ee12, 0x0b2a2592,
+    0x0b2a3609, 0x0b2a4a09, 0x0b2a6312, 0x0b2a6912, 0x0b2a798a, 0x0b2a8d89, 0x0b2acefd, 0x0b2af0dd,
+    0x0b2af579, 0x0b2af6dd, 0x0b2af75d, 0x0b2b04dd, 0x0b2b0979, 0x0b2b0add, 0x0b2b6a5d, 0x0b2b6edd,
+    0x0b2b70fd, 0x0b2b82fd, 0x0b2ba4dd, 0x0b2ba65d, 0x0b2ba6dd, 0x0b2baadd, 0x0b2bab5d, 0x0b2bb8de,
+    0x0b2bba5e, 0x0b2bbede, 0x0b2bcf92, 0x0b2bd412, 0x0b2bd592, 0x0b2bdd0e, 0x0b2bf10d, 0x0b2bfa09,
+    0x0b2c3b7d, 0x0b2c4192, 0x0b2c5209, 0x0b2c5d7d, 0x0b2c61d9, 0x0b2c6359, 0x0b2c63d9, 0x0b2c6609,
+    0x0b2c717d, 0x0b2c75d9, 0x0b2c7759, 0x0b2cb4d5, 0x0b2d0552, 0x0b2d0cce, 0x0b2d15ca, 0x0b2d20cd,
+    0x0b2d29c9, 0x0b2d864e, 0x0b2d8f4a, 0x0b2dc0cd, 0x0b2dc24d, 0x0b2dc2cd, 0x0b2dd4cd, 0x0b2dd64d,
+    0x0b2e577d, 0x0b2ea801, 0x0b2ebcd5, 0x0b2ed0d5, 0x0b2ee552, 0x0b2ef2ce, 0x0b2efbca, 0x0b2f2152,
+    0x0b2f21d1, 0x0b307e1a, 0x0b313222, 0x0b329e9a, 0x0b335962, 0x0b3579e2, 0x0b3678c9, 0x0b369195,
+    0x0b36961a, 0x0b36979a, 0x0b36981a, 0x0b369fc5, 0x0b36a395, 0x0b36a515, 0x0b36a595, 0x0b36a99a,
+    0x0b36aa1a, 0x0b36ba11, 0x0b36be9a, 0x0b36c01a, 0x0b36d08a, 0x0b36de09, 0x0b36e105, 0x0b36e41a,
+    0x0b36e59a, 0x0b370689, 0x0b371a09, 0x0b371a89, 0x0b371b85, 0x0b373391, 0x0b373991, 0x0b375789,
+    0x0b375a85, 0x0b375d89, 0x0b375f39, 0x0b3798dd, 0x0b379985, 0x0b379d79, 0x0b379edd, 0x0b379f7d,
+    0x0b37c15d, 0x0b37c5f9, 0x0b37c75d, 0x0b37c7dd, 0x0b37d379, 0x0b37d4dd, 0x0b37d55d, 0x0b37d979,
+    0x0b37d9f9, 0x0b37db5d, 0x0b383add, 0x0b384cdd, 0x0b384e5d, 0x0b38755d, 0x0b3876dd, 0x0b38775d,
+    0x0b38859e, 0x0b3888de, 0x0b38895e, 0x0b388ade, 0x0b38a03d, 0x0b38a49a, 0x0b38a61a, 0x0b38bf8d,
+    0x0b38c10d, 0x0b38c18d, 0x0b38c43d, 0x0b38c73d, 0x0b38ca9a, 0x0b38cb9a, 0x0b38fa0e, 0x0b39057d,
+    0x0b3909da, 0x0b390b5a, 0x0b390bda, 0x0b39228e, 0x0b392dfd, 0x0b39325a, 0x0b3933da, 0x0b39345a,
+    0x0b393689, 0x0b393785, 0x0b393ffd, 0x0b39417d, 0x0b3941fd, 0x0b3945da, 0x0b39465a, 0x0b3947da,
+    0x0b397389, 0x0b397efd, 0x0b397f85, 0x0b398379, 0x0b3984d5, 0x0b398555, 0x0b39b4ce, 0x0b39bdca,
+    0x0b39d5d1, 0x0b39dd4e, 0x0b39e64a, 0x0b39ef79, 0x0b39f0cd, 0x0b39f14d, 0x0b39f3fd, 0x0b39f9c9,
+    0x0b39fa49, 0x0b3a68ce, 0x0b3a6a4e, 0x0b3a914e, 0x0b3a92ce, 0x0b3a934e, 0x0b3aa4ce, 0x0b3aa54e,
+    0x0b3aa6ce, 0x0b3b1a5a, 0x0b3b27fd, 0x0b3b2bda, 0x0b3b5059, 0x0b3b54da, 0x0b3b93d5, 0x0b3bc34e,
+    0x0b3c08c9, 0x0b3c4355, 0x0b3cf795, 0x0b3cf915, 0x0b3cf995, 0x0b3d0b95, 0x0b3d0d15, 0x0b3d119a,
+    0x0b3d3219, 0x0b3d6e09, 0x0b3d6e89, 0x0b3d6f85, 0x0b3d8209, 0x0b3d8385, 0x0b3dab95, 0x0b3dbf95,
+    0x0b3df2dd, 0x0b3e06fd, 0x0b3e2779, 0x0b3e28dd, 0x0b3e295d, 0x0b3e3b79, 0x0b3e3cdd, 0x0b3e4179,
+    0x0b3ea0dd, 0x0b3ea25d, 0x0b3edcdd, 0x0b3edd5d, 0x0b3ededd, 0x0b3f1395, 0x0b3f150d, 0x0b3f158d,
+    0x0b3f278d, 0x0b3f290d, 0x0b3f4e19, 0x0b3f5f5a, 0x0b3f5fda, 0x0b3f71da, 0x0b3f735a, 0x0b3f8b85,
+    0x0b3f93fd, 0x0b3f957d, 0x0b3f95fd, 0x0b3f99da, 0x0b3f9a5a, 0x0b3f9bda, 0x0b3f9f85, 0x0b3fa7fd,
+    0x0b3fa97d, 0x0b3fadda, 0x0b3fc795, 0x0b3fd8d5, 0x0b3fd955, 0x0b3fdb8d, 0x0b3feb79, 0x0b3fecd5,
+    0x0b4025fd, 0x0b404379, 0x0b4044cd, 0x0b40454d, 0x0b4047fd, 0x0b405779, 0x0b4058cd, 0x0b405bfd,
+    0x0b40bcce, 0x0b40be4e, 0x0b40c17d, 0x0b40f8ce, 0x0b40f94e, 0x0b40face, 0x0b417bfd, 0x0b418dfd,
+    0x0b418f7d, 0x0b422979, 0x0b422acd, 0x0b422b7d, 0x0b422dc9, 0x0b4233c9, 0x0b4241fd, 0x0b426cfa,
+    0x0b42737a, 0x0b4280fa, 0x0b42e3fd, 0x0b4322f9, 0x0b4a0d9a, 0x0b4c370d, 0x0b4cfae5, 0x0b4d2365,
+    0x0b4d9ce6, 0x0b4daa7a, 0x0b4dd27a, 0x0b4f0965, 0x0b4f43e5, 0x0b4f4565, 0x0b4fbd66, 0x0b52a1bd,
+    0x0b535c7d, 0x0b5360e5, 0x0b53fe7a, 0x0b54107d, 0x0b557ce5, 0x0b5582e5, 0x0b5aa2fa, 0x0b5bd361,
+    0x0b5be562, 0x0b5be761, 0x0b5c21e1, 0x0b5cea49, 0x0b5d0315, 0x0b5d0795, 0x0b5d0915, 0x0b5d0995,
+    0x0b5d1145, 0x0b5d1515, 0x0b5d1695, 0x0b5d1715, 0x0b5d1b15, 0x0b5d1b95, 0x0b5d2b91, 0x0b5d3011,
+    0x0b5d4f89, 0x0b5d5285, 0x0b5d5705, 0x0b5d67be, 0x0b5d783e, 0x0b5d8bbe, 0x0b5d8c09, 0x0b5d8d3e,
+    0x0b5da511, 0x0b5da991, 0x0b5dab15, 0x0b5dc909, 0x0b5dcc05, 0x0b5dcf15, 0x0b5dd085, 0x0b5e0a5d,
+    0x0b5e0b05, 0x0b5e0edd, 0x0b5e10dd, 0x0b5e32fe, 0x0b5e377e, 0x0b5e38fe, 0x0b5e395d, 0x0b5e44fe,
+    0x0b5e467e, 0x0b5e46dd, 0x0b5e4afe, 0x0b5e4b5d, 0x0b5e4cdd, 0x0b5eac7a, 0x0b5eb0dd, 0x0b5eb2fa,
+    0x0b5ebe5d, 0x0b5ec07a, 0x0b5ec4dd, 0x0b5ee6fe, 0x0b5ee87a, 0x0b5ee8fa, 0x0b5eecfe, 0x0b5eed5d,
+    0x0b5efade, 0x0b5efc5e, 0x0b5f11bd, 0x0b5f1611, 0x0b5f1795, 0x0b5f310d, 0x0b5f3295, 0x0b5f330d,
+    0x0b5f35bd, 0x0b5f38bd, 0x0b5f3d05, 0x0b5f6b89, 0x0b5f76fd, 0x0b5f7b59, 0x0b5f7d59, 0x0b5f83be,
+    0x0b5f9f7e, 0x0b5fa3fe, 0x0b5fa57e, 0x0b5fa5d9, 0x0b5fa809, 0x0b5fa93e, 0x0b5fb17e, 0x0b5fb2fe,
+    0x0b5fb37d, 0x0b5fb77e, 0x0b5fb7d9, 0x0b5fb959, 0x0b5fe509, 0x0b5ff07d, 0x0b5ff105, 0x0b5ff4d5,
+    0x0b5ff655, 0x0b5ff6d5, 0x0b60264e, 0x0b602f4a, 0x0b60477e, 0x0b6060fe, 0x0b60627e, 0x0b6062cd,
+    0x0b60657e, 0x0b60687e, 0x0b606b7e, 0x0b6098fa, 0x0b60da4d, 0x0b60dc7a, 0x0b6102fe, 0x0b6104fa,
+    0x0b61167e, 0x0b6116cd, 0x0b61187a, 0x0b618bd9, 0x0b61c1d9, 0x0b61c659, 0x0b61e609, 0x0b61e905,
+    0x0b61ea01, 0x0b61fed5, 0x0b620555, 0x0b6210d5, 0x0b621255, 0x0b6212d5, 0x0b622751, 0x0b62637e,
+    0x0b6263d1, 0x0b62b4fa, 0x0b62b955, 0x0b64725d, 0x0b6476dd, 0x0b6498fe, 0x0b649a7e, 0x0b649add,
+    0x0b649efe, 0x0b649f5d, 0x0b64acdd, 0x0b64ae5d, 0x0b64b2dd, 0x0b65125d, 0x0b65147a, 0x0b65265d,
+    0x0b654e7e, 0x0b65defd, 0x0b668e4d, 0x0b66b4fe, 0x0b66b67e, 0x0b66b6cd, 0x0b66c8cd, 0x0b66ca4d,
+    0x0b672e4d, 0x0b67307a, 0x0b67424d, 0x0b676a7e, 0x0b6d1611, 0x0b6dc5be, 0x0b6e9019, 0x0b6f3211,
+    0x0b7140dd, 0x0b71425d, 0x0b7142dd, 0x0b7146dd, 0x0b71475d, 0x0b71697e, 0x0b716afe, 0x0b716b5d,
+    0x0b716fdd, 0x0b717cfe, 0x0b717d5d, 0x0b717edd, 0x0b71835d, 0x0b71e2dd, 0x0b71e4fa, 0x0b71f65d,
+    0x0b71f6dd, 0x0b721efe, 0x0b72af7d, 0x0b735ccd, 0x0b735e4d, 0x0b735ecd, 0x0b73857e, 0x0b7386fe,
+    0x0b73874d, 0x0b7398fe, 0x0b73994d, 0x0b739acd, 0x0b73a6f9, 0x0b74567e, 0x0b75aefd, 0x0b75b579,
+    0x0b75c2f9, 0x0b7664f9, 0x0b76dc19, 0x0b76e01e, 0x0b76e159, 0x0b76e519, 0x0b76ef89, 0x0b771b19,
+    0x0b776015, 0x0b77991e, 0x0b779c1e, 0x0b77a8dd, 0x0b77aa5d, 0x0b77aedd, 0x0b77d0fe, 0x0b77d15d,
+    0x0b77d2dd, 0x0b77d509, 0x0b77d75d, 0x0b784809, 0x0b784889, 0x0b784a5d, 0x0b784add, 0x0b784bb9,
+    0x0b78f819, 0x0b79157d, 0x0b7916fd, 0x0b791b5a, 0x0b7929be, 0x0b793d7e, 0x0b79c4cd, 0x0b79c64d,
+    0x0b79c97d, 0x0b79ecfe, 0x0b79ed4d, 0x0b79eecd, 0x0b79f17e, 0x0b79faf9, 0x0b7a087e, 0x0b7a66ce,
+    0x0b7a6b7d, 0x0b7a6f7e, 0x0b7aaa7e, 0x0b7b1d0d, 0x0b7b2109, 0x0b7b980d, 0x0b7ba109, 0x0b7bd34d,
+    0x0b7bd7c9, 0x0b7bdd05, 0x0b7be0f9, 0x0b7be279, 0x0b7beff9, 0x0b7c16f9, 0x0b7c1879, 0x0b7c1cf9,
+    0x0b7c8c85, 0x0b7c8ff9, 0x0b7c9079, 0x0b7c91f9, 0x0b8354c9, 0x0b8357c5, 0x0b8360c5, 0x0b836491,
+    0x0b836611, 0x0b837f8d, 0x0b83810d, 0x0b838a15, 0x0b83ba09, 0x0b83c9d9, 0x0b83cb66, 0x0b83d08d,
+    0x0b83d20d, 0x0b83db11, 0x0b83e289, 0x0b83e585, 0x0b83ee85, 0x0b83f259, 0x0b83f3d9, 0x0b83ffd9,
+    0x0b840159, 0x0b84c38d, 0x0b84c50d, 0x0b84ce25, 0x0b84d589, 0x0b84d885, 0x0b84e1a5, 0x0b84e565,
+    0x0b84e6e5, 0x0b84f2d5, 0x0b84f455, 0x0b8528cd, 0x0b852a66, 0x0b853366, 0x0b8543d1, 0x0b854551,
+    0x0b85514d, 0x0b8552cd, 0x0b855be5, 0x0b85da99, 0x0b861519, 0x0b861699, 0x0b865415, 0x0b86c909,
+    0x0b86cc05, 0x0b870826, 0x0b879c8d, 0x0b879e0d, 0x0b87a73d, 0x0b87be7d, 0x0b87bffd, 0x0b87cbd5,
+    0x0b87cd55, 0x0b87f699, 0x0b8801cd, 0x0b880c66, 0x0b881cd1, 0x0b881e51, 0x0b882a4d, 0x0b882bcd,
+    0x0b8834fd, 0x0b887015, 0x0b88c5bd, 0x0b88ee3d, 0x0b88efbd, 0x0b88fba5, 0x0b88fd25, 0x0b890fd1,
+    0x0b891151, 0x0b891d4d, 0x0b891ecd, 0x0b892415, 0x0b897525, 0x0b8976a6, 0x0b899da5, 0x0b899f25,
+    0x0b89d50d, 0x0b89de19, 0x0b8a0e09, 0x0b8a1dd9, 0x0b8a1f66, 0x0b8a5559, 0x0b8a98d6, 0x0b8b0dc9,
+    0x0b8b4855, 0x0b8b7ccd, 0x0b8e2155, 0x0b8e55cd, 0x0b8ed9fd, 0x0b8f19bd, 0x0b8f1b26, 0x0b8f5125,
+    0x0b8f55bd, 0x0b8fc925, 0x0b8fcaa6, 0x0b931e15, 0x0b934691, 0x0b9527c9, 0x0b952ac5, 0x0b953e95,
+    0x0b953ec1, 0x0b954015, 0x0b954095, 0x0b955295, 0x0b955415, 0x0b956711, 0x0b956911, 0x0b957c05,
+    0x0b957d01, 0x0b95a311, 0x0b95a391, 0x0b95a511, 0x0b95b901, 0x0b96f74d, 0x0b970049, 0x0b971fcd,
+    0x0b9728c9, 0x0b9731cd, 0x0b97334d, 0x0b973c59, 0x0b97e39d, 0x0b97f59d, 0x0b97f71d, 0x0b980b56,
+    0x0b981bc9, 0x0b981ec5, 0x0b982f56, 0x0b985f49, 0x0b986a9d, 0x0b986f1d, 0x0b988051, 0x0b9887c9,
+    0x0b98911d, 0x0b98931d, 0x0b9893c5, 0x0b98979d, 0x0b98991d, 0x0b98a51d, 0x0b98a69d, 0x0b98d695,
+    0x0b994b89, 0x0b994e85, 0x0b997211, 0x0b99d769, 0x0b99ffe9, 0x0b9a0669, 0x0b9a7fe9, 0x0b9ab5e9,
+    0x0b9aba69, 0x0b9abbe9, 0x0b9ac10d, 0x0b9ac28d, 0x0b9acb89, 0x0b9af295, 0x0b9b4399, 0x0b9b483d,
+    0x0b9b6c19, 0x0b9b70bd, 0x0b9b7e19, 0x0b9b7f99, 0x0b9b9291, 0x0b9b9415, 0x0b9b9491, 0x0b9ba785,
+    0x0b9bbb85, 0x0b9bd005, 0x0b9bd101, 0x0b9be5e9, 0x0b9bf7e9, 0x0b9bf9e9, 0x0b9c2069, 0x0b9c21e9,
+    0x0b9c2269, 0x0b9c2d8d, 0x0b9c2f0d, 0x0b9c33e9, 0x0b9c3469, 0x0b9c35e9, 0x0b9c383d, 0x0b9c4c56,
+    0x0b9c5ffd, 0x0b9c63bd, 0x0b9c6516, 0x0b9c9be9, 0x0b9ca106, 0x0b9ca70d, 0x0b9ccf8d, 0x0b9cd669,
+    0x0b9cd7e9, 0x0b9cda3d, 0x0b9d4b4d, 0x0b9d5449, 0x0b9d85cd, 0x0b9d874d, 0x0b9d9049, 0x0b9e0f1e,
+    0x0b9e431d, 0x0b9e499d, 0x0b9e4b1d, 0x0b9e7a56, 0x0b9e8356, 0x0b9eb349, 0x0b9ebc9d, 0x0b9ebe9d,
+    0x0b9ec31d, 0x0b9ed09d, 0x0b9ef89d, 0x0b9ef91d, 0x0b9efa9d, 0x0b9eff1d, 0x0ba19799, 0x0ba19c3d,
+    0x0ba1d219, 0x0ba1d399, 0x0ba1d83d, 0x0ba24be9, 0x0ba24de9, 0x0ba287e9, 0x0ba28869, 0x0ba289e9,
+    0x0ba2fb0d, 0x0ba3f4d9, 0x0ba60351, 0x0ba6d4a1, 0x0ba6e221, 0x0ba78421, 0x0ba8f0a1, 0x0ba9c88d,
+    0x0ba9ca0d, 0x0ba9d319, 0x0ba9da89, 0x0ba9dd85, 0x0ba9e699, 0x0ba9ea59, 0x0ba9ebd9, 0x0ba9f7d5,
+    0x0ba9f955, 0x0baa1bcd, 0x0baa2dcd, 0x0baa2f4d, 0x0baa3249, 0x0baa3859, 0x0baa48d1, 0x0baa4a51,
+    0x0baa564d, 0x0baa57cd, 0x0baa5a49, 0x0baa5ac9, 0x0baa60d9, 0x0baa8dd1, 0x0baa9e49, 0x0baaa145,
+    0x0baab1c9, 0x0baadf9e, 0x0baaed1d, 0x0baaedc5, 0x0baaf1aa, 0x0baaf31d, 0x0bab02c9, 0x0bab139d,
+    0x0bab151d, 0x0bab159d, 0x0bab1645, 0x0bab1a1d, 0x0bab1b9d, 0x0bab271d, 0x0bab279d, 0x0bab291d,
+    0x0bab2d9d, 0x0bab3bd1, 0x0bab3d51, 0x0bab494d, 0x0bab4acd, 0x0bab4dc9, 0x0bab50c5, 0x0bab614a,
+    0x0bab8d1d, 0x0bab8e9d, 0x0bab8f1d, 0x0bab9d45, 0x0baba09d, 0x0baba11d, 0x0baba29d, 0x0babc5c5,
+    0x0babc91d, 0x0babc99d, 0x0babcb1d, 0x0bac9419, 0x0bad3e69, 0x0badfd8a, 0x0bae14d1, 0x0bae1651,
+    0x0bae224d, 0x0bae23cd, 0x0bae6819, 0x0bae7a19, 0x0bae7b99, 0x0baea219, 0x0baea299, 0x0baea419,
+    0x0baecefd, 0x0baee005, 0x0baee27d, 0x0baee63d, 0x0baee7bd, 0x0baef9bd, 0x0baf1e69, 0x0baf343d,
+    0x0baf4abd, 0x0baf5a69, 0x0baf5cbd, 0x0baf91c5, 0x0baf9595, 0x0baf9715, 0x0bafd269, 0x0bafe38a,
+    0x0bb00c0a, 0x0bb04d69, 0x0bb081ea, 0x0bb085e9, 0x0bb0fce9, 0x0bb105e9, 0x0bb138de, 0x0bb1409e,
+    0x0bb141de, 0x0bb1459e, 0x0bb1471e, 0x0bb154a9, 0x0bb17ba9, 0x0bb17d29, 0x0bb181a9, 0x0bb1b54a,
+    0x0bb1f169, 0x0bb1f4a9, 0x0bb1f529, 0x0bb1f6a9, 0x0bb2e829, 0x0bb4cda9, 0x0bb4ce29, 0x0bb4cfa9,
+    0x0bb54929, 0x0bb57f29, 0x0bb6378a, 0x0bbf4815, 0x0bbf5595, 0x0bbfbd09, 0x0bbfc005, 0x0bc077e5,
+    0x0bc08565, 0x0bc0f166, 0x0bc12765, 0x0bc12be6, 0x0bc12d66, 0x0bc16415, 0x0bc293e5, 0x0bc30d7d,
+    0x0bc347e5, 0x0bc34965, 0x0bccb411, 0x0bcd1962, 0x0bcd41e1, 0x0bcd55e1, 0x0bced691, 0x0bcee985,
+    0x0bceea81, 0x0bcf27e1, 0x0bcf39e2, 0x0bcf3bfd, 0x0bcf6279, 0x0bcf63e1, 0x0bcf6461, 0x0bcf75e2,
+    0x0bcf7679, 0x0bcf77e1, 0x0bd05795, 0x0bd05e15, 0x0bd06049, 0x0bd06145, 0x0bd065c5, 0x0bd06995,
+    0x0bd06b15, 0x0bd06b95, 0x0bd06f95, 0x0bd07015, 0x0bd08011, 0x0bd09f8d, 0x0bd0a1bd, 0x0bd0a409,
+    0x0bd0a705, 0x0bd0ab85, 0x0bd0af3e, 0x0bd0c80d, 0x0bd0ca0d, 0x0bd0cc89, 0x0bd0db8d, 0x0bd0dc0d,
+    0x0bd0e009, 0x0bd0e089, 0x0bd0f991, 0x0bd11939, 0x0bd11a95, 0x0bd11b0d, 0x0bd11d89, 0x0bd12085,
+    0x0bd12395, 0x0bd12539, 0x0bd15389, 0x0bd15edd, 0x0bd15f85, 0x0bd16379, 0x0bd1657d, 0x0bd17c09,
+    0x0bd1875d, 0x0bd18bf9, 0x0bd18d5d, 0x0bd18ddd, 0x0bd19009, 0x0bd19979, 0x0bd19add, 0x0bd19b5d,
+    0x0bd19f79, 0x0bd19ff9, 0x0bd20e3e, 0x0bd212dd, 0x0bd2173e, 0x0bd2368d, 0x0bd23b5d, 0x0bd23d5d,
+    0x0bd241dd, 0x0bd24ede, 0x0bd24f5e, 0x0bd26611, 0x0bd26a91, 0x0bd26c15, 0x0bd2858d, 0x0bd28715,
+    0x0bd2878d, 0x0bd28a09, 0x0bd28d05, 0x0bd29089, 0x0bd29185, 0x0bd2c009, 0x0bd2cb59, 0x0bd2cfd9,
+    0x0bd2d1fd, 0x0bd2f3d9, 0x0bd2f859, 0x0bd2f9d9, 0x0bd2fa59, 0x0bd2fc89, 0x0bd305d9, 0x0bd30759,
+    0x0bd307d9, 0x0bd30bd9, 0x0bd30c59, 0x0bd30dd9, 0x0bd33989, 0x0bd344d5, 0x0bd34585, 0x0bd34979,
+    0x0bd34ad5, 0x0bd34b55, 0x0bd37ace, 0x0bd383ca, 0x0bd395d1, 0x0bd39bd1, 0x0bd3a34e, 0x0bd3b579,
+    0x0bd3b6cd, 0x0bd3b74d, 0x0bd3b9c9, 0x0bd3bfc9, 0x0bd3c049, 0x0bd3ed55, 0x0bd42ecd, 0x0bd4574d,
+    0x0bd4594d, 0x0bd478f9, 0x0bd47a79, 0x0bd4e73e, 0x0bd4f03e, 0x0bd51659, 0x0bd51afe, 0x0bd53a89,
+    0x0bd53d85, 0x0bd55355, 0x0bd559fe, 0x0bd56579, 0x0bd566d5, 0x0bd56755, 0x0bd57bd1, 0x0bd5b7d1,
+    0x0bd5b851, 0x0bd5cefe, 0x0bd5d37d, 0x0bd5e57a, 0x0bd5e6fd, 0x0bd60955, 0x0bd60dfe, 0x0bd64cfe,
+    0x0bd64f3e, 0x0bd680f9, 0x0bd682f9, 0x0bd6877d, 0x0bd688fd, 0x0bd8623e, 0x0bd89c8d, 0x0bd89e0d,
+    0x0bdbb979, 0x0bdbbb55, 0x0bdbfefe, 0x0bdc32fa, 0x0bdc397a, 0x0bdc3afd, 0x0bdcac79, 0x0bdcae7e,
+    0x0bdcb2fe, 0x0bdcc07e, 0x0bdce879, 0x0bdce8f9, 0x0bdcea79, 0x0bdceefd, 0x0bdfc219, 0x0be6fb7a,
+    0x0be796f9, 0x0be7aaf9, 0x0be7ac79, 0x0be88bd5, 0x0be8cf7e, 0x0be8dcfe, 0x0be8e17a, 0x0be8e2fe,
+    0x0be9037a, 0x0be904f9, 0x0be90579, 0x0be909fa, 0x0be90b7d, 0x0be916fa, 0x0be9177a, 0x0be918f9,
+    0x0be91d7a, 0x0be97cf9, 0x0be97e79, 0x0be97efe, 0x0be99079, 0x0be990fe, 0x0be9927e, 0x0be9b8f9,
+    0x0be9b979, 0x0be9baf9, 0x0bea29fe, 0x0bea2cfe, 0x0bea3499, 0x0bea35fe, 0x0bea39be, 0x0bea6f19,
+    0x0bea6f99, 0x0bea7119, 0x0beab496, 0x0beb208d, 0x0beb2989, 0x0beb6415, 0x0beb98be, 0x0beb9c89,
+    0x0beb9d3e, 0x0beba03e, 0x0bec5bda, 0x0bec7e11, 0x0becfdd2, 0x0bed48fa, 0x0bed4f7a, 0x0bed5cfa,
+    0x0bedfef9, 0x0bee3d15, 0x0bee71be, 0x0bee7589, 0x0beeec8d, 0x0beef5bd, 0x0bef3079, 0x0bef31be,
+    0x0bef357a, 0x0bef36fe, 0x0bef447e, 0x0bef6afa, 0x0bef6b7a, 0x0bef6cf9, 0x0bef717a, 0x0befe13e,
+    0x0befe479, 0x0befe4fe, 0x0befe67e, 0x0bf6ab8d, 0x0bf6ad0d, 0x0bf6b609, 0x0bf6bd89, 0x0bf6c085,
+    0x0bf6c985, 0x0bf6cd55, 0x0bf6ced5, 0x0bf6dad5, 0x0bf6dc55, 0x0bf6e0d5, 0x0bf6fecd, 0x0bf707c9,
+    0x0bf710cd, 0x0bf71266, 0x0bf71b66, 0x0bf72bd1, 0x0bf72d51, 0x0bf731d1, 0x0bf7394d, 0x0bf73acd,
+    0x0bf743c9, 0x0bf7d49d, 0x0bf7fd1d, 0x0bf7fe9d, 0x0bf80a9d, 0x0bf80c1d, 0x0bf81ed1, 0x0bf82079,
+    0x0bf824e5, 0x0bf82c4d, 0x0bf82df9, 0x0bf836e5, 0x0bf866c9, 0x0bf87239, 0x0bf876a5, 0x0bf87826,
+    0x0bf8841d, 0x0bf885a6, 0x0bf88a26, 0x0bf8ac9d, 0x0bf8ae39, 0x0bf8b2a5, 0x0bfa1fe5, 0x0bfa2165,
+    0x0bfa9966, 0x0bfaf7d1, 0x0bfaf951, 0x0bfafdfd, 0x0bfb054d, 0x0bfb06cd, 0x0bfb0ffd, 0x0bfb4b19,
+    0x0bfb4fbd, 0x0bfb5126, 0x0bfb5d19, 0x0bfb5ea6, 0x0bfb6326, 0x0bfb8599, 0x0bfb8719, 0x0bfb8bbd,
+    0x0bfc7895, 0x0bfc7a39, 0x0bfcae8d, 0x0bfcb565, 0x0bfd3065, 0x0bfd64e5, 0x0bfde8e5, 0x0bfe289e,
+    0x0bfe2a1e, 0x0bfe6025, 0x0bfe64a5, 0x0bfed825, 0x0bfed9a6, 0x0c01b125, 0x0c01b2a6, 0x0c026b26,
+    0x0c06c361, 0x0c08cfe1, 0x0c08e3e1, 0x0c0a0e56, 0x0c0a1756, 0x0c0a4519, 0x0c0a4749, 0x0c0a5299,
+    0x0c0a5719, 0x0c0a6fc9, 0x0c0a7b19, 0x0c0a7f99, 0x0c0a8119, 0x0c0a8d19, 0x0c0a8e99, 0x0c0a9319,
+    0x0c0b020d, 0x0c0b2a8d, 0x0c0b3c8d, 0x0c0b3e0d, 0x0c0b4709, 0x0c0b5b56, 0x0c0b6ec5, 0x0c0b7295,
+    0x0c0b7416, 0x0c0b8616, 0x0c0bad09, 0x0c0bb60d, 0x0c0bba89, 0x0c0bd711, 0x0c0bde8d, 0x0c0be309,
+    0x0c0be909, 0x0c0d5af9, 0x0c0d6cf9, 0x0c0d6e79, 0x0c0de1f9, 0x0c0de679, 0x0c0e087d, 0x0c0e0a79,
+    0x0c0e0ef9, 0x0c0e1079, 0x0c0e1c79, 0x0c0e1df9, 0x0c0e2279, 0x0c0e8f0d, 0x0c0eb78d, 0x0c0f40fd,
+    0x0c0f4e79, 0x0c0f52fd, 0x0c0f76f9, 0x0c0f7b7d, 0x0c0f7cfd, 0x0c0f88f9, 0x0c0f8a79, 0x0c0f8efd,
+    0x0c0fa316, 0x0c0fb516, 0x0c0ff4fd, 0x0c100279, 0x0c102af9, 0x0c102c79, 0x0c1030fd, 0x0c106256,
+    0x0c106b56, 0x0c109b49, 0x0c10a499, 0x0c10a699, 0x0c10ab19, 0x0c10b899, 0x0c10e119, 0x0c10e299,
+    0x0c10e719, 0x0c112616, 0x0c11561e, 0x0c11908d, 0x0c11920d, 0x0c119b09, 0x0c11d596, 0x0c120a0d,
+    0x0c120e89, 0x0c12460e, 0x0c13ba7d, 0x0c13c0f9, 0x0c13c279, 0x0c1433f9, 0x0c1435f9, 0x0c143a79,
+    0x0c1447f9, 0x0c146ffd, 0x0c147079, 0x0c1471f9, 0x0c147679, 0x0c14ae96, 0x0c14e30d, 0x0c156716,
+    0x0c15a079, 0x0c15a279, 0x0c15a6fd, 0x0c15b479, 0x0c15dcf9, 0x0c15de79, 0x0c15e2fd, 0x0c165679,
+    0x0c17ffa1, 0x0c196c21, 0x0c1d23d1, 0x0c1d2551, 0x0c1d29d9, 0x0c1d314d, 0x0c1d32cd, 0x0c1d3bd9,
+    0x0c1d6bc9, 0x0c1d7519, 0x0c1d7699, 0x0c1d7719, 0x0c1d7b99, 0x0c1d7d19, 0x0c1d8899, 0x0c1d8919,
+    0x0c1d8a99, 0x0c1d8f19, 0x0c1db13d, 0x0c1db199, 0x0c1db319, 0x0c1db799, 0x0c1dddc9, 0x0c1de845,
+    0x0c1df145, 0x0c1df515, 0x0c1df695, 0x0c1e0895, 0x0c1e269e, 0x0c1e2f9e, 0x0c1e388d, 0x0c1e3a0d,
+    0x0c1e4309, 0x0c1e5991, 0x0c1e610d, 0x0c1e628d, 0x0c1e6b89, 0x0c1ea0c5, 0x0c1ea495, 0x0c1ea639,
+    0x0c1eda8d, 0x0c1ede89, 0x0c1edf09, 0x0c1ef28a, 0x0c1f1b0a, 0x0c1fc011, 0x0c206479, 0x0c2068f9,
+    0x0c206a79, 0x0c208afd, 0x0c208c7d, 0x0c208cf9, 0x0c209179, 0x0c2092f9, 0x0c209e7d, 0x0c209ef9,
+    0x0c20a079, 0x0c20a4f9, 0x0c210479, 0x0c2105f9, 0x0c210679, 0x0c2117f9, 0x0c211879, 0x0c2119f9,
+    0x0c21407d, 0x0c2140f9, 0x0c214279, 0x0c217d95, 0x0c217f15, 0x0c21b38d, 0x0c2225bd, 0x0c222e8d,
+    0x0c2237bd, 0x0c2270f9, 0x0c227279, 0x0c2272f9, 0x0c22777d, 0x0c2278fd, 0x0c228479, 0x0c2284f9,
+    0x0c228679, 0x0c228afd, 0x0c22acfd, 0x0c22ad79, 0x0c22aef9, 0x0c22b37d, 0x0c22e70a, 0x0c232679,
+    0x0c2326f9, 0x0c232879, 0x0c2e5f4a, 0x0c2e60c6, 0x0c2e9e99, 0x0c2e9f19, 0x0c2f1a15, 0x0c2f1e95,
+    0x0c34b695, 0x0c34b815, 0x0c34bd32, 0x0c34beb2, 0x0c34c6c5, 0x0c34ca15, 0x0c34ca95, 0x0c34cc15,
+    0x0c34d095, 0x0c352ab2, 0x0c352d09, 0x0c3530b2, 0x0c3533b2, 0x0c35410a, 0x0c35e7e5, 0x0c35ee72,
+    0x0c35f9e6, 0x0c35fa66, 0x0c35fbe5, 0x0c360065, 0x0c361c32, 0x0c361db2, 0x0c362009, 0x0c3620b2,
+    0x0c3623b2, 0x0c36340a, 0x0c365fe5, 0x0c366165, 0x0c367365, 0x0c3673e5, 0x0c367565, 0x0c3679e5,
+    0x0c3698b2, 0x0c369be5, 0x0c369df2, 0x0c36a272, 0x0c3b074a, 0x0c3b1ac5, 0x0c3b1e15, 0x0c3b1e95,
+    0x0c3b2015, 0x0c3b2495, 0x0c3b950a, 0x0c3c11e5, 0x0c3c1365, 0x0c3c186a, 0x0c3c19e5, 0x0c3c2571,
+    0x0c3c25ea, 0x0c3c2765, 0x0c3c2bea, 0x0c3c4de5, 0x0c3c4e65, 0x0c3c4fe5, 0x0c3c5465, 0x0c3c838e,
+    0x0c3c880a, 0x0c3cc765, 0x0c3cc7e5, 0x0c3cc965, 0x0c3ccde5, 0x0c42caf2, 0x0c481951, 0x0c48486a,
+    0x0c4868da, 0x0c486f72, 0x0c487cda, 0x0c48eaa9, 0x0c48f831, 0x0c48fca9, 0x0c48fea9, 0x0c499a29,
+    0x0c49a76a, 0x0c49ae29, 0x0c49b06a, 0x0c49ce72, 0x0c49d2f2, 0x0c4ed0d9, 0x0c4f4c31, 0x0c4f72f2,
+    0x0c4fc9d5, 0x0c4ff251, 0x0c55c661, 0x0c55c6ea, 0x0c55c861, 0x0c55ccea, 0x0c5b2509, 0x0c5b28b2,
+    0x0c5b390a, 0x0c5b64d9, 0x0c5b6659, 0x0c5b6cf2, 0x0c5b7859, 0x0c5b78d9, 0x0c5b7a59, 0x0c5b7ed9,
+    0x0c5ba0d9, 0x0c5ba2f2, 0x0c5ba772, 0x0c5c90b2, 0x0c5c93d5, 0x0c5c95f2, 0x0c5cca72, 0x0c5ccef2,
+    0x0c618d0a, 0x0c61cc59, 0x0c61ccd9, 0x0c61ce59, 0x0c61d2ed, 0x0c7c3a31, 0x0c7c3eb9, 0x0c7c40bd,
+    0x0c7cf03d, 0x0c81dead, 0x0c81ec2d, 0x0c81f0ad, 0x0c8280ad, 0x0c83302d, 0x0c8334ad, 0x0c835f2e,
+    0x0c88ef8d, 0x0c89383a, 0x0c89edad, 0x0c95e1be, 0x0c9615ba, 0x0c9617ad, 0x0c961c3a, 0x0c96913e,
+    0x0c9b4059, 0x0c9c2dba, 0x0c9c2f2d, 0x0c9c343a, 0x0c9c35be, 0x0c9c41ba, 0x0c9c433e, 0x0c9c47ba,
+    0x0c9c69ba, 0x0c9c6bad, 0x0c9c703a, 0x0c9ce32d, 0x0c9ce3be, 0x0c9ce53e, 0x0ca2a961, 0x0ca2a9e1,
+    0x0ca2ab61, 0x0ca2afe1, 0x0ca80432, 0x0ca805b2, 0x0ca80809, 0x0ca808b2, 0x0ca80bb2, 0x0ca81c0a,
+    0x0ca847d9, 0x0ca84959, 0x0ca85b59, 0x0ca85bd9, 0x0ca85d59, 0x0ca861d9, 0x0ca880b2, 0x0ca883fd,
+    0x0ca885f2, 0x0ca88a72, 0x0ca9474e, 0x0ca973b2, 0x0ca976d5, 0x0ca97772, 0x0ca9c0ce, 0x0cae700a,
+    0x0caeaf59, 0x0caeafd9, 0x0caeb159, 0x0caeb5e5, 0x0caf28d5, 0x0caf2955, 0x0caf2ad5, 0x0cbc532d,
+    0x0cbc73b2, 0x0cbc7532, 0x0cbc7a32, 0x0cbc8732, 0x0cbc87b2, 0x0cbc8932, 0x0cbc8dad, 0x0cbced2d,
+    0x0cbceeb9, 0x0cbd00ad, 0x0cbd012d, 0x0cbd02b9, 0x0cbd072d, 0x0cbd293d, 0x0cbd29b2, 0x0cc1b1d5,
+    0x0cc253d1, 0x0cc29f32, 0x0cc2a0b2, 0x0cc2a5ad, 0x0cc2a72d, 0x0cc2b332, 0x0cc2b4b2, 0x0cc2b92d,
+    0x0cc2db32, 0x0cc2dbb2, 0x0cc2dd32, 0x0cc2e1ad, 0x0cc354ad, 0x0cc3552d, 0x0cc356b9, 0x0cc35b2d,
+    0x0cce78b2, 0x0cce7bd5, 0x0cce7df2, 0x0cceb6f2, 0x0ccf6fad, 0x0ccf712d, 0x0ccf832d, 0x0ccf83ad,
+    0x0ccf852d, 0x0ccf89ad, 0x0ccfabbd, 0x0ccfadb2, 0x0ccfb232, 0x0cd0252d, 0x0cd025b2, 0x0cd5d72d,
+    0x0cd5d7ad, 0x0cd5d92d, 0x0cd93ebe, 0x0cd94515, 0x0cd94695, 0x0cd9bd05, 0x0cda7661, 0x0cdaa9be,
+    0x0cdaaabe, 0x0cdab005, 0x0cdae7fe, 0x0cdae97e, 0x0cdaee61, 0x0cdaefe1, 0x0cdb23fe, 0x0cdb25fe,
+    0x0cdb2a61, 0x0cdb5d45, 0x0cdb6095, 0x0cdb6115, 0x0cdb6295, 0x0cdb6715, 0x0cdbd78a, 0x0cdc906a,
+    0x0cdc90e6, 0x0cdc9261, 0x0cdc96e1, 0x0cdcca8a, 0x0cdd09e1, 0x0cdd0a61, 0x0cdd0be1, 0x0cdd1061,
+    0x0ce5e6be, 0x0ce5ed11, 0x0ce5ee91, 0x0ce65259, 0x0ce653d9, 0x0ce66505, 0x0ce67ae5, 0x0ce67c59,
+    0x0ce68e59, 0x0ce71e51, 0x0ce751be, 0x0ce752be, 0x0ce75805, 0x0ce76dd5, 0x0ce76f65, 0x0ce78155,
+    0x0ce78ffe, 0x0ce7917e, 0x0ce79651, 0x0ce7cbfe, 0x0ce7cdfe, 0x0ce7d251, 0x0ce80545, 0x0ce80891,
+    0x0ce80911, 0x0ce80a91, 0x0ce80f11, 0x0ce81a89, 0x0ce82e8a, 0x0ce83006, 0x0ce86df1, 0x0ce86e59,
+    0x0ce86fd9, 0x0ce87459, 0x0ce87f8a, 0x0ce88106, 0x0ce89305, 0x0ce89659, 0x0ce896e5, 0x0ce89859,
+    0x0ce89cd9, 0x0ce8d3d5, 0x0ce8d555, 0x0ce93851, 0x0ce93a51, 0x0ce93ed1, 0x0ce95fc6, 0x0ce9728a,
+    0x0ce97406, 0x0ce98605, 0x0ce98955, 0x0ce989d5, 0x0ce98b55, 0x0ce98fd5, 0x0ce9b1d1, 0x0ce9b251,
+    0x0ce9b3d1, 0x0ce9b851, 0x0ce9d946, 0x0cea004a, 0x0cea01c6, 0x0cea92d9, 0x0cea9759, 0x0ceb4b49,
+    0x0cecaecd, 0x0cecb7c9, 0x0cecf759, 0x0ced72a1, 0x0cee223d, 0x0cee26a1, 0x0cee28a1, 0x0cee5cfe,
+    0x0cef135a, 0x0cef8eb1, 0x0cef9321, 0x0cef9521, 0x0cf044a1, 0x0cf0d969, 0x0cf0fd69, 0x0cf1b829,
+    0x0cf25a29, 0x0cf267a9, 0x0cf26c29, 0x0cf324a9, 0x0cf468a9, 0x0cf53329, 0x0cf540a9, 0x0cf54529,
+    0x0cf5d529, 0x0cf684a9, 0x0cf68929, 0x0cf6d62a, 0x0cf75ef2, 0x0cf80c1d, 0x0cf81e32, 0x0cf8201d,
+    0x0cf8bb9d, 0x0cf8cf9d, 0x0cf8d41d, 0x0cf97899, 0x0cf98632, 0x0cf98ab2, 0x0cf98c99, 0x0cf99f51,
+    0x0cfa35b2, 0x0cfa7e29, 0x0cfad78d, 0x0cfb04fe, 0x0cfb2029, 0x0cfb21a9, 0x0cfbbb51, 0x0cfbcd49,
+    0x0cfc440d, 0x0cfc8632, 0x0cfc87b2, 0x0cfc8ca9, 0x0cfc8e29, 0x0cfc9a32, 0x0cfcffa9, 0x0cfd0129,
+    0x0cfd13a9, 0x0cfd1529, 0x0cfd19a9, 0x0cfd3ba9, 0x0cfd3c29, 0x0cfd3da9, 0x0cfd4229, 0x0cffb505,
+    0x0cffecfe, 0x0cfff359, 0x0cfff4d9, 0x0d002f59, 0x0d011bfe, 0x0d011dfe, 0x0d012271, 0x0d01cf8a,
+    0x0d01d182, 0x0d020ed9, 0x0d020f59, 0x0d0210d9, 0x0d021559, 0x0d028855, 0x0d0288d5, 0x0d030142,
+    0x0d037ac2, 0x0d075029, 0x0d07c831, 0x0d07c9b1, 0x0d080431, 0x0d096c29, 0x0d0970a9, 0x0d09e3a9,
+    0x0d09e429, 0x0d09e5a9, 0x0d09ea31, 0x0d0c5d05, 0x0d0c72d5, 0x0d0c7455, 0x0d0c8655, 0x0d0c94fe,
+    0x0d0c9b5a, 0x0d0cd751, 0x0d0d7a2a, 0x0d0d7ba9, 0x0d0da429, 0x0d0db629, 0x0d0dc3fe, 0x0d0dc5fe,
+    0x0d0dca71, 0x0d0e1c31, 0x0d0e1db1, 0x0d0e2fb1, 0x0d0e5831, 0x0d0e778a, 0x0d0e8b05, 0x0d0e8e55,
+    0x0d0e8ed5, 0x0d0e9055, 0x0d0e94d5, 0x0d0eb751, 0x0d0ec949, 0x0d0f054a, 0x0d0f8229, 0x0d0f83a9,
+    0x0d0f8a29, 0x0d0f95b1, 0x0d0f962a, 0x0d0f97a9, 0x0d0f9c2a, 0x0d0fbe29, 0x0d0fc029, 0x0d0fc4a9,
+    0x0d0ff84a, 0x0d1037a9, 0x0d103829, 0x0d1039a9, 0x0d103e31, 0x0d15c1fa, 0x0d1639fa, 0x0d163afa,
+    0x0d2269fa, 0x0d230b3a, 0x0d243f61, 0x0d24fa21, 0x0d25a9a1, 0x0d25ae21, 0x0d2666a1, 0x0d2807a2,
+    0x0d2882a1, 0x0d288721, 0x0d310019, 0x0d310db2, 0x0d311232, 0x0d31143d, 0x0d31a211, 0x0d31c632,
+    0x0d330e91, 0x0d3329b2, 0x0d3332b2, 0x0d33ed72, 0x0d348f71, 0x0d349cf2, 0x0d34a172, 0x0d34a37d,
+    0x0d34afbe, 0x0d34d7be, 0x0d35fbf1, 0x0d360972, 0x0d360df2, 0x0d360ffd, 0x0d36ab71, 0x0d36aff1,
+    0x0d36bf7d, 0x0d36c3fd, 0x0d3c703a, 0x0d3cac3a, 0x0d3d25a1, 0x0d3d263e, 0x0d3d27be, 0x0d4c92be,
+    0x0d4c9805, 0x0d4cd659, 0x0d4cd7d9, 0x0d4d0dfe, 0x0d4d1259, 0x0d4d497e, 0x0d4d4afe, 0x0d4d4fd5,
+    0x0d4d5155, 0x0d4dfefe, 0x0d4dff7e, 0x0d4e0555, 0x0d4eb28a, 0x0d4eb482, 0x0d4ef1d9, 0x0d4ef259,
+    0x0d4ef3d9, 0x0d4ef859, 0x0d4f6b55, 0x0d4f6bd5, 0x0d4f6d55, 0x0d4f71d5, 0x0d4fe442, 0x0d505dc2,
+    0x0d543325, 0x0d54ab25, 0x0d54acb9, 0x0d54e725, 0x0d564f25, 0x0d5653a5, 0x0d56c6a5, 0x0d56c725,
+    0x0d56c8b9, 0x0d56cd25, 0x0d593abe, 0x0d594005, 0x0d5955d5, 0x0d595755, 0x0d596955, 0x0d59b5fe,
+    0x0d59ba51, 0x0d59f17e, 0x0d59f2fe, 0x0d59f7d1, 0x0d59f951, 0x0d5a5d25, 0x0d5a5ea5, 0x0d5a85a5,
+    0x0d5a8725, 0x0d5a9925, 0x0d5aa6fe, 0x0d5aa77e, 0x0d5aad51, 0x0d5aff25, 0x0d5b00b9, 0x0d5b12a5,
+    0x0d5b3b25, 0x0d5b5a8a, 0x0d5b6e05, 0x0d5b7155, 0x0d5b71d5, 0x0d5b7355, 0x0d5b77d5, 0x0d5be84a,
+    0x0d5c1351, 0x0d5c13d1, 0x0d5c1551, 0x0d5c19d1, 0x0d5c6525, 0x0d5c66a5, 0x0d5c78b1, 0x0d5c7925,
+    0x0d5c7aa5, 0x0d5c7f25, 0x0d5ca13d, 0x0d5ca1a5, 0x0d5ca325, 0x0d5ca7a5, 0x0d5cdb4a, 0x0d5d1aa5,
+    0x0d5d1b25, 0x0d5d1cb9, 0x0d5d2125, 0x0d5ea41d, 0x0d601099, 0x0d6044fe, 0x0d610221, 0x0d61b1be,
+    0x0d62e1b2, 0x0d631e32, 0x0d639721, 0x0d6397a1, 0x0d639da1, 0x0d644219, 0x0d644f99, 0x0d645419,
+    0x0d645619, 0x0d64e411, 0x0d650809, 0x0d665091, 0x0d666b8d, 0x0d667489, 0x0d672f71, 0x0d67d17a,
+    0x0d67defa, 0x0d67e371, 0x0d67e57a, 0x0d68be32, 0x0d693df1, 0x0d694b71, 0x0d694ff1, 0x0d6951f1,
+    0x0d69ed7a, 0x0d69f1f1, 0x0d6a017a, 0x0d6a2632, 0x0d6cecfe, 0x0d6d0819, 0x0d6daa11, 0x0d6dfcb9,
+    0x0d6e46fa, 0x0d6e59be, 0x0d6f2419, 0x0d6fc632, 0x0d7305fe, 0x0d730a55, 0x0d73fe21, 0x0d73ffa1,
+    0x0d7435be, 0x0d743a21, 0x0d74ad3e, 0x0d74adbe, 0x0d74b3b1, 0x0d7619a1, 0x0d761a21, 0x0d761ba1,
+    0x0d762021, 0x0d7d9d55, 0x0d7d9dd5, 0x0d7d9f55, 0x0d7da3d5, 0x0d7ea51d, 0x0d7ea69d, 0x0d7eab1d,
+    0x0d7ecf1d, 0x0d7ed39d, 0x0d7f469d, 0x0d7f471d, 0x0d7f48b9, 0x0d7f4d31, 0x0d7fac7e, 0x0d7fadfe,
+    0x0d7fb251, 0x0d80041a, 0x0d80059a, 0x0d8011be, 0x0d80133e, 0x0d801799, 0x0d803bbe, 0x0d804019,
+    0x0d807d96, 0x0d807f16, 0x0d80a612, 0x0d80ddbe, 0x0d80e211, 0x0d812cbe, 0x0d812d3e, 0x0d812ebe,
+    0x0d813331, 0x0d81553e, 0x0d8155be, 0x0d81e04a, 0x0d821f99, 0x0d822019, 0x0d822199, 0x0d822619,
+    0x0d829915, 0x0d829995, 0x0d829b15, 0x0d829f95, 0x0d82c191, 0x0d82c211, 0x0d82c391, 0x0d8418c6,
+    0x0d863945, 0x0d863c95, 0x0d863d15, 0x0d863e95, 0x0d864315, 0x0d86b38a, 0x0d86b582, 0x0d873061,
+    0x0d8731e1, 0x0d8736ea, 0x0d873861, 0x0d876ce5, 0x0d876e61, 0x0d8772e1, 0x0d87a68a, 0x0d87a806,
+    0x0d87a882, 0x0d87e5e1, 0x0d87e661, 0x0d87e7e1, 0x0d87ec61, 0x0d895261, 0x0d8952ea, 0x0d895461,
+    0x0d8958fd, 0x0d8a6e95, 0x0d8a7015, 0x0d8a7532, 0x0d8a76b2, 0x0d8a7ec5, 0x0d8a8215, 0x0d8a8295,
+    0x0d8a8415, 0x0d8a8895, 0x0d8ae509, 0x0d8ae8b2, 0x0d8aebb2, 0x0d8af90a, 0x0d8afa86, 0x0d8b9fdd,
+    0x0d8ba672, 0x0d8bb1dd, 0x0d8bb3dd, 0x0d8bb85d, 0x0d8bd5b2, 0x0d8bd809, 0x0d8bd8b2, 0x0d8bdbb2,
+    0x0d8bec0a, 0x0d8bed86, 0x0d8c17dd, 0x0d8c195d, 0x0d8c2b5d, 0x0d8c2bdd, 0x0d8c2d5d, 0x0d8c31dd,
+    0x0d8c50b2, 0x0d8c53dd, 0x0d8c55f2, 0x0d8c5a72, 0x0d8caa85, 0x0d8ce8d9, 0x0d8cea59, 0x0d8d1ee5,
+    0x0d8d2059, 0x0d8d24d9, 0x0d8e0e05, 0x0d8e1155, 0x0d8e11d5, 0x0d8e1355, 0x0d8e17d5, 0x0d8e884a,
+    0x0d8ec50a, 0x0d8ec686, 0x0d8ef0d9, 0x0d8ef259, 0x0d8f0459, 0x0d8f04d9, 0x0d8f0659, 0x0d8f0afd,
+    0x0d8f2cd9, 0x0d8f7e55, 0x0d8f7fd5, 0x0d8ff4ca, 0x0d901fd5, 0x0d906e4a, 0x0d90bf4a, 0x0d90c0c6,
+    0x0d90d2c5, 0x0d90d615, 0x0d90d695, 0x0d90d815, 0x0d90dc95, 0x0d914d0a, 0x0d91c9de, 0x0d91cb5e,
+    0x0d91d05e, 0x0d91d1de, 0x0d91ddea, 0x0d91df5d, 0x0d91e3ea, 0x0d9207dd, 0x0d920c5d, 0x0d92400a,
+    0x0d927f5d, 0x0d927fdd, 0x0d928165, 0x0d9285e5, 0x0d92e145, 0x0d92e491, 0x0d92e515, 0x0d92e691,
+    0x0d92eb11, 0x0d92f689, 0x0d92fe85, 0x0d930a8a, 0x0d930c06, 0x0d93365a, 0x0d9337da, 0x0d9349f1,
+    0x0d934a59, 0x0d934bd9, 0x0d935059, 0x0d935b8a, 0x0d936f05, 0x0d937265, 0x0d937459, 0x0d9378d9,
+    0x0d93b656, 0x0d93b7d6, 0x0d93d852, 0x0d93d9d2, 0x0d93ded2, 0x0d93e052, 0x0d941651, 0x0d941ad1,
+    0x0d944e8a, 0x0d945006, 0x0d946205, 0x0d946555, 0x0d9465d5, 0x0d946765, 0x0d946be5, 0x0d948dd1,
+    0x0d948e51, 0x0d94dc4a, 0x0d95190a, 0x0d955859, 0x0d9558d9, 0x0d955a59, 0x0d955efd, 0x0d95d1d5,
+    0x0d95d255, 0x0d95d3d5, 0x0d95fa51, 0x0d95faea, 0x0d95fc51, 0x0d9882f2, 0x0d99ef59, 0x0d9a7121,
+    0x0d9e20d9, 0x0d9e2772, 0x0d9e34d9, 0x0d9f8af2, 0x0da0d901, 0x0da114a9, 0x0da1c429, 0x0da22b19,
+    0x0da31cb2, 0x0da31e32, 0x0da33032, 0x0da330b2, 0x0da33232, 0x0da336bd, 0x0da38111, 0x0da39629,
+    0x0da397a9, 0x0da3a9a9, 0x0da3aa29, 0x0da3aba9, 0x0da3b03d, 0x0da3d229, 0x0da48859, 0x0da488d9,
+    0x0da57d55, 0x0da581d5, 0x0da69751, 0x0da6a949, 0x0da741a9, 0x0da763b2, 0x0da768a9, 0x0da76a29,
+    0x0da77632, 0x0da777b2, 0x0da77c29, 0x0da7e3a9, 0x0da7efa9, 0x0da7f129, 0x0da7f5a9, 0x0da817a9,
+    0x0da81829, 0x0da819a9, 0x0da81e29, 0x0da94832, 0x0da949b2, 0x0da9503d, 0x0da95db2, 0x0da98432,
+    0x0da984b2, 0x0da98632, 0x0da98abd, 0x0da9fda9, 0x0da9fe29, 0x0da9ffa9, 0x0daa043d, 0x0dacab8a,
+    0x0dacad82, 0x0daceae1, 0x0daceb59, 0x0dacecd9, 0x0dacf159, 0x0dad64d5, 0x0dad6655, 0x0dad6ad5,
+    0x0db0dd09, 0x0db0e0b2, 0x0db0f10a, 0x0db0f286, 0x0db11cd9, 0x0db11e59, 0x0db124f2, 0x0db13059,
+    0x0db130d9, 0x0db13259, 0x0db136d9, 0x0db158d9, 0x0db15af2, 0x0db15f72, 0x0db248b2, 0x0db24bd5,
+    0x0db24df2, 0x0db286f2, 0x0db316d5, 0x0db31855, 0x0db31cd5, 0x0db40a29, 0x0db40ba9, 0x0db410aa,
+    0x0db41229, 0x0db43429, 0x0db44629, 0x0db44829, 0x0db44ca9, 0x0db4804a, 0x0db4ac29, 0x0db4ada9,
+    0x0db4bfa9, 0x0db4c029, 0x0db4c1a9, 0x0db4c631, 0x0db4e829, 0x0db4ea32, 0x0db524d5, 0x0db618a9,
+    0x0db61a29, 0x0db62c29, 0x0db62caa, 0x0db62e29, 0x0db632bd, 0x0db654a9, 0x0db6ce29, 0x0db7450a,
+    0x0db78469, 0x0db784ea, 0x0db78669, 0x0db78ae9, 0x0db9538a, 0x0db96729, 0x0db96a69, 0x0db96c69,
+    0x0db970e9, 0x0db9936a, 0x0db9a55a, 0x0db9e14a, 0x0dba722a, 0x0dba73a9, 0x0dba782a, 0x0dba9c29,
+    0x0dbaa0a9, 0x0dbad44a, 0x0dbb13a9, 0x0dbb1429, 0x0dbc8029, 0x0dbc80aa, 0x0dbc8229, 0x0dbef3fa,
+    0x0dc06059, 0x0dc0a47a, 0x0dc7863a, 0x0dc787a5, 0x0dc7f925, 0x0dc7faa5, 0x0dc7ffbe, 0x0dc8013e,
+    0x0dc83525, 0x0dc835a5, 0x0dc83725, 0x0dc83ba5, 0x0dc9a1ba, 0x0dc9a23a, 0x0dc9a3a5, 0x0dca1d3e,
+    0x0dcd0851, 0x0dcd08e5, 0x0dcd4c7a, 0x0dcdb1ba, 0x0dcdd3ba, 0x0dcde73a, 0x0dcde7ba, 0x0dcdfd51,
+    0x0dce01d1, 0x0dce4d25, 0x0dce4ea5, 0x0dce53be, 0x0dce62be, 0x0dce673e, 0x0dce8925, 0x0dce89a5,
+    0x0dce8b25, 0x0dce8fa5, 0x0dcfb9ba, 0x0dcfc03a, 0x0dcfcdba, 0x0dcfd3ba, 0x0dcff5ba, 0x0dcff63a,
+    0x0dcff7a5, 0x0dd06f25, 0x0dd06fbe, 0x0dd0713e, 0x0dd3995a, 0x0dd41b01, 0x0dd45032, 0x0dd505a1,
+    0x0dd79699, 0x0dd7a419, 0x0dd83891, 0x0dd9173e, 0x0dd9a511, 0x0dd9c00d, 0x0dda83f1, 0x0ddb25f1,
+    0x0ddb3371, 0x0ddb37f1, 0x0ddbc111, 0x0ddbf03e, 0x0ddc927e, 0x0ddc9ff1, 0x0ddca47e, 0x0ddd41f1,
+    0x0ddd467e, 0x0ddd4f3e, 0x0ddd53f1, 0x0ddd583e, 0x0de0561a, 0x0de06a1a, 0x0de0ebfd, 0x0de0f832,
+    0x0de12032, 0x0de1ae11, 0x0de47259, 0x0de65855, 0x0de74c3a, 0x0de74da1, 0x0de752ba, 0x0de7543e,
+    0x0de7883a, 0x0de78a21, 0x0de78eba, 0x0de801a1, 0x0de8023e, 0x0de803be, 0x0de96e3a, 0x0de96eba,
+    0x0de9703e, 0x0de974ba, 0x0df0f1d5, 0x0df0f256, 0x0df0f3d5, 0x0df0f85a, 0x0df1ac56, 0x0df1ed9e,
+    0x0df1f93a, 0x0df1f9ba, 0x0df1fb3e, 0x0df1ffba, 0x0df221ba, 0x0df2239d, 0x0df2283a, 0x0df29b1d,
+    0x0df29bbe, 0x0df29d3e, 0x0df2a1be, 0x0df30051, 0x0df300d6, 0x0df30251, 0x0df306d6, 0x0df312d6,
+    0x0df315d6, 0x0df327c6, 0x0df33c5a, 0x0df33d5a, 0x0df3541a, 0x0df365b1, 0x0df3663e, 0x0df367be,
+    0x0df36c3e, 0x0df378c6, 0x0df38ac5, 0x0df38e19, 0x0df39019, 0x0df39499, 0x0df3dfba, 0x0df3e115,
+    0x0df3e5ba, 0x0df3f412, 0x0df41b3a, 0x0df41c3a, 0x0df43211, 0x0df436ba, 0x0df46bc6, 0x0df47dc5,
+    0x0df48115, 0x0df48195, 0x0df48315, 0x0df487b1, 0x0df4a991, 0x0df4aa3e, 0x0df4b03e, 0x0df4bc3e,
+    0x0df4bf3e, 0x0df4d106, 0x0df4f80a, 0x0df5304e, 0x0df57419, 0x0df574be, 0x0df5763e, 0x0df57abe,
+    0x0df5edba, 0x0df5ee3a, 0x0df5ef95, 0x0df5f43a, 0x0df6163a, 0x0df616ba, 0x0df6183e, 0x0df6243a,
+    0x0df625be, 0x0df62ebe, 0x0df6600e, 0x0df98e8a, 0x0df9cde1, 0x0df9ce59, 0x0df9cfd9, 0x0df9d459,
+    0x0dfa47d5, 0x0dfa4955, 0x0dfa4dd5, 0x0dfdc009, 0x0dfdc0b2, 0x0dfdc3b2, 0x0dfdd40a, 0x0dfdd586,
+    0x0dfdffd9, 0x0dfe0159, 0x0dfe1359, 0x0dfe13d9, 0x0dfe1559, 0x0dfe19d9, 0x0dfe38b2, 0x0dfe3bfd,
+    0x0dfe3df2, 0x0dfe4272, 0x0dff2bb2, 0x0dff2ed5, 0x0dff2f72, 0x0dffe755, 0x0dfff955, 0x0dfff9d5,
+    0x0dfffb55, 0x0dffffd5, 0x0e00ed25, 0x0e00eea5, 0x0e00f3a5, 0x0e00f525, 0x0e01173d, 0x0e01293d,
+    0x0e0129a5, 0x0e012b25, 0x0e012fa5, 0x0e01634a, 0x0e018f25, 0x0e0190b9, 0x0e01a2a5, 0x0e01a325,
+    0x0e01a4b9, 0x0e01a925, 0x0e01cb3d, 0x0e0207d5, 0x0e02fba5, 0x0e02fd25, 0x0e030f25, 0x0e030fa5,
+    0x0e031125, 0x0e0315bd, 0x0e0337bd, 0x0e03b125, 0x0e04280a, 0x0e046765, 0x0e0467e5, 0x0e046965,
+    0x0e046de5, 0x0e06368a, 0x0e064a25, 0x0e064d65, 0x0e064f65, 0x0e0653e5, 0x0e067665, 0x0e06c44a,
+    0x0e06c5c6, 0x0e0701d6, 0x0e0704d6, 0x0e075525, 0x0e0756a5, 0x0e075b25, 0x0e077f25, 0x0e0783a5,
+    0x0e07b74a, 0x0e07f6a5, 0x0e07f725, 0x0e096325, 0x0e0963a5, 0x0e096525, 0x0e0cc9d5, 0x0e0dbdb2,
+    0x0e0dbf32, 0x0e0dc421, 0x0e0dc5a1, 0x0e0dfa32, 0x0e0dfbb2, 0x0e0e0021, 0x0e0e7321, 0x0e0e73a1,
+    0x0e0e79a1, 0x0e0fdfb2, 0x0e0fe032, 0x0e0fe1b2, 0x0e122bb2, 0x0e123232, 0x0e123fb2, 0x0e12e1b2,
+    0x0e13ac19, 0x0e142df1, 0x0e16e9f1, 0x0e176355, 0x0e1763d5, 0x0e176555, 0x0e1769d5, 0x0e17da4a,
+    0x0e186b32, 0x0e186cb2, 0x0e18711d, 0x0e189332, 0x0e1893b2, 0x0e189532, 0x0e18999d, 0x0e18cd4a,
+    0x0e190c9d, 0x0e190d1d, 0x0e190eb9, 0x0e19131d, 0x0e1971d1, 0x0e197251, 0x0e1973d1, 0x0e197851,
+    0x0e19845a, 0x0e19875a, 0x0e1999c2, 0x0e19d731, 0x0e19d799, 0x0e19d919, 0x0e19dd99, 0x0e19fc45,
+    0x0e19ffbd, 0x0e1a0019, 0x0e1a0199, 0x0e1a0619, 0x0e1a3f16, 0x0e1a5132, 0x0e1a52b2, 0x0e1a5715,
+    0x0e1aa232, 0x0e1aa3b2, 0x0e1aa811, 0x0e1ab432, 0x0e1ab732, 0x0e1aef45, 0x0e1af295, 0x0e1af315,
+    0x0e1af4b9, 0x0e1af915, 0x0e1b1b11, 0x0e1b1b91, 0x0e1b2191, 0x0e1b698a, 0x0e1ba64a, 0x0e1be599,
+    0x0e1be619, 0x0e1be799, 0x0e1bec3d, 0x0e1c5f32, 0x0e1c5fb2, 0x0e1c6132, 0x0e1c65bd, 0x0e1c87b2,
+    0x0e1c8832, 0x0e1c89b2, 0x0e20f621, 0x0e20f7a1, 0x0e20fc21, 0x0e2430b2, 0x0e2433d5, 0x0e243472,
+    0x0e2435f2, 0x0e246ef2, 0x0e25279e, 0x0e25291e, 0x0e253b1d, 0x0e253b9d, 0x0e253d1d, 0x0e25419d,
+    0x0e2563bd, 0x0e2565b2, 0x0e256a32, 0x0e25dd1d, 0x0e25ddb2, 0x0e264251, 0x0e2642d5, 0x0e264451,
+    0x0e2648d1, 0x0e2654f2, 0x0e2657f2, 0x0e26959a, 0x0e26a799, 0x0e26a819, 0x0e26a999, 0x0e26ae19,
+    0x0e26ccf2, 0x0e26d03d, 0x0e26d232, 0x0e26d6b2, 0x0e272115, 0x0e272195, 0x0e272315, 0x0e272795,
+    0x0e277411, 0x0e277891, 0x0e27bff2, 0x0e27c315, 0x0e27c3b2, 0x0e27c532, 0x0e27c9b2, 0x0e27eb91,
+    0x0e27ec11, 0x0e28b619, 0x0e28b6b2, 0x0e292f95, 0x0e293032, 0x0e2931b2, 0x0e295811, 0x0e295891,
+    0x0e295a11, 0x0e3539c9, 0x0e354c15, 0x0e354d62, 0x0e355095, 0x0e355122, 0x0e3552a2, 0x0e355e95,
+    0x0e356015, 0x0e356495, 0x0e35afa5, 0x0e35b111, 0x0e35b591, 0x0e35c7a2, 0x0e3645e1, 0x0e36586a,
+    0x0e367be6, 0x0e368e66, 0x0e368fe6, 0x0e369461, 0x0e36a291, 0x0e36a411, 0x0e36a891, 0x0e36baa2,
+    0x0e36f561, 0x0e36f9e1, 0x0e3707e1, 0x0e370961, 0x0e370de1, 0x0e372fe1, 0x0e373062, 0x0e3731e2,
+    0x0e373662, 0x0e3bb689, 0x0e3bc785, 0x0e3bca89, 0x0e3bf1d9, 0x0e3bf659, 0x0e3bf7d9, 0x0e3c0559,
+    0x0e3c05e6, 0x0e3c09d9, 0x0e3c0a59, 0x0e3c0bd9, 0x0e3c2c65, 0x0e3c2dd9, 0x0e3c3269, 0x0e3c41d9,
+    0x0e3c4659, 0x0e3cf466, 0x0e3cf766, 0x0e3cfa49, 0x0e3d1f55, 0x0e3d20d5, 0x0e3d2555, 0x0e3d2f95,
+    0x0e3d32d5, 0x0e3d34d5, 0x0e3d3955, 0x0e3d5fc9, 0x0e3d6dc9, 0x0e3d70c5, 0x0e3d73c9, 0x0e3d95c9,
+    0x0e420811, 0x0e420c91, 0x0e421e89, 0x0e425959, 0x0e4259d9, 0x0e425dd9, 0x0e425e59, 0x0e425fd9,
+    0x0e4271d9, 0x0e4295d9, 0x0e429a59, 0x0e430a65, 0x0e430e25, 0x0e435bca, 0x0e438385, 0x0e4386d5,
+    0x0e438755, 0x0e4388d5, 0x0e438d55, 0x0e43c149, 0x0e43c1c9, 0x0e43c7c9, 0x0e43fdca, 0x0e497ea1,
+    0x0e4990a1, 0x0e4992a1, 0x0e4a2e21, 0x0e4a4221, 0x0e4a54d1, 0x0e4a66e2, 0x0e4f2cc9, 0x0e4f4049,
+    0x0e4f40ea, 0x0e4f68e9, 0x0e4f7cd9, 0x0e4ffb29, 0x0e4ffbaa, 0x0e50222a, 0x0e5023a9, 0x0e503245,
+    0x0e5035aa, 0x0e50362a, 0x0e5037a9, 0x0e508211, 0x0e509729, 0x0e509ba9, 0x0e509d29, 0x0e50aaa9,
+    0x0e50ab2a, 0x0e50af29, 0x0e50afaa, 0x0e50b12a, 0x0e50d1a9, 0x0e50d7a9, 0x0e559449, 0x0e5594c9,
+    0x0e55d0c9, 0x0e564a89, 0x0e564c05, 0x0e564f29, 0x0e564fa9, 0x0e5689a9, 0x0e568a29, 0x0e568ba9,
+    0x0e569da9, 0x0e56fd29, 0x0e56fea9, 0x0e56ff29, 0x0e570329, 0x0e5703a9, 0x0e570529, 0x0e5710a9,
+    0x0e571129, 0x0e5712a9, 0x0e571729, 0x0e573929, 0x0e5739a9, 0x0e573b29, 0x0e573fa9, 0x0e5bad91,
+    0x0e5bbfa2, 0x0e5bfed9, 0x0e5c12d9, 0x0e5c3b62, 0x0e5d27d5, 0x0e5d2862, 0x0e5d29e2, 0x0e5d2e62,
+    0x0e5d50d1, 0x0e5d56d1, 0x0e622a55, 0x0e623e55, 0x0e6264c9, 0x0e6278c9, 0x0e631e29, 0x0e631fa9,
+    0x0e6331a9, 0x0e63322a, 0x0e6333a9, 0x0e635a29, 0x0e636e29, 0x0e63cda9, 0x0e63cf29, 0x0e63d3a9,
+    0x0e63e1a9, 0x0e63e329, 0x0e63e7a9, 0x0e6409a9, 0x0e689269, 0x0e68cce9, 0x0e6985a9, 0x0e69862a,
+    0x0e6987a9, 0x0e6999aa, 0x0e69c229, 0x0e6a3729, 0x0e6a3ba9, 0x0e6f7459, 0x0e75da49, 0x0e7693ba,
+    0x0e769525, 0x0e76a73a, 0x0e7744a5, 0x0e774925, 0x0e7cb625, 0x0e7cd33a, 0x0e7cfb3a, 0x0e827299,
+    0x0e828499, 0x0e831491, 0x0e83c411, 0x0e83c891, 0x0e88efae, 0x0e89162e, 0x0e8917ae, 0x0e89a56d,
+    0x0e89ddae, 0x0e8a476d, 0x0e8a54ed, 0x0e8a57ae, 0x0e8a596d, 0x0e8a7fae, 0x0e8f7d99, 0x0e8ff405,
+    0x0e8ff7f9, 0x0e8ff96d, 0x0e900b79, 0x0e900d7d, 0x0e90a8ed, 0x0e90bcfd, 0x0e96743a, 0x0e969c3a,
+    0x0e9c4e19, 0x0ea22851, 0x0ea23a49, 0x0ea27999, 0x0ea27a3e, 0x0ea27bbe, 0x0ea28dbe, 0x0ea2b619,
+    0x0ea3a495, 0x0ea3a915, 0x0ea3d1be, 0x0ea3e3be, 0x0ea88a91, 0x0ea88c11, 0x0ea89091, 0x0ea8a2a2,
+    0x0ea8dd59, 0x0ea8e1d9, 0x0ea8efd9, 0x0ea8f159, 0x0ea8f5d9, 0x0ea91862, 0x0ea919e2, 0x0ea91e62,
+    0x0ea9dfca, 0x0eaa0ad5, 0x0eaa0b62, 0x0eaa0ce2, 0x0eaa1162, 0x0eaf0755, 0x0eaf08d5, 0x0eaf0d55,
+    0x0eaf1b55, 0x0eaf1cd5, 0x0eaf2155, 0x0eaf47c9, 0x0eaf5bc9, 0x0eaffca6, 0x0eb00125, 0x0eb002a5,
+    0x0eb01026, 0x0eb010a6, 0x0eb014a5, 0x0eb01525, 0x0eb016a5, 0x0eb038a6, 0x0eb04766, 0x0eb04aa6,
+    0x0eb04b26, 0x0eb04ca6, 0x0eb05125, 0x0eb070c9, 0x0eb084ca, 0x0eb0b0a5, 0x0eb0b239, 0x0eb0b6a5,
+    0x0eb0c0c5, 0x0eb0c425, 0x0eb0c4a5, 0x0eb0c639, 0x0eb0caa5, 0x0eb0ecbd, 0x0eb570d5, 0x0eb57565,
+    0x0eb5afe5, 0x0eb662a6, 0x0eb66426, 0x0eb664a6, 0x0eb668a5, 0x0eb66925, 0x0eb66aa5, 0x0eb67626,
+    0x0eb676a6, 0x0eb67826, 0x0eb67ca5, 0x0eb6a0a6, 0x0eb6a525, 0x0eb6d8ca, 0x0eb71825, 0x0eb718a5,
+    0x0eb71a39, 0x0eb71ea5, 0x0ebdbda2, 0x0ec243d5, 0x0ec257c9, 0x0ec28399, 0x0ec28519, 0x0ec29719,
+    0x0ec29799, 0x0ec29919, 0x0ec2d399, 0x0ec33b6d, 0x0ec34d6d, 0x0ec34f6d, 0x0ec38789, 0x0ec3c695,
+    0x0ec3eafa, 0x0ec3ed09, 0x0ec3fb09, 0x0ec3fefa, 0x0ec40109, 0x0ec899d1, 0x0ec8abc9, 0x0ec8eb19,
+    0x0ec8eb99, 0x0ec8ed19, 0x0ec8ff19, 0x0ec92799, 0x0eca1a95, 0x0eca4e89, 0x0eca4f09, 0x0eca5509,
+    0x0eca8b0a, 0x0ecf1662, 0x0ed009a1, 0x0ed01da1, 0x0ed0b921, 0x0ed0b9a2, 0x0ed0bfa2, 0x0ed5bb99,
+    0x0ed5cf99, 0x0ed6e495, 0x0ede1685, 0x0ede54d9, 0x0edece65, 0x0ee03285, 0x0ee03afd, 0x0ee070cd,
+    0x0ee0ea4d, 0x0ee134a1, 0x0ee1e43d, 0x0ee48059, 0x0ee6299d, 0x0ee69c4d, 0x0ee6e699, 0x0ee76015,
+    0x0ee80fbd, 0x0eeabd09, 0x0eeabe85, 0x0eead095, 0x0eead455, 0x0eead5d5, 0x0eeae485, 0x0eeae501,
+    0x0eeae7d5, 0x0eeae855, 0x0eeae9d5, 0x0eeaee55, 0x0eeaf911, 0x0eeafcd1, 0x0eeafe51, 0x0eeb2249,
+    0x0eeb22dd, 0x0eeb23c5, 0x0eeb4ac9, 0x0eeb4c45, 0x0eeb7665, 0x0eeb77e5, 0x0eeb9be5, 0x0eeb9c65,
+    0x0eeb9d65, 0x0eebd7e5, 0x0eebdba5, 0x0eebdd25, 0x0eec0065, 0x0eec0426, 0x0eec05a5, 0x0eec17a5,
+    0x0eec1826, 0x0eec19a5, 0x0eec1e1d, 0x0eecda85, 0x0eece2fd, 0x0eece47d, 0x0eecf04d, 0x0eed03cd,
+    0x0eed044d, 0x0eed087d, 0x0eed08fd, 0x0eed09fd, 0x0eed18cd, 0x0eed3a99, 0x0eed3fc5, 0x0eed447d,
+    0x0eed483d, 0x0eed49bd, 0x0eed4e19, 0x0eed4e99, 0x0eed6cfd, 0x0eed70a6, 0x0eed723d, 0x0eed843d,
+    0x0eed84a6, 0x0eed863d, 0x0eed8a99, 0x0eed924d, 0x0eedb415, 0x0eedb94d, 0x0eedc795, 0x0eedc815,
+    0x0eeddc91, 0x0eedf78d, 0x0eee0385, 0x0eee2026, 0x0eee338d, 0x0eee3426, 0x0eee998d, 0x0eee9e3d,
+    0x0eef2d55, 0x0eef6a99, 0x0ef0060d, 0x0ef01ea5, 0x0ef05d26, 0x0ef0d6a5, 0x0ef150d9, 0x0ef16d51,
+    0x0ef19149, 0x0ef20c61, 0x0ef24c1d, 0x0ef2bbc5, 0x0ef2ee1d, 0x0ef2fa1d, 0x0ef2fb9d, 0x0ef3001d,
+    0x0ef36ccd, 0x0ef3b719, 0x0ef3b899, 0x0ef430a1, 0x0ef4e03d, 0x0ef4fc91, 0x0ef5c719, 0x0ef5d499,
+    0x0ef5d919, 0x0ef66911, 0x0ef71891, 0x0ef71d11, 0x0ef7fe29, 0x0ef8b08a, 0x0ef8eca9, 0x0ef8ed29,
+    0x0ef925a9, 0x0ef96029, 0x0ef99c1e, 0x0ef99c9e, 0x0ef9e2a9, 0x0efb1269, 0x0efb13e9, 0x0efb1469,
+    0x0efb41a9, 0x0efb7c29, 0x0efb8be9, 0x0efb8d69, 0x0efbb8a9, 0x0efcf9e9, 0x0efd9be9, 0x0efda7e9,
+    0x0efda969, 0x0efdade9, 0x0efdf8d9, 0x0efdfa59, 0x0efe1e59, 0x0efe1ed9, 0x0efe1fd9, 0x0efe5219,
+    0x0efe5a59, 0x0efe5e19, 0x0efe5f99, 0x0efe6419, 0x0efe6619, 0x0efe82d9, 0x0efe8699, 0x0efe8819,
+    0x0efe9a19, 0x0efe9a99, 0x0efe9c19, 0x0efea099, 0x0efeb2c9, 0x0efec645, 0x0efeca15, 0x0efecb95,
+    0x0efeda45, 0x0efedac1, 0x0efedd95, 0x0efede15, 0x0efeeec5, 0x0efef291, 0x0efef411, 0x0eff048a,
+    0x0eff1809, 0x0eff1889, 0x0eff1985, 0x0eff4089, 0x0eff5489, 0x0eff6249, 0x0eff75c5, 0x0eff7995,
+    0x0eff7b15, 0x0eff89c5, 0x0eff8a41, 0x0eff8d15, 0x0eff8d95, 0x0eff8f15, 0x0eff9395, 0x0eff9e45,
+    0x0effa211, 0x0effa391, 0x0effb409, 0x0effc789, 0x0effc81d, 0x0effc905, 0x0efff009, 0x0efff185,
+    0x0f00041e, 0x0f0014cd, 0x0f003695, 0x0f003bcd, 0x0f004a15, 0x0f004a95, 0x0f005f11, 0x0f006091,
+    0x0f007a0d, 0x0f007b8d, 0x0f008489, 0x0f008605, 0x0f00a28d, 0x0f00a40d, 0x0f00b60d, 0x0f00b68d,
+    0x0f00b80d, 0x0f00d891, 0x0f00da11, 0x0f00ea8a, 0x0f00fe09, 0x0f00fe89, 0x0f00ff85, 0x0f01130a,
+    0x0f013a05, 0x0f013de9, 0x0f013f69, 0x0f013fe9, 0x0f016285, 0x0f016669, 0x0f0167e9, 0x0f0179e9,
+    0x0f017a69, 0x0f017be9, 0x0f01883d, 0x0f0189bd, 0x0f019a3d, 0x0f01adbd, 0x0f01ae3d, 0x0f01af3d,
+    0x0f01c2bd, 0x0f01db7d, 0x0f01dfe9, 0x0f01e169, 0x0f01e40d, 0x0f01e9bd, 0x0f01ed7d, 0x0f01eefd,
+    0x0f01f369, 0x0f01f3e9, 0x0f01f569, 0x0f02123d, 0x0f0215fd, 0x0f02177d, 0x0f02297d, 0x0f0229fd,
+    0x0f022b7d, 0x0f022fe9, 0x0f02a119, 0x0f034885, 0x0f034c69, 0x0f034de9, 0x0f035fe9, 0x0f0361e9,
+    0x0f039c69, 0x0f03fd69, 0x0f040fe9, 0x0f041169, 0x0f0415e9, 0x0f053e45, 0x0f057c9d, 0x0f076296,
+    0x0f07f6d5, 0x0f081dc5, 0x0f085c21, 0x0f086ec5, 0x0f088622, 0x0f089821, 0x0f0a7e21, 0x0f0aa6a2,
+    0x0f0af045, 0x0f0b2e99, 0x0f0b3019, 0x0f0b309d, 0x0f0b6a99, 0x0f0ba816, 0x0f0be289, 0x0f0c1e89,
+    0x0f0c2006, 0x0f0d0c45, 0x0f0d1496, 0x0f0d4a8d, 0x0f0d868d, 0x0f0dc416, 0x0f0e09fd, 0x0f0e0e69,
+    0x0f0e3c06, 0x0f0e45fd, 0x0f0e4a69, 0x0f0ebdfd, 0x0f0ebf7d, 0x0f0ef9fd, 0x0f102a69, 0x0f102c69,
+    0x0f1142c9, 0x0f114356, 0x0f114445, 0x0f1156c9, 0x0f115845, 0x0f117ed9, 0x0f118299, 0x0f118419,
+    0x0f119619, 0x0f11969d, 0x0f11981d, 0x0f119c99, 0x0f11be99, 0x0f11c099, 0x0f11c519, 0x0f11e4c9,
+    0x0f11f845, 0x0f11fc16, 0x0f11fd95, 0x0f120c45, 0x0f120f95, 0x0f121016, 0x0f121195, 0x0f121615,
+    0x0f1220d1, 0x0f122491, 0x0f122611, 0x0f12369d, 0x0f124a09, 0x0f124a9d, 0x0f124b85, 0x0f127289,
+    0x0f127406, 0x0f128689, 0x0f128806, 0x0f12ec09, 0x0f12ec9d, 0x0f12ed85, 0x0f136045, 0x0f136896,
+    0x0f136a3d, 0x0f137445, 0x0f137c96, 0x0f137e3d, 0x0f138295, 0x0f139e99, 0x0f13b20d, 0x0f13b28d,
+    0x0f13b40d, 0x0f13b6bd, 0x0f13da8d, 0x0f13dc8d, 0x0f13df3d, 0x0f13e086, 0x0f140a96, 0x0f140c3d,
+    0x0f141816, 0x0f141c96, 0x0f142b8d, 0x0f142c16, 0x0f14303d, 0x0f143096, 0x0f1431bd, 0x0f14668d,
+    0x0f146785, 0x0f146c3d, 0x0f146ffd, 0x0f14717d, 0x0f1475e9, 0x0f147669, 0x0f1477e9, 0x0f149006,
+    0x0f149486, 0x0f1499fd, 0x0f149e69, 0x0f14a069, 0x0f14a406, 0x0f14abfd, 0x0f14adfd, 0x0f14b269,
+    0x0f14c5c5, 0x0f14dd15, 0x0f14ef15, 0x0f150411, 0x0f15088d, 0x0f150e3d, 0x0f1511fd, 0x0f15137d,
+    0x0f151869, 0x0f15257d, 0x0f152be9, 0x0f154011, 0x0f154dfd, 0x0f154ffd, 0x0f155469, 0x0f15db99,
+    0x0f165515, 0x0f167509, 0x0f167a85, 0x0f167e69, 0x0f167fe9, 0x0f168069, 0x0f169269, 0x0f1693e9,
+    0x0f16fd95, 0x0f172611, 0x0f173469, 0x0f17c259, 0x0f196b9d, 0x0f19de4d, 0x0f1a2899, 0x0f1aa239,
+    0x0f1b51bd, 0x0f1f9725, 0x0f205425, 0x0f2183e6, 0x0f21fd65, 0x0f241965, 0x0f246a55, 0x0f246bd1,
+    0x0f247c55, 0x0f248fc9, 0x0f249055, 0x0f249159, 0x0f24cbc5, 0x0f24cf99, 0x0f24d119, 0x0f24f445,
+    0x0f24f826, 0x0f24f999, 0x0f250b99, 0x0f250c26, 0x0f250d99, 0x0f251219, 0x0f254aa5, 0x0f2583a5,
+    0x0f259a26, 0x0f25ac26, 0x0f25c026, 0x0f25fe95, 0x0f263a85, 0x0f26864d, 0x0f26a815, 0x0f26ad4d,
+    0x0f26b73d, 0x0f26bb95, 0x0f26bc15, 0x0f26d091, 0x0f26eb8d, 0x0f26f03d, 0x0f26f785, 0x0f2706a6,
+    0x0f271426, 0x0f2718a6, 0x0f27278d, 0x0f272826, 0x0f272c3d, 0x0f272ca6, 0x0f274a39, 0x0f277139,
+    0x0f27af79, 0x0f27d7e6, 0x0f27eb79, 0x0f27ebe6, 0x0f2820bd, 0x0f284189, 0x0f284cfd, 0x0f285165,
+    0x0f285efd, 0x0f28607d, 0x0f2864e5, 0x0f28657d, 0x0f2888fd, 0x0f289afd, 0x0f289cfd, 0x0f28a165,
+    0x0f2912bd, 0x0f29ae09, 0x0f29b965, 0x0f29bdf9, 0x0f2a0df9, 0x0f2a817d, 0x0f2b4021, 0x0f2c67a1,
+    0x0f2d24a1, 0x0f2ecde1, 0x0f2ecf61, 0x0f303be1, 0x0f30dde1, 0x0f30e9e1, 0x0f30eb61, 0x0f30efe1,
+    0x0f37cd19, 0x0f37e811, 0x0f380619, 0x0f380c09, 0x0f381c99, 0x0f382e99, 0x0f384219, 0x0f384299,
+    0x0f386191, 0x0f38720a, 0x0f388589, 0x0f388609, 0x0f388739, 0x0f389a8a, 0x0f38c185, 0x0f38c579,
+    0x0f38c6dd, 0x0f38c77d, 0x0f38ea05, 0x0f38edf9, 0x0f38ef5d, 0x0f38efdd, 0x0f38fe05, 0x0f390179,
+    0x0f3901f9, 0x0f39035d, 0x0f390f91, 0x0f391111, 0x0f392189, 0x0f393509, 0x0f393595, 0x0f393685,
+    0x0f394a09, 0x0f3962dd, 0x0f3968dd, 0x0f397105, 0x0f3974dd, 0x0f39765d, 0x0f397add, 0x0f397cfd,
+    0x0f399985, 0x0f399d5d, 0x0f399edd, 0x0f399f5d, 0x0f39ad9e, 0x0f39b0de, 0x0f39b15e, 0x0f39b2de,
+    0x0f39b75e, 0x0f39cc91, 0x0f39f385, 0x0f3a31d9, 0x0f3a3359, 0x0f3a5a59, 0x0f3a5bd9, 0x0f3a6dd9,
+    0x0f3a6e59, 0x0f3a6fd9, 0x0f3aab79, 0x0f3aacd5, 0x0f3aad55, 0x0f3ae5ca, 0x0f3b0e4a, 0x0f3b21c9,
+    0x0f3b2249, 0x0f3b48fd, 0x0f3b5285, 0x0f3b5afd, 0x0f3b5c7d, 0x0f3b717d, 0x0f3b7751, 0x0f3b7ece,
+    0x0f3b90cd, 0x0f3b924d, 0x0f3b957d, 0x0f3b9bfd, 0x0f3babfd, 0x0f3bb94d, 0x0f3bbacd, 0x0f3bbb4d,
+    0x0f3bbdfd, 0x0f3bcccd, 0x0f3bcd4d, 0x0f3bcecd, 0x0f3bd17d, 0x0f3bd1fd, 0x0f3c41d9, 0x0f3c4f59,
+    0x0f3c53d9, 0x0f3ce3d1, 0x0f3ceb4e, 0x0f3cf44a, 0x0f3d9351, 0x0f3d97d1, 0x0f3db7fd, 0x0f3de8f9,
+    0x0f3e3245, 0x0f3e7099, 0x0f3eea16, 0x0f405696, 0x0f41fffd, 0x0f436c79, 0x0f449c16, 0x0f44d689,
+    0x0f451289, 0x0f451406, 0x0f45915d, 0x0f45cd5d, 0x0f46455d, 0x0f4646dd, 0x0f46815e, 0x0f46b816,
+    0x0f46f289, 0x0f46fdfd, 0x0f470259, 0x0f473006, 0x0f4739fd, 0x0f473e59, 0x0f477bd6, 0x0f47ad4e,
+    0x0f47e94d, 0x0f482b56, 0x0f48614d, 0x0f4862cd, 0x0f4898f9, 0x0f489d4d, 0x0f49207d, 0x0f4a0579,
+    0x0f4ab4f9, 0x0f4ab979, 0x0f4ada45, 0x0f4af016, 0x0f4af195, 0x0f4b0395, 0x0f4b0416, 0x0f4b0595,
+    0x0f4b0a15, 0x0f4b1891, 0x0f4b2a99, 0x0f4b3e09, 0x0f4b3f85, 0x0f4b6689, 0x0f4b6806, 0x0f4b7a89,
+    0x0f4b7c06, 0x0f4b9216, 0x0f4b9391, 0x0f4ba416, 0x0f4bb789, 0x0f4bb816, 0x0f4bb939, 0x0f4bf385,
+    0x0f4bf779, 0x0f4bf8dd, 0x0f4c1c06, 0x0f4c215d, 0x0f4c3379, 0x0f4c355d, 0x0f4c39f9, 0x0f4c9585,
+    0x0f4c995d, 0x0f4c9add, 0x0f4cacdd, 0x0f4cb37d, 0x0f4cd55d, 0x0f4cd75d, 0x0f4cdbdd, 0x0f4cfe96,
+    0x0f4d0c16, 0x0f4d1f8d, 0x0f4d2016, 0x0f4d25bd, 0x0f4d4699, 0x0f4d5b85, 0x0f4d63fd, 0x0f4d657d,
+    0x0f4d69d9, 0x0f4d6a7d, 0x0f4d6bfd, 0x0f4d8406, 0x0f4d8dfd, 0x0f4d9259, 0x0f4d9459, 0x0f4d9806,
+    0x0f4d9ffd, 0x0f4da1fd, 0x0f4da659, 0x0f4ddefd, 0x0f4de379, 0x0f4e1379, 0x0f4e14cd, 0x0f4e17fd,
+    0x0f4e1e7d, 0x0f4e3d4d, 0x0f4e514d, 0x0f4e53fd, 0x0f4eb54d, 0x0f4eb6cd, 0x0f4eb9fd, 0x0f4ec07d,
+    0x0f4ec8cd, 0x0f4ef14d, 0x0f4ef34d, 0x0f4f00f9, 0x0f4f867d, 0x0f4f87fd, 0x0f5021f9, 0x0f50234d,
+    0x0f5023fd, 0x0f502649, 0x0f503a7d, 0x0f5066f9, 0x0f506d79, 0x0f5078fa, 0x0f50dc7d, 0x0f50def9,
+    0x0f50e079, 0x0f50e4f9, 0x0f50f279, 0x0f50f8fe, 0x0f511af9, 0x0f511cf9, 0x0f512179, 0x0f609a3d,
+    0x0f62be99, 0x0f633826, 0x0f64ea19, 0x0f67c361, 0x0f68797a, 0x0f69521a, 0x0f69d1e1, 0x0f69e3e1,
+    0x0f69e5e1, 0x0f6a85e1, 0x0f6aba22, 0x0f6b2a11, 0x0f6b4819, 0x0f6b4e09, 0x0f6b843e, 0x0f6b8499,
+    0x0f6bc905, 0x0f6c075d, 0x0f6c08dd, 0x0f6c095d, 0x0f6c437e, 0x0f6c43dd, 0x0f6c7896, 0x0f6caafa,
+    0x0f6cb6dd, 0x0f6cb87a, 0x0f6cb8fa, 0x0f6cbcdd, 0x0f6cbefa, 0x0f6cf2de, 0x0f6cf35e, 0x0f6d640d,
+    0x0f6d73d9, 0x0f6d7559, 0x0f6ded55, 0x0f6e27ca, 0x0f6e63fe, 0x0f6e6449, 0x0f6e9485, 0x0f6e9cfd,
+    0x0f6eb97a, 0x0f6ed2cd, 0x0f6ed47a, 0x0f6ed4fa, 0x0f6ed77d, 0x0f6f0efe, 0x0f6f0f4d, 0x0f6f137e,
+    0x0f6f13fd, 0x0f6f14fe, 0x0f6f187e, 0x0f6f1cf9, 0x0f6f83d9, 0x0f6f9159, 0x0f6f95d9, 0x0f6f97d9,
+    0x0f7025d1, 0x0f704ef9, 0x0f708979, 0x0f708af9, 0x0f70d57a, 0x0f70d9d1, 0x0f70eef9, 0x0f7102f9,
+    0x0f71b019, 0x0f726edd, 0x0f726f5d, 0x0f7270dd, 0x0f72977e, 0x0f72ab5d, 0x0f730add, 0x0f730c7a,
+    0x0f731e5d, 0x0f731edd, 0x0f73207a, 0x0f7324dd, 0x0f7346fe, 0x0f748fc9, 0x0f7526cd, 0x0f75287a,
+    0x0f753a4d, 0x0f753acd, 0x0f753c7a, 0x0f753f7d, 0x0f754879, 0x0f7562fe, 0x0f7570f9, 0x0f758479,
+    0x0f761e1a, 0x0f76a2f9, 0x0f76dd79, 0x0f76def9, 0x0f76f0f9, 0x0f775079, 0x0f7756f9, 0x0f7763f9,
+    0x0f776479, 0x0f778cf9, 0x0f7792f9, 0x0f7b49c5, 0x0f7b6122, 0x0f7b7315, 0x0f7b8811, 0x0f7bc411,
+    0x0f7d81a2, 0x0f7daa11, 0x0f7f395d, 0x0f7f3add, 0x0f7f3b5d, 0x0f7f757e, 0x0f80a7fd, 0x0f81554d,
+    0x0f8156cd, 0x0f81574d, 0x0f816479, 0x0f8164f9, 0x0f81917e, 0x0f81a0f9, 0x0f8204f9, 0x0f821879,
+    0x0f8218f9, 0x0f821a79, 0x0f8254f9, 0x0f836cf9, 0x0f837179, 0x0f8372f9, 0x0f838079, 0x0f8380f9,
+    0x0f8384f9, 0x0f838579, 0x0f8386f9, 0x0f83bcf9, 0x0f83c179, 0x0f8420f9, 0x0f8426f9, 0x0f843479,
+    0x0f8434f9, 0x0f843af9, 0x0f848bd1, 0x0f8497d5, 0x0f849ac5, 0x0f849dc9, 0x0f84d499, 0x0f84d89e,
+    0x0f84d91e, 0x0f84d9c5, 0x0f84dd19, 0x0f84dd99, 0x0f84df19, 0x0f84e809, 0x0f84ea99, 0x0f84f119,
+    0x0f850fc5, 0x0f85133d, 0x0f851519, 0x0f851999, 0x0f85a0dd, 0x0f85a15d, 0x0f85a2dd, 0x0f85a75d,
+    0x0f85c97e, 0x0f85cb5d, 0x0f85cfdd, 0x0f8602c5, 0x0f860615, 0x0f860695, 0x0f860839, 0x0f860c95,
+    0x0f864089, 0x0f864109, 0x0f8642dd, 0x0f86435d, 0x0f864709, 0x0f867d0a, 0x0f86c395, 0x0f86d0be,
+    0x0f870dfd, 0x0f870f7d, 0x0f8713d9, 0x0f8735fe, 0x0f873b85, 0x0f87bccd, 0x0f87bd4d, 0x0f87becd,
+    0x0f87c1fd, 0x0f87c47e, 0x0f87c5fe, 0x0f87caf9, 0x0f87cc79, 0x0f87e57e, 0x0f87e74d, 0x0f87e9fe,
+    0x0f87f4f9, 0x0f8806f9, 0x0f881b11, 0x0f88273e, 0x0f882a3e, 0x0f882e85, 0x0f885ecd, 0x0f885f4d,
+    0x0f8863fd, 0x0f8867fe, 0x0f88687e, 0x0f886c79, 0x0f886cf9, 0x0f886e79, 0x0f8879fe, 0x0f887a7e,
+    0x0f887bfe, 0x0f888079, 0x0f889f3e, 0x0f88a27e, 0x0f88a47e, 0x0f88a8f9, 0x0f88dbc5, 0x0f88df15,
+    0x0f88df95, 0x0f88e115, 0x0f88e595, 0x0f89150d, 0x0f89158d, 0x0f89170d, 0x0f891989, 0x0f891a09,
+    0x0f892009, 0x0f89518e, 0x0f89560a, 0x0f89cb4d, 0x0f89cbcd, 0x0f89d049, 0x0f89d2f9, 0x0f89d479,
+    0x0f89d4f9, 0x0f89d8f9, 0x0f89d979, 0x0f89daf9, 0x0f89e679, 0x0f89e6f9, 0x0f89e879, 0x0f89ecf9,
+    0x0f8a10f9, 0x0f8a1579, 0x0f8a448e, 0x0f8a490a, 0x0f8a8879, 0x0f8a88f9, 0x0f8a8a79, 0x0f8a8ef9,
+    0x0f8af1c9, 0x0f8b0415, 0x0f8b0562, 0x0f8b0895, 0x0f8b0922, 0x0f8b0aa2, 0x0f8b1695, 0x0f8b1815,
+    0x0f8b1c95, 0x0f8b67a5, 0x0f8b6911, 0x0f8b6d91, 0x0f8b7fa2, 0x0f8bfdde, 0x0f8c106a, 0x0f8c33e6,
+    0x0f8c4666, 0x0f8c47e6, 0x0f8c4c5d, 0x0f8c5a91, 0x0f8c5c11, 0x0f8c6091, 0x0f8c72a2, 0x0f8cad5d,
+    0x0f8cb1dd, 0x0f8cbfdd, 0x0f8cc15d, 0x0f8cc5dd, 0x0f8ce7dd, 0x0f8ce862, 0x0f8ce9e2, 0x0f8cee62,
+    0x0f8da4d9, 0x0f8f3391, 0x0f8f3511, 0x0f8f39bd, 0x0f8f408d, 0x0f8f4122, 0x0f8f42a2, 0x0f8f8659,
+    0x0f8f8afd, 0x0f8f98da, 0x0f8f9a59, 0x0f8f9efd, 0x0f8fa58e, 0x0f8fc0d9, 0x0f8fc162, 0x0f8fc2e2,
+    0x0f8fc762, 0x0f9088ca, 0x0f90988e, 0x0f90b3d5, 0x0f90b462, 0x0f90b5e2, 0x0f90ba62, 0x0f915d12,
+    0x0f915e92, 0x0f916e89, 0x0f917c89, 0x0f917f85, 0x0f918289, 0x0f91a9da, 0x0f91ae59, 0x0f91afd9,
+    0x0f91bd59, 0x0f91bdd9, 0x0f91c1d9, 0x0f91c259, 0x0f91c3d9, 0x0f91e465, 0x0f91e5d9, 0x0f91ea5d,
+    0x0f91f485, 0x0f91f7d9, 0x0f91f865, 0x0f91f9d9, 0x0f91fe59, 0x0f92b249, 0x0f92d755, 0x0f92d8d5,
+    0x0f92dd55, 0x0f92e785, 0x0f92ead5, 0x0f92eb55, 0x0f92ecd5, 0x0f92f155, 0x0f9317c9, 0x0f9325c9,
+    0x0f932bc9, 0x0f934dc9, 0x0f9361ca, 0x0f93a855, 0x0f940ac9, 0x0f942045, 0x0f949d25, 0x0f949da5,
+    0x0f94c425, 0x0f94c5a5, 0x0f94d7a5, 0x0f94d825, 0x0f94d9a5, 0x0f950bc9, 0x0f950ec5, 0x0f951345,
+    0x0f953925, 0x0f953da5, 0x0f953f25, 0x0f954b25, 0x0f954ca5, 0x0f954d25, 0x0f955125, 0x0f9551a5,
+    0x0f955325, 0x0f9573a5, 0x0f9579a5, 0x0f9583c5, 0x0f958725, 0x0f9587a5, 0x0f958925, 0x0f958da5,
+    0x0f959512, 0x0f959692, 0x0f95b055, 0x0f95b1d5, 0x0f95b67d, 0x0f95c3d5, 0x0f95c455, 0x0f95c5d5,
+    0x0f95ca7d, 0x0f95e64d, 0x0f95e7cd, 0x0f95f9cd, 0x0f95fa4d, 0x0f95fbcd, 0x0f95fec9, 0x0f96224d,
+    0x0f9626c9, 0x0f963aca, 0x0f96a5a6, 0x0f96aa3d, 0x0f96abbd, 0x0f96b926, 0x0f96b9a6, 0x0f96bdbd,
+    0x0f96be3d, 0x0f96bfbd, 0x0f96e026, 0x0f96e1a6, 0x0f96f066, 0x0f96f3a6, 0x0f96f426, 0x0f96f5a6,
+    0x0f96fa3d, 0x0f97154d, 0x0f972dca, 0x0f9759a5, 0x0f975b25, 0x0f975fbd, 0x0f9769c5, 0x0f976d25,
+    0x0f976da5, 0x0f976f25, 0x0f9773bd, 0x0f9795a5, 0x0f97be95, 0x0f97c011, 0x0f97c491, 0x0f97d009,
+    0x0f97d095, 0x0f97d385, 0x0f97d689, 0x0f980fda, 0x0f98115a, 0x0f9811da, 0x0f9815d9, 0x0f981659,
+    0x0f9817d9, 0x0f982359, 0x0f9823da, 0x0f982559, 0x0f9829d9, 0x0f984885, 0x0f984bd9, 0x0f984dd9,
+    0x0f985259, 0x0f993b85, 0x0f993ed5, 0x0f993f55, 0x0f9940e5, 0x0f994555, 0x0f9967d1, 0x0f997949,
+    0x0f9979c9, 0x0f997fc9, 0x0f99b5ca, 0x0f99fc55, 0x0f99fdd5, 0x0f9a0955, 0x0f9a09d5, 0x0f9a7445,
+    0x0f9afd26, 0x0f9afea6, 0x0f9b0525, 0x0f9b2726, 0x0f9b2ba5, 0x0f9b2da5, 0x0f9b3926, 0x0f9b3b26,
+    0x0f9b3fa5, 0x0f9b5fd5, 0x0f9b62e5, 0x0f9b6745, 0x0f9b9f25, 0x0f9ba0a5, 0x0f9ba125, 0x0f9ba525,
+    0x0f9ba5a5, 0x0f9ba725, 0x0f9bb2a5, 0x0f9bb325, 0x0f9bb4a5, 0x0f9bb925, 0x0f9bd7c5, 0x0f9bdb25,
+    0x0f9bdd25, 0x0f9be1a5, 0x0f9c17d5, 0x0f9c1855, 0x0f9c19d5, 0x0f9c1e7d, 0x0f9c40da, 0x0f9c4dcd,
+    0x0f9c4e4d, 0x0f9c4fcd, 0x0f9c5249, 0x0f9c52c9, 0x0f9c8a4e, 0x0f9c8eca, 0x0f9d0ba6, 0x0f9d0d26,
+    0x0f9d0da6, 0x0f9d11bd, 0x0f9d123d, 0x0f9d13bd, 0x0f9d1f26, 0x0f9d1fa6, 0x0f9d2126, 0x0f9d25bd,
+    0x0f9d47a6, 0x0f9d49a6, 0x0f9d4e3d, 0x0f9d7d4e, 0x0f9d81ca, 0x0f9dc125, 0x0f9dc1a5, 0x0f9dc325,
+    0x0f9dc7bd, 0x0f9eb6da, 0x0f9ec8da, 0x0fa00cd1, 0x0fa01ee2, 0x0fa16d01, 0x0fa24622, 0x0fa2bf19,
+    0x0fa2e5da, 0x0fa2f7da, 0x0fa41511, 0x0fa466a2, 0x0fa4aa55, 0x0fa4abd5, 0x0fa4bdd5, 0x0fa4be55,
+    0x0fa4bfd5, 0x0fa4e4c9, 0x0fa4f849, 0x0fa4f8c9, 0x0fa520dd, 0x0fa52e5a, 0x0fa52eda, 0x0fa534d9,
+    0x0fa5b31d, 0x0fa5b39d, 0x0fa5da1d, 0x0fa5db9d, 0x0fa5ed9d, 0x0fa5ee1d, 0x0fa5ef9d, 0x0fa64f1d,
+    0x0fa6539d, 0x0fa6551d, 0x0fa6631d, 0x0fa6671d, 0x0fa6679d, 0x0fa6691d, 0x0fa6899d, 0x0fa68f9d,
+    0x0fa69d9d, 0x0fa74699, 0x0fa74819, 0x0fa75a99, 0x0fa7d5e9, 0x0fa80e09, 0x0fa8b009, 0x0fa8b90d,
+    0x0fa8b98d, 0x0fa8bb0d, 0x0fa8bd89, 0x0fa8be09, 0x0fa8c409, 0x0fa8e24d, 0x0fa8e3cd, 0x0fa8f5cd,
+    0x0fa8f64d, 0x0fa8f7cd, 0x0fa91cc9, 0x0fa9281a, 0x0fa92cbd, 0x0fa92e3d, 0x0fa930c9, 0x0fa93b9a,
+    0x0fa93c1a, 0x0fa9403d, 0x0fa940bd, 0x0fa9423d, 0x0fa9629a, 0x0fa9641a, 0x0fa9761a, 0x0fa9769a,
+    0x0fa9781a, 0x0fa9eb0e, 0x0faa120e, 0x0faa138e, 0x0faa258e, 0x0faa260e, 0x0faa278e, 0x0faa30bd,
+    0x0faa5595, 0x0faa5715, 0x0faa6915, 0x0faa6995, 0x0faa6b15, 0x0faa8b8d, 0x0faa8d0d, 0x0faa93e9,
+    0x0faa9f0d, 0x0faa9f8d, 0x0faaa10d, 0x0faaa5e9, 0x0faac78d, 0x0fab11d5, 0x0fab1255, 0x0fab13d5,
+    0x0fab4c49, 0x0fab4cc9, 0x0fab70da, 0x0fab825a, 0x0fab82da, 0x0fab88c9, 0x0fac071e, 0x0fac079e,
+    0x0fac419d, 0x0fac421d, 0x0fac439d, 0x0fac559d, 0x0fac6551, 0x0facb51d, 0x0facb69d, 0x0facb71d,
+    0x0facbb1d, 0x0facbb9d, 0x0facbd1d, 0x0facc89d, 0x0facc91d, 0x0facca9d, 0x0faccf1d, 0x0facf11d,
+    0x0facf19d, 0x0facf31d, 0x0facf79d, 0x0fadaa1a, 0x0fadae19, 0x0fadae99, 0x0fadb019, 0x0fadbc1a,
+    0x0fae3de9, 0x0fae9d15, 0x0faea315, 0x0faf1209, 0x0faf1505, 0x0faf49cd, 0x0faf4a4d, 0x0faf4bcd,
+    0x0faf8e1a, 0x0faf8f9a, 0x0faf943d, 0x0faf94bd, 0x0faf963d, 0x0fafa19a, 0x0fafa39a, 0x0fafca1a,
+    0x0fafca9a, 0x0fafcc1a, 0x0fafd0bd, 0x0fb03f0e, 0x0fb03f8e, 0x0fb0798e, 0x0fb07a0e, 0x0fb07b8e,
+    0x0fb0bd15, 0x0fb0bd95, 0x0fb0bf15, 0x0fb0f30d, 0x0fb0f38d, 0x0fb0f50d, 0x0fb15f95, 0x0fb16111,
+    0x0fb16591, 0x0fb177a2, 0x0fb1b259, 0x0fb1b6d9, 0x0fb1c4d9, 0x0fb1c659, 0x0fb1cad9, 0x0fb1eee2,
+    0x0fb1f362, 0x0fb2dfd5, 0x0fb2e062, 0x0fb2e1e2, 0x0fb2e662, 0x0fb308d1, 0x0fb4a621, 0x0fb4cca1,
+    0x0fb4dc21, 0x0fb4e0a1, 0x0fb4f4d1, 0x0fb541a1, 0x0fb54621, 0x0fb546a2, 0x0fb54822, 0x0fb55421,
+    0x0fb555a1, 0x0fb55a21, 0x0fb57c21, 0x0fb582a2, 0x0fb59d8e, 0x0fb5b8d5, 0x0fb5b962, 0x0fb5bae2,
+    0x0fb5bf62, 0x0fb5e1d1, 0x0fb6ae21, 0x0fb6b2bd, 0x0fb6c0aa, 0x0fb6c221, 0x0fb6c6bd, 0x0fb6e8a1,
+    0x0fb6eaa2, 0x0fb76221, 0x0fb762a2, 0x0fb768a2, 0x0fb7dc55, 0x0fb7ddd5, 0x0fb7e255, 0x0fb7ec85,
+    0x0fb7efd5, 0x0fb7f055, 0x0fb7f1d5, 0x0fb7f655, 0x0fb81cc9, 0x0fb82ac9, 0x0fb830c9, 0x0fb852c9,
+    0x0fb866ca, 0x0fb8d19e, 0x0fb8d61e, 0x0fb8d79e, 0x0fb8e51d, 0x0fb8e59d, 0x0fb8e99d, 0x0fb8ea2a,
+    0x0fb8eb9d, 0x0fb90d9d, 0x0fb9121d, 0x0fb91f9d, 0x0fb9219d, 0x0fb9261d, 0x0fb945c9, 0x0fb959ca,
+    0x0fb9859d, 0x0fb9871d, 0x0fb98b9d, 0x0fb9991d, 0x0fb9999d, 0x0fb99b1d, 0x0fb99f9d, 0x0fb9c19d,
+    0x0fba1845, 0x0fba5699, 0x0fba5819, 0x0fba7e99, 0x0fba9299, 0x0fbb7bc5, 0x0fbb7f15, 0x0fbb7f95,
+    0x0fbb8115, 0x0fbb8595, 0x0fbbba09, 0x0fbbf18e, 0x0fbbf60a, 0x0fbc1a4d, 0x0fbc2e4e, 0x0fbc32ca,
+    0x0fbc5e99, 0x0fbc6019, 0x0fbc64bd, 0x0fbc7219, 0x0fbc7299, 0x0fbc7419, 0x0fbc78bd, 0x0fbc9a99,
+    0x0fbd0e0d, 0x0fbd0f8d, 0x0fbd218d, 0x0fbd222a, 0x0fbd238d, 0x0fbd4a0d, 0x0fbd5e0e, 0x0fbd628a,
+    0x0fbd8d95, 0x0fbdc38d, 0x0fbdc809, 0x0fbdd78e, 0x0fbddc0a, 0x0fbe40a9, 0x0fbe43e9, 0x0fbe45e9,
+    0x0fbe4a69, 0x0fbe6ce9, 0x0fbe7e69, 0x0fbe7ee9, 0x0fbe84e9, 0x0fbebaca, 0x0fbf379e, 0x0fbf391e,
+    0x0fbf399e, 0x0fbf3d9e, 0x0fbf3e1e, 0x0fbf3f9e, 0x0fbf4b29, 0x0fbf4baa, 0x0fbf4d29, 0x0fbf51aa,
+    0x0fbf73a9, 0x0fbf75a9, 0x0fbf7a29, 0x0fbfadca, 0x0fbfed29, 0x0fbfeda9, 0x0fbff3a9, 0x0fc06c69,
+    0x0fc0a61a, 0x0fc0aa9a, 0x0fc0ac1a, 0x0fc0b7a9, 0x0fc0b829, 0x0fc0e6a9, 0x0fc1cfe9, 0x0fc1d329,
+    0x0fc1d9a9, 0x0fc20e29, 0x0fc24a0a, 0x0fc286ca, 0x0fc2c629, 0x0fc2c6a9, 0x0fc2c829, 0x0fc368aa,
+    0x0fc375a9, 0x0fc3762a, 0x0fc377a9, 0x0fca003a, 0x0fca283a, 0x0fccfc9d, 0x0fcfda3d, 0x0fd28b3a,
+    0x0fd2b33a, 0x0fd42d1a, 0x0fda3911, 0x0fdb17e1, 0x0fdbb9e1, 0x0fdbc761, 0x0fdc5519, 0x0fdd267e,
+    0x0fddd5e1, 0x0fddda7e, 0x0fdde7e1, 0x0fde7e91, 0x0fde9c99, 0x0fdea7be, 0x0fded899, 0x0fded919,
+    0x0fdf5bf9, 0x0fdf5d5d, 0x0fdf97f9, 0x0fdf9879, 0x0fdfcd05, 0x0fdfff5d, 0x0fe00b5d, 0x0fe00cdd,
+    0x0fe00fbe, 0x0fe0115d, 0x0fe0475e, 0x0fe047de, 0x0fe0b889, 0x0fe0c3d9, 0x0fe0c9d9, 0x0fe1734e,
+    0x0fe17c4a, 0x0fe1b849, 0x0fe1b8c9, 0x0fe1bcf9, 0x0fe1e905, 0x0fe1f155, 0x0fe20dd1, 0x0fe2274d,
+    0x0fe228cd, 0x0fe22bc9, 0x0fe258f9, 0x0fe25d79, 0x0fe25ef9, 0x0fe2634d, 0x0fe263cd, 0x0fe267c9,
+    0x0fe26849, 0x0fe26c79, 0x0fe26cf9, 0x0fe270f9, 0x0fe27179, 0x0fe272f9, 0x0fe2d87e, 0x0fe2dfbe,
+    0x0fe2e5d9, 0x0fe2e8be, 0x0fe2ea7e, 0x0fe310bd, 0x0fe37a7e, 0x0fe3a2fd, 0x0fe3a37e, 0x0fe3c9fa,
+    0x0fe3cb7d, 0x0fe3dd7a, 0x0fe3ddfa, 0x0fe3df7d, 0x0fe429d1, 0x0fe42e7e, 0x0fe43ef9, 0x0fe4437d,
+    0x0fe444fd, 0x0fe447be, 0x0fe45279, 0x0fe452fe, 0x0fe456fd, 0x0fe4577e, 0x0fe458fe, 0x0fe47979,
+    0x0fe47af9, 0x0fe47f7d, 0x0fe88a79, 0x0fe88afe, 0x0fe89cfe, 0x0fe8bef9, 0x0fe8c0f9, 0x0fe8c4f9,
+    0x0fe8c579, 0x0fe8c6f9, 0x0fe8d279, 0x0fe8d2f9, 0x0fe8d8f9, 0x0fe9f6fd, 0x0fe9f77e, 0x0fea317a,
+    0x0fea31fa, 0x0fea337d, 0x0fea457a, 0x0feaa4f9, 0x0feaa679, 0x0feaa6fe, 0x0feaaafd, 0x0feaab7e,
+    0x0feaacfe, 0x0feab879, 0x0feab8fe, 0x0feaba7e, 0x0feabefe, 0x0feae0f9, 0x0feae179, 0x0feae2f9,
+    0x0feae77d, 0x0fec2c3a, 0x0fec543a, 0x0ff4b8f9, 0x0ff4b97e, 0x0ff4e179, 0x0ff4f37a, 0x0ff4f579,
+    0x0ff554f9, 0x0ff55979, 0x0ff55af9, 0x0ff566f9, 0x0ff56879, 0x0ff568fe, 0x0ff56cf9, 0x0ff56d7e,
+    0x0ff56efe, 0x0ff590f9, 0x0ff59579, 0x0ff5a2f9, 0x0ff5a4f9, 0x0ff5a979, 0x0ff6c179, 0x0ff6c5fa,
+    0x0ff6c77d, 0x0ff6d4f9, 0x0ff6d57e, 0x0ff6d97a, 0x0ff6d9fa, 0x0ff6db7e, 0x0ff6fd79, 0x0ff701fa,
+    0x0ff70f7a, 0x0ff71179, 0x0ff715fa, 0x0ff77579, 0x0ff776f9, 0x0ff77b7d, 0x0ff788f9, 0x0ff7897e,
+    0x0ff78afe, 0x0ff78f7e, 0x0ff7b179, 0x0ff7da55, 0x0ff7dbd1, 0x0ff7e051, 0x0ff7ec55, 0x0ff7ef45,
+    0x0ff7f249, 0x0ff82d19, 0x0ff82dbe, 0x0ff82e7e, 0x0ff8319a, 0x0ff8323e, 0x0ff833be, 0x0ff83f19,
+    0x0ff83fbe, 0x0ff8413e, 0x0ff845be, 0x0ff86445, 0x0ff86799, 0x0ff86999, 0x0ff86e19, 0x0ff8abba,
+    0x0ff95745, 0x0ff95a95, 0x0ff95b15, 0x0ff95c95, 0x0ff96115, 0x0ff983be, 0x0ff99509, 0x0ff995be,
+    0x0ff99bbe, 0x0ff9d18a, 0x0ffa1816, 0x0ffa2515, 0x0ffa9005, 0x0ffb18fa, 0x0ffb1a79, 0x0ffb20fe,
+    0x0ffb42f9, 0x0ffb4979, 0x0ffb54fa, 0x0ffb56f9, 0x0ffb5b7a, 0x0ffb6f91, 0x0ffb7b95, 0x0ffb7e85,
+    0x0ffb8305, 0x0ffbbaf9, 0x0ffbbc79, 0x0ffbbcfe, 0x0ffbc0f9, 0x0ffbc17e, 0x0ffbc2fe, 0x0ffbce79,
+    0x0ffbcefe, 0x0ffbd4fe, 0x0ffbf385, 0x0ffbf6f9, 0x0ffbf8f9, 0x0ffbfd79, 0x0ffc3045, 0x0ffc3395,
+    0x0ffc3415, 0x0ffc3595, 0x0ffc3a3d, 0x0ffc5cbe, 0x0ffc698d, 0x0ffc6a3e, 0x0ffc6bbe, 0x0ffc6e09,
+    0x0ffc6ebe, 0x0ffc74be, 0x0ffca60e, 0x0ffcaa8a, 0x0ffd277a, 0x0ffd28f9, 0x0ffd297e, 0x0ffd2d7a,
+    0x0ffd2dfa, 0x0ffd2f7e, 0x0ffd3afa, 0x0ffd3b7a, 0x0ffd3cfe, 0x0ffd417a, 0x0ffd637a, 0x0ffd6579,
+    0x0ffd69fa, 0x0ffd990e, 0x0ffd9d8a, 0x0ffddcf9, 0x0ffddd7e, 0x0ffddefe, 0x0ffde37e, 0x0ffe4291,
+    0x0ffe4411, 0x0ffe4891, 0x0ffe5aa2, 0x0ffe955a, 0x0ffe99d9, 0x0ffea7d9, 0x0ffea959, 0x0ffeadd9,
+    0x0ffed062, 0x0ffed1e2, 0x0ffed662, 0x0fffc2d5, 0x0fffc362, 0x0fffc4e2, 0x0fffc962, 0x100187a1,
+    0x10018921, 0x1001aba2, 0x1001afbd, 0x1001c3a1, 0x100224b9, 0x10022921, 0x10023721, 0x100238b9,
+    0x10023d21, 0x10025f3d, 0x1002808e, 0x10029bd5, 0x10029c62, 0x10029de2, 0x1002a262, 0x10039126,
+    0x100395bd, 0x1003a3a6, 0x1003a526, 0x1003a9bd, 0x1003cba6, 0x1003cc22, 0x1003cda2, 0x10044521,
+    0x1004bf55, 0x1004c0d5, 0x1004c555, 0x1004cf85, 0x1004d2d5, 0x1004d355, 0x1004d4d5, 0x1004d955,
+    0x1004ffc9, 0x10050dc9, 0x100513c9, 0x100549ca, 0x1005b49e, 0x1005b91e, 0x1005ba9e, 0x1005c826,
+    0x1005c8a6, 0x1005cc9d, 0x1005cd1d, 0x1005ce9d, 0x1005f0a6, 0x100602a6, 0x10060326, 0x100604a6,
+    0x1006091d, 0x100628c9, 0x10063cca, 0x1006689d, 0x10066a39, 0x10066e9d, 0x10067c1d, 0x10067c9d,
+    0x10067e39, 0x1006829d, 0x1006a4bd, 0x1006fb45, 0x10073999, 0x10073b19, 0x100761bd, 0x10077119,
+    0x10077599, 0x10085ec5, 0x10086215, 0x10086295, 0x10086439, 0x10086895, 0x10089d09, 0x1008d48e,
+    0x1008d90a, 0x1008fd4d, 0x100901c9, 0x1009114e, 0x100915ca, 0x10094199, 0x10094319, 0x100947bd,
+    0x10095519, 0x10095599, 0x10095719, 0x10095bbd, 0x10097dbd, 0x100a458a, 0x100a7095, 0x100aa68d,
+    0x100aba8e, 0x100abf0a, 0x100b23a5, 0x100b26e5, 0x100b2765, 0x100b28e5, 0x100b2d65, 0x100b4fe5,
+    0x100b6165, 0x100b61e5, 0x100b67e5, 0x100b9dca, 0x100c1a9e, 0x100c1c1e, 0x100c1c9e, 0x100c209e,
+    0x100c211e, 0x100c229e, 0x100c2e26, 0x100c2ea6, 0x100c3026, 0x100c34a5, 0x100c56a6, 0x100c58a6,
+    0x100c5d25, 0x100c90ca, 0x100cd025, 0x100cd0a5, 0x100cd6a5, 0x100d4f65, 0x100d8d9a, 0x100d8f1a,
+    0x100d9aa5, 0x100d9b25, 0x100d9ca5, 0x100da125, 0x100dc525, 0x100dc9a5, 0x100e7aa6, 0x100eb2e5,
+    0x100eb625, 0x100ebca5, 0x100ef125, 0x100f2d0a, 0x100f69ca, 0x100fa925, 0x100fa9a5, 0x100fab25,
+    0x10104ba6, 0x1011f4da, 0x101206da, 0x101375a2, 0x10142e1a, 0x1014c1e1, 0x10159622, 0x1016139a,
+    0x1016279a, 0x10164e9a, 0x10177de1, 0x1017fbd5, 0x10180fc9, 0x1018371a, 0x10183b99, 0x10183d19,
+    0x10184a9a, 0x10184b1a, 0x10184f19, 0x10184f99, 0x10185119, 0x1018719a, 0x1018859a, 0x1018871a,
+    0x10188b99, 0x1018ef9e, 0x10193f89, 0x10196a95, 0x10197e95, 0x1019a509, 0x1019b309, 0x1019b909,
+    0x1019ef0a, 0x101a983d, 0x101b2a79, 0x101b2af9, 0x101b517d, 0x101b52fd, 0x101b64fd, 0x101b6579,
+    0x101b66f9, 0x101bc679, 0x101bcaf9, 0x101bcc79, 0x101bd879, 0x101bd9f9, 0x101bda79, 0x101bde79,
+    0x101bdef9, 0x101be079, 0x101c00fd, 0x101c06fd, 0x101c147d, 0x101c14f9, 0x101c1679, 0x101c1af9,
+    0x101c3d9a, 0x101c3f1a, 0x101c511a, 0x101c519a, 0x101c531a, 0x101c57bd, 0x101c738d, 0x101c750d,
+    0x101c7e3d, 0x101c870d, 0x101c878d, 0x101c890d, 0x101c8c1a, 0x101cc80a, 0x101d278e, 0x101d377d,
+    0x101d38fd, 0x101d4afd, 0x101d4b7d, 0x101d4cfd, 0x101d877d, 0x101da28d, 0x101de6f9, 0x101de879,
+    0x101decfd, 0x101dfa79, 0x101dfaf9, 0x101dfc79, 0x101e00fd, 0x101e22fd, 0x101e4bda, 0x101e4d5a,
+    0x101e51d1, 0x101e5dda, 0x101e60da, 0x101e63c9, 0x101e9e9a, 0x101e9f1a, 0x101ea319, 0x101ea399,
+    0x101ea519, 0x101eb09a, 0x101eb11a, 0x101eb29a, 0x101eb719, 0x101ed5da, 0x101ed91a, 0x101ed99a,
+    0x101edb1a, 0x101edf99, 0x101f571e, 0x101f579e, 0x101fc8c5, 0x101fcc15, 0x101fcc95, 0x101fce39,
+    0x101fd295, 0x101ff511, 0x10200689, 0x10200709, 0x10200d09, 0x1020430a, 0x10208995, 0x1020969a,
+    0x1020fa1a, 0x10210185, 0x102190f9, 0x10219279, 0x1021b8fd, 0x1021b979, 0x1021baf9, 0x1021ccf9,
+    0x1021ed09, 0x1021f039, 0x1021f485, 0x10222c79, 0x10222df9, 0x10222e79, 0x10223279, 0x102232f9,
+    0x10223479, 0x10223ff9, 0x10224079, 0x102241f9, 0x10224679, 0x10226505, 0x1022687d, 0x102268f9,
+    0x10226a79, 0x10226ef9, 0x1022a1da, 0x1022a51a, 0x1022a59a, 0x1022a71a, 0x1022abbd, 0x1022ce1a,
+    0x1022db0d, 0x1022db8d, 0x1022dd0d, 0x1022df9a, 0x1022e01a, 0x1022e63d, 0x10231c0a, 0x10239efd,
+    0x10239f7d, 0x1023a0fd, 0x1023b2fd, 0x1023db7d, 0x10240a8e, 0x10240f0a, 0x10244e79, 0x10244ef9,
+    0x10245079, 0x102454fd, 0x1024c862, 0x1024c9e2, 0x1024ce62, 0x1024f0e1, 0x1025bd1e, 0x1025c19e,
+    0x1025cfa1, 0x1025d121, 0x1025d5a1, 0x10267121, 0x102671a2, 0x10281ba2, 0x10285da2, 0x10294a21,
+    0x10294aa2, 0x102b1c52, 0x102b1dd2, 0x102b2252, 0x102b2dc9, 0x102b41ca, 0x102b6d99, 0x102b6f19,
+    0x102b7399, 0x102b8119, 0x102b8199, 0x102b8319, 0x102b8799, 0x102ba9bd, 0x102c9c95, 0x102cc592,
+    0x102cd709, 0x102d5515, 0x102d6715, 0x102d6915, 0x102d6d95, 0x102e5af9, 0x102e5c79, 0x102e5cf9,
+    0x102e60f9, 0x102e6179, 0x102e62f9, 0x102e84fd, 0x102e897d, 0x102e96fd, 0x102e98f9, 0x102e9d79,
+    0x102eb192, 0x102ed10a, 0x102efcf9, 0x102efe79, 0x102f02f9, 0x102f1079, 0x102f10f9, 0x102f1279,
+    0x102f16f9, 0x102f38fd, 0x102f7595, 0x102f9e92, 0x102fab8d, 0x102fb009, 0x10306979, 0x10306af9,
+    0x10306f7d, 0x10307cf9, 0x10307d79, 0x10307ef9, 0x1030837d, 0x1030a57d, 0x10311ef9, 0x103c4cad,
+    0x103d406a, 0x103d41ed, 0x103d53ea, 0x103d7c69, 0x1042f26d, 0x1042f3ed, 0x10432e6d, 0x1049d369,
+    0x104a0ded, 0x1050f1ed, 0x10511a6d, 0x1056e3aa, 0x10571e2a, 0x10571fa9, 0x105757e9, 0x105797aa,
+    0x1057992a, 0x1057ab2a, 0x1057d3a9, 0x105d4b2d, 0x105dff2d, 0x1083bb3a, 0x1083ceba, 0x1083f73a,
+    0x108a603a, 0x108adb3e, 0x10908d6d, 0x109106ae, 0x10913fae, 0x1091532e, 0x10917bae, 0x10b0576d,
+    0x10b6096d, 0x10b6fd2d, 0x10b6fead, 0x10b710ad, 0x10b7392d, 0x10c3cf2d, 0x10c4832d, 0x10c9faad,
+    0x10caaead, 0x10e70ebe, 0x10e71515, 0x10e71699, 0x10e77a59, 0x10e77bd9, 0x10e78d05, 0x10e7b659,
+    0x10e7f555, 0x10e84651, 0x10e879be, 0x10e88025, 0x10e8a965, 0x10e8b7fe, 0x10e8b97e, 0x10e8be65,
+    0x10e8f3fe, 0x10e8f5fe, 0x10e8fa65, 0x10e92d45, 0x10e93091, 0x10e93111, 0x10e93291, 0x10e93711,
+    0x10e94289, 0x10e9568a, 0x10e95806, 0x10e995e1, 0x10e99659, 0x10e997d9, 0x10e99c59, 0x10e9a78a,
+    0x10e9bb05, 0x10e9be69, 0x10e9bee5, 0x10e9c059, 0x10e9c4d9, 0x10e9fbd5, 0x10e9fd55, 0x10ea6069,
+    0x10ea6251, 0x10ea66d1, 0x10ea87c6, 0x10ea9a8a, 0x10eaae05, 0x10eab155, 0x10eab1d5, 0x10eab369,
+    0x10eab7e5, 0x10ead9d1, 0x10eada51, 0x10eadbe9, 0x10eae065, 0x10eb0146, 0x10eb284a, 0x10eb29c6,
+    0x10eb6485, 0x10eb687e, 0x10eb7895, 0x10eb8d05, 0x10eb90d1, 0x10eba2d9, 0x10ebb649, 0x10ebb7c5,
+    0x10ebf2c9, 0x10ebf445, 0x10ec0685, 0x10ec0a55, 0x10ec1c7e, 0x10ec2fc9, 0x10ec44d1, 0x10ec6bc5,
+    0x10ec6fa5, 0x10ec711d, 0x10ec9826, 0x10eca845, 0x10ecac26, 0x10ecad9d, 0x10ed119d, 0x10ed88fe,
+    0x10ed984d, 0x10ed9cfd, 0x10edb17d, 0x10edd3c5, 0x10eddc3d, 0x10edddbd, 0x10ede299, 0x10ee04a6,
+    0x10ee14fd, 0x10ee18a6, 0x10ee1a3d, 0x10ee1e99, 0x10ee2afe, 0x10ee573d, 0x10ee5c15, 0x10ee8ba5,
+    0x10ee903d, 0x10eea6a6, 0x10eeb426, 0x10eeb8a6, 0x10eec826, 0x10eecca6, 0x10eed725, 0x10ef323d,
+    0x10ef4f25, 0x10ef50a5, 0x10ef8b25, 0x10efc155, 0x10f0dda5, 0x10f0df25, 0x10f0e425, 0x10f0e5a5,
+    0x10f0f12a, 0x10f0f1a5, 0x10f0f325, 0x10f0f7aa, 0x10f15725, 0x10f158a5, 0x10f15da5, 0x10f15f25,
+    0x10f16aa5, 0x10f16b2a, 0x10f16caa, 0x10f17125, 0x10f19325, 0x10f193a5, 0x10f19525, 0x10f199a5,
+    0x10f3f9d5, 0x10f3fb59, 0x10f4225a, 0x10f45e51, 0x10f49d51, 0x10f5012a, 0x10f502a5, 0x10f52b25,
+    0x10f53d25, 0x10f55165, 0x10f5a325, 0x10f5b6a5, 0x10f5df25, 0x10f5fe8a, 0x10f61555, 0x10f615d5,
+    0x10f61755, 0x10f61bd5, 0x10f68c4a, 0x10f70925, 0x10f70aa5, 0x10f71125, 0x10f71d2a, 0x10f71ea5,
+    0x10f7232a, 0x10f74529, 0x10f745a5, 0x10f74725, 0x10f74ba5, 0x10f77f4a, 0x10f7bea5, 0x10f7bf25,
+    0x10f7c0a9, 0x10f7c525, 0x10f83505, 0x10f838d5, 0x10f84915, 0x10f862d1, 0x10f87359, 0x10f886e2,
+    0x10f8c349, 0x10f8c4c5, 0x10f8d705, 0x10f8dad1, 0x10f8ecd5, 0x10f91551, 0x10f9341d, 0x10f94022,
+    0x10f941a2, 0x10f968be, 0x10f978c5, 0x10f97ca1, 0x10f97e1d, 0x10f9e21d, 0x10fa597d, 0x10fa7ecd,
+    0x10faa099, 0x10faae22, 0x10fac751, 0x10fad53e, 0x10fae57d, 0x10fae93d, 0x10faeabd, 0x10fafb7d,
+    0x10fb2622, 0x10fb4291, 0x10fb5da2, 0x10fb60a2, 0x10fb893e, 0x10fb9d3d, 0x10fba62a, 0x10fbba51,
+    0x10fbe145, 0x10fbffba, 0x10fc02bd, 0x10fc1faa, 0x10fc3245, 0x10fc4821, 0x10fc5ba1, 0x10fce351,
+    0x10fcf549, 0x10fd5e91, 0x10fdae2a, 0x10fdb4aa, 0x10fdc22a, 0x10fe3d2a, 0x10fe41aa, 0x10fe6421,
+    0x10fe6a21, 0x10fe9ee9, 0x10feb2e9, 0x10fec769, 0x10fee629, 0x10fef229, 0x10fef3a9, 0x10fef829,
+    0x10ff1aa9, 0x10ff1ca9, 0x10ff2129, 0x10ff2ae9, 0x10ff2e29, 0x10ff2ea9, 0x10ff3029, 0x10ff34a9,
+    0x10ff40e9, 0x10ff6ba9, 0x10ff6d29, 0x10ff8829, 0x10ffa629, 0x10ffbca9, 0x10ffcea9, 0x10ffe229,
+    0x10ffe2a9, 0x11004829, 0x1100cfe9, 0x1100dea9, 0x1100f4a9, 0x11010e29, 0x11010fa9, 0x110136a9,
+    0x11014a29, 0x11014aa9, 0x11014c29, 0x1101d369, 0x1101eaa9, 0x11020e69, 0x11026429, 0x11027569,
+    0x11028769, 0x110287e9, 0x1102b069, 0x1102c3e9, 0x1103622a, 0x1103d0a9, 0x1103dbe9, 0x1103e1e9,
+    0x1103ef69, 0x11042be9, 0x11048fe9, 0x1104ca2a, 0x1104f105, 0x1104f4d1, 0x11050649, 0x110506c9,
+    0x110507c5, 0x11051a49, 0x11051bc5, 0x11052ed2, 0x11052f5d, 0x11054259, 0x11054619, 0x11054799,
+    0x1105481d, 0x1105565d, 0x110556c2, 0x11055a1d, 0x11055b9d, 0x11056019, 0x1105823e, 0x11058299,
+    0x11058419, 0x11058899, 0x1105a852, 0x1105a8c9, 0x1105a9d2, 0x1105bbd5, 0x1105bf95, 0x1105c115,
+    0x1105c195, 0x1105cfc5, 0x1105d395, 0x1105d515, 0x1105d995, 0x1105e992, 0x1105ea1d, 0x11060e1d,
+    0x1106363e, 0x11063689, 0x110637be, 0x11064a09, 0x11064b85, 0x1106af89, 0x1106b01d, 0x1106b105,
+    0x1107157d, 0x110723c5, 0x11072c3d, 0x11072dbd, 0x11072e3d, 0x110737c5, 0x11073c7d, 0x1107403d,
+    0x110741bd, 0x11074615, 0x11076219, 0x11076399, 0x1107760d, 0x1107778d, 0x11079e3e, 0x11079e8d,
+    0x1107a00d, 0x1107a2be, 0x1107a33d, 0x1107ac19, 0x1107c5d2, 0x1107d03d, 0x1107db95, 0x1107ef8d,
+    0x1107f43d, 0x11080592, 0x110839e9, 0x11083b69, 0x110853be, 0x1108583e, 0x11085bfe, 0x11085d7e,
+    0x11085dfd, 0x11086269, 0x110863e9, 0x11086785, 0x11086ffd, 0x1108717d, 0x110875e9, 0x11088945,
+    0x11089f15, 0x1108a0a9, 0x1108b295, 0x1108c791, 0x1108cd05, 0x1108d1bd, 0x1108d57d, 0x1108d6fd,
+    0x1108db69, 0x1108ef69, 0x11090391, 0x110911fd, 0x1109137d, 0x110917e9, 0x11097711, 0x11098909,
+    0x11099c89, 0x11099e05, 0x1109c819, 0x110a2b09, 0x110a3985, 0x110a3e05, 0x110a41e9, 0x110a4369,
+    0x110a43e9, 0x110a47e9, 0x110a5205, 0x110a55e9, 0x110a5769, 0x110ac115, 0x110ae991, 0x110af7e9,
+    0x110d8519, 0x110d9c59, 0x110dae59, 0x110dbcfe, 0x110dc35a, 0x110dff59, 0x110e3cd6, 0x110e3e51,
+    0x110e63c5, 0x110ea22a, 0x110ea3a1, 0x110eb4c5, 0x110ecc21, 0x110ede21, 0x110eebfe, 0x110eedfe,
+    0x110f9f8a, 0x110fb305, 0x110fb655, 0x110fb6d5, 0x110fb855, 0x110fbcd9, 0x110fdf51, 0x110ff149,
+    0x11102d4a, 0x1110aa21, 0x1110aba1, 0x1110b221, 0x1110bda1, 0x1110be2a, 0x1110bfa1, 0x1110c42a,
+    0x1110e629, 0x1110e821, 0x1110eca1, 0x1111204a, 0x11115fa1, 0x11116021, 0x111161a9, 0x1111d6c9,
+    0x1111d856, 0x1111eac9, 0x1111ec45, 0x11121699, 0x11121819, 0x11122a19, 0x11122a9d, 0x11122c1d,
+    0x1112309a, 0x111252be, 0x11127a56, 0x11129195, 0x1112a395, 0x1112a416, 0x1112a595, 0x1112aa15,
+    0x1112de09, 0x1112de9d, 0x1112df85, 0x1112f4be, 0x111306be, 0x11130806, 0x11131a89, 0x11131c06,
+    0x1113f456, 0x1113fe3d, 0x11140845, 0x11141096, 0x1114123d, 0x1114169a, 0x11143299, 0x1114460d,
+    0x1114468d, 0x11146ebe, 0x11147486, 0x11149656, 0x1114bf8d, 0x1114c016, 0x1114fb85, 0x111503fd,
+    0x1115057d, 0x111509e9, 0x11150a69, 0x111510be, 0x11151686, 0x11152406, 0x11152dfe, 0x11153806,
+    0x11153ffe, 0x111541fd, 0x11154669, 0x1115a5fd, 0x1115a77d, 0x1115b97d, 0x11166299, 0x11166419,
+    0x11166f99, 0x11169e99, 0x1116e915, 0x11171269, 0x11172669, 0x111727e9, 0x11187e19, 0x111a5659,
+    0x111aa81a, 0x111aa99a, 0x111abb99, 0x111ae419, 0x111b0bd6, 0x111b2316, 0x111b3515, 0x111b4a12,
+    0x111b712a, 0x111b8611, 0x111c0d7d, 0x111c844a, 0x111cc399, 0x111cc419, 0x111cc599, 0x111cca19,
+    0x111d4395, 0x111d79e9, 0x111d7e09, 0x111ea685, 0x111eaa55, 0x111eba95, 0x111ecf05, 0x111ed2d1,
+    0x111ee4d9, 0x111f34c9, 0x111f3645, 0x111f5e55, 0x111f86d1, 0x111fb1a2, 0x111fda26, 0x111fea45,
+    0x111fee26, 0x111fef9d, 0x111ff439, 0x1120539d, 0x1120cafd, 0x1120da4d, 0x1120f37d, 0x11211e22,
+    0x112124bd, 0x112146a6, 0x112156fd, 0x11215aa6, 0x11215c3d, 0x11216099, 0x11219e39, 0x1121d222,
+    0x1121faa6, 0x11220b8d, 0x11220ea6, 0x1122743d, 0x112391fa, 0x1124333a, 0x1124aebe, 0x1124d521,
+    0x1124d721, 0x11251065, 0x112523e5, 0x11252465, 0x11252565, 0x112538e5, 0x112563a5, 0x11256525,
+    0x11258c26, 0x11259c65, 0x11259fa5, 0x1125a026, 0x1125a1a5, 0x1125a625, 0x1125b265, 0x1125dea5,
+    0x112617a5, 0x11262e26, 0x11264026, 0x112653a5, 0x11265426, 0x1126b9a5, 0x11274165, 0x11275026,
+    0x11277fa5, 0x1127a826, 0x1127aca6, 0x1127bba5, 0x1127bc26, 0x1127c0a6, 0x11287fe6, 0x11288165,
+    0x1128d5a5, 0x1128f966, 0x11293566, 0x112a4225, 0x112a60e5, 0x112a9d65, 0x112b0165, 0x112b77c9,
+    0x112b7945, 0x112ba052, 0x112ba1d2, 0x112bb3d9, 0x112bb799, 0x112bb919, 0x112c2d55, 0x112c3139,
+    0x112c3295, 0x112ca789, 0x112ca939, 0x112d2109, 0x112d2285, 0x112d9555, 0x112d9dbd, 0x112d9f3d,
+    0x112dbdd2, 0x112e0f8d, 0x112e15bd, 0x112ec539, 0x112ec9bd, 0x112ecefd, 0x112ed379, 0x112ee2fd,
+    0x112f3e85, 0x112f433d, 0x112f46fd, 0x112f487d, 0x11303919, 0x1130ab39, 0x1130af85, 0x1130b379,
+    0x1130db3a, 0x11312e15, 0x113156be, 0x1131e0e1, 0x1131f5e2, 0x11320961, 0x11322821, 0x11323422,
+    0x113235a2, 0x11325ca1, 0x11326ce1, 0x113270a1, 0x11327221, 0x113276a1, 0x113282e1, 0x1132ada2,
+    0x1132ca21, 0x1132e822, 0x113310a1, 0x113324a1, 0x11338a21, 0x113411e2, 0x113420a1, 0x113436a1,
+    0x113451a2, 0x113493a2, 0x11351562, 0x113551e1, 0x1135b761, 0x1135d7a2, 0x1135ffa2, 0x113605e1,
+    0x113723e1, 0x11373162, 0x11376de1, 0x1137d1e1, 0x113e9c52, 0x113e9cd5, 0x113e9dd2, 0x113eafc5,
+    0x113eb395, 0x113eb515, 0x113eb595, 0x113ec3d5, 0x113ec795, 0x113ec915, 0x113ecd95, 0x113ed852,
+    0x113edc12, 0x113edd92, 0x113eee19, 0x113f1891, 0x113f2a09, 0x113f2a89, 0x113f2b85, 0x113f3e09,
+    0x113f3f85, 0x113f51d2, 0x113f5592, 0x113f5795, 0x113f6795, 0x113f7b95, 0x113f9012, 0x113faedd,
+    0x113fc2fd, 0x113fcc89, 0x113fdf85, 0x113fe379, 0x113fe4dd, 0x113fe55d, 0x113ff385, 0x113ff779,
+    0x113ff8dd, 0x113ffd79, 0x11405905, 0x11405cdd, 0x11405e5d, 0x114062dd, 0x114076fd, 0x114098dd,
+    0x1140995d, 0x11409add, 0x11409f5d, 0x1140b9d2, 0x1140cf95, 0x1140d43d, 0x1140e38d, 0x1140f992,
+    0x1140fc92, 0x11411b59, 0x11412dfd, 0x11412f7d, 0x1141393d, 0x11413bbe, 0x11414785, 0x11414ffd,
+    0x1141517d, 0x114151fd, 0x114155d9, 0x11415659, 0x114157d9, 0x11415b85, 0x1141603d, 0x114163be,
+    0x114163fd, 0x1141657d, 0x114169d9, 0x11417612, 0x1141a779, 0x1141bd52, 0x1141f3fd, 0x1141ff79,
+    0x114200cd, 0x1142014d, 0x114203fd, 0x11421379, 0x114214cd, 0x114217fd, 0x114220fa, 0x114278cd,
+    0x11427a4d, 0x11427d7d, 0x11429a7e, 0x1142b4cd, 0x1142b54d, 0x1142b6cd, 0x1142c2f9, 0x1142c479,
+    0x11431f3d, 0x114337fd, 0x1143463d, 0x114349fd, 0x11434b7d, 0x1143d9fd, 0x1143e579, 0x1143e6cd,
+    0x1143e9c9, 0x1143fdfd, 0x114428fa, 0x11442a79, 0x11442f7a, 0x114430f9, 0x11443cfa, 0x11449ffd,
+    0x1144a279, 0x1144a3f9, 0x1144b67e, 0x1144b7fe, 0x1144bc7e, 0x1144de79, 0x1144def9, 0x1144e079,
+    0x1144e4f9, 0x11452e45, 0x11456cbd, 0x1145729a, 0x1145e616, 0x1145ec39, 0x11474a45, 0x11475296,
+    0x1147589a, 0x114788bd, 0x11480216, 0x1149da19, 0x114a7c3a, 0x114acf15, 0x114af7be, 0x114b6e45,
+    0x114b8045, 0x114b8416, 0x114b8595, 0x114b9445, 0x114b94c1, 0x114b9795, 0x114b9816, 0x114b9995,
+    0x114b9e1a, 0x114ba8c5, 0x114bac91, 0x114bbe99, 0x114bd209, 0x114bd2bd, 0x114bd385, 0x114bfa89,
+    0x114bfc06, 0x114c0e89, 0x114c1006, 0x114c2245, 0x114c2616, 0x114c3816, 0x114c4b89, 0x114c4c16,
+    0x114c4d39, 0x114c6091, 0x114c8785, 0x114c8b79, 0x114c8cdd, 0x114c9e06, 0x114cb55d, 0x114cc406,
+    0x114cc779, 0x114cc95d, 0x114ccdf9, 0x114d2d5d, 0x114d2edd, 0x114d40dd, 0x114d695d, 0x114d8a45,
+    0x114d9296, 0x114da016, 0x114da496, 0x114db38d, 0x114db416, 0x114db83d, 0x114db896, 0x114db9bd,
+    0x114dc891, 0x114dcd3d, 0x114def85, 0x114df43d, 0x114df7fd, 0x114df97d, 0x114dfdda, 0x114dfe5a,
+    0x114e1806, 0x114e21fd, 0x114e2c06, 0x114e3086, 0x114e33fd, 0x114e35fd, 0x114e3a5a, 0x114e4216,
+    0x114e4696, 0x114e6939, 0x114e6dbd, 0x114e72fd, 0x114e7779, 0x114e77d6, 0x114ea779, 0x114ea8cd,
+    0x114eabfd, 0x114eba06, 0x114ed14d, 0x114ee379, 0x114ee54d, 0x114ee7fd, 0x114ef2f9, 0x114f494e,
+    0x114f4dfd, 0x114f5cce, 0x114f647e, 0x114f65fe, 0x114f854e, 0x114fa07e, 0x114fa27e, 0x11501a7d,
+    0x11501bfd, 0x1150b5f9, 0x1150ba49, 0x1150ce7d, 0x1150faf9, 0x11510179, 0x11510cfa, 0x11510ef9,
+    0x1151137a, 0x115172f9, 0x11517479, 0x11518679, 0x115186fe, 0x1151887e, 0x1151aef9, 0x1151b0f9,
+    0x1151eb95, 0x11522619, 0x11529f95, 0x11531b79, 0x115394dd, 0x11540795, 0x115487fd, 0x11551cfa,
+    0x11551e7e, 0x11553779, 0x11553bfd, 0x1155407e, 0x115546f9, 0x1155547e, 0x115558fa, 0x1155b0ce,
+    0x1155b57d, 0x1155b87e, 0x1155b9fe, 0x1155f47e, 0x1155f67e, 0x11571d79, 0x115721c9, 0x115724fa,
+    0x11572679, 0x11572cfe, 0x115738fa, 0x11573a7e, 0x11573efa, 0x115760fa, 0x115762f9, 0x1157677a,
+    0x1157da79, 0x1157dafe, 0x1157dc7e, 0x115a6805, 0x115a9155, 0x115aa651, 0x115addfe, 0x115ae251,
+    0x115b197e, 0x115b1afe, 0x115b1fd1, 0x115b2151, 0x115b8521, 0x115b86a1, 0x115bada5, 0x115baf21,
+    0x115bc121, 0x115bcefe, 0x115bcf7e, 0x115bd565, 0x115c2725, 0x115c3aa5, 0x115c6325, 0x115c828a,
+    0x115c9605, 0x115c9955, 0x115c99d5, 0x115c9b59, 0x115c9fd5, 0x115d104a, 0x115d3b55, 0x115d3bd1,
+    0x115d3d51, 0x115d41d1, 0x115d8d21, 0x115d8ea1, 0x115d9521, 0x115da0a1, 0x115da121, 0x115da2a1,
+    0x115da721, 0x115dc9a5, 0x115dcb21, 0x115dcfa1, 0x115e034a, 0x115e42a1, 0x115e4321, 0x115e4925,
+    0x11612e3d, 0x11634599, 0x11634719, 0x11635299, 0x11638199, 0x1163cc15, 0x116474a5, 0x11673951,
+    0x11678b1a, 0x11678c9a, 0x11679e99, 0x1167c719, 0x11680496, 0x11680616, 0x11682d12, 0x1168ba25,
+    0x1169674a, 0x1169a699, 0x1169a719, 0x1169a899, 0x1169ad19, 0x116a2015, 0x116a2095, 0x116a2215,
+    0x116a2695, 0x116a4891, 0x116a6109, 0x116e3019, 0x116ed211, 0x116f0d45, 0x116f2315, 0x116f3695,
+    0x116f4b91, 0x116f81be, 0x116f8791, 0x11704c19, 0x1170ee11, 0x11714515, 0x11716d91, 0x1171f1fe,
+    0x1171f5be, 0x117205c5, 0x11720995, 0x11721a45, 0x11721e11, 0x11721fba, 0x11723019, 0x11724389,
+    0x11724409, 0x11724505, 0x11726c3e, 0x11728009, 0x11728185, 0x117293fe, 0x117297be, 0x1172a9be,
+    0x1172bd3e, 0x1172bd89, 0x1172bebe, 0x1172d211, 0x1172f0dd, 0x1172f905, 0x1172fcdd, 0x1172fe5d,
+    0x1172fedd, 0x117302dd, 0x1173257e, 0x1173275d, 0x11732bdd, 0x11733585, 0x117338fe, 0x1173395d,
+    0x11733add, 0x11733f5d, 0x11739edd, 0x1173b25d, 0x1173b2dd, 0x117411be, 0x1174163e, 0x1174253e,
+    0x1174258d, 0x117429be, 0x11742a3d, 0x11742b3e, 0x11743bba, 0x11743ebd, 0x11745d59, 0x11746105,
+    0x117465bd, 0x1174697d, 0x11746afd, 0x11746b7d, 0x11746f59, 0x11746fd9, 0x117491fe, 0x117493fd,
+    0x11749859, 0x11749d85, 0x1174a23d, 0x1174a57e, 0x1174a5fd, 0x1174a77d, 0x1174abd9, 0x1174b83e,
+    0x1174dabe, 0x1174df3e, 0x1174e2fe, 0x1174e47e, 0x1174e4fd, 0x1174e955, 0x1174ff51, 0x117518cd,
+    0x11751a4d, 0x11751acd, 0x11751d7d, 0x117533fe, 0x1175417e, 0x1175434d, 0x117545fe, 0x117554fe,
+    0x1175554d, 0x117556cd, 0x1175597e, 0x117559fd, 0x117562f9, 0x11756479, 0x1175bacd, 0x1175bf7d,
+    0x1175ce4d, 0x1175cecd, 0x1175d5fe, 0x1175d77e, 0x1175dc79, 0x1175ddf9, 0x117604f9, 0x117611fe,
+    0x1176127e, 0x117613fe, 0x11761879, 0x1177274d, 0x11772bc9, 0x117736f9, 0x11774279, 0x11774a79,
+    0x11776afd, 0x11776c7d, 0x11776cf9, 0x11777179, 0x117772f9, 0x11777ef9, 0x11778079, 0x117784f9,
+    0x1177e479, 0x1177e5f9, 0x1177eaf9, 0x1177ec79, 0x1177f7f9, 0x1177f879, 0x1177fe79, 0x1178207d,
+    0x117820f9, 0x11782279, 0x117826f9, 0x11789819, 0x1178ab89, 0x117964dd, 0x1179665d, 0x11796add,
+    0x11798d5d, 0x11798edd, 0x1179935d, 0x117a065d, 0x117a06dd, 0x117acdbd, 0x117ad17d, 0x117ad2fd,
+    0x117ad759, 0x117b80cd, 0x117b824d, 0x117b857d, 0x117b8e79, 0x117b8ff9, 0x117ba94d, 0x117baacd,
+    0x117bb6f9, 0x117bb879, 0x117bc47e, 0x117bc5fe, 0x117bca79, 0x117bde91, 0x117c224d, 0x117c22cd,
+    0x117c277d, 0x117c29fe, 0x117c3079, 0x117c3dfe, 0x117c43f9, 0x117c667e, 0x117c6c79, 0x117d8ecd,
+    0x117d8f4d, 0x117d93c9, 0x117d9679, 0x117d97f9, 0x117d9cf9, 0x117d9e79, 0x117daa79, 0x117dabf9,
+    0x117db079, 0x117dd2f9, 0x117dd479, 0x117dd8f9, 0x117e4bf9, 0x117e4c79, 0x117e5279, 0x1180d5fe,
+    0x1180da59, 0x11812c1a, 0x11813f99, 0x11816819, 0x11818fc5, 0x1181a596, 0x1181a716, 0x1181b915,
+    0x1181ce12, 0x118205be, 0x11820a11, 0x11827d3e, 0x11827dbe, 0x1183084a, 0x11834799, 0x11834819,
+    0x11834999, 0x11834e19, 0x1183c115, 0x1183c195, 0x1183c315, 0x1183c795, 0x1183e991, 0x1183ea11,
+    0x1183eb91, 0x11857c09, 0x118634dd, 0x1186355d, 0x118636dd, 0x11863b5d, 0x1187a1fd, 0x1187a37d,
+    0x1187a7da, 0x118850cd, 0x1188514d, 0x118855fd, 0x1188587e, 0x118859fe, 0x11885ef9, 0x11886079,
+    0x118888f9, 0x1188967e, 0x11889af9, 0x1188fa7e, 0x11890dfe, 0x11890e7e, 0x11897999, 0x118a66f9,
+    0x118a6879, 0x118a68f9, 0x118a6d79, 0x118a6ef9, 0x118a7a79, 0x118a7af9, 0x118a7c79, 0x118a80f9,
+    0x118aa4f9, 0x118aa979, 0x118b1c79, 0x118b1cf9, 0x118bd29e, 0x118bd31e, 0x118bd49e, 0x118bd919,
+    0x118c5295, 0x118db93e, 0x118dbabe, 0x118dbf19, 0x118de1be, 0x118e6111, 0x118e9d12, 0x118ec07e,
+    0x118ec1fe, 0x118ec679, 0x118eea7e, 0x118eeef9, 0x118f61fe, 0x118f627e, 0x118f63fe, 0x1190ce79,
+    0x1190cef9, 0x1190d079, 0x1190d4f9, 0x1191e74a, 0x1191fac5, 0x1191fe15, 0x1191fe95, 0x11920015,
+    0x1192049d, 0x1192750a, 0x1192f85e, 0x1192f9de, 0x11930bea, 0x11932de9, 0x11932e65, 0x11932fdd,
+    0x1193345d, 0x1193680a, 0x1193a75d, 0x1193a7dd, 0x1193a969, 0x11940945, 0x11940c91, 0x11940d11,
+    0x11940e91, 0x11941311, 0x11941e89, 0x11942685, 0x1194328a, 0x11943406, 0x11945e5a, 0x11945fda,
+    0x119464da, 0x1194665a, 0x119471e1, 0x11947259, 0x119473d9, 0x11947859, 0x1194838a, 0x11949705,
+    0x11949a69, 0x11949ae5, 0x11949c59, 0x1194a0d9, 0x1194d7d6, 0x1194d956, 0x1194dfd6, 0x119506d2,
+    0x1195768a, 0x11958a05, 0x11958d55, 0x11958dd5, 0x11958f69, 0x119593e5, 0x1196044a, 0x1196410a,
+    0x11968059, 0x119680d9, 0x11968259, 0x1196f9d5, 0x1196fa55, 0x1196fbd5, 0x11986409, 0x11986489,
+    0x11986785, 0x11986a9d, 0x1198780a, 0x1198a3d9, 0x1198a559, 0x1198a5d9, 0x1198aa59, 0x1198abd9,
+    0x1198b759, 0x1198b7d9, 0x1198b959, 0x1198bddd, 0x1198dc85, 0x1198dfe9, 0x1198e065, 0x1198e1d9,
+    0x1198e65d, 0x1199cf85, 0x1199d2d5, 0x1199d355, 0x1199d4e9, 0x119a0d49, 0x119a0dc9, 0x119a49ca,
+    0x119a91d9, 0x119a9d55, 0x119a9dd5, 0x119aa3d5, 0x119b06c9, 0x119b9125, 0x119b92a5, 0x119b97aa,
+    0x119b9925, 0x119bbb29, 0x119bc025, 0x119bc1a5, 0x119bcd29, 0x119bcda5, 0x119bcf25, 0x119bd3a5,
+    0x119bf9e5, 0x119c074a, 0x119c3325, 0x119c34a9, 0x119c3529, 0x119c46a5, 0x119c4725, 0x119c48a9,
+    0x119c4d25, 0x119c6f29, 0x119c6fa5, 0x119c7129, 0x119c75a5, 0x119ca885, 0x119cabd5, 0x119cac55,
+    0x119cadd5, 0x119ce24d, 0x119ce3cd, 0x119ce649, 0x119ce6c9, 0x119d22ca, 0x119d9fa5, 0x119da125,
+    0x119da1a5, 0x119da63d, 0x119da7bd, 0x119db325, 0x119db3aa, 0x119db525, 0x119ddba9, 0x119ddc25,
+    0x119ddda5, 0x119e15ca, 0x119e5525, 0x119e55a5, 0x119e5729, 0x119ecc0a, 0x119f0b59, 0x119f0bda,
+    0x119f0d59, 0x119f11d9, 0x119f8b55, 0x119fc5de, 0x11a0da8a, 0x11a0dc06, 0x11a0f155, 0x11a0f1d5,
+    0x11a0f355, 0x11a0f7d5, 0x11a11a5a, 0x11a12c5a, 0x11a1684a, 0x11a199d6, 0x11a1f92a, 0x11a1faa5,
+    0x11a1ff2a, 0x11a22325, 0x11a227a5, 0x11a25b4a, 0x11a29aa5, 0x11a29b25, 0x11a29ca9, 0x11a2a125,
+    0x11a40725, 0x11a407aa, 0x11a40925, 0x11a40dbd, 0x11a57c59, 0x11a5b0d9, 0x11a6a9dd, 0x11a76255,
+    0x11a7bf51, 0x11a7d149, 0x11a88a29, 0x11a890a1, 0x11a89e21, 0x11a8b851, 0x11a8cbc5, 0x11a90a21,
+    0x11a90ba9, 0x11a91da1, 0x11a94021, 0x11a94621, 0x11aa5d11, 0x11aa7101, 0x11aa783d, 0x11aaaca1,
+    0x11aba65d, 0x11aba7dd, 0x11abe0d9, 0x11abee49, 0x11abf45d, 0x11ac16c9, 0x11ac1cdd, 0x11ac9b9e,
+    0x11aca91d, 0x11accfa9, 0x11acd129, 0x11acd19d, 0x11acd61d, 0x11acd79d, 0x11ace329, 0x11ace39d,
+    0x11ace51d, 0x11ace99d, 0x11ad0fdd, 0x11ad491d, 0x11ad4b29, 0x11ad4f9d, 0x11ad5139, 0x11ad5c9d,
+    0x11ad5d1d, 0x11ad631d, 0x11ad8529, 0x11ad859d, 0x11ad8729, 0x11ad8b9d, 0x11ae1a19, 0x11ae1b99,
+    0x11ae4299, 0x11ae4419, 0x11ae5019, 0x11ae5619, 0x11af3595, 0x11af3729, 0x11af4915, 0x11af8389,
+    0x11afac09, 0x11afad85, 0x11afb50e, 0x11afb98a, 0x11afde4d, 0x11afdfcd, 0x11b02219, 0x11b02399,
+    0x11b02419, 0x11b03599, 0x11b03619, 0x11b03799, 0x11b05e99, 0x11b06019, 0x11b0d9e9, 0x11b0dcbd,
+    0x11b0ede9, 0x11b10e0d, 0x11b10f8d, 0x11b1218e, 0x11b15195, 0x11b15329, 0x11b1878d, 0x11b18b89,
+    0x11b18c09, 0x11b241c9, 0x11b24859, 0x11b2fb1e, 0x11b2fc9e, 0x11b3031e, 0x11b30f2a, 0x11b3109d,
+    0x11b3152a, 0x11b33729, 0x11b3379d, 0x11b3391d, 0x11b33d9d, 0x11b3b09d, 0x11b3b11d, 0x11b3b2a9,
+    0x11b3b71d, 0x11b46f9a, 0x11b4a3a9, 0x11b4a419, 0x11b4aa19, 0x11b598a9, 0x11b59d15, 0x11b68999,
+    0x11b68a19, 0x11b68b99, 0x11b73b0d, 0x11b7443d, 0x11b86d0a, 0x11b8ac59, 0x11b8acda, 0x11b8ae59,
+    0x11b92c55, 0x11ba7b8a, 0x11ba8f05, 0x11ba9255, 0x11ba92d5, 0x11ba9455, 0x11ba98d9, 0x11babb5a,
+    0x11bacd5a, 0x11bb094a, 0x11bb3ad6, 0x11bb4e56, 0x11bb9a2a, 0x11bb9ba1, 0x11bba02a, 0x11bbc421,
+    0x11bbc8a1, 0x11bbfc4a, 0x11bc3ba1, 0x11bc3c21, 0x11bc3da9, 0x11bda821, 0x11bda8aa, 0x11bdaa21,
+    0x11bdaebd, 0x11bed485, 0x11bed7d5, 0x11bed855, 0x11bed9d5, 0x11bf1249, 0x11bf12c9, 0x11bf4eca,
+    0x11bf9255, 0x11bfcb9e, 0x11bfcd1e, 0x11bfcd9e, 0x11bfce5e, 0x11bfd21e, 0x11bfd39e, 0x11bfdf1d,
+    0x11bfdfaa, 0x11bfe11d, 0x11bfe5aa, 0x11c007a9, 0x11c0099d, 0x11c00e1d, 0x11c041ca, 0x11c07dc5,
+    0x11c0811d, 0x11c0819d, 0x11c08329, 0x11c0fed9, 0x11c13a1a, 0x11c14b99, 0x11c14c19, 0x11c14d99,
+    0x11c15219, 0x11c17429, 0x11c17a99, 0x11c1b996, 0x11c1cb95, 0x11c22e89, 0x11c26715, 0x11c26929,
+    0x11c31aca, 0x11c35a19, 0x11c35a99, 0x11c35c19, 0x11c40a2a, 0x11c40b8d, 0x11c414bd, 0x11c4c40a,
+    0x11c6331e, 0x11c6339e, 0x11c6351e, 0x11c6399e, 0x11c7604a, 0x11c79f9a, 0x11c7a01a, 0x11c7a19a,
+    0x11c7a61a, 0x11c81f96, 0x11c84212, 0x11c84812, 0x11cc21d9, 0x11cd16d5, 0x11ce747a, 0x11ced9ba,
+    0x11cefbba, 0x11cf0f3a, 0x11cf2551, 0x11cf76a1, 0x11cfb121, 0x11cfb321, 0x11d0e83a, 0x11d0f5ba,
+    0x11d0fbba, 0x11d11dba, 0x11d1243a, 0x11d1993e, 0x11d287c9, 0x11d3429d, 0x11d354ba, 0x11d37e45,
+    0x11d3bc1d, 0x11d3bcbe, 0x11d3d03e, 0x11d3f69d, 0x11d3f89d, 0x11d4c119, 0x11d5b615, 0x11d6cf99,
+    0x11d7c495, 0x11d980ba, 0x11d986ba, 0x11d9a8ba, 0x11da243e, 0x11db1519, 0x11db15a5, 0x11dc0a15,
+    0x11dc0ea5, 0x11dd7b3a, 0x11dd9dba, 0x11ddab3a, 0x11e011ba, 0x11e0933e, 0x11e17e19, 0x11e2203a,
+    0x11e2483a, 0x11e27915, 0x11e2a1be, 0x11e41be1, 0x11e42ffd, 0x11e53445, 0x11e54645, 0x11e54a15,
+    0x11e55a45, 0x11e55ac1, 0x11e55d95, 0x11e55e15, 0x11e57291, 0x11e58489, 0x11e58fbe, 0x11e59809,
+    0x11e598bd, 0x11e59985, 0x11e59d3e, 0x11e5a33e, 0x11e5c089, 0x11e5c205, 0x11e5c399, 0x11e5c519,
+    0x11e5d489, 0x11e5d605, 0x11e5d719, 0x11e5ec39, 0x11e5fe09, 0x11e61189, 0x11e61209, 0x11e61339,
+    0x11e63f5d, 0x11e6455d, 0x11e64d85, 0x11e65179, 0x11e652dd, 0x11e6537d, 0x11e65779, 0x11e679f9,
+    0x11e67b5d, 0x11e67bdd, 0x11e68079, 0x11e68d79, 0x11e68df9, 0x11e68f5d, 0x11e693f9, 0x11e6be9d,
+    0x11e6f35d, 0x11e6f7be, 0x11e7053e, 0x11e706dd, 0x11e70b3e, 0x11e72d09, 0x11e75045, 0x11e75891,
+    0x11e76615, 0x11e76a89, 0x11e7798d, 0x11e77a0d, 0x11e77e09, 0x11e77e89, 0x11e77f85, 0x11e78e91,
+    0x11e7abd9, 0x11e7b1d9, 0x11e7b585, 0x11e7ba05, 0x11e7bdd9, 0x11e7bf59, 0x11e7bffd, 0x11e7c3d9,
+    0x11e7c47d, 0x11e7de05, 0x11e7e659, 0x11e7e7d9, 0x11e7e859, 0x11e7ecd9, 0x11e7f205, 0x11e7f9d9,
+    0x11e7fa59, 0x11e7fbd9, 0x11e80059, 0x11e80839, 0x11e82555, 0x11e82f39, 0x11e83385, 0x11e83779,
+    0x11e838d5, 0x11e83955, 0x11e83d79, 0x11e83df9, 0x11e853d1, 0x11e86d79, 0x11e86ecd, 0x11e871c9,
+    0x11e895f9, 0x11e897cd, 0x11e89a49, 0x11e8a979, 0x11e8a9f9, 0x11e8ab4d, 0x11e8adc9, 0x11e8ae49,
+    0x11e8b77a, 0x11e8b8f9, 0x11e90f4d, 0x11e913c9, 0x11e922cd, 0x11e92a79, 0x11e92bf9, 0x11e930fe,
+    0x11e9327e, 0x11e952f9, 0x11e95479, 0x11e95979, 0x11e95af9, 0x11e96679, 0x11e966f9, 0x11e96879,
+    0x11e96cf9, 0x11e997bd, 0x11e9c7be, 0x11e9d0be, 0x11e9db3e, 0x11e9de3e, 0x11e9e43e, 0x11ea0609,
+    0x11ea0cbd, 0x11ea6fd1, 0x11ea7bf9, 0x11ea8049, 0x11ea8b7e, 0x11ea98fe, 0x11eabf7a, 0x11eac0f9,
+    0x11eac179, 0x11eac5fa, 0x11eac77d, 0x11ead2fa, 0x11ead37a, 0x11ead4f9, 0x11ead97a, 0x11eaf68d,
+    0x11eaffbd, 0x11eb38f9, 0x11eb3a79, 0x11eb3afe, 0x11eb3f7e, 0x11eb40fe, 0x11eb4c79, 0x11eb4cfe,
+    0x11eb4e7e, 0x11eb52fe, 0x11eb74f9, 0x11eb7579, 0x11eb76f9, 0x11eb7b7d, 0x11ec2b19, 0x11ee3a11,
+    0x11eee47e, 0x11ef04fa, 0x11ef0679, 0x11ef0b7a, 0x11ef0cf9, 0x11ef18fa, 0x11ef1a79, 0x11ef1efa,
+    0x11ef3311, 0x11ef7e79, 0x11ef7ff9, 0x11ef84fe, 0x11ef867e, 0x11ef927e, 0x11ef93fe, 0x11ef987e,
+    0x11efba79, 0x11efbaf9, 0x11efbc79, 0x11efc0f9, 0x11f0eafa, 0x11f0ec79, 0x11f0fefa, 0x11f1007e,
+    0x11f104fa, 0x11f126fa, 0x11f1277a, 0x11f128f9, 0x11f12d7a, 0x11f1a079, 0x11f1a0fe, 0x11f1a27e,
+    0x11f3213a, 0x11f327ba, 0x11f349ba, 0x11f3c53e, 0x11f48da1, 0x11f4b619, 0x11f5ab15, 0x11f71c3a,
+    0x11f73eba, 0x11f74c3a, 0x11f8d319, 0x11f8fb99, 0x11f93fba, 0x11f9f095, 0x11fa2cbe, 0x11fab915,
+    0x11fbacfa, 0x11fbae79, 0x11fbb37a, 0x11fbb4fe, 0x11fbd6f9, 0x11fbdd79, 0x11fbe8fa, 0x11fbeaf9,
+    0x11fbef7a, 0x11fc4ef9, 0x11fc5079, 0x11fc50fe, 0x11fc6279, 0x11fc62fe, 0x11fc647e, 0x11fc8af9,
+    0x11fc8cf9, 0x11fdbb7a, 0x11fdbcf9, 0x11fdbd7e, 0x11fdc1fa, 0x11fdcefa, 0x11fdcf7a, 0x11fdd0fe,
+    0x11fdd57a, 0x11fdf77a, 0x11fdf979, 0x11fdfdfa, 0x11fe70f9, 0x11fe717e, 0x11fe72fe, 0x11ff271a,
+    0x11ff27be, 0x11ff293e, 0x11ff2dbe, 0x11ffa73a, 0x11ffe19e, 0x1200f7c6, 0x120109d6, 0x12010d1a,
+    0x12010d96, 0x12010f16, 0x1201139a, 0x1201363e, 0x12013c3e, 0x1201481a, 0x12014b1a, 0x12015d06,
+    0x1201840a, 0x1201b5ba, 0x1201eb12, 0x1201ec12, 0x120214fa, 0x1202167e, 0x12021afa, 0x12023cfa,
+    0x12023ef9, 0x1202437a, 0x1202770a, 0x1202a106, 0x1202b33e, 0x1202b679, 0x1202b6fe, 0x1202b87e,
+    0x1203df0e, 0x120422fa, 0x1204237a, 0x120424fe, 0x1204297a, 0x1205500a, 0x12058f59, 0x12058fd9,
+    0x12059159, 0x12060ad5, 0x12060f55, 0x12075e8a, 0x12077205, 0x12077555, 0x120775d5, 0x12077755,
+    0x12077bd5, 0x12079e51, 0x1207ec4a, 0x1207edc6, 0x12081951, 0x12081dd1, 0x120829d6, 0x12082cd6,
+    0x12087d21, 0x12087ea1, 0x12088321, 0x1208a721, 0x1208aba1, 0x1208df4a, 0x12091ea1, 0x12091f21,
+    0x120920b9, 0x12092525, 0x120a8b21, 0x120a8ba1, 0x120a8d21, 0x120a91bd, 0x120bb785, 0x120bbad5,
+    0x120bbb55, 0x120bbcd9, 0x120bc15d, 0x120bf549, 0x120bf5c9, 0x120c31ca, 0x120c7245, 0x120cae9e,
+    0x120cb01e, 0x120cb09e, 0x120cb51e, 0x120cb69e, 0x120cc21d, 0x120cc29d, 0x120cc41d, 0x120cc89d,
+    0x120ceb25, 0x120cec9d, 0x120cf11d, 0x120d24ca, 0x120d641d, 0x120d649d, 0x120de1c9, 0x120de345,
+    0x120e1c9a, 0x120e219a, 0x120e2e99, 0x120e2f19, 0x120e3099, 0x120e3519, 0x120e57a5, 0x120e5d99,
+    0x120e9c96, 0x120eaa15, 0x120f4a95, 0x120f50a5, 0x120ffdca, 0x12103d19, 0x12103d99, 0x12103f19,
+    0x1210b715, 0x1210b895, 0x1210ee8d, 0x1213161e, 0x1213169e, 0x1213181e, 0x12131c9e, 0x1214434a,
+    0x1214829a, 0x1214831a, 0x1214849a, 0x1214891a, 0x1214fe16, 0x12150296, 0x12152512, 0x12152b12,
+    0x1219871e, 0x1219bb9d, 0x121a3b1d, 0x121af39a, 0x121aff21, 0x121b2819, 0x121bdc09, 0x121c2115,
+    0x121ef7dd, 0x121f3119, 0x121f3319, 0x121f3799, 0x121f4499, 0x121f4519, 0x121f4b1d, 0x121f6d99,
+    0x121f6f19, 0x121f739d, 0x121fb295, 0x121feb9e, 0x121fee9e, 0x1220669d, 0x12211d95, 0x12211f15,
+    0x12212a95, 0x12216b89, 0x12219409, 0x12221e79, 0x12221ff9, 0x12222079, 0x122224f9, 0x12222679,
+    0x122248f9, 0x12224d79, 0x12224ef9, 0x12225af9, 0x12225c79, 0x122260f9, 0x12228709, 0x12228885,
+    0x1222c079, 0x1222c6f9, 0x1222c879, 0x1222d3f9, 0x1222d479, 0x1222da79, 0x1222fcf9, 0x122302f9,
+    0x12233995, 0x12233b19, 0x12236f8d, 0x12237389, 0x12237409, 0x1223ea8d, 0x1224268d, 0x12242cf9,
+    0x12242e79, 0x12242ef9, 0x1224337d, 0x122434fd, 0x12244079, 0x122440f9, 0x12244279, 0x12246979,
+    0x12246af9, 0x1224e279, 0x1224e2f9, 0x12259899, 0x12259919, 0x12259a99, 0x12259f19, 0x12261895,
+    0x1226531e, 0x12276946, 0x12277b45, 0x12277e95, 0x12277f15, 0x12278095, 0x12278515, 0x1227a791,
+    0x1227f58a, 0x12282711, 0x12283316, 0x12283616, 0x12288679, 0x122887f9, 0x12288c79, 0x1228aef9,
+    0x1228b079, 0x1228b4f9, 0x1228e88a, 0x122927f9, 0x12292879, 0x122929f9, 0x12292e79, 0x122a9479,
+    0x122a94f9, 0x122a9679, 0x122a9afd, 0x122cb71e, 0x122cb79e, 0x122cb91e, 0x122cbd9e, 0x122de44a,
+    0x122e239a, 0x122e241a, 0x122e259a, 0x122e2a1a, 0x122e9f16, 0x122ea396, 0x122ec612, 0x122ecc12,
+    0x123229ca, 0x12326919, 0x12326999, 0x12326b19, 0x1232e495, 0x1232e915, 0x1233239e, 0x1233d30a,
+    0x12344bc5, 0x12344f15, 0x12344f95, 0x12345115, 0x12345599, 0x12347811, 0x1234c60a, 0x1234f791,
+    0x12350996, 0x12350b16, 0x12355679, 0x123556f9, 0x12355879, 0x12355cf9, 0x123580f9, 0x12358579,
+    0x1235b90a, 0x1235f879, 0x1235f8f9, 0x1235fa79, 0x123764f9, 0x12376579, 0x123766f9, 0x12376b7d,
+    0x14f2e69d, 0x14f2eb11, 0x14f2ec91, 0x14f2ed11, 0x14f2fd0a, 0x14f30006, 0x14f30d9d, 0x14f31109,
+    0x14f31205, 0x14f31405, 0x14f3258a, 0x14f34bdd, 0x14f35059, 0x14f351e5, 0x14f35269, 0x14f3745d,
+    0x14f378d9, 0x14f37a59, 0x14f387d9, 0x14f38859, 0x14f38c59, 0x14f38cd9, 0x14f38e59, 0x14f39f0a,
+    0x14f3c605, 0x14f3c9e9, 0x14f3cb55, 0x14f3cbd5, 0x14f4044a, 0x14f53655, 0x14f537d5, 0x14f53855,
+    0x14f567ce, 0x14f5ea4a, 0x14f66629, 0x14f667a1, 0x14f66821, 0x14f6dfa1, 0x14f6e125, 0x14f6e1a9,
+    0x14f70821, 0x14f709a1, 0x14f70a21, 0x14f7173d, 0x14f717bd, 0x14f71ba1, 0x14f71c21, 0x14f71da1,
+    0x14f72d89, 0x14f72e11, 0x14f74055, 0x14f744d5, 0x14f74655, 0x14f746e1, 0x14f753d5, 0x14f75455,
+    0x14f75855, 0x14f758d5, 0x14f75a55, 0x14f768d1, 0x14f76985, 0x14f76d51, 0x14f76ee5, 0x14f76f69,
+    0x14f77f4a, 0x14f78246, 0x14f78fc5, 0x14f79369, 0x14f79445, 0x14f7a4d1, 0x14f7a9d1, 0x14f7e265,
+    0x14f7e851, 0x14f7e8d1, 0x14f7fbc6, 0x14f80965, 0x14f80c49, 0x14f80cc9, 0x14f80fc5, 0x14f8214a,
+    0x14f847a5, 0x14f84c29, 0x14f84da5, 0x14f84e29, 0x14f85dc9, 0x14f87025, 0x14f874a9, 0x14f87621,
+    0x14f876a1, 0x14f883a5, 0x14f88425, 0x14f88829, 0x14f888a9, 0x14f88a21, 0x14f8e9a1, 0x14f8ee21,
+    0x14f8efa5, 0x14f8fba1, 0x14f8fd25, 0x14f8fda9, 0x14f901a5, 0x14f90229, 0x14f92421, 0x14f925a1,
+    0x14f92621, 0x14f92a21, 0x14f92aa1, 0x14f97bd9, 0x14f97d55, 0x14f97dd5, 0x14f9ced1, 0x14f9ef59,
+    0x14fa2fca, 0x14fa32c6, 0x14faad1d, 0x14faad9d, 0x14fabb5d, 0x14fabfd1, 0x14fae6c5, 0x14fb209d,
+    0x14fb251d, 0x14fb491d, 0x14fb4d9d, 0x14fb4f1d, 0x14fb5c9e, 0x14fb5d1e, 0x14fb611e, 0x14fb619e,
+    0x14fb631e, 0x14fc1819, 0x14fc1999, 0x14fc1a19, 0x14fd0b15, 0x14fd0c95, 0x14fd0d15, 0x14fd5c11,
+    0x14fd5d91, 0x14fd5e11, 0x14fd7ebd, 0x14fd9459, 0x14fd98d9, 0x14fd9a55, 0x14fdb855, 0x14fdbb55,
+    0x14fdbed5, 0x14fdd34a, 0x14fdd646, 0x14fdf999, 0x14fdfe19, 0x14fe2219, 0x14fe2699, 0x14fe2819,
+    0x14fe341a, 0x14fe359a, 0x14fe361a, 0x14fe3a1a, 0x14fe3a9a, 0x14fe3c1a, 0x14fe4fc6, 0x14fe7915,
+    0x14fe7995, 0x14feca11, 0x14feca91, 0x14fee825, 0x14feeb25, 0x14feee09, 0x14feee89, 0x14fefc49,
+    0x14feff45, 0x14ff02d1, 0x14ff1515, 0x14ff1995, 0x14ff1b15, 0x14ff2716, 0x14ff2896, 0x14ff2916,
+    0x14ff2d16, 0x14ff2d96, 0x14ff2f16, 0x14ff3d91, 0x14ff4211, 0x14ff6829, 0x14ff7812, 0x14ff7992,
+    0x14ff7a12, 0x14ff7e12, 0x14ff7e92, 0x14ffcb5d, 0x14ffcfd5, 0x14ffd155, 0x14ffd1d5, 0x14ffdf5d,
+    0x14ffe355, 0x14ffe3d5, 0x14ffe555, 0x14fff851, 0x14fff9e5, 0x15001f45, 0x15002fdd, 0x150071e9,
+    0x15007351, 0x150083ca, 0x150086c6, 0x15009749, 0x150098e9, 0x1500ac4a, 0x1500d345, 0x1500d729,
+    0x1500d8a5, 0x1500d929, 0x1500ffa9, 0x1501011d, 0x1501019d, 0x15011329, 0x150113a9, 0x1501151d,
+    0x15014855, 0x1501749d, 0x1501791d, 0x15017aa5, 0x15017b29, 0x1501869d, 0x15018ca5, 0x15018d29,
+    0x1501af1d, 0x1501b09d, 0x1501b11d, 0x1501b51d, 0x1501b59d, 0x1501c29e, 0x1501c31e, 0x1501c49e,
+    0x1501c91e, 0x1501de51, 0x1501dfd1, 0x1501f04a, 0x1501facd, 0x1501fb4d, 0x15020449, 0x15020545,
+    0x150218ca, 0x15024399, 0x15024525, 0x150245a9, 0x15024a4d, 0x15026c19, 0x15026d99, 0x15026e19,
+    0x15027f99, 0x15028019, 0x15028199, 0x1502924a, 0x1502b945, 0x1502bd29, 0x1502be95, 0x1502bf15,
+    0x1502f78a, 0x15030e29, 0x1503200a, 0x15032306, 0x15032b0d, 0x15033389, 0x15033409, 0x15035f15,
+    0x15036095, 0x15036115, 0x15037295, 0x15037315, 0x15037495, 0x1503908e, 0x1503998a, 0x1503e4bd,
+    0x15040f45, 0x15044d99, 0x15045219, 0x150453a5, 0x15045429, 0x150461a9, 0x15048819, 0x15048999,
+    0x15048a19, 0x15048e19, 0x15048e99, 0x15049c1a, 0x15049d9a, 0x1504a21a, 0x1504c725, 0x1504cd15,
+    0x1504cd95, 0x1504db25, 0x1504e115, 0x1504fd0e, 0x1505060a, 0x15050906, 0x15052ba5, 0x15054289,
+    0x15057c95, 0x15057d15, 0x15058115, 0x15058195, 0x15064c59, 0x15064dd5, 0x15064e55, 0x150686ca,
+    0x150689c6, 0x1507004a, 0x15077d9d, 0x15077e1d, 0x15078bdd, 0x15079051, 0x1507b2d5, 0x1507f11d,
+    0x1507f59d, 0x1508199d, 0x15081e1d, 0x15081f9d, 0x15082d1e, 0x15082d9e, 0x1508319e, 0x1508321e,
+    0x1508339e, 0x1508e899, 0x1508ea19, 0x1508ea99, 0x1509db95, 0x1509dd15, 0x1509dd95, 0x150a4f3d,
+    0x150a64d9, 0x150a6ad5, 0x150a6b61, 0x150a8bd9, 0x150a8f55, 0x150a9055, 0x150aa3ca, 0x150aca19,
+    0x150ace99, 0x150af299, 0x150af719, 0x150af899, 0x150b061a, 0x150b069a, 0x150b0a9a, 0x150b0b1a,
+    0x150b0c9a, 0x150b2046, 0x150b4445, 0x150b4829, 0x150b4995, 0x150b4a15, 0x150b828a, 0x150b9a91,
+    0x150b9b11, 0x150bbe89, 0x150bbf09, 0x150bc029, 0x150bd445, 0x150be595, 0x150bea15, 0x150beb95,
+    0x150bf916, 0x150bf996, 0x150bfd96, 0x150bfe16, 0x150c0e11, 0x150c1291, 0x150c3505, 0x150c4a12,
+    0x150d2fa9, 0x150d3029, 0x150e2129, 0x150e949e, 0x1510bd69, 0x1510bee9, 0x1510bf69, 0x15114ca9,
+    0x15116a9a, 0x15116d9a, 0x1511711a, 0x1511721a, 0x1511ae0a, 0x15122b69, 0x15122be9, 0x151239a9,
+    0x15123e29, 0x15125d96, 0x15126096, 0x15126416, 0x15129ee9, 0x1512a369, 0x1512b612, 0x1512c769,
+    0x1512cbe9, 0x1512cd69, 0x1512f451, 0x1512f5d5, 0x151319d5, 0x15131b45, 0x15135999, 0x15135ba9,
+    0x15138219, 0x15138399, 0x15138419, 0x15139599, 0x15139619, 0x15139799, 0x1513a84a, 0x1513cf45,
+    0x1513d329, 0x1513d495, 0x1513d515, 0x15140d8a, 0x15142591, 0x15144989, 0x15144a09, 0x151457dd,
+    0x1514709d, 0x15147ed5, 0x15148295, 0x15148415, 0x15148495, 0x1514991d, 0x1514bd1d, 0x1514d391,
+    0x1514d511, 0x1514e59d, 0x1514e89d, 0x1514f91e, 0x1514f99e, 0x1514fa9e, 0x15153f95, 0x15154115,
+    0x15154195, 0x15157a0a, 0x15159091, 0x15159211, 0x1515b609, 0x1515b689, 0x1515f38a, 0x1516448a,
+    0x15166f69, 0x151670e9, 0x15167169, 0x15169e8d, 0x1516e8e9, 0x1516eae9, 0x1516ef8d, 0x15171169,
+    0x151712e9, 0x15171369, 0x15171b3d, 0x15171efd, 0x1517207d, 0x151720fd, 0x151724e9, 0x15172569,
+    0x151726e9, 0x15174999, 0x15174e15, 0x15174f95, 0x15175015, 0x15175d99, 0x15176215, 0x15176395,
+    0x151778a9, 0x1517ae19, 0x1517f211, 0x15181905, 0x15185569, 0x15185769, 0x15187de9, 0x15187f69,
+    0x15187fe9, 0x15189169, 0x151891e9, 0x15189369, 0x15189f91, 0x1518b189, 0x1518b485, 0x1518da09,
+    0x1518f2e9, 0x1518f769, 0x1518f969, 0x151904e9, 0x151906e9, 0x15190b69, 0x15192d69, 0x15192ee9,
+    0x15192f69, 0x15193369, 0x151933e9, 0x151a799d, 0x151b1b9d, 0x151b291d, 0x151b2d9d, 0x151be619,
+    0x151c08b6, 0x151c1cb6, 0x151caab6, 0x151d6536, 0x151df499, 0x151e0699, 0x151e6815, 0x151e7b95,
+    0x151e7c15, 0x151e9091, 0x151e9691, 0x151eb785, 0x151eba89, 0x151ecc91, 0x151ecd36, 0x151f4611,
+    0x15202a19, 0x15202b99, 0x15202c29, 0x152052b6, 0x15205419, 0x15206619, 0x152066b6, 0x1520a3a9,
+    0x15225cb6, 0x15227d8d, 0x15227e36, 0x15233b76, 0x15233ff6, 0x15234169, 0x152341f6, 0x1523b969,
+    0x1523bae9, 0x1523bb69, 0x1523dd76, 0x1523e1f6, 0x1523e369, 0x1523f176, 0x1523f569, 0x1523f5f6,
+    0x1523f769, 0x15242c16, 0x15244891, 0x15246689, 0x1524bc11, 0x1524c0a9, 0x1524e009, 0x1524e305,
+    0x15252169, 0x152525e9, 0x15252769, 0x152527e9, 0x152549f6, 0x15254e76, 0x15254fe9, 0x15255bf6,
+    0x15255d69, 0x15255df6, 0x152561e9, 0x15256276, 0x152563e9, 0x1525c369, 0x1525c7e9, 0x1525c969,
+    0x1525d569, 0x1525d6e9, 0x1525d769, 0x1525db69, 0x1525dbe9, 0x1525dd69, 0x1525fdf6, 0x1525ff69,
+    0x152603e9, 0x15267e19, 0x15267f99, 0x15268029, 0x15269199, 0x15269229, 0x152693a9, 0x1526ba19,
+    0x1526bab6, 0x1526ce19, 0x15272191, 0x15274589, 0x1528694d, 0x15287795, 0x15288e11, 0x1528a78d,
+    0x1528a90d, 0x1528b385, 0x1528c2b6, 0x1528d036, 0x1528d18d, 0x1528d236, 0x1528d4b6, 0x1528e38d,
+    0x1528e436, 0x1528e58d, 0x1528e8b6, 0x1529228d, 0x15292d29, 0x15296b69, 0x15296ce9, 0x15296d69,
+    0x152976b6, 0x15298f76, 0x152993f6, 0x15299569, 0x152995f6, 0x1529a376, 0x1529a769, 0x1529a7f6,
+    0x1529a969, 0x152a0d69, 0x152a0ee9, 0x152a0f69, 0x152a20e9, 0x152a2169, 0x152a22e9, 0x152a4376,
+    0x152a4576, 0x152a4969, 0x152a49f6, 0x152a4b69, 0x152a5776, 0x152a5d69, 0x152acea9, 0x152b3705,
+    0x152b4929, 0x152b7569, 0x152b79e9, 0x152b7b69, 0x152b7be9, 0x152b8769, 0x152b88e9, 0x152b8969,
+    0x152b8d69, 0x152b8f69, 0x152bb169, 0x152bb1f6, 0x152bb5e9, 0x152bb676, 0x152bb7e9, 0x152bc369,
+    0x152bc569, 0x152bc9e9, 0x152c2969, 0x152c2ae9, 0x152c2b69, 0x152c2f69, 0x152c2fe9, 0x152c3d69,
+    0x152c3ee9, 0x152c4369, 0x152c6769, 0x152cbdd9, 0x152cbf55, 0x152cbfd5, 0x152d10d1, 0x152d71ca,
+    0x152d74c6, 0x152def1d, 0x152def9d, 0x152dfd5d, 0x152e01d1, 0x152e28c5, 0x152e629d, 0x152e671d,
+    0x152e8b1d, 0x152e8f9d, 0x152e911d, 0x152e9e9e, 0x152e9f1e, 0x152ea31e, 0x152ea39e, 0x152ea51e,
+    0x152f5a19, 0x152f5b99, 0x152f5c19, 0x15304d15, 0x15304e95, 0x15304f15, 0x1530d659, 0x1530dc55,
+    0x1530fd55, 0x15310055, 0x153100d5, 0x1531154a, 0x15313b99, 0x15313c45, 0x15314019, 0x153151d1,
+    0x15316419, 0x15316899, 0x15316a19, 0x1531779a, 0x1531781a, 0x15317c1a, 0x15317c9a, 0x15317e1a,
+    0x1531bb15, 0x1531bb95, 0x1531f40a, 0x1531f706, 0x15320c11, 0x15320c91, 0x15322d25, 0x15323009,
+    0x15323089, 0x15323385, 0x15325715, 0x15325b95, 0x15325d15, 0x15326a96, 0x15326b16, 0x15326f16,
+    0x15326f96, 0x15327f91, 0x15328411, 0x1532ab05, 0x1532c092, 0x1533a125, 0x1533a1a5, 0x153492a5,
+    0x1534df25, 0x1535061e, 0x15372ee5, 0x15373065, 0x153730e5, 0x15376d25, 0x1537a60a, 0x1537be25,
+    0x1537dc1a, 0x1537df1a, 0x1537e21a, 0x1537e29a, 0x15389ce5, 0x15389d65, 0x1538ab25, 0x1538afa5,
+    0x1538cf16, 0x1538d216, 0x1538d596, 0x1538d696, 0x15391065, 0x153914e5, 0x153938e5, 0x15393d65,
+    0x15393ee5, 0x1539615d, 0x153965d9, 0x15396751, 0x1539c69d, 0x1539cb19, 0x1539cca5, 0x1539ef1d,
+    0x1539f399, 0x1539f519, 0x1539f599, 0x153a0319, 0x153a0719, 0x153a0799, 0x153a0919, 0x153a4615,
+    0x153a4695, 0x153a7f0a, 0x153a8206, 0x153ae695, 0x153af415, 0x153afa15, 0x153b0f11, 0x153b3605,
+    0x153b4511, 0x153b6c1e, 0x153bb119, 0x153bb295, 0x153bb315, 0x153be28e, 0x153c0219, 0x153c1e8d,
+    0x153c1f0d, 0x153c2809, 0x153c650a, 0x153c6806, 0x153cad0e, 0x153ce265, 0x153ce2e5, 0x153cf511,
+    0x153d100d, 0x153d1c05, 0x153d5a65, 0x153d5be5, 0x153d610d, 0x153d82e5, 0x153d8465, 0x153d84e5,
+    0x153d907d, 0x153d927d, 0x153d9665, 0x153d96e5, 0x153d9865, 0x153dbb15, 0x153dc115, 0x153dc195,
+    0x153dcf15, 0x153dd515, 0x153de391, 0x153e1f91, 0x153e3689, 0x153e5d25, 0x153ec265, 0x153ec865,
+    0x153eeae5, 0x153ef0e5, 0x153ef165, 0x153efe65, 0x153efee5, 0x153f04e5, 0x153f6465, 0x153f68e5,
+    0x153f6a65, 0x153f7665, 0x153f77e5, 0x153f7c65, 0x153f9ee5, 0x153fa065, 0x153fa0e5, 0x153fa4e5,
+    0x153fa565, 0x154071a1, 0x15407221, 0x15416321, 0x1541d69e, 0x1543ff61, 0x154400e1, 0x15440161,
+    0x1544768a, 0x15448ea1, 0x1544af9a, 0x1544b29a, 0x1544b31a, 0x1544b41a, 0x1544f00a, 0x1544f306,
+    0x15456d61, 0x15456de1, 0x15457ba1, 0x15458021, 0x1545a296, 0x1545a716, 0x1545e0e1, 0x1545e561,
+    0x15460961, 0x15460de1, 0x15460f61, 0x154cc719, 0x154cc895, 0x154cc915, 0x154d018a, 0x154d1991,
+    0x154d3d89, 0x154d7b0a, 0x154d7e06, 0x154df85d, 0x154df8dd, 0x154e069d, 0x154e0b11, 0x154e2a95,
+    0x154e2d95, 0x154e3205, 0x154e6bdd, 0x154e705d, 0x154e945d, 0x154e98dd, 0x154e9a5d, 0x154e9add,
+    0x154ea29e, 0x154ea65e, 0x154ea7de, 0x154ea85e, 0x154eac5e, 0x154eacde, 0x154eae5e, 0x154f6359,
+    0x154f64d9, 0x154f6559, 0x15505655, 0x155057d5, 0x15505855, 0x1550a751, 0x1550a8d1, 0x1550a951,
+    0x1550c24d, 0x1550c6fd, 0x1550c9fd, 0x1550df99, 0x1550e595, 0x1550e615, 0x15510699, 0x155144d9,
+    0x15514959, 0x15516d59, 0x155171d9, 0x15517359, 0x155173d9, 0x155180da, 0x1551815a, 0x1551855a,
+    0x155185da, 0x1551875a, 0x1551c455, 0x1551c4d5, 0x15521551, 0x155215d1, 0x15523cc5, 0x15524789,
+    0x15524f05, 0x15526055, 0x155264d5, 0x15526655, 0x155266d5, 0x15527256, 0x155273d6, 0x15527456,
+    0x15527856, 0x155278d6, 0x155288d1, 0x15528d51, 0x1552acc9, 0x1552afc5, 0x1552c4d2, 0x1552c552,
+    0x1552c9d2, 0x1552d549, 0x1552d845, 0x15536d99, 0x155396b6, 0x15567d76, 0x15568361, 0x155683f6,
+    0x1556fce1, 0x15571f76, 0x155723f6, 0x15572561, 0x155725f6, 0x15573376, 0x155737f6, 0x15573961,
+    0x15578a91, 0x1557ae89, 0x1557d7b6, 0x1557fe11, 0x15582505, 0x15586361, 0x15586961, 0x15588bf6,
+    0x155891e1, 0x15589276, 0x15589f61, 0x15589ff6, 0x1558a5e1, 0x15590561, 0x155909e1, 0x15590b61,
+    0x15591761, 0x155918e1, 0x15591d61, 0x15593ff6, 0x15594161, 0x155941f6, 0x155945e1, 0x15594676,
+    0x15599799, 0x15599915, 0x15599995, 0x1559eab6, 0x155ac8dd, 0x155ac976, 0x155ad715, 0x155adb91,
+    0x155b0196, 0x155b0285, 0x155b3c5d, 0x155b40dd, 0x155b425d, 0x155b64f6, 0x155b6976, 0x155b6add,
+    0x155b785e, 0x155b7cde, 0x155b7d5e, 0x155b7ede, 0x155c2f76, 0x155c33f6, 0x155c3559, 0x155c35f6,
+    0x155d26d5, 0x155d2855, 0x155d28d5, 0x155d7376, 0x155d77f6, 0x155d7951, 0x155d79f6, 0x155d9df6,
+    0x155db011, 0x155db499, 0x155db611, 0x155dd416, 0x155dd705, 0x155e1559, 0x155e19d9, 0x155e1b59,
+    0x155e3df6, 0x155e4276, 0x155e43d9, 0x155e4fda, 0x155e515a, 0x155e51da, 0x155e55da, 0x155e565a,
+    0x155e688a, 0x155e6b86, 0x155e8ed5, 0x155e94d5, 0x155e9555, 0x155edff6, 0x155ee5d1, 0x155ee676,
+    0x155f03f6, 0x155f06c5, 0x155f1816, 0x155f1b05, 0x155f1e91, 0x155f1f85, 0x155f30d5, 0x155f3555,
+    0x155f36d5, 0x155f42d6, 0x155f4456, 0x155f44d6, 0x155f48d6, 0x155f4956, 0x155f5951, 0x155f5dd1,
+    0x155f5f51, 0x155f7d49, 0x155f83fd, 0x155f93d2, 0x155f9552, 0x155f95d2, 0x155f9a52, 0x155fa5f6,
+    0x155fa9f6, 0x155fae76, 0x155fed95, 0x15601591, 0x1560f45d, 0x15611cdd, 0x15611d76, 0x156130dd,
+    0x1561905d, 0x156194dd, 0x1561965d, 0x1561a85d, 0x1561cc5d, 0x1561ccf6, 0x1561d0dd, 0x1561d176,
+    0x1561e4de, 0x15622119, 0x15625f59, 0x156260d9, 0x15628376, 0x15628959, 0x156289f6, 0x15629776,
+    0x15629b59, 0x15629d59, 0x1562cc05, 0x1562d47d, 0x1562da55, 0x15630a4e, 0x15632576, 0x1563464d,
+    0x156346f6, 0x15637cd5, 0x1563800d, 0x15638e55, 0x1563be4d, 0x1563ca45, 0x1563d976, 0x1563e6f6,
+    0x1563fa4d, 0x1563faf6, 0x1564007d, 0x15646959, 0x15646f59, 0x1564a559, 0x1564a5f6, 0x1564e2d5,
+    0x1564e955, 0x1564f655, 0x1564f6d5, 0x15650b51, 0x156518ce, 0x15653245, 0x15654751, 0x156598d5,
+    0x15659d55, 0x1566f5d1, 0x15671cc5, 0x15675b1d, 0x15675d1d, 0x156783be, 0x1567973e, 0x1567979d,
+    0x156812a5, 0x156834be, 0x1568c999, 0x15694115, 0x1569923e, 0x156ad821, 0x156aea19, 0x156aeba5,
+    0x156b4f95, 0x156b6315, 0x156b6395, 0x156b7811, 0x156b7a11, 0x156b9e09, 0x156b9f05, 0x156bb43e,
+    0x156bb491, 0x156d0ea5, 0x156d0f19, 0x156d8695, 0x157022fe, 0x1570247e, 0x157024e5, 0x15709c65,
+    0x15709de5, 0x15709e65, 0x1570c67e, 0x1570d87e, 0x1570da65, 0x15712ba5, 0x15712c11, 0x15715009,
+    0x15719f25, 0x1571a391, 0x1571c625, 0x15720465, 0x157208e5, 0x15720a65, 0x15720ae5, 0x15722cfe,
+    0x1572317e, 0x157232fe, 0x1572407e, 0x157240e5, 0x157244fe, 0x15724565, 0x157246e5, 0x15729411,
+    0x1572a665, 0x1572aae5, 0x1572ac65, 0x1572b865, 0x1572b9e5, 0x1572ba65, 0x1572be65, 0x1572bee5,
+    0x1572c065, 0x1572e0fe, 0x1572e27e, 0x1572e6fe, 0x15736319, 0x157376a5, 0x1573da95, 0x1573ee15,
+    0x1573ee95, 0x15740311, 0x15742a05, 0x1575e911, 0x15761005, 0x15764e65, 0x15764fe5, 0x15765065,
+    0x1576553e, 0x157676fe, 0x1576787e, 0x157678e5, 0x15768a7e, 0x15768ae5, 0x15768c65, 0x1576f065,
+    0x1576f1e5, 0x1576f265, 0x15770465, 0x157705e5, 0x15772c7e, 0x15774065, 0x15785865, 0x15785ce5,
+    0x15785e65, 0x15785ee5, 0x15786c65, 0x15787065, 0x157870e5, 0x15787265, 0x157892fe, 0x1578947e,
+    0x157894e5, 0x157898fe, 0x15789965, 0x15789ae5, 0x1578a6e5, 0x1578a865, 0x1578ace5, 0x15790c65,
+    0x15790de5, 0x15790e65, 0x15791265, 0x157912e5, 0x15792065, 0x157921e5, 0x15792665, 0x1579df99,
+    0x157a5715, 0x157b0816, 0x157cf37e, 0x157cf4fe, 0x157cf561, 0x157d6ce1, 0x157d6ee1, 0x157d957e,
+    0x157d96fe, 0x157d9761, 0x157da47e, 0x157da8fe, 0x157da961, 0x157daae1, 0x157dd421, 0x157dfc91,
+    0x157e2089, 0x157e7411, 0x157e9b05, 0x157ed961, 0x157edb61, 0x157f01fe, 0x157f037e, 0x157f03e1,
+    0x157f157e, 0x157f15e1, 0x157f1761, 0x157f76e1, 0x157f7b61, 0x157f7d61, 0x157f88e1, 0x157f8ae1,
+    0x157f8f61, 0x157fb17e, 0x157fb2fe, 0x157fb361, 0x157fb77e, 0x157fb7e1, 0x15800915, 0x15800a95,
+    0x15800b15, 0x1580438a, 0x15804686, 0x15805c11, 0x158138fe, 0x15813a7e, 0x15813add, 0x1581489d,
+    0x15814d11, 0x15817416, 0x1581addd, 0x1581b25d, 0x1581b45d, 0x1581d67e, 0x1581dafe, 0x1581dc7e,
+    0x1581e9de, 0x1581ea5e, 0x1581ee5e, 0x1581eede, 0x1581f05e, 0x1582a57e, 0x1582a6fe, 0x1582a759,
+    0x15839855, 0x158399d5, 0x15839a55, 0x1583e97e, 0x1583eafe, 0x1583eb51, 0x1584107e, 0x15842199,
+    0x15842611, 0x15842795, 0x15842811, 0x15844899, 0x158486d9, 0x15848b59, 0x15848d59, 0x1584af7e,
+    0x1584b3fe, 0x1584b57e, 0x1584c2da, 0x1584c35a, 0x1584c75a, 0x1584c7da, 0x1584c95a, 0x1584dd06,
+    0x158504d5, 0x15850655, 0x158506d5, 0x158555fe, 0x1585577e, 0x158557d1, 0x15857cfe, 0x15858996,
+    0x15858c96, 0x15859011, 0x15859116, 0x1585a255, 0x1585a6d5, 0x1585a855, 0x1585b5d6, 0x1585b656,
+    0x1585bad6, 0x1585bc56, 0x1585cad1, 0x1585cf51, 0x1585d151, 0x1585f1c5, 0x1585f549, 0x15860552,
+    0x158606d2, 0x15860752, 0x15860b52, 0x15860bd2, 0x1586177e, 0x15861a7e, 0x15861efe, 0x15865f15,
+    0x1586ff11, 0x15872605, 0x1587645d, 0x1587665d, 0x15878cfe, 0x15878edd, 0x1587a07e, 0x1587a0dd,
+    0x1587d596, 0x1588085d, 0x158813dd, 0x15881a5d, 0x15883dfe, 0x158842dd, 0x15884fde, 0x1588d2d9,
+    0x1588fb59, 0x15894a55, 0x15899b7e, 0x158a71fe, 0x158ae159, 0x158aeed9, 0x158b1bd9, 0x158b58d5,
+    0x158b5ad5, 0x158b6cd5, 0x158b8351, 0x158c0ed5, 0x158fef61, 0x158ff0e1, 0x158ff161, 0x159019f6,
+    0x15902bf6, 0x15909161, 0x159092e1, 0x15909361, 0x1590a561, 0x1590a6e1, 0x1590cf61, 0x1591f961,
+    0x1591fde1, 0x1591ff61, 0x1591ffe1, 0x15920b61, 0x15920ce1, 0x15920d61, 0x15921161, 0x159211e1,
+    0x15921361, 0x15923a76, 0x15923be1, 0x159247f6, 0x1592aee1, 0x1592af61, 0x1592b361, 0x1592b3e1,
+    0x1592c2e1, 0x1592eb61, 0x159434dd, 0x1594365d, 0x159436dd, 0x159470fe, 0x15947176, 0x1594ec5d,
+    0x1595a2d9, 0x1595a359, 0x15961ad6, 0x15966776, 0x1597b159, 0x1597c559, 0x15980c16, 0x15980f05,
+    0x159824d6, 0x15982956, 0x159836d6, 0x15983855, 0x159838d5, 0x15984d51, 0x159851d1, 0x15985351,
+    0x15987445, 0x159887f6, 0x159899f6, 0x159a8add, 0x159a9c5d, 0x159a9cdd, 0x159a9e5d, 0x159ac4fe,
+    0x159ac576, 0x159ad8dd, 0x159b0395, 0x159bf759, 0x159c04fd, 0x159c0959, 0x159c0ad9, 0x159c2cfe,
+    0x159c317e, 0x159c3efe, 0x159c740d, 0x159c7c7d, 0x159c8255, 0x159cb24d, 0x159cbe45, 0x159ccefe,
+    0x159cdaf6, 0x159cdc7e, 0x159cdf76, 0x159ce27e, 0x159cee7e, 0x159ceef6, 0x159cf2fe, 0x159d7775,
+    0x159e2559, 0x159e9e55, 0x159ec0cd, 0x159ed949, 0x159eda45, 0x159f3b8d, 0x159f7f75, 0x159f7ff5,
+    0x159f85f5, 0x159f9375, 0x159fbbf5, 0x15a20989, 0x15a20a11, 0x15a20d11, 0x15a21c55, 0x15a220d5,
+    0x15a22255, 0x15a234d5, 0x15a23655, 0x15a244d1, 0x15a24585, 0x15a24951, 0x15a24ae5, 0x15a25b4a,
+    0x15a26f69, 0x15a27269, 0x15a2be65, 0x15a2c451, 0x15a2c4d1, 0x15a2e8c9, 0x15a2ebc5, 0x15a2fd4a,
+    0x15a323a5, 0x15a32445, 0x15a32829, 0x15a329a5, 0x15a32a29, 0x15a34c25, 0x15a34cc5, 0x15a350a9,
+    0x15a35221, 0x15a352a1, 0x15a36025, 0x15a364a9, 0x15a36621, 0x15a373d1, 0x15a37451, 0x15a37851,
+    0x15a378d1, 0x15a37a51, 0x15a38ae1, 0x15a38cc1, 0x15a38de1, 0x15a3b445, 0x15a3c5a1, 0x15a3c645,
+    0x15a3ca21, 0x15a3cba5, 0x15a3d7a1, 0x15a3d925, 0x15a3d9a9, 0x15a3dda5, 0x15a3de29, 0x15a3dfb5,
+    0x15a40021, 0x15a401a1, 0x15a40221, 0x15a40621, 0x15a406a1, 0x15a40821, 0x15a41421, 0x15a42905,
+    0x15a42dbe, 0x15a43cd9, 0x15a43ee1, 0x15a45059, 0x15a450d9, 0x15a46559, 0x15a466e5, 0x15a46769,
+    0x15a46b7e, 0x15a46bfe, 0x15a47b41, 0x15a4e065, 0x15a4e0e5, 0x15a4e6fe, 0x15a51f7e, 0x15a51ffe,
+    0x15a522fe, 0x15a53225, 0x15a5383e, 0x15a56e25, 0x15a574be, 0x15a59651, 0x15a5e621, 0x15a5e7a5,
+    0x15a5ec3e, 0x15a5f9a5, 0x15a5fa29, 0x15a5fbb5, 0x15a62221, 0x15a622a1, 0x15a62421, 0x15a87051,
+    0x15a874d1, 0x15a87651, 0x15a876d1, 0x15a89ac9, 0x15a89dc5, 0x15a8af4a, 0x15a8b246, 0x15a8d599,
+    0x15a8da19, 0x15a8dba5, 0x15a8dc29, 0x15a8fe19, 0x15a90299, 0x15a90419, 0x15a91199, 0x15a91699,
+    0x15a91819, 0x15a92bc6, 0x15a94f25, 0x15a953a9, 0x15a95515, 0x15a95595, 0x15a98e0a, 0x15a99106,
+    0x15a99202, 0x15a9a025, 0x15a9a611, 0x15a9a691, 0x15a9b68a, 0x15a9b986, 0x15a9ba82, 0x15a9c725,
+    0x15a9cd85, 0x15a9f115, 0x15a9f595, 0x15a9f715, 0x15aa0495, 0x15aa0515, 0x15aa0915, 0x15aa0995,
+    0x15aa0b15, 0x15aa1991, 0x15aa1e11, 0x15aa1fa5, 0x15aa300a, 0x15aa3306, 0x15aa3402, 0x15aa5591,
+    0x15aa5611, 0x15aa5a11, 0x15aa5a91, 0x15aa5c11, 0x15aa90d9, 0x15aa92d1, 0x15aaa6c1, 0x15aae419,
+    0x15aaf619, 0x15aaf829, 0x15ab1e99, 0x15ab321a, 0x15ab329a, 0x15ab5da5, 0x15ab71a5, 0x15ab8625,
+    0x15abc225, 0x15ac1195, 0x15ac2516, 0x15ac2596, 0x15ac2716, 0x15ac3a11, 0x15ac3ba5, 0x15ac7612,
+    0x15ac7692, 0x15ac7812, 0x15af3da5, 0x15af43a5, 0x15afb725, 0x15b02185, 0x15b05d95, 0x15b05f15,
+    0x15b09825, 0x15b09b25, 0x15b14c25, 0x15b1c5a5, 0x15b27995, 0x15b540d9, 0x15b54551, 0x15b546d5,
+    0x15b54751, 0x15b56b49, 0x15b56e45, 0x15b57fca, 0x15b5a619, 0x15b5aa99, 0x15b5aca9, 0x15b5ce99,
+    0x15b5d319, 0x15b5d499, 0x15b5e719, 0x15b5e899, 0x15b62429, 0x15b62595, 0x15b62615, 0x15b65e8a,
+    0x15b66186, 0x15b66282, 0x15b67691, 0x15b6870a, 0x15b68a06, 0x15b68b02, 0x15b6c195, 0x15b6c615,
+    0x15b6c795, 0x15b6c821, 0x15b6d515, 0x15b6d595, 0x15b6d995, 0x15b6da15, 0x15b6db95, 0x15b6ea11,
+    0x15b6ee91, 0x15b7008a, 0x15b70386, 0x15b70482, 0x15b76359, 0x15b7677e, 0x15b767fe, 0x15b7a37e,
+    0x15b7b499, 0x15b81b7e, 0x15b81bfe, 0x15b81efe, 0x15b8577e, 0x15b85d3e, 0x15b8e215, 0x15b8e421,
+    0x15b8f596, 0x15b8f616, 0x15b8f796, 0x15b90a91, 0x15b90ca9, 0x15bbd199, 0x15bbd615, 0x15bbd795,
+    0x15bbd815, 0x15bc2891, 0x15bc4999, 0x15bd05e9, 0x15bd0769, 0x15bd07e9, 0x15bd1591, 0x15bd1a11,
+    0x15bd1b95, 0x15bd1c11, 0x15bd3c85, 0x15bd7ae9, 0x15bd7f69, 0x15bd8169, 0x15bda369, 0x15bda7e9,
+    0x15bda969, 0x15bdb6e9, 0x15bdb769, 0x15bdbb69, 0x15bdbbe9, 0x15bdbd69, 0x15bde019, 0x15bdf419,
+    0x15beedfe, 0x15bf29fe, 0x15bf3611, 0x15bf3811, 0x15bf8969, 0x15bf8dfe, 0x15bf9b69, 0x15bf9d69,
+    0x15bfa1fe, 0x15bfc3e9, 0x15bfc569, 0x15c33169, 0x15c33369, 0x15c359e9, 0x15c35b69, 0x15c35be9,
+    0x15c36de9, 0x15c36f69, 0x15c39409, 0x15c39705, 0x15c3cee9, 0x15c3d369, 0x15c3d569, 0x15c3e0e9,
+    0x15c3e2e9, 0x15c3e769, 0x15c40969, 0x15c40ae9, 0x15c40b69, 0x15c40f69, 0x15c40fe9, 0x15c41169,
+    0x15c41d69, 0x15c41ee9, 0x15c42369, 0x15c44819, 0x15c541fe, 0x15c57dfe, 0x15c5ef69, 0x15c5f169,
+    0x15c60369, 0x15c62b69, 0x15c62be9, 0x15c62d69, 0x15c8d099, 0x15c94415, 0x15c96c91, 0x15c97291,
+    0x15caec99, 0x15cb4dc9, 0x15cb50c5, 0x15cb64aa, 0x15cb6615, 0x15cb66a1, 0x15cb7829, 0x15cb78a9,
+    0x15cb7a15, 0x15cb8d29, 0x15cb8e91, 0x15cb8f21, 0x15cba205, 0x15cba301, 0x15cbc92a, 0x15cbc9b6,
+    0x15cbcb11, 0x15cf2491, 0x15cf9811, 0x15cffd69, 0x15d001e9, 0x15d00369, 0x15d003e9, 0x15d025f6,
+    0x15d02a76, 0x15d02be9, 0x15d03969, 0x15d039f6, 0x15d03e76, 0x15d03fe9, 0x15d09f69, 0x15d0a3e9,
+    0x15d0a569, 0x15d0b169, 0x15d0b2e9, 0x15d0b369, 0x15d0b769, 0x15d0b7e9, 0x15d14091, 0x15d1b8a9,
+    0x15d1ba11, 0x15d1ba91, 0x15d1cd85, 0x15d1de89, 0x15d1e185, 0x15d1f605, 0x15d20be9, 0x15d211fe,
+    0x15d21de9, 0x15d21f69, 0x15d21fe9, 0x15d225fe, 0x15d24676, 0x15d247e9, 0x15d259e9, 0x15d25a76,
+    0x15d25be9, 0x15d2bfe9, 0x15d2c169, 0x15d2d369, 0x15d2d3e9, 0x15d2d569, 0x15d2fbe9, 0x15d6656a,
+    0x15d66b6a, 0x15d693ea, 0x15d6a16a, 0x15d7056a, 0x15d706ea, 0x15d70bea, 0x15d70d6a, 0x15d832aa,
+    0x15d835aa, 0x15d871ea, 0x15d8736a, 0x15d873ea, 0x15d8856a, 0x15d8876a, 0x15d8afea, 0x15d927ea,
+    0x15dbb851, 0x15dbb8d5, 0x15dbdcd5, 0x15dbdfd5, 0x15dbf14a, 0x15dbf446, 0x15dc1799, 0x15dc1c19,
+    0x15dc1da5, 0x15dc4019, 0x15dc4499, 0x15dc4619, 0x15dc46a1, 0x15dc5899, 0x15dc5a19, 0x15dc9715,
+    0x15dc9795, 0x15dcd00a, 0x15dcd306, 0x15dcd402, 0x15dce811, 0x15dce891, 0x15dcf88a, 0x15dcfb86,
+    0x15dcfc82, 0x15dd0c89, 0x15dd0f85, 0x15dd3315, 0x15dd3795, 0x15dd3915, 0x15dd4695, 0x15dd4715,
+    0x15dd4b15, 0x15dd4b95, 0x15dd4d15, 0x15dd5b91, 0x15dd6011, 0x15dd61a5, 0x15dd720a, 0x15dd7506,
+    0x15dd9791, 0x15dd9811, 0x15dd9c11, 0x15dd9e11, 0x15ddaea1, 0x15ddb1a1, 0x15ddd455, 0x15ddd4d5,
+    0x15de137e, 0x15de2619, 0x15de6219, 0x15de62a1, 0x15de907e, 0x15dec825, 0x15dece3e, 0x15df0425,
+    0x15df04a5, 0x15df0abe, 0x15df447e, 0x15df5395, 0x15df5515, 0x15df6716, 0x15df6796, 0x15df6916,
+    0x15df7c11, 0x15df7da5, 0x15df823e, 0x15e24315, 0x15e24799, 0x15e24915, 0x15e24995, 0x15e29a91,
+    0x15e2bb05, 0x15e2be89, 0x15e2c185, 0x15e372e5, 0x15e378e5, 0x15e37965, 0x15e38711, 0x15e38b91,
+    0x15e38d11, 0x15e3ec65, 0x15e3f0e5, 0x15e3f265, 0x15e414e5, 0x15e41965, 0x15e41ae5, 0x15e42865,
+    0x15e428e5, 0x15e42ce5, 0x15e42d65, 0x15e42ee5, 0x15e45195, 0x15e46515, 0x15e46595, 0x15e47a11,
+    0x15e4803e, 0x15e4b611, 0x15e4b691, 0x15e4f3a5, 0x15e558e5, 0x15e55efe, 0x15e58165, 0x15e5877e,
+    0x15e594e5, 0x15e59565, 0x15e59b7e, 0x15e5a791, 0x15e5a911, 0x15e5a991, 0x15e5fae5, 0x15e5ff7e,
+    0x15e600fe, 0x15e60ce5, 0x15e60e65, 0x15e60efd, 0x15e612fe, 0x15e63565, 0x15e636e5, 0x15e63b7e,
+    0x15e9a465, 0x15e9cce5, 0x15e9cd65, 0x15e9dae5, 0x15e9e0e5, 0x15ea0595, 0x15ea0895, 0x15ea4065,
+    0x15ea44e5, 0x15ea4665, 0x15ea5265, 0x15ea53e5, 0x15ea7ae5, 0x15ea7c65, 0x15ea7ce5, 0x15ea80e5,
+    0x15ea8165, 0x15ea82e5, 0x15ea8ee5, 0x15ea9065, 0x15ea94e5, 0x15eab995, 0x15ebace5, 0x15ebb2fe,
+    0x15ebe8e5, 0x15ebe965, 0x15ebfce5, 0x15ec60e5, 0x15ec6265, 0x15ec7465, 0x15ec9ce5, 0x15ec9d65,
+    0x15ec9ee5, 0x15ecced5, 0x15ed5ca1, 0x15edfe91, 0x15ef1819, 0x15ef1995, 0x15ef1a15, 0x15ef6a91,
+    0x15ef6b11, 0x15ef8f09, 0x15ef9205, 0x15f04961, 0x15f049e1, 0x15f05791, 0x15f05c11, 0x15f05d95,
+    0x15f05e15, 0x15f07e85, 0x15f0bce1, 0x15f0c161, 0x15f0e561, 0x15f0e9e1, 0x15f0eb61, 0x15f0ebe1,
+    0x15f0f8e1, 0x15f0f961, 0x15f0fd61, 0x15f0fde1, 0x15f0ff61, 0x15f10f7e, 0x15f10ffe, 0x15f14a99,
+    0x15f14b7e, 0x15f18699, 0x15f18719, 0x15f19dbe, 0x15f1ca3e, 0x15f1cabe, 0x15f257fe, 0x15f2587e,
+    0x15f26bfe, 0x15f27991, 0x15f27a11, 0x15f27e3e, 0x15f27ebe, 0x15f2ba3e, 0x15f2cb61, 0x15f2cffe,
+    0x15f2dd61, 0x15f2def5, 0x15f2df7d, 0x15f305e1, 0x15f30761, 0x15f307e1, 0x15f30bfe, 0x15f30c7e,
+    0x15f35919, 0x15f35d99, 0x15f35f15, 0x15f35f95, 0x15f3b091, 0x15f48edd, 0x15f48f5d, 0x15f49d11,
+    0x15f4a191, 0x15f4c89e, 0x15f5025d, 0x15f506dd, 0x15f52add, 0x15f52f5d, 0x15f530dd, 0x15f53e5e,
+    0x15f53ede, 0x15f542de, 0x15f5435e, 0x15f5f559, 0x15f5f9d9, 0x15f5fb59, 0x15f5fbd9, 0x15f6e855,
+    0x15f6ecd5, 0x15f6ee55, 0x15f6eed5, 0x15f73951, 0x15f73dd1, 0x15f73f51, 0x15f73fd1, 0x15f76045,
+    0x15f77619, 0x15f77abe, 0x15f77c3e, 0x15f7db59, 0x15f7dffe, 0x15f7e17e, 0x15f803d9, 0x15f8087e,
+    0x15f809fe, 0x15f8175a, 0x15f817da, 0x15f81bda, 0x15f81c5a, 0x15f85afe, 0x15f85b7e, 0x15f8abfe,
+    0x15f8ac7e, 0x15f8de09, 0x15f8e105, 0x15f8e4be, 0x15f8e5be, 0x15f8f6d5, 0x15f8fb7e, 0x15f8fcfe,
+    0x15f908d6, 0x15f90a56, 0x15f90ad6, 0x15f90ed6, 0x15f91f51, 0x15f923fe, 0x15f94afe, 0x15f959d2,
+    0x15f95b52, 0x15f95bd2, 0x15fae35d, 0x15fc4fd9, 0x15fd42d5, 0x15fdb7c9, 0x15fdbac5, 0x15fe6bd9,
+    0x15ff5ed5, 0x16026691, 0x1602da11, 0x16033f61, 0x16034561, 0x160367f6, 0x16036de1, 0x16036e76,
+    0x16037bf6, 0x160381e1, 0x1603e161, 0x1603e5e1, 0x1603e761, 0x1603f361, 0x1603f4e1, 0x1603f961,
+    0x16041bf6, 0x16041d61, 0x16041df6, 0x160421e1, 0x16042276, 0x160423e1, 0x16042ff6, 0x16048291,
+    0x1604fc11, 0x1604fc95, 0x16050f85, 0x16054de1, 0x16056161, 0x160589e1, 0x16058a76, 0x16059de1,
+    0x160601e1, 0x16060361, 0x16061561, 0x16063de1, 0x16063e76, 0x16063fe1, 0x1608f759, 0x16096ad5,
+    0x1609bbf6, 0x1609e2c5, 0x160a3b51, 0x160a7676, 0x160b1359, 0x160b6385, 0x160b7955, 0x160b8cd5,
+    0x160b8d55, 0x160ba1d1, 0x160bddd1, 0x160bde76, 0x160c5751, 0x160d711a, 0x160d771a, 0x160e643e,
+    0x160e6a3e, 0x160f597d, 0x160f5f7d, 0x160fd2d5, 0x1610b3fd, 0x1610b6fd, 0x16112f9a, 0x16113d1a,
+    0x1611431a, 0x161167fd, 0x16118e1a, 0x16119b9a, 0x1611e155, 0x161209fd, 0x1612813e, 0x16128ebe,
+    0x1614cdd5, 0x16151ed1, 0x1615c619, 0x1615c7a1, 0x16167a09, 0x16167b05, 0x16167c01, 0x16167d05,
+    0x161690a6, 0x1616a4a6, 0x16171c21, 0x16171f21, 0x16172036, 0x1617d021, 0x1618387e, 0x161847a6,
+    0x16187025, 0x16187225, 0x1618763e, 0x161876be, 0x1618ac3e, 0x1618aca6, 0x1618ead1, 0x16193c36,
+    0x16195036, 0x161978a2, 0x161b5f9d, 0x161b65b6, 0x161b79b6, 0x161b9bbd, 0x161baf9d, 0x161c2c09,
+    0x161c2f05, 0x161c7f91, 0x161ce065, 0x161ce4e5, 0x161ce665, 0x161ce6e5, 0x161d08fe, 0x161d0d7e,
+    0x161d0efe, 0x161d1ce5, 0x161d2165, 0x161d22e5, 0x161d8265, 0x161d86e5, 0x161d8865, 0x161d9465,
+    0x161d95e5, 0x161d9665, 0x161d9ae5, 0x161d9c65, 0x161dbcfe, 0x161dbe7e, 0x161dc2fe, 0x161dcb8d,
+    0x161dd0e5, 0x161e2411, 0x161e9ba5, 0x161eeee5, 0x161ef37e, 0x161f00e5, 0x161f02e5, 0x161f06fe,
+    0x161f077e, 0x161f08fe, 0x161f297e, 0x161f2afe, 0x161f3cfe, 0x161f3d65, 0x161f3ee5, 0x161f6795,
+    0x161f7b95, 0x161f9db6, 0x161fa2e5, 0x161fa465, 0x161fb1b6, 0x161fb665, 0x161fb6e5, 0x161fb865,
+    0x161fdefe, 0x1620d8a6, 0x162114a6, 0x162175e5, 0x1621c725, 0x1621cda5, 0x1621db25, 0x162203a5,
+    0x1622faa6, 0x16234866, 0x16234c66, 0x16234ce6, 0x16234e66, 0x16237566, 0x162376e6, 0x162388e6,
+    0x1623eee6, 0x1623f066, 0x1623fc66, 0x1623fde6, 0x162554e6, 0x162556e6, 0x16255ae6, 0x162568e6,
+    0x1625cfa5, 0x162605a5, 0x16260a66, 0x16260ae6, 0x1628fc89, 0x1628ff85, 0x16295011, 0x1629b561,
+    0x1629b761, 0x1629ddfe, 0x1629df7e, 0x1629dfe1, 0x1629f1e1, 0x1629f361, 0x162a52e1, 0x162a5761,
+    0x162a5961, 0x162a64e1, 0x162a66e1, 0x162a6b61, 0x162a8d7e, 0x162a8efe, 0x162a8f61, 0x162a937e,
+    0x162a93e1, 0x162a9561, 0x162aa161, 0x162af499, 0x162b72be, 0x162bae3e, 0x162bc3fe, 0x162bc5fe,
+    0x162bd7fe, 0x162c007e, 0x162c7361, 0x162c7561, 0x162c79fe, 0x162c8761, 0x162caf7e, 0x162cafe1,
+    0x162cb161, 0x162f6959, 0x162fe0d5, 0x163031fe, 0x16310bf5, 0x163111f5, 0x16318559, 0x1632c951,
+    0x1632ddf5, 0x1632f1f5, 0x163410be, 0x1634c9b6, 0x1634d736, 0x16352811, 0x1635d0f5, 0x16372549,
+    0x16372845, 0x163729f5, 0x163765f5, 0x1637d959, 0x163892fe, 0x1638f436, 0x163901b6, 0x16394576,
+    0x163945f5, 0x16394bf6, 0x16395976, 0x163981f5, 0x163b16e1, 0x163b6821, 0x163b7c21, 0x163ba4a2,
+    0x163ce962, 0x163cede2, 0x163cef62, 0x163d1662, 0x163d17e2, 0x163d7d21, 0x163d8b62, 0x163d8fe2,
+    0x163d9162, 0x163ef5e2, 0x163ef762, 0x163ef7e2, 0x163f0962, 0x163f09e2, 0x163f0b62, 0x163f31e2,
+    0x163f3262, 0x163f33e2, 0x163f70a2, 0x163fab62, 0x163fabe2, 0x16419395, 0x1641a795, 0x1641f892,
+    0x16436a76, 0x16437e76, 0x1643f3f5, 0x1643f9f5, 0x16440775, 0x164407f5, 0x16440df5, 0x164443f5,
+    0x16452156, 0x164534d5, 0x16453555, 0x164549d1, 0x16454bd1, 0x164585fe, 0x16458676, 0x1645c492,
+    0x164615f5, 0x164629f5, 0x16fd49bd, 0x16fddb22, 0x16ff2fa1, 0x170063d9, 0x17006555, 0x170065d5,
+    0x170077d9, 0x17008c59, 0x17010751, 0x17012b49, 0x17016745, 0x17016b29, 0x17016ca5, 0x17016d25,
+    0x1701951d, 0x1701959d, 0x1701a91d, 0x17020d26, 0x17020ea6, 0x17020f26, 0x170220a6, 0x17022126,
+    0x17024926, 0x17025d1e, 0x17027259, 0x170273d1, 0x17027b4e, 0x17028d59, 0x17028ecd, 0x170291fd,
+    0x1702a3ce, 0x1702d33d, 0x1702d799, 0x1702d925, 0x1702fbbd, 0x17030026, 0x17030199, 0x17030226,
+    0x17030f3d, 0x17030fbd, 0x17031399, 0x17031426, 0x17031599, 0x17031d4e, 0x17034cbd, 0x17035295,
+    0x17035315, 0x1703828e, 0x17038b8a, 0x1703ab0e, 0x1703be8d, 0x1703bf0d, 0x1703c789, 0x1703f326,
+    0x1703f526, 0x170400bd, 0x17040726, 0x17041ba6, 0x17042d8a, 0x1704368d, 0x1704e819, 0x17051e19,
+    0x170522a6, 0x17056195, 0x1705910e, 0x17061115, 0x170615a6, 0x17065026, 0x17077f49, 0x1707c09d,
+    0x1707d49d, 0x1707fb29, 0x17080f29, 0x170874a6, 0x170888a6, 0x1708e155, 0x1708e2cd, 0x1708e34d,
+    0x1708e5fd, 0x1708f54d, 0x1708f6cd, 0x1708f9fd, 0x17092d19, 0x17092d99, 0x17093f99, 0x17094119,
+    0x17095945, 0x170961bd, 0x1709633d, 0x170963bd, 0x17096799, 0x170975bd, 0x1709773d, 0x17097b99,
+    0x1709a695, 0x1709a715, 0x1709b929, 0x1709ba95, 0x1709ea8d, 0x170a1129, 0x170a128d, 0x170a130d,
+    0x170a15bd, 0x170a18bd, 0x170a1b89, 0x170a268d, 0x170a29bd, 0x170a8a8d, 0x170a8c0d, 0x170a8c8d,
+    0x170a8f3d, 0x170a923d, 0x170a9e8d, 0x170b5b99, 0x170b5d19, 0x170bf729, 0x170bf88d, 0x170bf90d,
+    0x170bfb89, 0x170bfe85, 0x170c0189, 0x170dd7d1, 0x170e3ba2, 0x170e3d22, 0x170e659d, 0x170edd9d,
+    0x170f42d1, 0x170f4451, 0x170f4bce, 0x170f5de2, 0x170f5f62, 0x170f6262, 0x170fa3a2, 0x170fa822,
+    0x170fa9a2, 0x170fd099, 0x170fd219, 0x170fedce, 0x17101d22, 0x171021a2, 0x17102322, 0x17107b8e,
+    0x1710f50e, 0x17122b95, 0x17123f22, 0x17123f95, 0x17125411, 0x17127b22, 0x17129011, 0x17129091,
+    0x171468a9, 0x17146929, 0x17150929, 0x17151ca9, 0x17151d29, 0x171531a9, 0x171558a9, 0x1715d3a9,
+    0x1715d529, 0x17164129, 0x171641a9, 0x17167e8e, 0x171704e9, 0x17170569, 0x171717a9, 0x171732a9,
+    0x17177ce9, 0x1717a569, 0x1717a6e9, 0x1717a769, 0x1717b8e9, 0x1717b969, 0x1717bae9, 0x1717e429,
+    0x17187fa9, 0x1718a6a9, 0x1718e4e9, 0x17190d69, 0x17191369, 0x171913e9, 0x171920e9, 0x17192169,
+    0x17192769, 0x17194c29, 0x17198b69, 0x17198d69, 0x1719c369, 0x1719c7e9, 0x171abc95, 0x171abd15,
+    0x171bac85, 0x171c05d2, 0x171c0752, 0x171c233d, 0x171c2795, 0x171c2915, 0x171c2995, 0x171c3b95,
+    0x171c3d15, 0x171c6d0d, 0x171c938d, 0x171c950d, 0x171c958d, 0x171c983d, 0x171c9f85, 0x171ca78d,
+    0x171ca90d, 0x171cac3d, 0x171cdb8a, 0x171ce68d, 0x171d30e9, 0x171d52fd, 0x171d5385, 0x171d5769,
+    0x171d58e9, 0x171d5969, 0x171d66fd, 0x171d6b69, 0x171d6ce9, 0x171dcc7d, 0x171dd0e9, 0x171dd275,
+    0x171dd2e9, 0x171de4e9, 0x171de675, 0x171e087d, 0x171e0ce9, 0x171e20e9, 0x171e9209, 0x171efa85,
+    0x171f38e9, 0x171f3985, 0x171f3d69, 0x171f3ef5, 0x171f3f69, 0x171f4ce9, 0x171f52f5, 0x171f7369,
+    0x171f74e9, 0x171f7569, 0x171f7969, 0x171f8769, 0x171f88e9, 0x171f8d69, 0x171fece9, 0x171feee9,
+    0x172000e9, 0x17200275, 0x172028e9, 0x1728d64d, 0x1728f81a, 0x172905bd, 0x17290b9a, 0x17290c1a,
+    0x1729209a, 0x1729221a, 0x17293b8d, 0x17293d0d, 0x17293d8d, 0x1729403d, 0x1729469a, 0x1729479a,
+    0x17296436, 0x1729658d, 0x17296636, 0x172968b6, 0x1729778d, 0x17297836, 0x1729798d, 0x17297c3d,
+    0x17297cb6, 0x17299a29, 0x1729b529, 0x1729b9bd, 0x1729fafd, 0x1729ff69, 0x172a00e9, 0x172a0169,
+    0x172a2376, 0x172a27f6, 0x172a2969, 0x172a29f6, 0x172a36fd, 0x172a3776, 0x172a3b69, 0x172a3bf6,
+    0x172a3d69, 0x172a9cfd, 0x172aaefd, 0x172ab07d, 0x172ad776, 0x172ad8fd, 0x172ad976, 0x172aeafd,
+    0x172aeb76, 0x172aecfd, 0x172b6289, 0x172c0969, 0x172c0de9, 0x172c0f69, 0x172c0fe9, 0x172c1b69,
+    0x172c1ce9, 0x172c1d69, 0x172c2169, 0x172c4569, 0x172c45f6, 0x172c49e9, 0x172c4a76, 0x172c4be9,
+    0x172c5769, 0x172c5969, 0x172c5de9, 0x172cbd69, 0x172cbf69, 0x172cd169, 0x172cfb69, 0x172fa50d,
+    0x172fcb8d, 0x172fcc36, 0x172fd03d, 0x172fd0b6, 0x173068e9, 0x17308afd, 0x17308b76, 0x17308f69,
+    0x17309efd, 0x173102fd, 0x1731047d, 0x17313efd, 0x17326f69, 0x173270e9, 0x17327169, 0x17327569,
+    0x173284e9, 0x1732ab69, 0x173324e9, 0x1735bd4e, 0x1735e5ce, 0x17361522, 0x17364219, 0x1736ed0e,
+    0x17376f8a, 0x1737a126, 0x1738d30e, 0x173a8925, 0x173a89a6, 0x173ada25, 0x173adaa5, 0x173b130a,
+    0x173b1606, 0x173b7aa6, 0x173b8e26, 0x173b8ea6, 0x173ba326, 0x173bca26, 0x173c46a5, 0x173cb2a5,
+    0x173cbc26, 0x173cf00e, 0x173d7665, 0x173d76e5, 0x173d8926, 0x173da425, 0x173dee66, 0x173defe6,
+    0x173e16e6, 0x173e1866, 0x173e18e6, 0x173e2a66, 0x173e2ae6, 0x173e2c66, 0x173e55a5, 0x173ecaa6,
+    0x173f84e5, 0x173f8565, 0x173f98e5, 0x173fbda6, 0x173ffee6, 0x17401066, 0x174034e5, 0x17403966,
+    0x1740b499, 0x17412e15, 0x17414215, 0x1741e226, 0x1741f626, 0x17421e26, 0x174294bd, 0x17429a95,
+    0x17429b15, 0x1742ad19, 0x1742ae95, 0x17430519, 0x1743068d, 0x1743070d, 0x174309bd, 0x17431a8d,
+    0x17431dbd, 0x1743440e, 0x1743580d, 0x1743a27d, 0x1743bc05, 0x1743c47d, 0x1743ca65, 0x1743cae5,
+    0x1743d87d, 0x1743de65, 0x1743f80d, 0x17440c0d, 0x17443dfd, 0x17444266, 0x174443e6, 0x17444466,
+    0x17445666, 0x174457e6, 0x17447005, 0x1744787d, 0x17447e66, 0x17448c7d, 0x17448dfd, 0x17449266,
+    0x1745a205, 0x1745aa65, 0x1745b065, 0x1745b0fd, 0x1745c47d, 0x1745e665, 0x1745fa65, 0x17465e65,
+    0x17465fe5, 0x1746727d, 0x174673fd, 0x17469a65, 0x1747aaa2, 0x174915a2, 0x17491722, 0x174a59a1,
+    0x174abee2, 0x174ac062, 0x174ae761, 0x174ae8e1, 0x174afae2, 0x174afb61, 0x174bc1a1, 0x174be8a2,
+    0x174c26e2, 0x174c4f61, 0x174c5561, 0x174c62e2, 0x174c6361, 0x174ccd61, 0x174ce0e2, 0x17545292,
+    0x1754e05d, 0x1754e0dd, 0x17551a05, 0x1755585d, 0x175559f5, 0x17556c7d, 0x1755945d, 0x175594dd,
+    0x1755a85e, 0x1755bd92, 0x1755bf12, 0x1755c68e, 0x1755e389, 0x175624fd, 0x175646fd, 0x17564b59,
+    0x17564cd9, 0x17564d59, 0x17565afd, 0x17565f59, 0x175660d9, 0x17569e55, 0x1756f64e, 0x1756ff4a,
+    0x17570246, 0x17570a4d, 0x17573e55, 0x17575255, 0x175766d2, 0x17576fce, 0x175778ca, 0x1757aa4d,
+    0x1757b645, 0x1757be4d, 0x175840fd, 0x1758a655, 0x1758ba55, 0x1758ced2, 0x1758dc4e, 0x1758e54a,
+    0x1758e846, 0x17590ad2, 0x17590b51, 0x175ca636, 0x175caab6, 0x175d42e2, 0x175dad0e, 0x175e1976,
+    0x175e2d76, 0x17628e1a, 0x17628f9a, 0x1762a919, 0x1762aa8d, 0x1762adbd, 0x1762b0bd, 0x1762b41a,
+    0x1762eefd, 0x1762f35a, 0x1762f4da, 0x1762f55a, 0x17631776, 0x17631bda, 0x17631d5a, 0x17631dda,
+    0x17632afd, 0x17632b76, 0x17632f5a, 0x17632fda, 0x1763315a, 0x17636005, 0x1763687d, 0x17636e55,
+    0x17636ed5, 0x17639e4e, 0x1763a74a, 0x1763da4d, 0x1763daf6, 0x1763e3f6, 0x1763ed0e, 0x1764140e,
+    0x17641c7d, 0x1764524e, 0x17647ace, 0x17648e4e, 0x17648ece, 0x1764904e, 0x176503da, 0x1765117d,
+    0x176539f6, 0x17653e5a, 0x17657d55, 0x1765acce, 0x1765f276, 0x17662cd5, 0x176948da, 0x17695cda,
+    0x17697efd, 0x17697f76, 0x1769835a, 0x176992fd, 0x176a2e4d, 0x176a2ef6, 0x176a424d, 0x176aa64e,
+    0x176aa7ce, 0x176aaafd, 0x176ae24e, 0x176ae2ce, 0x176c144d, 0x17706ca2, 0x1770953e, 0x1770c5fe,
+    0x177131a5, 0x177167be, 0x17727b0d, 0x1772e851, 0x177339a1, 0x17734da1, 0x17737621, 0x1773f719,
+    0x17746e95, 0x17748215, 0x17748295, 0x1774be05, 0x1776208d, 0x17767d11, 0x1776980d, 0x1776e265,
+    0x1776e465, 0x17770afe, 0x17770ce5, 0x1777187e, 0x17771e7e, 0x17771ee5, 0x17778666, 0x177793fd,
+    0x1778f0e5, 0x1778f2e5, 0x17792d65, 0x17792ee5, 0x177940e5, 0x1779a265, 0x1779a6e6, 0x177ad615,
+    0x177aea15, 0x177c7299, 0x177c7499, 0x177c868d, 0x177c8b3d, 0x177cec15, 0x177d000d, 0x177d1492,
+    0x177d45fd, 0x177d4a65, 0x177d6c7e, 0x177d727e, 0x177d807d, 0x177d81fd, 0x177d8665, 0x177dd9a5,
+    0x177de5fd, 0x177de7fd, 0x177df9fd, 0x177dfb7d, 0x177f4a05, 0x177f5265, 0x177f5465, 0x177f5865,
+    0x177f6665, 0x177f6c65, 0x177fcd15, 0x177ff591, 0x17834d91, 0x1783b2e2, 0x1783db7e, 0x1785bce1,
+    0x1785c161, 0x1785cee2, 0x1785d0e1, 0x1785f77e, 0x17860b61, 0x17879311, 0x17879491, 0x1787f85d,
+    0x1787f9f5, 0x1787fa5d, 0x178820fe, 0x1788227e, 0x178822dd, 0x178834dd, 0x1788365d, 0x17889a5d,
+    0x17889c5d, 0x1788adf5, 0x1788ae5d, 0x1788d6dd, 0x1788fb3d, 0x1788ff91, 0x17890111, 0x17891a8d,
+    0x17891c0d, 0x17891c8d, 0x17891f3d, 0x1789223d, 0x1789607d, 0x178964d9, 0x17896675, 0x178966d9,
+    0x178988fe, 0x17898d7e, 0x17898efe, 0x17898f59, 0x17899afe, 0x17899c7e, 0x17899cfd, 0x1789a0fe,
+    0x1789a159, 0x1789a2d9, 0x1789d9fd, 0x1789de55, 0x1789dfd5, 0x1789e055, 0x178a0fce, 0x178a4a7e,
+    0x178a4bfe, 0x178a4c4d, 0x178a4efe, 0x178a8055, 0x178a8255, 0x178a8dfd, 0x178a93d5, 0x178a9455,
+    0x178aa8d1, 0x178ac3cd, 0x178acfc5, 0x178aec7e, 0x178b7559, 0x178bab59, 0x178bafd9, 0x178bcf89,
+    0x178bd285, 0x178be855, 0x178beed5, 0x178bfa55, 0x178bfbd5, 0x178bfc55, 0x178c10d1, 0x178c37c5,
+    0x178c4cfe, 0x178c4d51, 0x178c9e55, 0x178ca2d5, 0x178cdd49, 0x178fc87d, 0x178fccd9, 0x17903255,
+    0x17904655, 0x17909e7e, 0x1790aa7e, 0x1790b24d, 0x179117cd, 0x179119cd, 0x17913af6, 0x17916375,
+    0x1792844d, 0x1792864d, 0x17929045, 0x179342f6, 0x179356f6, 0x17937f75, 0x1797743e, 0x1797b0be,
+    0x17996e15, 0x17999691, 0x179c98fd, 0x179ce116, 0x179d02d6, 0x179d107d, 0x179d1655, 0x179d16d5,
+    0x179d2b51, 0x179d464d, 0x179d5245, 0x179d6176, 0x179d6ef6, 0x179d827e, 0x179d82f6, 0x179e04fe,
+    0x179e417e, 0x179f54cd, 0x17a01375, 0x17a02775, 0x17a04ff5, 0x17a2fefd, 0x17a3007d, 0x17a304da,
+    0x17a326fe, 0x17a3ae4d, 0x17a3b2fd, 0x17a3d67e, 0x17a3d6f6, 0x17a3dafe, 0x17a407be, 0x17a4504e,
+    0x17a454fd, 0x17a458fe, 0x17a46cfe, 0x17a4957e, 0x17a5bc4d, 0x17a5bccd, 0x17a5c149, 0x17a67b75,
+    0x17afc419, 0x17b03d95, 0x17b0b585, 0x17b0f1a6, 0x17b0f326, 0x17b12c26, 0x17b12f26, 0x17b1e019,
+    0x17b25995, 0x17b30d95, 0x17bd0795, 0x17bd3011, 0x17bf1149, 0x17bf1445, 0x17bf2829, 0x17bf2995,
+    0x17bf2a15, 0x17bf3c29, 0x17bf3d95, 0x17bf50a9, 0x17bf5235, 0x17bf5291, 0x17bf6585, 0x17bf6681,
+    0x17bf8ca9, 0x17bf8d29, 0x17bf8e91, 0x17c2c015, 0x17c35b91, 0x17c3c0e9, 0x17c3e969, 0x17c3efe9,
+    0x17c3fd69, 0x17c42809, 0x17c42b05, 0x17c46969, 0x17c49f69, 0x17c4a3e9, 0x17c4a569, 0x17c4dc15,
+    0x17c57c29, 0x17c57d91, 0x17c57e11, 0x17c59105, 0x17c5a505, 0x17c5b985, 0x17c5cf69, 0x17c5e169,
+    0x17c5e2f5, 0x17c5e369, 0x17c609e9, 0x17c60b69, 0x17c60be9, 0x17c61d69, 0x17c61de9, 0x17c61f69,
+    0x17c68569, 0x17c6bfe9, 0x17c6c169, 0x17ca28e9, 0x17cc3569, 0x17cc3769, 0x17cc7169, 0x17cc71e9,
+    0x17cc7369, 0x17d727e9, 0x17d8c985, 0x17d907e9, 0x17d943e9, 0x17d9bbe9, 0x17e93195, 0x17e93f15,
+    0x17ea6165, 0x17ea6ee5, 0x17ea99a6, 0x17ea9ca6, 0x17eadae6, 0x17eb10e5, 0x17eb1566, 0x17eb16e6,
+    0x17eb4d95, 0x17ec7d65, 0x17ecf6fd, 0x17ed3165, 0x17ed32e5, 0x17f69d91, 0x17f702e2, 0x17f72b61,
+    0x17f73f61, 0x17f8bf91, 0x17f8c011, 0x17f8d305, 0x17f91161, 0x17f924e2, 0x17f9257d, 0x17f94d61,
+    0x17f94de1, 0x17f96161, 0x17fa4115, 0x17fa4795, 0x17fa4f45, 0x17fa5319, 0x17fa5495, 0x17fa5515,
+    0x17fa5919, 0x17fa5999, 0x17fa6991, 0x17fa8d89, 0x17fa9085, 0x17fab609, 0x17fac989, 0x17faca09,
+    0x17fae311, 0x17fb0709, 0x17fb0a05, 0x17fb485d, 0x17fb4e75, 0x17fb4efd, 0x17fb70dd, 0x17fb76dd,
+    0x17fb775d, 0x17fb845d, 0x17fb84dd, 0x17fbbe05, 0x17fbeedd, 0x17fbfc5d, 0x17fc0275, 0x17fc02fd,
+    0x17fc24dd, 0x17fc26dd, 0x17fc2b5d, 0x17fc385e, 0x17fc38de, 0x17fc4f91, 0x17fc5419, 0x17fc5591,
+    0x17fc6f19, 0x17fc708d, 0x17fc710d, 0x17fc7389, 0x17fc7685, 0x17fc7a09, 0x17fcb4d9, 0x17fcb959,
+    0x17fcbaf5, 0x17fcbb7d, 0x17fcdd59, 0x17fce1d9, 0x17fce359, 0x17fce3d9, 0x17fcef59, 0x17fcf0d9,
+    0x17fcf159, 0x17fcf559, 0x17fcf5d9, 0x17fcf759, 0x17fd2605, 0x17fd2e55, 0x17fd3455, 0x17fd34d5,
+    0x17fd644e, 0x17fd7f51, 0x17fd8cce, 0x17fda04d, 0x17fda0cd, 0x17fda9c9, 0x17fdd4d5, 0x17fdd6d5,
+    0x17fde255, 0x17fde855, 0x17fde8d5, 0x17fdfd51, 0x17fe184d, 0x17fe2445, 0x17fe40cd, 0x17fe4bc9,
+    0x17fe4ec5, 0x17fe544d, 0x17fe54cd, 0x17feffd9, 0x17ff047e, 0x17ff2409, 0x17ff2705, 0x17ff3cd5,
+    0x17ff437e, 0x17ff5055, 0x17ff50d5, 0x17ff6551, 0x17ffa151, 0x17ffa1d1, 0x17ffb87e, 0x17fff2d5,
+    0x17fff77e, 0x180031fe, 0x18039655, 0x18127555, 0x181bb5d5, 0x181dc451, 0x181e15a1, 0x181e29a1,
+    0x181e5221, 0x18203821, 0x18221d45, 0x18225b1d, 0x18225b9d, 0x18226f1d, 0x1822979d, 0x18240965,
+    0x18240ae5, 0x18244115, 0x18245515, 0x182482e6, 0x18248466, 0x1825eae5, 0x18266395, 0x1826998d,
+    0x18269ee5, 0x1828c325, 0x182aa925, 0x1830ace1, 0x18311815, 0x183140b6, 0x1832b961, 0x1832cd61,
+    0x1832f57e, 0x1832f5e1, 0x18355d95, 0x1837b949, 0x1837bc45, 0x1837caf6, 0x1837d176, 0x1837f9f5,
+    0x18380775, 0x18386d59, 0x1838e4d5, 0x1838f8d5, 0x18390d51, 0x1839497e, 0x183949d1, 0x1839d976,
+    0x1839d9f5, 0x1839dff6, 0x1839ed76, 0x183a15f5, 0x183bbf15, 0x183dcd91, 0x183e1ef6, 0x183e2576,
+    0x183e32f6, 0x183e5b75, 0x18404176, 0x18426421, 0x18444a21, 0x18488f95, 0x184a9e11, 0x184aef75,
+    0x184aeff5, 0x184b0375, 0x184b2bf5, 0x184d11f5, 0x190a1099, 0x190a1219, 0x190a1299, 0x190b0395,
+    0x190b0515, 0x190b0595, 0x190bb0d5, 0x190bb3d5, 0x190bf219, 0x190bf699, 0x190c2c9a, 0x190c2e1a,
+    0x190c2e9a, 0x190c329a, 0x190c331a, 0x190c349a, 0x190ce0a5, 0x190ce3a5, 0x190ff3cd, 0x190ffcc9,
+    0x191037b2, 0x19103c32, 0x19103e29, 0x19106499, 0x19106619, 0x19106699, 0x191073b2, 0x19107832,
+    0x19107899, 0x19107a19, 0x1910b732, 0x1910b795, 0x19110f8e, 0x1911188a, 0x19111b86, 0x19115795,
+    0x19115915, 0x19115995, 0x191166b2, 0x19116b95, 0x19116d15, 0x1911890e, 0x1911920a, 0x19124619,
+    0x19124a99, 0x19124c25, 0x19124ca9, 0x19125a29, 0x19128099, 0x19128219, 0x19128299, 0x19128699,
+    0x19128719, 0x1912949a, 0x1912961a, 0x19129a9a, 0x1912bfa5, 0x1912c595, 0x1912c615, 0x1912d3a5,
+    0x1912d995, 0x1912f58e, 0x1912fe8a, 0x19130186, 0x191eb5e9, 0x191eb769, 0x191eb7e9, 0x191f631a,
+    0x191f661a, 0x191f691a, 0x192023e9, 0x19202469, 0x19205c96, 0x19205f96, 0x19209769, 0x19209be9,
+    0x1920bfe9, 0x1920c469, 0x1920c5e9, 0x19233832, 0x19233a15, 0x192467f2, 0x19246972, 0x192469e9,
+    0x19249eb2, 0x1924dcf2, 0x1924e172, 0x1924e369, 0x192509e9, 0x19250b69, 0x19250be9, 0x192518f2,
+    0x19251d72, 0x19251de9, 0x19251f69, 0x19254219, 0x19254695, 0x19254815, 0x19254895, 0x19255615,
+    0x19255a95, 0x19255c15, 0x19264df2, 0x19264fe9, 0x19267669, 0x192677e9, 0x19267869, 0x192685f1,
+    0x192689f2, 0x19268a69, 0x19268be9, 0x1926eb69, 0x1926efe9, 0x1926f1e9, 0x1926fd72, 0x1926ff69,
+    0x192703e9, 0x192725e9, 0x19272769, 0x192727e9, 0x19272be9, 0x19272c69, 0x19300895, 0x19313869,
+    0x193139e9, 0x19313a69, 0x1931b1f2, 0x1931b372, 0x1931b3f2, 0x1931da72, 0x1931edf2, 0x1931ee72,
+    0x1931eff2, 0x19326599, 0x193319e9, 0x19331e69, 0x19331fe9, 0x19332069, 0x19334269, 0x193346e9,
+    0x19334869, 0x19335469, 0x193355e9, 0x19335669, 0x19335a69, 0x19335ae9, 0x19335c69, 0x1933bbe9,
+    0x1933c072, 0x1933c1f2, 0x1933cde9, 0x1933cf69, 0x1933cfe9, 0x1933d3f2, 0x1933d472, 0x1933f669,
+    0x1933fc72, 0x19375f72, 0x19376572, 0x193765e9, 0x19378c69, 0x19378de9, 0x19378e69, 0x19379b72,
+    0x1937a069, 0x1937a1e9, 0x193805f2, 0x19380772, 0x193807f2, 0x193814f2, 0x193819f2, 0x19381b72,
+    0x193841f2, 0x19384272, 0x193843f2, 0x193855f2, 0x19396de9, 0x19397269, 0x193973e9, 0x19397469,
+    0x19397ff2, 0x19398172, 0x193981e9, 0x193985f2, 0x193987e9, 0x1939a869, 0x1939a9e9, 0x1939aa69,
+    0x1939aee9, 0x1939b069, 0x1939bc69, 0x1939bde9, 0x1939c269, 0x193a21e9, 0x193a2369, 0x193a23e9,
+    0x193a35e9, 0x193a3769, 0x193a3bf2, 0x193a5fe9, 0x1949ab32, 0x1949ab95, 0x194adaf2, 0x194adb65,
+    0x194b4e72, 0x194b7b65, 0x194b7ce5, 0x194b7d65, 0x194b8a72, 0x194b8f65, 0x194b90e5, 0x194bb395,
+    0x194bb995, 0x194bba15, 0x194bc795, 0x194bcd95, 0x194c2f09, 0x194cbaf2, 0x194ce365, 0x194ce965,
+    0x194ce9e5, 0x194cf6f2, 0x194cf765, 0x194cfd65, 0x194d5ce5, 0x194d6165, 0x194d62e5, 0x194d6ef2,
+    0x194d9765, 0x194d98e5, 0x194d9965, 0x194d9d65, 0x194d9de5, 0x195d5bf2, 0x195d5d72, 0x195d5dd9,
+    0x195e4a72, 0x195e4ef2, 0x195e5072, 0x195e50d5, 0x195e9fd1, 0x195ea151, 0x195ea1d1, 0x195ed819,
+    0x195edc99, 0x195ede15, 0x195ede95, 0x195eff32, 0x195f3d72, 0x195f41f2, 0x195f5312, 0x195f65d9,
+    0x195f6a59, 0x195f6bd9, 0x195f6c59, 0x195f79da, 0x195f7dda, 0x195f7e5a, 0x195f7fda, 0x195fbcf2,
+    0x195fbd55, 0x19600dd1, 0x19600e51, 0x196031f2, 0x19604792, 0x196058d5, 0x19605d55, 0x19605ed5,
+    0x19605f55, 0x19606c56, 0x19606cd6, 0x196070d6, 0x19607156, 0x19608151, 0x196085d1, 0x1960acf2,
+    0x1960bd52, 0x1960bdd2, 0x1960c1d2, 0x1960c252, 0x196a2c59, 0x196a2dd9, 0x196a2e59, 0x196b1f72,
+    0x196b20f2, 0x196b2172, 0x196b95f2, 0x196bcf85, 0x196bd31a, 0x196c0dd9, 0x196c1259, 0x196c13d9,
+    0x196c3659, 0x196c3ad9, 0x196c3c59, 0x196c485a, 0x196c49da, 0x196c4a5a, 0x196c8755, 0x196c8d55,
+    0x196c8dd5, 0x196cfc49, 0x196cff45, 0x196d2955, 0x196d2df2, 0x196d2f72, 0x196d3b56, 0x196d3cd6,
+    0x196d3d56, 0x196d4156, 0x196d41d6, 0x196d7c72, 0x196da472, 0x197267d9, 0x19727572, 0x1972db55,
+    0x1972ef55, 0x198446f2, 0x198448e5, 0x19846f7e, 0x198470fe, 0x19847165, 0x19848365, 0x198484e5,
+    0x1984e8e5, 0x1984ea65, 0x1984eae5, 0x1984fce5, 0x1984fe65, 0x198524fe, 0x198538e5, 0x198650e5,
+    0x19865565, 0x198656e5, 0x19865765, 0x198662f2, 0x198664e5, 0x19866965, 0x19866ae5, 0x19868b7e,
+    0x19868cfe, 0x19868d65, 0x1986917e, 0x198691e5, 0x19869365, 0x19869f65, 0x1986a0e5, 0x1986a565,
+    0x198704e5, 0x19870665, 0x19870b65, 0x198718e5, 0x19871a65, 0x19871ee5, 0x1996cb59, 0x199742f2,
+    0x1998d9d9, 0x1998e759, 0x19995155, 0x19996555, 0x19a39b59, 0x19a41355, 0x19a5bdd9, 0x19aa0359,
+    0x19aa23fe, 0x19aad7fe, 0x19aadafe, 0x19bd3625, 0x19bd3c25, 0x19bdafa5, 0x19d129f2, 0x19d12be9,
+    0x19d15269, 0x19d153e9, 0x19d15469, 0x19d16669, 0x19d167e9, 0x19d1c769, 0x19d1cbe9, 0x19d1cde9,
+    0x19d1db69, 0x19d1dfe9, 0x19d201e9, 0x19d20369, 0x19d203e9, 0x19d207e9, 0x19d20869, 0x19d209e9,
+    0x19d215e9, 0x19d21769, 0x19d21be9, 0x19d33a7e, 0x19d3767e, 0x19d3e7e9, 0x19d3e9e9, 0x19d3fbe9,
+    0x19d423e9, 0x19d42469, 0x19d425e9, 0x19e3832a, 0x19e3952a, 0x19e4372a, 0x19e45dea, 0x19e461ea,
+    0x19e463ea, 0x19e499ea, 0x19e4fdea, 0x19e4ff6a, 0x19e66a6a, 0x19e66bea, 0x19e66c6a, 0x19e6706a,
+    0x19e67fea, 0x19e6a6ea, 0x19e6a86a, 0x19e71fea, 0x1a1d2b32, 0x1a1d51fd, 0x1a1d57fd, 0x1a1dcb55,
+    0x1a1e09f2, 0x1a20187e, 0x1b0aa4bd, 0x1b0aa63d, 0x1b0aa6bd, 0x1b0c20fd, 0x1b0c26fd, 0x1b0c47fd,
+    0x1b0c4b7d, 0x1b0c4e7d, 0x1b0c5fca, 0x1b0c863d, 0x1b0c8abd, 0x1b0caebd, 0x1b0cb33d, 0x1b0cb4bd,
+    0x1b0cc21a, 0x1b0cc29a, 0x1b0cc69a, 0x1b0cc71a, 0x1b0cc89a, 0x1b0d05bd, 0x1b0d063d, 0x1b0d573d,
+    0x1b0e0612, 0x1b12797d, 0x1b127afd, 0x1b127b7d, 0x1b1308bd, 0x1b13269a, 0x1b13299a, 0x1b132d1a,
+    0x1b13e77d, 0x1b13e7fd, 0x1b13f5bd, 0x1b13fa3d, 0x1b142016, 0x1b142316, 0x1b145afd, 0x1b145f7d,
+    0x1b146d92, 0x1b14837d, 0x1b1487fd, 0x1b14897d, 0x1b16fbbd, 0x1b16fd3d, 0x1b16fdbd, 0x1b174cbd,
+    0x1b174e3d, 0x1b17723d, 0x1b1772bd, 0x1b17af8a, 0x1b182cfd, 0x1b182d7d, 0x1b18a4fd, 0x1b18cd7d,
+    0x1b18cefd, 0x1b18cf7d, 0x1b18e0fd, 0x1b18e17d, 0x1b18e2fd, 0x1b18ecfd, 0x1b1905bd, 0x1b190c3d,
+    0x1b1913fd, 0x1b1919bd, 0x1b192e3d, 0x1b19523d, 0x1b196a3d, 0x1b197abd, 0x1b197dbd, 0x1b198e1a,
+    0x1b1a3b7d, 0x1b1a3bfd, 0x1b1a4f7d, 0x1b1a5bbd, 0x1b1a8296, 0x1b1aaefd, 0x1b1ab37d, 0x1b1ac0fd,
+    0x1b1ae97d, 0x1b1aeafd, 0x1b1aeb7d, 0x1b1aef7d, 0x1b1aeffd, 0x1b1f49fd, 0x1b1f4b7d, 0x1b1f4bfd,
+    0x1b1fd93d, 0x1b1ffa1a, 0x1b1ffd1a, 0x1b1ffd9a, 0x1b1ffe9a, 0x1b203a8a, 0x1b20b7fd, 0x1b20b87d,
+    0x1b20c63d, 0x1b20cabd, 0x1b20ed16, 0x1b212b7d, 0x1b212ffd, 0x1b2153fd, 0x1b21587d, 0x1b2159fd,
+    0x1b2aadfd, 0x1b2aaf7d, 0x1b2aaffd, 0x1b2ba0fd, 0x1b2ba2fd, 0x1b2bf1fd, 0x1b2c177d, 0x1b2c17fd,
+    0x1b2c18fd, 0x1b2c30bd, 0x1b2cbc7d, 0x1b2cbdfd, 0x1b2cbe7d, 0x1b2ccbda, 0x1b2cd05a, 0x1b2cd1da,
+    0x1b2d0f7d, 0x1b2d923d, 0x1b2daafd, 0x1b2db916, 0x1b2dbcd6, 0x1b2dbed6, 0x1b2dd37d, 0x1b2df77d,
+    0x1b2e0f52, 0x1b2e1ffd, 0x1b2e22fd, 0x1b309e3d, 0x1b31cdfd, 0x1b32477d, 0x1b32ba3d, 0x1b32d53d,
+    0x1b3348bd, 0x1b336fbd, 0x1b33adfd, 0x1b33b3fd, 0x1b33d67d, 0x1b33e9fd, 0x1b33ea7d, 0x1b3455fd,
+    0x1b34637d, 0x1b3467fd, 0x1b377e7d, 0x1b377ffd, 0x1b37807d, 0x1b38fabd, 0x1b395ffd, 0x1b3965fd,
+    0x1b39887d, 0x1b399a5a, 0x1b399bda, 0x1b39d97d, 0x1b3a4e7d, 0x1b3a517d, 0x1b3ace7d, 0x1b3d463d,
+    0x1b3d6a3d, 0x1b3d6abd, 0x1b3d6bbd, 0x1b3da9fd, 0x1b3dab7d, 0x1b3dd27d, 0x1b3dd3fd, 0x1b3dd47d,
+    0x1b3de5fd, 0x1b3de67d, 0x1b3de7fd, 0x1b3e24fd, 0x1b3e257d, 0x1b3e75fd, 0x1b3e99fd, 0x1b3e9a7d,
+    0x1b3f623d, 0x1b3f72bd, 0x1b3f863d, 0x1b3f86bd, 0x1b3f87bd, 0x1b3fb3fd, 0x1b3fb9fd, 0x1b3fc5fd,
+    0x1b3fc77d, 0x1b3fee7d, 0x1b3feffd, 0x1b3ff07d, 0x1b4001da, 0x1b40025a, 0x1b4014bd, 0x1b402d7d,
+    0x1b403bbd, 0x1b4040fd, 0x1b40417d, 0x1b4055fd, 0x1b40634e, 0x1b4079fd, 0x1b407cfd, 0x1b4091fd,
+    0x1b40a27d, 0x1b40a57d, 0x1b40b5fd, 0x1b40b67d, 0x1b411bfd, 0x1b45bb7d, 0x1b45bcfd, 0x1b45bd7d,
+    0x1b46328a, 0x1b464abd, 0x1b466b9a, 0x1b466e9a, 0x1b466f1a, 0x1b47297d, 0x1b4729fd, 0x1b4737bd,
+    0x1b479cfd, 0x1b47a17d, 0x1b47c57d, 0x1b47c9fd, 0x1b47cb7d, 0x1b5120fd, 0x1b51217d, 0x1b52127d,
+    0x1b52637d, 0x1b529bbd, 0x1b52c2bd, 0x1b5300fd, 0x1b53297d, 0x1b532f7d, 0x1b532ffd, 0x1b533cda,
+    0x1b533d5a, 0x1b53435a, 0x1b542e56, 0x1b65c4bd, 0x1b65c63d, 0x1b65c6bd, 0x1b6653fd, 0x1b66547d,
+    0x1b6677da, 0x1b6732bd, 0x1b67333d, 0x1b6740fd, 0x1b67457d, 0x1b6767d6, 0x1b676c56, 0x1b67a63d,
+    0x1b67aabd, 0x1b67cebd, 0x1b67d33d, 0x1b67d4bd, 0x1b67d53d, 0x1b6ac1fd, 0x1b6ca7fd, 0x1b6cddda,
+    0x1b6d1b7d, 0x1b6d937d, 0x1b72953d, 0x1b7296bd, 0x1b72973d, 0x1b72cd7d, 0x1b72d37d, 0x1b73247d,
+    0x1b73425a, 0x1b7348da, 0x1b73fd3d, 0x1b74033d, 0x1b7403bd, 0x1b74117d, 0x1b7415fd, 0x1b743bd6,
+    0x1b7476bd, 0x1b747b3d, 0x1b747cbd, 0x1b748652, 0x1b748c52, 0x1b749f3d, 0x1b74a3bd, 0x1b74a53d,
+    0x1b7718fd, 0x1b778dfd, 0x1b778e7d, 0x1b7848bd, 0x1b78493d, 0x1b78827d, 0x1b78c0bd, 0x1b78c23d,
+    0x1b78e93d, 0x1b78eabd, 0x1b78eb3d, 0x1b78fcbd, 0x1b78fd3d, 0x1b78febd, 0x1b79217d, 0x1b792fbd,
+    0x1b7934fd, 0x1b796dfd, 0x1b79967d, 0x1b79aa5a, 0x1b79ab5a, 0x1b79c37d, 0x1b79ea7d, 0x1b7a28bd,
+    0x1b7a2ebd, 0x1b7a513d, 0x1b7a573d, 0x1b7a57bd, 0x1b7a64bd, 0x1b7a653d, 0x1b7a6b3d, 0x1b7acabd,
+    0x1b7acf3d, 0x1b7ad0bd, 0x1b7adcbd, 0x1b7ade3d, 0x1b7ae2bd, 0x1b7b053d, 0x1b7b06bd, 0x1b7b073d,
+    0x1b7b0b3d, 0x1b7b0bbd, 0x1b7eaf7e, 0x1b7f2afd, 0x1b7f52fe, 0x1b7fb8bd, 0x1b7fdcbd, 0x1b80303d,
+    0x1b80957d, 0x1b80977d, 0x1b80bdfe, 0x1b80d17e, 0x1b80d1fd, 0x1b8146fd, 0x1b814b7d, 0x1b816efe,
+    0x1b85a6fe, 0x1b85e3bd, 0x1b86497d, 0x1b86c0fd, 0x1b87347e, 0x1b87647d, 0x1b87b17d, 0x1b87b47d,
+    0x1b87d67e, 0x1b8a8efd, 0x1b8b067d, 0x1b8b577e, 0x1b8c9d7d, 0x1b8caafd, 0x1b92777e, 0x1b9319fd,
+    0x1b93917d, 0x1b94097e, 0x1b9906be, 0x1b99083e, 0x1b9908bd, 0x1b99437d, 0x1b99457d, 0x1b9995fe,
+    0x1b99b6da, 0x1b9a733e, 0x1b9a74be, 0x1b9a753d, 0x1b9a82fd, 0x1b9a877d, 0x1b9aa9d6, 0x1b9aad56,
+    0x1b9ae83d, 0x1b9aecbd, 0x1b9aeebd, 0x1b9af7d2, 0x1b9afad2, 0x1b9aff52, 0x1b9b10be, 0x1b9b153e,
+    0x1b9b16be, 0x1b9eb8be, 0x1b9eba3e, 0x1b9ebabd, 0x1b9f323d, 0x1b9f343d, 0x1b9f5abe, 0x1b9f5c3e,
+    0x1b9f5cbd, 0x1b9f6e3e, 0x1b9f6ebd, 0x1b9f703d, 0x1b9f997d, 0x1b9fc1fd, 0x1ba09ebd, 0x1ba0a0bd,
+    0x1ba0c73e, 0x1ba0c8be, 0x1ba0c93d, 0x1ba0dabe, 0x1ba0db3d, 0x1ba0dcbd, 0x1ba13c3d, 0x1ba140bd,
+    0x1ba142bd, 0x1ba14e3d, 0x1ba1503d, 0x1ba154bd, 0x1ba176be, 0x1ba1783e, 0x1ba178bd, 0x1ba17cbe,
+    0x1ba17d3d, 0x1ba651fd, 0x1bab893e, 0x1bab8abe, 0x1bab8b3d, 0x1bac02bd, 0x1bac043d, 0x1bac04bd,
+    0x1bac2b3e, 0x1bac2cbe, 0x1bac3ebe, 0x1bac3f3d, 0x1bac40bd, 0x1bac91fd, 0x1bacb67d, 0x1bad057d,
+    0x1bad09fd, 0x1bad2c7d, 0x1bad6abd, 0x1bad6f3d, 0x1bad70bd, 0x1bad713d, 0x1bad7a7e, 0x1bad933e,
+    0x1bad97be, 0x1bad993e, 0x1bada53e, 0x1bada6be, 0x1bada73d, 0x1badab3e, 0x1badabbd, 0x1badad3d,
+    0x1bae0cbd, 0x1bae113d, 0x1bae12bd, 0x1bae1ebd, 0x1bae203d, 0x1bae20bd, 0x1bae24bd, 0x1bae253d,
+    0x1bae26bd, 0x1bae473e, 0x1bae48be, 0x1bae4d3e, 0x1bb0fbfd, 0x1bb14f7d, 0x1bb1767d, 0x1bb1b4bd,
+    0x1bb1b63d, 0x1bb1b6bd, 0x1bb1dd3e, 0x1bb1debe, 0x1bb1df3d, 0x1bb1f0be, 0x1bb1f13d, 0x1bb1f2bd,
+    0x1bb256bd, 0x1bb2583d, 0x1bb258bd, 0x1bb26a3d, 0x1bb26abd, 0x1bb26c3d, 0x1bb292be, 0x1bb2933d,
+    0x1bb294bd, 0x1bb2a6bd, 0x1bb3003e, 0x1bb3093e, 0x1bb317fd, 0x1bb33cbe, 0x1bb345be, 0x1bb36b7d,
+    0x1bb3927d, 0x1bb3bebd, 0x1bb3c33d, 0x1bb3c4bd, 0x1bb3c53d, 0x1bb3d0bd, 0x1bb3d23d, 0x1bb3d2bd,
+    0x1bb3d6bd, 0x1bb3d73d, 0x1bb3d8bd, 0x1bb3f93e, 0x1bb3fabe, 0x1bb3fb3d, 0x1bb3ff3e, 0x1bb3ffbd,
+    0x1bb4013d, 0x1bb40cbe, 0x1bb40d3d, 0x1bb40ebd, 0x1bb4133d, 0x1bb42fbe, 0x1bb438be, 0x1bb43dfe,
+    0x1bb44b7e, 0x1bb46bfe, 0x1bb46d7e, 0x1bb46dfe, 0x1bb472bd, 0x1bb4743d, 0x1bb474bd, 0x1bb478bd,
+    0x1bb4793d, 0x1bb4863d, 0x1bb486bd, 0x1bb4883d, 0x1bb48cbd, 0x1bb49c7e, 0x1bb4a87e, 0x1bb4a9fe,
+    0x1bb4b0bd, 0x1bb57cbe, 0x1bb66fbe, 0x1bb6c0be, 0x1bb6fcfd, 0x1bb702fd, 0x1bb723fd, 0x1bb7277d,
+    0x1bb72a7d, 0x1bb73bca, 0x1bb7623d, 0x1bb766bd, 0x1bb78abd, 0x1bb78f3d, 0x1bb790bd, 0x1bb79e3d,
+    0x1bb79ebd, 0x1bb7a33d, 0x1bb7a4bd, 0x1bb7e1bd, 0x1bb7e23d, 0x1bb81a8a, 0x1bb832bd, 0x1bb8430a,
+    0x1bb8823d, 0x1bb883bd, 0x1bb8913d, 0x1bb891bd, 0x1bb895bd, 0x1bb8963d, 0x1bb897bd, 0x1bb8aabd,
+    0x1bb8bc8a, 0x1bb8e8bd, 0x1bb91f7d, 0x1bb9237e, 0x1bb9327d, 0x1bb95f7e, 0x1bb970bd, 0x1bb9753e,
+    0x1bb990be, 0x1bb999be, 0x1bb9acbd, 0x1bb9b1be, 0x1bb9d77e, 0x1bb9dafe, 0x1bb9f03e, 0x1bb9f0be,
+    0x1bba83be, 0x1bba8cbe, 0x1bba9e3d, 0x1bba9fbd, 0x1bbaa43e, 0x1bbaa4be, 0x1bbab196, 0x1bbab216,
+    0x1bbab396, 0x1bbac6bd, 0x1bbb0492, 0x1bbb6bbe, 0x1bbd8dbd, 0x1bbd923d, 0x1bbd93bd, 0x1bbd943d,
+    0x1bbe05bd, 0x1bbec37d, 0x1bbec3fd, 0x1bbf36fd, 0x1bbf3b7d, 0x1bbf5f7d, 0x1bbf63fd, 0x1bbf657d,
+    0x1bbf72fd, 0x1bbf737d, 0x1bbf777d, 0x1bbf77fd, 0x1bbf797d, 0x1bbf9c3d, 0x1bbfb03d, 0x1bc0f23d,
+    0x1bc1457d, 0x1bc1577d, 0x1bc17ffd, 0x1bc1817d, 0x1bc1bfbe, 0x1bc224be, 0x1bc317be, 0x1bc3a57e,
+    0x1bc3b6be, 0x1bc3f5bd, 0x1bc4463d, 0x1bc45d3d, 0x1bc4603d, 0x1bc5177d, 0x1bc517fd, 0x1bc52b7d,
+    0x1bc5503d, 0x1bc5533d, 0x1bc55ebd, 0x1bc58afd, 0x1bc58f7d, 0x1bc59cfd, 0x1bc5c57d, 0x1bc5c6fd,
+    0x1bc5c77d, 0x1bc5cb7d, 0x1bc5cbfd, 0x1bc5cd7d, 0x1bc5d8fd, 0x1bc5d97d, 0x1bc6043d, 0x1bc6757e,
+    0x1bc67e7e, 0x1bc68fbe, 0x1bc7687e, 0x1bc7717e, 0x1bc7ab7d, 0x1bc7d3be, 0x1bc7e77d, 0x1bc7e7fd,
+    0x1bc7e97d, 0x1bca62bd, 0x1bca64bd, 0x1bcab53d, 0x1bcb93fd, 0x1bcb947d, 0x1bcba23d, 0x1bcbc93d,
+    0x1bcc077d, 0x1bcc0bfd, 0x1bcc2ffd, 0x1bcc347d, 0x1bcc35fd, 0x1bcc437d, 0x1bcc43fd, 0x1bcc47fd,
+    0x1bcc487d, 0x1bcc49fd, 0x1bcc5b7e, 0x1bcc713e, 0x1bcc99be, 0x1bcd0f7e, 0x1bcd153e, 0x1bcda2fe,
+    0x1bcdb67e, 0x1bcdc4bd, 0x1bce15fd, 0x1bce1a7e, 0x1bce27fd, 0x1bce507d, 0x1bce51fd, 0x1bce56fe,
+    0x1bd1447d, 0x1bd145fd, 0x1bd1467d, 0x1bd232fd, 0x1bd2377d, 0x1bd2397d, 0x1bd289fd, 0x1bd2aafd,
+    0x1bd4417d, 0x1bd45356, 0x1bd45556, 0x1bd79a7d, 0x1bd86e3d, 0x1bd886fd, 0x1bd88d7d, 0x1bd8953d,
+    0x1bd898fd, 0x1bd89afd, 0x1bd8af7d, 0x1bd8d37d, 0x1bd8e9fd, 0x1bd8eb7d, 0x1bd8fbfd, 0x1bd90f7d,
+    0x1bd90ffd, 0x1bdaa97d, 0x1bdb74be, 0x1bdbc5be, 0x1bdcb8be, 0x1bddb13d, 0x1bde24bd, 0x1bde4bbd,
+    0x1bde89fd, 0x1bde8ffd, 0x1bdeb27d, 0x1bdec5fd, 0x1bdec67d, 0x1bdf31fd, 0x1bdf3f7d, 0x1bdf43fd,
+    0x1bdf88be, 0x1bdf91be, 0x1bdfcd3d, 0x1be046bd, 0x1be0473d, 0x1be05a3d, 0x1be0987d, 0x1be09e7e,
+    0x1be0abfd, 0x1be0d47d, 0x1be0e87d, 0x1be14dfd, 0x1be15ffd, 0x1be1b4be, 0x1be219fe, 0x1be2427e,
+    0x1be2567e, 0x1be3357e, 0x1be3497e, 0x1be441fd, 0x1be4b57d, 0x1be5067d, 0x1be52d7d, 0x1be585fd,
+    0x1be5dcbe, 0x1be5e5be, 0x1be6197e, 0x1be6227e, 0x1be65dfd, 0x1be6c3fd, 0x1be6d77d, 0x1be6d7fd,
+    0x1be6ec7d, 0x1be7196a, 0x1be7287d, 0x1be741ea, 0x1be7493e, 0x1be7523e, 0x1be755ea, 0x1be7a1fd,
+    0x1be8bbbe, 0x1bea7d2a, 0x1beaa3ea, 0x1beaa9ea, 0x1beb1d6a, 0x1beb5bea, 0x1beb6dea, 0x1bebfe6a,
+    0x1bec016a, 0x1becb26a, 0x1becd8be, 0x1bed29ea, 0x1bed2bea, 0x1bed3d6a, 0x1bed3dea, 0x1bed526a,
+    0x1bed546a, 0x1bed6a6a, 0x1bed6d6a, 0x1bed8eea, 0x1beda9ea, 0x1bedb76a, 0x1bf0cfbd, 0x1bf0d5bd,
+    0x1bf1273d, 0x1bf14b3d, 0x1bf14e3d, 0x1bf2057d, 0x1bf205fd, 0x1bf213bd, 0x1bf278fd, 0x1bf27d7d,
+    0x1bf2a17d, 0x1bf2a5fd, 0x1bf2a77d, 0x1bf2b4fd, 0x1bf2b57d, 0x1bf2b97d, 0x1bf2b9fd, 0x1bf2bb7d,
+    0x1bf2cb7e, 0x1bf2de3d, 0x1bf2e43e, 0x1bf3077e, 0x1bf342bd, 0x1bf3433d, 0x1bf359be, 0x1bf3863e,
+    0x1bf413fe, 0x1bf4147e, 0x1bf43a3e, 0x1bf4763e, 0x1bf4877d, 0x1bf48bfe, 0x1bf4997d, 0x1bf4c1fd,
+    0x1bf4c37d, 0x1bf4c7fe, 0x1bf4c87e, 0x1bf7b17d, 0x1bf7b77d, 0x1bf7b7fd, 0x1bf8a47d, 0x1bf8a8fd,
+    0x1bf8aa7d, 0x1bf9977d, 0x1bf9bffd, 0x1bf9d35a, 0x1bf9d3da, 0x1bfa823e, 0x1bfa833e, 0x1bfa8b0a,
+    0x1bfa8c0a, 0x1bfab2fd, 0x1bfac4d6, 0x1bfac656, 0x1bfac6d6, 0x1bfd77bd, 0x1bfddcfd, 0x1bfe057d,
+    0x1bfe0bfd, 0x1bfe18fd, 0x1bfe197d, 0x1bff0a7d, 0x1bff5b7d, 0x1bff73fd, 0x1bff76fd, 0x1c0027fd,
+    0x1c023d3d, 0x1c031bfd, 0x1c0487fd, 0x1c04887d, 0x1c0574fd, 0x1c05797d, 0x1c05cbfd, 0x1c05cc7d,
+    0x1c06967e, 0x1c0696fe, 0x1c07387e, 0x1c07723e, 0x1c07837d, 0x1c0787fe, 0x1c0796d6, 0x1c079756,
+    0x1c07abfd, 0x1c07b07e, 0x1c07e7d2, 0x1c07e852, 0x1c08cd7d, 0x1c08cdfd, 0x1c09ba7d, 0x1c09befd,
+    0x1c0a0b7d, 0x1c0c56bd, 0x1c0c5b3d, 0x1c0c5cbd, 0x1c0c5d3d, 0x1c0c997e, 0x1c0cea7e, 0x1c0ceafe,
+    0x1c0d0e5a, 0x1c0dc93e, 0x1c0dc9be, 0x1c0dd77d, 0x1c0ddbfe, 0x1c0e02d6, 0x1c0e3cbd, 0x1c0e413e,
+    0x1c0e653d, 0x1c0e69be, 0x1c0e6b3e, 0x1c0f21fd, 0x1c108dfe, 0x1c108e7e, 0x1c120ebd, 0x1c120f3d,
+    0x1c121cfd, 0x1c1240fd, 0x1c1243fd, 0x1c12823d, 0x1c1286bd, 0x1c12aabd, 0x1c12af3d, 0x1c12b0bd,
+    0x1c12b13d, 0x1c12bcbd, 0x1c12be3d, 0x1c12bebd, 0x1c12c2bd, 0x1c12c33d, 0x1c12c4bd, 0x1c141d3e,
+    0x1c141dbe, 0x1c14313e, 0x1c1490bd, 0x1c14953e, 0x1c14a2bd, 0x1c14cb3d, 0x1c14ccbd, 0x1c14cd3d,
+    0x1c14d13e, 0x1c14d1be, 0x1c1783fd, 0x1c17f77d, 0x1c18c7fd, 0x1c19927e, 0x1c199ffd, 0x1c1a05fd,
+    0x1c1a197d, 0x1c1a2e7d, 0x1c1a347e, 0x1c1a6a7d, 0x1c1a6afd, 0x1c1ae3fd, 0x1c1d347e, 0x1c1d35fe,
+    0x1c1d5cfe, 0x1c1d5e7e, 0x1c1ed93d, 0x1c1edf3d, 0x1c1edfbd, 0x1c1eed7d, 0x1c1f52bd, 0x1c1f573d,
+    0x1c1f58bd, 0x1c1f7b3d, 0x1c1f7fbd, 0x1c1f813d, 0x1c1f8ebd, 0x1c1f8f3d, 0x1c1f933d, 0x1c1f93bd,
+    0x1c1f953d, 0x1c2059fd, 0x1c20bf3d, 0x1c20c53e, 0x1c20e7bd, 0x1c20edbe, 0x1c20fb3d, 0x1c20fbbd,
+    0x1c2101be, 0x1c21613d, 0x1c2165be, 0x1c21673e, 0x1c21733d, 0x1c2174bd, 0x1c21793e, 0x1c219bbd,
+    0x1c219d3d, 0x1c21a1be, 0x1c21db7e, 0x1c21f31a, 0x1c22407e, 0x1c22441a, 0x1c23373e, 0x1c2384be,
+    0x1c23887e, 0x1c2389fe, 0x1c23c13e, 0x1c23c4fe, 0x1c23c67e, 0x1c23d27e, 0x1c23d87e, 0x1c249f7d,
+    0x1c2504bd, 0x1c250abd, 0x1c252d3d, 0x1c25333d, 0x1c2533bd, 0x1c2540bd, 0x1c25413d, 0x1c25473d,
+    0x1c25a6bd, 0x1c25ab3d, 0x1c25acbd, 0x1c25b8bd, 0x1c25ba3d, 0x1c25bebd, 0x1c25e13d, 0x1c25e2bd,
+    0x1c25e33d, 0x1c25e73d, 0x1c25e7bd, 0x1c25e93d, 0x1c25f4bd, 0x1c25f53d, 0x1c25f6bd, 0x1c25fb3d,
+    0x1c26101a, 0x1c262b1a, 0x1c2654be, 0x1c265dbe, 0x1c26615a, 0x1c267c1a, 0x1c26913e, 0x1c269a3e,
+    0x1c269dda, 0x1c26ab5a, 0x1c26b15a, 0x1c270c7e, 0x1c27133d, 0x1c27154a, 0x1c27193e, 0x1c2726bd,
+    0x1c274f3d, 0x1c274fbd, 0x1c2755be, 0x1c27633d, 0x1c276f3e, 0x1c279e7e, 0x1c27c07e, 0x1c27c73d,
+    0x1c27c8bd, 0x1c27dabd, 0x1c27ef7e, 0x1c27fcfe, 0x1c28033d, 0x1c2803bd, 0x1c28053d, 0x1c2857be,
+    0x1c28a8be, 0x1c299bbe, 0x1c29a0fe, 0x1c2a3c3e, 0x1c2ab8bd, 0x1c2abbbd, 0x1c2b0c3d, 0x1c2b717d,
+    0x1c2b737d, 0x1c2b99fe, 0x1c2badfd, 0x1c2c22fd, 0x1c2c277d, 0x1c2c4afe, 0x1c2c6bbe, 0x1c2c74be,
+    0x1c2cb0bd, 0x1c2d2ebe, 0x1c2d6a3e, 0x1c2d7ffe, 0x1c2d81fe, 0x1c2dbc7e, 0x1c2dd8fe, 0x1c2e083e,
+    0x1c2e35fe, 0x1c2e437d, 0x1c2e593e, 0x1c2f397e, 0x1c3017be, 0x1c301dbe, 0x1c302c7e, 0x1c3031be,
+    0x1c31257d, 0x1c319cfd, 0x1c32bfbe, 0x1c32c8be, 0x1c32cdfe, 0x1c32fc7e, 0x1c33057e, 0x1c33417d,
+    0x1c342c3e, 0x1c34353e, 0x1c3455be, 0x1c3469be, 0x1c3499fe, 0x1c349fe6, 0x1c34a5be, 0x1c34adfe,
+    0x1c34aebe, 0x1c34b3e6, 0x1c359ebe, 0x1c35cca6, 0x1c3685be, 0x1c36933e, 0x1c36e43e, 0x1c378ce6,
+    0x1c37aee6, 0x1c384066, 0x1c38e166, 0x1c38e466, 0x1c38e566, 0x1c392f7e, 0x1c399566, 0x1c39bbbe,
+    0x1c3a0ce6, 0x1c3a0ee6, 0x1c3a4ee6, 0x1c3ab03e, 0x1c3abdbe, 0x1c3b0166, 0x1c3b01fe, 0x1c3b07e6,
+    0x1c3b1566, 0x1c3b3dfe, 0x1c3df5fd, 0x1c3e6d7d, 0x1c3f6f7e, 0x1c408ffe, 0x1c40a47e, 0x1c4155fd,
+    0x1c41f8fe, 0x1c432e7e, 0x1c43a17e, 0x1c43a5fe, 0x1c43a7fe, 0x1c454f3e, 0x1c4550be, 0x1c45513d,
+    0x1c45c43d, 0x1c45c8bd, 0x1c45cabd, 0x1c45ecbe, 0x1c45f13e, 0x1c45f2be, 0x1c45f9fe, 0x1c46003e,
+    0x1c4600bd, 0x1c4604be, 0x1c46053d, 0x1c4606bd, 0x1c47353e, 0x1c47373e, 0x1c4771be, 0x1c47733e,
+    0x1c47d2bd, 0x1c47d73e, 0x1c47dffe, 0x1c47e4bd, 0x1c47e6bd, 0x1c47eb3e, 0x1c480d3e, 0x1c480ebe,
+    0x1c48b1fe, 0x1c49827e, 0x1c49a4fe, 0x1c49bdbe, 0x1c49f57e, 0x1c49f9fe, 0x1c49fbfe, 0x1c4a31fe,
+    0x1c4a32be, 0x1c4a367e, 0x1c4a37fe, 0x1c4a457e, 0x1c4b7abd, 0x1c4b7cbd, 0x1c4ba33e, 0x1c4ba4be,
+    0x1c4ba53d, 0x1c4bb73d, 0x1c4bb8bd, 0x1c4c183d, 0x1c4c1cbd, 0x1c4c1ebd, 0x1c4c2a3d, 0x1c4c2c3d,
+    0x1c4c30bd, 0x1c4c52be, 0x1c4c543e, 0x1c4c54bd, 0x1c4c58be, 0x1c4c593d, 0x1c4c5abd, 0x1c4c663e,
+    0x1c4c66bd, 0x1c4c683d, 0x1c4c6cbd, 0x1c4d02be, 0x1c4d0bbe, 0x1c4d893e, 0x1c4d8b3e, 0x1c4d9d3e,
+    0x1c4dc5be, 0x1c4dc73e, 0x1c4dd93e, 0x1c4df5be, 0x1c4dfdfe, 0x1c4dfebe, 0x1c4e03d6, 0x1c4e1156,
+    0x1c4e33fe, 0x1c4e38bd, 0x1c4e3abd, 0x1c4e4cbd, 0x1c4e627e, 0x1c4e6ffe, 0x1c4e74be, 0x1c4e753d,
+    0x1c4e76bd, 0x1c50343e, 0x1c50853e, 0x1c512de2, 0x1c51f6e2, 0x1c524962, 0x1c526b62, 0x1c5271e2,
+    0x1c528262, 0x1c528562, 0x1c52867e, 0x1c52d07e, 0x1c53ade2, 0x1c53c162, 0x1c53c1e2, 0x1c53d662,
+    0x1c53d862, 0x1c541262, 0x1c5412e2, 0x1c543b7e, 0x1c54513e, 0x1c548de2, 0x1c54a27e, 0x1c54b67e,
+    0x1c551d7e, 0x1c55317e, 0x1c55abbe, 0x1c56287e, 0x1c5629fe, 0x1c562a7e, 0x1c5650fe, 0x1c5664fe,
+    0x1c56667e, 0x1c56c5fe, 0x1c56c6be, 0x1c56ca7e, 0x1c56cbfe, 0x1c56d9fe, 0x1c56dabe, 0x1c56ddfe,
+    0x1c56de7e, 0x1c56dffe, 0x1c5701fe, 0x1c5715fe, 0x1c5846bd, 0x1c584b3d, 0x1c584cbd, 0x1c584d3d,
+    0x1c586f3e, 0x1c5873be, 0x1c58753e, 0x1c5882be, 0x1c58833d, 0x1c5887bd, 0x1c58893d, 0x1c58e8bd,
+    0x1c58ed3d, 0x1c58eebd, 0x1c58fabd, 0x1c58fc3d, 0x1c58fcbd, 0x1c5900bd, 0x1c59013d, 0x1c5902bd,
+    0x1c59293e, 0x1c59307e, 0x1c5931fe, 0x1c59373d, 0x1c593afe, 0x1c5a01fd, 0x1c5a553d, 0x1c5a59be,
+    0x1c5a5b3e, 0x1c5a673d, 0x1c5a68bd, 0x1c5a693d, 0x1c5a6d3e, 0x1c5a6dbe, 0x1c5a6f3e, 0x1c5a8fbe,
+    0x1c5a913e, 0x1c5a9cfe, 0x1c5a9e7e, 0x1c5aa33e, 0x1c5aa3bd, 0x1c5aa53d, 0x1c5aa77e, 0x1c5acdfe,
+    0x1c5ae1fe, 0x1c5b03fe, 0x1c5b093d, 0x1c5b0abd, 0x1c5b17fe, 0x1c5b1cbd, 0x1c5b1d3d, 0x1c5b1ebd,
+    0x1c5b453e, 0x1d116619, 0x1d11df95, 0x1d138219, 0x1d178f99, 0x1d179115, 0x1d179195, 0x1d17e211,
+    0x1d18438a, 0x1d18c0e5, 0x1d18c165, 0x1d18d3a6, 0x1d18faa6, 0x1d1938e6, 0x1d193ae6, 0x1d196166,
+    0x1d1962e6, 0x1d196366, 0x1d1974e6, 0x1d197566, 0x1d1976e6, 0x1d199995, 0x1d19a015, 0x1d19ab95,
+    0x1d19ad15, 0x1d19ad95, 0x1d19b21a, 0x1d19e609, 0x1d19e905, 0x1d1a3b91, 0x1d1a5f89, 0x1d1a6285,
+    0x1d1aa0e5, 0x1d1aa765, 0x1d1ac965, 0x1d1acf65, 0x1d1acfe5, 0x1d1adb69, 0x1d1adce5, 0x1d1add65,
+    0x1d1ae365, 0x1d1b0826, 0x1d1b42e5, 0x1d1b4766, 0x1d1b4966, 0x1d1b54e5, 0x1d1b56e5, 0x1d1b5b66,
+    0x1d1b7d65, 0x1d1b7ee5, 0x1d1b7f65, 0x1d1b83e6, 0x1d1de515, 0x1d1de595, 0x1d1e978a, 0x1d1eab89,
+    0x1d1eece5, 0x1d1f0f85, 0x1d1f1369, 0x1d1f14e5, 0x1d1f1565, 0x1d1f2769, 0x1d1f28e5, 0x1d1f4ea6,
+    0x1d1f8ce6, 0x1d1f8e66, 0x1d1f8ee6, 0x1d1fa0e6, 0x1d1fa266, 0x1d1fc8e6, 0x1d1fc966, 0x1d1fcae6,
+    0x1d1fdce6, 0x1d204e09, 0x1d20f4e5, 0x1d20f585, 0x1d20f969, 0x1d20fae5, 0x1d20fb65, 0x1d2108e5,
+    0x1d210ee5, 0x1d212f69, 0x1d2130e5, 0x1d213165, 0x1d213569, 0x1d2135e9, 0x1d213765, 0x1d214369,
+    0x1d2144e5, 0x1d214969, 0x1d21a8e5, 0x1d21aae5, 0x1d21bce5, 0x1d21be65, 0x1d21e4e5, 0x1d21e6e5,
+    0x1d259162, 0x1d2591e1, 0x1d260962, 0x1d260b61, 0x1d2631e1, 0x1d263361, 0x1d264562, 0x1d270c11,
+    0x1d273322, 0x1d277162, 0x1d2799e1, 0x1d279fe1, 0x1d27ad62, 0x1d27ade1, 0x1d281361, 0x1d2817e1,
+    0x1d282761, 0x1d2c34e9, 0x1d2c36e9, 0x1d2cbe29, 0x1d2ce229, 0x1d2ce529, 0x1d2d2369, 0x1d2d4be9,
+    0x1d2d5269, 0x1d2d5dda, 0x1d2d5f5a, 0x1d2d5fda, 0x1d2d645a, 0x1d2d9ce9, 0x1d2da369, 0x1d2e14e9,
+    0x1d2e3ee9, 0x1d2e4369, 0x1d2e5756, 0x1d31e8d5, 0x1d3288d5, 0x1d328ad5, 0x1d329cd5, 0x1d32c34a,
+    0x1d338b59, 0x1d33f0d5, 0x1d3404d5, 0x1d3426ce, 0x1d342fca, 0x1d3aa9e1, 0x1d3aade2, 0x1d3b5f61,
+    0x1d4047d9, 0x1d4059d9, 0x1d405b59, 0x1d405bd9, 0x1d405fda, 0x1d40605a, 0x1d408459, 0x1d4088da,
+    0x1d40f74e, 0x1d410dc9, 0x1d46afd9, 0x1d46c1d9, 0x1d46c359, 0x1d475d69, 0x1d475ecd, 0x1d475f4d,
+    0x1d4761c9, 0x1d4767c9, 0x1d4775c9, 0x1d4817c9, 0x1d4ad395, 0x1d4c0361, 0x1d4c7ae2, 0x1d4c7c62,
+    0x1d4c7ce6, 0x1d4ca366, 0x1d4cb6e2, 0x1d4cb766, 0x1d4e0b61, 0x1d4e1f61, 0x1d4e98fd, 0x1d4e9ce2,
+    0x1d51b4e5, 0x1d51b565, 0x1d52a666, 0x1d52a866, 0x1d531ce6, 0x1d532fa5, 0x1d5353a5, 0x1d5356a5,
+    0x1d535a25, 0x1d5394e5, 0x1d53bd65, 0x1d53c365, 0x1d53c3e5, 0x1d53cf5a, 0x1d53d0da, 0x1d53d15a,
+    0x1d540e65, 0x1d5414e5, 0x1d54b065, 0x1d54b4e6, 0x1d54c256, 0x1d54c8d6, 0x1d5808d9, 0x1d580959,
+    0x1d585a55, 0x1d58bb4a, 0x1d58be46, 0x1d58cf49, 0x1d58fa66, 0x1d58fbe6, 0x1d58fc66, 0x1d590e66,
+    0x1d590fe6, 0x1d5934ca, 0x1d597266, 0x1d59fcfd, 0x1d5a984e, 0x1d5aa14a, 0x1d5aa446, 0x1d5f76e2,
+    0x1d5f78e1, 0x1d5fed62, 0x1d60dee2, 0x1d6156e2, 0x1d6c0cbd, 0x1d6c1ed2, 0x1d6c863d, 0x1d6cacbd,
+    0x1d6cae3d, 0x1d6caebd, 0x1d6cc0bd, 0x1d6cc23d, 0x1d6d6049, 0x1d6d86d2, 0x1d6e14bd, 0x1d6e1abd,
+    0x1d6e1b3d, 0x1d6e28bd, 0x1d6e2ebd, 0x1d6e8e3d, 0x1d6e92bd, 0x1d6ea23d, 0x1d6ec8bd, 0x1d6eca3d,
+    0x1d6ecabd, 0x1d6ecebd, 0x1d6ecf3d, 0x1d73a1da, 0x1d79b555, 0x1d79bbda, 0x1d79c759, 0x1d79c8d5,
+    0x1d79cdda, 0x1d79ddd1, 0x1d7a01c9, 0x1d7a04c5, 0x1d7a085a, 0x1d7a30da, 0x1d7a5751, 0x1d7a7b49,
+    0x1d7a7e45, 0x1d7a81c9, 0x1d7abcbd, 0x1d7ac2bd, 0x1d7ac33d, 0x1d7ae53d, 0x1d7aeb3d, 0x1d7aebbd,
+    0x1d7af8bd, 0x1d7af93d, 0x1d7aff3d, 0x1d7b5ebd, 0x1d7b70bd, 0x1d7b723d, 0x1d7b72bd, 0x1d7b993d,
+    0x1d7b9abd, 0x1d7b9b3d, 0x1d810845, 0x1d8110bd, 0x1d8116bd, 0x1d81173d, 0x1d8124bd, 0x1d812abd,
+    0x1d814cbd, 0x1d814d3d, 0x1d81533d, 0x1d8160bd, 0x1d81c4bd, 0x1d81c63d, 0x1d81c6bd, 0x1d81d8bd,
+    0x1d81da3d, 0x1d8200bd, 0x1d82013d, 0x1d8202bd, 0x1d877d61, 0x1d878ae2, 0x1d8b22d9, 0x1d8b9a55,
+    0x1d8d3159, 0x1d8db655, 0x1d8dbcd5, 0x1d8e9966, 0x1d91ee55, 0x1d920255, 0x1d92667e, 0x1d94404d,
+    0x1d94424d, 0x1d944c45, 0x1d986ae2, 0x1d9f4cbe, 0x1d9f4e3e, 0x1d9f4ebd, 0x1d9f60d1, 0x1d9f87c5,
+    0x1d9fc63d, 0x1d9fc83d, 0x1d9feebe, 0x1d9ff03e, 0x1d9ff0bd, 0x1da0023e, 0x1da002bd, 0x1da0043d,
+    0x1da026d5, 0x1da02d55, 0x1da038d6, 0x1da03a56, 0x1da04f51, 0x1da07349, 0x1da07645, 0x1da0c8d1,
+    0x1da0ecc9, 0x1da0efc5, 0x1da12e3d, 0x1da132bd, 0x1da134bd, 0x1da156be, 0x1da15cbe, 0x1da15d3d,
+    0x1da168be, 0x1da16a3e, 0x1da16abd, 0x1da16f3d, 0x1da170bd, 0x1da19549, 0x1da1d03d, 0x1da1d4bd,
+    0x1da1d6bd, 0x1da1e23d, 0x1da1e43d, 0x1da1e8bd, 0x1da20abe, 0x1da20c3e, 0x1da20cbd, 0x1da2113d,
+    0x1da57a3d, 0x1da5a23e, 0x1da5a2bd, 0x1da61a3d, 0x1da61c3d, 0x1da62e3d, 0x1da6563e, 0x1da656bd,
+    0x1da6583d, 0x1da66a3d, 0x1da7823d, 0x1da786bd, 0x1da788bd, 0x1da7963d, 0x1da79abd, 0x1da7bcbe,
+    0x1da7be3e, 0x1da7bebd, 0x1da7c2be, 0x1da7c33d, 0x1da7c4bd, 0x1da7d0bd, 0x1da7d23d, 0x1da7d6bd,
+    0x1da8363d, 0x1da8383d, 0x1da83cbd, 0x1da84a3d, 0x1da8723e, 0x1da8743d, 0x1db452bd, 0x1db4573d,
+    0x1db458bd, 0x1db4593d, 0x1db464bd, 0x1db4663d, 0x1db466bd, 0x1db46abd, 0x1db46b3d, 0x1db46cbd,
+    0x1db48ebe, 0x1db48f3d, 0x1db4933e, 0x1db493bd, 0x1db4953d, 0x1db4a0be, 0x1db4a13d, 0x1db4a2bd,
+    0x1db4a73d, 0x1db506bd, 0x1db5083d, 0x1db508bd, 0x1db51a3d, 0x1db51abd, 0x1db51c3d, 0x1db544bd,
+    0x1db9fc05, 0x1dba0519, 0x1dba08d9, 0x1dba0a59, 0x1dba83d5, 0x1dbab3cd, 0x1dbab8bd, 0x1dbaba3d,
+    0x1dbababd, 0x1dbabcc9, 0x1dbabebd, 0x1dbabf3d, 0x1dbabfc5, 0x1dbaccbd, 0x1dbace3d, 0x1dbad2bd,
+    0x1dbaefcd, 0x1dbaf4be, 0x1dbaf53d, 0x1dbaf6bd, 0x1dbafb3d, 0x1dbb67cd, 0x1dbb694d, 0x1dbb6c49,
+    0x1dbb6e3d, 0x1dbb6ebd, 0x1dbb6f45, 0x1dc26795, 0x1dc2a5c9, 0x1dc2a8c5, 0x1dc2b891, 0x1dc2ce49,
+    0x1dc2d145, 0x1dc3aba5, 0x1dc3c165, 0x1dc3c465, 0x1dc3d4e5, 0x1dc410e5, 0x1dc414a5, 0x1dc41626,
+    0x1dc43965, 0x1dc43d25, 0x1dc43ea5, 0x1dc47c15, 0x1dc4f109, 0x1dc4f405, 0x1dc5abe5, 0x1dc5e426,
+    0x1dc5e726, 0x1dc62566, 0x1dc65b65, 0x1dc65fe6, 0x1dc66166, 0x1dc6680d, 0x1dc67125, 0x1dc67b85,
+    0x1dc684bd, 0x1dc689fd, 0x1dc69815, 0x1dc6a4cd, 0x1dc6e9fd, 0x1dc6edbd, 0x1dc6ef26, 0x1dc6f5cd,
+    0x1dc70945, 0x1dc7127d, 0x1dc7163d, 0x1dc717bd, 0x1dc72519, 0x1dc7c7e5, 0x1dc7d48d, 0x1dc7ddbd,
+    0x1dc7e8cd, 0x1dc7fc4d, 0x1dc80495, 0x1dc81815, 0x1dc83a8d, 0x1dc84165, 0x1dc84e26, 0x1dc85726,
+    0x1dc86911, 0x1dc8768d, 0x1dc87be5, 0x1dc87c85, 0x1dc87d65, 0x1dc8bb99, 0x1dc9736a, 0x1dc97645,
+    0x1dc9eb45, 0x1dc9f09d, 0x1dccf8cd, 0x1dcd7919, 0x1dcdb77d, 0x1dcdbcbd, 0x1dce31bd, 0x1dce6c15,
+    0x1dcea226, 0x1dd1e811, 0x1dd24d62, 0x1dd275e1, 0x1dd289e1, 0x1dd40a15, 0x1dd40a91, 0x1dd41d85,
+    0x1dd45be1, 0x1dd46de2, 0x1dd46fe1, 0x1dd49669, 0x1dd497e1, 0x1dd49861, 0x1dd4a9e2, 0x1dd4aa69,
+    0x1dd4abe1, 0x1dd5a1c9, 0x1dd5a4c5, 0x1dd5e319, 0x1dd60b99, 0x1dd619d9, 0x1dd61d99, 0x1dd61f19,
+    0x1dd6d189, 0x1dd6d485, 0x1dd6e5c9, 0x1dd6e8c5, 0x1dd6fe95, 0x1dd70cc5, 0x1dd71095, 0x1dd71216,
+    0x1dd74b09, 0x1dd74e06, 0x1dd75dd1, 0x1dd76191, 0x1dd76311, 0x1dd77389, 0x1dd77685, 0x1dd7871d,
+    0x1dd82e59, 0x1dd878d5, 0x1dd8c9d1, 0x1dd92155, 0x1dd9a005, 0x1dd9a905, 0x1dd9ae69, 0x1dd9dcc5,
+    0x1dd9e9bd, 0x1dd9eb16, 0x1dda1b0d, 0x1dda243d, 0x1dda2706, 0x1dda438d, 0x1dda4a59, 0x1dda4cbd,
+    0x1dda5719, 0x1dda8755, 0x1dda9969, 0x1dda9ad5, 0x1dda9b55, 0x1ddaafd1, 0x1ddadefd, 0x1ddaebd1,
+    0x1ddb077d, 0x1ddb0c85, 0x1ddb15bd, 0x1ddb196a, 0x1ddb1afd, 0x1ddb29fd, 0x1ddb2dbd, 0x1ddb2f16,
+    0x1ddb368d, 0x1ddb3d55, 0x1ddb3fbd, 0x1ddb42bd, 0x1ddb4a16, 0x1ddb5316, 0x1ddb6b06, 0x1ddb80fd,
+    0x1ddb8606, 0x1ddb8e69, 0x1ddb8f06, 0x1ddb92fd, 0x1ddbae85, 0x1ddbb6e9, 0x1ddbb7bd, 0x1ddbbb7d,
+    0x1ddbbcfd, 0x1ddbf5c9, 0x1ddbf8c5, 0x1ddc3719, 0x1ddc6dc5, 0x1ddc7199, 0x1ddc7319, 0x1ddd60c5,
+    0x1ddd6495, 0x1ddd6616, 0x1ddd9f09, 0x1ddda206, 0x1ddddb09, 0x1ddee0d5, 0x1de030c5, 0x1de039fd,
+    0x1de03dbd, 0x1de03f16, 0x1de06f0d, 0x1de0783d, 0x1de0a98d, 0x1de0ab0d, 0x1de0b43d, 0x1de0ed69,
+    0x1de0ef55, 0x1de132fd, 0x1de16d6a, 0x1de16efd, 0x1de19e16, 0x1de1a716, 0x1de1da06, 0x1de1e269,
+    0x1de1e6fd, 0x1de21ce9, 0x1de21e69, 0x1de222fd, 0x1de8b099, 0x1de8c659, 0x1de8c959, 0x1de90799,
+    0x1de915d9, 0x1de91999, 0x1de91b19, 0x1de93e59, 0x1de94219, 0x1de94399, 0x1de96849, 0x1de96b45,
+    0x1de98115, 0x1de98f45, 0x1de9932a, 0x1de99495, 0x1de9cdaa, 0x1de9d085, 0x1de9e045, 0x1de9e42a,
+    0x1de9e591, 0x1de9f609, 0x1de9f905, 0x1dea0989, 0x1dea17c9, 0x1dea1ac5, 0x1dea3095, 0x1dea3ec5,
+    0x1dea4295, 0x1dea4415, 0x1dea7d09, 0x1dea8005, 0x1dea8fc5, 0x1dea9391, 0x1dea9511, 0x1deaa589,
+    0x1deaa885, 0x1deab90a, 0x1dece069, 0x1decedcd, 0x1ded014d, 0x1ded0995, 0x1ded1d15, 0x1ded3f8d,
+    0x1ded51aa, 0x1ded530d, 0x1ded6e11, 0x1ded7a0d, 0x1ded7b8d, 0x1ded8185, 0x1dedac7d, 0x1dedb02a,
+    0x1dedb1bd, 0x1dedbfd5, 0x1dedc23d, 0x1dedc53d, 0x1dedd5bd, 0x1dee037d, 0x1dee11bd, 0x1dee156a,
+    0x1dee16fd, 0x1dee26bd, 0x1dee3a3d, 0x1dee3dea, 0x1dee3f7d, 0x1dee4ce9, 0x1dee516a, 0x1dee5bc5,
+    0x1dee5f91, 0x1dee6111, 0x1dee7189, 0x1dee7485, 0x1dee850a, 0x1deeb2e9, 0x1deec105, 0x1deec4e9,
+    0x1deec669, 0x1deed60a, 0x1deee985, 0x1deeed69, 0x1deeeee9, 0x1defe36a, 0x1defe8a9, 0x1df05da9,
+    0x1df284e9, 0x1df37129, 0x1df3a5aa, 0x1df420a9, 0x1df4696a, 0x1df4a0e9, 0x1df4d90a, 0x1df518e9,
+    0x1df51a69, 0x1dfe9fd9, 0x1dfead59, 0x1e0007e6, 0x1e000ae6, 0x1e00bbd9, 0x1e01aed5, 0x1e032216,
+    0x1e03970a, 0x1e07630a, 0x1e07a47e, 0x1e0bbae2, 0x1e0dc955, 0x1e0ddce2, 0x1e0ddd55, 0x1e0df1d1,
+    0x1e0e2dd1, 0x1e0e2e51, 0x1e0f2191, 0x1e0f4589, 0x1e0f4885, 0x1e0f4d19, 0x1e0f86d9, 0x1e0f8b59,
+    0x1e0f8d7d, 0x1e0faf59, 0x1e0fb3d9, 0x1e0fb559, 0x1e0fb5d9, 0x1e0fbd85, 0x1e0fc159, 0x1e0fc2d9,
+    0x1e0fc359, 0x1e0fc589, 0x1e0fc759, 0x1e0fc7d9, 0x1e100055, 0x1e100109, 0x1e100655, 0x1e1006d5,
+    0x1e103f4a, 0x1e104246, 0x1e107549, 0x1e107845, 0x1e107b49, 0x1e107bc9, 0x1e10805d, 0x1e10a6d5,
+    0x1e10b455, 0x1e10ba55, 0x1e10bade, 0x1e10eec9, 0x1e10f645, 0x1e10f9fe, 0x1e11225d, 0x1e112b5e,
+    0x1e112c5e, 0x1e11345d, 0x1e116cd5, 0x1e117159, 0x1e1172d5, 0x1e117355, 0x1e11a2ce, 0x1e11c3d1,
+    0x1e11dd59, 0x1e11decd, 0x1e11df4d, 0x1e11e1c9, 0x1e11e7c9, 0x1e11e849, 0x1e121c4e, 0x1e12254a,
+    0x1e122846, 0x1e129445, 0x1e129cbd, 0x1e12a2bd, 0x1e12a33d, 0x1e12b551, 0x1e12d04d, 0x1e12dc45,
+    0x1e13163d, 0x1e131abd, 0x1e131cbd, 0x1e133ebd, 0x1e13433d, 0x1e1344bd, 0x1e13453d, 0x1e134bcd,
+    0x1e1350bd, 0x1e13523d, 0x1e1352bd, 0x1e1354c9, 0x1e1356bd, 0x1e13573d, 0x1e1358bd, 0x1e137b55,
+    0x1e138d59, 0x1e138ed5, 0x1e1393fe, 0x1e13a3d1, 0x1e13c7c9, 0x1e13cac5, 0x1e13ce7e, 0x1e13d2fe,
+    0x1e13f6fe, 0x1e140d5a, 0x1e141d51, 0x1e144149, 0x1e144445, 0x1e1447fe, 0x1e1482bd, 0x1e14893e,
+    0x1e14ab3d, 0x1e14b13e, 0x1e14b1be, 0x1e14b84d, 0x1e14bebd, 0x1e14bf3d, 0x1e14c14a, 0x1e14e9fe,
+    0x1e1516fe, 0x1e1524bd, 0x1e15293e, 0x1e1531fe, 0x1e1536bd, 0x1e153afe, 0x1e153d3e, 0x1e155a4d,
+    0x1e155f3d, 0x1e1560bd, 0x1e15613d, 0x1e1565be, 0x1e161989, 0x1e16d45d, 0x1e174dfe, 0x1e17885d,
+    0x1e1789dd, 0x1e18f0bd, 0x1e18f6bd, 0x1e18f73d, 0x1e1904bd, 0x1e190abd, 0x1e196a3d, 0x1e196ebd,
+    0x1e19a4bd, 0x1e19a63d, 0x1e19a6bd, 0x1e19aabd, 0x1e19ab3d, 0x1e19acbd, 0x1e19b8bd, 0x1e19ba3d,
+    0x1e19bebd, 0x1e1a615a, 0x1e1ad6bd, 0x1e1aeabd, 0x1e1b0c4d, 0x1e1b12bd, 0x1e1b133d, 0x1e1b26bd,
+    0x1e1b85fe, 0x1e1b8abd, 0x1e1bc04d, 0x1e1bc1cd, 0x1e1bc6bd, 0x1e1bc73d, 0x1e1bc8bd, 0x1e22c1be,
+    0x1e22ea19, 0x1e237c7e, 0x1e23a4dd, 0x1e24545d, 0x1e2598bd, 0x1e259ebd, 0x1e25c13d, 0x1e25c73d,
+    0x1e25c7bd, 0x1e25d4bd, 0x1e25d53d, 0x1e25db3d, 0x1e263abd, 0x1e264cbd, 0x1e264e3d, 0x1e26753d,
+    0x1e2676bd, 0x1e26773d, 0x1e26893d, 0x1e27095a, 0x1e27a73d, 0x1e27ad3e, 0x1e27babd, 0x1e27bd4a,
+    0x1e27dccd, 0x1e27e33d, 0x1e27e3bd, 0x1e27e5ca, 0x1e27e9be, 0x1e27f04d, 0x1e27f73d, 0x1e285b3d,
+    0x1e285cbd, 0x1e285d3d, 0x1e28687e, 0x1e286ebd, 0x1e289549, 0x1e28973d, 0x1e2897bd, 0x1e28993d,
+    0x1e28d75a, 0x1e2915be, 0x1e2918be, 0x1e298f0a, 0x1e299216, 0x1e29d05e, 0x1e2a070a, 0x1e2a0c5d,
+    0x1e2a3e89, 0x1e2a4185, 0x1e2ab685, 0x1e2ab9dd, 0x1e2aba5d, 0x1e2abbdd, 0x1e2b25d2, 0x1e2b37da,
+    0x1e2bd9d2, 0x1e2c28bd, 0x1e2c3cbd, 0x1e2ca0bd, 0x1e2ca23d, 0x1e2d50be, 0x1e2d5d5a, 0x1e2d94d9,
+    0x1e2dd30a, 0x1e2dd87d, 0x1e2e0ebd, 0x1e2e147e, 0x1e2e444d, 0x1e2e4b3d, 0x1e2e4d4a, 0x1e2e8285,
+    0x1e2e8655, 0x1e2e87d5, 0x1e2ebc7e, 0x1e2ec2bd, 0x1e2efcca, 0x1e359385, 0x1e3598d1, 0x1e35a949,
+    0x1e35ac45, 0x1e35bcd5, 0x1e35f8c5, 0x1e35fc99, 0x1e35fe26, 0x1e360dd1, 0x1e362145, 0x1e362519,
+    0x1e362699, 0x1e3700e5, 0x1e371465, 0x1e371825, 0x1e3719a5, 0x1e372715, 0x1e376626, 0x1e377811,
+    0x1e378ea5, 0x1e397566, 0x1e397866, 0x1e39c365, 0x1e39d0cd, 0x1e39d9fd, 0x1e39e445, 0x1e39ed7d,
+    0x1e39f13d, 0x1e39f2bd, 0x1e3a0015, 0x1e3a228d, 0x1e3a2959, 0x1e3a2bbd, 0x1e3a3626, 0x1e3a3f26,
+    0x1e3a5111, 0x1e3a5e8d, 0x1e3a67bd, 0x1e3af87d, 0x1e3b20fd, 0x1e3b227d, 0x1e3b2fe5, 0x1e3b4411,
+    0x1e3b518d, 0x1e3b5785, 0x1e3b95e5, 0x1e3ba966, 0x1e3bd1e5, 0x1e3cc665, 0x1e3ccba5, 0x1e3d40a5,
+    0x1e3f67e5, 0x1e405425, 0x1e408a26, 0x1e4183e5, 0x1e41fd66, 0x1e477155, 0x1e478555, 0x1e4799d1,
+    0x1e47d5fe, 0x1e47d651, 0x1e48e695, 0x1e48f4c5, 0x1e48f895, 0x1e48fa16, 0x1e493309, 0x1e493606,
+    0x1e495b89, 0x1e495e85, 0x1e496f19, 0x1e49eddd, 0x1e4a165d, 0x1e4a2485, 0x1e4a285d, 0x1e4a29dd,
+    0x1e4a38c5, 0x1e4a3c91, 0x1e4a3e16, 0x1e4a4e89, 0x1e4a5185, 0x1e4a6216, 0x1e4a8fdd, 0x1e4a9d5d,
+    0x1e4a9e06, 0x1e4aa1dd, 0x1e4ab311, 0x1e4ac5dd, 0x1e4ac685, 0x1e4aca5d, 0x1e4acbdd, 0x1e4c0a3d,
+    0x1e4c0ebd, 0x1e4c10bd, 0x1e4c32be, 0x1e4c393d, 0x1e4c46bd, 0x1e4c4b3d, 0x1e4c4cbd, 0x1e4cb0bd,
+    0x1e4cb2bd, 0x1e4cc4bd, 0x1e4ce8bd, 0x1e4ced3d, 0x1e4ceebd, 0x1e4cf3cd, 0x1e4cf54d, 0x1e4cfe49,
+    0x1e4d00bd, 0x1e4d1e8d, 0x1e4d3216, 0x1e4d3b16, 0x1e4d68fd, 0x1e4d6e06, 0x1e4d7659, 0x1e4d7afd,
+    0x1e4d9685, 0x1e4d9ed9, 0x1e4da37d, 0x1e4da4fd, 0x1e4dc551, 0x1e4e18bd, 0x1e4e1d3e, 0x1e4e1f3e,
+    0x1e4e25cd, 0x1e4e2abd, 0x1e4e2cbd, 0x1e4e4e4d, 0x1e4e533e, 0x1e4e54be, 0x1e4e553d, 0x1e4e59be,
+    0x1e4e5b3e, 0x1e4e604d, 0x1e4e61cd, 0x1e4e66be, 0x1e4e673d, 0x1e4e68bd, 0x1e4e6afd, 0x1e4e6d3e,
+    0x1e4e7f16, 0x1e4e8985, 0x1e4e91d5, 0x1e4e92bd, 0x1e4e967d, 0x1e4e97d6, 0x1e4ec7cd, 0x1e4eccbd,
+    0x1e4ecebd, 0x1e4ed0fd, 0x1e4ed9cd, 0x1e4ee0bd, 0x1e4f024d, 0x1e4f03cd, 0x1e4f093d, 0x1e4f0abd,
+    0x1e4f0cfd, 0x1e4f48c5, 0x1e4f4c95, 0x1e4f4e16, 0x1e4f8709, 0x1e4f8a06, 0x1e4fc309, 0x1e500089,
+    0x1e500396, 0x1e5041de, 0x1e507885, 0x1e507c5d, 0x1e507ddd, 0x1e50b616, 0x1e50ef5d, 0x1e50f15d,
+    0x1e50f5dd, 0x1e51035d, 0x1e512bdd, 0x1e512d5d, 0x1e5131dd, 0x1e52723d, 0x1e5276bd, 0x1e529f3d,
+    0x1e52a0bd, 0x1e5318bd, 0x1e53263d, 0x1e538616, 0x1e538f16, 0x1e53c206, 0x1e53ca59, 0x1e53cefd,
+    0x1e5404d9, 0x1e540659, 0x1e540afd, 0x1e5444bd, 0x1e54487d, 0x1e5449d6, 0x1e5479cd, 0x1e547ebd,
+    0x1e5480bd, 0x1e5485c6, 0x1e5492bd, 0x1e54b44d, 0x1e54b5cd, 0x1e54babe, 0x1e54bb3d, 0x1e54bcbd,
+    0x1e54befd, 0x1e54f956, 0x1e552dcd, 0x1e5534bd, 0x1e5c05d9, 0x1e5c1959, 0x1e5c1d19, 0x1e5c1e99,
+    0x1e5c5799, 0x1e5c5a99, 0x1e5c6b19, 0x1e5c9399, 0x1e5cbb45, 0x1e5cbf11, 0x1e5cc091, 0x1e5cd109,
+    0x1e5cd405, 0x1e5ce489, 0x1e5d125e, 0x1e5d1fdd, 0x1e5d2085, 0x1e5d245d, 0x1e5d25dd, 0x1e5d3589,
+    0x1e5d485d, 0x1e5d4905, 0x1e5d4cdd, 0x1e5d4e5d, 0x1e5d5a5d, 0x1e5d5bdd, 0x1e5d605d, 0x1e5d6ac5,
+    0x1e5d6e91, 0x1e5d7011, 0x1e5d8089, 0x1e5d8385, 0x1e5d940a, 0x1e5dbfdd, 0x1e5dc15d, 0x1e5dc1dd,
+    0x1e5dd005, 0x1e5dd35d, 0x1e5dd3dd, 0x1e5dd55d, 0x1e5de50a, 0x1e5df885, 0x1e5dfc5d, 0x1e5dfddd,
+    0x1e5f42bd, 0x1e5f473d, 0x1e5f48bd, 0x1e5f6fbd, 0x1e5f713d, 0x1e5fe4bd, 0x1e60304a, 0x1e604911,
+    0x1e60568d, 0x1e605c85, 0x1e60928d, 0x1e609ad9, 0x1e60ae59, 0x1e60d559, 0x1e60d6d9, 0x1e6101bd,
+    0x1e61153d, 0x1e6118fd, 0x1e611a7d, 0x1e612c7d, 0x1e614a4d, 0x1e614f3d, 0x1e6150bd, 0x1e61513d,
+    0x1e61537d, 0x1e61567d, 0x1e615c4d, 0x1e615dcd, 0x1e6164bd, 0x1e6166fd, 0x1e617d7d, 0x1e6184cd,
+    0x1e61864d, 0x1e618d3d, 0x1e618f7d, 0x1e61b10a, 0x1e61c485, 0x1e61c855, 0x1e61c9d5, 0x1e6202c9,
+    0x1e6204bd, 0x1e62053d, 0x1e6205c5, 0x1e62164a, 0x1e623eca, 0x1f342129, 0x1f34dbe9, 0x1f358b69,
+    0x1f358fe9, 0x1f3b2fe9, 0x1f3b41f2, 0x1f3b43e9, 0x1f3bdf69, 0x1f3bf369, 0x1f3bf7e9, 0x1f7423d9,
+    0x1f743172, 0x1f7435f2, 0x1f7437fd, 0x1f74c5d1, 0x1f74e9f2, 0x1f757551, 0x1f7579d1, 0x1f9bbe15,
+    0x1f9be691, 0x1fa77359, 0x1fa777d9, 0x1fa779d9, 0x1fa82bc9, 0x1faf33f1, 0x1faf47f1, 0x1faf7071,
+    0x1fbc1871, 0x1fc26c71, 0x1fdfb7e9, 0x1fe06769, 0x1fe1da7e, 0x1fe287e9, 0x1fe61fe9, 0x20173f5d,
+    0x2017eedd, 0x2017f35d, 0x2018abd9, 0x201ac7d9, 0x201acc7e, 0x201f13fd, 0x203e601d, 0x20404615,
+    0x20469a25, 0x2053bbf1, 0x2053c271, 0x2053f871, 0x2055de71, 0x2057b015, 0x2059be91, 0x205a0ff1,
+    0x205a1671, 0x205a23f1, 0x205a4c71, 0x205c3271, 0x2066f471, 0x21217a99, 0x21220f11, 0x21223605,
+    0x21289fe5, 0x21294d65, 0x21294f65, 0x212953e5, 0x212ef1e9, 0x212ef3e5, 0x212f0765, 0x212f41e9,
+    0x212fa365, 0x212fa7e5, 0x212fb565, 0x21349111, 0x2134b509, 0x21356fe1, 0x21357061, 0x213611e1,
+    0x21361de1, 0x21361f61, 0x21361fe1, 0x213623e1, 0x21362461, 0x213b21e9, 0x213c83e9, 0x21417459,
+    0x214175d9, 0x214189d9, 0x2141b0d9, 0x2142284a, 0x21423f45, 0x214264c9, 0x2142ebc9, 0x2148a861,
+    0x214957e1, 0x214e5859, 0x214f0c49, 0x215be1fd, 0x215c8f61, 0x215c917d, 0x216e63e1, 0x217b0bd1,
+    0x217b2fc9, 0x217b58c9, 0x217beabd, 0x217beb3d, 0x217c133d, 0x217c13bd, 0x217c273d, 0x217c86bd,
+    0x217c8b3d, 0x217c8cbd, 0x217c98bd, 0x217c9a3d, 0x217c9abd, 0x217c9ebd, 0x217c9f3d, 0x217ca0bd,
+    0x217cc13d, 0x217cc2bd, 0x217cc33d, 0x217cc73d, 0x217cc7bd, 0x21880049, 0x2188bb3d, 0x2188bbbd,
+    0x2188e3bd, 0x2188f7bd, 0x2189573d, 0x21895bbd, 0x21895d3d, 0x2189693d, 0x21896abd, 0x21896b3d,
+    0x21896f3d, 0x21896fbd, 0x2189933d, 0x218997bd, 0x218f0f3d, 0x218f0fbd, 0x218f233d, 0x218f4bbd,
+    0x218fbebd, 0x218fbf3d, 0x218fc33d, 0x218fc3bd, 0x218ffb3d, 0x218fffbd, 0x21a80dd9, 0x21ae4dd1,
+    0x21ae71c9, 0x21af2b3d, 0x21af2cbd, 0x21af2d3d, 0x21af67bd, 0x21af693d, 0x21afc8bd, 0x21afcd3d,
+    0x21afcebd, 0x21afdabd, 0x21afdc3d, 0x21afdcbd, 0x21afe0bd, 0x21afe13d, 0x21afe2bd, 0x21b57f3d,
+    0x21b580bd, 0x21b5813d, 0x21b592bd, 0x21b5933d, 0x21b594bd, 0x21b5bbbd, 0x21b5bd3d, 0x21b5cf3d,
+    0x21b62ebd, 0x21b6303d, 0x21b630bd, 0x21b634bd, 0x21b6353d, 0x21b6423d, 0x21b642bd, 0x21b6443d,
+    0x21b648bd, 0x21b66cbd, 0x21c24fbd, 0x21c2513d, 0x21c2633d, 0x21c263bd, 0x21c2653d, 0x21c300bd,
+    0x21c3053d, 0x21c314bd, 0x21c7c189, 0x21c7fd85, 0x21c800d9, 0x21c80159, 0x21c802d9, 0x21c83d59,
+    0x21c8b73d, 0x21c8b7bd, 0x21c8cb3d, 0x21c8f3bd, 0x21c92bd5, 0x21c93055, 0x21c96ac9, 0x21c9cf45,
+    0x21c9d491, 0x21c9e489, 0x21c9e822, 0x21c9f889, 0x21ca4989, 0x21ca6059, 0x21ca6262, 0x21ca7459,
+    0x21cb3c89, 0x21cb5355, 0x21cb5562, 0x21cb6755, 0x21cbb851, 0x21ce15bd, 0x21ce2022, 0x21ce2922,
+    0x21ce2c7d, 0x21ce2e62, 0x21ce407d, 0x21ce917d, 0x21ce9a62, 0x21cea362, 0x21cf5c2a, 0x21cf702a,
+    0x21cf847d, 0x21cf8d62, 0x21cf9662, 0x21cfd5bd, 0x21cfe9bd, 0x21d01222, 0x21d03912, 0x21d03c12,
+    0x21d04b55, 0x21d04c05, 0x21d04fd5, 0x21d05155, 0x21d06005, 0x21d06555, 0x21d09e49, 0x21d0b652,
+    0x21d0c65d, 0x21d0da59, 0x21d1951d, 0x21d1b949, 0x21d1cd55, 0x21d1f49d, 0x21d1f91d, 0x21d1fa9d,
+    0x21d20d1d, 0x21d20e9d, 0x21d2351d, 0x21d2ed99, 0x21d43165, 0x21d45589, 0x21d46989, 0x21d47412,
+    0x21d4894d, 0x21d4927d, 0x21d49d4d, 0x21d4a67d, 0x21d4cd99, 0x21d4d23d, 0x21d4d3bd, 0x21d4e63d,
+    0x21d4e7bd, 0x21d4ee52, 0x21d50999, 0x21d51d99, 0x21d5cbaa, 0x21d5cd0d, 0x21d5d63d, 0x21d5d7aa,
+    0x21d5fc95, 0x21d6013d, 0x21d61095, 0x21d6328d, 0x21d63bbd, 0x21d6468d, 0x21d64d65, 0x21d64fbd,
+    0x21d6a089, 0x21d6b405, 0x21d6b755, 0x21d6b955, 0x21d6cb55, 0x21d71c51, 0x21d72e49, 0x21d7e72a,
+    0x21d7fb2a, 0x21d80f51, 0x21d82149, 0x21d8609d, 0x21d8629d, 0x21d8749d, 0x21d89d1d, 0x21dae87d,
+    0x21daf14d, 0x21dafa7d, 0x21db39bd, 0x21db3bbd, 0x21db4dbd, 0x21db7199, 0x21db763d, 0x21dc6495,
+    0x21dc693d, 0x21dc9a8d, 0x21dca3bd, 0x21df6d11, 0x21e04be1, 0x21e0ede1, 0x21e0fb61, 0x21e101e1,
+    0x21e18919, 0x21e25a7e, 0x21e26e7e, 0x21e309e1, 0x21e31be1, 0x21e31de1, 0x21e38649, 0x21e38945,
+    0x21e399c9, 0x21e39a49, 0x21e39d45, 0x21e3db19, 0x21e3db99, 0x21e3eb52, 0x21e3fd9a, 0x21e3fe5d,
+    0x21e40219, 0x21e4039d, 0x21e41259, 0x21e41599, 0x21e41619, 0x21e41799, 0x21e4ca09, 0x21e4cd05,
+    0x21e4f095, 0x21e4f515, 0x21e4f695, 0x21e50895, 0x21e50915, 0x21e50a95, 0x21e52f89, 0x21e53285,
+    0x21e54309, 0x21e54389, 0x21e54685, 0x21e56b9d, 0x21e5fdd9, 0x21e62289, 0x21e62585, 0x21e741d1,
+    0x21e78d85, 0x21e79169, 0x21e792e9, 0x21e7a185, 0x21e7a4e9, 0x21e7a569, 0x21e7a6e9, 0x21e7c145,
+    0x21e7c99a, 0x21e7ce3d, 0x21e7cfbd, 0x21e7d545, 0x21e7e1bd, 0x21e7e23d, 0x21e7e3bd, 0x21e8130d,
+    0x21e8138d, 0x21e81c3d, 0x21e81cbd, 0x21e83a1a, 0x21e83b8d, 0x21e84e1a, 0x21e84f99, 0x21e8d6fd,
+    0x21e8d77d, 0x21e8fdea, 0x21e9050e, 0x21e90e3d, 0x21e9116a, 0x21e911ea, 0x21e9137d, 0x21e92e8d,
+    0x21e94295, 0x21e95dd1, 0x21e96a85, 0x21e972e9, 0x21e9777d, 0x21e978fd, 0x21e97e85, 0x21e98669,
+    0x21e986e9, 0x21e98afd, 0x21e98b7d, 0x21e98cfd, 0x21e9aee9, 0x21e9edc9, 0x21e9ee49, 0x21e9f145,
+    0x21ea2f19, 0x21ea2f99, 0x21ea6645, 0x21ea6999, 0x21ea6a19, 0x21ea6b99, 0x21eb5c95, 0x21eb5d15,
+    0x21eb5e95, 0x21eb9709, 0x21eb9789, 0x21eb9a85, 0x21ebd389, 0x21ec65d9, 0x21ee2945, 0x21ee35bd,
+    0x21ee363d, 0x21ee37bd, 0x21ee670d, 0x21ee678d, 0x21ee703d, 0x21ee70bd, 0x21eea21a, 0x21eea38d,
+    0x21eeacbd, 0x21ef2afd, 0x21ef2b7d, 0x21ef656a, 0x21ef65ea, 0x21ef677d, 0x21ef968d, 0x21efd285,
+    0x21efda69, 0x21efdae9, 0x21efdefd, 0x21efdf7d, 0x21efe0fd, 0x21f016e9, 0x21f01b7d, 0x21f04189,
+    0x21f05855, 0x21f05a62, 0x21f06c55, 0x21f0bd51, 0x21f1882a, 0x21f19c2a, 0x21f1b051, 0x21f2019d,
+    0x21f2159d, 0x21f23e22, 0x21f4897d, 0x21f49262, 0x21f49b62, 0x21f4dabd, 0x21f4eebd, 0x21f51722,
+    0x21f60a22, 0x21f6be49, 0x21f6d249, 0x21f6e752, 0x21f6f999, 0x21f6fa45, 0x21f6fe1a, 0x21f6ff99,
+    0x21f70e45, 0x21f71199, 0x21f7122a, 0x21f71399, 0x21f72352, 0x21f73a19, 0x21f74e19, 0x21f80209,
+    0x21f82d15, 0x21f84115, 0x21f86789, 0x21f87b89, 0x21f95a89, 0x21fa1569, 0x21fa2969, 0x21fa88e9,
+    0x21fa8d69, 0x21fa8ee9, 0x21faa169, 0x21faa2e9, 0x21fac969, 0x21fadd69, 0x21fb0195, 0x21fb063d,
+    0x21fb1595, 0x21fb1a3d, 0x21fb360d, 0x21fb378d, 0x21fb40bd, 0x21fb4b8d, 0x21fb54bd, 0x21fbf569,
+    0x21fbf9ea, 0x21fbfb7d, 0x21fc0d6a, 0x21fc0f7d, 0x21fc3169, 0x21fc35ea, 0x21fc4569, 0x21fc49ea,
+    0x21fca969, 0x21fcaae9, 0x21fcaf7d, 0x21fcbee9, 0x21fcc37d, 0x21fd1469, 0x21fd2669, 0x21fd65a9,
+    0x21fd67a9, 0x21fd79aa, 0x21fda229, 0x21fe1a1e, 0x21fe9529, 0x2200f4e9, 0x2200f6e9, 0x220108e9,
+    0x22013169, 0x220169a9, 0x22019fa9, 0x2202616a, 0x22029969, 0x22029dea, 0x220312e9, 0x2207737d,
+    0x22098f7d, 0x220eb63d, 0x22193fd9, 0x221a83d1, 0x221b4e7e, 0x221bf07e, 0x221c9fd1, 0x221ca47e,
+    0x221d8559, 0x221daa09, 0x221dbe09, 0x221dfb0a, 0x221e37ca, 0x221e4c0a, 0x221e730a, 0x221e73c9,
+    0x221e740a, 0x221e7449, 0x221e785d, 0x221e78dd, 0x221e9ad5, 0x221eacd5, 0x221ec351, 0x221ee749,
+    0x221ef05d, 0x221ef1dd, 0x221ef27e, 0x221f145d, 0x221f18dd, 0x221f1a5d, 0x221f235e, 0x221f23de,
+    0x221f24de, 0x221f2cdd, 0x22209b3d, 0x22209bbd, 0x2220a951, 0x22210ebd, 0x2221133d, 0x222114bd,
+    0x2221373d, 0x22213bbd, 0x22213d3d, 0x2221493d, 0x22214abd, 0x22214b3d, 0x22214d49, 0x22214f3d,
+    0x22214fbd, 0x2221513d, 0x2221a27e, 0x2221cb7e, 0x2221ed5a, 0x2221ee3d, 0x2221f1da, 0x2221f37d,
+    0x222205da, 0x2222360e, 0x22223f0a, 0x2222813e, 0x22229cce, 0x2222a5ca, 0x2222b0ce, 0x2222b94a,
+    0x2222b9ca, 0x22231d3d, 0x2223233e, 0x2223284d, 0x222329cd, 0x22232a7e, 0x22232f3d, 0x222330bd,
+    0x2223337e, 0x2223353e, 0x222350cd, 0x2223524d, 0x222357bd, 0x2223593d, 0x22235b7d, 0x22241209,
+    0x2224cc5d, 0x2224ccdd, 0x222545dd, 0x2225467e, 0x22257bdd, 0x2225805d, 0x222580dd, 0x2225825d,
+    0x2226c6bd, 0x2226ef3d, 0x2226efbd, 0x2227033d, 0x222762bd, 0x2227673d, 0x222768bd, 0x222774bd,
+    0x2227763d, 0x22277cbd, 0x22279d3d, 0x22279ebd, 0x22279f3d, 0x2227a33d, 0x2227a3bd, 0x2227a53d,
+    0x2227b13d, 0x2227b2bd, 0x2227b73d, 0x222859da, 0x2228d53e, 0x222904ce, 0x22290dca, 0x22297dcd,
+    0x22297e7e, 0x2229833d, 0x222984bd, 0x222996bd, 0x222998bd, 0x2229b8cd, 0x2229ba4d, 0x2229bf3d,
+    0x2229bfbd, 0x2229c13d, 0x2230a609, 0x2230ba3e, 0x2231745d, 0x223174fe, 0x22319cdd, 0x2231b0dd,
+    0x2232105d, 0x223214dd, 0x2232165d, 0x223223dd, 0x2232285d, 0x223228fe, 0x22322a7e, 0x22324c5d,
+    0x223250dd, 0x2233913d, 0x2233973d, 0x2233bfbd, 0x2233cd3d, 0x2233d3bd, 0x2234333d, 0x223437bd,
+    0x2234393d, 0x2234453d, 0x223446bd, 0x22344d3d, 0x22346f3d, 0x223473bd, 0x2234e959, 0x2234edda,
+    0x223501da, 0x223529da, 0x22359fbd, 0x2235ac4d, 0x2235acfe, 0x2235b33d, 0x2235d4cd, 0x2235dbbd,
+    0x2235e8cd, 0x2235efbd, 0x22364ccd, 0x22364e4d, 0x223653bd, 0x2236553d, 0x223660fe, 0x2236627e,
+    0x2236673d, 0x2236693d, 0x22368fbd, 0x2236cfda, 0x2236d515, 0x2236e11a, 0x2236e71a, 0x22370d9a,
+    0x22370e3e, 0x2237113e, 0x2237381a, 0x22374a09, 0x2237878a, 0x22378a96, 0x2237c85e, 0x2237c8de,
+    0x2237ff8a, 0x223804dd, 0x22382b11, 0x22383d09, 0x223877dd, 0x22387c5d, 0x22387e7e, 0x2238907e,
+    0x2238b25d, 0x2238b45d, 0x2238b8dd, 0x223a213d, 0x223a27bd, 0x223a353d, 0x223a993d, 0x223a9abd,
+    0x223afe1a, 0x223b041a, 0x223b0d0d, 0x223b163d, 0x223b493e, 0x223b523e, 0x223b555a, 0x223b55da,
+    0x223b577e, 0x223b695a, 0x223b8d59, 0x223b91da, 0x223bcb8a, 0x223c004d, 0x223c00fe, 0x223c073d,
+    0x223c094a, 0x223c09ca, 0x223c0cfe, 0x223c3ccd, 0x223c43bd, 0x223c8055, 0x223c84fd, 0x223cb4fe,
+    0x223cb67e, 0x223cbf7e, 0x223d2489, 0x223d3b55, 0x223d3d62, 0x223d4f55, 0x223da051, 0x223e6b3d,
+    0x223e7f1d, 0x223e8ed1, 0x223e9351, 0x223ee01d, 0x223ee49d, 0x223ef41d, 0x223ef89d, 0x223f1ca2,
+    0x223f2122, 0x22416c7d, 0x22417562, 0x22417e62, 0x2241bdbd, 0x2241d1bd, 0x2241fa22, 0x2242bb8a,
+    0x2242e8a2, 0x2242ed22, 0x2243a155, 0x2243b549, 0x2243dc9a, 0x2243e119, 0x2243e299, 0x2243f519,
+    0x2243f699, 0x22443119, 0x2244e509, 0x22450b95, 0x22451015, 0x22451f95, 0x22452415, 0x22454a89,
+    0x22455e89, 0x22463dbd, 0x2246f87d, 0x22470c65, 0x22474185, 0x22476be5, 0x22477065, 0x224771e5,
+    0x22477f65, 0x22477fe5, 0x22478465, 0x224785e5, 0x2247ac7d, 0x2247bbe5, 0x2247c065, 0x2247e495,
+    0x2247f895, 0x2247fd3d, 0x22481a8d, 0x224823bd, 0x22482e8d, 0x224837bd, 0x2248d866, 0x2248dcfd,
+    0x2248de7d, 0x2248f0fd, 0x2248f27d, 0x22491466, 0x224926e6, 0x22492866, 0x22492cfd, 0x22498de5,
+    0x2249927d, 0x2249a1e5, 0x2249a67d, 0x2249f765, 0x224a0965, 0x224a48a5, 0x224a4aa5, 0x224a5ca5,
+    0x224a8525, 0x224b73a5, 0x224b7825, 0x224d7265, 0x224d95a5, 0x224dd365, 0x224dd3e5, 0x224dd7e5,
+    0x224dd9e5, 0x224de765, 0x224debe5, 0x224e0fe5, 0x224e1465, 0x224e4ca5, 0x224e82a5, 0x224f7c66,
+    0x224ff5e5, 0x2256d89a, 0x2256d955, 0x2256dd15, 0x2256de95, 0x2256ed45, 0x2256f095, 0x2256f115,
+    0x2256f295, 0x22571789, 0x22571a85, 0x22572b09, 0x22572b89, 0x22572e85, 0x22576799, 0x2257e45d,
+    0x2257e5dd, 0x2257e65d, 0x22580cfd, 0x22581d05, 0x2258207d, 0x225820dd, 0x2258225d, 0x22584695,
+    0x22585a95, 0x225881dd, 0x22588285, 0x2258865d, 0x225887dd, 0x2258955d, 0x225895dd, 0x22589685,
+    0x225899dd, 0x22589a5d, 0x22589bdd, 0x225975bd, 0x2259797d, 0x22597afd, 0x225a073d, 0x225a08bd,
+    0x225a093d, 0x225a43bd, 0x225a453d, 0x225aa93d, 0x225aaabd, 0x225ab83d, 0x225abd3d, 0x225abebd,
+    0x225ae2fd, 0x225af6c9, 0x225b168d, 0x225b2a8d, 0x225b33bd, 0x225b5285, 0x225b5ada, 0x225b5bbd,
+    0x225b5f7d, 0x225b60fd, 0x225b6685, 0x225b6e5a, 0x225b6eda, 0x225b72fd, 0x225b737d, 0x225b74fd,
+    0x225b96da, 0x225baada, 0x225c173e, 0x225c1dce, 0x225c1e4e, 0x225c293e, 0x225c2b3e, 0x225c44ce,
+    0x225c5a4e, 0x225c637d, 0x225c89d5, 0x225c9dd5, 0x225cbe4d, 0x225cbfcd, 0x225cc53d, 0x225cc6bd,
+    0x225cc8fd, 0x225cd24d, 0x225cd3cd, 0x225cd8bd, 0x225cd93d, 0x225cdabd, 0x225cdcfd, 0x225d4145,
+    0x225d4495, 0x225d4515, 0x225d4695, 0x225d5895, 0x225d7f89, 0x225d8285, 0x225da991, 0x225dbb89,
+    0x225e39de, 0x225e3a5e, 0x225e747d, 0x225e74dd, 0x225e765d, 0x225e885d, 0x225e9811, 0x225e9c91,
+    0x225eae89, 0x225ee7dd, 0x225ee95d, 0x225ee9dd, 0x225eea85, 0x225eeddd, 0x225eee5d, 0x225eefdd,
+    0x225efb5d, 0x225efbdd, 0x225efd5d, 0x225f01dd, 0x225f245d, 0x225f25dd, 0x225f2a5d, 0x22606f3d,
+    0x226070bd, 0x226097bd, 0x2260993d, 0x2260cfd5, 0x2260d5d5, 0x2261113d, 0x22611ebd, 0x2261203d,
+    0x226147c5, 0x226175bd, 0x22617e8d, 0x226187bd, 0x2261ba85, 0x2261c25a, 0x2261c2da, 0x2261c6fd,
+    0x2261c77d, 0x2261c8fd, 0x2261dafd, 0x2261feda, 0x2262037d, 0x226271ce, 0x2262724e, 0x2262ae4e,
+    0x2262f1d5, 0x2262f67d, 0x226327cd, 0x22632cbd, 0x22632d3d, 0x226330fd, 0x226366ca, 0x22639861,
+    0x2263e9a1, 0x2263fda1, 0x22642622, 0x226514a2, 0x22651922, 0x22671361, 0x22677461, 0x226778e1,
+    0x22677ae2, 0x22678861, 0x22678ce1, 0x226a1515, 0x226a2915, 0x226a4f89, 0x226a6389, 0x226a7a12,
+    0x226b045e, 0x226b08de, 0x226b0a5e, 0x226b17dd, 0x226b185d, 0x226b1c5d, 0x226b1cdd, 0x226b1e5d,
+    0x226b44fd, 0x226b545d, 0x226b58dd, 0x226b6892, 0x226b6d12, 0x226bb85d, 0x226bb9dd, 0x226bbe5d,
+    0x226bcbdd, 0x226bcc5d, 0x226bcddd, 0x226bd25d, 0x226cb17d, 0x226d3b3d, 0x226d3fbd, 0x226d413d,
+    0x226d9fd5, 0x226db3d5, 0x226dced2, 0x226e4612, 0x226e9159, 0x226e92d9, 0x226e977d, 0x226ea6d9,
+    0x226eab7d, 0x226f40cd, 0x226f424d, 0x226f47bd, 0x226f493d, 0x226f564d, 0x226f5bbd, 0x226f5d3d,
+    0x226f954a, 0x226f96c6, 0x226ffd3d, 0x233c57e1, 0x2382d2bd, 0x2382d33d, 0x238386bd, 0x2383c33d,
+    0x23b6133d, 0x23b614bd, 0x23b6153d, 0x23b628bd, 0x23b64fbd, 0x23b6513d, 0x23b6c8bd, 0x23b6c93d,
+    0x23d74805, 0x23d74d55, 0x23d7c249, 0x23d8b565, 0x23d8f6a5, 0x23d93125, 0x23db854d, 0x23db8e7d,
+    0x23dbcfbd, 0x23dbe1bd, 0x23dc0599, 0x23dc0a3d, 0x23dcf895, 0x23dd2e8d, 0x23e235bd, 0x23e8a03d,
+    0x23e94fe1, 0x23e963e1, 0x23ea8249, 0x23ea8545, 0x23eac399, 0x23ead719, 0x23eafa45, 0x23eafe19,
+    0x23eaff99, 0x23eb1199, 0x23ebf115, 0x23ebf295, 0x23ec2b89, 0x23ec2e85, 0x23ec3f09, 0x23ec6789,
+    0x23eea0e9, 0x23eebd45, 0x23eeca3d, 0x23eecbbd, 0x23eefb8d, 0x23ef04bd, 0x23ef0f0d, 0x23ef378d,
+    0x23ef40bd, 0x23efa3d1, 0x23efbf7d, 0x23efd2fd, 0x23eff9ea, 0x23effb7d, 0x23f00d6a, 0x23f02a8d,
+    0x23f033bd, 0x23f06685, 0x23f06ee9, 0x23f0737d, 0x23f074fd, 0x23f08269, 0x23f086fd, 0x23f0aae9,
+    0x23f0af7d, 0x23f12b19, 0x23f16599, 0x23f29309, 0x23f5630d, 0x23f56c3d, 0x23f626fd, 0x23f6616a,
+    0x23f6d669, 0x23f6dafd, 0x23fdba59, 0x23fdf659, 0x23fdfb99, 0x23fe3619, 0x23fe7515, 0x23feae1e,
+    0x23feb11e, 0x23feea09, 0x23ff2495, 0x23ff5d89, 0x23ff6085, 0x23ff998a, 0x2401fd95, 0x2402338d,
+    0x2402b63d, 0x2402f23d, 0x2402f5ea, 0x2402f77d, 0x2403096a, 0x24032d69, 0x240331ea, 0x2403658a,
+    0x2403a185, 0x2403a569, 0x2403a6e9, 0x24095d6a, 0x2422e5d1, 0x24241419, 0x24242609, 0x24243989,
+    0x24243a09, 0x24243b19, 0x24246759, 0x24246d59, 0x24247585, 0x24247959, 0x24247ad9, 0x24247b7d,
+    0x24247f59, 0x24249e05, 0x2424a1d9, 0x2424a359, 0x2424a3d9, 0x2424a609, 0x2424a859, 0x2424b205,
+    0x2424b559, 0x2424b5d9, 0x2424b759, 0x2424bbd9, 0x2424e0d5, 0x2424f455, 0x2424f4d5, 0x24252d49,
+    0x24253045, 0x242555c9, 0x242558c5, 0x242560dd, 0x24256949, 0x242569c9, 0x24256cc5, 0x2425745d,
+    0x24257f05, 0x242594d5, 0x2425a855, 0x2425a8d5, 0x2425bd51, 0x2425cf49, 0x2425da7e, 0x2425e445,
+    0x2425edfe, 0x24260cc5, 0x242614dd, 0x2426165d, 0x24261f5e, 0x242620de, 0x24264d55, 0x24265b85,
+    0x24265f59, 0x242660d5, 0x24266155, 0x24266559, 0x242665d9, 0x24267bd1, 0x242699c9, 0x2426c249,
+    0x2426d5c9, 0x2426d649, 0x24271349, 0x24271645, 0x242754bd, 0x24275abd, 0x24277d3d, 0x2427833d,
+    0x242783bd, 0x242790bd, 0x2427913d, 0x2427973d, 0x2427a351, 0x2427ca45, 0x2427f6bd, 0x2427fb3d,
+    0x2427fcbd, 0x242808bd, 0x24280a3d, 0x24280ebd, 0x24280f3d, 0x2428313d, 0x242832bd, 0x2428333d,
+    0x2428373d, 0x242837bd, 0x2428393d, 0x242844bd, 0x2428453d, 0x242846bd, 0x24284b3d, 0x2428b37e,
+    0x2428edda, 0x2429633d, 0x2429693e, 0x242976bd, 0x242998cd, 0x24299f3d, 0x24299fbd, 0x2429ac4d,
+    0x2429b33d, 0x2429b54a, 0x242a127e, 0x242a173d, 0x242a18bd, 0x242a1b7e, 0x242a25fe, 0x242a2abd,
+    0x242a4e4d, 0x242a53bd, 0x242a553d, 0x242bc85d, 0x242c41fe, 0x242c75dd, 0x242c77dd, 0x242c7c5d,
+    0x242fcabd, 0x242fdebd, 0x2430004d, 0x2430073d, 0x243079fe, 0x2437a23e, 0x2438925d, 0x243898dd,
+    0x24390bdd, 0x24390c7e, 0x2439465d, 0x2439485d, 0x243abbbd, 0x243be9da, 0x243c94fe, 0x243c9dca,
+    0x243cd0cd, 0x243cd7bd, 0x2445dc1d, 0x2447c215, 0x244a9d49, 0x244ade99, 0x244b1919, 0x244c0795,
+    0x244c0c25, 0x244e6765, 0x244e67e5, 0x244e7b65, 0x244ea3e5, 0x244ee095, 0x244ee53d, 0x244f168d,
+    0x244f1fbd, 0x244fda7d, 0x24501065, 0x245014fd, 0x245089e5, 0x2454cf65, 0x245b3e61, 0x245dd545,
+    0x245dd915, 0x245dda95, 0x245e1389, 0x245e1685, 0x245e4f89, 0x245ece5e, 0x245ee1dd, 0x245f045d,
+    0x245f08dd, 0x245f0a5d, 0x245f165d, 0x245f17dd, 0x245f1c5d, 0x245f4289, 0x245f7bdd, 0x245f7d5d,
+    0x245f7ddd, 0x245f825d, 0x245f83dd, 0x245f8f5d, 0x245f8fdd, 0x245f915d, 0x245f95dd, 0x245fb85d,
+    0x245fb9dd, 0x245fbe5d, 0x2460febd, 0x246104bd, 0x24612bbd, 0x24612d3d, 0x246169d5, 0x2461a53d,
+    0x2462128d, 0x24621bbd, 0x24624e85, 0x246256d9, 0x24625b7d, 0x24625cfd, 0x24626a59, 0x24626efd,
+    0x246292d9, 0x2462977d, 0x2463064d, 0x24630b3d, 0x24630cbd, 0x246319cd, 0x24631f3d, 0x246320bd,
+    0x2463424d, 0x246385d5, 0x24638a7d, 0x2463bbcd, 0x2463c0bd, 0x2463c13d, 0x2463c4fd, 0x246535de,
+    0x246541dd, 0x2465435d, 0x246547dd, 0x24656a5d, 0x24656bdd, 0x2465705d, 0x2465e35d, 0x2465e3dd,
+    0x2465e55d, 0x2465e9dd, 0x2467cb55, 0x2468be59, 0x2468c2fd, 0x24693c7d, 0x24696dcd, 0x246976fd,
+    0x246e7061, 0x24711119, 0x2471c509, 0x2472011e, 0x2472065e, 0x247211dd, 0x2472125d, 0x247213dd,
+    0x2472185d, 0x24723c5d, 0x247240dd, 0x2472748a, 0x2472b085, 0x2472b3dd, 0x2472b45d, 0x2472b5dd,
+    0x24749bd5, 0x24758ed9, 0x24760cfd, 0x24763e4d, 0x2476477d, 0x2476f6ca, 0x27dec4c9, 0x27ded715,
+    0x27ded862, 0x27dedb95, 0x27dedc22, 0x27dedda2, 0x27dee995, 0x27deeb15, 0x27deef95, 0x27df3a91,
+    0x27df3c11, 0x27df4091, 0x27df52a2, 0x27dfd0de, 0x27dfe35d, 0x27e00566, 0x27e006e6, 0x27e01966,
+    0x27e01ae6, 0x27e01f5d, 0x27e02d91, 0x27e02f29, 0x27e03391, 0x27e045a2, 0x27e08069, 0x27e084dd,
+    0x27e092dd, 0x27e09469, 0x27e098dd, 0x27e0badd, 0x27e0bb62, 0x27e0bce2, 0x27e0c162, 0x27e177d9,
+    0x27e30691, 0x27e30811, 0x27e30cbd, 0x27e315a2, 0x27e31ea2, 0x27e35966, 0x27e35dfd, 0x27e36bd9,
+    0x27e36d66, 0x27e371fd, 0x27e393d9, 0x27e39462, 0x27e395e2, 0x27e39a62, 0x27e45bca, 0x27e486d5,
+    0x27e48762, 0x27e488e2, 0x27e48d62, 0x27e53012, 0x27e53192, 0x27e54189, 0x27e55285, 0x27e55589,
+    0x27e57cda, 0x27e58159, 0x27e582d9, 0x27e59066, 0x27e590d9, 0x27e594d9, 0x27e59559, 0x27e596d9,
+    0x27e5b759, 0x27e5b8d9, 0x27e5bd5d, 0x27e5cb59, 0x27e5ccd9, 0x27e5d159, 0x27e68266, 0x27e68549,
+    0x27e6aa55, 0x27e6abe9, 0x27e6b055, 0x27e6ba85, 0x27e6bdd5, 0x27e6be55, 0x27e6bfe9, 0x27e6c455,
+    0x27e6eac9, 0x27e6f8c9, 0x27e6fec9, 0x27e734ca, 0x27e77b55, 0x27e7ddc9, 0x27e7ebc9, 0x27e7eec5,
+    0x27e7f345, 0x27e87025, 0x27e870a5, 0x27e89725, 0x27e898a5, 0x27e8aaa5, 0x27e8ab25, 0x27e8aca5,
+    0x27e8dec9, 0x27e8e645, 0x27e90c29, 0x27e910a5, 0x27e91229, 0x27e91e25, 0x27e91fa9, 0x27e92029,
+    0x27e92425, 0x27e924a5, 0x27e946a5, 0x27e94ca5, 0x27e956c5, 0x27e95a25, 0x27e95aa5, 0x27e95c29,
+    0x27e960a5, 0x27e96992, 0x27e98355, 0x27e984d5, 0x27e9897d, 0x27e996d5, 0x27e99755, 0x27e998d5,
+    0x27e99d7d, 0x27e9bacd, 0x27e9c3fd, 0x27e9cecd, 0x27e9d1c9, 0x27e9d4c5, 0x27e9d7fd, 0x27e9f9c9,
+    0x27ea0dca, 0x27ea78a6, 0x27ea7d3d, 0x27ea7ebd, 0x27ea8ca6, 0x27ea90bd, 0x27ea913d, 0x27ea92bd,
+    0x27eab326, 0x27eab4a6, 0x27eac366, 0x27eac6a6, 0x27eac726, 0x27eac8a6, 0x27eacd3d, 0x27eb00ca,
+    0x27eb2ca5, 0x27eb2e29, 0x27eb32bd, 0x27eb3cc5, 0x27eb4025, 0x27eb40a5, 0x27eb4229, 0x27eb46bd,
+    0x27eb68a5, 0x27eb9319, 0x27eb9791, 0x27eba989, 0x27ebe45a, 0x27ebe4da, 0x27ebe8d9, 0x27ebe959,
+    0x27ebead9, 0x27ebfcd9, 0x27ec20d9, 0x27ec2559, 0x27ec71e6, 0x27ecc2e6, 0x27ed0e85, 0x27ed11d5,
+    0x27ed1255, 0x27ed13e9, 0x27ed1855, 0x27ed4c49, 0x27ed4cc9, 0x27ed52c9, 0x27ed88ca, 0x27edcf55,
+    0x27edd0d5, 0x27eddc55, 0x27eddcd5, 0x27edde59, 0x27ee3fe5, 0x27ee42d9, 0x27ee4745, 0x27eed026,
+    0x27eed1a6, 0x27eed6a5, 0x27eed825, 0x27eefa26, 0x27eefaa6, 0x27eefea5, 0x27eeff25, 0x27ef00a5,
+    0x27ef0c26, 0x27ef0ca6, 0x27ef0e26, 0x27ef12a5, 0x27ef32c9, 0x27ef3a45, 0x27ef7225, 0x27ef7825,
+    0x27ef78a5, 0x27ef7a29, 0x27ef85a5, 0x27ef8625, 0x27ef8c25, 0x27efaac5, 0x27efae25, 0x27efaea5,
+    0x27efb029, 0x27efb4a5, 0x27efead5, 0x27efeb55, 0x27efecd9, 0x27eff17d, 0x27f022d9, 0x27f02566,
+    0x27f025c9, 0x27f02bfd, 0x27f061ca, 0x27f08ee6, 0x27f0dea6, 0x27f0e026, 0x27f0e0a6, 0x27f0e4bd,
+    0x27f0e53d, 0x27f0e6bd, 0x27f0f226, 0x27f0f2a6, 0x27f0f8bd, 0x27f11aa6, 0x27f11b26, 0x27f11ca6,
+    0x27f1213d, 0x27f154ca, 0x27f19425, 0x27f194a5, 0x27f19abd, 0x27f7feb6, 0x27f812b6, 0x27f8f3dd,
+    0x27f907d9, 0x27f98636, 0x27f9869d, 0x27f9ad1d, 0x27f9ae9d, 0x27f9c09d, 0x27f9c11d, 0x27f9c29d,
+    0x27fa269d, 0x27fa35b6, 0x27fa3629, 0x27fa3a36, 0x27fa3a9d, 0x27fa5c9d, 0x27fa629d, 0x27fa701d,
+    0x27fa709d, 0x27fb1999, 0x27fb1b19, 0x27fb2d99, 0x27fbe109, 0x27fc8309, 0x27fc9089, 0x27fc9109,
+    0x27fc9709, 0x27fcfb1a, 0x27fcffbd, 0x27fd0136, 0x27fd0e9a, 0x27fd0f1a, 0x27fd1336, 0x27fd13bd,
+    0x27fd1536, 0x27fd359a, 0x27fd371a, 0x27fd491a, 0x27fd499a, 0x27fde68e, 0x27fdfa8e, 0x27fe03bd,
+    0x27fe6936, 0x27fe7709, 0x27fe7d36, 0x27fee6d5, 0x27ff5bc9, 0x27ffda9e, 0x27ffec9d, 0x2800149d,
+    0x2800151d, 0x2800169d, 0x2800289d, 0x28003869, 0x28004be9, 0x28004ec9, 0x2800881d, 0x280089b6,
+    0x28008a29, 0x28008e36, 0x28008e9d, 0x28009036, 0x28009bb6, 0x28009c1d, 0x28009db6, 0x2800a236,
+    0x2800c41d, 0x2800c49d, 0x2800c629, 0x2800ca9d, 0x28017d1a, 0x28018119, 0x28018199, 0x28018319,
+    0x28018f1a, 0x2801909a, 0x2802e509, 0x28031ecd, 0x280324da, 0x2803611a, 0x2803629a, 0x2803631a,
+    0x28036736, 0x280367bd, 0x28036936, 0x2803749a, 0x2803751a, 0x2803769a, 0x28037b36, 0x28039d1a,
+    0x28039d9a, 0x28039f1a, 0x2803a3bd, 0x2804120e, 0x2804128e, 0x28049229, 0x280496bd, 0x2804cab6,
+    0x2804cb09, 0x2804d136, 0x28053891, 0x28054aa2, 0x280589d9, 0x28059dd9, 0x2805c662, 0x2806b2d5,
+    0x2806b362, 0x2806b4e2, 0x2806b962, 0x280877a1, 0x28087921, 0x28089fa1, 0x2808af21, 0x2808b3a1,
+    0x2808c7d1, 0x28091921, 0x280919a2, 0x28091b22, 0x28092721, 0x28092d21, 0x28094f21, 0x280955a2,
+    0x28098bd5, 0x28098c62, 0x28098de2, 0x28099262, 0x280a8121, 0x280a85bd, 0x280a93a1, 0x280a9521,
+    0x280a99bd, 0x280abba1, 0x280abc22, 0x280abda2, 0x280b3521, 0x280b3ba2, 0x280bb555, 0x280bc955,
+    0x280befc9, 0x280c03c9, 0x280ca91e, 0x280caa9e, 0x280cbc9d, 0x280cbd1d, 0x280cbe9d, 0x280ce51d,
+    0x280cf91d, 0x280d589d, 0x280d5a29, 0x280d5e9d, 0x280d6c9d, 0x280d6e29, 0x280d729d, 0x280d949d,
+    0x280de3c9, 0x280de6c5, 0x280deb45, 0x280e2519, 0x280e2999, 0x280e2b19, 0x280e5199, 0x280e5bc5,
+    0x280e5fb5, 0x280e6119, 0x280e6599, 0x280f4ec5, 0x280f5215, 0x280f5295, 0x280f5429, 0x280f5895,
+    0x280f8d09, 0x280fc90a, 0x281005ca, 0x28103199, 0x28103319, 0x281037bd, 0x28104519, 0x28104599,
+    0x28104719, 0x28104bbd, 0x28106d99, 0x2811358a, 0x28116095, 0x28119b09, 0x2811af0a, 0x28121d69,
+    0x281257e9, 0x2813109e, 0x2813111e, 0x2813129e, 0x281324a9, 0x28134d29, 0x2813c6a9, 0x28143f69,
+    0x28147d9a, 0x28147f1a, 0x28148aa9, 0x28148b29, 0x2814afe9, 0x2814b9a9, 0x28150429, 0x28150629,
+    0x28156aa9, 0x2815a629, 0x2815a6a9, 0x2815aca9, 0x28161d0a, 0x281659ca, 0x28169929, 0x281699a9,
+    0x281714a9, 0x28174aa9, 0x281a01d5, 0x281a52d1, 0x281bb001, 0x281bc491, 0x281c5421, 0x281d6c7e,
+    0x281d7ba5, 0x281d81be, 0x281d823e, 0x281da425, 0x281daa3e, 0x281de025, 0x281de0a5, 0x281e1ed1,
+    0x281e7021, 0x281e843e, 0x281eaca2, 0x28206945, 0x2820939d, 0x2820981d, 0x2820999d, 0x2820a7be,
+    0x2820adbe, 0x2820cf9d, 0x2820e39d, 0x2821b391, 0x282218e5, 0x28224165, 0x28225565, 0x28228d95,
+    0x28230585, 0x2823ad3d, 0x2823cfa5, 0x2824277e, 0x282434e5, 0x28243afe, 0x28245d65, 0x2824637e,
+    0x282470e5, 0x28247165, 0x28249b95, 0x2824af95, 0x2824d18d, 0x2824e5be, 0x2824ebbe, 0x28265e3e,
+    0x2826861d, 0x2826a9d1, 0x2826bd45, 0x2826fb1d, 0x2826fbbe, 0x282701be, 0x28270f3e, 0x2827379d,
+    0x28280019, 0x2828e195, 0x2828e795, 0x2828f515, 0x28295985, 0x282a88e5, 0x282b0395, 0x282b39be,
+    0x282e8411, 0x282ee961, 0x282f11e1, 0x282f25e1, 0x2830a63e, 0x2830a6be, 0x2830f7fe, 0x283133fe,
+    0x2831347e, 0x28327abe, 0x2832c991, 0x28332edd, 0x2833575d, 0x28336add, 0x28336b5d, 0x28340a89,
+    0x283514d5, 0x283565d1, 0x28358ff5, 0x28362bf5, 0x28363075, 0x283631f5, 0x28363f75, 0x28363ff5,
+    0x283643f5, 0x28364475, 0x283645f5, 0x2836b2be, 0x2836e3bd, 0x28370dbe, 0x2837237e, 0x283736fe,
+    0x2837377e, 0x28374bfe, 0x283772fe, 0x2837767e, 0x283787fe, 0x2837887e, 0x28379cfd, 0x28379e7d,
+    0x2837b07d, 0x283811f5, 0x2838167d, 0x283817f6, 0x283825fe, 0x28382a7e, 0x28384c75, 0x28384df5,
+    0x2838527d, 0x2839f795, 0x2839fd96, 0x283a0b16, 0x283a5c11, 0x283a6f85, 0x283c5d76, 0x283c5dfe,
+    0x283c6ffe, 0x283c91f5, 0x283c93f5, 0x283c97f5, 0x283c9875, 0x283c99f5, 0x283ca575, 0x283ca775,
+    0x283cabf5, 0x283e047d, 0x283e2816, 0x283e3596, 0x283e3b85, 0x283e7976, 0x283e79fe, 0x283e7ff6,
+    0x283e8bfe, 0x283e8d76, 0x283eb3f5, 0x283eb475, 0x283eb5f5, 0x283fff3e, 0x2840271d, 0x28404ad1,
+    0x28409c1d, 0x2840b03e, 0x2840d8a2, 0x2842b13e, 0x284429e1, 0x28443d61, 0x28443dfd, 0x284465e1,
+    0x28446676, 0x2844a4a2, 0x2846c795, 0x2846db95, 0x28488bf5, 0x28488c7e, 0x2848b475, 0x2848c675,
+    0x2848c875, 0x2848fd85, 0x284927f5, 0x28492c75, 0x28492df5, 0x284939f5, 0x28493b75, 0x28493bfe,
+    0x28493ff5, 0x2849407e, 0x284941fe, 0x284963f5, 0x28496875, 0x284975f5, 0x284977f5, 0x28497c75,
+    0x284a5555, 0x284a68d5, 0x284a6955, 0x284a7dd1, 0x284a9475, 0x284aa7f5, 0x284aa87e, 0x284ab9d1,
+    0x284aba76, 0x284ad075, 0x284ad4fd, 0x284ae275, 0x284ae475, 0x284b4875, 0x284b49f5, 0x284b5bf5,
+    0x284b5c7e, 0x284b5dfe, 0x284b8475, 0x284bb351, 0x284bc549, 0x284c0499, 0x284c053e, 0x284c06be,
+    0x284c18be, 0x284c4119, 0x284c7e96, 0x284c8016, 0x284d2f95, 0x284d3415, 0x284d6ebe, 0x284deb16,
+    0x284df815, 0x284e5bb5, 0x284e5e85, 0x284e6305, 0x284eebf5, 0x284eed75, 0x284ef3fe, 0x284f15f5,
+    0x284f1675, 0x284f1a75, 0x284f1c75, 0x284f27f5, 0x284f29f5, 0x284f2e75, 0x284f4291, 0x284f5605,
+    0x284f8df5, 0x284f8f75, 0x284f8ffe, 0x284f93f5, 0x284f947e, 0x284f95fe, 0x284fa175, 0x284fa1fe,
+    0x284fa37e, 0x284fa7fe, 0x284fc685, 0x284fc9f5, 0x284fca75, 0x284fcbf5, 0x284fd075, 0x28500345,
+    0x28500695, 0x28500715, 0x28500895, 0x28500d3d, 0x28504109, 0x285041be, 0x285047be, 0x28507d8a,
+    0x2850aa91, 0x2850b80d, 0x2850be05, 0x2850fbf5, 0x2850fc7e, 0x2851007d, 0x285100fe, 0x2851027e,
+    0x28510df5, 0x28510e7e, 0x28510ffe, 0x2851147e, 0x28513675, 0x28513875, 0x28513cfd, 0x2851708a,
+    0x2851aff5, 0x2851b07e, 0x2851b1fe, 0x2851b67e, 0x28521591, 0x28521719, 0x28521b91, 0x28522da2,
+    0x2852685a, 0x28526cd9, 0x28527ad9, 0x28527c59, 0x285280d9, 0x2852a362, 0x2852a4e2, 0x2852a962,
+    0x2852f5e6, 0x285346e6, 0x285395d5, 0x28539662, 0x28539c62, 0x28555aa1, 0x28555c21, 0x28557ea2,
+    0x285582bd, 0x285596a1, 0x2855fc21, 0x28560a21, 0x28561021, 0x2856323d, 0x28566ed5, 0x28566f62,
+    0x285670e2, 0x28567562, 0x285712e6, 0x28576426, 0x285768bd, 0x285776a6, 0x28577826, 0x28577cbd,
+    0x28579ea6, 0x28579f22, 0x2857a0a2, 0x28581821, 0x28589255, 0x285893d9, 0x28589855, 0x2858a655,
+    0x2858a7d9, 0x2858ac55, 0x2858d2c9, 0x2858e6c9, 0x28595d66, 0x2859879e, 0x28598c1e, 0x28598d9e,
+    0x28599ba6, 0x28599f9d, 0x2859a01d, 0x2859a19d, 0x2859c226, 0x2859c3a6, 0x2859d626, 0x2859d7a6,
+    0x2859dc1d, 0x285a0fca, 0x285a1146, 0x285a3b9d, 0x285a419d, 0x285a4f1d, 0x285a4f9d, 0x285a559d,
+    0x285ac6c9, 0x285ace45, 0x285b0c99, 0x285b34bd, 0x285b3ec5, 0x285b4299, 0x285b4419, 0x285b4899,
+    0x285b81a6, 0x285bf9a6, 0x285c2195, 0x285c3515, 0x285c3595, 0x285c3b95, 0x285cac0a, 0x285cad86,
+    0x285cd4c9, 0x285ce8ca, 0x285d1499, 0x285d1619, 0x285d1abd, 0x285d2826, 0x285d2899, 0x285d2a19,
+    0x285d2ebd, 0x285d50bd, 0x285d8fa6, 0x285da3a6, 0x285dc5a6, 0x285dd9a6, 0x285ddfa6, 0x285e188a,
+    0x285e4395, 0x285e920a, 0x285e9386, 0x285f0065, 0x285f3ae5, 0x285f9de6, 0x285fb166, 0x285fed9e,
+    0x285fef1e, 0x285fef9e, 0x285ff39e, 0x285ff41e, 0x285ff59e, 0x286001a6, 0x28600326, 0x286007a5,
+    0x28602ba6, 0x28603025, 0x286063ca, 0x28606546, 0x2860a325, 0x2860a3a5, 0x2860a9a5, 0x28611ae5,
+    0x28612265, 0x2861609a, 0x2861621a, 0x28616da6, 0x28616e25, 0x28617425, 0x286192e5, 0x28619ca5,
+    0x2861d596, 0x2861db96, 0x2861e726, 0x2861e926, 0x28624da6, 0x28628925, 0x286289a5, 0x28628fa5,
+    0x2863000a, 0x28630186, 0x28633cca, 0x28637c26, 0x28637ca5, 0x2863f7a6, 0x28642da6, 0x28669aa2,
+    0x286748a2, 0x2869e69a, 0x2869fa9a, 0x286a219a, 0x286a66a2, 0x286ad28e, 0x286c0e99, 0x286c2236,
+    0x286c2299, 0x286c5e99, 0x286c8996, 0x286d1289, 0x286d8609, 0x286e6b3d, 0x286e791a, 0x286efd76,
+    0x286efdf5, 0x286f247d, 0x286f25fd, 0x286f37fd, 0x286f3875, 0x286f39f5, 0x286f9df5, 0x286fab75,
+    0x286fb176, 0x286fb1f5, 0x286fd3fd, 0x286fd9fd, 0x286fe77d, 0x286fe7f5, 0x286fedf5, 0x28705136,
+    0x28705c36, 0x28705f1a, 0x28706536, 0x2870c18e, 0x28710a7d, 0x28710bf6, 0x28711df6, 0x28711e7d,
+    0x28711ff6, 0x28715a7d, 0x2871b9f5, 0x2871bff6, 0x2871cd76, 0x2871cdf5, 0x2871d3f6, 0x2871f5fd,
+    0x287224d1, 0x287236c9, 0x28727636, 0x28727699, 0x28727836, 0x28728a36, 0x2872b299, 0x2872f196,
+    0x28739bc9, 0x28739f15, 0x28739f95, 0x2873a595, 0x2873d9b6, 0x2873da09, 0x2873e036, 0x2874160a,
+    0x28741786, 0x2874581a, 0x28745c95, 0x2874699a, 0x2874cd1a, 0x2874d01a, 0x2874d485, 0x287563f5,
+    0x28756576, 0x28758bfd, 0x28758c75, 0x28758df5, 0x28759ff5, 0x2875c009, 0x2875c785, 0x2875ff75,
+    0x28760576, 0x287605f5, 0x287612f6, 0x28761375, 0x28761976, 0x28763809, 0x28763b7d, 0x28763bf5,
+    0x287641f5, 0x287674da, 0x2876781a, 0x2876789a, 0x28767a1a, 0x28767ebd, 0x2876b29a, 0x2876b31a,
+    0x2876b936, 0x2876ef0a, 0x2877298e, 0x2877727d, 0x287773f6, 0x287785f6, 0x2877ae7d, 0x2877e20a,
+    0x2877e386, 0x28782176, 0x287821f5, 0x287827f6, 0x2878a162, 0x2879949e, 0x2879a8a1, 0x287a4421,
+    0x287beea2, 0x287c30a2, 0x287d1d21, 0x287d98a2, 0x287ef552, 0x287f4699, 0x287f5a99, 0x28806f95,
+    0x288136c5, 0x28813a15, 0x28813a95, 0x28813c19, 0x28814095, 0x28817509, 0x2881b10a, 0x2881f185,
+    0x28822df5, 0x28822f75, 0x28822ff5, 0x288233f5, 0x28823475, 0x288235f5, 0x28825c7d, 0x28826a75,
+    0x28826bf5, 0x28827075, 0x28828492, 0x2882a40a, 0x2882a586, 0x2882cff5, 0x2882d5f5, 0x2882e375,
+    0x2882e3f5, 0x2882e9f5, 0x28830bfd, 0x28834895, 0x28838309, 0x2883ec92, 0x28843c75, 0x28843df5,
+    0x2884427d, 0x28844ff5, 0x28845075, 0x288451f5, 0x2884567d, 0x2884787d, 0x2884f1f5, 0x29e5d79d,
+    0x29e6cb5e, 0x29e6ccde, 0x29e6dedd, 0x29e7075d, 0x29e7dc45, 0x29e7df91, 0x29e7e011, 0x29e7e191,
+    0x29e7e611, 0x29e7f189, 0x29e7f985, 0x29e8058a, 0x29e80706, 0x29e8315a, 0x29e832da, 0x29e837da,
+    0x29e8395a, 0x29e84559, 0x29e846d9, 0x29e84b59, 0x29e8568a, 0x29e86a05, 0x29e86d69, 0x29e86de5,
+    0x29e86f59, 0x29e873d9, 0x29e8aad6, 0x29e8ac56, 0x29e8b2d6, 0x29e8be61, 0x29e8bed5, 0x29e8c055,
+    0x29e8c4d5, 0x29e8d4d2, 0x29e8d9d2, 0x29e9498a, 0x29e95d05, 0x29e96055, 0x29e960d5, 0x29e96269,
+    0x29e966e5, 0x29e9d74a, 0x29ea5359, 0x29ea53d9, 0x29ea5559, 0x29eaccd5, 0x29eacd55, 0x29eaced5,
+    0x29ec7d59, 0x29ec7ed9, 0x29ecb95d, 0x29ee5cd5, 0x29ee5e55, 0x29ee7055, 0x29ee70d5, 0x29ee7255,
+    0x29ee76d5, 0x29eed6c5, 0x29eee74a, 0x29eee8c6, 0x29ef6425, 0x29ef65a5, 0x29ef6aa5, 0x29ef6c25,
+    0x29ef8e29, 0x29ef9325, 0x29ef94a5, 0x29efa029, 0x29efa0a5, 0x29efa225, 0x29efa6a5, 0x29efc6c9,
+    0x29efda4a, 0x29efdbc6, 0x29f00625, 0x29f007a9, 0x29f00829, 0x29f019a5, 0x29f01a25, 0x29f01ba9,
+    0x29f02025, 0x29f03ec5, 0x29f04229, 0x29f042a5, 0x29f04429, 0x29f048a5, 0x29f07b85, 0x29f07ed5,
+    0x29f07f55, 0x29f080d5, 0x29f0b6cd, 0x29f0b949, 0x29f0b9c9, 0x29f0f5ca, 0x29f172a5, 0x29f17425,
+    0x29f174a5, 0x29f1793d, 0x29f17abd, 0x29f18625, 0x29f186a5, 0x29f18825, 0x29f1aea9, 0x29f1af25,
+    0x29f1b0a5, 0x29f1e8ca, 0x29f22825, 0x29f228a5, 0x29f22a29, 0x29f35e55, 0x29f398de, 0x29f4ad8a,
+    0x29f4af06, 0x29f4c455, 0x29f4c4d5, 0x29f4c655, 0x29f4cad5, 0x29f4ff5a, 0x29f53b4a, 0x29f53cc6,
+    0x29f56651, 0x29f566d1, 0x29f56851, 0x29f56cd1, 0x29f5cc25, 0x29f5cda5, 0x29f5d225, 0x29f5f429,
+    0x29f5f4a5, 0x29f5f625, 0x29f5faa5, 0x29f62e4a, 0x29f62fc6, 0x29f66da5, 0x29f66e25, 0x29f66fa9,
+    0x29f67425, 0x29f7da25, 0x29f7daa5, 0x29f7dc25, 0x29f7e0bd, 0x29fa7cd5, 0x29fb3556, 0x29fb9251,
+    0x29fba449, 0x29fc3636, 0x29fc5d29, 0x29fc63a1, 0x29fc8b51, 0x29fc9ec5, 0x29fcdd21, 0x29fcdeb6,
+    0x29fcf0b6, 0x29fd1321, 0x29fd1921, 0x29fe44b6, 0x29fe4b36, 0x29fe56b6, 0x29fe58b6, 0x29fe5d36,
+    0x29fe7fa1, 0x29feff36, 0x2a00a91d, 0x2a00aa9d, 0x2a00e2d5, 0x2a01229d, 0x2a012436, 0x2a013636,
+    0x2a015e9d, 0x2a01ed19, 0x2a01eeb6, 0x2a021119, 0x2a021719, 0x2a022319, 0x2a022499, 0x2a022919,
+    0x2a030895, 0x2a031c15, 0x2a037909, 0x2a038085, 0x2a03f519, 0x2a03f6b6, 0x2a03f719, 0x2a03fd36,
+    0x2a0408b6, 0x2a040919, 0x2a040ab6, 0x2a040f36, 0x2a043199, 0x2a043319, 0x2a055eb6, 0x2a055f09,
+    0x2a056536, 0x2a078a36, 0x2a08429a, 0x2a0876a9, 0x2a087719, 0x2a087899, 0x2a087d19, 0x2a096ba9,
+    0x2a097015, 0x2a0a5cb6, 0x2a0a5d19, 0x2a0a5eb6, 0x2a0a6336, 0x2a0afeb6, 0x2a0b00b6, 0x2a0b1736,
+    0x2a0e4e8a, 0x2a0e6205, 0x2a0e6555, 0x2a0e65d5, 0x2a0e6755, 0x2a0e6bd9, 0x2a0e8e51, 0x2a0ea05a,
+    0x2a0edc4a, 0x2a0f0951, 0x2a0f0dd1, 0x2a0f2156, 0x2a0f6d21, 0x2a0f6ea1, 0x2a0f7321, 0x2a0f9721,
+    0x2a0f9ba1, 0x2a0fcf4a, 0x2a100ea1, 0x2a100f21, 0x2a1010a9, 0x2a117b21, 0x2a117ba1, 0x2a117d21,
+    0x2a1181bd, 0x2a14df4a, 0x2a14e0c6, 0x2a150b1a, 0x2a150c9a, 0x2a151e99, 0x2a151f19, 0x2a152099,
+    0x2a152519, 0x2a154729, 0x2a154919, 0x2a154d99, 0x2a158496, 0x2a158616, 0x2a159815, 0x2a159895,
+    0x2a159a15, 0x2a159e95, 0x2a1636c5, 0x2a163a15, 0x2a163a95, 0x2a163c29, 0x2a167509, 0x2a16b10a,
+    0x2a16edca, 0x2a172d19, 0x2a172d99, 0x2a172f19, 0x2a17a695, 0x2a17a895, 0x2a17de8d, 0x2a17e7bd,
+    0x2a1b334a, 0x2a1b6f5a, 0x2a1b729a, 0x2a1b731a, 0x2a1b749a, 0x2a1b791a, 0x2a1bec16, 0x2a1bec96,
+    0x2a1bee16, 0x2a1bf296, 0x2a1c1692, 0x2a22a621, 0x2a22acbe, 0x2a22ae3e, 0x2a22cea5, 0x2a22e221,
+    0x2a22e2a5, 0x2a22e421, 0x2a22e8a1, 0x2a22f851, 0x2a230bc5, 0x2a2349a1, 0x2a235ba1, 0x2a235c3e,
+    0x2a235dbe, 0x2a23623e, 0x2a238421, 0x2a238621, 0x2a24c8be, 0x2a256c3e, 0x2a2880a5, 0x2a289419,
+    0x2a297515, 0x2a297595, 0x2a298915, 0x2a29ed85, 0x2a2b9795, 0x2a2bcdbe, 0x2a2d59be, 0x2a2ee819,
+    0x2a2ee8a5, 0x2a2f8a11, 0x2a2f8aa5, 0x2a2fdd15, 0x2a2fe1a5, 0x2a3005be, 0x2a300a3e, 0x2a3170be,
+    0x2a346636, 0x2a364c16, 0x2a37ed61, 0x2a38017d, 0x2a382961, 0x2a3829e1, 0x2a389e36, 0x2a3a16dd,
+    0x2a3a2afe, 0x2a3a9196, 0x2a3aa396, 0x2a3acabe, 0x2a3bfcd5, 0x2a3c0a55, 0x2a3c1055, 0x2a3c10d5,
+    0x2a3c2551, 0x2a3c8a75, 0x2a3c8bf5, 0x2a3cfd75, 0x2a3cfef6, 0x2a3d03fe, 0x2a3d25f5, 0x2a3d2775,
+    0x2a3d27f5, 0x2a3d2c75, 0x2a3d2df5, 0x2a3d3975, 0x2a3d39f5, 0x2a3d3b75, 0x2a3d3ff5, 0x2a3d9abe,
+    0x2a3da3be, 0x2a3db13e, 0x2a3e18d5, 0x2a3e2cd5, 0x2a3e4151, 0x2a3e5e7e, 0x2a3e6bfe, 0x2a3e7d51,
+    0x2a3e7dd1, 0x2a3e9275, 0x2a3e93f5, 0x2a3e9475, 0x2a3ea5f5, 0x2a3ea675, 0x2a3ea7f5, 0x2a3ec996,
+    0x2a3f0bf5, 0x2a3f0d76, 0x2a3f0dfe, 0x2a3f127e, 0x2a3f13f6, 0x2a3f1ffe, 0x2a3f2176, 0x2a3f25f6,
+    0x2a3f47f5, 0x2a3f4875, 0x2a3f49f5, 0x2a42d7f5, 0x2a42d975, 0x2a42de75, 0x2a42dff5, 0x2a42ebf5,
+    0x2a42ed75, 0x2a42f1f5, 0x2a430616, 0x2a435175, 0x2a4352f6, 0x2a4357fe, 0x2a435976, 0x2a43657e,
+    0x2a436b76, 0x2a438d75, 0x2a438df5, 0x2a438f75, 0x2a4393f5, 0x2a44bdf5, 0x2a44d1fe, 0x2a44f9f5,
+    0x2a44fa75, 0x2a44fbf5, 0x2a457376, 0x2a4573fe, 0x2a457576, 0x2a4860a1, 0x2a488919, 0x2a48da21,
+    0x2a497e15, 0x2a4b11be, 0x2a4e8c15, 0x2a4f7ff5, 0x2a4f8175, 0x2a4f867e, 0x2a4f87fe, 0x2a4fa9f5,
+    0x2a4fb075, 0x2a4fbbf5, 0x2a4fbdf5, 0x2a4fc275, 0x2a4fe585, 0x2a5021f5, 0x2a502375, 0x2a5023fe,
+    0x2a503575, 0x2a5035fe, 0x2a50377e, 0x2a505df5, 0x2a505ff5, 0x2a518e75, 0x2a518ff5, 0x2a51907e,
+    0x2a5194fe, 0x2a51a1f5, 0x2a51a27e, 0x2a51a3fe, 0x2a51ca75, 0x2a51cc75, 0x2a5243f5, 0x2a52447e,
+    0x2a5245fe, 0x2a54cac6, 0x2a54dcd6, 0x2a54e015, 0x2a54e096, 0x2a54e216, 0x2a54e699, 0x2a55093e,
+    0x2a551b1a, 0x2a551e1a, 0x2a555886, 0x2a558211, 0x2a558296, 0x2a558416, 0x2a558896, 0x2a55e7fe,
+    0x2a55e97e, 0x2a55edfe, 0x2a560ff5, 0x2a5611f5, 0x2a561675, 0x2a564b86, 0x2a56863e, 0x2a568975,
+    0x2a5689fe, 0x2a568b7e, 0x2a57f5f5, 0x2a57f67e, 0x2a57f7fe, 0x2a57fc7e, 0x2a59e255, 0x2a5b318a,
+    0x2a5b4505, 0x2a5b4855, 0x2a5b48d5, 0x2a5b4a59, 0x2a5b4ed5, 0x2a5bbf4a, 0x2a5bec51, 0x2a5bf0d1,
+    0x2a5bffd6, 0x2a5c5021, 0x2a5c51a1, 0x2a5c5621, 0x2a5c7a21, 0x2a5c7ea1, 0x2a5cb24a, 0x2a5cb3c6,
+    0x2a5cf1a1, 0x2a5cf221, 0x2a5cf825, 0x2a5e5e21, 0x2a5e5ea1, 0x2a5e6021, 0x2a5e64bd, 0x2a5f945d,
+    0x2a60881e, 0x2a60899e, 0x2a609b9d, 0x2a60c41d, 0x2a61aec9, 0x2a61b645, 0x2a61c24a, 0x2a61c3c6,
+    0x2a61ee1a, 0x2a61ef9a, 0x2a61f49a, 0x2a620199, 0x2a620219, 0x2a620399, 0x2a620819, 0x2a6226c5,
+    0x2a622aa5, 0x2a622c19, 0x2a623099, 0x2a626796, 0x2a626916, 0x2a626996, 0x2a627b15, 0x2a627b95,
+    0x2a627d15, 0x2a628195, 0x2a62e185, 0x2a631d15, 0x2a631d95, 0x2a6323a5, 0x2a63940a, 0x2a639586,
+    0x2a63d0ca, 0x2a641019, 0x2a641099, 0x2a641219, 0x2a648995, 0x2a648a15, 0x2a648b95, 0x2a64c18d,
+    0x2a66ef9e, 0x2a68164a, 0x2a68559a, 0x2a68561a, 0x2a68579a, 0x2a685c1a, 0x2a68cf16, 0x2a68cf96,
+    0x2a68d116, 0x2a68d596, 0x2a6d5a1e, 0x2a6e0e36, 0x2a6ec69a, 0x2a6ed236, 0x2a6efb19, 0x2a6f4016,
+    0x2a6ff415, 0x2a7182b6, 0x2a7184b6, 0x2a719236, 0x2a738596, 0x2a743995, 0x2a747436, 0x2a74fd95,
+    0x2a756109, 0x2a75f175, 0x2a75f2f6, 0x2a75f375, 0x2a75f7f5, 0x2a75f976, 0x2a761bf5, 0x2a762075,
+    0x2a7621f5, 0x2a762df5, 0x2a762f75, 0x2a7633f5, 0x2a765b85, 0x2a769375, 0x2a7699f5, 0x2a76a6f6,
+    0x2a76a775, 0x2a76ad76, 0x2a76cff5, 0x2a76d5f5, 0x2a7746b6, 0x2a774709, 0x2a774d36, 0x2a77fff5,
+    0x2a780176, 0x2a7801f5, 0x2a7807f6, 0x2a781376, 0x2a7813f5, 0x2a781576, 0x2a7819f6, 0x2a783c75,
+    0x2a783df5, 0x2a78b576, 0x2a78b5f5, 0x2a78bbf6, 0x2a7b3c46, 0x2a7b4e45, 0x2a7b5196, 0x2a7b5215,
+    0x2a7b5399, 0x2a7b5816, 0x2a7b7a36, 0x2a7bc88a, 0x2a7bca06, 0x2a7bf391, 0x2a7bf411, 0x2a7bf596,
+    0x2a7bfa16, 0x2a7c0616, 0x2a7c0916, 0x2a7c2f92, 0x2a7c5975, 0x2a7c5af6, 0x2a7c5f76, 0x2a7c817d,
+    0x2a7c81f5, 0x2a7c8375, 0x2a7c87f5, 0x2a7cbb8a, 0x2a7cbd06, 0x2a7cfaf6, 0x2a7cfb75, 0x2a7d0176,
+    0x2a7e280a, 0x2a7e6776, 0x2a7e67f5, 0x2a7e6976, 0x2a7e6df6, 0x2a81b74a, 0x2a81f69a, 0x2a81f71a,
+    0x2a81f89a, 0x2a81fd1a, 0x2a827216, 0x2a827696, 0x2a881ec5, 0x2a882215, 0x2a882295, 0x2a882419,
+    0x2a882899, 0x2a885d1a, 0x2a88990a, 0x2a88c411, 0x2a88c491, 0x2a88c611, 0x2a88ca91, 0x2a88d996,
+    0x2a88de16, 0x2a892975, 0x2a8929f5, 0x2a892b75, 0x2a892ff5, 0x2a8951fd, 0x2a895275, 0x2a8953f5,
+    0x2a895875, 0x2a898c0a, 0x2a898d86, 0x2a89cb75, 0x2a89cbf5, 0x2a8b37f5, 0x2a8b3875, 0x2a8b39f5,
+    0x2a8b3e7d, 0x2df73921, 0x2df7e721, 0x2df7e8a9, 0x2df812a2, 0x2df815fd, 0x2df874d1, 0x2df87651,
+    0x2df883e2, 0x2df88ce2, 0x2df953a6, 0x2df95526, 0x2df967d1, 0x2df97fe2, 0x2df99f66, 0x2df9cd21,
+    0x2df9cea6, 0x2df9f5a2, 0x2df9f722, 0x2dfe5309, 0x2dfe72cd, 0x2dfe7bfd, 0x2dfe86d5, 0x2dfe8ffd,
+    0x2dfeb719, 0x2dfebbbd, 0x2dfebd26, 0x2dfecb19, 0x2dfecf26, 0x2dfecfbd, 0x2dfed126, 0x2dfed7d2,
+    0x2dfef319, 0x2dff0599, 0x2dffa28d, 0x2dffb68d, 0x2dffbfbd, 0x2dffe629, 0x2dffeabd, 0x2dfff895,
+    0x2e002526, 0x2e003026, 0x2e003926, 0x2e04e3fd, 0x2e051f19, 0x2e052326, 0x2e0523bd, 0x2e052526,
+    0x2e055999, 0x2e055b19, 0x2e055fbd, 0x2e06210a, 0x2e064c95, 0x2e068426, 0x2e068d26, 0x2e10da69,
+    0x2e10dae9, 0x2e117ae9, 0x2e118a69, 0x2e118e69, 0x2e118ee9, 0x2e119069, 0x2e11b31a, 0x2e11b7bd,
+    0x2e11b916, 0x2e11cd16, 0x2e11fd0d, 0x2e12063d, 0x2e120906, 0x2e12befd, 0x2e12c0fd, 0x2e12fb7d,
+    0x2e12fcfd, 0x2e1360fd, 0x2e137069, 0x2e137106, 0x2e1374fd, 0x2e1396e9, 0x2e172e69, 0x2e172ee9,
+    0x2e174269, 0x2e17ba69, 0x2e17de69, 0x2e17e269, 0x2e17e2e9, 0x2e17e469, 0x2e17efe9, 0x2e17f069,
+    0x2e17f1e9, 0x2e17f669, 0x2e181b1a, 0x2e182116, 0x2e18510d, 0x2e185a3d, 0x2e187f9a, 0x2e188d0d,
+    0x2e18963d, 0x2e1912fd, 0x2e1914fd, 0x2e1926fd, 0x2e194f7d, 0x2e1950fd, 0x2e1962fd, 0x2e198016,
+    0x2e198916, 0x2e19c269, 0x2e19c469, 0x2e19c8fd, 0x2e19d669, 0x2e19fe69, 0x2e19fee9, 0x2e1a0069,
+    0x2e1a04fd, 0x2e1e6cd1, 0x2e1e6e51, 0x2e1e84e2, 0x2e1ed219, 0x2e1ed399, 0x2e1efaa2, 0x2e1efc22,
+    0x2e1f00a2, 0x2e1fc20a, 0x2e1feda2, 0x2e1fef22, 0x2e1ff3a2, 0x2e234409, 0x2e23d669, 0x2e23d6e9,
+    0x2e23fd69, 0x2e23fee9, 0x2e2410e9, 0x2e241169, 0x2e2412e9, 0x2e247269, 0x2e2476e9, 0x2e247869,
+    0x2e248469, 0x2e2485e9, 0x2e248a69, 0x2e248ae9, 0x2e24ace9, 0x2e24b2e9, 0x2e24c0e9, 0x2e24c269,
+    0x2e24c6e9, 0x2e24e995, 0x2e24eb15, 0x2e24efbd, 0x2e24fd95, 0x2e24ff15, 0x2e2503bd, 0x2e25210d,
+    0x2e252a3d, 0x2e253809, 0x2e253e3d, 0x2e256009, 0x2e25dee9, 0x2e25e37d, 0x2e25e4fd, 0x2e25f0e9,
+    0x2e25f269, 0x2e25f2e9, 0x2e25f6fd, 0x2e25f77d, 0x2e25f8fd, 0x2e261969, 0x2e261ae9, 0x2e262ce9,
+    0x2e262d69, 0x2e262ee9, 0x2e26337d, 0x2e2692e9, 0x2e269469, 0x2e2698fd, 0x2e26a669, 0x2e26a6e9,
+    0x2e26a869, 0x2e26acfd, 0x2e26cee9, 0x2e2a3ce9, 0x2e2a3e69, 0x2e2a6569, 0x2e2a66e9, 0x2e2a78e9,
+    0x2e2ade69, 0x2e2adee9, 0x2e2af269, 0x2e2b1ae9, 0x2e2b51a9, 0x2e2b5329, 0x2e2b8ba9, 0x2e2b8c29,
+    0x2e2bf529, 0x2e2c02a9, 0x2e2c44e9, 0x2e2c4669, 0x2e2c46e9, 0x2e2c5869, 0x2e2c58e9, 0x2e2c5a69,
+    0x2e2c8169, 0x2e2c82e9, 0x2e2cfa69, 0x2e2cfae9, 0x2e304011, 0x2e30a561, 0x2e30cde1, 0x2e30e1e1,
+    0x2e32623e, 0x2e3262be, 0x2e32b3fe, 0x2e32e9e5, 0x2e32effe, 0x2e32f07e, 0x2e32fde5, 0x2e330cd6,
+    0x2e335726, 0x2e337226, 0x2e338d11, 0x2e339aa2, 0x2e36d0d5, 0x2e37ffe5, 0x2e3801e5, 0x2e38968d,
+    0x2e389fbd, 0x2e38ece5, 0x2e395a7d, 0x2e396c7d, 0x2e396e7d, 0x2e39898d, 0x2e399d96, 0x2e39b292,
+    0x2e39be92, 0x2e39cde5, 0x2e39d27d, 0x2e39d3e6, 0x2e39e1fe, 0x2e39e7e6, 0x2e39ee92, 0x2e3a09e5,
+    0x2e3a0e7d, 0x2e3e6365, 0x2e3f40e5, 0x2e3ff196, 0x2e401a26, 0x2e403be6, 0x2e4071e5, 0x2e43a155,
+    0x2e45affe, 0x2e45c3fe, 0x2e45d87e, 0x2e4a833d, 0x2e4b3649, 0x2e4b36c9, 0x2e4b39c5, 0x2e4b6a8d,
+    0x2e4b76bd, 0x2e4bae5a, 0x2e4bb2fd, 0x2e4bb4fe, 0x2e4bd6da, 0x2e4bdb7d, 0x2e4bdcfd, 0x2e4beada,
+    0x2e4c03fe, 0x2e4c2afe, 0x2e4c693e, 0x2e4c91be, 0x2e4c99ce, 0x2e4c9a4e, 0x2e4ca2fd, 0x2e4ca37d,
+    0x2e4ca53e, 0x2e4ca5be, 0x2e4ca67d, 0x2e4cc9d5, 0x2e4cce7d, 0x2e4ccfd6, 0x2e4cddd5, 0x2e4d13fe,
+    0x2e4d1cfe, 0x2e4d1fc6, 0x2e4d3bcd, 0x2e4d44fd, 0x2e50aebd, 0x2e50d73d, 0x2e50eb3d, 0x2e5242fd,
+    0x2e52437d, 0x2e52ee4e, 0x2e5331d5, 0x2e5367fe, 0x2e5373c6, 0x2e539651, 0x2e53a3cd, 0x2e580461,
+    0x2e58e1d5, 0x2e58f555, 0x2e58f5d5, 0x2e590a51, 0x2e594651, 0x2e5946d1, 0x2e598511, 0x2e5992a2,
+    0x2e59bb3e, 0x2e59ea7e, 0x2e5a12e2, 0x2e5d7f3d, 0x2e5da7bd, 0x2e5dbbbd, 0x2e5ed2d9, 0x2e5ed77d,
+    0x2e5f0ed9, 0x2e5f137d, 0x2e5f35d1, 0x2e5f95cd, 0x2e5f967e, 0x2e5f9b3d, 0x2e5fbe4d, 0x2e5fc3bd,
+    0x2e5fd24d, 0x2e5fd73d, 0x2e5fd7bd, 0x2e5fe692, 0x2e6001d5, 0x2e6015d5, 0x2e6037cd, 0x2e604bfe,
+    0x2e64e791, 0x2e64e911, 0x2e64ffbd, 0x2e6538d9, 0x2e653a59, 0x2e653afe, 0x2e653efd, 0x2e653f7e,
+    0x2e6540fe, 0x2e654c59, 0x2e654cfe, 0x2e654e7e, 0x2e6552fe, 0x2e6574d9, 0x2e657559, 0x2e6576d9,
+    0x2e657b7d, 0x2e65ba7d, 0x2e65c7d5, 0x2e65e9cd, 0x2e65ea7e, 0x2e65ef3d, 0x2e6602bd, 0x2e66033d,
+    0x2e6618d1, 0x2e662b3d, 0x2e662bbd, 0x2e666855, 0x2e6669d5, 0x2e666e7d, 0x2e669ffe, 0x2e66a249,
+    0x2e66a2fe, 0x2e66a8fe, 0x2e6b4fd1, 0x2e6b5159, 0x2e6b67e2, 0x2e6bb519, 0x2e6bdda2, 0x2e6bdf22,
+    0x2e6be3a2, 0x2e6c22a2, 0x2e6c3026, 0x2e6c8126, 0x2e6ca50a, 0x2e6cd0a2, 0x2e6cd6a2, 0x2e70f465,
+    0x2e70f5e5, 0x2e7159e5, 0x2e716de5, 0x2e71a3e5, 0x2e71a9e5, 0x2e71cc95, 0x2e71ce19, 0x2e71e095,
+    0x2e71e6bd, 0x2e720d26, 0x2e722126, 0x2e727da6, 0x2e72c1e6, 0x2e72c67d, 0x2e72c7e6, 0x2e72d5e6,
+    0x2e72dbe6, 0x2e72fde6, 0x2e731066, 0x2e7311e6, 0x2e73167d, 0x2e7375e5, 0x2e737be6, 0x2e7389e5,
+    0x2e738fe6, 0x2e7834a5, 0x2e787526, 0x2e78d826, 0x2e7929e6, 0x2e792fe6, 0x2e793be6, 0x2e796466,
+    0x2e7965e6, 0x2e79dd66, 0x2e79dde5, 0x2e79e3e6, 0x2e7e8c56, 0x2e7eb296, 0x2e7f039a, 0x2e7f278a,
+    0x2e7f4716, 0x2e806b8a, 0x2e8376d9, 0x2e84e1c5, 0x2e851d16, 0x2e8548fd, 0x2e85565a, 0x2e85585a,
+    0x2e855cfd, 0x2e8592da, 0x2e85c3d6, 0x2e85d7d6, 0x2e85f3ce, 0x2e85ffc6, 0x2e8607ce, 0x2e8613c6,
+    0x2e862fce, 0x2e864cfd, 0x2e8677d6, 0x2e868bd6, 0x2e86c7c6, 0x2e89cad9, 0x2e8b591a, 0x2e8b5a96,
+    0x2e8b7116, 0x2e8baa5a, 0x2e8bac5a, 0x2e8bb0fd, 0x2e8bbe5a, 0x2e8bcf8a, 0x2e8be6da, 0x2e8be85a,
+    0x2e8becfd, 0x2e8c2bd6, 0x2e8c5bce, 0x2e8c67c6, 0x2e8cd956, 0x2e8cd9d5, 0x2e8cdfd6, 0x2e8d504a,
+    0x2e91d5a2, 0x2e91d722, 0x2e927921, 0x2e92dce1, 0x2e92de61, 0x2e9306e2, 0x2e9672d9, 0x2e969afd,
+    0x2e96aed9, 0x2e982992, 0x2e982b12, 0x2e987ad9, 0x2e987c59, 0x2e9880fd, 0x2e988e59, 0x2e988ed9,
+    0x2e989059, 0x2e9894fd, 0x2e98b6fd, 0x2e98f5d5, 0x2e9909d5, 0x2e992bcd, 0x2e995ad2, 0x2e997eca,
+    0x2fff11fd, 0x300005bd, 0x30003b21, 0x300041bd, 0x30055fd1, 0x30056151, 0x300577fd, 0x3005b7bd,
+    0x3005b926, 0x3005c519, 0x3005c6a6, 0x3005ed19, 0x3005ed99, 0x3005ef19, 0x3005f3bd, 0x300644bd,
+    0x3006e095, 0x3006e229, 0x300c1919, 0x300c1aa6, 0x300c98bd, 0x300cd326, 0x3013b716, 0x3017c2e9,
+    0x3017d4e9, 0x3017d669, 0x30184e69, 0x301876e9, 0x30187869, 0x30188a69, 0x3018b516, 0x3018e50d,
+    0x3018ee3d, 0x3018f106, 0x3018fb89, 0x30192389, 0x30192409, 0x30192a3d, 0x3019a8fd, 0x3019b669,
+    0x3019bafd, 0x3019dce9, 0x3019de69, 0x3019dee9, 0x3019e37d, 0x3019e4fd, 0x3019f069, 0x3019f0e9,
+    0x3019f269, 0x3019f6fd, 0x301a1d16, 0x301a5669, 0x301a5869, 0x301a5906, 0x301a5cfd, 0x301a6a69,
+    0x301a9269, 0x301a92e9, 0x301a9469, 0x301a98fd, 0x301e2a69, 0x301ea269, 0x301ede69, 0x301f1b16,
+    0x30200869, 0x30200a69, 0x30200efd, 0x30201c69, 0x30204469, 0x302044e9, 0x30204669, 0x30204afd,
+    0x3020be69, 0x302639bd, 0x302be595, 0x302be715, 0x302c1f89, 0x302c2009, 0x302c9fbd, 0x302cd8e9,
+    0x302cda69, 0x302cdae9, 0x302cdf7d, 0x302ce0fd, 0x302cec69, 0x302cece9, 0x302cee69, 0x302cf2fd,
+    0x302d14e9, 0x302d1569, 0x302d16e9, 0x302d1b7d, 0x302d4f0a, 0x302d8e69, 0x302d8ee9, 0x302d9069,
+    0x30334069, 0x303340e9, 0x30334269, 0x30407816, 0x3040cfe6, 0x3040dd66, 0x304105e5, 0x304ca555,
+    0x304cb955, 0x304ccdd1, 0x304d09d1, 0x304d0a51, 0x3050dd51, 0x305142bd, 0x30516b3d, 0x30517f3d,
+    0x30529cfe, 0x3052ab06, 0x3052aefe, 0x3052d259, 0x3052d77d, 0x3052f951, 0x3053513e, 0x30535ebd,
+    0x3053653e, 0x3053824d, 0x3053873d, 0x30538dbe, 0x30539abd, 0x30539b3d, 0x3053a13e, 0x3053cbd6,
+    0x3053fbfe, 0x305404fe, 0x305407c6, 0x30543a49, 0x3059adfe, 0x3059b2bd, 0x3059eebd, 0x3059ef3d,
+    0x3065e059, 0x30664e7d, 0x30667e7e, 0x30668a7e, 0x3066fdd5, 0x3067267e, 0x306c3459, 0x306c34fe,
+    0x306c367e, 0x306cafd5, 0x306cb47d, 0x306ceefe, 0x30731cbd, 0x3077b3e5, 0x3077dc65, 0x3077dde5,
+    0x3078c895, 0x3078ca19, 0x3078cebd, 0x30790926, 0x30796c11, 0x3079bde5, 0x3079c27d, 0x3079c3e6,
+    0x3079cfe5, 0x3079d166, 0x3079d5e6, 0x3079f7fd, 0x3079f865, 0x3079f9e5, 0x3079fe7d, 0x307a71e5,
+    0x308023e5, 0x308029e6, 0x308c0516, 0x308c3e59, 0x308c4059, 0x308c44fd, 0x308c5259, 0x308c7a7d,
+    0x308c7ad9, 0x308c80fd, 0x308cbfd6, 0x308cefcd, 0x308cfbc6, 0x308d73d6, 0x3092a659, 0x309f7659,
+    0x309f76d9, 0x309f7859, 0x309ff1d5, 0x309ff67d, 0x30a030fd, 0x340d03d5, 0x340d0462, 0x340d05e2,
+    0x340d0a62, 0x340df926, 0x340e0ba6, 0x340e0d26, 0x340e33a6, 0x340e3422, 0x340e35a2, 0x340ead21,
+    0x3413a999, 0x3413ab19, 0x3413afbd, 0x3413bd99, 0x3413bf19, 0x3413c3bd, 0x3413e599, 0x34142326,
+    0x341424a6, 0x341436a6, 0x34143726, 0x341438a6, 0x34143d3d, 0x3414ad8a, 0x3414d895, 0x34151309,
+    0x3415270a, 0x341a1319, 0x341a17bd, 0x341a8aa6, 0x341a8b26, 0x341a8ca6, 0x341a913d, 0x341ab3a6,
+    0x341ac526, 0x341ac5a6, 0x3426e63d, 0x3426fa3d, 0x34279f7d, 0x3427a0fd, 0x3427b2fd, 0x3427b37d,
+    0x3427b4fd, 0x3427ef7d, 0x34284ee9, 0x34285069, 0x342854fd, 0x34286269, 0x342862e9, 0x34286469,
+    0x342868fd, 0x34288ae9, 0x342d4e3d, 0x342e06fd, 0x342e077d, 0x342e08fd, 0x342e1afd, 0x342e437d,
+    0x342eb669, 0x342eb6e9, 0x342eb869, 0x342ebcfd, 0x343ad77d, 0x343aeb7d, 0x343b86e9, 0x34481ca2,
+    0x344e4cfd, 0x344ec1e5, 0x344ed5fe, 0x345529fe, 0x3460a77e, 0x3460a8fe, 0x3460cf7d, 0x34615d3e,
+    0x34620afe, 0x34620dfe, 0x346210fe, 0x346825d5, 0x34684e7e, 0x347a337e, 0x347aacfd, 0x34809519,
+    0x348110a2, 0x3486c095, 0x3487b466, 0x3487b5e6, 0x3487ba7d, 0x3487c7e6, 0x3487c866, 0x3487c9e6,
+    0x3487ce7d, 0x3487f066, 0x348869e5, 0x348e1be6, 0x348e1c66, 0x348e1de6, 0x349a3cfd, 0x349a50fd,
+    0x349b65d5, 0x349ba049, 0x349bb44a, 0x34a0a4fd, 0x34a11e7d, 0x34a146fd, 0x38c3a2c5, 0x38c3a505,
+    0x38c3a5c9, 0x38c3a8d1, 0x38c3b895, 0x38c3bd15, 0x38c3be95, 0x38c3bf21, 0x38c3cc15, 0x38c3cc95,
+    0x38c3ce49, 0x38c3cfc5, 0x38c3d095, 0x38c3d115, 0x38c3e111, 0x38c3e1c5, 0x38c3e591, 0x38c3e725,
+    0x38c3e7a9, 0x38c3f78a, 0x38c3fa86, 0x38c41f49, 0x38c420c5, 0x38c43699, 0x38c44a19, 0x38c4710a,
+    0x38c47406, 0x38c48509, 0x38c4998a, 0x38c4bfe5, 0x38c4c469, 0x38c4c5e5, 0x38c4c669, 0x38c4e865,
+    0x38c4ece5, 0x38c4ee5d, 0x38c4fbe5, 0x38c4fc65, 0x38c50069, 0x38c500e5, 0x38c52995, 0x38c53d15,
+    0x38c561dd, 0x38c5665d, 0x38c567e5, 0x38c573dd, 0x38c57565, 0x38c575e9, 0x38c579e5, 0x38c57a69,
+    0x38c58e11, 0x38c59c5d, 0x38c59ddd, 0x38c5a25d, 0x38c5b05e, 0x38c5dd8a, 0x38c5f189, 0x38c5f595,
+    0x38c62c6d, 0x38c630d9, 0x38c63265, 0x38c632e9, 0x38c654ed, 0x38c65959, 0x38c65ad9, 0x38c6686d,
+    0x38c668ed, 0x38c66cd9, 0x38c66d59, 0x38c6aa69, 0x38c6abd5, 0x38c6ac55, 0x38c6e4ca, 0x38c6e7c6,
+    0x38c70d4a, 0x38c71046, 0x38c72561, 0x38c75b6d, 0x38c75bed, 0x38c75fd5, 0x38c76055, 0x38c761d5,
+    0x38c79ef6, 0x38c7d961, 0x38c81615, 0x38c84cd9, 0x38c84e65, 0x38c84ee9, 0x38c852e5, 0x38c8895a,
+    0x38c945fa, 0x38ca0c99, 0x38ca0ec9, 0x38ca1111, 0x38ca11c5, 0x38ca1291, 0x38ca1311, 0x38ca3526,
+    0x38ca35c5, 0x38ca3995, 0x38ca3b15, 0x38ca3b95, 0x38ca4b8a, 0x38ca4e86, 0x38ca71d9, 0x38ca7659,
+    0x38ca77e5, 0x38ca7869, 0x38ca8626, 0x38ca86c5, 0x38ca8a91, 0x38ca8c11, 0x38ca9a59, 0x38ca9c89,
+    0x38ca9ed9, 0x38ca9f85, 0x38caa059, 0x38caadd9, 0x38caae59, 0x38cab009, 0x38cab089, 0x38cab259,
+    0x38cab2d9, 0x38cab385, 0x38cac50a, 0x38cac806, 0x38caefe9, 0x38caf155, 0x38caf1d5, 0x38cb7911,
+    0x38cb79c5, 0x38cb7d91, 0x38cb7f11, 0x38cb8d55, 0x38cb8f89, 0x38cb9285, 0x38cba309, 0x38cba389,
+    0x38cba685, 0x38cbb5d1, 0x38cbe2dd, 0x38cbe476, 0x38cbe4ea, 0x38cbf409, 0x38cc06dd, 0x38cc0785,
+    0x38cc0b5d, 0x38cc0cdd, 0x38cc1edd, 0x38cc1f5d, 0x38cc20dd, 0x38cc318a, 0x38cc3486, 0x38cc5c55,
+    0x38cc5dd5, 0x38cc5e55, 0x38cc96ca, 0x38cd8c25, 0x38cd8da5, 0x38cd8e25, 0x38cd9bed, 0x38cda051,
+    0x38cda1d1, 0x38cda251, 0x38ce012d, 0x38ce05a5, 0x38ce0725, 0x38ce07a9, 0x38ce29ad, 0x38ce2e25,
+    0x38ce2fa5, 0x38ce3d2d, 0x38ce3dad, 0x38ce3fc9, 0x38ce41a5, 0x38ce4225, 0x38ce42c5, 0x38ce43a5,
+    0x38ce4d89, 0x38ce5085, 0x38ce5211, 0x38ce5691, 0x38ce5811, 0x38ce6655, 0x38ce6ad5, 0x38ce6b85,
+    0x38ce6c55, 0x38ce7855, 0x38ce79d5, 0x38ce7a55, 0x38ce7c09, 0x38ce7e55, 0x38ce7ed5, 0x38ce8ed1,
+    0x38ce9351, 0x38ce94e5, 0x38cebbd9, 0x38cebd76, 0x38cebdea, 0x38cecd09, 0x38cedfd9, 0x38cee459,
+    0x38cee5d9, 0x38cef7d9, 0x38cef859, 0x38cef9d9, 0x38cf0865, 0x38cf0ce9, 0x38cf0e51, 0x38cf0ed1,
+    0x38cf6da5, 0x38cf7229, 0x38cf73a5, 0x38cf7429, 0x38cf9625, 0x38cf9aa5, 0x38cf9c25, 0x38cfa825,
+    0x38cfa9a5, 0x38cfaa25, 0x38cfac49, 0x38cfae29, 0x38cfaea5, 0x38cfaf45, 0x38cfb025, 0x38cfbc51,
+    0x38cfbdd1, 0x38cfbe51, 0x38cfc009, 0x38cfc251, 0x38cfc2d1, 0x38cfd2d5, 0x38cfd755, 0x38cfd8d5,
+    0x38cfead5, 0x38cfeb55, 0x38cfecd5, 0x38d00fa5, 0x38d01425, 0x38d015a5, 0x38d021a5, 0x38d02325,
+    0x38d023a9, 0x38d025ea, 0x38d027a5, 0x38d02829, 0x38d028ea, 0x38d03bd1, 0x38d04a25, 0x38d04ba5,
+    0x38d04dc9, 0x38d05025, 0x38d07649, 0x38d077c5, 0x38d089c5, 0x38d08d95, 0x38d08f15, 0x38d08f95,
+    0x38d0a115, 0x38d0cc69, 0x38d0f211, 0x38d101d9, 0x38d10259, 0x38d10409, 0x38d10489, 0x38d106d9,
+    0x38d10785, 0x38d11a59, 0x38d14555, 0x38d145d5, 0x38d14da5, 0x38d15955, 0x38d18be5, 0x38d1b465,
+    0x38d1bd7a, 0x38d1c7e5, 0x38d1c865, 0x38d1cae6, 0x38d1d0fa, 0x38d1e511, 0x38d1f709, 0x38d1f789,
+    0x38d1fa85, 0x38d20605, 0x38d236dd, 0x38d23876, 0x38d238ea, 0x38d24a76, 0x38d272dd, 0x38d2735d,
+    0x38d274dd, 0x38d2805d, 0x38d2932d, 0x38d29d91, 0x38d2b055, 0x38d2b1d5, 0x38d2b255, 0x38d2ba2d,
+    0x38d2bfed, 0x38d2c3d5, 0x38d2c455, 0x38d2c5d5, 0x38d2d8d1, 0x38d2da65, 0x38d2f86d, 0x38d302f6,
+    0x38d30eed, 0x38d3106d, 0x38d320ed, 0x38d32b59, 0x38d3346d, 0x38d334ed, 0x38d33d59, 0x38d35269,
+    0x38d353d1, 0x38d37969, 0x38d3b7a9, 0x38d3b925, 0x38d3b9a9, 0x38d3cd51, 0x38d3e025, 0x38d3e1a5,
+    0x38d3e225, 0x38d3f3a9, 0x38d3f425, 0x38d3f5a5, 0x38d41e55, 0x38d428ed, 0x38d43055, 0x38d446f6,
+    0x38d4552d, 0x38d455c5, 0x38d459a5, 0x38d45b25, 0x38d45ba9, 0x38d4672d, 0x38d46d25, 0x38d46da9,
+    0x38d48151, 0x38d48fad, 0x38d4912d, 0x38d491ad, 0x38d495a5, 0x38d49625, 0x38d497a5, 0x38d4a32d,
+    0x38d4a3ad, 0x38d4a52d, 0x38d4a9a5, 0x38d4be11, 0x38d4cdd5, 0x38d4ce55, 0x38d4d009, 0x38d4df1a,
+    0x38d4e1d5, 0x38d4e655, 0x38d506c9, 0x38d50fd9, 0x38d51176, 0x38d511ea, 0x38d52376, 0x38d54bd9,
+    0x38d54c59, 0x38d54dd9, 0x38d5595a, 0x38d5897a, 0x38d596e6, 0x38d59cfa, 0x38d5c1a5, 0x38d5c245,
+    0x38d5c629, 0x38d5c7a5, 0x38d5c829, 0x38d5edfa, 0x38d5fda5, 0x38d5fe25, 0x38d602a5, 0x38d60425,
+    0x38d60ee6, 0x38d611a5, 0x38d61629, 0x38d63ed5, 0x38d63f55, 0x38d640d5, 0x38d64c55, 0x38d66776,
+    0x38d675a5, 0x38d67725, 0x38d677a9, 0x38d67c29, 0x38d689a9, 0x38d6b3a5, 0x38d6e191, 0x38d6e315,
+    0x38d6e391, 0x38d71c0a, 0x38d71f06, 0x38d746d9, 0x38d748e9, 0x38d76f59, 0x38d770d9, 0x38d77161,
+    0x38d782d9, 0x38d78359, 0x38d7958a, 0x38d79886, 0x38d7c069, 0x38d7c1d5, 0x38d7c255, 0x38d7faca,
+    0x38d812d1, 0x38d84805, 0x38d85dd5, 0x38d87155, 0x38d871d5, 0x38d88651, 0x38d8aa49, 0x38d92cd5,
+    0x38d92e55, 0x38d92ed5, 0x38d9674a, 0x38d97f51, 0x38da5ca9, 0x38da5e21, 0x38da5ea1, 0x38da6c6d,
+    0x38da70d1, 0x38da7255, 0x38da72d1, 0x38dad1ad, 0x38dad621, 0x38dad829, 0x38dafa2d, 0x38dafea1,
+    0x38db0021, 0x38db00a1, 0x38db0dad, 0x38db0e2d, 0x38db1221, 0x38db12a1, 0x38db1421, 0x38db36d9,
+    0x38db3b55, 0x38db3cd5, 0x38db4a59, 0x38db4ad9, 0x38db4ed5, 0x38db4f55, 0x38db5f59, 0x38db63d1,
+    0x38dbdd69, 0x38dbded5, 0x38dbdf51, 0x38dc42a9, 0x38dc44a9, 0x38dc6b29, 0x38dc6ca1, 0x38dc6d21,
+    0x38dc7ea9, 0x38dc7f29, 0x38dc80a1, 0x38dc8e51, 0x38dc8ed1, 0x38dc92d1, 0x38dc9351, 0x38dca1c5,
+    0x38dcca45, 0x38dce021, 0x38dce4a1, 0x38dcf221, 0x38dcf3b5, 0x38dcf429, 0x38dcf835, 0x38dcf8a9,
+    0x38dd1aa1, 0x38dd1c21, 0x38dd1ca1, 0x38dd20a1, 0x38dd2121, 0x38dd7259, 0x38dd73d5, 0x38dd7455,
+    0x38ddc4d1, 0x38ddc551, 0x38dea39d, 0x38dea41d, 0x38deb1dd, 0x38deda6e, 0x38df171d, 0x38df1b9d,
+    0x38df2b6e, 0x38df3f9d, 0x38df441d, 0x38df459d, 0x38df531e, 0x38df539e, 0x38df579e, 0x38df581e,
+    0x38e00e99, 0x38e01019, 0x38e01099, 0x38e10195, 0x38e10315, 0x38e10395, 0x38e15291, 0x38e15411,
+    0x38e15491, 0x38e18ad9, 0x38e18f59, 0x38e190d5, 0x38e1b35a, 0x38e1f019, 0x38e1f499, 0x38e2045a,
+    0x38e21899, 0x38e21d19, 0x38e21e99, 0x38e22a9a, 0x38e22c1a, 0x38e22c9a, 0x38e2309a, 0x38e2311a,
+    0x38e26f95, 0x38e27015, 0x38e2c091, 0x38e2c111, 0x38e2f2c9, 0x38e30b95, 0x38e31015, 0x38e31195,
+    0x38e31d96, 0x38e31f16, 0x38e31f96, 0x38e32396, 0x38e32416, 0x38e33411, 0x38e33891, 0x38e36e92,
+    0x38e37012, 0x38e37092, 0x38e37492, 0x38e37512, 0x38e3c855, 0x38e46485, 0x38e46869, 0x38e469d5,
+    0x38e47a4a, 0x38e48dd5, 0x38e48e49, 0x38e48f69, 0x38e4a2ca, 0x38e4c9c5, 0x38e4cda9, 0x38e4cfa9,
+    0x38e4f629, 0x38e4f79d, 0x38e4f81d, 0x38e509a9, 0x38e50a29, 0x38e50b9d, 0x38e51405, 0x38e517d1,
+    0x38e51955, 0x38e529c9, 0x38e53d55, 0x38e53dc9, 0x38e53ec5, 0x38e55249, 0x38e56b1d, 0x38e571a9,
+    0x38e57945, 0x38e57d1d, 0x38e57f29, 0x38e5a59d, 0x38e5a71d, 0x38e5a79d, 0x38e5ac1d, 0x38e5b91e,
+    0x38e5b99e, 0x38e5bb1e, 0x38e5bf9e, 0x38e5d4d1, 0x38e5d655, 0x38e5fa55, 0x38e63a19, 0x38e63c29,
+    0x38e66299, 0x38e66419, 0x38e66499, 0x38e67619, 0x38e67699, 0x38e67819, 0x38e688ca, 0x38e6afc5,
+    0x38e6b3a9, 0x38e6b515, 0x38e6b595, 0x38e6ee0a, 0x38e70611, 0x38e7168a, 0x38e72a09, 0x38e7386d,
+    0x38e7512d, 0x38e75595, 0x38e75715, 0x38e75795, 0x38e75f6d, 0x38e7632d, 0x38e7652d, 0x38e76995,
+    0x38e779ad, 0x38e7900a, 0x38e79306, 0x38e79dad, 0x38e7b42d, 0x38e7b5ad, 0x38e7c62d, 0x38e7d9ad,
+    0x38e7da2d, 0x38e7e2a9, 0x38e84419, 0x38e87e99, 0x38e88019, 0x38e88099, 0x38e88519, 0x38e8929a,
+    0x38e8941a, 0x38e8989a, 0x38e8c395, 0x38e8c415, 0x38e8fc8a, 0x38e8ff86, 0x38e97315, 0x38e97395,
+    0x38e97815, 0x38ea1749, 0x38ea18c5, 0x38ea2e95, 0x38ea4215, 0x38ea6cd9, 0x38ea9311, 0x38eb0ed1,
+    0x38eb5e75, 0x38eb71fa, 0x38eb8611, 0x38ebd7dd, 0x38ebeb5d, 0x38ec13dd, 0x38ec3e91, 0x38ec7b51,
+    0x38eca3d9, 0x38eccc59, 0x38eceeed, 0x38ed15ed, 0x38ed542d, 0x38ed5a21, 0x38ed6e51, 0x38ed7cb6,
+    0x38ed8136, 0x38ed902d, 0x38ed90b6, 0x38ed9536, 0x38edbf55, 0x38edd155, 0x38ede7d1, 0x38edfc21,
+    0x38ee09ad, 0x38ee0e21, 0x38ee1029, 0x38ee2251, 0x38ee3736, 0x38ee5f11, 0x38eeb0d9, 0x38eec459,
+    0x38eeecd9, 0x38ef10d1, 0x38ef1151, 0x38ef2445, 0x38ef2a7a, 0x38ef3dfa, 0x38ef4cc5, 0x38ef62a1,
+    0x38ef68a1, 0x38ef74a9, 0x38ef7621, 0x38ef76a9, 0x38ef7aa9, 0x38ef7ca9, 0x38ef8efa, 0x38ef9d36,
+    0x38ef9ea1, 0x38ef9f36, 0x38efb136, 0x38efdfd5, 0x38f00851, 0x38f01ca1, 0x38f02c29, 0x38f07ec5,
+    0x38f08291, 0x38f08411, 0x38f09489, 0x38f09785, 0x38f0a809, 0x38f0a889, 0x38f0ab85, 0x38f0c0d1,
+    0x38f0e7d9, 0x38f0e959, 0x38f0e9ea, 0x38f0f909, 0x38f10c85, 0x38f11075, 0x38f111d9, 0x38f123d9,
+    0x38f12475, 0x38f125d9, 0x38f19f9d, 0x38f1c6b6, 0x38f1dab6, 0x38f1ec09, 0x38f1fed5, 0x38f1ff85,
+    0x38f20355, 0x38f204d5, 0x38f216d5, 0x38f21755, 0x38f218d5, 0x38f2419d, 0x38f24f1d, 0x38f2539d,
+    0x38f267d1, 0x38f279c9, 0x38f3062d, 0x38f30a99, 0x38f30c19, 0x38f30ca9, 0x38f3422d, 0x38f34699,
+    0x38f37fad, 0x38f3ff29, 0x38f47729, 0x38f48b36, 0x38f49b2e, 0x38f49fb5, 0x38f4a129, 0x38f4b329,
+    0x38f4b3b5, 0x38f4b529, 0x38f4c509, 0x38f4d7d5, 0x38f4dc55, 0x38f4ddd5, 0x38f4efd5, 0x38f4f055,
+    0x38f4f1d5, 0x38f51a99, 0x38f52819, 0x38f52c99, 0x38f540d1, 0x38f552c9, 0x38f57549, 0x38f58e15,
+    0x38f5a015, 0x38f5a195, 0x38f5a215, 0x38f5b691, 0x38f5bc91, 0x38f5e3ba, 0x38f5e529, 0x38f5f136,
+    0x38f5f291, 0x38f5f336, 0x38f607b5, 0x38f60c35, 0x38f60da9, 0x38f61fba, 0x38f62035, 0x38f621a9,
+    0x38f633d1, 0x38f645c9, 0x38f67091, 0x38f68129, 0x38f685a9, 0x38f68729, 0x38f69929, 0x38f699aa,
+    0x38f69b2a, 0x38f6c1a9, 0x38f6ea11, 0x38f6fc09, 0x38f6fc89, 0x38f6ff85, 0x38f73bda, 0x38f73d59,
+    0x38f73dea, 0x38f74f59, 0x38f777d9, 0x38f77875, 0x38f779d9, 0x38f807a9, 0x38f84229, 0x38f86ad5,
+    0x38f86b55, 0x38f86ce9, 0x38f8a3aa, 0x38f8bba9, 0x38f918ed, 0x38f92355, 0x38f92ded, 0x38f93555,
+    0x38f9416d, 0x38f96019, 0x38f96c2d, 0x38f96dad, 0x38f97219, 0x38f972a9, 0x38f97429, 0x38f994b6,
+    0x38f9962d, 0x38f9a82d, 0x38f9a8b6, 0x38f9aa2d, 0x38f9baed, 0x38f9e1ed, 0x38f9e5ad, 0x38f9e72d,
+    0x38f9e7ad, 0x38fa0211, 0x38fa202d, 0x38fa232d, 0x38fa293a, 0x38fa2aa9, 0x38fa36b6, 0x38fa382d,
+    0x38fa48b6, 0x38fa4bad, 0x38fa5329, 0x38fa5c2d, 0x38fa5cb6, 0x38fa653a, 0x38fa7951, 0x38fac22d,
+    0x38facb29, 0x38facca9, 0x38fadea9, 0x38fb0729, 0x38fb07b5, 0x38fb0929, 0x38fb14ae, 0x38fb1b29,
+    0x38fb43d5, 0x38fb4455, 0x38fb45d5, 0x38fb5155, 0x38fbf615, 0x38fc06fa, 0x38fc2e89, 0x38fc3185,
+    0x38fc37ba, 0x38fc3929, 0x38fc46a9, 0x38fc4b3a, 0x38fc73ba, 0x38fc7435, 0x38fc75a9, 0x38fc813a,
+    0x38fced29, 0x38fcedaa, 0x38fcef2a, 0x38fcfaa9, 0x3903e3d9, 0x3903e555, 0x3903e5d5, 0x390436d1,
+    0x3905151d, 0x3905159d, 0x3905235d, 0x390527d1, 0x3905889d, 0x39058d1d, 0x3905b11d, 0x3905b59d,
+    0x3905b71d, 0x3905c49e, 0x3905c51e, 0x3905c91e, 0x3905c99e, 0x39068019, 0x39068199, 0x39068219,
+    0x39077315, 0x39077495, 0x39077515, 0x3907c411, 0x3907c591, 0x3907c611, 0x3907fc59, 0x390800d9,
+    0x39080255, 0x39086199, 0x39086619, 0x39088a19, 0x39088e99, 0x39089019, 0x39089c1a, 0x39089d9a,
+    0x39089e1a, 0x3908a21a, 0x3908a29a, 0x3908b4ca, 0x3908b7c6, 0x3908e115, 0x3908e195, 0x39093211,
+    0x39093291, 0x39096449, 0x39096745, 0x39097d15, 0x39098195, 0x39098315, 0x39098f16, 0x39099096,
+    0x39099116, 0x39099516, 0x39099596, 0x3909a591, 0x3909aa11, 0x3909e012, 0x3909e192, 0x3909e212,
+    0x3909e612, 0x3909e692, 0x390a39d5, 0x390b691d, 0x390b699d, 0x390b7d1d, 0x390bdc9d, 0x390c189d,
+    0x390c191d, 0x390c1d9d, 0x390c311e, 0x390c41ed, 0x390c4659, 0x390c47d1, 0x390c68ed, 0x390ca72d,
+    0x390cab99, 0x390cad25, 0x390ccfad, 0x390cd419, 0x390cd599, 0x390cd619, 0x390ce32d, 0x390ce3ad,
+    0x390ce799, 0x390ce819, 0x390ce999, 0x390d2695, 0x390d2715, 0x390dc715, 0x390dc895, 0x390dc915,
+    0x390dd4ad, 0x390def91, 0x390e018a, 0x390e0486, 0x390e25ad, 0x390eb599, 0x390ef199, 0x390ef219,
+    0x390ef699, 0x390f059a, 0x390f0a1a, 0x390f3515, 0x390f3595, 0x390f6e0a, 0x390f7106, 0x390fe495,
+    0x390fe515, 0x390fe995, 0x3910b459, 0x3910b5d5, 0x3910b655, 0x391106d1, 0x39110751, 0x3911e59d,
+    0x3911e61d, 0x3912591d, 0x39125d9d, 0x3912819d, 0x3912861d, 0x3912879d, 0x3912951e, 0x3912959e,
+    0x3912999e, 0x39129a1e, 0x39135099, 0x39135219, 0x39135299, 0x39144395, 0x39144515, 0x39144595,
+    0x39153219, 0x39153699, 0x39156e1a, 0x39156e9a, 0x3915729a, 0x3915731a, 0x391797ad, 0x3917982d,
+    0x3918892d, 0x391b256d, 0x391b26ed, 0x391b276d, 0x391bb4ad, 0x391c936d, 0x391c93ed, 0x391ca1ad,
+    0x391ca62d, 0x391d06ed, 0x391d0b6d, 0x391d2f6d, 0x391d33ed, 0x391d356d, 0x391dec19, 0x391e104a,
+    0x391e3745, 0x391e3b39, 0x391e3c95, 0x391e3d15, 0x391e758a, 0x391e8d91, 0x391e9e0a, 0x391eb189,
+    0x391eb209, 0x391ebfc9, 0x391ed895, 0x391ee6c5, 0x391eea95, 0x391eec15, 0x391eec95, 0x391f0111,
+    0x391f2509, 0x391f3d11, 0x391f4d89, 0x391f611e, 0x391f619e, 0x391fa799, 0x391fa915, 0x391fa995,
+    0x391ffa11, 0x39201e09, 0x39205b8a, 0x39205e86, 0x3920d8ed, 0x3920d96d, 0x3920e72d, 0x3920eb91,
+    0x39210b2d, 0x39210e2d, 0x39214c6d, 0x392150ed, 0x392174ed, 0x3921796d, 0x39217aed, 0x39217b6d,
+    0x392186ed, 0x3921886d, 0x392188ed, 0x39218ced, 0x39218d6d, 0x39218eed, 0x3922e76d, 0x3922e7ed,
+    0x3922fb6d, 0x39235aed, 0x39235f6d, 0x39236ced, 0x3923956d, 0x392396ed, 0x3923976d, 0x39239b6d,
+    0x39239bed, 0x392402d1, 0x3924e19d, 0x392508b6, 0x39251cb6, 0x3925839d, 0x3925911d, 0x3925959d,
+    0x39264e19, 0x3926c1ad, 0x3927cd36, 0x39285c99, 0x39286a19, 0x39286e99, 0x3928d015, 0x3928e395,
+    0x3928e415, 0x3928f891, 0x3928fe91, 0x39293491, 0x39293536, 0x3929b291, 0x392a9399, 0x392c73ad,
+    0x392da376, 0x392da7f6, 0x392da96d, 0x392da9f6, 0x392db7ad, 0x392e1ced, 0x392e216d, 0x392e22ed,
+    0x392e4576, 0x392e49f6, 0x392e4b6d, 0x392e58ed, 0x392e5976, 0x392e5d6d, 0x392e5df6, 0x392e5f6d,
+    0x392eb091, 0x392eebb6, 0x392f2411, 0x392f896d, 0x392f8f6d, 0x392fb1f6, 0x392fb676, 0x392fb7ed,
+    0x392fc3f6, 0x392fc56d, 0x392fc5f6, 0x392fca76, 0x392fcbed, 0x39302b6d, 0x39302fed, 0x3930316d,
+    0x39303d6d, 0x39303eed, 0x3930436d, 0x393065f6, 0x3930676d, 0x39306bed, 0x3932909d, 0x3932f611,
+    0x393369ad, 0x393390ad, 0x3933ceed, 0x3933d4ed, 0x3933f776, 0x3933fbf6, 0x3933fd6d, 0x3933fdf6,
+    0x39340aed, 0x39340b76, 0x39340ff6, 0x3934116d, 0x393444ad, 0x393470ed, 0x3934756d, 0x393476ed,
+    0x393482ed, 0x3934846d, 0x393488ed, 0x3934ab76, 0x3934aced, 0x3934ad76, 0x3934b16d, 0x3934b1f6,
+    0x3934b36d, 0x3934beed, 0x3934bf76, 0x3934c0ed, 0x3934c56d, 0x3935dd6d, 0x3935e36d, 0x3935f0ed,
+    0x3936196d, 0x393619f6, 0x39361e76, 0x39361fed, 0x39362d6d, 0x39365c96, 0x3936916d, 0x393692ed,
+    0x3936976d, 0x3936cf6d, 0x393d6111, 0x393d61c5, 0x393d6591, 0x393d6711, 0x393d7789, 0x393d7a85,
+    0x393d8b09, 0x393d8b89, 0x393d8e85, 0x393da451, 0x393dcad9, 0x393dcc76, 0x393dccd9, 0x393ddc09,
+    0x393deed9, 0x393def85, 0x393df359, 0x393df4d9, 0x393e06d9, 0x393e0759, 0x393e08d9, 0x393e1bd1,
+    0x393e811d, 0x393e831d, 0x393ebd1d, 0x393ecf09, 0x393ee1f9, 0x393ee285, 0x393ee655, 0x393ee7f9,
+    0x393ef9d5, 0x393efa55, 0x393efbf9, 0x393f32ba, 0x393f371d, 0x393f4ad1, 0x393f5aba, 0x393f5cc9,
+    0x393fef99, 0x39406715, 0x3940b811, 0x3940e225, 0x3941333a, 0x394133ba, 0x39415a25, 0x39417e2e,
+    0x394182a5, 0x39418439, 0x39419625, 0x394196a5, 0x39419839, 0x3941a809, 0x3941bad5, 0x3941bf55,
+    0x3941c0d5, 0x3941d2d5, 0x3941d355, 0x3941d4d5, 0x3941e551, 0x39420b99, 0x39421019, 0x394223d1,
+    0x394235c9, 0x39427595, 0x39428915, 0x39428995, 0x39429e11, 0x3942a011, 0x3942c409, 0x3942c6a5,
+    0x3942c8a5, 0x3942da11, 0x3942da91, 0x3942eaa6, 0x3942ef25, 0x3942f0a5, 0x394302a5, 0x39430325,
+    0x394304a5, 0x394316d1, 0x394328c9, 0x39434f3a, 0x39434fba, 0x39435411, 0x39436439, 0x394368a5,
+    0x39436a39, 0x39437c36, 0x39437ca5, 0x39437e39, 0x39439ea5, 0x3943a039, 0x3943a4a5, 0x3943cd11,
+    0x3943df09, 0x3943df89, 0x3943e285, 0x394405d1, 0x39441ed9, 0x39442076, 0x394420d9, 0x39443276,
+    0x39445ad9, 0x39445b65, 0x39445cd9, 0x3944a5e6, 0x3944d71d, 0x3944e4a5, 0x3944eaa5, 0x39451de6,
+    0x39454dd5, 0x39454e55, 0x39454ff9, 0x39455b55, 0x3945989d, 0x39459a3a, 0x39459ea5, 0x394604d5,
+    0x39460655, 0x39461855, 0x39464399, 0x3946512d, 0x39465599, 0x39465719, 0x39466951, 0x3946a856,
+    0x3946bb15, 0x3946ce95, 0x3946e391, 0x39470989, 0x39470a85, 0x39470c25, 0x39470db6, 0x394734a5,
+    0x39473625, 0x39474825, 0x39475c51, 0x3947ae25, 0x3947afb9, 0x3947c1b6, 0x3947ea25, 0x3947eaa5,
+    0x3947ec39, 0x3947f7ae, 0x394826d5, 0x39482755, 0x394828d5, 0x39483476, 0x39486419, 0x39487199,
+    0x39487319, 0x394877a5, 0x3948c8d1, 0x3948e9e6, 0x39491809, 0x39491aa5, 0x39491ca5, 0x394929a6,
+    0x39492e36, 0x394956a5, 0x39495725, 0x394958a5, 0x39496426, 0x3949d036, 0x3949d0a5, 0x3949d239,
+    0x3949ddb6, 0x394a0625, 0x39510599, 0x395129c9, 0x39513d49, 0x39517d15, 0x3951f81d, 0x39529439,
+    0x3952989d, 0x3952ac1d, 0x3954196d, 0x39541aed, 0x39541b6d, 0x3954293a, 0x39548e7a, 0x395492ed,
+    0x395494fa, 0x3954b6fa, 0x3954bb6d, 0x3954bcfa, 0x3954ca7a, 0x3954cafa, 0x3954cc89, 0x3954ceed,
+    0x3954cf6d, 0x3954d0fa, 0x39552291, 0x39554689, 0x39556d1a, 0x39557199, 0x39558519, 0x39559a11,
+    0x3955ff6d, 0x3956016d, 0x395627ed, 0x39563909, 0x39563b6d, 0x39563bed, 0x39563d6d, 0x39569cfa,
+    0x3956a16d, 0x3956aeed, 0x3956b0fa, 0x3956b56d, 0x3956d76d, 0x3956d8fa, 0x39575999, 0x39579149,
+    0x3957d115, 0x3957e495, 0x3957f991, 0x39582085, 0x3959001d, 0x3959009d, 0x39590d9d, 0x39598c09,
+    0x3959df91, 0x395a0685, 0x395a44ed, 0x395a46ed, 0x395a6d6d, 0x395a6eed, 0x395a6f6d, 0x395a80ed,
+    0x395a816d, 0x395a82ed, 0x395abdb6, 0x395ae27a, 0x395ae6ed, 0x395ae8fa, 0x395af46d, 0x395af67a,
+    0x395afaed, 0x395afc7a, 0x395b1ced, 0x395b1e7a, 0x395b1efa, 0x395b22ed, 0x395b236d, 0x395b24fa,
+    0x395b306d, 0x395b30ed, 0x395b327a, 0x395b36ed, 0x395b9a89, 0x395bd919, 0x395bd999, 0x395be69a,
+    0x395c536d, 0x395c556d, 0x395c676d, 0x395c8fed, 0x395c916d, 0x395ca36d, 0x395d02ed, 0x395d04fa,
+    0x395d096d, 0x395d16ed, 0x395d187a, 0x395d40fa, 0x395d6e11, 0x395dbfd9, 0x395dd359, 0x395dfbd9,
+    0x395eeed5, 0x395fa5d5, 0x395fb955, 0x3960aea1, 0x3960d5b5, 0x3960d721, 0x3960e921, 0x396162a1,
+    0x39618b21, 0x39619f21, 0x3962cf21, 0x3963d409, 0x3963e785, 0x3963eb55, 0x3963ecd5, 0x3963fed5,
+    0x3963ff55, 0x396400d5, 0x39644fd1, 0x396461c9, 0x3964f29d, 0x3964f41d, 0x3964f49d, 0x39651b35,
+    0x39651c9d, 0x39652e9d, 0x39652f35, 0x3965309d, 0x396542d1, 0x396554c9, 0x39659039, 0x3965949d,
+    0x39659639, 0x3965a81d, 0x3965a89d, 0x3965aa39, 0x3965d09d, 0x396710ed, 0x3967156d, 0x396716ed,
+    0x3967176d, 0x39673f6d, 0x39674ced, 0x3967516d, 0x3967b2fa, 0x3967b76d, 0x3967b8fa, 0x3967c4ed,
+    0x3967c67a, 0x3967caed, 0x3967cb6d, 0x3967ccfa, 0x3967f36d, 0x39681bd1, 0x39682dc9, 0x39686919,
+    0x39686d99, 0x39686f19, 0x39688119, 0x39688199, 0x39688319, 0x3968a3b5, 0x3968a519, 0x3968a999,
+    0x39691f6d, 0x396923ed, 0x3969256d, 0x3969316d, 0x396932ed, 0x3969336d, 0x3969376d, 0x396937ed,
+    0x3969396d, 0x396959f6, 0x39695b6d, 0x39696df6, 0x39699c95, 0x3969d4fa, 0x3969e8fa, 0x396a52ed,
+    0x396a536d, 0x396a54ed, 0x396b469e, 0x396b481e, 0x396b489e, 0x396b5a2d, 0x396b82ad, 0x396b84ad,
+    0x396bfc2d, 0x396bfcad, 0x396c616d, 0x396cb31a, 0x396cb49a, 0x396cbe2e, 0x396cc6ad, 0x396ce62e,
+    0x396cef2d, 0x396cfcae, 0x396d2e16, 0x396d402d, 0x396d5692, 0x396d76ee, 0x396d786e, 0x396d78ee,
+    0x396d7cee, 0x396d7d6e, 0x396d7eee, 0x396d912d, 0x396da0ee, 0x396db2ee, 0x396db4ee, 0x396db96e,
+    0x396de22d, 0x396df62d, 0x396e0aad, 0x396e18ee, 0x396e1a6e, 0x396e1aee, 0x396e2cee, 0x396e2e6e,
+    0x396e32ee, 0x396e472d, 0x396ed52d, 0x396ed5ad, 0x396ed72d, 0x396ee2ad, 0x396f0b2d, 0x396f4ead,
+    0x396f5c2d, 0x396f772d, 0x396f856e, 0x396f86ee, 0x396f876e, 0x396f996e, 0x396f9aee, 0x396f9f6e,
+    0x39773855, 0x397739d5, 0x39773a55, 0x397772ca, 0x39778709, 0x39778a05, 0x39778b51, 0x3977ad5e,
+    0x3977af49, 0x3977b1d9, 0x3977b245, 0x3977b359, 0x3977b3d9, 0x39786825, 0x3978699d, 0x39786a1d,
+    0x3978a05e, 0x3978a4d5, 0x3978a655, 0x3978a6ea, 0x3978dd1d, 0x3978e19d, 0x3978f15e, 0x3978f5d1,
+    0x3979059d, 0x39790a1d, 0x39790ac5, 0x39790b9d, 0x3979191e, 0x3979199e, 0x39791d9e, 0x39791e1e,
+    0x39791f9e, 0x3979d499, 0x3979d619, 0x3979d699, 0x397ac795, 0x397ac915, 0x397ac995, 0x397b4125,
+    0x397b42a5, 0x397b4325, 0x397bb619, 0x397bba99, 0x397bf09a, 0x397bf21a, 0x397bf29a, 0x397bf69a,
+    0x397bf71a, 0x397bf89a, 0x397ca926, 0x397cadaa, 0x397caf25, 0x397cafa5, 0x397d6f1d, 0x397d7811,
+    0x397d7991, 0x397d7a11, 0x397d8a09, 0x397d8c55, 0x397d8dd5, 0x397d8e55, 0x397d961d, 0x397d9bdd,
+    0x397d9fd5, 0x397da055, 0x397da1d5, 0x397db4d1, 0x397db665, 0x397dc6ca, 0x397dd45d, 0x397deadd,
+    0x397dec5d, 0x397df005, 0x397dfcdd, 0x397e05d9, 0x397e0759, 0x397e07d9, 0x397e105d, 0x397e10dd,
+    0x397e1959, 0x397e2e69, 0x397e2fd1, 0x397e404a, 0x397e5569, 0x397e68ca, 0x397e93a9, 0x397e9525,
+    0x397e95a9, 0x397ebc25, 0x397ebd9d, 0x397ebe1d, 0x397ecfa9, 0x397ed025, 0x397ed19d, 0x397ee305,
+    0x397ef8d5, 0x397efa55, 0x397efad5, 0x397f04dd, 0x397f0c55, 0x397f311d, 0x397f359d, 0x397f3725,
+    0x397f37a9, 0x397f431d, 0x397f4925, 0x397f49a9, 0x397f5d51, 0x397f6b9d, 0x397f6d1d, 0x397f6d9d,
+    0x397f721d, 0x397f72c5, 0x397f7f1e, 0x397f7f9e, 0x397f811e, 0x397f859e, 0x397f9889, 0x397f9ad1,
+    0x397f9b85, 0x397f9c51, 0x397facca, 0x397fc355, 0x397fc4d5, 0x397fc555, 0x397fd54a, 0x39800019,
+    0x398001a5, 0x39800229, 0x39801451, 0x398015d1, 0x39801651, 0x39802649, 0x39802899, 0x39802a19,
+    0x39802a99, 0x39803c19, 0x39803c99, 0x39803e19, 0x39804eca, 0x398079a9, 0x39807b15, 0x39807b95,
+    0x3980b40a, 0x3980dc8a, 0x3980f33a, 0x3980f4a5, 0x3980f525, 0x39810751, 0x398108d1, 0x39810951,
+    0x39811949, 0x39811d15, 0x39811d95, 0x39813115, 0x3981560a, 0x39815906, 0x39816ca5, 0x39816e36,
+    0x39816eaa, 0x39817f45, 0x39819525, 0x398196a5, 0x39819725, 0x3981a8a5, 0x3981b6d5, 0x3981bc05,
+    0x3981c8c9, 0x3981d1d5, 0x3981d355, 0x3981d3d5, 0x3981dc55, 0x3981ddd9, 0x3981df5a, 0x3981e555,
+    0x3981f149, 0x39820a19, 0x39820e99, 0x39821025, 0x39821845, 0x39821c19, 0x39821e29, 0x39823051,
+    0x398231d1, 0x39823651, 0x39824499, 0x39824619, 0x39824699, 0x39824b19, 0x3982575a, 0x3982581a,
+    0x3982589a, 0x39825a1a, 0x39825e9a, 0x39826ae5, 0x39826f66, 0x398273fa, 0x39827551, 0x398283a5,
+    0x39828995, 0x39828a15, 0x398291e5, 0x398297a5, 0x39829d95, 0x3982ac25, 0x3982c28a, 0x3982c586,
+    0x3982d025, 0x3982dab6, 0x3982e6a5, 0x3982e825, 0x3982f8a5, 0x398301ba, 0x39830325, 0x398303a5,
+    0x39830c25, 0x39830ca5, 0x39830f26, 0x398310a6, 0x3983153a, 0x39832351, 0x398324d1, 0x39832951,
+    0x39833915, 0x39833995, 0x39833e15, 0x39834a55, 0x39834b16, 0x39834d16, 0x39835196, 0x39837209,
+    0x39837b25, 0x39837cb6, 0x39837d2a, 0x39838705, 0x398388a5, 0x39838a36, 0x39838eb6, 0x3983b125,
+    0x3983b2a5, 0x3983b725, 0x3983b925, 0x398aeaa9, 0x398aeb6a, 0x398aec29, 0x398aeca9, 0x398bdda9,
+    0x398c529e, 0x398e79e9, 0x398e7b69, 0x398e7be9, 0x398f0929, 0x398f2b9a, 0x398fe42a, 0x398fe72a,
+    0x398fe7e9, 0x398fe869, 0x398ff629, 0x398ffaa9, 0x398ffc29, 0x39901eaa, 0x39905b69, 0x39905fe9,
+    0x39906faa, 0x399083e9, 0x39908869, 0x399089e9, 0x3990b0d1, 0x3990b255, 0x3990d655, 0x39911619,
+    0x39911829, 0x39913e99, 0x39914019, 0x39914099, 0x39915219, 0x39915299, 0x39915419, 0x399164ca,
+    0x39918bc5, 0x39918fa9, 0x39919115, 0x39919195, 0x3991ca0a, 0x3991e211, 0x39920609, 0x3992145d,
+    0x39922d1d, 0x39923b5d, 0x39923f1d, 0x3992409d, 0x3992411d, 0x3992559d, 0x3992799d, 0x3992901d,
+    0x3992919d, 0x3992a21d, 0x3992b59e, 0x3992b61e, 0x3992fc15, 0x3992fd95, 0x3992fe15, 0x3993368a,
+    0x39934e91, 0x39937289, 0x3993b00a, 0x39942be9, 0x39942d69, 0x39942de9, 0x39946895, 0x3994a569,
+    0x3994a769, 0x3994cde9, 0x3994cf69, 0x3994cfe9, 0x3994e085, 0x3994e169, 0x3994e1e9, 0x3994e369,
+    0x3994ed59, 0x39950619, 0x39950a95, 0x39950c15, 0x39950c95, 0x39951459, 0x39951a19, 0x39951e95,
+    0x39952e99, 0x39955299, 0x39956919, 0x39956a99, 0x39957b19, 0x39958e9a, 0x39958f1a, 0x399611e9,
+    0x399613e9, 0x39963a69, 0x39963be9, 0x39963c69, 0x39964de9, 0x39964e69, 0x39964fe9, 0x39965c11,
+    0x39966e09, 0x39968196, 0x39968316, 0x39969689, 0x3996af69, 0x3996b3e9, 0x3996b5e9, 0x3996bd85,
+    0x3996c169, 0x3996c2f5, 0x3996c369, 0x3996c7e9, 0x3996e9e9, 0x3996eb69, 0x3996ebe9, 0x3996efe9,
+    0x3996f069, 0x399d7f09, 0x399d8205, 0x399da55e, 0x399da9d5, 0x399dab55, 0x399dabd5, 0x399de21d,
+    0x399de699, 0x399de819, 0x399de8a9, 0x399df65e, 0x399dfaf5, 0x399dfc51, 0x399dfcd2, 0x399e1e1d,
+    0x399e1eb6, 0x399e2299, 0x399e23c5, 0x399e5b9d, 0x399e6015, 0x399ed9b5, 0x399edb1d, 0x399edbb5,
+    0x399ee95e, 0x399eedd1, 0x399eef51, 0x399eefd2, 0x399f02c5, 0x399f16c5, 0x399f531d, 0x399f549d,
+    0x399f552a, 0x399f771e, 0x399f7bb5, 0x399f7d1d, 0x399f911d, 0x39a0fc76, 0x39a0fde9, 0x39a0fe76,
+    0x39a10e49, 0x39a13915, 0x39a13b15, 0x39a175e9, 0x39a17769, 0x39a177e9, 0x39a18a35, 0x39a18b91,
+    0x39a18c12, 0x39a19e76, 0x39a19fe9, 0x39a1b1e9, 0x39a1b276, 0x39a1b305, 0x39a1b3e9, 0x39a1c251,
+    0x39a1c6d1, 0x39a1c851, 0x39a1c8d2, 0x39a20511, 0x39a22c19, 0x39a22d99, 0x39a22e2a, 0x39a23a45,
+    0x39a25035, 0x39a254b5, 0x39a25619, 0x39a26399, 0x39a26a19, 0x39a27891, 0x39a27d15, 0x39a29f85,
+    0x39a2dde9, 0x39a2e269, 0x39a2e3e9, 0x39a2e469, 0x39a2f6b5, 0x39a2f811, 0x39a30676, 0x39a30af6,
+    0x39a30c69, 0x39a31876, 0x39a31905, 0x39a319e9, 0x39a31a76, 0x39a31e69, 0x39a31ef6, 0x39a31f85,
+    0x39a32069, 0x39a32d45, 0x39a34315, 0x39a34795, 0x39a34915, 0x39a35695, 0x39a35d15, 0x39a36b91,
+    0x39a37011, 0x39a37191, 0x39a37fe9, 0x39a38469, 0x39a385e9, 0x39a391e9, 0x39a39285, 0x39a39369,
+    0x39a393e9, 0x39a397e9, 0x39a39869, 0x39a3992a, 0x39a399e9, 0x39a3a791, 0x39a3ba76, 0x39a3bb05,
+    0x39a3bbe9, 0x39a3c069, 0x39a3e805, 0x39a3fdd5, 0x39a3ff55, 0x39a3ffd5, 0x39a409dd, 0x39a41155,
+    0x39a43a99, 0x39a43c19, 0x39a43ca9, 0x39a4481d, 0x39a4499d, 0x39a44e19, 0x39a44ea9, 0x39a45029,
+    0x39a46251, 0x39a470b6, 0x39a4721d, 0x39a47699, 0x39a477c5, 0x39a4841d, 0x39a484b6, 0x39a4861d,
+    0x39a496dd, 0x39a4bddd, 0x39a4c31d, 0x39a4c39d, 0x39a4de11, 0x39a4fc1d, 0x39a4ff1d, 0x39a512b6,
+    0x39a5141d, 0x39a524b6, 0x39a5279d, 0x39a52db5, 0x39a52f1d, 0x39a52fb5, 0x39a5381d, 0x39a538b6,
+    0x39a5413a, 0x39a55551, 0x39a56ac5, 0x39a59e1d, 0x39a5a71d, 0x39a5a89d, 0x39a5a92a, 0x39a5ba9d,
+    0x39a5e31d, 0x39a5e51d, 0x39a60c51, 0x39a60dd1, 0x39a60e51, 0x39a61e49, 0x39a62095, 0x39a64911,
+    0x39a64a91, 0x39a65b0a, 0x39a67199, 0x39a67319, 0x39a673aa, 0x39a68445, 0x39a69a35, 0x39a69b99,
+    0x39a69c35, 0x39a6ad99, 0x39a6c295, 0x39a6d48a, 0x39a6e809, 0x39a6e9a9, 0x39a6eb3a, 0x39a6ec95,
+    0x39a6ed15, 0x39a6fd0a, 0x39a72405, 0x39a727e9, 0x39a72969, 0x39a729e9, 0x39a73d91, 0x39a75076,
+    0x39a751e9, 0x39a75276, 0x39a7633a, 0x39a763e9, 0x39a76476, 0x39a765e9, 0x39a77745, 0x39a78d15,
+    0x39a78e95, 0x39a78f15, 0x39a7a095, 0x39a7a115, 0x39a7a295, 0x39a7b591, 0x39a7b711, 0x39a7b7aa,
+    0x39a7c9e9, 0x39a7cb69, 0x39a7cbe9, 0x39a7dd69, 0x39a7dde9, 0x39a7df69, 0x39a7f191, 0x39a7f235,
+    0x39a7f391, 0x39a80505, 0x39a805e9, 0x39a80676, 0x39a807e9, 0x39a81905, 0x39a819e9, 0x39a82851,
+    0x39a829d1, 0x39a82e51, 0x39a84f45, 0x39a85015, 0x39a88019, 0x39a88199, 0x39a8822a, 0x39a88b29,
+    0x39a88c05, 0x39a89399, 0x39a8b635, 0x39a8b799, 0x39a8bc19, 0x39a8be19, 0x39a8c999, 0x39a8de95,
+    0x39a8f089, 0x39a8fb15, 0x39a90409, 0x39a905a9, 0x39a9073a, 0x39a90895, 0x39a90d3a, 0x39a91909,
+    0x39a91d91, 0x39a92391, 0x39a931e9, 0x39a93669, 0x39a937e9, 0x39a93869, 0x39a94005, 0x39a943e9,
+    0x39a94569, 0x39a945e9, 0x39a949e9, 0x39a94be9, 0x39a95991, 0x39a95e3a, 0x39a96c76, 0x39a96de9,
+    0x39a96e76, 0x39a97269, 0x39a972f6, 0x39a97469, 0x39a97f3a, 0x39a97fe9, 0x39a98076, 0x39a981e9,
+    0x39a98669, 0x39a9a915, 0x39a9aa95, 0x39a9af15, 0x39a9b115, 0x39a9bc95, 0x39a9c315, 0x39a9d191,
+    0x39a9d311, 0x39a9d791, 0x39a9e5e9, 0x39a9e769, 0x39a9e7e9, 0x39a9ebe9, 0x39a9ec69, 0x39a9f885,
+    0x39a9f9e9, 0x39a9fb69, 0x39a9ffe9, 0x39aa1411, 0x39aa23e9, 0x39b71ddd, 0x39b72259, 0x39b723d1,
+    0x39b744dd, 0x39b7831d, 0x39b78799, 0x39b78925, 0x39b7ab9d, 0x39b7b019, 0x39b7b199, 0x39b7b219,
+    0x39b7bf1d, 0x39b7bf9d, 0x39b7c399, 0x39b7c419, 0x39b7c599, 0x39b80295, 0x39b80315, 0x39b890d6,
+    0x39b8a315, 0x39b8b09d, 0x39b8cb91, 0x39b9019d, 0x39b96d99, 0x39b96f15, 0x39b96f95, 0x39b9a80a,
+    0x39ba2486, 0x39ba9ee5, 0x39ba9f65, 0x39bab191, 0x39bb16e5, 0x39bb1865, 0x39bb3f65, 0x39bb40e5,
+    0x39bb4165, 0x39bb52e5, 0x39bb5365, 0x39bb54e5, 0x39bb5ec9, 0x39bb69d6, 0x39bb7795, 0x39bb7d95,
+    0x39bb85c9, 0x39bb8b15, 0x39bb8b95, 0x39bba011, 0x39bbc409, 0x39bbc705, 0x39bbda99, 0x39bbdc11,
+    0x39bbec89, 0x39bc001a, 0x39bc009a, 0x39bc19a5, 0x39bc40a5, 0x39bc7ee5, 0x39bc84e5, 0x39bca765,
+    0x39bcad65, 0x39bcade5, 0x39bcbae5, 0x39bcbb65, 0x39bcc165, 0x39bcf496, 0x39bd20e5, 0x39bd2565,
+    0x39bd26e5, 0x39bd32e5, 0x39bd3465, 0x39bd38e5, 0x39bd5b65, 0x39bd5ce5, 0x39bd5d65, 0x39bd6165,
+    0x39bd61e5, 0x39ca8399, 0x39ca8515, 0x39ca8595, 0x39cabe0a, 0x39cad611, 0x39cad691, 0x39cafa09,
+    0x39cafa89, 0x39cafd85, 0x39cb378a, 0x39cb3a86, 0x39cbb4dd, 0x39cbb55d, 0x39cbc31d, 0x39cbc791,
+    0x39cbe71d, 0x39cbea1d, 0x39cc285d, 0x39cc2cdd, 0x39cc50dd, 0x39cc555d, 0x39cc56dd, 0x39cc575d,
+    0x39cc62de, 0x39cc645e, 0x39cc64de, 0x39cc68de, 0x39cc695e, 0x39cc6ade, 0x39cd1fd9, 0x39cd2159,
+    0x39cd21d9, 0x39ce12d5, 0x39ce1455, 0x39ce14d5, 0x39ce4d4a, 0x39ce63d1, 0x39ce6551, 0x39ce65d1,
+    0x39ce8df5, 0x39ce9c19, 0x39cea099, 0x39cea215, 0x39cec319, 0x39cf0159, 0x39cf05d9, 0x39cf29d9,
+    0x39cf2e59, 0x39cf2fd9, 0x39cf3059, 0x39cf3d5a, 0x39cf3dda, 0x39cf41da, 0x39cf425a, 0x39cf43da,
+    0x39cf80d5, 0x39cf8155, 0x39cfd1d1, 0x39cfd251, 0x39d00409, 0x39d01cd5, 0x39d02155, 0x39d022d5,
+    0x39d02b16, 0x39d02ed6, 0x39d03056, 0x39d030d6, 0x39d034d6, 0x39d03556, 0x39d04551, 0x39d049d1,
+    0x39d06949, 0x39d06c45, 0x39d07275, 0x39d07fd2, 0x39d08152, 0x39d081d2, 0x39d08652, 0x39d091c9,
+    0x39d74f9d, 0x39d75415, 0x39d75595, 0x39d75615, 0x39d78e8a, 0x39d7a736, 0x39d7cb36, 0x39d7ce05,
+    0x39d87f76, 0x39d883f6, 0x39d8855d, 0x39d885f6, 0x39d8939d, 0x39d8c296, 0x39d8f8dd, 0x39d8fd5d,
+    0x39d8fedd, 0x39d91392, 0x39d92176, 0x39d925f6, 0x39d9275d, 0x39d934de, 0x39d9395e, 0x39d93b5e,
+    0x39d9f076, 0x39d9f1d9, 0x39d9f276, 0x39dae355, 0x39dae4d5, 0x39dae555, 0x39db3476, 0x39db35d1,
+    0x39db3676, 0x39db6c91, 0x39db7115, 0x39db7291, 0x39dbd1d9, 0x39dbd659, 0x39dbd7d9, 0x39dbec92,
+    0x39dbfa76, 0x39dbfef6, 0x39dc0059, 0x39dc0c5a, 0x39dc0dda, 0x39dc0e5a, 0x39dc125a, 0x39dc12da,
+    0x39dc250a, 0x39dc2806, 0x39dc4b55, 0x39dc5155, 0x39dc51d5, 0x39dc9c76, 0x39dca0f6, 0x39dca251,
+    0x39dca2f6, 0x39dcc97a, 0x39dcd496, 0x39dcd785, 0x39dcdf92, 0x39dced55, 0x39dcf1d5, 0x39dcf355,
+    0x39dd00d6, 0x39dd0156, 0x39dd0396, 0x39dd0556, 0x39dd05d6, 0x39dd15d1, 0x39dd1a51, 0x39dd1bd1,
+    0x39dd3e75, 0x39dd42f5, 0x39dd5052, 0x39dd51d2, 0x39dd5252, 0x39dd5492, 0x39dd56d2, 0x39dd6276,
+    0x39dd66f5, 0x39dd6b75, 0x39dd6cf5, 0x39ddaa15, 0x39ddd211, 0x39de2d9d, 0x39de459d, 0x39de6c9d,
+    0x39deaadd, 0x39deb0dd, 0x39ded376, 0x39ded7f6, 0x39ded95d, 0x39ded9f6, 0x39dee6dd, 0x39dee776,
+    0x39deebf6, 0x39deed5d, 0x39df4cdd, 0x39df515d, 0x39df52dd, 0x39df5edd, 0x39df605d, 0x39df64dd,
+    0x39df88dd, 0x39df8d5d, 0x39df9ade, 0x39df9cde, 0x39dfc88a, 0x39dff10a, 0x39e01bd9, 0x39e01d59,
+    0x39e04476, 0x39e04676, 0x39e06a8a, 0x39e09185, 0x39e09579, 0x39e096d5, 0x39e09755, 0x39e0cfca,
+    0x39e0d2c6, 0x39e0e676, 0x39e11075, 0x39e12491, 0x39e12516, 0x39e13955, 0x39e171ca, 0x39e18875,
+    0x39e189f5, 0x39e1b275, 0x39e1c475, 0x39e1c675, 0x39e1f995, 0x39e22bd9, 0x39e237d9, 0x39e23959,
+    0x39e261d9, 0x39e273da, 0x39e275da, 0x39e28689, 0x39e29f55, 0x39e2a5d5, 0x39e2ad89, 0x39e2b2d5,
+    0x39e2b355, 0x39e2c7d1, 0x39e2ebc9, 0x39e2eec5, 0x39e2f075, 0x39e2f675, 0x39e30276, 0x39e303d1,
+    0x39e31476, 0x39e31745, 0x39e31ef5, 0x39e327c9, 0x39e32876, 0x39e32979, 0x39e32c75, 0x39e34511,
+    0x39e35555, 0x39e359d5, 0x39e38105, 0x39e38dc9, 0x39e396f5, 0x39e3a475, 0x39e3a5f5, 0x39e3aa75,
+    0x39e3ce75, 0x39e3d2f5, 0x39e3d375, 0x39f0cb05, 0x39f0e0d5, 0x39f0e255, 0x39f0e2d5, 0x39f0f455,
+    0x39f11f99, 0x39f12d1d, 0x39f13199, 0x39f13319, 0x39f14551, 0x39f157c9, 0x39f15ac5, 0x39f19715,
+    0x39f1aa95, 0x39f1bf91, 0x39f1e589, 0x39f1e685, 0x39f2109d, 0x39f2121d, 0x39f2129d, 0x39f2241d,
+    0x39f23851, 0x39f24ac9, 0x39f28a1d, 0x39f28bb9, 0x39f28c39, 0x39f29db6, 0x39f2c61d, 0x39f2c69d,
+    0x39f2c839, 0x39f2ef51, 0x39f2f0d1, 0x39f2f151, 0x39f30149, 0x39f35209, 0x39f35499, 0x39f35636,
+    0x39f35699, 0x39f36745, 0x39f37d19, 0x39f37e99, 0x39f37f19, 0x39f39099, 0x39f3a591, 0x39f3cc85,
+    0x39f3ce15, 0x39f3cf95, 0x39f3d015, 0x39f40ae5, 0x39f40c65, 0x39f40ce5, 0x39f41f11, 0x39f42091,
+    0x39f42111, 0x39f43365, 0x39f434e5, 0x39f43565, 0x39f446e5, 0x39f44765, 0x39f448e5, 0x39f45a45,
+    0x39f47015, 0x39f471b9, 0x39f47239, 0x39f48395, 0x39f49891, 0x39f4ace5, 0x39f4ae7a, 0x39f4aefa,
+    0x39f4c0e5, 0x39f4c27a, 0x39f4d491, 0x39f4fce5, 0x39f50b51, 0x39f50cd1, 0x39f51151, 0x39f53245,
+    0x39f56089, 0x39f56319, 0x39f564b6, 0x39f56519, 0x39f56e09, 0x39f57105, 0x39f576b6, 0x39f59919,
+    0x39f59a99, 0x39f59f19, 0x39f59f99, 0x39f5a119, 0x39f5ac99, 0x39f5de15, 0x39f5ea26, 0x39f5eba6,
+    0x39f5f015, 0x39f60511, 0x39f606b6, 0x39f614e5, 0x39f61965, 0x39f61ae5, 0x39f61b65, 0x39f628e5,
+    0x39f62ce5, 0x39f62d65, 0x39f62ee5, 0x39f63b26, 0x39f63ca6, 0x39f64111, 0x39f650e5, 0x39f65165,
+    0x39f655e5, 0x39f65765, 0x39f66226, 0x39f664e5, 0x39f66965, 0x39f68c15, 0x39f68db9, 0x39f69215,
+    0x39f69295, 0x39f69f95, 0x39f6b491, 0x39f6bab6, 0x39f6c8e5, 0x39f6ca7a, 0x39f6cafa, 0x39f6cee5,
+    0x39f6cf65, 0x39f6db85, 0x39f6dce5, 0x39f6de7a, 0x39f6e2e5, 0x3a041b95, 0x3a046809, 0x3a04bb91,
+    0x3a04e285, 0x3a0520dd, 0x3a0522dd, 0x3a05495d, 0x3a054b5d, 0x3a055cdd, 0x3a055d5d, 0x3a05c4fa,
+    0x3a05d27a, 0x3a05d6dd, 0x3a05d87a, 0x3a05fa7a, 0x3a05ff5d, 0x3a068f59, 0x3a06b7d9, 0x3a0706d5,
+    0x3a078075, 0x3a0781f5, 0x3a078275, 0x3a07bb85, 0x3a07f9f5, 0x3a082275, 0x3a0823f9, 0x3a082479,
+    0x3a0835f5, 0x3a089dd9, 0x3a08ab59, 0x3a08afd9, 0x3a08d859, 0x3a091755, 0x3a096675, 0x3a099075,
+    0x3a0990f5, 0x3a09a275, 0x3a09cb55, 0x3a0a0875, 0x3a0a15f5, 0x3a0a3e75, 0x3a0a3ff9, 0x3a0a4475,
+    0x3a0a4679, 0x3a10d15e, 0x3a10d5d1, 0x3a10eac5, 0x3a10fbc9, 0x3a10fec5, 0x3a111491, 0x3a113889,
+    0x3a113b19, 0x3a113b85, 0x3a113c99, 0x3a113d19, 0x3a115f1e, 0x3a1163b5, 0x3a116519, 0x3a1177b5,
+    0x3a117919, 0x3a11ecdd, 0x3a11f35d, 0x3a121576, 0x3a12521e, 0x3a125695, 0x3a125839, 0x3a126a95,
+    0x3a126c39, 0x3a12a8fa, 0x3a132115, 0x3a132295, 0x3a132315, 0x3a135fd9, 0x3a1450f5, 0x3a145275,
+    0x3a1452f5, 0x3a14ca75, 0x3a14cafa, 0x3a14cbf9, 0x3a14cc79, 0x3a14f2f5, 0x3a1506f5, 0x3a150879,
+    0x3a153d15, 0x3a153e95, 0x3a157bd9, 0x3a158059, 0x3a163275, 0x3a1636f5, 0x3a166cf5, 0x3a166e75,
+    0x3a167375, 0x3a1674f5, 0x3a173d51, 0x3a174fc9, 0x3a1752c5, 0x3a178f19, 0x3a179099, 0x3a179119,
+    0x3a179a1d, 0x3a17a299, 0x3a17cb19, 0x3a17cbb5, 0x3a17cd19, 0x3a17d89e, 0x3a18475d, 0x3a1854dd,
+    0x3a18595d, 0x3a185add, 0x3a18955d, 0x3a18be15, 0x3a18be95, 0x3a18c039, 0x3a18cb9e, 0x3a18f6fa,
+    0x3a190a7a, 0x3a190edd, 0x3a195f45, 0x3a197515, 0x3a197695, 0x3a197715, 0x3a198895, 0x3a19b3d9,
+    0x3a19c5d9, 0x3a19c759, 0x3a19d991, 0x3a1a1711, 0x3a1a1891, 0x3a1a1911, 0x3a1a3e05, 0x3a1a3ed5,
+    0x3a1a7ac5, 0x3a1a7c75, 0x3a1a7df5, 0x3a1a7e75, 0x3a1aa4f5, 0x3a1aa675, 0x3a1aa6f5, 0x3a1ab875,
+    0x3a1acc91, 0x3a1acd11, 0x3a1aceb9, 0x3a1ae005, 0x3a1af405, 0x3a1b1e75, 0x3a1b1ff9, 0x3a1b2079,
+    0x3a1b31f5, 0x3a1b3275, 0x3a1b33f9, 0x3a1b5a75, 0x3a1b5af5, 0x3a1b5c79, 0x3a1b6e75, 0x3a1b9115,
+    0x3a1b9295, 0x3a1b9715, 0x3a1b9795, 0x3a1b9915, 0x3a1ba495, 0x3a1be1d9, 0x3a1be7d9, 0x3a1c3311,
+    0x3a1c3491, 0x3a1c3911, 0x3a1c5ad5, 0x3a1c8675, 0x3a1c8af5, 0x3a1c8c75, 0x3a1c8cf5, 0x3a1c95c9,
+    0x3a1c96c5, 0x3a1c9875, 0x3a1c99f5, 0x3a1c9e75, 0x3a1cc0f5, 0x3a1cc275, 0x3a1cc6f5, 0x3a1cc775,
+    0x3a1cc8f5, 0x3a1cd475, 0x3a1cef11, 0x3a1d3a75, 0x3a1d3bf9, 0x3a1d4075, 0x3a1d40f5, 0x3a1d4279,
+    0x3a1d4df5, 0x3a1d5475, 0x3a1d7675, 0x3a1d7cf5, 0x3a2a7611, 0x3a2a8809, 0x3a2a8c55, 0x3a2a973a,
+    0x3a2ac7da, 0x3a2ac869, 0x3a2ac976, 0x3a2ac9ea, 0x3a2adb76, 0x3a2b03d9, 0x3a2b0465, 0x3a2b05d9,
+    0x3a2b117a, 0x3a2b41d5, 0x3a2b4ee6, 0x3a2bbc1d, 0x3a2bc6e6, 0x3a2bf6d5, 0x3a2bf755, 0x3a2bf8e5,
+    0x3a2c0455, 0x3a2c3429, 0x3a2c35aa, 0x3a2ca4d5, 0x3a2cadda, 0x3a2cb855, 0x3a2cb9d9, 0x3a2cbb7a,
+    0x3a2cc155, 0x3a2cf445, 0x3a2cf819, 0x3a2cfa29, 0x3a2d20a6, 0x3a2d2219, 0x3a2d2899, 0x3a2d337a,
+    0x3a2d3419, 0x3a2d34a6, 0x3a2d3619, 0x3a2d6de5, 0x3a2d73a5, 0x3a2dac25, 0x3a2db53a, 0x3a2db6b6,
+    0x3a2dd4a6, 0x3a2dddba, 0x3a2dde05, 0x3a2ddf25, 0x3a2de825, 0x3a2de8a6, 0x3a2deb26, 0x3a2deca6,
+    0x3a2df13a, 0x3a2e2645, 0x3a2e2715, 0x3a2e6305, 0x3a2e64a5, 0x3a2e6636, 0x3a2e6ab6, 0x3a2e8d25,
+    0x3a2e8ea5, 0x3a2e9325, 0x3a2ea0a5, 0x3a2edd76, 0x3a2f1e6a, 0x3a2fd2a6, 0x3a300d26, 0x3a3013ba,
+    0x3a3dc445, 0x3a3e02a9, 0x3a3e3e99, 0x3a3e7c15, 0x3a3ef405, 0x3a3f3015, 0x3a3f3195, 0x3a3fa99d,
+    0x3a3fab1d, 0x3a3fc959, 0x3a3fe895, 0x3a3ff059, 0x3a3ff619, 0x3a402e99, 0x3a404519, 0x3a404699,
+    0x3a405719, 0x3a406a99, 0x3a406b19, 0x3a40ede9, 0x3a40efe9, 0x3a411669, 0x3a4117e9, 0x3a411869,
+    0x3a412a69, 0x3a412be9, 0x3a413811, 0x3a414a09, 0x3a415385, 0x3a415d95, 0x3a415f05, 0x3a4166b6,
+    0x3a417289, 0x3a418b69, 0x3a418fe9, 0x3a4191e9, 0x3a419985, 0x3a419d69, 0x3a419f69, 0x3a41a3e9,
+    0x3a41c5e9, 0x3a41c769, 0x3a41c7e9, 0x3a41cbe9, 0x3a41cc69, 0x3a41cde9, 0x3a41d969, 0x3a41d9e9,
+    0x3a41db69, 0x3a41dfe9, 0x3a420499, 0x3a420545, 0x3a420915, 0x3a4243a9, 0x3a427f89, 0x3a428299,
+    0x3a42bd09, 0x3a42c005, 0x3a42fc69, 0x3a42fe69, 0x3a4338e9, 0x3a433a69, 0x3a434c69, 0x3a436f85,
+    0x3a437405, 0x3a437716, 0x3a43abe9, 0x3a43ade9, 0x3a43b269, 0x3a43bfe9, 0x3a43e7e9, 0x3a43e869,
+    0x3a43e9e9, 0x3a43ee69, 0x3a50fbe9, 0x3a50fc69, 0x3a50fde9, 0x3a510969, 0x3a51ef9e, 0x3a51f11e,
+    0x3a520329, 0x3a522ba9, 0x3a522da9, 0x3a52a529, 0x3a52a5aa, 0x3a52b2a9, 0x3a530469, 0x3a5305e9,
+    0x3a530a69, 0x3a5318aa, 0x3a532b69, 0x3a532c2a, 0x3a53412a, 0x3a53532a, 0x3a535d9a, 0x3a53682a,
+    0x3a536fa9, 0x3a539829, 0x3a53a5a9, 0x3a53baaa, 0x3a53ccaa, 0x3a53d596, 0x3a53d716, 0x3a53e02a,
+    0x3a53e1aa, 0x3a53e329, 0x3a53e4a9, 0x3a53e929, 0x3a53f52a, 0x3a53f992, 0x3a53ff92, 0x3a541c2a,
+    0x3a541fea, 0x3a54216a, 0x3a5421ea, 0x3a5435a9, 0x3a543a29, 0x3a54486a, 0x3a5449ea, 0x3a54506a,
+    0x3a545bea, 0x3a545c6a, 0x3a545dea, 0x3a54626a, 0x3a548b29, 0x3a5498a9, 0x3a549f29, 0x3a54ada9,
+    0x3a54b3a9, 0x3a54c1ea, 0x3a54c36a, 0x3a54c86a, 0x3a54f029, 0x3a552cea, 0x3a553ee9, 0x3a557e29,
+    0x3a557eaa, 0x3a55802a, 0x3a558ba9, 0x3a55922a, 0x3a55baa9, 0x3a55ef2a, 0x3a55f22a, 0x3a55f7a9,
+    0x3a560529, 0x3a562e6a, 0x3a562fea, 0x3a56306a, 0x3a5641ea, 0x3a5643ea, 0x3a565ca9, 0x3a566c6a,
+    0x3a56ada9, 0x3a56d62a, 0x3a56e46a, 0x3a777015, 0x3a77e805, 0x3a789fdd, 0x3a7953dd, 0x3a79555d,
+    0x3a799f19, 0x3a79dd59, 0x3a7a05d9, 0x3a7a0c59, 0x3a7a1959, 0x3a7a19d9, 0x3a7a95ca, 0x3a7b0705,
+    0x3a7b0ad5, 0x3a7b0c55, 0x3a7b0cd5, 0x3a7b4549, 0x3a7b4845, 0x3a7b6dc9, 0x3a7b8149, 0x3a7b81c9,
+    0x3a7b8a75, 0x3a8aa456, 0x3a8aa756, 0x3a8b1fba, 0x3a8b2035, 0x3a8b2199, 0x3a8b2d3a, 0x3a8c1295,
+    0x3a8c1316, 0x3a8c1496, 0x3a8c2015, 0x3a8cac49, 0x3a8caf45, 0x3a8cc089, 0x3a8cd599, 0x3a8cd73a,
+    0x3a8cd895, 0x3a8cdd3a, 0x3a8ce909, 0x3a8d01d9, 0x3a8d13d9, 0x3a8d1559, 0x3a8d2835, 0x3a8d2991,
+    0x3a8d2e3a, 0x3a8d3c76, 0x3a8d3dd9, 0x3a8d4f3a, 0x3a8d4fd9, 0x3a8d5076, 0x3a8d51d9, 0x3a8d6289,
+    0x3a8d7b55, 0x3a8d8989, 0x3a8d8d79, 0x3a8d8ed5, 0x3a8d8f55, 0x3a8da3d1, 0x3a8dc7c9, 0x3a8dcac5,
+    0x3a8dcc75, 0x3a8dd275, 0x3a8dde76, 0x3a8ddfd1, 0x3a8df076, 0x3a8df345, 0x3a8dfaf5, 0x3a8e03c9,
+    0x3a8e0476, 0x3a8e06fa, 0x3a8e0875, 0x3a8e0cfa, 0x3a8e1b11, 0x3a8e1c91, 0x3a8e2111, 0x3a8e4205,
+    0x3a8e42d5, 0x3a8e69c9, 0x3a8e72f5, 0x3a8e7475, 0x3a8e7ec5, 0x3a8e8075, 0x3a8e81f5, 0x3a8e8675,
+    0x3a8ea8f5, 0x3a8eaa75, 0x3a8eaef5, 0x3a8eaf75, 0x3a8eb0f5, 0x3a8ebc75, 0x3a8ec2f5, 0x3a8eebba,
+    0x3a8eec16, 0x3a8eed96, 0x3a8ef93a, 0x3a8eff96, 0x3a8f50ba, 0x3a8f6289, 0x3a8f9dd5, 0x3a8fe0f5,
+    0x3a8fee75, 0x3a8ff2fa, 0x3a901b7a, 0x3a901d75, 0x3a9028fa, 0x3a902f7a, 0x3a904396, 0x3a905596,
+    0x3a9094f5, 0x3a90a275, 0x3a90d175, 0x3accc645, 0x3acce9ae, 0x3acceb2e, 0x3accefa1, 0x3accf015,
+    0x3acd22a2, 0x3acd3aae, 0x3acd3c2e, 0x3acd4091, 0x3acd7e11, 0x3acde361, 0x3ace0be1, 0x3ace1f61,
+    0x3ace1fe1, 0x3ace29ee, 0x3ace2dae, 0x3ace2f2e, 0x3ace33a5, 0x3ace996a, 0x3acec165, 0x3aceceee,
+    0x3acecf6e, 0x3aced0ee, 0x3aced565, 0x3acee245, 0x3acef445, 0x3acef815, 0x3acef995, 0x3acf0ba1,
+    0x3acf0c15, 0x3acf0d95, 0x3acf5c91, 0x3acf6e89, 0x3acf7005, 0x3acf9a11, 0x3acf9b91, 0x3ad000e1,
+    0x3ad027e1, 0x3ad02961, 0x3ad03b61, 0x3ad03be1, 0x3ad03d61, 0x3ad04f91, 0x3ad06189, 0x3ad06305,
+    0x3ad0a161, 0x3ad0a2e1, 0x3ad0b4e1, 0x3ad0b56a, 0x3ad0b6ea, 0x3ad0dd61, 0x3ad16069, 0x3ad19ae6,
+    0x3ad1d9d5, 0x3ad3272d, 0x3ad33fed, 0x3ad34455, 0x3ad345d5, 0x3ad34655, 0x3ad34e2d, 0x3ad351ed,
+    0x3ad3536d, 0x3ad353ed, 0x3ad357d5, 0x3ad35855, 0x3ad3686d, 0x3ad36cd1, 0x3ad36e51, 0x3ad38c6d,
+    0x3ad3b4ed, 0x3ad3c86d, 0x3ad3c8ed, 0x3ad3d159, 0x3ad3e1ed, 0x3ad3e651, 0x3ad3e7d1, 0x3ad405ed,
+    0x3ad4472d, 0x3ad44ba5, 0x3ad44d25, 0x3ad44da9, 0x3ad46fad, 0x3ad47425, 0x3ad475a5, 0x3ad47625,
+    0x3ad4832d, 0x3ad483ad, 0x3ad487a5, 0x3ad48825, 0x3ad489a5, 0x3ad4c465, 0x3ad4e92d, 0x3ad4eda6,
+    0x3ad4ef26, 0x3ad4efa6, 0x3ad4fb2d, 0x3ad50126, 0x3ad501a6, 0x3ad5252d, 0x3ad525ad, 0x3ad52a26,
+    0x3ad52ba6, 0x3ad5372d, 0x3ad537ad, 0x3ad5392d, 0x3ad53da6, 0x3ad54845, 0x3ad54d91, 0x3ad55e09,
+    0x3ad56105, 0x3ad56255, 0x3ad57189, 0x3ad57305, 0x3ad59f59, 0x3ad5b159, 0x3ad5b2d9, 0x3ad5c289,
+    0x3ad5d605, 0x3ad5d9d9, 0x3ad5db59, 0x3ad5ed59, 0x3ad5edd9, 0x3ad5ef59, 0x3ad655a5, 0x3ad65a25,
+    0x3ad65c29, 0x3ad69225, 0x3ad696a5, 0x3ad69825, 0x3ad6aa25, 0x3ad6b589, 0x3ad6c905, 0x3ad6ccd5,
+    0x3ad6ce55, 0x3ad6e055, 0x3ad6e0d5, 0x3ad6e255, 0x3ad70749, 0x3ad70ba9, 0x3ad71026, 0x3ad71ac9,
+    0x3ad73151, 0x3ad74349, 0x3ad744c5, 0x3ad747a5, 0x3ad85355, 0x3ad991ae, 0x3ad9932e, 0x3ad99791,
+    0x3ad99811, 0x3ad9a22d, 0x3ad9a5ed, 0x3ad9abd5, 0x3ad9b9ed, 0x3ad9bb6d, 0x3ad9bfd5, 0x3ad9fd6a,
+    0x3ada1c6d, 0x3ada2559, 0x3ada25d9, 0x3ada336e, 0x3ada34ee, 0x3ada3959, 0x3ada62d6, 0x3ada6ded,
+    0x3ada76ea, 0x3ada8b52, 0x3adab529, 0x3adac751, 0x3adac7d1, 0x3adad1ed, 0x3adad5ad, 0x3adadba5,
+    0x3adae9ad, 0x3adaeb2d, 0x3adaefa5, 0x3adb1865, 0x3adb18e5, 0x3adb266e, 0x3adb27ee, 0x3adb2c65,
+    0x3adb416a, 0x3adb4b6d, 0x3adb4f2d, 0x3adb50ad, 0x3adb5526, 0x3adb6926, 0x3adb76ee, 0x3adb776e,
+    0x3adb78ee, 0x3adb7d65, 0x3adb8b2d, 0x3adbb391, 0x3adbb411, 0x3adbb591, 0x3adbc589, 0x3adbc705,
+    0x3adc0559, 0x3adc06d9, 0x3adc196a, 0x3adc1aea, 0x3adc4159, 0x3adc41d9, 0x3adc4359, 0x3adc7ed5,
+    0x3adc8055, 0x3adc92ea, 0x3adc9455, 0x3adca8d1, 0x3adcb7c5, 0x3adcbba5, 0x3adcbd25, 0x3adcc1a5,
+    0x3adce351, 0x3adce3d1, 0x3adce551, 0x3add3455, 0x3add34d5, 0x3add3655, 0x3add5cd1, 0x3add5d6a,
+    0x3add5eea, 0x3add8446, 0x3adff7ad, 0x3ae0106d, 0x3ae014d5, 0x3ae02262, 0x3ae023e2, 0x3ae038ed,
+    0x3ae03d51, 0x3ae0b26d, 0x3ae0b6d1, 0x3ae0d962, 0x3ae117a2, 0x3ae11c22, 0x3ae1402d, 0x3ae144a1,
+    0x3ae14621, 0x3ae153a2, 0x3ae1542d, 0x3ae194e1, 0x3ae1b9ad, 0x3ae1be21, 0x3ae1d1a2, 0x3ae1e5d1,
+    0x3ae1f5ad, 0x3ae2d451, 0x3ae2d4d1, 0x3ae2e7c5, 0x3ae31045, 0x3ae32621, 0x3ae33822, 0x3ae339a2,
+    0x3ae33a29, 0x3ae360a1, 0x3ae36221, 0x3ae362a1, 0x3ae374a1, 0x3ae58c1d, 0x3ae6401d, 0x3ae6539e,
+    0x3ae668d1, 0x3ae66a51, 0x3ae6ce19, 0x3ae6cfb5, 0x3ae6f699, 0x3ae6f819, 0x3ae6f899, 0x3ae70a19,
+    0x3ae70a99, 0x3ae70c19, 0x3ae747a9, 0x3ae74915, 0x3ae74995, 0x3ae7eb95, 0x3ae8240a, 0x3ae86dad,
+    0x3ae86e2d, 0x3ae8722e, 0x3ae876a9, 0x3ae91049, 0x3ae91499, 0x3ae91919, 0x3ae923d9, 0x3ae938c9,
+    0x3ae95195, 0x3ae95815, 0x3ae96515, 0x3ae96595, 0x3ae97a11, 0x3ae9b611, 0x3ae9b691, 0x3ae9dea9,
+    0x3aea0795, 0x3aea0c15, 0x3aea44a9, 0x3aea56a9, 0x3aea5836, 0x3aea7f29, 0x3aea80a9, 0x3aecc692,
+    0x3aecca52, 0x3aeccbd2, 0x3aecdc6d, 0x3aecf06d, 0x3aed3629, 0x3aed582d, 0x3aed59ad, 0x3aed5a2d,
+    0x3aed5e19, 0x3aed6c2d, 0x3aed6dad, 0x3aed7219, 0x3aedab2d, 0x3aedaf95, 0x3aedb115, 0x3aee0c2d,
+    0x3aee0f2d, 0x3aee202d, 0x3aee3cd1, 0x3aee85ad, 0x3aeecaa9, 0x3aeecb29, 0x3aeedea9, 0x3aeff209,
+    0x3aeff505, 0x3af0aaa9, 0x3af0ac36, 0x3af0e6a9, 0x3af0e729, 0x3af0e8a9, 0x3af332ae, 0x3af3342e,
+    0x3af33899, 0x3af39e6a, 0x3af3c659, 0x3af3d3ee, 0x3af3d5ee, 0x3af3da59, 0x3af403d6, 0x3af41761,
+    0x3af417ea, 0x3af42c52, 0x3af46851, 0x3af4c6ee, 0x3af4c76e, 0x3af4c8ee, 0x3af517ee, 0x3af55491,
+    0x3af56689, 0x3af56805, 0x3af5a659, 0x3af5a7d9, 0x3af5ba6a, 0x3af5bbea, 0x3af5e259, 0x3af61fd5,
+    0x3af62155, 0x3af63361, 0x3af633ea, 0x3af63555, 0x3af64851, 0x3af649d1, 0x3af68451, 0x3af6d555,
+    0x3af6fdd1, 0x3af72546, 0x3af9c0ed, 0x3af9c959, 0x3afa002d, 0x3afa01ad, 0x3afa061a, 0x3afa069a,
+    0x3afa28b6, 0x3afa2a2d, 0x3afa2ab6, 0x3afa2e9a, 0x3afa2f1a, 0x3afa3c2d, 0x3afa3cb6, 0x3afa3e2d,
+    0x3afa79ad, 0x3afa7bad, 0x3afab42d, 0x3afabd29, 0x3afadcb6, 0x3afae5b5, 0x3afaf02d, 0x3afaf0b6,
+    0x3afaf929, 0x3afaf9b5, 0x3afb562d, 0x3afb5aae, 0x3afba8ae, 0x3afba92e, 0x3afbaaae, 0x3afbba89,
+    0x3afbce05, 0x3afbd1d5, 0x3afbd355, 0x3afbe555, 0x3afbe5d5, 0x3afbe755, 0x3afc0c49, 0x3afc1fc9,
+    0x3afc3651, 0x3afc4849, 0x3afc49c5, 0x3afc8a15, 0x3afcc289, 0x3afcc729, 0x3afcd929, 0x3afcdaa9,
+    0x3afd01b5, 0x3afd0329, 0x3afd1529, 0x3afd15b5, 0x3afd1729, 0x3afd2951, 0x3afd3b49, 0x3afd3cc5,
+    0x3afd7b29, 0x3afd7ca9, 0x3afd8ea9, 0x3afd8f2a, 0x3afd90aa, 0x3afdb729, 0x3b001d59, 0x3b001dd9,
+    0x3b002b6e, 0x3b002cee, 0x3b003159, 0x3b007bee, 0x3b007dee, 0x3b008259, 0x3b00902d, 0x3b00bf51,
+    0x3b00bfd6, 0x3b01252a, 0x3b01442d, 0x3b014d29, 0x3b014db5, 0x3b016129, 0x3b016eee, 0x3b016f6e,
+    0x3b0170ee, 0x3b01bdad, 0x3b01c0ae, 0x3b01c22e, 0x3b01c2aa, 0x3b01d4aa, 0x3b01d62a, 0x3b023955,
+    0x3b0239d5, 0x3b023b55, 0x3b02db51, 0x3b02dbea, 0x3b02dd51, 0x3b032a09, 0x3b032d29, 0x3b032ea9,
+    0x3b0342aa, 0x3b036929, 0x3b0369b5, 0x3b036b29, 0x3b03e2a9, 0x3b03e32a, 0x3b03e4aa, 0x3b0681ed,
+    0x3b06aa6d, 0x3b078922, 0x3b07b1ad, 0x3b082b2d, 0x3b082fa6, 0x3b084322, 0x3b0865ad, 0x3b0acdd5,
+    0x3b0bfd9d, 0x3b0cc51e, 0x3b0cda51, 0x3b0cdbd1, 0x3b0d0055, 0x3b0d3f99, 0x3b0d4125, 0x3b0d6826,
+    0x3b0d6999, 0x3b0d6a26, 0x3b0d7b99, 0x3b0d7c26, 0x3b0d7d99, 0x3b0db939, 0x3b0dba95, 0x3b0dbb15,
+    0x3b0e3009, 0x3b0e5d26, 0x3b0e958a, 0x3b0f8619, 0x3b0f8aa6, 0x3b0fc995, 0x3b107915, 0x3b107da6,
+    0x3b127739, 0x3b134ded, 0x3b13c9ad, 0x3b13cb2d, 0x3b13cf99, 0x3b13ddad, 0x3b13df2d, 0x3b13e399,
+    0x3b142295, 0x3b147dad, 0x3b1491ad, 0x3b149aba, 0x3b14f72d, 0x3b166389, 0x3b16b6ba, 0x3b19aad1,
+    0x3b19ac51, 0x3b19ca62, 0x3b19d0d5, 0x3b1a0ba2, 0x3b1a1022, 0x3b1a11a2, 0x3b1a3899, 0x3b1a3a19,
+    0x3b1a4c99, 0x3b1a8522, 0x3b1a89a2, 0x3b1a8b22, 0x3b1a8b95, 0x3b1b0089, 0x3b1b660a, 0x3b1c9395,
+    0x3b1ca722, 0x3b1ca795, 0x3b1cbc11, 0x3b1cf811, 0x3b1cf891, 0x3b203bad, 0x3b203d2d, 0x3b20b2ad,
+    0x3b216ced, 0x3b216d6d, 0x3b21e4ed, 0x3b220d6d, 0x3b220eed, 0x3b220f6d, 0x3b2220ed, 0x3b22216d,
+    0x3b2222ed, 0x3b22e7ad, 0x3b234ced, 0x3b23756d, 0x3b237bed, 0x3b2388ed, 0x3b23896d, 0x3b242b6d,
+    0x3b242fed, 0x3b268b2d, 0x3b26a395, 0x3b27142d, 0x3b27baed, 0x3b27bf79, 0x3b27c0ed, 0x3b27c16d,
+    0x3b27ceed, 0x3b27d379, 0x3b27d4ed, 0x3b28346d, 0x3b2838ed, 0x3b286eed, 0x3b28706d, 0x3b2870ed,
+    0x3b2874ed, 0x3b2882ed, 0x3b28846d, 0x3b2888ed, 0x3b29a0ed, 0x3b29db79, 0x3b29dced, 0x3b29dd6d,
+    0x3b29ef79, 0x3b29f0ed, 0x3b2e3bba, 0x3b3057ba, 0x3b3342ed, 0x3b335bad, 0x3b3369ed, 0x3b336dad,
+    0x3b336f2d, 0x3b33842d, 0x3b338a1a, 0x3b33a82d, 0x3b33d0b6, 0x3b33e42d, 0x3b33e4b6, 0x3b33fdad,
+    0x3b3421ad, 0x3b3462ed, 0x3b346779, 0x3b3468ed, 0x3b348b76, 0x3b348ff6, 0x3b34916d, 0x3b3491f6,
+    0x3b349eed, 0x3b349f76, 0x3b34a379, 0x3b34a3f6, 0x3b34a56d, 0x3b3504ed, 0x3b3516ed, 0x3b35186d,
+    0x3b353f76, 0x3b3540ed, 0x3b354176, 0x3b3552ed, 0x3b355376, 0x3b3554ed, 0x3b36716d, 0x3b3675f9,
+    0x3b36adf6, 0x3b36b276, 0x3b36b3ed, 0x3b36c5f9, 0x3b37636d, 0x3b3a9296, 0x3b3af2ed, 0x3b3af779,
+    0x3b3b06ed, 0x3b3b0b79, 0x3b3b4396, 0x3b3b6aed, 0x3b3b6c6d, 0x3b3b94ae, 0x3b3ba6ed, 0x3b3cae96,
+    0x3b3cd779, 0x3b3cd8ed, 0x3b3cdd79, 0x3b3cffba, 0x3b3d5216, 0x3b4015ae, 0x3b40172e, 0x3b401b91,
+    0x3b408159, 0x3b40a36e, 0x3b40a4ee, 0x3b40a959, 0x3b40b6ee, 0x3b40b76e, 0x3b40b8ee, 0x3b40bd59,
+    0x3b40e6d6, 0x3b40fa61, 0x3b40fad5, 0x3b410f52, 0x3b41456e, 0x3b4146ee, 0x3b414b51, 0x3b4180ae,
+    0x3b419c65, 0x3b41a9ee, 0x3b41aa6e, 0x3b41b065, 0x3b41c4e5, 0x3b41faee, 0x3b423791, 0x3b424989,
+    0x3b424b05, 0x3b428959, 0x3b428ad9, 0x3b429d59, 0x3b429ed9, 0x3b42c559, 0x3b4302d5, 0x3b430455,
+    0x3b431661, 0x3b4316d5, 0x3b431855, 0x3b432b51, 0x3b432cd1, 0x3b436751, 0x3b43b855, 0x3b43e0d1,
+    0x3b440846, 0x3b456b1d, 0x3b46ac55, 0x3b46d79a, 0x3b46e52d, 0x3b47a025, 0x3b47c8a5, 0x3b47dc25,
+    0x3b47dca5, 0x3b483dae, 0x3b4855a5, 0x3b488bae, 0x3b488c2e, 0x3b488dae, 0x3b489d89, 0x3b48b105,
+    0x3b48b4d5, 0x3b48b655, 0x3b48c855, 0x3b48c8d5, 0x3b48ca55, 0x3b491951, 0x3b492b49, 0x3b492cc5,
+    0x3b49aa25, 0x3b49bc25, 0x3b49bda5, 0x3b49e4a5, 0x3b49e625, 0x3b49f825, 0x3b49f8a5, 0x3b49fa25,
+    0x3b4a0c51, 0x3b4a1e49, 0x3b4a1fc5, 0x3b4a5e25, 0x3b4a5fb9, 0x3b4a71a5, 0x3b4a7225, 0x3b4a73b9,
+    0x3b4a9a25, 0x3b4be49d, 0x3b4d0055, 0x3b4d00d5, 0x3b4d0e6e, 0x3b4d0fee, 0x3b4d1459, 0x3b4d4b2d,
+    0x3b4d4cad, 0x3b4d5126, 0x3b4d5eee, 0x3b4d5f6e, 0x3b4d60ee, 0x3b4d6559, 0x3b4da251, 0x3b4da2d1,
+    0x3b4dff2d, 0x3b4e0825, 0x3b4e2a2e, 0x3b4e2bae, 0x3b4e3025, 0x3b4e30a5, 0x3b4e4425, 0x3b4e51ee,
+    0x3b4e526e, 0x3b4ea3ae, 0x3b4ea52e, 0x3b4ea5ae, 0x3b4ea9a5, 0x3b4eaa25, 0x3b4eb7ae, 0x3b4eb92e,
+    0x3b4edfae, 0x3b4f1c55, 0x3b4f1cd5, 0x3b4f1e55, 0x3b4fbe51, 0x3b4fbed1, 0x3b4fc051, 0x3b501025,
+    0x3b5011a5, 0x3b502425, 0x3b5025a5, 0x3b504c25, 0x3b504ca5, 0x3b504e25, 0x3b50c5a5, 0x3b50c625,
+    0x3b50c7b9, 0x3b54c0d1, 0x3b552636, 0x3b554ea1, 0x3b5562a1, 0x3b568e36, 0x3b56b521, 0x3b59b46d,
+    0x3b59cd2d, 0x3b59db6d, 0x3b59df2d, 0x3b59e0ad, 0x3b59e12d, 0x3b59f5ad, 0x3b5a19ad, 0x3b5a422d,
+    0x3b5a55ad, 0x3b5a562d, 0x3b5a6f2d, 0x3b5a7391, 0x3b5a932d, 0x3b5a962d, 0x3b5ad46d, 0x3b5ad8ed,
+    0x3b5adaed, 0x3b5afced, 0x3b5b016d, 0x3b5b02ed, 0x3b5b036d, 0x3b5b0eed, 0x3b5b106d, 0x3b5b10ed,
+    0x3b5b14ed, 0x3b5b156d, 0x3b5b16ed, 0x3b5b5195, 0x3b5b767a, 0x3b5b7aed, 0x3b5b7cfa, 0x3b5b886d,
+    0x3b5b8a7a, 0x3b5b8eed, 0x3b5bb27a, 0x3b5bb2fa, 0x3b5bb76d, 0x3b5bb8fa, 0x3b5bc22e, 0x3b5bc46d,
+    0x3b5bc4ed, 0x3b5bc67a, 0x3b5bcaed, 0x3b5c3e99, 0x3b5c4036, 0x3b5c6719, 0x3b5c6899, 0x3b5c7a99,
+    0x3b5c7b19, 0x3b5c8f91, 0x3b5ce2ed, 0x3b5ce76d, 0x3b5ce96d, 0x3b5cf4ed, 0x3b5cf6ed, 0x3b5d1d6d,
+    0x3b5d1eed, 0x3b5d1f6d, 0x3b5d23ed, 0x3b5d256d, 0x3b5d2e89, 0x3b5d316d, 0x3b5d376d, 0x3b5d9489,
+    0x3b5d98fa, 0x3b5d9d6d, 0x3b5da836, 0x3b5dd089, 0x3b5dd4fa, 0x3b6081ad, 0x3b613c6d, 0x3b6140ed,
+    0x3b614275, 0x3b6162ed, 0x3b61646d, 0x3b6164ed, 0x3b6168ed, 0x3b6176ed, 0x3b61786d, 0x3b617ced,
+    0x3b61a595, 0x3b61a615, 0x3b61b995, 0x3b61ce36, 0x3b61dc6d, 0x3b61de7a, 0x3b61f06d, 0x3b620a91,
+    0x3b62186d, 0x3b62a699, 0x3b62a836, 0x3b62ce99, 0x3b62cf19, 0x3b62d099, 0x3b633636, 0x3b6348ed,
+    0x3b634aed, 0x3b635ced, 0x3b6362f5, 0x3b66a159, 0x3b66aeee, 0x3b66af6e, 0x3b66b0ee, 0x3b66b559,
+    0x3b66ffee, 0x3b674351, 0x3b67a921, 0x3b67cb2e, 0x3b67ccae, 0x3b67d121, 0x3b67deae, 0x3b67e521,
+    0x3b67f2ee, 0x3b6858ae, 0x3b685a2e, 0x3b6880ae, 0x3b68bd55, 0x3b695f51, 0x3b69b121, 0x3b69b2a1,
+    0x3b69c521, 0x3b69c6a1, 0x3b69ed21, 0x3b6a66a1, 0x3b6d429a, 0x3b6d522d, 0x3b6d5a99, 0x3b6d90ae,
+    0x3b6dd415, 0x3b6e0aed, 0x3b6e0c6d, 0x3b6e0ced, 0x3b6e10ed, 0x3b6e116d, 0x3b6e34ed, 0x3b6e396d,
+    0x3b6e46ed, 0x3b6e48ed, 0x3b6e4d6d, 0x3b6eaaae, 0x3b6eaced, 0x3b6eaefa, 0x3b6ec0ed, 0x3b6f1151,
+    0x3b6f2349, 0x3b6f24c5, 0x3b6f6319, 0x3b6f6499, 0x3b6f7699, 0x3b6f7719, 0x3b6f7899, 0x3b6f9f19,
+    0x3b6ff015, 0x3b70196d, 0x3b701b6d, 0x3b709215, 0x3b70cc89, 0x3b73a89a, 0x3b73aa1a, 0x3b73ae9a,
+    0x3b73af1a, 0x3b73b9ae, 0x3b73bb2e, 0x3b742816, 0x3b742896, 0x3b743c2d, 0x3b745112, 0x3b7472ee,
+    0x3b74746e, 0x3b7478ee, 0x3b748d2d, 0x3b749aee, 0x3b7512ae, 0x3b75146e, 0x3b75caad, 0x3b75cb2d,
+    0x3b75ccad, 0x3b76442d, 0x3b7644ad, 0x3b76462d, 0x3b7680ee, 0x3b779ade, 0x3b779dde, 0x3b77c59e,
+    0x3b79c2c5, 0x3b79c691, 0x3b79c811, 0x3b79c891, 0x3b79ec21, 0x3b7a3d09, 0x3b7a3e85, 0x3b7a5459,
+    0x3b7a55d9, 0x3b7a5659, 0x3b7a67e1, 0x3b7a6859, 0x3b7a69d9, 0x3b7aa561, 0x3b7aa6e1, 0x3b7aa755,
+    0x3b7af651, 0x3b7af7d1, 0x3b7af851, 0x3b7b3025, 0x3b7b31a5, 0x3b7b4765, 0x3b7b48e5, 0x3b7b4965,
+    0x3b7b5b65, 0x3b7b5ce5, 0x3b7b6fe5, 0x3b7b7165, 0x3b7b71ea, 0x3b7b97a2, 0x3b7babe5, 0x3b7bdec5,
+    0x3b7be291, 0x3b7be411, 0x3b7be891, 0x3b7c0821, 0x3b7c09a1, 0x3b7c5911, 0x3b7c5a91, 0x3b7c7059,
+    0x3b7c71d9, 0x3b7c7659, 0x3b7cc161, 0x3b7cc2e1, 0x3b7cc355, 0x3b7cc761, 0x3b7cc7ea, 0x3b7cd7d1,
+    0x3b7cdc51, 0x3b7d1251, 0x3b7d13d1, 0x3b7d1851, 0x3b7d3961, 0x3b7d4c11, 0x3b7d4d91, 0x3b7d6355,
+    0x3b7d64d5, 0x3b7d6965, 0x3b7d8bd1, 0x3b7d8d51, 0x3b7d91e5, 0x3b7db2e1, 0x3b7dd9c9, 0x3b7ddb45,
+    0x3b7e031d, 0x3b7e1bdd, 0x3b7e2055, 0x3b7e21d5, 0x3b7e2255, 0x3b7e2ddd, 0x3b7e2f5d, 0x3b7e33d5,
+    0x3b7e3455, 0x3b7e445d, 0x3b7e48d1, 0x3b7e685d, 0x3b7e90dd, 0x3b7ea45d, 0x3b7ea4dd, 0x3b7ebddd,
+    0x3b7ec3d1, 0x3b7ee1dd, 0x3b7f231d, 0x3b7f27a5, 0x3b7f2925, 0x3b7f4b9d, 0x3b7f5025, 0x3b7f519d,
+    0x3b7f521d, 0x3b7f5f1d, 0x3b7f5f9d, 0x3b7f63a5, 0x3b7f6425, 0x3b7f659d, 0x3b7fc51d, 0x3b7fc9a6,
+    0x3b7fcba6, 0x3b7fd71d, 0x3b7fdda6, 0x3b7fff9d, 0x3b80011d, 0x3b80019d, 0x3b80131e, 0x3b80139e,
+    0x3b80151e, 0x3b80199e, 0x3b802ed1, 0x3b803051, 0x3b8058d5, 0x3b809419, 0x3b8095a5, 0x3b80bca6,
+    0x3b80be19, 0x3b80bea6, 0x3b80cdc9, 0x3b80d019, 0x3b80d0a6, 0x3b80d219, 0x3b810da5, 0x3b810f15,
+    0x3b810f95, 0x3b81872a, 0x3b8188a5, 0x3b81b1a6, 0x3b81c0e5, 0x3b81ea0a, 0x3b820226, 0x3b823ca5,
+    0x3b824ad1, 0x3b825cc9, 0x3b827049, 0x3b8271c5, 0x3b827355, 0x3b8274d5, 0x3b828549, 0x3b829e19,
+    0x3b82ac45, 0x3b82b019, 0x3b82b1a5, 0x3b82d899, 0x3b82da99, 0x3b82df26, 0x3b82e9d9, 0x3b82eb59,
+    0x3b82ec1a, 0x3b82ec9a, 0x3b82fec9, 0x3b831795, 0x3b831e15, 0x3b8325c5, 0x3b8329a5, 0x3b832b15,
+    0x3b834011, 0x3b836409, 0x3b838c89, 0x3b83a009, 0x3b83a089, 0x3b83a32a, 0x3b83a4a5, 0x3b83a92a,
+    0x3b83cd95, 0x3b83d226, 0x3b83dcd5, 0x3b83de55, 0x3b841ca5, 0x3b841e26, 0x3b846d9e, 0x3b846f1e,
+    0x3b8481dd, 0x3b8487d5, 0x3b8495dd, 0x3b84975d, 0x3b849bd5, 0x3b84f85d, 0x3b8549dd, 0x3b859129,
+    0x3b85b19d, 0x3b85b79d, 0x3b85c59d, 0x3b85c71d, 0x3b85cb9d, 0x3b862b1d, 0x3b862c9d, 0x3b863126,
+    0x3b864526, 0x3b86671d, 0x3b869411, 0x3b86ab55, 0x3b86acd5, 0x3b86ad56, 0x3b86bf55, 0x3b86c0d5,
+    0x3b86fc29, 0x3b86fda9, 0x3b870fd1, 0x3b871059, 0x3b8711d1, 0x3b8721c9, 0x3b872419, 0x3b873819,
+    0x3b874d51, 0x3b874ed1, 0x3b874f56, 0x3b877595, 0x3b877715, 0x3b87b4aa, 0x3b87d809, 0x3b87d985,
+    0x3b87db25, 0x3b87dca5, 0x3b87dd25, 0x3b87ef25, 0x3b87f0a5, 0x3b880365, 0x3b8804e5, 0x3b8814e5,
+    0x3b881665, 0x3b882a65, 0x3b8851a6, 0x3b885326, 0x3b8854a5, 0x3b885625, 0x3b8856aa, 0x3b8868aa,
+    0x3b886a2a, 0x3b8890a5, 0x3b8892a5, 0x3b88a4a5, 0x3b88b011, 0x3b88b191, 0x3b88c449, 0x3b88c5c5,
+    0x3b88c755, 0x3b88c8d5, 0x3b88cd55, 0x3b88d849, 0x3b88d9c5, 0x3b88db55, 0x3b88dcd5, 0x3b88e155,
+    0x3b890045, 0x3b890419, 0x3b890599, 0x3b891829, 0x3b8919a9, 0x3b892c51, 0x3b892dd1, 0x3b893251,
+    0x3b893dc9, 0x3b893f45, 0x3b894019, 0x3b896951, 0x3b896ad1, 0x3b896b51, 0x3b896f51, 0x3b896fea,
+    0x3b8979c5, 0x3b897d95, 0x3b897f15, 0x3b899195, 0x3b899315, 0x3b89b809, 0x3b89bca5, 0x3b89c125,
+    0x3b89cc29, 0x3b89d0aa, 0x3b89e151, 0x3b89f409, 0x3b89f585, 0x3b89f725, 0x3b89f8a5, 0x3b89f925,
+    0x3b89fd25, 0x3b89fda5, 0x3b8a0b25, 0x3b8a0ca5, 0x3b8a1125, 0x3b8a1f51, 0x3b8a20d1, 0x3b8a2565,
+    0x3b8a30c9, 0x3b8a3245, 0x3b8a5ad1, 0x3b8a6d89, 0x3b8a6f05, 0x3b8a70a5, 0x3b8a7225, 0x3b8a76a5,
+    0x3b8a84aa, 0x3b8a862a, 0x3b8a8aaa, 0x3b8aaca5, 0x3b8aad25, 0x3b8aaea5, 0x3b8ab325, 0x3b8ad39d,
+    0x3b8aec5d, 0x3b8af0d5, 0x3b8af255, 0x3b8afe62, 0x3b8affe2, 0x3b8b14dd, 0x3b8b1951, 0x3b8b8e5d,
+    0x3b8b9451, 0x3b8bb562, 0x3b8bf3a2, 0x3b8bf822, 0x3b8bf9a2, 0x3b8c1c1d, 0x3b8c20a1, 0x3b8c221d,
+    0x3b8c301d, 0x3b8c959d, 0x3b8c9a1d, 0x3b8cff51, 0x3b8d00d1, 0x3b8d64a2, 0x3b8d6622, 0x3b8d8d19,
+    0x3b8d8e99, 0x3b8dde22, 0x3b8ddfa2, 0x3b8e6805, 0x3b8e6bd1, 0x3b8e6d51, 0x3b8e9161, 0x3b8e92e1,
+    0x3b8ed121, 0x3b8ed2b6, 0x3b8ee249, 0x3b8ee3c5, 0x3b8ef9a1, 0x3b8efb21, 0x3b8efba1, 0x3b8f0d21,
+    0x3b8f0da1, 0x3b8f0f21, 0x3b8f1b51, 0x3b8f2d49, 0x3b8f49e1, 0x3b8f55c9, 0x3b8f6e99, 0x3b8f80a2,
+    0x3b8fcf49, 0x3b8fe815, 0x3b8ffa22, 0x3b8ffba2, 0x3b8ffc15, 0x3b901091, 0x3b904c91, 0x3b904d11,
+    0x3b9079a1, 0x3b90eeb6, 0x3b90f336, 0x3b911ba1, 0x3b91aa29, 0x3b91d2a9, 0x3b91d429, 0x3b91d4a9,
+    0x3b91e629, 0x3b91e6a9, 0x3b922529, 0x3b933a9e, 0x3b93499e, 0x3b934a1e, 0x3b934e1e, 0x3b939029,
+    0x3b9391a9, 0x3b94c169, 0x3b94c1e9, 0x3b94fcaa, 0x3b94fe2a, 0x3b953969, 0x3b9561e9, 0x3b956369,
+    0x3b9563e9, 0x3b95732a, 0x3b9574aa, 0x3b957569, 0x3b9575e9, 0x3b957769, 0x3b958169, 0x3b959a29,
+    0x3b95a869, 0x3b95ac29, 0x3b95ada9, 0x3b95c2a9, 0x3b95e6a9, 0x3b960f29, 0x3b9613aa, 0x3b96229a,
+    0x3b96231a, 0x3b96272a, 0x3b962baa, 0x3b963c29, 0x3b966029, 0x3b96a169, 0x3b96c9e9, 0x3b96cfe9,
+    0x3b96d069, 0x3b96dd69, 0x3b96dde9, 0x3b96e3e9, 0x3b971eaa, 0x3b974369, 0x3b9747e9, 0x3b975569,
+    0x3b977baa, 0x3b977de9, 0x3b977f69, 0x3b977fe9, 0x3b978469, 0x3b97a652, 0x3b97a7d2, 0x3b97b85d,
+    0x3b97cc5d, 0x3b97fe19, 0x3b980029, 0x3b981229, 0x3b98341d, 0x3b98359d, 0x3b98361d, 0x3b983a19,
+    0x3b98481d, 0x3b98499d, 0x3b984e19, 0x3b987795, 0x3b98871d, 0x3b988b95, 0x3b988d15, 0x3b98e81d,
+    0x3b98eb1d, 0x3b98fc1d, 0x3b99619d, 0x3b99e415, 0x3b99f815, 0x3b99f995, 0x3b9a32a9, 0x3b9aac09,
+    0x3b9aed69, 0x3b9b1005, 0x3b9b13e9, 0x3b9b1569, 0x3b9b15e9, 0x3b9b27e9, 0x3b9b2969, 0x3b9b3951,
+    0x3b9b3ad1, 0x3b9b5095, 0x3b9b5215, 0x3b9b5295, 0x3b9b6495, 0x3b9b6616, 0x3b9b7911, 0x3b9b7ab6,
+    0x3b9b8985, 0x3b9b8d69, 0x3b9b8ef5, 0x3b9b8f69, 0x3b9ba169, 0x3b9bb511, 0x3b9bb591, 0x3b9bb711,
+    0x3b9bc709, 0x3b9bc885, 0x3b9bc969, 0x3b9bdc85, 0x3b9bdd69, 0x3b9bfc45, 0x3b9c0015, 0x3b9c0195,
+    0x3b9c1415, 0x3b9c1595, 0x3b9c3a89, 0x3b9c4ea9, 0x3b9c7689, 0x3b9c9399, 0x3b9cb409, 0x3b9cc809,
+    0x3b9cf569, 0x3b9cf9e9, 0x3b9cfbe9, 0x3b9d0969, 0x3b9d2c05, 0x3b9d2fe9, 0x3b9d3169, 0x3b9d31e9,
+    0x3b9d35e9, 0x3b9d43e9, 0x3b9d4569, 0x3b9d49e9, 0x3b9d7295, 0x3b9d8696, 0x3b9d9b36, 0x3b9da585,
+    0x3b9da969, 0x3b9daaf5, 0x3b9dab69, 0x3b9dbd69, 0x3b9dd791, 0x3b9de569, 0x3ba03519, 0x3ba03699,
+    0x3ba04c59, 0x3ba04dd9, 0x3ba04e59, 0x3ba06059, 0x3ba061d9, 0x3ba0b0d9, 0x3ba0ea85, 0x3ba0ee51,
+    0x3ba0efd1, 0x3ba0f056, 0x3ba113e1, 0x3ba11561, 0x3ba153a1, 0x3ba15521, 0x3ba155aa, 0x3ba164c9,
+    0x3ba16645, 0x3ba17c35, 0x3ba17da1, 0x3ba17e35, 0x3ba18fa1, 0x3ba19035, 0x3ba191a1, 0x3ba25109,
+    0x3ba25285, 0x3ba26855, 0x3ba269d5, 0x3ba26e59, 0x3ba27be1, 0x3ba27dd5, 0x3ba2ccd1, 0x3ba2dec9,
+    0x3ba2e045, 0x3ba30a51, 0x3ba30bd1, 0x3ba31051, 0x3ba35da1, 0x3ba36221, 0x3ba36fa1, 0x3ba37121,
+    0x3ba371aa, 0x3ba375a1, 0x3ba39835, 0x3ba399a1, 0x3ba39e21, 0x3ba3aba1, 0x3ba3ada1, 0x3ba3b221,
+    0x3ba3bfd1, 0x3ba3d1c9, 0x3ba3d345, 0x3ba411a1, 0x3ba41321, 0x3ba42521, 0x3ba425aa, 0x3ba4272a,
+    0x3ba44da1, 0x3ba44fa1, 0x3ba49cdd, 0x3ba4ce9a, 0x3ba4d01a, 0x3ba4d09a, 0x3ba4dc1d, 0x3ba4dd9d,
+    0x3ba4e21a, 0x3ba4e29a, 0x3ba504b6, 0x3ba5061d, 0x3ba506b6, 0x3ba50a9a, 0x3ba50b1a, 0x3ba5181d,
+    0x3ba518b6, 0x3ba51a1d, 0x3ba54815, 0x3ba5559d, 0x3ba5579d, 0x3ba55b95, 0x3ba55c15, 0x3ba57091,
+    0x3ba57211, 0x3ba5901d, 0x3ba5b8b6, 0x3ba5cc1d, 0x3ba5ccb6, 0x3ba6321d, 0x3ba6c5d9, 0x3ba6c89a,
+    0x3ba6de9a, 0x3ba7031a, 0x3ba70719, 0x3ba74199, 0x3ba75691, 0x3ba77c89, 0x3ba77f15, 0x3ba78095,
+    0x3ba7bbe9, 0x3ba7bd69, 0x3ba7bde9, 0x3ba7e476, 0x3ba7e5e9, 0x3ba7e676, 0x3ba7f589, 0x3ba7f705,
+    0x3ba7f7e9, 0x3ba7f876, 0x3ba7f9e9, 0x3ba8e1c9, 0x3ba8e345, 0x3ba8e496, 0x3ba91f29, 0x3ba92199,
+    0x3ba92319, 0x3ba95d99, 0x3ba99889, 0x3ba99b15, 0x3ba99c95, 0x3ba9a115, 0x3ba9c5e9, 0x3ba9ca69,
+    0x3ba9cbe9, 0x3ba9cc69, 0x3ba9d7e9, 0x3ba9d969, 0x3ba9d9e9, 0x3ba9dde9, 0x3baa01e9, 0x3baa0276,
+    0x3baa0669, 0x3baa06f6, 0x3baa0869, 0x3baa1189, 0x3baa1305, 0x3baa13e9, 0x3baa1476, 0x3baa15e9,
+    0x3baa1a69, 0x3baa5095, 0x3baa79e9, 0x3baa7be9, 0x3baa8b09, 0x3baa8c85, 0x3baa8de9, 0x3baab7e9,
+    0x3bab361a, 0x3bab6c1d, 0x3bac201d, 0x3bac999d, 0x3bad0859, 0x3bad09d9, 0x3bad19d9, 0x3bad2f59,
+    0x3bad599a, 0x3bad5b1a, 0x3bad5b9a, 0x3bad6daa, 0x3bad6f2a, 0x3bad9599, 0x3bad9799, 0x3bada999,
+    0x3badbbd1, 0x3badbd51, 0x3badd316, 0x3badd496, 0x3badd516, 0x3bade72a, 0x3bade895, 0x3badfb92,
+    0x3badfd12, 0x3badfd92, 0x3bae2569, 0x3bae3791, 0x3bae3835, 0x3bae3991, 0x3bae4989, 0x3bae4b05,
+    0x3bae4be9, 0x3bae5f05, 0x3bae5fe9, 0x3baf23d1, 0x3baf2451, 0x3baf25d1, 0x3baf2a59, 0x3baf35c9,
+    0x3baf3745, 0x3baf7599, 0x3baf7719, 0x3baf7b99, 0x3baf89aa, 0x3baf8b2a, 0x3baf8faa, 0x3bafb199,
+    0x3bafb235, 0x3bafb399, 0x3bafb819, 0x3bafef15, 0x3baff095, 0x3baff115, 0x3baff515, 0x3bb0032a,
+    0x3bb00495, 0x3bb0092a, 0x3bb01791, 0x3bb01911, 0x3bb019aa, 0x3bb01d91, 0x3bb02be9, 0x3bb02d69,
+    0x3bb031e9, 0x3bb04169, 0x3bb05391, 0x3bb05591, 0x3bb05a11, 0x3bb06705, 0x3bb067e9, 0x3bb07b06,
+    0x3bb0a495, 0x3bb0a515, 0x3bb0a695, 0x3bb0cd11, 0x3bb0cdaa, 0x3bb0cf2a, 0x3bb0e085, 0x3bb0e169,
+    0x3bb0f486, 0x3bb3fea6, 0x3bb4c93a, 0x3bb4caa1, 0x3bb4cb21, 0x3bb4dee5, 0x3bb4df56, 0x3bb52c0a,
+    0x3bb56ca5, 0x3bb580a5, 0x3bb6aaa1, 0x3bb6af3a, 0x3bb6e53a, 0x3bb6e6a1, 0x3bb6e721, 0x3bb6eb3a,
+    0x3bb6ebba, 0x3bb6fad1, 0x3bb73b65, 0x3bb75125, 0x3bb75ea1, 0x3bb76021, 0x3bb78721, 0x3bb788a1,
+    0x3bb78921, 0x3bb78d25, 0x3bb81ba5, 0x3bb84426, 0x3bb845a5, 0x3bb84626, 0x3bb857a5, 0x3bb85826,
+    0x3bb896a5, 0x3bba01a5, 0x3bba0325, 0x3bba78a6, 0x3bbb32e5, 0x3bbb3365, 0x3bbbaae6, 0x3bbbac66,
+    0x3bbbd4e6, 0x3bbbd566, 0x3bbbe6e6, 0x3bbbe8e6, 0x3bbbf2e5, 0x3bbc0ba5, 0x3bbc19e5, 0x3bbc1da5,
+    0x3bbc1f25, 0x3bbc3425, 0x3bbc5825, 0x3bbc80a5, 0x3bbc941a, 0x3bbc949a, 0x3bbcada5, 0x3bbcd1a5,
+    0x3bbd12e5, 0x3bbd3b65, 0x3bbd4165, 0x3bbd41e5, 0x3bbd4ee5, 0x3bbd4f65, 0x3bbd5565, 0x3bbdb4e5,
+    0x3bbdc6e5, 0x3bbdcce6, 0x3bbdef65, 0x3bbdf0e5, 0x3bbdf165, 0x3bbdf5e6, 0x3bbe29dd, 0x3bbe7119,
+    0x3bbea59d, 0x3bbea71d, 0x3bbeab99, 0x3bbeb99d, 0x3bbebb1d, 0x3bbebf9a, 0x3bbeea95, 0x3bbefe95,
+    0x3bbf599d, 0x3bbf6d9d, 0x3bbfd31d, 0x3bc0231e, 0x3bc05715, 0x3bc06995, 0x3bc06b15, 0x3bc18185,
+    0x3bc18579, 0x3bc186e5, 0x3bc19979, 0x3bc19ae5, 0x3bc1c3a5, 0x3bc1d796, 0x3bc1fb26, 0x3bc1fee6,
+    0x3bc20066, 0x3bc228a5, 0x3bc23ae6, 0x3bc24ee6, 0x3bc26dc5, 0x3bc27195, 0x3bc27315, 0x3bc28595,
+    0x3bc28715, 0x3bc2ac09, 0x3bc2e809, 0x3bc2fc1a, 0x3bc2fd9a, 0x3bc32589, 0x3bc33995, 0x3bc34296,
+    0x3bc366e5, 0x3bc36ce5, 0x3bc38f11, 0x3bc393ba, 0x3bc39d85, 0x3bc3a179, 0x3bc3a2e5, 0x3bc3a779,
+    0x3bc3b579, 0x3bc3b6e5, 0x3bc3bb79, 0x3bc3ced6, 0x3bc3df95, 0x3bc40811, 0x3bc41705, 0x3bc41ae5,
+    0x3bc41c65, 0x3bc42025, 0x3bc456e5, 0x3bc45ca5, 0x3bc4ec22, 0x3bc514a1, 0x3bc51621, 0x3bc56122,
+    0x3bc56722, 0x3bc6d222, 0x3bc6d3a2, 0x3bc74921, 0x3bc803e1, 0x3bc816e2, 0x3bc84022, 0x3bc87b62,
+    0x3bc87ce2, 0x3bc89122, 0x3bc891a2, 0x3bc8a3e1, 0x3bc8a561, 0x3bc8b762, 0x3bc8b7e1, 0x3bc8c361,
+    0x3bc8dc21, 0x3bc8ee22, 0x3bc904a1, 0x3bc97e21, 0x3bc9e362, 0x3bc9f7a2, 0x3bca0be1, 0x3bca11e1,
+    0x3bca1f62, 0x3bca1fe1, 0x3bca3762, 0x3bca75a2, 0x3bca8561, 0x3bca89e1, 0x3bca9ca2, 0x3bca9d62,
+    0x3bcac522, 0x3bd14e52, 0x3bd1671d, 0x3bd16b95, 0x3bd16d15, 0x3bd16d95, 0x3bd17f95, 0x3bd18f92,
+    0x3bd19412, 0x3bd1f01d, 0x3bd20912, 0x3bd20f12, 0x3bd296dd, 0x3bd29b79, 0x3bd29cdd, 0x3bd29d5d,
+    0x3bd2aadd, 0x3bd2af79, 0x3bd2b0dd, 0x3bd3105d, 0x3bd314dd, 0x3bd31675, 0x3bd34add, 0x3bd34c5d,
+    0x3bd34cdd, 0x3bd350dd, 0x3bd35ede, 0x3bd3605e, 0x3bd364de, 0x3bd37a12, 0x3bd37b92, 0x3bd3a015,
+    0x3bd407d9, 0x3bd40959, 0x3bd409d9, 0x3bd41bd9, 0x3bd41d59, 0x3bd45ad5, 0x3bd4bbca, 0x3bd4cfc9,
+    0x3bd4d475, 0x3bd4e811, 0x3bd5354a, 0x3bd57475, 0x3bd575f5, 0x3bd57675, 0x3bd58549, 0x3bd58875,
+    0x3bd589f5, 0x3bd59612, 0x3bd5a809, 0x3bd5bc15, 0x3bd5d092, 0x3bd5e959, 0x3bd623d9, 0x3bd62559,
+    0x3bd625d9, 0x3bd637da, 0x3bd6395a, 0x3bd64a12, 0x3bd662d5, 0x3bd676d5, 0x3bd68b52, 0x3bd6c752,
+    0x3bd6c7d1, 0x3bd6d7c9, 0x3bd6dac5, 0x3bd6ebc9, 0x3bd6f075, 0x3bd74491, 0x3bd75149, 0x3bd75a75,
+    0x3bd79075, 0x3bd791f5, 0x3bd79275, 0x3bd79675, 0x3bd796f5, 0x3bdb2676, 0x3bdcdf16, 0x3bdce396,
+    0x3bdcf391, 0x3bdd1fe2, 0x3bdd2f91, 0x3bdd8095, 0x3bdda911, 0x3bde1edd, 0x3bde379d, 0x3bde3c1a,
+    0x3bde3d9a, 0x3bde3e1a, 0x3bde499d, 0x3bde4b1d, 0x3bde4f9a, 0x3bde501a, 0x3bde601d, 0x3bde649a,
+    0x3bde661a, 0x3bde841d, 0x3bdeacb6, 0x3bdec01d, 0x3bdec0b6, 0x3bded99d, 0x3bdedf91, 0x3bdefd9d,
+    0x3bdf3edd, 0x3bdf4379, 0x3bdf44dd, 0x3bdf6776, 0x3bdf6bf6, 0x3bdf6d5d, 0x3bdf6df6, 0x3bdf7add,
+    0x3bdf7b76, 0x3bdf7f79, 0x3bdf7ff6, 0x3bdf815d, 0x3bdfe0dd, 0x3bdff2dd, 0x3bdff45d, 0x3be01b76,
+    0x3be01cdd, 0x3be01d76, 0x3be02ede, 0x3be030de, 0x3be04a9a, 0x3be04c1a, 0x3be0709a, 0x3be0afda,
+    0x3be0b15a, 0x3be0d85a, 0x3be0d9da, 0x3be0da5a, 0x3be0ebda, 0x3be0ec5a, 0x3be0edda, 0x3be12979,
+    0x3be12ad5, 0x3be12b55, 0x3be163ca, 0x3be1a076, 0x3be1a2fa, 0x3be1a475, 0x3be1a4f5, 0x3be26691,
+    0x3be27889, 0x3be28c09, 0x3be28c96, 0x3be28d85, 0x3be2a109, 0x3be2b9d9, 0x3be2c805, 0x3be2cbd9,
+    0x3be2cd59, 0x3be2d1da, 0x3be2f476, 0x3be2f5d9, 0x3be2f676, 0x3be2fada, 0x3be307da, 0x3be3085a,
+    0x3be309da, 0x3be31a89, 0x3be33355, 0x3be339d5, 0x3be34185, 0x3be34579, 0x3be346d5, 0x3be34755,
+    0x3be35bd1, 0x3be37fc9, 0x3be38475, 0x3be3a876, 0x3be3bbc9, 0x3be3bc76, 0x3be3befa, 0x3be3c075,
+    0x3be3c0f5, 0x3be3c4fa, 0x3be3e955, 0x3be421c9, 0x3be43875, 0x3be439f5, 0x3be460f5, 0x3be46275,
+    0x3be462f5, 0x3be5cedd, 0x3be5e2dd, 0x3be646dd, 0x3be6485d, 0x3be682dd, 0x3be7693a, 0x3be7f875,
+    0x3be80afa, 0x3be80c75, 0x3be95bd9, 0x3be98716, 0x3be98b96, 0x3be9d875, 0x3be9dcfa, 0x3bea0fc9,
+    0x3bea1475, 0x3bea14f5, 0x3bea18fa, 0x3bea26fa, 0x3bea2875, 0x3bea2cfa, 0x3bea3c96, 0x3bea8949,
+    0x3bea8c75, 0x3bea8df5, 0x3beac875, 0x3beaca75, 0x3bed1809, 0x3bed1985, 0x3bed2f55, 0x3bed30d9,
+    0x3bed3159, 0x3bed42e1, 0x3bed4355, 0x3bed44d9, 0x3bed93d1, 0x3bedd151, 0x3bedd2d1, 0x3bedd351,
+    0x3bee36a1, 0x3bee3821, 0x3bee38a1, 0x3bee5f21, 0x3bee60a1, 0x3bee6121, 0x3bee72a1, 0x3bee7321,
+    0x3bee74a1, 0x3bee86e5, 0x3beed8a5, 0x3beeeca5, 0x3bef14a5, 0x3bef28a5, 0x3bef3409, 0x3bef3585,
+    0x3bef4b55, 0x3bef4cd5, 0x3bef5155, 0x3bef5ee1, 0x3bef5f55, 0x3bef6555, 0x3befafd1, 0x3befc1c9,
+    0x3befc345, 0x3befed51, 0x3befeed1, 0x3beff351, 0x3bf040a1, 0x3bf04521, 0x3bf052a1, 0x3bf05421,
+    0x3bf054a1, 0x3bf058a1, 0x3bf05921, 0x3bf07b21, 0x3bf07ca1, 0x3bf08121, 0x3bf08ea1, 0x3bf08f21,
+    0x3bf090a1, 0x3bf09521, 0x3bf0a2d1, 0x3bf0b4c9, 0x3bf0b645, 0x3bf0f4a1, 0x3bf0f639, 0x3bf0faa5,
+    0x3bf10821, 0x3bf108a1, 0x3bf10ea5, 0x3bf130a1, 0x3bf13121, 0x3bf1b39a, 0x3bf3a8c9, 0x3bf3ea19,
+    0x3bf42499, 0x3bf46215, 0x3bf46395, 0x3bf4a0e5, 0x3bf4c965, 0x3bf517a5, 0x3bf542e6, 0x3bf5c4c9,
+    0x3bf5c645, 0x3bf60499, 0x3bf60619, 0x3bf64099, 0x3bf67e15, 0x3bf67f95, 0x3bf68415, 0x3bf6af65,
+    0x3bf6e9e5, 0x3bf6eb65, 0x3bf6f489, 0x3bf6f605, 0x3bf73395, 0x3bf75efa, 0x3bf76366, 0x3bf76e09,
+    0x3bf76f85, 0x3bf8271d, 0x3bf8289d, 0x3bf82d19, 0x3bf8db1d, 0x3bf9ead1, 0x3bf9eb51, 0x3bf9ecd9,
+    0x3bf9fcc9, 0x3bfa3c9a, 0x3bfa3e1a, 0x3bfa3e9a, 0x3bfa4d89, 0x3bfa4f05, 0x3bfa5099, 0x3bfa5219,
+    0x3bfa7899, 0x3bfa7919, 0x3bfa7a99, 0x3bfa8c99, 0x3bfab616, 0x3bfab796, 0x3bfab816, 0x3bfaca15,
+    0x3bfacb95, 0x3bfade92, 0x3bfae012, 0x3bfae092, 0x3bfb0305, 0x3bfb06e5, 0x3bfb0865, 0x3bfb1a91,
+    0x3bfb1b11, 0x3bfb1c91, 0x3bfb6ba5, 0x3bfb6c25, 0x3bfb7fa5, 0x3bfb94a5, 0x3bfbbc66, 0x3bfbd0a5,
+    0x3bfc06d1, 0x3bfc0751, 0x3bfc08d1, 0x3bfc0d51, 0x3bfc18c9, 0x3bfc1a45, 0x3bfc5899, 0x3bfc5a19,
+    0x3bfc5e99, 0x3bfc6989, 0x3bfc6b05, 0x3bfc6c99, 0x3bfc6e19, 0x3bfc7299, 0x3bfc9499, 0x3bfc9519,
+    0x3bfc9699, 0x3bfc9b19, 0x3bfcd215, 0x3bfcd395, 0x3bfcd415, 0x3bfcd815, 0x3bfce615, 0x3bfce795,
+    0x3bfcec15, 0x3bfcfa91, 0x3bfcfc11, 0x3bfcfc91, 0x3bfd0091, 0x3bfd0111, 0x3bfd22e5, 0x3bfd2465,
+    0x3bfd28e5, 0x3bfd3691, 0x3bfd3711, 0x3bfd3891, 0x3bfd3d11, 0x3bfd4a05, 0x3bfd5e06, 0x3bfd8795,
+    0x3bfd8815, 0x3bfd89b9, 0x3bfd8e25, 0x3bfdb011, 0x3bfdb091, 0x3bfdb6a5, 0x3bfdc385, 0x3bfdd786,
+    0x3c01bd49, 0x3c01bec5, 0x3c01d495, 0x3c01d639, 0x3c01d6b9, 0x3c01e821, 0x3c01e895, 0x3c01ea39,
+    0x3c01fd11, 0x3c01feb6, 0x3c023911, 0x3c032811, 0x3c037961, 0x3c038b62, 0x3c038d61, 0x3c03b3e1,
+    0x3c03c7e1, 0x3c03f695, 0x3c041f36, 0x3c04905d, 0x3c04a91d, 0x3c04ad95, 0x3c04af15, 0x3c04af95,
+    0x3c04bb1d, 0x3c04bc9d, 0x3c04bd1d, 0x3c04c115, 0x3c04c195, 0x3c04d19d, 0x3c04d611, 0x3c04f59d,
+    0x3c051e1d, 0x3c05229e, 0x3c05319d, 0x3c05321d, 0x3c05361e, 0x3c054b1d, 0x3c054f91, 0x3c055111,
+    0x3c056f1d, 0x3c05721d, 0x3c05b05d, 0x3c05b4dd, 0x3c05b675, 0x3c05b6dd, 0x3c05d8dd, 0x3c05dd5d,
+    0x3c05dedd, 0x3c05df5d, 0x3c05eadd, 0x3c05ec5d, 0x3c05ecdd, 0x3c05f0dd, 0x3c05f15d, 0x3c05f2dd,
+    0x3c06527a, 0x3c0656dd, 0x3c0658fa, 0x3c06645d, 0x3c06667a, 0x3c066add, 0x3c068a9e, 0x3c068cdd,
+    0x3c068e7a, 0x3c068efa, 0x3c06935d, 0x3c06a0de, 0x3c06a25e, 0x3c06bc11, 0x3c06bd91, 0x3c072159,
+    0x3c0722f5, 0x3c072359, 0x3c0749d9, 0x3c074b59, 0x3c074bd9, 0x3c075d59, 0x3c075dd9, 0x3c075f59,
+    0x3c079ad5, 0x3c079c55, 0x3c079cd5, 0x3c07d54a, 0x3c0811c9, 0x3c0815f5, 0x3c083efa, 0x3c084e09,
+    0x3c084f85, 0x3c088df5, 0x3c088f76, 0x3c08b675, 0x3c08b7f9, 0x3c08b879, 0x3c08c9f5, 0x3c08ca75,
+    0x3c08cbf9, 0x3c08d811, 0x3c08ea09, 0x3c08fd89, 0x3c08ff05, 0x3c090695, 0x3c091289, 0x3c092b59,
+    0x3c0931d9, 0x3c093985, 0x3c093d59, 0x3c093ef5, 0x3c093f59, 0x3c0965d9, 0x3c0967d9, 0x3c096c59,
+    0x3c09795a, 0x3c0979da, 0x3c098c09, 0x3c098f05, 0x3c09a4d5, 0x3c09ab55, 0x3c09b305, 0x3c09b6d5,
+    0x3c09b855, 0x3c09b8d5, 0x3c09cd51, 0x3c09f149, 0x3c09f445, 0x3c0a0951, 0x3c0a09d1, 0x3c0a19c9,
+    0x3c0a2d49, 0x3c0a2dc9, 0x3c0a31f5, 0x3c0a3675, 0x3c0a5afa, 0x3c0a5f55, 0x3c0aa9f5, 0x3c0aab76,
+    0x3c0aaff6, 0x3c0ad875, 0x3c0b5d9d, 0x3c0c0add, 0x3c0c185d, 0x3c0c1cdd, 0x3c0c1e75, 0x3c0cba7a,
+    0x3c0cd275, 0x3c0d7759, 0x3c0d8585, 0x3c0d8959, 0x3c0d8af5, 0x3c0e3d49, 0x3c0e41f5, 0x3c0e6875,
+    0x3c0e69f5, 0x3c0e6a75, 0x3c0e7c75, 0x3c0e7df5, 0x3c0e9011, 0x3c0e9091, 0x3c0e9239, 0x3c0ea209,
+    0x3c0ea385, 0x3c0eb785, 0x3c0ee1f5, 0x3c0ee376, 0x3c0ee3f9, 0x3c0ef5f5, 0x3c0ef776, 0x3c0f1df5,
+    0x3c0f1e75, 0x3c0f1ff9, 0x3c0f31f5, 0x3c0f6e95, 0x3c0fa559, 0x3c0fa6f5, 0x3c0fab75, 0x3c1049f5,
+    0x3c104e75, 0x3c105949, 0x3c105df5, 0x3c106275, 0x3c108475, 0x3c1085f5, 0x3c108675, 0x3c108a75,
+    0x3c108af5, 0x3c109875, 0x3c1099f5, 0x3c109e75, 0x3c10b291, 0x3c10fdf5, 0x3c10ff76, 0x3c1103f6,
+    0x3c1111f5, 0x3c1117f6, 0x3c1139f5, 0x3c113a75, 0x3c113bf9, 0x3c114075, 0x3c138bd9, 0x3c13dd9a,
+    0x3c13f199, 0x3c141999, 0x3c142d99, 0x3c143fc9, 0x3c144145, 0x3c145716, 0x3c145896, 0x3c145916,
+    0x3c146aa1, 0x3c146b15, 0x3c146c95, 0x3c147f92, 0x3c148112, 0x3c148192, 0x3c14bb91, 0x3c15a7d1,
+    0x3c15f999, 0x3c15fb19, 0x3c15ff99, 0x3c160d99, 0x3c160f19, 0x3c161399, 0x3c163599, 0x3c167315,
+    0x3c167495, 0x3c167915, 0x3c1686a1, 0x3c168715, 0x3c168895, 0x3c168d15, 0x3c169b91, 0x3c169d11,
+    0x3c16a191, 0x3c16d791, 0x3c172895, 0x3c175111, 0x3c177886, 0x3c182e1d, 0x3c18db5d, 0x3c18e8dd,
+    0x3c18ed5d, 0x3c198afa, 0x3c1a1c99, 0x3c1a47da, 0x3c1a59da, 0x3c1ad089, 0x3c1ad205, 0x3c1b0dc9,
+    0x3c1b1075, 0x3c1b11f5, 0x3c1b1275, 0x3c1b38f5, 0x3c1b3a75, 0x3c1b3af5, 0x3c1b4c75, 0x3c1b4cf5,
+    0x3c1b4e75, 0x3c1c3895, 0x3c1c75d9, 0x3c1d1a75, 0x3c1d1ef5, 0x3c1d29c9, 0x3c1d2c75, 0x3c1d2df5,
+    0x3c1d2e75, 0x3c1d3275, 0x3c1d32f5, 0x3c1d54f5, 0x3c1d5675, 0x3c1d5af5, 0x3c1d6875, 0x3c1d68f5,
+    0x3c1d6a75, 0x3c1d6ef5, 0x3c1dce75, 0x3c1dcff9, 0x3c1de1f5, 0x3c1de275, 0x3c1e0a75, 0x3c1e0af5,
+    0x3c1e0c79, 0x3c1e32de, 0x3c1e335e, 0x3c1e34de, 0x3c1ec09e, 0x3c1ec11e, 0x3c1ec29e, 0x3c1f4edd,
+    0x3c1f505d, 0x3c1fb39e, 0x3c1fb41e, 0x3c1fb59e, 0x3c207099, 0x3c207119, 0x3c208499, 0x3c20c15a,
+    0x3c20d599, 0x3c211291, 0x3c211311, 0x3c211491, 0x3c212496, 0x3c212616, 0x3c213a05, 0x3c217549,
+    0x3c2176c5, 0x3c217875, 0x3c2179f5, 0x3c21a075, 0x3c21a0f5, 0x3c21a275, 0x3c21b475, 0x3c228c95,
+    0x3c228d15, 0x3c228e95, 0x3c229319, 0x3c232e91, 0x3c232f11, 0x3c233091, 0x3c233511, 0x3c238075,
+    0x3c2381f5, 0x3c238275, 0x3c238675, 0x3c2386f5, 0x3c239475, 0x3c2395f5, 0x3c239a75, 0x3c23bc75,
+    0x3c23bcf5, 0x3c23be75, 0x3c23c2f5, 0x3c242086, 0x3c2435f5, 0x3c243675, 0x3c2437f9, 0x3c249a45,
+    0x3c24b015, 0x3c24b195, 0x3c24c3a1, 0x3c24c415, 0x3c24c595, 0x3c251491, 0x3c252805, 0x3c260791,
+    0x3c261b05, 0x3c26595d, 0x3c265add, 0x3c266d6a, 0x3c266eea, 0x3c26955d, 0x3c26be91, 0x3c26c011,
+    0x3c26c491, 0x3c26e5a1, 0x3c272a6a, 0x3c273685, 0x3c274c59, 0x3c274dd9, 0x3c275259, 0x3c275fe1,
+    0x3c276059, 0x3c2761d9, 0x3c276659, 0x3c278fd6, 0x3c279d61, 0x3c279ee1, 0x3c279f55, 0x3c27a361,
+    0x3c27a3ea, 0x3c27b3d2, 0x3c27b852, 0x3c27ee51, 0x3c27efd1, 0x3c27f451, 0x3c282985, 0x3c283f55,
+    0x3c2840d5, 0x3c284565, 0x3c2852e1, 0x3c285355, 0x3c2854d5, 0x3c285965, 0x3c2867d1, 0x3c286951,
+    0x3c286de5, 0x3c28a3d1, 0x3c28e091, 0x3c28f289, 0x3c293259, 0x3c2933d9, 0x3c29466a, 0x3c2947ea,
+    0x3c296e59, 0x3c2974d9, 0x3c29abd5, 0x3c29ad55, 0x3c29bf61, 0x3c29bfea, 0x3c29c155, 0x3c29c5ea,
+    0x3c29d5d1, 0x3c2a1051, 0x3c2a6155, 0x3c2a67e5, 0x3c2a89d1, 0x3c2ab146, 0x3c2b1609, 0x3c2b1905,
+    0x3c2b2055, 0x3c2b2989, 0x3c2b2b05, 0x3c2b5759, 0x3c2b5c69, 0x3c2b6959, 0x3c2b6ad9, 0x3c2b91d9,
+    0x3c2b9359, 0x3c2ba559, 0x3c2ba5d9, 0x3c2ba759, 0x3c2bd5d5, 0x3c2c501d, 0x3c2c84d5, 0x3c2c8655,
+    0x3c2c9855, 0x3c2c98d5, 0x3c2c9a55, 0x3c2cbf49, 0x3c2cc826, 0x3c2cc9a6, 0x3c2cd2c9, 0x3c2cfb49,
+    0x3c2cfcc5, 0x3c2d26d1, 0x3c2d38c9, 0x3c2d4255, 0x3c2d4c49, 0x3c2d4dc5, 0x3c2d4f55, 0x3c2d5555,
+    0x3c2d6149, 0x3c2d7a19, 0x3c2d8c19, 0x3c2d8d99, 0x3c2d8e29, 0x3c2db499, 0x3c2dbc99, 0x3c2dc745,
+    0x3c2dc819, 0x3c2dc899, 0x3c2ddac9, 0x3c2df395, 0x3c2e0595, 0x3c2e0715, 0x3c2e0795, 0x3c2e1c11,
+    0x3c2e4009, 0x3c2e4925, 0x3c2e6889, 0x3c2e71a5, 0x3c2e7205, 0x3c2e7c09, 0x3c2e7c89, 0x3c2e7f25,
+    0x3c2e80a5, 0x3c2e8525, 0x3c2e85a5, 0x3c2eae26, 0x3c2eafa6, 0x3c2eba45, 0x3c2eeba6, 0x3c2ef8a5,
+    0x3c2efea5, 0x3c2f34a5, 0x3c2f3525, 0x3c2f36a5, 0x3c2f4689, 0x3c2f5dd5, 0x3c2f5f55, 0x3c2f65d5,
+    0x3c2f7155, 0x3c2f77d5, 0x3c2f9ca9, 0x3c2fc251, 0x3c2fd449, 0x3c2fdac9, 0x3c2fdd19, 0x3c301615,
+    0x3c301c15, 0x3c305325, 0x3c305829, 0x3c306525, 0x3c3066a5, 0x3c308da5, 0x3c308f25, 0x3c309109,
+    0x3c30a125, 0x3c30a1a5, 0x3c30a325, 0x3c30a7a5, 0x3c30b551, 0x3c30c749, 0x3c30ca15, 0x3c30cde5,
+    0x3c30d026, 0x3c310725, 0x3c3108a5, 0x3c310c26, 0x3c310daa, 0x3c310f2a, 0x3c311aa5, 0x3c311b2a,
+    0x3c311caa, 0x3c31212a, 0x3c314325, 0x3c3149a5, 0x3c316b91, 0x3c316c11, 0x3c316d91, 0x3c317f05,
+    0x3c31bd59, 0x3c31bed9, 0x3c31d16a, 0x3c31d2ea, 0x3c31f959, 0x3c31f9e5, 0x3c31fb59, 0x3c32ec55,
+    0x3c32ecd5, 0x3c32ee65, 0x3c338d91, 0x3c33a049, 0x3c33a1c5, 0x3c33a355, 0x3c33a4d5, 0x3c33a955,
+    0x3c33a9d6, 0x3c33b449, 0x3c33b5c5, 0x3c33b755, 0x3c33b8d5, 0x3c33bd55, 0x3c33e019, 0x3c33e199,
+    0x3c33f429, 0x3c33f5a9, 0x3c33fa29, 0x3c3407d1, 0x3c3409d1, 0x3c340e59, 0x3c341b45, 0x3c341c19,
+    0x3c344551, 0x3c3446d1, 0x3c344756, 0x3c344b51, 0x3c344bd6, 0x3c345995, 0x3c345b15, 0x3c346d95,
+    0x3c346f15, 0x3c347395, 0x3c34a829, 0x3c34acaa, 0x3c34b12a, 0x3c34d009, 0x3c34d185, 0x3c34d325,
+    0x3c34d4a5, 0x3c34d925, 0x3c34d9a5, 0x3c34e409, 0x3c34e725, 0x3c34e8a5, 0x3c34ed25, 0x3c34fad1,
+    0x3c34fb51, 0x3c350e45, 0x3c354989, 0x3c354b05, 0x3c354ca5, 0x3c354e25, 0x3c354eaa, 0x3c3552a5,
+    0x3c35532a, 0x3c3560aa, 0x3c35622a, 0x3c3566aa, 0x3c3588a5, 0x3c358925, 0x3c358aa5, 0x3c35c555,
+    0x3c35c5d5, 0x3c35c755, 0x3c35cbd5, 0x3c366751, 0x3c3667ea, 0x3c366951, 0x3c366dea, 0x3c36b925,
+    0x3c36baa5, 0x3c36bfaa, 0x3c36c12a, 0x3c36ceaa, 0x3c36d32a, 0x3c36f525, 0x3c36f5a5, 0x3c36f725,
+    0x3c36fba5, 0x3c376ea5, 0x3c376f2a, 0x3c3770aa, 0x3c37752a, 0x3c388cd1, 0x3c38f229, 0x3c39f751,
+    0x3c3a0949, 0x3c3a31c9, 0x3c3a4a99, 0x3c3a5ca2, 0x3c3aab49, 0x3c3ac415, 0x3c3ad622, 0x3c3ad815,
+    0x3c3aec91, 0x3c3b69d1, 0x3c3bcf36, 0x3c3bf7a1, 0x3c3c0ba1, 0x3c3ce495, 0x3c3ce615, 0x3c3ce695,
+    0x3c3cf895, 0x3c3cfa15, 0x3c3d0d11, 0x3c3d0f29, 0x3c3d2205, 0x3c3d3736, 0x3c3d4911, 0x3c3d4991,
+    0x3c3e1a21, 0x3c3e5845, 0x3c3e96a9, 0x3c3ec849, 0x3c3ed299, 0x3c3edbc9, 0x3c3f1015, 0x3c3f1d95,
+    0x3c3f8805, 0x3c3fc415, 0x3c3fc595, 0x3c3ffc9d, 0x3c400e9d, 0x3c401036, 0x3c40371d, 0x3c40389d,
+    0x3c404a9d, 0x3c405d49, 0x3c407615, 0x3c407c95, 0x3c408815, 0x3c408995, 0x3c408a15, 0x3c409e91,
+    0x3c40c289, 0x3c40eb09, 0x3c40f485, 0x3c40fe89, 0x3c40ff09, 0x3c411811, 0x3c413c09, 0x3c417d69,
+    0x3c41a5e9, 0x3c41ac69, 0x3c41b7e9, 0x3c41b969, 0x3c41b9e9, 0x3c41e785, 0x3c41fa95, 0x3c421f69,
+    0x3c4225e9, 0x3c423169, 0x3c4232f5, 0x3c4259e9, 0x3c425b69, 0x3c425be9, 0x3c426069, 0x3c4261e9,
+    0x3c426b09, 0x3c426d69, 0x3c426de9, 0x3c426f69, 0x3c429895, 0x3c429d15, 0x3c42d7a9, 0x3c431019,
+    0x3c431389, 0x3c432399, 0x3c433891, 0x3c433a11, 0x3c433a91, 0x3c434d85, 0x3c435109, 0x3c435405,
+    0x3c436185, 0x3c437605, 0x3c438be9, 0x3c439269, 0x3c439de9, 0x3c439f75, 0x3c439fe9, 0x3c43c669,
+    0x3c43c7e9, 0x3c43c869, 0x3c43cce9, 0x3c43ce69, 0x3c43d789, 0x3c43d9e9, 0x3c43da69, 0x3c43dbe9,
+    0x3c440805, 0x3c440b16, 0x3c4441e9, 0x3c444669, 0x3c447c69, 0x3c447de9, 0x3c448009, 0x3c448269,
+    0x3c46629d, 0x3c466436, 0x3c469e9d, 0x3c469f1d, 0x3c46a09d, 0x3c46dc15, 0x3c46dd95, 0x3c46f015,
+    0x3c46f195, 0x3c46f615, 0x3c471699, 0x3c472aa9, 0x3c475289, 0x3c479015, 0x3c47a409, 0x3c47e569,
+    0x3c480be9, 0x3c480d69, 0x3c480de9, 0x3c481fe9, 0x3c482169, 0x3c4825e9, 0x3c484e95, 0x3c484f15,
+    0x3c486296, 0x3c487736, 0x3c488569, 0x3c4886f5, 0x3c48b391, 0x3c48c169, 0x3c497819, 0x3c49df36,
+    0x3c49f1e9, 0x3c49f3e9, 0x3c4a2de9, 0x3c4a2e69, 0x3c4a2fe9, 0x3c4a6c96, 0x3c4a7116, 0x3c4b0c91,
+    0x3c4b2005, 0x3c4b5e59, 0x3c4b5fd9, 0x3c4b726a, 0x3c4b73ea, 0x3c4b9a59, 0x3c4c8d55, 0x3c4d2e91,
+    0x3c4d4455, 0x3c4d45d5, 0x3c4d4a59, 0x3c4d5855, 0x3c4d59d5, 0x3c4d5e59, 0x3c4da8d1, 0x3c4dbc45,
+    0x3c4de651, 0x3c4de7d1, 0x3c4dec51, 0x3c4e4daa, 0x3c4e7435, 0x3c4e75a1, 0x3c4e7a21, 0x3c4e8835,
+    0x3c4e89a1, 0x3c4e8e21, 0x3c4e9bd1, 0x3c4eaf45, 0x3c4eeda1, 0x3c4eef21, 0x3c4f01aa, 0x3c4f032a,
+    0x3c4f29a1, 0x3c4f6655, 0x3c4f6cd9, 0x3c500851, 0x3c505a21, 0x3c505ba1, 0x3c5060aa, 0x3c50622a,
+    0x3c506faa, 0x3c50742a, 0x3c509621, 0x3c509ca1, 0x3c510fa1, 0x3c5189d5, 0x3c518b55, 0x3c519d55,
+    0x3c519dd5, 0x3c519f55, 0x3c51c449, 0x3c51d7c9, 0x3c520049, 0x3c5201c5, 0x3c527f1e, 0x3c52911d,
+    0x3c52929d, 0x3c52b9b5, 0x3c52bb1d, 0x3c52cd1d, 0x3c52cdb5, 0x3c52cf1d, 0x3c52f349, 0x3c52f4c5,
+    0x3c53331d, 0x3c53349d, 0x3c53469d, 0x3c53472a, 0x3c5348aa, 0x3c536f1d, 0x3c53bf45, 0x3c53c095,
+    0x3c53eb9a, 0x3c53fb29, 0x3c53fd99, 0x3c540399, 0x3c543999, 0x3c547489, 0x3c547715, 0x3c547895,
+    0x3c547d15, 0x3c54b3e9, 0x3c54b569, 0x3c54b5e9, 0x3c54dde9, 0x3c54e469, 0x3c54efe9, 0x3c54f076,
+    0x3c54f1e9, 0x3c552c95, 0x3c5555e9, 0x3c55ba51, 0x3c55cc49, 0x3c55d2d9, 0x3c560c19, 0x3c560d99,
+    0x3c5612aa, 0x3c56142a, 0x3c561f99, 0x3c56202a, 0x3c5621aa, 0x3c56262a, 0x3c564819, 0x3c564e99,
+    0x3c568605, 0x3c568d95, 0x3c569915, 0x3c569faa, 0x3c56c469, 0x3c570069, 0x3c570289, 0x3c573b15,
+    0x3c577869, 0x3c57f169, 0x3c57f1e9, 0x3c57f369, 0x3c58e51e, 0x3c58e69e, 0x3c592129, 0x3c592329,
+    0x3c599aa9, 0x3c599b2a, 0x3c5a1369, 0x3c5a519a, 0x3c5a531a, 0x3c5a579a, 0x3c5a581a, 0x3c5a65aa,
+    0x3c5a672a, 0x3c5a6baa, 0x3c5a8da9, 0x3c5a8fa9, 0x3c5acb16, 0x3c5acc96, 0x3c5ad116, 0x3c5ad196,
+    0x3c5ae52a, 0x3c5af592, 0x3c5afa12, 0x3c5b3629, 0x3c5b43ea, 0x3c5b80a9, 0x3c5b8129, 0x3c5bbbaa,
+    0x3c5bbd6a, 0x3c5c73a9, 0x3c5c742a, 0x3c5c75aa, 0x3c5c7a2a, 0x3c5ced29, 0x3c5cef29, 0x3c5cf3aa,
+    0x3c5d2e2a, 0x3c609761, 0x3c60bc19, 0x3c6125fa, 0x3c613595, 0x3c615e11, 0x3c6186a1, 0x3c618b3a,
+    0x3c61af21, 0x3c61b3ba, 0x3c61c2a1, 0x3c61c321, 0x3c61c73a, 0x3c61c7ba, 0x3c61d6d1, 0x3c61db65,
+    0x3c623aa1, 0x3c623c21, 0x3c626321, 0x3c6264a1, 0x3c626925, 0x3c6276a1, 0x3c627721, 0x3c6278a1,
+    0x3c627d25, 0x3c63d121, 0x3c63e3ba, 0x3c63e521, 0x3c63e9ba, 0x3c645ca1, 0x3c648521, 0x3c648ba5,
+    0x3c64c9d5, 0x3c654419, 0x3c65f985, 0x3c6635a6, 0x3c663726, 0x3c66cec9, 0x3c66e795, 0x3c66f995,
+    0x3c66fb15, 0x3c66fb95, 0x3c671011, 0x3c673409, 0x3c675c89, 0x3c676605, 0x3c677009, 0x3c677089,
+    0x3c677919, 0x3c678991, 0x3c67ad89, 0x3c67eee5, 0x3c681765, 0x3c681de5, 0x3c682979, 0x3c682ae5,
+    0x3c682b65, 0x3c685926, 0x3c686c25, 0x3c6890e5, 0x3c68a2e5, 0x3c68a465, 0x3c68cb65, 0x3c68cce5,
+    0x3c68cd65, 0x3c68d1e6, 0x3c68d366, 0x3c68dee5, 0x3c68df65, 0x3c68e0e5, 0x3c690a15, 0x3c698509,
+    0x3c698685, 0x3c69c595, 0x3c6a39e5, 0x3c6a3e79, 0x3c6a3fe5, 0x3c6a79a6, 0x3c6aede5, 0x3c6aef65,
+    0x3c6af3e6, 0x3c6b8fd1, 0x3c6c8456, 0x3c6d109d, 0x3c6d3f51, 0x3c6d4d95, 0x3c6d4f15, 0x3c6d6195,
+    0x3c6d6315, 0x3c6d6795, 0x3c6d8819, 0x3c6dc409, 0x3c6dcd19, 0x3c6dd809, 0x3c6dd985, 0x3c6ddb19,
+    0x3c6de119, 0x3c6e0195, 0x3c6e1595, 0x3c6e1e96, 0x3c6e693a, 0x3c6e6b11, 0x3c6e6fba, 0x3c6e7d79,
+    0x3c6e7ee5, 0x3c6e9179, 0x3c6e92e5, 0x3c6e9779, 0x3c6ebb95, 0x3c6ec025, 0x3c6ecf96, 0x3c6ed416,
+    0x3c6ee411, 0x3c6ef6e5, 0x3c6ef865, 0x3c6f1f11, 0x3c6f2091, 0x3c6f2525, 0x3c6f32e5, 0x3c6fe999,
+    0x3c703a96, 0x3c704096, 0x3c708bba, 0x3c7091ba, 0x3c725f95, 0x3c739f49, 0x3c73b815, 0x3c73ca22,
+    0x3c73e091, 0x3c745a11, 0x3c74bf62, 0x3c74e7e1, 0x3c74fb62, 0x3c74fbe1, 0x3c751345, 0x3c753ca1,
+    0x3c756161, 0x3c758d91, 0x3c759be1, 0x3c759d61, 0x3c768f85, 0x3c76cde1, 0x3c76dfe2, 0x3c770879,
+    0x3c7709e1, 0x3c770a61, 0x3c771be2, 0x3c771c79, 0x3c771de1, 0x3c780415, 0x3c780f95, 0x3c781115,
+    0x3c781195, 0x3c781595, 0x3c781615, 0x3c784a09, 0x3c787289, 0x3c787c05, 0x3c788609, 0x3c788689,
+    0x3c789f91, 0x3c78c389, 0x3c78c685, 0x3c7904dd, 0x3c792d5d, 0x3c7933dd, 0x3c793f79, 0x3c7940dd,
+    0x3c79415d, 0x3c794579, 0x3c7945f9, 0x3c79b8dd, 0x3c79e15d, 0x3c79e35d, 0x3c79e7dd, 0x3c79e95d,
+    0x3c79f4de, 0x3c79f55e, 0x3c7a0c11, 0x3c7a1091, 0x3c7a1211, 0x3c7a3009, 0x3c7a3695, 0x3c7a7159,
+    0x3c7a75d9, 0x3c7a7775, 0x3c7a99d9, 0x3c7a9e59, 0x3c7a9fd9, 0x3c7aa059, 0x3c7aabd9, 0x3c7aad59,
+    0x3c7aadd9, 0x3c7ab1d9, 0x3c7ab259, 0x3c7ab3d9, 0x3c7aead5, 0x3c7aef79, 0x3c7af0d5, 0x3c7af155,
+    0x3c7b3bd1, 0x3c7b6649, 0x3c7b9355, 0x3c7c0b45, 0x3c7c1549, 0x3c7c15c9, 0x3c7c1e75, 0x3c7c4515,
+    0x3c7cbc59, 0x3c7cc0d9, 0x3c7cc259, 0x3c7ce089, 0x3c7ce385, 0x3c7cf955, 0x3c7cffd5, 0x3c7d0b79,
+    0x3c7d0cd5, 0x3c7d0d55, 0x3c7d21d1, 0x3c7d5dd1, 0x3c7d5e51, 0x3c7d74c9, 0x3c7d77c5, 0x3c7d8675,
+    0x3c7daf55, 0x3c7db3d5, 0x3c7dec75, 0x3c7dfe75, 0x3c7e26f5, 0x3c7e2875, 0x3c7e2bc5, 0x3c808409,
+    0x3c809815, 0x3c80c559, 0x3c80ffd9, 0x3c810159, 0x3c8101d9, 0x3c8113d9, 0x3c811559, 0x3c8119d9,
+    0x3c813ed5, 0x3c8152d5, 0x3c81b3c9, 0x3c81b6c5, 0x3c81b875, 0x3c81c7c9, 0x3c81cc75, 0x3c81e491,
+    0x3c822d49, 0x3c826c75, 0x3c826df5, 0x3c827275, 0x3c8272f5, 0x3c827475, 0x3c828075, 0x3c8281f5,
+    0x3c828675, 0x3c83da75, 0x3c83ee75, 0x3c845275, 0x3c848e75, 0x3c848ef5, 0x3c849075, 0x3c8494f5,
+    0x3c84df61, 0x3c870161, 0x3c877ba1, 0x3c87b93a, 0x3c87baa1, 0x3c87bb16, 0x3c87bf3a, 0x3c87bf96,
+    0x3c87cf92, 0x3c880b91, 0x3c885c95, 0x3c886ea1, 0x3c886f16, 0x3c887096, 0x3c888391, 0x3c888511,
+    0x3c88bf91, 0x3c88e706, 0x3c89db3a, 0x3c89db96, 0x3c89e196, 0x3c8bc119, 0x3c8cb415, 0x3c8d4291,
+    0x3c8d5489, 0x3c8d6809, 0x3c8d6895, 0x3c8d6985, 0x3c8d6b15, 0x3c8d7119, 0x3c8d7d09, 0x3c8d95d9,
+    0x3c8da7d9, 0x3c8da959, 0x3c8dd1d9, 0x3c8de305, 0x3c8de3d9, 0x3c8de476, 0x3c8de5d9, 0x3c8df689,
+    0x3c8e0f55, 0x3c8e2179, 0x3c8e22d5, 0x3c8e2355, 0x3c8e37d1, 0x3c8e5bc9, 0x3c8e6075, 0x3c8e64fa,
+    0x3c8e88f5, 0x3c8e97c9, 0x3c8e9876, 0x3c8e9c75, 0x3c8e9cf5, 0x3c8ea0fa, 0x3c8ea2f5, 0x3c8ed605,
+    0x3c8efdc9, 0x3c8f1475, 0x3c8f15f5, 0x3c8f3cf5, 0x3c8f3e75, 0x3c8f5075, 0x3c8f50f5, 0x3c8f5275,
+    0x3c8f8d15, 0x3c9031d5, 0x3c906ef5, 0x3c9080fa, 0x3c908275, 0x3c90aaf5, 0x3c90bcfa, 0x3c90bef5,
+    0x3c90c37a, 0x3c9122f5, 0x3c912475, 0x3c913675, 0x3c915ef5, 0x3c918751, 0x3c9187d6, 0x3c918956,
+    0x3c921519, 0x3c9215b5, 0x3c921719, 0x3c930815, 0x3c930896, 0x3c930a16, 0x3c93a951, 0x3c93bf1a,
+    0x3c93c51a, 0x3c93d316, 0x3c93d496, 0x3c93d916, 0x3c942391, 0x3c942591, 0x3c942a19, 0x3c943705,
+    0x3c9437d9, 0x3c944b06, 0x3c94613a, 0x3c946291, 0x3c946316, 0x3c94673a, 0x3c946796, 0x3c94ebc9,
+    0x3c94eefa, 0x3c94f075, 0x3c94f0f5, 0x3c94f4fa, 0x3c9502fa, 0x3c950475, 0x3c9508fa, 0x3c951691,
+    0x3c951716, 0x3c951896, 0x3c952a05, 0x3c953e06, 0x3c956549, 0x3c956875, 0x3c9569f5, 0x3c958f06,
+    0x3c95a475, 0x3c95a4f5, 0x3c95a675, 0x3c95e115, 0x3c95e196, 0x3c95e316, 0x3c95e796, 0x3c96833a,
+    0x3c968396, 0x3c968516, 0x3c968996, 0x3c96d4fa, 0x3c96d675, 0x3c9710fa, 0x3c97117a, 0x3c9712f5,
+    0x3c97177a, 0x3c978a75, 0x3c97ef91, 0x3c980305, 0x3c984159, 0x3c9842d9, 0x3c985559, 0x3c9856d9,
+    0x3c987d59, 0x3c997055, 0x3c9a1191, 0x3c9a2755, 0x3c9a28d5, 0x3c9a2d55, 0x3c9a3b55, 0x3c9a3cd5,
+    0x3c9a4159, 0x3c9a8bd1, 0x3c9a9f45, 0x3c9ac951, 0x3c9acad1, 0x3c9acf51, 0x3c9b30a1, 0x3c9b3521,
+    0x3c9b5721, 0x3c9b58a1, 0x3c9b5d21, 0x3c9b6b21, 0x3c9b6ca1, 0x3c9b7121, 0x3c9b7ed1, 0x3c9b9245,
+    0x3c9bd0a1, 0x3c9bd239, 0x3c9bd6a5, 0x3c9be4a1, 0x3c9be639, 0x3c9c0ca1, 0x3c9c4955, 0x3c9c4fd9,
+    0x3c9ceb51, 0x3c9d3d21, 0x3c9d3ea1, 0x3c9d43a1, 0x3c9d4521, 0x3c9d5121, 0x3c9d52a1, 0x3c9d5721,
+    0x3c9d7921, 0x3c9d7fa1, 0x3c9df2a1, 0x3c9e6cd5, 0x3c9e6e55, 0x3c9e8055, 0x3c9e80d5, 0x3c9e8255,
+    0x3c9eb19a, 0x3c9ee349, 0x3c9ee4c5, 0x3c9f621e, 0x3c9f671d, 0x3c9f741d, 0x3c9f759d, 0x3c9f9c9d,
+    0x3c9f9e1d, 0x3c9fb01d, 0x3c9fb09d, 0x3c9fb21d, 0x3c9fd649, 0x3c9fd7c5, 0x3ca0161d, 0x3ca017b9,
+    0x3ca0299d, 0x3ca02a1d, 0x3ca02bb9, 0x3ca0521d, 0x3ca0a245, 0x3ca0ce9a, 0x3ca0d39a, 0x3ca0e099,
+    0x3ca0e699, 0x3ca11c99, 0x3ca15a15, 0x3ca15b95, 0x3ca16015, 0x3ca198e5, 0x3ca1c5e5, 0x3ca1c765,
+    0x3ca20f95, 0x3ca23f66, 0x3ca240e6, 0x3ca29d51, 0x3ca2af49, 0x3ca2b5c9, 0x3ca2ef19, 0x3ca2f099,
+    0x3ca2f599, 0x3ca2f719, 0x3ca30299, 0x3ca30319, 0x3ca30499, 0x3ca30919, 0x3ca32b19, 0x3ca33199,
+    0x3ca37c15, 0x3ca38295, 0x3ca3a765, 0x3ca3abe5, 0x3ca3ad65, 0x3ca41e15, 0x3ca424a5, 0x3ca45b65,
+    0x3ca46166, 0x3ca4d465, 0x3ca4d4e5, 0x3ca4d665, 0x3ca5c81e, 0x3ca5c99e, 0x3ca5dc25, 0x3ca5dda5,
+    0x3ca60425, 0x3ca60625, 0x3ca67da5, 0x3ca67e25, 0x3ca6f665, 0x3ca7349a, 0x3ca7361a, 0x3ca73a9a,
+    0x3ca73b1a, 0x3ca745a6, 0x3ca74726, 0x3ca748a5, 0x3ca74a25, 0x3ca74ea5, 0x3ca770a5, 0x3ca772a5,
+    0x3ca7ae16, 0x3ca7af96, 0x3ca7b416, 0x3ca7b496, 0x3ca7c825, 0x3ca7d892, 0x3ca7dd12, 0x3ca7fee6,
+    0x3ca80066, 0x3ca804e6, 0x3ca81925, 0x3ca863a5, 0x3ca86425, 0x3ca956a5, 0x3ca95725, 0x3ca958a5,
+    0x3ca95d25, 0x3ca9d025, 0x3ca9d0a5, 0x3ca9d225, 0x3ca9d6a5, 0x3caa1125, 0x3cab50e1, 0x3cac6d1d,
+    0x3cac80a1, 0x3cad72e1, 0x3cadd999, 0x3caded21, 0x3caded99, 0x3cae2aa1, 0x3cae2c21, 0x3cae30a1,
+    0x3cae6961, 0x3cae7b91, 0x3cae91e1, 0x3caed295, 0x3caee021, 0x3caee695, 0x3caefb36, 0x3cb03985,
+    0x3cb04ca1, 0x3cb06336, 0x3cb075e1, 0x3cb07775, 0x3cb077e1, 0x3cb089e1, 0x3cb0b1e1, 0x3cb0b261,
+    0x3cb0f515, 0x3cb1e985, 0x3cb1f699, 0x3cb1f836, 0x3cb21f19, 0x3cb22099, 0x3cb23299, 0x3cb23319,
+    0x3cb2a15d, 0x3cb2aedd, 0x3cb32595, 0x3cb34c89, 0x3cb3555d, 0x3cb356fa, 0x3cb36036, 0x3cb38889,
+    0x3cb3b411, 0x3cb3c609, 0x3cb3d989, 0x3cb3db05, 0x3cb3dc95, 0x3cb3ee89, 0x3cb40759, 0x3cb40dd9,
+    0x3cb41959, 0x3cb41af5, 0x3cb41b59, 0x3cb441d9, 0x3cb45485, 0x3cb45559, 0x3cb455d9, 0x3cb46809,
+    0x3cb480d5, 0x3cb492d5, 0x3cb49455, 0x3cb494d5, 0x3cb4a951, 0x3cb4cd49, 0x3cb4d045, 0x3cb4d675,
+    0x3cb4e5d1, 0x3cb4f5c9, 0x3cb4fef5, 0x3cb4ff45, 0x3cb50949, 0x3cb509c9, 0x3cb50c75, 0x3cb50df5,
+    0x3cb51275, 0x3cb512f5, 0x3cb51475, 0x3cb53b55, 0x3cb54785, 0x3cb573f9, 0x3cb575c9, 0x3cb578fa,
+    0x3cb585f5, 0x3cb58bf6, 0x3cb58c75, 0x3cb5ae75, 0x3cb5aff9, 0x3cb5b475, 0x3cb5c1f5, 0x3cb5c275,
+    0x3cb5c3f9, 0x3cb5c875, 0x3cb5fe95, 0x3cb629d9, 0x3cb62e59, 0x3cb62ff5, 0x3cb66a59, 0x3cb68d85,
+    0x3cb6a155, 0x3cb6a2d5, 0x3cb6a355, 0x3cb6a7d5, 0x3cb6b6d5, 0x3cb6c9d1, 0x3cb6cb75, 0x3cb6cbd1,
+    0x3cb6e075, 0x3cb6e249, 0x3cb6e545, 0x3cb6e6f5, 0x3cb6f275, 0x3cb6f2c5, 0x3cb6f3f6, 0x3cb705d1,
+    0x3cb70651, 0x3cb71af5, 0x3cb71c75, 0x3cb71e49, 0x3cb72175, 0x3cb722f5, 0x3cb72e75, 0x3cb72ef5,
+    0x3cb73075, 0x3cb734f5, 0x3cb75b09, 0x3cb75d55, 0x3cb79475, 0x3cb795f6, 0x3cb797f5, 0x3cb79945,
+    0x3cb79af5, 0x3cb79c76, 0x3cb7a7f6, 0x3cb7a875, 0x3cb7ae76, 0x3cb7d075, 0x3cb7d6f5, 0x3cb7f8d1,
+    0x3cb7f951, 0x3cb7fad1, 0x3cb85e99, 0x3cb86036, 0x3cb88699, 0x3cb88719, 0x3cb88899, 0x3cb97995,
+    0x3cb97a15, 0x3cb97bb9, 0x3cba1ad1, 0x3cba3095, 0x3cba4495, 0x3cba4615, 0x3cba4a95, 0x3cba5ab6,
+    0x3cba8159, 0x3cba82f5, 0x3cba8775, 0x3cba9511, 0x3cba9591, 0x3cba9711, 0x3cba9b91, 0x3cbaa885,
+    0x3cbabc86, 0x3cbad291, 0x3cbad411, 0x3cbad491, 0x3cbad891, 0x3cbad911, 0x3cbb3549, 0x3cbb39f5,
+    0x3cbb3e75, 0x3cbb6075, 0x3cbb61f5, 0x3cbb6275, 0x3cbb6675, 0x3cbb66f5, 0x3cbb6875, 0x3cbb7475,
+    0x3cbb75f5, 0x3cbb7a75, 0x3cbb8811, 0x3cbb8891, 0x3cbb8e91, 0x3cbb9b85, 0x3cbbaf86, 0x3cbbd9f5,
+    0x3cbbdb76, 0x3cbbdff6, 0x3cbbe075, 0x3cbbedf5, 0x3cbbef76, 0x3cbbf3f6, 0x3cbc15f5, 0x3cbc1675,
+    0x3cbc17f9, 0x3cbc1c75, 0x3cbc5295, 0x3cbc5315, 0x3cbc5495, 0x3cbc5915, 0x3cbcf491, 0x3cbcf511,
+    0x3cbcf691, 0x3cbcfb11, 0x3cbd4675, 0x3cbd47f6, 0x3cbd4cf5, 0x3cbd4e76, 0x3cbd5a75, 0x3cbd5bf6,
+    0x3cbd6076, 0x3cbd8275, 0x3cbd82f5, 0x3cbd8475, 0x3cbd88f5, 0x3cbdfbf6, 0x3cbdfc75, 0x3cbdfdf6,
+    0x3cbe0276, 0x3cbe7561, 0x3cbf691e, 0x3cbf6a9e, 0x3cbf7d21, 0x3cbf7ea1, 0x3cbfa521, 0x3cc01ea1,
+    0x3cc09761, 0x3cc0d59a, 0x3cc0d71a, 0x3cc0db9a, 0x3cc0e9a1, 0x3cc0eb21, 0x3cc111a1, 0x3cc14f16,
+    0x3cc15096, 0x3cc15516, 0x3cc16921, 0x3cc204a1, 0x3cc2f7a1, 0x3cc37121, 0x3cc377a1, 0x3cc4c951,
+    0x3cc4dcc5, 0x3cc51b19, 0x3cc51c99, 0x3cc52e99, 0x3cc52f19, 0x3cc53099, 0x3cc55719, 0x3cc64a15,
+    0x3cc68489, 0x3cc6eb45, 0x3cc70115, 0x3cc71495, 0x3cc71515, 0x3cc71695, 0x3cc71b19, 0x3cc73b9a,
+    0x3cc751d9, 0x3cc76591, 0x3cc76791, 0x3cc77905, 0x3cc7a311, 0x3cc7a491, 0x3cc7a511, 0x3cc7a911,
+    0x3cc7a991, 0x3cc805c9, 0x3cc80875, 0x3cc809f5, 0x3cc80a75, 0x3cc80e75, 0x3cc80ef5, 0x3cc81075,
+    0x3cc830f5, 0x3cc83275, 0x3cc832f5, 0x3cc836f5, 0x3cc83775, 0x3cc84475, 0x3cc844f5, 0x3cc84675,
+    0x3cc84af5, 0x3cc85891, 0x3cc85911, 0x3cc86c05, 0x3cc8aa75, 0x3cc8abf9, 0x3cc8bdf5, 0x3cc8be75,
+    0x3cc8bff9, 0x3cc8e675, 0x3cc8e6f5, 0x3cc8e879, 0x3cc92315, 0x3cc92999, 0x3cc9c511, 0x3cc9cb91,
+    0x3cc9db55, 0x3cc9dd89, 0x3cca16f5, 0x3cca1745, 0x3cca1875, 0x3cca1d75, 0x3cca1ef5, 0x3cca2a75,
+    0x3cca2af5, 0x3cca2c75, 0x3cca30f5, 0x3cca52f5, 0x3cca5975, 0x3ccacc75, 0x3edae8f9, 0x3edaea79,
+    0x3edaeaf9, 0x3edb9cca, 0x3edc1a39, 0x3edc1ab9, 0x3edc9239, 0x3edcbab9, 0x3edcbc39, 0x3edcce39,
+    0x3edcceb9, 0x3edcd039, 0x3edcf2f9, 0x3edcf779, 0x3edcf8f9, 0x3edd06f9, 0x3edd0af9, 0x3edd0b79,
+    0x3edd3f79, 0x3edd46f9, 0x3eddbef9, 0x3ede28b9, 0x3ede3cb9, 0x3ede9c39, 0x3edea0b9, 0x3edeae39,
+    0x3eded6b9, 0x3eded839, 0x3ededcb9, 0x3ee1cab9, 0x3ee1cc39, 0x3ee1ccb9, 0x3ee2bdb9, 0x3ee2bf39,
+    0x3ee2bfb9, 0x3ee30eb9, 0x3ee31039, 0x3ee3393a, 0x3ee346f9, 0x3ee3493a, 0x3ee34b79, 0x3ee34cf9,
+    0x3ee36df9, 0x3ee3703a, 0x3ee37179, 0x3ee375fa, 0x3ee388c6, 0x3ee3ac39, 0x3ee3b0b9, 0x3ee3c13a,
+    0x3ee3d4b9, 0x3ee3d6fa, 0x3ee3d939, 0x3ee3d9fa, 0x3ee3dab9, 0x3ee3e69a, 0x3ee3e81a, 0x3ee3e89a,
+    0x3ee3ec9a, 0x3ee3ed1a, 0x3ee42bb9, 0x3ee42c39, 0x3ee47cb9, 0x3ee49ffa, 0x3ee4a5ba, 0x3ee4b43a,
+    0x3ee4c7b9, 0x3ee4c9fa, 0x3ee4cc39, 0x3ee4ccfa, 0x3ee4cdb9, 0x3ee4d996, 0x3ee4db16, 0x3ee4db96,
+    0x3ee4df96, 0x3ee4e016, 0x3ee4f039, 0x3ee4f4b9, 0x3ee5197a, 0x3ee51ea6, 0x3ee51f2a, 0x3ee52a92,
+    0x3ee52c12, 0x3ee52c92, 0x3ee53092, 0x3ee53112, 0x3ee541fa, 0x3ee7f639, 0x3ee81eb9, 0x3ee82039,
+    0x3ee820b9, 0x3ee83239, 0x3ee832b9, 0x3ee83439, 0x3ee87139, 0x3ee871b9, 0x3ee8aa0a, 0x3ee8d28a,
+    0x3ee8d586, 0x3ee911b9, 0x3ee91339, 0x3ee913b9, 0x3ee94c0a, 0x3ee94f06, 0x3ee96426, 0x3ee9bef9,
+    0x3ee9c1f9, 0x3ee9c43a, 0x3ee9c9fa, 0x3eea0039, 0x3eea04b9, 0x3eea3ab9, 0x3eea3c39, 0x3eea3cb9,
+    0x3eea3efa, 0x3eea40b9, 0x3eea4139, 0x3eea41fa, 0x3eea4e9a, 0x3eea501a, 0x3eea549a, 0x3eea7fb9,
+    0x3eea8039, 0x3eeab88a, 0x3eeabb86, 0x3eeb2db9, 0x3eeb2f39, 0x3eeb2fb9, 0x3eeb31fa, 0x3eeb3439,
+    0x3eeb34fa, 0x3eeb72a6, 0x3eeb84a6, 0x3eee9b39, 0x3eee9cb9, 0x3eee9d39, 0x3eef8e39, 0x3eef9039,
+    0x3ef042f9, 0x3ef08139, 0x3ef0a9b9, 0x3ef0ab39, 0x3ef0b89a, 0x3ef0bd1a, 0x3ef0bd9a, 0x3ef0f6f9,
+    0x3ef0fcb9, 0x3ef1350a, 0x3ef17139, 0x3ef19839, 0x3ef1ab96, 0x3ef1ac16, 0x3ef1b016, 0x3ef1b096,
+    0x3ef1e4b9, 0x3ef66ff9, 0x3ef67179, 0x3ef671f9, 0x3ef6ff39, 0x3ef76386, 0x3ef7ddf9, 0x3ef7de79,
+    0x3ef7ec39, 0x3ef7f0b9, 0x3ef81316, 0x3ef81696, 0x3ef81796, 0x3ef85179, 0x3ef855f9, 0x3ef879f9,
+    0x3ef87e79, 0x3ef87ff9, 0x3efaf239, 0x3efb44b9, 0x3efb68b9, 0x3efba60a, 0x3efc2379, 0x3efc23f9,
+    0x3efc9b79, 0x3efcc3f9, 0x3efcc579, 0x3efcc5f9, 0x3efcd779, 0x3efcd7f9, 0x3efcd979, 0x3efd00b9,
+    0x3efe31f9, 0x3efe3279, 0x3efe45f9, 0x3efe6439, 0x3efe6739, 0x3efea579, 0x3efea9f9, 0x3efeb779,
+    0x3efedff9, 0x3efee179, 0x3efee1f9, 0x3efee5f9, 0x3efee679, 0x3f0198b9, 0x3f03053a, 0x3f03a739,
+    0x3f03b4b9, 0x3f03b939, 0x3f041ab9, 0x3f042e39, 0x3f042eb9, 0x3f046d39, 0x3f0498ba, 0x3f0525ba,
+    0x3f0527aa, 0x3f08f279, 0x3f08f3f9, 0x3f08f479, 0x3f096bf9, 0x3f096d79, 0x3f099479, 0x3f0995f9,
+    0x3f09a63a, 0x3f09a7f9, 0x3f09a879, 0x3f09a93a, 0x3f09a9f9, 0x3f09b93a, 0x3f09cefa, 0x3f09d1fa,
+    0x3f09e2fa, 0x3f09e5fa, 0x3f09fb39, 0x3f0a23ba, 0x3f0a242a, 0x3f0a463a, 0x3f0a46fa, 0x3f0a4aba,
+    0x3f0a5eba, 0x3f0a6eb9, 0x3f0a95b9, 0x3f0ad3f9, 0x3f0ad9f9, 0x3f0afc79, 0x3f0b00f9, 0x3f0b0279,
+    0x3f0b0e79, 0x3f0b0ff9, 0x3f0b1079, 0x3f0b12ba, 0x3f0b14f9, 0x3f0b15ba, 0x3f0b1679, 0x3f0b39fa,
+    0x3f0b75f9, 0x3f0b7a79, 0x3f0b7bf9, 0x3f0b87f9, 0x3f0b8979, 0x3f0b8c2a, 0x3f0b8df9, 0x3f0b8f2a,
+    0x3f0bb079, 0x3f0bb1f9, 0x3f0bb679, 0x3f0e40b9, 0x3f0e693a, 0x3f0f1f79, 0x3f0f4679, 0x3f0f47f9,
+    0x3f0f4879, 0x3f0f5a79, 0x3f0f5bf9, 0x3f0fad3a, 0x3f0fbff9, 0x3f0fc179, 0x3f0fd379, 0x3f0ffbf9,
+    0x3f0ffc79, 0x3f0ffdf9, 0x3f100ff9, 0x3f1036fa, 0x3f1039fa, 0x3f1077ba, 0x3f10782a, 0x3f1089ba,
+    0x3f108baa, 0x3f10b2ba, 0x3f10bfba, 0x3f10e6b9, 0x3f10e9b9, 0x3f1127f9, 0x3f112df9, 0x3f113b79,
+    0x3f1163f9, 0x3f116479, 0x3f1168f9, 0x3f116a79, 0x3f1177f9, 0x3f11cdba, 0x3f11dbf9, 0x3f11dd79,
+    0x3f11e02a, 0x3f11e1f9, 0x3f11f3aa, 0x3f1219f9, 0x3f150e39, 0x3f150eb9, 0x3f15ffb9, 0x3f160139,
+    0x3f16b2f9, 0x3f16ee39, 0x3f16eef9, 0x3f1716b9, 0x3f171cb9, 0x3f172a1a, 0x3f172a9a, 0x3f172e9a,
+    0x3f172f1a, 0x3f176db9, 0x3f17a986, 0x3f1809b9, 0x3f180e39, 0x3f180fb9, 0x3f181d16, 0x3f182196,
+    0x3f185939, 0x3f185db9, 0x3f1ce179, 0x3f1ce2f9, 0x3f1ce379, 0x3f1d5b86, 0x3f1d70b9, 0x3f1d951a,
+    0x3f1e4f79, 0x3f1e4ff9, 0x3f1e5db9, 0x3f1e6239, 0x3f1e8496, 0x3f1e8796, 0x3f1ec2f9, 0x3f1ec779,
+    0x3f1ed912, 0x3f1eeb79, 0x3f1eeff9, 0x3f1ef179, 0x3f216539, 0x3f219e0a, 0x3f2294f9, 0x3f229579,
+    0x3f22a7b9, 0x3f230cf9, 0x3f233579, 0x3f2336f9, 0x3f233779, 0x3f2348f9, 0x3f234979, 0x3f234af9,
+    0x3f236db9, 0x3f2373b9, 0x3f23e939, 0x3f24a379, 0x3f24a3f9, 0x3f24b779, 0x3f2516f9, 0x3f251b79,
+    0x3f2528f9, 0x3f255179, 0x3f2552f9, 0x3f255379, 0x3f255779, 0x3f2557f9, 0x3f29b1f9, 0x3f29b379,
+    0x3f29b3f9, 0x3f2a290a, 0x3f2a651a, 0x3f2a659a, 0x3f2aa586, 0x3f2b1ff9, 0x3f2b2079, 0x3f2b5516,
+    0x3f2b5996, 0x3f2b9379, 0x3f2b97f9, 0x3f2bbbf9, 0x3f2bc079, 0x3f2bc1f9, 0x3f351779, 0x3f3517f9,
+    0x3f3608f9, 0x3f3725f9, 0x3f372679, 0x3f3733da, 0x3f37385a, 0x3f3812f9, 0x3f381779, 0x3f383b79,
+    0x3f3caf79, 0x3f3d6139, 0x3f3e15f9, 0x3f3e1bf9, 0x3f3e3e79, 0x3f3e51f9, 0x3f3e5279, 0x3f3ebdf9,
+    0x3f3ecb79, 0x3f3ecff9, 0x3f41e7f9, 0x3f43cdf9, 0x3f444179, 0x3f449279, 0x3f4511f9, 0x3f4535f9,
+    0x3f454cd2, 0x3f481379, 0x3f49e596, 0x3f4a21f9, 0x3f4a5aba, 0x3f4a5dba, 0x3f4a9579, 0x3f4b4d96,
+    0x3f4b5096, 0x3f4bc97a, 0x3f4bcafa, 0x3f4e7c39, 0x3f4ef3b9, 0x3f4f97ba, 0x3f4fa4ba, 0x3f4fa53a,
+    0x3f4fe826, 0x3f509839, 0x3f509cb9, 0x3f510239, 0x3f5115b9, 0x3f511639, 0x3f5150b9, 0x3f5151b9,
+    0x3f51b3ba, 0x3f5208a6, 0x3f52313a, 0x3f55d579, 0x3f55e53a, 0x3f564a7a, 0x3f5650fa, 0x3f5672fa,
+    0x3f5678fa, 0x3f56867a, 0x3f5686fa, 0x3f56893a, 0x3f569c3a, 0x3f56b1fa, 0x3f56b4fa, 0x3f56c5fa,
+    0x3f56c8fa, 0x3f5702b9, 0x3f5706a6, 0x3f57293a, 0x3f5729fa, 0x3f572dba, 0x3f572f3a, 0x3f575639,
+    0x3f57bb79, 0x3f57bd79, 0x3f57e3f9, 0x3f57f5ba, 0x3f57f779, 0x3f57f7f9, 0x3f57f8ba, 0x3f581cfa,
+    0x3f586cfa, 0x3f586f3a, 0x3f587179, 0x3f58723a, 0x3f5894fa, 0x3f58973a, 0x3f5b4c26, 0x3f5b9bb9,
+    0x3f5bc2b9, 0x3f5c00f9, 0x3f5c02f9, 0x3f5c2979, 0x3f5c3cf9, 0x3f5c3d79, 0x3f5c9026, 0x3f5c9e7a,
+    0x3f5ca4fa, 0x3f5cb27a, 0x3f5cb6f9, 0x3f5cb87a, 0x3f5cda7a, 0x3f5cdafa, 0x3f5cee7a, 0x3f5d19fa,
+    0x3f5d1cfa, 0x3f5d56b9, 0x3f5d5aa6, 0x3f5d6ca6, 0x3f5d953a, 0x3f5da2ba, 0x3f5e0f79, 0x3f5e1179,
+    0x3f5e2379, 0x3f5e4b79, 0x3f5e4bf9, 0x3f5e5f79, 0x3f5e95ba, 0x3f5eb0a6, 0x3f5ec0fa, 0x3f5ec579,
+    0x3f5ed2f9, 0x3f5ed47a, 0x3f62a5f9, 0x3f62dcba, 0x3f631afa, 0x3f63217a, 0x3f63437a, 0x3f63497a,
+    0x3f6349fa, 0x3f6356fa, 0x3f63577a, 0x3f644db9, 0x3f648bf9, 0x3f648df9, 0x3f64b479, 0x3f64c7f9,
+    0x3f64c879, 0x3f652ffa, 0x3f653d7a, 0x3f6541f9, 0x3f65657a, 0x3f6565fa, 0x3f69467a, 0x3f69be7a,
+    0x3f6a3ff9, 0x3f6a643a, 0x3f6a77ba, 0x3f6ab779, 0x3f6b0879, 0x3f6b83fa, 0x3f6ba7f9, 0x3f6bd2fa,
+    0x3f6e8579, 0x3f6efcf9, 0x3f6f9a7a, 0x3f6fae7a, 0x3f6fc2fa, 0x3f6ffefa, 0x3f70127a, 0x3f702bfa,
+    0x3f7093f9, 0x3f70a5f9, 0x3f70cbba, 0x3f710b79, 0x3f711f79, 0x3f71867a, 0x3f723a7a, 0x3f74ed3a,
+    0x3f7652fa, 0x3f76597a, 0x3f770dba, 0x3f770fba, 0x3f77363a, 0x3f77bdf9, 0x3f77bff9, 0x3f77c3f9,
+    0x3f77c5f9, 0x3f77e679, 0x3f77fa79, 0x3f78757a, 0x3f7877ba, 0x3f7b55f9, 0x3f7ce8fa, 0x3f7cfcfa,
+    0x3f7d21fa, 0x3f7d743a, 0x3f7d9c3a, 0x3f7de979, 0x3f7e3a79, 0x3f7e50fa, 0x3f7e557a, 0x3f7e56fa,
+    0x3f7e68fa, 0x3f7e697a, 0x3f7ede7a, 0x3f7ee27a, 0x3f7ee2fa, 0x3f7ee47a, 0x3f7f04fa, 0x3f7f067a,
+    0x3f7f0afa, 0x3f81bbee, 0x3f81bd6e, 0x3f81e3ee, 0x3f8273fa, 0x3f8297ee, 0x3f829afa, 0x3f8327fa,
+    0x3f8350fa, 0x3f839aba, 0x3f83c83a, 0x3f83d96e, 0x3f83ddee, 0x3f84947a, 0x3f84bd7a, 0x3f85367a,
+    0x3f85387a, 0x3f8543fa, 0x3f85447a, 0x3f8545fa, 0x3f854a7a, 0x3f856c7a, 0x3f85c4f9, 0x3f85c679,
+    0x3f85c6f9, 0x3f8678ca, 0x3f86f639, 0x3f86f6b9, 0x3f876e39, 0x3f8796b9, 0x3f879839, 0x3f87a59e,
+    0x3f87a61e, 0x3f87aa1e, 0x3f87aa9e, 0x3f87ac1e, 0x3f886139, 0x3f8862b9, 0x3f886339, 0x3f895439,
+    0x3f8955b9, 0x3f895639, 0x3f8a0479, 0x3f8a07f9, 0x3f8a0af9, 0x3f8a42b9, 0x3f8a4739, 0x3f8a6b39,
+    0x3f8a6fb9, 0x3f8a7139, 0x3f8a7e9a, 0x3f8a7f1a, 0x3f8a831a, 0x3f8a839a, 0x3f8a851a, 0x3f8ac239,
+    0x3f8ac2b9, 0x3f8b5e39, 0x3f8b62b9, 0x3f8b6439, 0x3f8b7196, 0x3f8b7216, 0x3f8b7616, 0x3f8b7696,
+    0x3f8b7816, 0x3f8badb9, 0x3f8bb239, 0x3f8ca6b9, 0x3f8ca839, 0x3f8ca8b9, 0x3f8d99b9, 0x3f8d9a7a,
+    0x3f8e0d1e, 0x3f9035f9, 0x3f903779, 0x3f9037f9, 0x3f90c17a, 0x3f90c47a, 0x3f90c539, 0x3f90e61a,
+    0x3f90e99a, 0x3f91a3f9, 0x3f91a479, 0x3f91b239, 0x3f91b47a, 0x3f91b6b9, 0x3f91b77a, 0x3f91b839,
+    0x3f91d916, 0x3f91dc96, 0x3f91df96, 0x3f921779, 0x3f9219ba, 0x3f921bf9, 0x3f921cba, 0x3f922a12,
+    0x3f922d92, 0x3f923ff9, 0x3f92423a, 0x3f924479, 0x3f92453a, 0x3f9245f9, 0x3f92d239, 0x3f92fab9,
+    0x3f92fb7a, 0x3f92fc39, 0x3f92fcb9, 0x3f930e39, 0x3f930eb9, 0x3f931039, 0x3f934d39, 0x3f93860a,
+    0x3f93ee7a, 0x3f94693a, 0x3f94731e, 0x3f94b839, 0x3f94b9b9, 0x3f94ba39, 0x3f94f28a, 0x3f950ab9,
+    0x3f952eb9, 0x3f952f39, 0x3f95e979, 0x3f95e9f9, 0x3f966179, 0x3f9689f9, 0x3f968b79, 0x3f968bf9,
+    0x3f969d79, 0x3f969df9, 0x3f969f79, 0x3f96a979, 0x3f96c239, 0x3f96c6b9, 0x3f96c839, 0x3f96c8b9,
+    0x3f96d639, 0x3f96eab9, 0x3f970eb9, 0x3f972539, 0x3f9726b9, 0x3f973739, 0x3f973a39, 0x3f97423a,
+    0x3f974a9a, 0x3f974b1a, 0x3f97f7f9, 0x3f97f879, 0x3f980bf9, 0x3f981839, 0x3f9830b9, 0x3f98353a,
+    0x3f983f16, 0x3f986b79, 0x3f986ff9, 0x3f987d79, 0x3f98a5f9, 0x3f98a779, 0x3f98a7f9, 0x3f98abf9,
+    0x3f98ac79, 0x3f98ad3a, 0x3f9978b9, 0x3f997939, 0x3f9a6a39, 0x3f9add9e, 0x3f9d0679, 0x3f9d07f9,
+    0x3f9d0879, 0x3f9d4339, 0x3f9db69a, 0x3f9db99a, 0x3f9dba1a, 0x3f9dbd1a, 0x3f9dfa06, 0x3f9e7479,
+    0x3f9e74f9, 0x3f9ea996, 0x3f9ead16, 0x3f9eae16, 0x3f9ee7f9, 0x3f9eec79, 0x3f9f1079, 0x3f9f14f9,
+    0x3f9f1679, 0x3fa5ce39, 0x3fa620b9, 0x3fa644b9, 0x3fa6820a, 0x3fa6ff79, 0x3fa6fff9, 0x3fa77779,
+    0x3fa79ff9, 0x3fa7a179, 0x3fa7a1f9, 0x3fa7ad5e, 0x3fa7aede, 0x3fa7af5e, 0x3fa7b35e, 0x3fa7b3de,
+    0x3fa7b55e, 0x3fa86a79, 0x3fa86bf9, 0x3fa86c79, 0x3fa95d79, 0x3fa95f79, 0x3fa997ca, 0x3fa9d3f9,
+    0x3fa9d479, 0x3fa9d579, 0x3fa9ed39, 0x3faa78f9, 0x3faa7a79, 0x3faa7af9, 0x3faa885a, 0x3faa8cda,
+    0x3faa8e5a, 0x3faacbf9, 0x3fab4eb9, 0x3fab6779, 0x3fab6bf9, 0x3fab6df9, 0x3fab7956, 0x3fab7ad6,
+    0x3fab7b56, 0x3fab7fd6, 0x3fab8ff9, 0x3fabb3f9, 0x3fabca52, 0x3fabcbd2, 0x3fabdc79, 0x3fabdf79,
+    0x3fac74b9, 0x3fae5ab9, 0x3faed2ba, 0x3faed4ba, 0x3faf8a79, 0x3fb003f9, 0x3fb076b9, 0x3fb0eeba,
+    0x3fb12c39, 0x3fb16a79, 0x3fb17079, 0x3fb192f9, 0x3fb1a2ba, 0x3fb1a679, 0x3fb1a6f9, 0x3fb21279,
+    0x3fb21ff9, 0x3fb22479, 0x3fb244ba, 0x3fb29f7a, 0x3fb2ed7a, 0x3fb2f07a, 0x3fb3183a, 0x3fb31a3a,
+    0x3fb3ce79, 0x3fb40d3a, 0x3fb447f9, 0x3fb44979, 0x3fb45c3a, 0x3fb47079, 0x3fb4713a, 0x3fb471f9,
+    0x3fb47f5e, 0x3fb47fde, 0x3fb483de, 0x3fb4845e, 0x3fb53c79, 0x3fb53cf9, 0x3fb67cba, 0x3fb6a77a,
+    0x3fb6b739, 0x3fb6b97a, 0x3fb6bc7a, 0x3fb6e63a, 0x3fb71c79, 0x3fb72279, 0x3fb730ba, 0x3fb7353a,
+    0x3fb744f9, 0x3fb7585a, 0x3fb795f9, 0x3fb7e6f9, 0x3fb7eb79, 0x3fb80df9, 0x3fb80f7a, 0x3fb813fa,
+    0x3fb815fa, 0x3fb83d3a, 0x3fb86679, 0x3fb8b17a, 0x3fb8b5fa, 0x3fb8f37a, 0x3fb91cb9, 0x3fb96e3a,
+    0x3fb9fb79, 0x3fba2279, 0x3fba23f9, 0x3fba3679, 0x3fba613a, 0x3fba9bf9, 0x3fba9d79, 0x3fbaaf79,
+    0x3fbad7f9, 0x3fbad879, 0x3fbad93a, 0x3fbae55e, 0x3fbae5de, 0x3fbae75e, 0x3fbaebde, 0x3fbb02b9,
+    0x3fbb130a, 0x3fbb26b9, 0x3fbb2739, 0x3fbb2839, 0x3fbb3b8a, 0x3fbb6679, 0x3fbb67f9, 0x3fbb7aba,
+    0x3fbb7cba, 0x3fbb8cba, 0x3fbb8ef9, 0x3fbb9079, 0x3fbb90f9, 0x3fbba279, 0x3fbba2f9, 0x3fbba479,
+    0x3fbbb50a, 0x3fbbdc39, 0x3fbbe179, 0x3fbbe1f9, 0x3fbc1a4a, 0x3fbc30f9, 0x3fbc3279, 0x3fbc5679,
+    0x3fbc56f9, 0x3fbc597a, 0x3fbc5b7a, 0x3fbcbc4a, 0x3fbcd47a, 0x3fbcfb7a, 0x3fbcfd7a, 0x3fbd0f7a,
+    0x3fbd1eb9, 0x3fbd2f39, 0x3fbd3a3a, 0x3fbd42b9, 0x3fbd4339, 0x3fbd4439, 0x3fbd7079, 0x3fbd7679,
+    0x3fbd8279, 0x3fbd83f9, 0x3fbd96ba, 0x3fbdaaf9, 0x3fbdac79, 0x3fbdacf9, 0x3fbdb23a, 0x3fbdbe5a,
+    0x3fbdbeda, 0x3fbdc05a, 0x3fbdd139, 0x3fbde9f9, 0x3fbdfd79, 0x3fbdfdf9, 0x3fbe1279, 0x3fbe3679,
+    0x3fbe3979, 0x3fbe40fa, 0x3fbe4cf9, 0x3fbe4e79, 0x3fbe5ef9, 0x3fbe61f9, 0x3fbe67fa, 0x3fbe69fa,
+    0x3fbe7279, 0x3fbe72f9, 0x3fbe757a, 0x3fbea53a, 0x3fbed879, 0x3fbee2fa, 0x3fbef07a, 0x3fbef4fa,
+    0x3fbf177a, 0x3fbfea39, 0x3fbfeab9, 0x3fc0dbb9, 0x3fc1521e, 0x3fc377f9, 0x3fc37979, 0x3fc379f9,
+    0x3fc3f206, 0x3fc4281a, 0x3fc42b9a, 0x3fc42e9a, 0x3fc4e5f9, 0x3fc4e679, 0x3fc51e16, 0x3fc55979,
+    0x3fc55df9, 0x3fc581f9, 0x3fc58679, 0x3fc587f9, 0x3fcc4139, 0x3fcc7a0a, 0x3fcd70f9, 0x3fcd7179,
+    0x3fcd83b9, 0x3fcde8f9, 0x3fce1179, 0x3fce12f9, 0x3fce1379, 0x3fce1ede, 0x3fce205e, 0x3fce20de,
+    0x3fce24de, 0x3fce255e, 0x3fce26de, 0x3fcedd79, 0x3fceddf9, 0x3fcfcef9, 0x3fd05839, 0x3fd07f39,
+    0x3fd0bd79, 0x3fd0e5f9, 0x3fd0ebf9, 0x3fd0ec79, 0x3fd0f95a, 0x3fd0f9da, 0x3fd0ffda, 0x3fd1d8f9,
+    0x3fd1dd79, 0x3fd1def9, 0x3fd1ead6, 0x3fd23bd2, 0x3fd25479, 0x3fdff379, 0x3fdff3f9, 0x3fe0e4f9,
+    0x3fe137f9, 0x3fe1585e, 0x3fe38139, 0x3fe382b9, 0x3fe38339, 0x3fe3bdf9, 0x3fe41079, 0x3fe410f9,
+    0x3fe4345a, 0x3fe4ef39, 0x3fe4efb9, 0x3fe4fd79, 0x3fe501f9, 0x3fe52156, 0x3fe52456, 0x3fe562b9,
+    0x3fe56739, 0x3fe58b39, 0x3fe58fb9, 0x3fe59139, 0x3fe591b9, 0x3fe78b79, 0x3fe87e79, 0x3fe9eb7a,
+    0x3fea6479, 0x3fea9a5a, 0x3fead7f9, 0x3feb4ff9, 0x3febcc79, 0x3febf7fa, 0x3fecc279, 0x3fecc3f9,
+    0x3fecc479, 0x3fedb579, 0x3fee28de, 0x3fee2bde, 0x3fee2c5e, 0x3fee2f5e, 0x3ff051b9, 0x3ff05339,
+    0x3ff053b9, 0x3ff089f9, 0x3ff08ff9, 0x3ff0df79, 0x3ff0e0f9, 0x3ff101da, 0x3ff1055a, 0x3ff1b9b9,
+    0x3ff1bfb9, 0x3ff1c039, 0x3ff1cdf9, 0x3ff1d279, 0x3ff1d3f9, 0x3ff23339, 0x3ff237b9, 0x3ff23939,
+    0x3ff242d2, 0x3ff248d2, 0x3ff25bb9, 0x3ff26039, 0x3ff261b9, 0x3ff2ef79, 0x3ff31879, 0x3ff48ede,
+    0x3ff4d579, 0x3ff54a79, 0x3ff54af9, 0x3ff587ca, 0x3ff58ac6, 0x3ff60539, 0x3ff605b9, 0x3ff63ef9,
+    0x3ff67d39, 0x3ff67eb9, 0x3ff6937a, 0x3ff6a5b9, 0x3ff6a739, 0x3ff6a7b9, 0x3ff6b939, 0x3ff6b9b9,
+    0x3ff6bb39, 0x3ff6ddf9, 0x3ff6f179, 0x3ff72a79, 0x3ff752f9, 0x3ff766da, 0x3ff767da, 0x3ff77ff9,
+    0x3ff7a6f9, 0x3ff7e539, 0x3ff7eb39, 0x3ff80db9, 0x3ff813b9, 0x3ff81439, 0x3ff82139, 0x3ff821b9,
+    0x3ff827b9, 0x3ff88739, 0x3ff88bb9, 0x3ff88d39, 0x3ff89939, 0x3ff89ab9, 0x3ff89f39, 0x3ff8c1b9,
+    0x3ff8c339, 0x3ff8c3b9, 0x3ff8c7b9, 0x3ff8c839, 0x3ff915ba, 0x3ff95839, 0x3ff9cfb9, 0x3ffc6bf9,
+    0x3ffc6d79, 0x3ffc6df9, 0x3ffce579, 0x3ffce6fa, 0x3ffce77a, 0x3ffd0df9, 0x3ffd0f7a, 0x3ffd2179,
+    0x3ffd21f9, 0x3ffd237a, 0x3ffd6039, 0x3ffd9939, 0x3ffd9c39, 0x3ffe15b9, 0x3ffe51f9, 0x3ffe53f9,
+    0x3ffe7a79, 0x3ffe7bf9, 0x3ffe8df9, 0x3ffe8e79, 0x3ffe8ff9, 0x3ffeef7a, 0x3ffef3f9, 0x3ffef57a,
+    0x3fff0179, 0x3fff02fa, 0x3fff037a, 0x3fff07f9, 0x3fff097a, 0x3fff29f9, 0x3fff2b7a, 0x3fff2ff9,
+    0x3fff7f7a, 0x3fff827a, 0x3ffffd3a, 0x4000b179, 0x4000c7ba, 0x40012c7a, 0x40012cfa, 0x40014efa,
+    0x400154fa, 0x400361f9, 0x4003637a, 0x40039c7a, 0x40039f7a, 0x4003c93a, 0x400405f9, 0x40042d3a,
+    0x40047d79, 0x40047f79, 0x4004ce79, 0x4004cff9, 0x4004f8fa, 0x40051f79, 0x40053356, 0x400534d6,
+    0x4005497a, 0x400549fa, 0x40056df9, 0x400570fa, 0x400583d2, 0x400592fa, 0x4005bdba, 0x4005d37a,
+    0x4005d67a, 0x4006513a, 0x400677b9, 0x40069eb9, 0x4006dcf9, 0x4006def9, 0x40070579, 0x400718f9,
+    0x40071979, 0x400780fa, 0x40078e7a, 0x400792f9, 0x4007947a, 0x4007b67a, 0x4007b93a, 0x40084b79,
+    0x4008c2f9, 0x4009b766, 0x400a1d3a, 0x400a59f9, 0x400a6779, 0x400a6bf9, 0x400a923a, 0x400a953a,
+    0x400ad179, 0x400ad379, 0x400ae579, 0x400b23e6, 0x400b853a, 0x400b8779, 0x400bc1f9, 0x400bc5e6,
+    0x400bd366, 0x400bd7e6, 0x400c5439, 0x400d81f9, 0x400dfd7a, 0x400e1f7a, 0x400e257a, 0x400fe37a,
+    0x40109839, 0x4010d679, 0x4011125a, 0x40114df9, 0x40114ff9, 0x4011c7f9, 0x4011eb7a, 0x4011eff9,
+    0x40123e79, 0x401333f9, 0x40133579, 0x401335f9, 0x4014227a, 0x401426f9, 0x4014287a, 0x401479fa,
+    0x4014a0de, 0x4016c339, 0x4016c4ba, 0x4016c53a, 0x4016fff9, 0x401701f9, 0x40175279, 0x4017735a,
+    0x40182fb9, 0x40183139, 0x401831b9, 0x40183f7a, 0x401843f9, 0x4018457a, 0x401845fa, 0x40186cd6,
+    0x4018a4ba, 0x4018a939, 0x4018ab3a, 0x4018b452, 0x4018b752, 0x4018cd3a, 0x4018d1b9, 0x4018d33a,
+    0x40196179, 0x401989f9, 0x4019d8f9, 0x401adafa, 0x401aee7a, 0x401c7539, 0x401c76b9, 0x401c7739,
+    0x401ceeb9, 0x401cf0ba, 0x401d1739, 0x401d18ba, 0x401d193a, 0x401d2ab9, 0x401d2b39, 0x401d2cba,
+    0x401d55f9, 0x401d7e79, 0x401e5b39, 0x401e5d39, 0x401e83b9, 0x401e8539, 0x401e85b9, 0x401e9739,
+    0x401e97b9, 0x401e9939, 0x401ef8ba, 0x401efd39, 0x401eff3a, 0x401f0ab9, 0x401f0cba, 0x401f1139,
+    0x401f3339, 0x401f34ba, 0x401f353a, 0x401f3939, 0x401f39b9, 0x4021357a, 0x4022dd7a, 0x4022df7a,
+    0x40237f7a, 0x4023937a, 0x40240e79, 0x40246df9, 0x4024c4fa, 0x4024f97a, 0x402578fa, 0x40259b7a,
+    0x4025f53a, 0x40263179, 0x402631f9, 0x4026443a, 0x4026593a, 0x40266a3a, 0x40266d3a, 0x4026a979,
+    0x402722fa, 0x402724fa, 0x40275d3a, 0x402775fa, 0x40279cfa, 0x4027c4fa, 0x4027d8fa, 0x402864ba,
+    0x40288f7a, 0x402945b9, 0x40294739, 0x402947b9, 0x4029bf39, 0x4029c0ba, 0x4029c13a, 0x4029d37a,
+    0x4029e7b9, 0x4029e93a, 0x4029fb39, 0x4029fbb9, 0x4029fd3a, 0x402a253a, 0x402a363a, 0x402a393a,
+    0x402a4e79, 0x402a72f9, 0x402a80ba, 0x402a997a, 0x402a9dfa, 0x402aab7a, 0x402ab1fa, 0x402ac1f9,
+    0x402ac679, 0x402b2739, 0x402b2bb9, 0x402b2d39, 0x402b2db9, 0x402b3ffa, 0x402b4fb9, 0x402b5439,
+    0x402b55b9, 0x402b5f7a, 0x402b61b9, 0x402b6339, 0x402b63b9, 0x402b65fa, 0x402b67b9, 0x402b6839,
+    0x402b68fa, 0x402b69b9, 0x402bc93a, 0x402bcdb9, 0x402bcf3a, 0x402bdb39, 0x402bdcba, 0x402bdd3a,
+    0x402bdf7a, 0x402be139, 0x402be1b9, 0x402be33a, 0x402bef7a, 0x402c03b9, 0x402c053a, 0x402c09b9,
+    0x402c437a, 0x402c493a, 0x402c81ba, 0x402c85f9, 0x402c97f9, 0x402c9979, 0x402cbdba, 0x402cbe3a,
+    0x402cc13a, 0x402d76fa, 0x402d78fa, 0x402db13a, 0x402e03fa, 0x402e2c7a, 0x402e2cfa, 0x402eb879,
+    0x402ebc7a, 0x402ee37a, 0x402ee57a, 0x402f0bf9, 0x402f32f9, 0x402f7139, 0x402f72b9, 0x402f7339,
+    0x402f857a, 0x402f877a, 0x402f99b9, 0x402f9b39, 0x402f9bb9, 0x402fad39, 0x402fadb9, 0x402faf39,
+    0x40301339, 0x403014ba, 0x4030153a, 0x403026b9, 0x40302739, 0x403028ba, 0x40303b7a, 0x40304f39,
+    0x40304fb9, 0x4030513a, 0x40306339, 0x40308a3a, 0x40308d3a, 0x4030cafa, 0x4030d479, 0x4030dcfa,
+    0x4030ff7a, 0x4031057a, 0x403105fa, 0x403127f9, 0x40314ef9, 0x40316cfa, 0x40317b39, 0x40317fb9,
+    0x40318139, 0x403181b9, 0x40318d39, 0x40318eb9, 0x40318f39, 0x40319339, 0x403193b9, 0x40319539,
+    0x4031a17a, 0x4031b5b9, 0x4031b739, 0x4031b7b9, 0x4031bbb9, 0x4031bc39, 0x4031bdb9, 0x4031c939,
+    0x4031c9b9, 0x4031cb39, 0x4031cfb9, 0x403220fa, 0x40322f39, 0x403230ba, 0x4032313a, 0x40323539,
+    0x403235b9, 0x403242b9, 0x40324339, 0x403244ba, 0x40324939, 0x40326d3a, 0x4034e079, 0x4034e2ba,
+    0x4034e3f9, 0x4034e6f9, 0x40351eb9, 0x40352339, 0x40354739, 0x40354bb9, 0x40354d39, 0x40355ab9,
+    0x40355b39, 0x40355f39, 0x40355fb9, 0x40356139, 0x40359e39, 0x40359eb9, 0x4035d70a, 0x4035da06,
+    0x4035ff8a, 0x40360286, 0x40363a39, 0x40363eb9, 0x40364039, 0x40364db9, 0x40364e39, 0x40365239,
+    0x403652b9, 0x4036790a, 0x40367c06, 0x403689b9, 0x40369126, 0x4036eef9, 0x4036f1f9, 0x40372d39,
+    0x40372df9, 0x403731b9, 0x40373f39, 0x403767b9, 0x40376939, 0x40376db9, 0x40377f7a, 0x4037acb9,
+    0x4037e886, 0x40383a3a, 0x40385ab9, 0x40385c39, 0x403860b9, 0x40386e16, 0x40386e96, 0x4038727a,
+    0x40389839, 0x40389cb9, 0x4038b1a6, 0x4039283a, 0x40392c79, 0x40392dfa, 0x4039793a, 0x40398efa,
+    0x403991fa, 0x4039a2fa, 0x4039a5fa, 0x4039e439, 0x403a6c3a, 0x403a81fa, 0x403a84fa, 0x403a85b9,
+    0x403a95fa, 0x403a9839, 0x403a98fa, 0x403a99b9, 0x403ad6a6, 0x403ad72a, 0x403af9fa, 0x403b4a39,
+    0x403b4eb9, 0x403b4f7a, 0x403b5039, 0x403b50b9, 0x403b9d7a, 0x403bc239, 0x403c7ff9, 0x403c8079,
+    0x403c8e39, 0x403c907a, 0x403c92b9, 0x403c9439, 0x403cbbb9, 0x403cf379, 0x403cf7f9, 0x403d1bf9,
+    0x403d2079, 0x403d213a, 0x403d21f9, 0x403d2f79, 0x403d2ff9, 0x403d323a, 0x403d33f9, 0x403d3479,
+    0x403d353a, 0x403d35f9, 0x403d58b9, 0x403d5afa, 0x403d5d39, 0x403d5dfa, 0x403d5eb9, 0x403d6cb9,
+    0x403d85b9, 0x403d9a86, 0x403dafa6, 0x403de79a, 0x403deaba, 0x403dec3a, 0x403e00b9, 0x403e1406,
+    0x403e2839, 0x403e3c86, 0x403e8e79, 0x403e9eba, 0x403ea1ba, 0x403ea279, 0x403eaeb9, 0x403eb039,
+    0x403eb4b9, 0x403ed796, 0x403edc16, 0x403eddba, 0x403edf3a, 0x403f01f9, 0x403f0679, 0x403f13f9,
+    0x403f182a, 0x403f1b2a, 0x403f3c79, 0x403f3df9, 0x403f4279, 0x403f7c3a, 0x403f8079, 0x403f81fa,
+    0x403ff6fa, 0x403ff9fa, 0x403ffab9, 0x4040b039, 0x4040d97a, 0x4040e9fa, 0x4040ec39, 0x4040ecfa,
+    0x4040edb9, 0x4040fd7a, 0x40412aa6, 0x40413ca6, 0x40414e7a, 0x40418579, 0x4041b239, 0x4041eab9,
+    0x4041f526, 0x40420139, 0x404202b9, 0x40421339, 0x40421639, 0x404219b9, 0x40421cb9, 0x404226b9,
+    0x40422739, 0x4042d3f9, 0x4042d479, 0x4042e7f9, 0x4042f439, 0x40430fb9, 0x40431b39, 0x40432eb9,
+    0x40433926, 0x40434779, 0x40434bf9, 0x40435979, 0x404381f9, 0x40438379, 0x404383f9, 0x404387f9,
+    0x40438879, 0x404389f9, 0x40439579, 0x404395f9, 0x40439779, 0x40439bf9, 0x4043b27a, 0x4043c0b9,
+    0x4043d67a, 0x404403a6, 0x404415a6, 0x4044277a, 0x40443bb9, 0x40443eba, 0x4044403a, 0x40444bba,
+    0x4044523a, 0x40447c39, 0x4044f679, 0x4045063a, 0x40451a7a, 0x40452bb9, 0x40453039, 0x404531ba,
+    0x4045333a, 0x40453eba, 0x4045453a, 0x404559a6, 0x404567f9, 0x4045963a, 0x4045a3f9, 0x4045a479,
+    0x4045a5f9, 0x4045a83a, 0x4045aa79, 0x40466339, 0x40481f39, 0x40482139, 0x40495079, 0x404950f9,
+    0x404985b9, 0x4049c3f9, 0x4049c879, 0x4049ec79, 0x4049f0f9, 0x4049f279, 0x4049fff9, 0x404a0079,
+    0x404a0479, 0x404a04f9, 0x404a0679, 0x404a2db9, 0x404a680a, 0x404aa439, 0x404b5ef9, 0x404b72f9,
+    0x404b9439, 0x404bd279, 0x404bd6f9, 0x404be479, 0x404c0cf9, 0x404c0e79, 0x404c12f9, 0x404c66b9,
+    0x404cb739, 0x404e37f9, 0x404e4bde, 0x404f00f9, 0x404f0279, 0x404f02f9, 0x404fef79, 0x404ff3f9,
+    0x404ff5f9, 0x40504079, 0x405044f9, 0x40504679, 0x40506779, 0x405081b9, 0x4050a7b9, 0x405110f9,
+    0x405124da, 0x40516279, 0x4051b2f9, 0x4051fdf9, 0x40520279, 0x40520fd6, 0x405211d6, 0x40521656,
+    0x40522679, 0x40522af9, 0x405260d2, 0x40526252, 0x405262d2, 0x405266d2, 0x4052bab9, 0x4053ea79,
+    0x40549e79, 0x40549ff9, 0x405556f9, 0x4055e04a, 0x40562ab9, 0x40564379, 0x405649f9, 0x40565579,
+    0x40565779, 0x40566bf9, 0x40568ff9, 0x4056a679, 0x4056a7f9, 0x4056b879, 0x4056bb79, 0x4056cbf9,
+    0x4056cc79, 0x4056d4fa, 0x4056fbb9, 0x40577779, 0x405778f9, 0x4057b679, 0x405865f9, 0x40586a79,
+    0x4058a96a, 0x40595f39, 0x405a50ba, 0x405addba, 0x405adfaa, 0x405b963a, 0x405bcaba, 0x405c0839,
+    0x405c4679, 0x405c4c79, 0x405c6ef9, 0x405c8279, 0x405c82f9, 0x405cee79, 0x405cfbf9, 0x405d0079,
+    0x405d777a, 0x405da039, 0x405db6ba, 0x405db8aa, 0x405df33a, 0x405e16b9, 0x405e54f9, 0x405e5af9,
+    0x405e6879, 0x405e8f79, 0x405e90f9, 0x405ea379, 0x405ea4f9, 0x405ea73a, 0x405ee63a, 0x405f0a79,
+    0x405f0ef9, 0x405f1c79, 0x405f20aa, 0x405f713a, 0x405f86fa, 0x405f89fa, 0x405f9afa, 0x405f9dfa,
+    0x405fb339, 0x405fdbba, 0x405fdc2a, 0x405ffe3a, 0x405ffefa, 0x406002ba, 0x406016ba, 0x4060f1fa,
+    0x406133f9, 0x4061442a, 0x4061472a, 0x4061957a, 0x4061f879, 0x4061fe79, 0x40620cba, 0x4062263a,
+    0x40623479, 0x406271f9, 0x4062c2f9, 0x4062e9f9, 0x4062eb7a, 0x4062effa, 0x4063193a, 0x40634279,
+    0x40636afa, 0x406374ba, 0x40638d7a, 0x406391fa, 0x40639f7a, 0x4063a5fa, 0x4063d03a, 0x4063e2ba,
+    0x4063e43a, 0x4063f439, 0x40640cf9, 0x40641d2a, 0x4064453a, 0x4064593a, 0x40648079, 0x406493f9,
+    0x40649479, 0x4064a8f9, 0x4064aef9, 0x4064e379, 0x4064e4f9, 0x4064f9fa, 0x4064fe7a, 0x4065127a,
+    0x406513fa, 0x4065383a, 0x40654c3a, 0x40655e79, 0x406562f9, 0x406577fa, 0x4065797a, 0x4065876a,
+    0x40658b7a, 0x40658bea, 0x40658d6a, 0x4065b3fa, 0x40662fba, 0x4066302a, 0x406641ba, 0x406643aa,
+    0x40666aba, 0x406677ba, 0x4067467a, 0x406787aa, 0x4067982a, 0x4067abaa, 0x40680b2a, 0x4068202a,
+    0x406833aa, 0x406839aa, 0x40685e6a, 0x40685fea, 0x4068606a, 0x406872ba, 0x406886ea, 0x4068886a,
+    0x40689a6a, 0x40689aea, 0x40689c6a, 0x4068ad2a, 0x4068d7ea, 0x4068d96a, 0x4068d9ea, 0x4069126a,
+    0x4069156a, 0x4069186a, 0x40691cfa, 0x406928ea, 0x40692a6a, 0x40693aea, 0x40693dea, 0x406943fa,
+    0x40694e6a, 0x40694eea, 0x4069517a, 0x4069b46a, 0x4069befa, 0x4069cc7a, 0x4069d0fa, 0x4069f37a,
+    0x4069f9fa, 0x406a1f7a, 0x406a36ba, 0x406a383a, 0x406a43ba, 0x406a4a3a, 0x406a6eea, 0x406a712a,
+    0x406a9b3a, 0x406aad3a, 0x406ae66a, 0x406ae86a, 0x406af9ea, 0x406afa6a, 0x406b0eea, 0x406b10ea,
+    0x406b26ea, 0x406b2b7a, 0x406b4b6a, 0x406b667a, 0x406b67fa, 0x406b79fa, 0x406b8e3a, 0x406ba03a,
+    0x406bdb6a, 0x406bdf7a, 0x406bdfea, 0x406be16a, 0x406becfa, 0x406bed6a, 0x406beeea, 0x406bf36a,
+    0x406c1bfa, 0x406dc639, 0x406e0386, 0x406e8c39, 0x406e9239, 0x406f07b9, 0x406f0ab9, 0x406fc1f9,
+    0x406fc279, 0x40703579, 0x407039f9, 0x40705df9, 0x40706279, 0x407063f9, 0x40707179, 0x407071f9,
+    0x407075f9, 0x40707679, 0x407077f9, 0x40709ab9, 0x4070a0b9, 0x4070dc86, 0x4070e739, 0x4071d079,
+    0x4071e479, 0x407205b9, 0x40720a39, 0x407243f9, 0x40724879, 0x407255f9, 0x40727e79, 0x40727ff9,
+    0x40728479, 0x4072d1b9, 0x40735039, 0x407407f9, 0x40741a39, 0x4074a979, 0x4074bbde, 0x4074bd5e,
+    0x40756df9, 0x407573f9, 0x40757479, 0x407660f9, 0x40766579, 0x407666f9, 0x4076b1f9, 0x4076b679,
+    0x4076b7f9, 0x4076dc79, 0x4076df79, 0x4076f4b9, 0x40773086, 0x407753f9, 0x40777c79, 0x40778279,
+    0x40778fda, 0x4077905a, 0x407794da, 0x4077965a, 0x40782479, 0x407837c6, 0x40784bf9, 0x40785e39,
+    0x40786f79, 0x407873f9, 0x40787579, 0x40788156, 0x407882d6, 0x407897f9, 0x40789c79, 0x4078d252,
+    0x4078d3d2, 0x4078d452, 0x4078d852, 0x4078d8d2, 0x4079a439, 0x407a5bf9, 0x407b0ff9, 0x407b1179,
+    0x407b3439, 0x407b5b39, 0x407b9979, 0x407bc1f9, 0x407bc879, 0x407bd579, 0x407bd5f9, 0x407cb4f9,
+    0x407cc6f9, 0x407cc879, 0x407cdd79, 0x407d17f9, 0x407d1979, 0x407d3379, 0x407de479, 0x407dea79,
+    0x407e6346, 0x407e9ff9, 0x407f4f79, 0x407f53f9, 0x4080d879, 0x40824479, 0x408244f9, 0x40833179,
+    0x408335f9, 0x408452f9, 0x40853ff9, 0x40854479, 0x408553d6, 0x40858c79, 0x408689f9, 0x40868a79,
+    0x408776f9, 0x40877b79, 0x408a1339, 0x408a17b9, 0x408a1939, 0x408a19b9, 0x408aa6f9, 0x408acada,
+    0x408acb5a, 0x408ace5a, 0x408b85b9, 0x408b8639, 0x408b93f9, 0x408b9879, 0x408bf939, 0x408bfdb9,
+    0x408c0f52, 0x408c21b9, 0x408c2639, 0x408c27b9, 0x408cde79, 0x408fcb39, 0x408fcbb9, 0x408fd979,
+    0x408ffd79, 0x40900079, 0x40903eb9, 0x40904339, 0x40906739, 0x40906bb9, 0x40906d39, 0x40906db9,
+    0x40907939, 0x40907ab9, 0x40907b39, 0x40907f39, 0x40907fb9, 0x40908139, 0x40911f79, 0x40912279,
+    0x4091d9b9, 0x4091da39, 0x4091edb9, 0x40924d39, 0x409251b9, 0x40925f39, 0x409287b9, 0x40928939,
+    0x409289b9, 0x40928db9, 0x40928e39, 0x40928fb9, 0x409475f9, 0x40954079, 0x4095b3f9, 0x40974ef9,
+    0x40975c79, 0x4097c279, 0x4099f979, 0x409b65f9, 0x409c95b9, 0x409c9bb9, 0x409c9c39, 0x409ca9f9,
+    0x409d0f39, 0x409d13b9, 0x409d1539, 0x409d37b9, 0x409d3c39, 0x409d3db9, 0x409d4b39, 0x409d4bb9,
+    0x409d4fb9, 0x409d5039, 0x409d51b9, 0x409da2f9, 0x409df3fa, 0x409e1679, 0x409e7bb9, 0x409e81b9,
+    0x409ea439, 0x409eaa39, 0x409eb7b9, 0x409eb839, 0x409ebe39, 0x409f1db9, 0x409f2239, 0x409f23b9,
+    0x409f2fb9, 0x409f3139, 0x409f35b9, 0x409f5839, 0x409f59b9, 0x409f5bfa, 0x409f5e39, 0x409f84d6,
+    0x409f87d6, 0x409f97fa, 0x409f9d96, 0x409fb116, 0x40a0023a, 0x40a012ba, 0x40a015ba, 0x40a0263a,
+    0x40a0f396, 0x40a0f516, 0x40a10596, 0x40a10896, 0x40a11916, 0x40a16a3a, 0x40a17cfa, 0x40a1817a,
+    0x40a182fa, 0x40a18efa, 0x40a1907a, 0x40a194fa, 0x40a1b9f9, 0x40a1e279, 0x40a21aba, 0x40a2457a,
+    0x40a25bf9, 0x40a282f9, 0x40a2c139, 0x40a2c739, 0x40a2e9b9, 0x40a2efb9, 0x40a2f039, 0x40a2fd39,
+    0x40a2fdb9, 0x40a303b9, 0x40a336f9, 0x40a36339, 0x40a367b9, 0x40a36939, 0x40a37539, 0x40a376b9,
+    0x40a37b39, 0x40a3897a, 0x40a39db9, 0x40a39f39, 0x40a39fb9, 0x40a3a3b9, 0x40a3a439, 0x40a3a5b9,
+    0x40a3b139, 0x40a3b1b9, 0x40a3b339, 0x40a3b7b9, 0x40a3ce16, 0x40a3de96, 0x40a3e196, 0x40a3f216,
+    0x40a41f7a, 0x40a4433a, 0x40a455fa, 0x40a45a7a, 0x40a45bfa, 0x40a4697a, 0x40a46dfa, 0x40a4cfb9,
+    0x40a4d5b9, 0x40a4e339, 0x40a50bb9, 0x40a50c39, 0x40a51239, 0x40a51fb9, 0x40a53616, 0x40a548d6,
+    0x40a54d56, 0x40a54ed6, 0x40a55ad6, 0x40a55c56, 0x40a560d6, 0x40a583b9, 0x40a58539, 0x40a5877a,
+    0x40a589b9, 0x40a59739, 0x40a5abfa, 0x40a5ad7a, 0x40a5b1fa, 0x40a5bfb9, 0x40a5c039, 0x40a5c1b9,
+    0x40a5c3fa, 0x40a5c639, 0x40a6ba39, 0x40a7c0a6, 0x40a87539, 0x40a87839, 0x40a87926, 0x40a92df9,
+    0x40a92ff9, 0x40a95679, 0x40a957f9, 0x40a969f9, 0x40a96a79, 0x40a96bf9, 0x40a9cb7a, 0x40a9cff9,
+    0x40a9d17a, 0x40a9dd79, 0x40a9defa, 0x40a9df7a, 0x40a9e3f9, 0x40aa05f9, 0x40aa077a, 0x40aa0bf9,
+    0x40aa19f9, 0x40aa5a7a, 0x40aa99a6, 0x40aa9ba6, 0x40aac23a, 0x40aad63a, 0x40ab3c79, 0x40ab5079,
+    0x40ab7879, 0x40ab8a3a, 0x40abc93a, 0x40abebf9, 0x40abed7a, 0x40abfff9, 0x40ac03a6, 0x40ac27f9,
+    0x40ac543a, 0x40ac69fa, 0x40ac6cfa, 0x40ac7dfa, 0x40ac80fa, 0x40aca986, 0x40acbdb9, 0x40acbea6,
+    0x40ace13a, 0x40ace1fa, 0x40ace5ba, 0x40ace73a, 0x40acf93a, 0x40ad0e39, 0x40ad2306, 0x40ad7579,
+    0x40add4fa, 0x40ae16fa, 0x40ae273a, 0x40ae2979, 0x40ae2a3a, 0x40ae2afa, 0x40ae4f3a, 0x40ae787a,
+    0x40ae8f86, 0x40aee1f9, 0x40af093a, 0x40af5979, 0x40afaa79, 0x40afabf9, 0x40afbf46, 0x40afd379,
+    0x40affb79, 0x40affcfa, 0x40b00f79, 0x40b0257a, 0x40b049f9, 0x40b04cfa, 0x40b04de6, 0x40b05ff9,
+    0x40b0aeb9, 0x40b0c2b9, 0x40b0c5ba, 0x40b0c73a, 0x40b0e9f9, 0x40b0eab9, 0x40b0ee79, 0x40b0fdf9,
+    0x40b10279, 0x40b1283a, 0x40b13c3a, 0x40b167f9, 0x40b16979, 0x40b17bf9, 0x40b17d79, 0x40b19079,
+    0x40b1a546, 0x40b1b679, 0x40b1b979, 0x40b1cc79, 0x40b1f4fa, 0x40b1f57a, 0x40b1f6fa, 0x40b21779,
+    0x40b21d79, 0x40b22b56, 0x40b22f3a, 0x40b23156, 0x40b2417a, 0x40b25afa, 0x40b25c66, 0x40b268fa,
+    0x40b26a7a, 0x40b26d79, 0x40b26e66, 0x40b26efa, 0x40b27066, 0x40b27bd2, 0x40b290fa, 0x40b296fa,
+    0x40b311a6, 0x40b312a6, 0x40b324a6, 0x40b38b26, 0x40b3d6e6, 0x40b4297a, 0x40b47d66, 0x40b47ee6,
+    0x40b4f7a6, 0x40b54366, 0x40b56b66, 0x40b5bce6, 0x40b5ffe6, 0x40b61de6, 0x40b620e6, 0x40b62766,
+    0x40b66366, 0x40b664e6, 0x40b69de6, 0x40b6a0e6, 0x40b6a1e6, 0x40b6af66, 0x40b6b3e6, 0x40b7027a,
+    0x40b716a6, 0x40b719ba, 0x40b71b3a, 0x40b726ba, 0x40b72d3a, 0x40b743a6, 0x40b751e6, 0x40b75666,
+    0x40b757e6, 0x40b767a6, 0x40b77e3a, 0x40b7903a, 0x40b7c966, 0x40b7cb66, 0x40b7cfe6, 0x40b7d166,
+    0x40b80a66, 0x40b80d66, 0x40b80e66, 0x40b82066, 0x40b8497a, 0x40b84afa, 0x40b85cfa, 0x40b8713a,
+    0x40b87f66, 0x40b880e6, 0x40b8833a, 0x40b88566, 0x40b8aba6, 0x40b8bce6, 0x40b8be7a, 0x40b8c166,
+    0x40b8c266, 0x40b8c2fa, 0x40b8cfe6, 0x40b8d07a, 0x40b8d666, 0x40b8f87a, 0x40b8fefa, 0x40bbb279,
+    0x40bc29f9, 0x40bc2bf9, 0x40bcc77a, 0x40bccbf9, 0x40bcdb7a, 0x40bcdff9, 0x40bdd2f9, 0x40be3879,
+    0x40be86f9, 0x40bee7f9, 0x40bff7f9, 0x40c01c3a, 0x40c02fba, 0x40c18afa, 0x40c30bb9, 0x40c30d39,
+    0x40c30db9, 0x40c31b7a, 0x40c380ba, 0x40c38539, 0x40c3873a, 0x40c3a93a, 0x40c3adb9, 0x40c3af3a,
+    0x40c3bcba, 0x40c3bd3a, 0x40c3befa, 0x40c3c139, 0x40c3c1b9, 0x40c3c33a, 0x40c424ca, 0x40c427c6,
+    0x40c438f9, 0x40c460f9, 0x40c463fa, 0x40c48c79, 0x40c4f1b9, 0x40c4f3b9, 0x40c51a39, 0x40c51bb9,
+    0x40c52db9, 0x40c52e39, 0x40c52fb9, 0x40c567d6, 0x40c58f3a, 0x40c593b9, 0x40c5a139, 0x40c5a33a,
+    0x40c5a7b9, 0x40c5c9b9, 0x40c5cb3a, 0x40c5cfb9, 0x40c6097a, 0x40c60f3a, 0x40c64bf9, 0x40c683ba,
+    0x40c6843a, 0x40c6873a, 0x40c6c579, 0x40c73e7a, 0x40c7773a, 0x40c7b87a, 0x40c7f27a, 0x40c7fffa,
+    0x40c801fa, 0x40c831f9, 0x40c8b85a, 0x40c8bcfa, 0x40c93739, 0x40c93939, 0x40c95fb9, 0x40c96139,
+    0x40c961b9, 0x40c97339, 0x40c973b9, 0x40c97539, 0x40c9afd6, 0x40c9d4ba, 0x40c9d939, 0x40c9db3a,
+    0x40c9e6b9, 0x40c9e8ba, 0x40c9ed39, 0x40ca00fa, 0x40ca0f39, 0x40ca10ba, 0x40ca113a, 0x40ca1539,
+    0x40ca15b9, 0x40ca173a, 0x40ca22b9, 0x40ca2339, 0x40ca24ba, 0x40ca2939, 0x40ca503a, 0x40ca533a,
+    0x40ca8cf9, 0x40ca917a, 0x40cac8f9, 0x40cacb7a, 0x40cacbfa, 0x40cacd7a, 0x40cad8da, 0x40cadada,
+    0x40cadf7a, 0x40cb45b9, 0x40cb47b9, 0x40cb59b9, 0x40cb81b9, 0x40cb8239, 0x40cb83b9, 0x40cb95b9,
+    0x40cbbe56, 0x40cbbefa, 0x40cbc056, 0x40cbcbd6, 0x40cbd256, 0x40cbf539, 0x40cbf73a, 0x40cbf97a,
+    0x40cbfbb9, 0x40cc0939, 0x40cc1cfa, 0x40cc1efa, 0x40cc237a, 0x40cc3139, 0x40cc31b9, 0x40cc333a,
+    0x40cc357a, 0x40cc37b9, 0x40ccc7ba, 0x40ce2fba, 0x40ceea62, 0x40cfa0fa, 0x40cfc7fa, 0x40cfd57a,
+    0x40d003e2, 0x40d054fa, 0x40d0777a, 0x40d0ce3a, 0x40d108ba, 0x40d16a62, 0x40d16be2, 0x40d17de2,
+    0x40d1af7a, 0x40d1c17a, 0x40d1fdfa, 0x40d2637a, 0x40d2717a, 0x40d272fa, 0x40d2777a, 0x40d2d9fa,
+    0x40d32c3a, 0x40d3543a, 0x40d408fa, 0x40d40d7a, 0x40d40efa, 0x40d4217a, 0x40d4967a, 0x40d49a7a,
+    0x40d49afa, 0x40d49c7a, 0x40d4bcfa, 0x40d4be7a, 0x40d4c2fa, 0x40d4d07a, 0x40d5013a, 0x40d55cba,
+    0x40d5757a, 0x40d579fa, 0x40d57b7a, 0x40d5877a, 0x40d58dfa, 0x40d59df9, 0x40d60339, 0x40d607b9,
+    0x40d60939, 0x40d609b9, 0x40d6177a, 0x40d61bfa, 0x40d62bb9, 0x40d63039, 0x40d631b9, 0x40d63f39,
+    0x40d63fb9, 0x40d643b9, 0x40d64439, 0x40d645b9, 0x40d6a53a, 0x40d6a9b9, 0x40d6ab3a, 0x40d6b739,
+    0x40d6b8ba, 0x40d6b93a, 0x40d6bd39, 0x40d6bdb9, 0x40d6bf3a, 0x40d6cb7a, 0x40d6dfb9, 0x40d6e37a,
+    0x40d6e5b9, 0x40d6f3b9, 0x40d7203a, 0x40d7343a, 0x40d75cf9, 0x40d75ffa, 0x40d7617a, 0x40d76f7a,
+    0x40d770f9, 0x40d7737a, 0x40d773fa, 0x40d7757a, 0x40d795fa, 0x40d7977a, 0x40d79bfa, 0x40d7a97a,
+    0x40d7affa, 0x40d7be79, 0x40d7bff9, 0x40d7e779, 0x40d811b9, 0x40d81639, 0x40d817b9, 0x40d823b9,
+    0x40d82539, 0x40d825b9, 0x40d829b9, 0x40d82a39, 0x40d82bb9, 0x40d84c39, 0x40d84db9, 0x40d85239,
+    0x40d85fb9, 0x40d86039, 0x40d861b9, 0x40d863fa, 0x40d88efa, 0x40d8a2fa, 0x40d8b77a, 0x40d8c5b9,
+    0x40d8c73a, 0x40d8c97a, 0x40d8cbb9, 0x40d8d939, 0x40d8d9b9, 0x40d8db3a, 0x40d8dd7a, 0x40d8dfb9,
+    0x40d901b9, 0x40e38da2, 0x40e4e221, 0x40e88a19, 0x40e88ba5, 0x40e8b299, 0x40e8b419, 0x40e8b499,
+    0x40e8c699, 0x40e90395, 0x40e90515, 0x40e93e0a, 0x40e97a09, 0x40e9a7a6, 0x40e9e00a, 0x40ea5755,
+    0x40ea5805, 0x40ea5bd5, 0x40ea5d55, 0x40ea5dd5, 0x40ea7156, 0x40eaaa6a, 0x40ead099, 0x40ead249,
+    0x40ead519, 0x40eb1415, 0x40ebc395, 0x40ebc565, 0x40ebc826, 0x40ec00a5, 0x40ec0525, 0x40ec06a6,
+    0x40ec072a, 0x40ec1aa6, 0x40ec4125, 0x40ef5795, 0x40efcf85, 0x40f04926, 0x40f0bed5, 0x40f0f7c9,
+    0x40f1ae09, 0x40f1b105, 0x40f1b585, 0x40f226c9, 0x40f266a5, 0x40f26826, 0x40f2a2a5, 0x40f5d422,
+    0x40f7de15, 0x40f7f1a2, 0x40f7f215, 0x40f80691, 0x40f84291, 0x40fcb5e9, 0x40fcb769, 0x40fcb7e9,
+    0x40fd2f69, 0x40fd57e9, 0x40fd5969, 0x40fd59e9, 0x40fd6909, 0x40fd6989, 0x40fd6b69, 0x40fd6be9,
+    0x40fd6c85, 0x40fd6d69, 0x40fd9545, 0x40fda5d6, 0x40fda956, 0x40fde119, 0x40fde599, 0x40fde7aa,
+    0x40fe0999, 0x40fe0e19, 0x40fe0f99, 0x40fe1019, 0x40fe2199, 0x40fe2219, 0x40fe2399, 0x40fe3211,
+    0x40fe9769, 0x40febfe9, 0x40fec669, 0x40fed369, 0x40fed3e9, 0x40fed589, 0x40fed609, 0x40fed905,
+    0x40fefc95, 0x40fefd45, 0x40ff0115, 0x40ff0296, 0x40ff032a, 0x40ff1696, 0x40ff3e86, 0x40ff4faa,
+    0x40ff5286, 0x40ff75e9, 0x40ff7789, 0x40ff7809, 0x40ff7a69, 0x40ff7b05, 0x41030b69, 0x41030be9,
+    0x41038369, 0x41038569, 0x41039769, 0x4103bf69, 0x4103bfe9, 0x4103d369, 0x41046f99, 0x41047119,
+    0x4104eb69, 0x4104efe9, 0x4104f1e9, 0x4104ff69, 0x410525e9, 0x41052769, 0x410527e9, 0x410539e9,
+    0x41053b69, 0x41059d09, 0x4105d909, 0x410ba221, 0x4110ca59, 0x41110599, 0x41110a19, 0x41110b99,
+    0x41110c2a, 0x41111799, 0x41111919, 0x41111faa, 0x41114019, 0x41114199, 0x41114619, 0x41114819,
+    0x41115399, 0x41115419, 0x41115599, 0x41117f15, 0x41117fc5, 0x41118395, 0x41118515, 0x41118595,
+    0x41119915, 0x4111bbe9, 0x4111c069, 0x4111c1e9, 0x4111c269, 0x4111f869, 0x4111fa09, 0x4111fa89,
+    0x4111fce9, 0x4111fd85, 0x4111fe69, 0x41121069, 0x41123495, 0x41123515, 0x41126d89, 0x411271e9,
+    0x41128109, 0x4112a989, 0x4112aa09, 0x4112ad05, 0x4112ade9, 0x41176b99, 0x41176d19, 0x4117a799,
+    0x4117a819, 0x4117a999, 0x411821e9, 0x41182369, 0x411823e9, 0x411827e9, 0x41184a11, 0x41189a95,
+    0x4118d509, 0x411c0899, 0x411c4795, 0x411cbc89, 0x411d220a, 0x411dee22, 0x411e67a2, 0x4121f795,
+    0x4121f915, 0x41224a11, 0x4122ab8a, 0x41232779, 0x412328e5, 0x41232965, 0x4123a0e6, 0x4123c966,
+    0x4123cae6, 0x4123cb66, 0x4123dce6, 0x4123dd66, 0x4123dee6, 0x4124199a, 0x41247d09, 0x412537e5,
+    0x4125c2e6, 0x4125e765, 0x4125ebe6, 0x4128ff8a, 0x41297785, 0x41297b79, 0x41297ce5, 0x412990e5,
+    0x4129f4e6, 0x412a30e6, 0x412a44e6, 0x412b5ce5, 0x412b5d85, 0x412b6179, 0x412ff962, 0x412ff9e1,
+    0x41307162, 0x413099e1, 0x41309b61, 0x4130ad62, 0x4130ade1, 0x4130ea22, 0x41317411, 0x4131d962,
+    0x413201e1, 0x41321562, 0x413215e1, 0x41375516, 0x4137ba6d, 0x413804ed, 0x4138ac2e, 0x4138bd16,
+    0x4138bed6, 0x4138fc6e, 0x4139226d, 0x413924ee, 0x4139266e, 0x413926ee, 0x413d2b4a, 0x413e97ca,
+    0x413f4bed, 0x413f866d, 0x413f87ed, 0x414515e2, 0x414ac7da, 0x414af0da, 0x414ba2ed, 0x414ba77a,
+    0x414ba8ed, 0x414ba96d, 0x414bbced, 0x414c1c6d, 0x414c2e6d, 0x414c2fed, 0x414c56ed, 0x414c586d,
+    0x414c58ed, 0x4151c9c9, 0x4151cfc9, 0x415283ed, 0x4152be6d, 0x4152beed, 0x4152c06d, 0x415c96e5,
+    0x415d38e6, 0x415da749, 0x415dad49, 0x415dbac9, 0x415de899, 0x415ded19, 0x415deea6, 0x415def19,
+    0x415dfc26, 0x415e02a6, 0x415e2319, 0x415e2499, 0x415e2919, 0x415e3699, 0x415ea565, 0x415edfe5,
+    0x415f1615, 0x415f1c25, 0x415f2995, 0x415f5089, 0x415f54fa, 0x415f5966, 0x415f6426, 0x4162fe65,
+    0x41644e99, 0x41645026, 0x416506e5, 0x41651ee5, 0x41657d95, 0x416b8162, 0x416b8361, 0x416ba9e1,
+    0x416bbde1, 0x416f90d5, 0x4170bfed, 0x4170c06d, 0x4170c1f9, 0x4170e495, 0x4170e915, 0x4170ea96,
+    0x4170eb15, 0x4170fe96, 0x41712686, 0x417127d9, 0x41713789, 0x41713a86, 0x41715989, 0x41715f89,
+    0x41716009, 0x41716305, 0x41716d19, 0x4171acd5, 0x4171ebed, 0x4171f06d, 0x4171f26d, 0x4172146d,
+    0x417218ed, 0x41721a6d, 0x41721aed, 0x417227ed, 0x41722c6d, 0x41722ced, 0x41722e6d, 0x41725296,
+    0x41725309, 0x41728df9, 0x4172926d, 0x41729479, 0x41729fed, 0x4172a66d, 0x4172c86d, 0x4172ce6d,
+    0x4172ceed, 0x4172d079, 0x41778509, 0x41778806, 0x4177c109, 0x41787a6d, 0x41787bed, 0x4178b416,
+    0x4178f3ed, 0x417907ed, 0x41792fed, 0x4179306d, 0x41841b15, 0x41841c95, 0x41842119, 0x41842e95,
+    0x41845589, 0x41846909, 0x41849189, 0x4184d509, 0x4184d589, 0x4185106d, 0x41851105, 0x418514ed,
+    0x4185166d, 0x418516ed, 0x4185226d, 0x418523ed, 0x41852a6d, 0x41854aed, 0x41854c6d, 0x418550ed,
+    0x4185516d, 0x418552ed, 0x41855e6d, 0x41855eed, 0x4185606d, 0x41858509, 0x4185c46d, 0x4185c5f9,
+    0x4185c679, 0x4185d7ed, 0x4185d86d, 0x4186006d, 0x418600ed, 0x41860279, 0x418b73ee, 0x418b766d,
+    0x418b77ed, 0x418bb26d, 0x418bb2ed, 0x418bb46d, 0x418c2bed, 0x418f22a9, 0x418f9c15, 0x41913ea9,
+    0x419142a2, 0x4191b815, 0x4191bc22, 0x4192fe89, 0x41930185, 0x41932955, 0x41932ae6, 0x41932b6a,
+    0x41936619, 0x41937a51, 0x41937bd1, 0x41937c51, 0x41938c49, 0x41938e99, 0x41939019, 0x41939099,
+    0x4193a21a, 0x4193a29a, 0x4193dfa5, 0x4193e115, 0x41941a0a, 0x41943211, 0x41945609, 0x41946d65,
+    0x41946ee6, 0x41946f65, 0x4194d2a5, 0x4194fb25, 0x4194fca5, 0x4194fd25, 0x41954c15, 0x41954d95,
+    0x41954e15, 0x41959ac9, 0x41959dc5, 0x41959e91, 0x4195c599, 0x4195c719, 0x4195c799, 0x41967be5,
+    0x41967d65, 0x41967de5, 0x4196f566, 0x4196f766, 0x419709a5, 0x41970b25, 0x41970ba5, 0x41971de6,
+    0x41971f66, 0x41971fe6, 0x41973166, 0x419731e6, 0x41973366, 0x41973d49, 0x419741d1, 0x41974651,
+    0x419747e6, 0x4197486a, 0x41975615, 0x41975c95, 0x41976815, 0x41976995, 0x41976a15, 0x41976e1a,
+    0x41977e91, 0x4197a289, 0x4197ab99, 0x4197b6c9, 0x4197b9c5, 0x4197cb09, 0x4197cf99, 0x4197d419,
+    0x4197d599, 0x4197d619, 0x4197de9a, 0x4197df1a, 0x4197e199, 0x4197e319, 0x4197f811, 0x41981c09,
+    0x41985d65, 0x419885e5, 0x41988be5, 0x41988c65, 0x41989589, 0x419897e5, 0x41989885, 0x41989965,
+    0x419899e5, 0x41989fe5, 0x4198a9c9, 0x4198acc5, 0x4198c295, 0x4198c725, 0x4198c925, 0x4198d495,
+    0x4198d615, 0x4198ff65, 0x419905e6, 0x41990f09, 0x41991165, 0x41991226, 0x41991766, 0x41992591,
+    0x41992711, 0x41993789, 0x419939e5, 0x41993a85, 0x41993b65, 0x41993be5, 0x41994066, 0x4199ba19,
+    0x4199f619, 0x419a0a1a, 0x419a3395, 0x419ba015, 0x419bb415, 0x419bb595, 0x419beea9, 0x419c6809,
+    0x419ca969, 0x419ccc05, 0x419ccfe5, 0x419cd165, 0x419cd1e5, 0x419ce3e5, 0x419ce565, 0x419d45a6,
+    0x419d4966, 0x419d4ae6, 0x419d4b66, 0x419d5d66, 0x419d8566, 0x419d9966, 0x419dbc15, 0x419dbd95,
+    0x419dd015, 0x419dd195, 0x419df689, 0x419e0aa9, 0x419e3289, 0x419e7009, 0x419e8409, 0x419eb165,
+    0x419eb5e5, 0x419eb7e9, 0x419ec569, 0x419eebe5, 0x419eed65, 0x419eede5, 0x419ef1e5, 0x419ef265,
+    0x419effe5, 0x419f0165, 0x419f05e5, 0x419f6565, 0x419f66e5, 0x419f6769, 0x419f7969, 0x419fa165,
+    0x41a036a2, 0x41a05f19, 0x41a06099, 0x41a0b1a2, 0x41a10291, 0x41a21ca2, 0x41a21e22, 0x41a21e95,
+    0x41a26f11, 0x41a34de2, 0x41a34e61, 0x41a3c5e2, 0x41a3ee61, 0x41a3efe1, 0x41a401e2, 0x41a40dc9,
+    0x41a42695, 0x41a438a2, 0x41a43a95, 0x41a43ea2, 0x41a44f11, 0x41a4c891, 0x41a52de2, 0x41a55661,
+    0x41a55c61, 0x41a569e2, 0x41a56a61, 0x41a5cfe1, 0x41a5d461, 0x41a66229, 0x41a6dd2a, 0x41a7160a,
+    0x41a79369, 0x41a793e9, 0x41a7a3ea, 0x41a7a6ea, 0x41a7ceaa, 0x41a7d016, 0x41a7d0aa, 0x41a80b69,
+    0x41a81faa, 0x41a8212a, 0x41a821aa, 0x41a831aa, 0x41a833e9, 0x41a83569, 0x41a835e9, 0x41a8475e,
+    0x41a847de, 0x41a8fe69, 0x41a8ffe9, 0x41a90069, 0x41aa402a, 0x41aa432a, 0x41aa6aea, 0x41aa6c6a,
+    0x41aa6cea, 0x41aa7aa9, 0x41aa9ea9, 0x41aaa916, 0x41aadfe9, 0x41aafa2a, 0x41ab0869, 0x41ab0ee9,
+    0x41ab1a5a, 0x41ab1bda, 0x41ab1c5a, 0x41ab5969, 0x41abce69, 0x41abd169, 0x41abebaa, 0x41abed16,
+    0x41abedaa, 0x41abfdaa, 0x41ac1356, 0x41ac4c6a, 0x41ac50ea, 0x41ac74ea, 0x41ac76e9, 0x41ac796a,
+    0x41ac7aea, 0x41ac7b6a, 0x41acb615, 0x41ade5dd, 0x41ade75d, 0x41ade7dd, 0x41adf9dd, 0x41adfb5d,
+    0x41ae5f5d, 0x41ae6169, 0x41ae7369, 0x41ae9b5d, 0x41ae9bdd, 0x41aeaf5e, 0x41aeea89, 0x41af2be9,
+    0x41af5259, 0x41af53d9, 0x41af5459, 0x41af6659, 0x41af67d9, 0x41afa555, 0x41b0064a, 0x41b01a49,
+    0x41b07fca, 0x41b0f289, 0x41b10689, 0x41b133d9, 0x41b147e9, 0x41b16e59, 0x41b16fd9, 0x41b17059,
+    0x41b1825a, 0x41b183da, 0x41b1ad55, 0x41b1c155, 0x41b22249, 0x41b22545, 0x41b23649, 0x41b29bc9,
+    0x41b29ec5, 0x41b36e9a, 0x41b5ce99, 0x41b65c91, 0x41b86a62, 0x41b87891, 0x41b97259, 0x41b973d9,
+    0x41b97459, 0x41b9c10a, 0x41b9d799, 0x41ba0019, 0x41ba0199, 0x41ba0219, 0x41ba2649, 0x41ba2945,
+    0x41ba4f85, 0x41ba5115, 0x41ba5295, 0x41ba5315, 0x41ba8ddd, 0x41ba8f5d, 0x41ba8fe9, 0x41baa211,
+    0x41baa391, 0x41baa411, 0x41bab409, 0x41bab65d, 0x41bab7dd, 0x41bab85d, 0x41bac9dd, 0x41baca5d,
+    0x41bb969a, 0x41bbbb1a, 0x41bbfa5a, 0x41bbfbda, 0x41bbfc5a, 0x41bc0e99, 0x41bc1019, 0x41bc1099,
+    0x41bc22da, 0x41bc245a, 0x41bc24da, 0x41bc365a, 0x41bc36da, 0x41bc385a, 0x41bc73d5, 0x41bc7555,
+    0x41bc75d5, 0x41bcae4a, 0x41bcc289, 0x41bcc585, 0x41bcea49, 0x41bceac9, 0x41bcebc5, 0x41bced69,
+    0x41bceee9, 0x41bcef69, 0x41bdaec9, 0x41bdb1c5, 0x41bdc795, 0x41bdcc19, 0x41bdce19, 0x41bdd689,
+    0x41bdd709, 0x41bdd805, 0x41bdd995, 0x41bddb15, 0x41be0459, 0x41be1659, 0x41be17d9, 0x41be1869,
+    0x41be1c5a, 0x41be2a91, 0x41be2c11, 0x41be3ed9, 0x41be4059, 0x41be455a, 0x41be525a, 0x41be52da,
+    0x41be545a, 0x41be6e11, 0x41be6f91, 0x41be7011, 0x41be7dd5, 0x41be8009, 0x41be8fd5, 0x41be9155,
+    0x41be91d5, 0x41beca49, 0x41bed369, 0x41bed4e9, 0x41bed56a, 0x41bef2c9, 0x41bef769, 0x41befbe9,
+    0x41befd69, 0x41befde9, 0x41bf0649, 0x41bf06c9, 0x41bf07c5, 0x41bf0969, 0x41bf0ae9, 0x41bf1d91,
+    0x41bf1f11, 0x41bf2f89, 0x41bf6c49, 0x41bf70e9, 0x41bf82e9, 0x41bf8469, 0x41bfab69, 0x41bface9,
+    0x41c0021a, 0x41c0f769, 0x41c11ddd, 0x41c11e5d, 0x41c131dd, 0x41c2229a, 0x41c2241a, 0x41c24e5a,
+    0x41c24fda, 0x41c2625a, 0x41c263da, 0x41c27699, 0x41c28a5a, 0x41c28ada, 0x41c28c5a, 0x41c29e5a,
+    0x41c2c7d5, 0x41c2c955, 0x41c2dbd5, 0x41c2dd55, 0x41c31669, 0x41c33e49, 0x41c33fc5, 0x41c34169,
+    0x41c34369, 0x41c35569, 0x41c42a89, 0x41c42c05, 0x41c46a59, 0x41c46bd9, 0x41c46c69, 0x41c47e69,
+    0x41c47fe9, 0x41c49291, 0x41c4a659, 0x41c4a6d9, 0x41c4e3d5, 0x41c4e555, 0x41c4e5d5, 0x41c4f7d5,
+    0x41c4f955, 0x41c53269, 0x41c55a49, 0x41c55ac9, 0x41c55bc5, 0x41c55d69, 0x41c55f69, 0x41c563e9,
+    0x41c57169, 0x41c5d3c9, 0x41c5d469, 0x41c5d545, 0x41c61369, 0x41c6e49a, 0x41c72395, 0x41c79889,
+    0x41c89015, 0x41c9bfe1, 0x41ca3762, 0x41ca38e2, 0x41ca5fe6, 0x41ca7362, 0x41ca73e6, 0x41caac15,
+    0x41cab022, 0x41cbc7e1, 0x41cbdbe1, 0x41cc5962, 0x41ccd3a5, 0x41cd4f26, 0x41cd878a, 0x41ce04e5,
+    0x41ce0565, 0x41ce4216, 0x41ce7ce6, 0x41cea566, 0x41cea6e6, 0x41cea766, 0x41ceb8de, 0x41ceb95e,
+    0x41cf6fe5, 0x41cf7165, 0x41cf71e5, 0x41d0d966, 0x41d0ec25, 0x41d11025, 0x41d11b16, 0x41d15165,
+    0x41d16c26, 0x41d179e5, 0x41d18065, 0x41d18bda, 0x41d18d5a, 0x41d18dda, 0x41d1cae5, 0x41d23fe5,
+    0x41d25f16, 0x41d284d6, 0x41d2bde6, 0x41d2c0e6, 0x41d2e866, 0x41d32795, 0x41d3db8a, 0x41d45779,
+    0x41d458dd, 0x41d46cdd, 0x41d4d0e6, 0x41d4d266, 0x41d50ce6, 0x41d50d66, 0x41d520de, 0x41d55c15,
+    0x41d5c3d9, 0x41d5c559, 0x41d5c5d9, 0x41d5d7d9, 0x41d5d959, 0x41d616d5, 0x41d677ca, 0x41d68bc9,
+    0x41d6f14a, 0x41d74166, 0x41d76409, 0x41d77815, 0x41d7a559, 0x41d7dfd9, 0x41d7e159, 0x41d7e1d9,
+    0x41d7f3da, 0x41d7f55a, 0x41d81ed5, 0x41d832d5, 0x41d85dca, 0x41d893c9, 0x41d896c5, 0x41d8a7c9,
+    0x41d90d49, 0x41d91045, 0x41dad562, 0x41dad5e1, 0x41db4d62, 0x41db75e1, 0x41db7761, 0x41db89de,
+    0x41dc41e2, 0x41dc4261, 0x41dda9e2, 0x41ddbca1, 0x41de21e2, 0x41de4a61, 0x41de5e5a, 0x41de9b62,
+    0x41df1362, 0x41df9162, 0x41e6d9d9, 0x41e6db59, 0x41e6dbd9, 0x41e6edd9, 0x41e72cd5, 0x41e77d52,
+    0x41e7a1c9, 0x41e8074a, 0x41e89955, 0x41e8e9d2, 0x41e90e49, 0x41e9c939, 0x41ea6939, 0x41ea6ab9,
+    0x41ea6b39, 0x41ea7d39, 0x41ea7eb9, 0x41ea8892, 0x41eaa155, 0x41eab555, 0x41eac9d2, 0x41eb1649,
+    0x41eb2a5a, 0x41eb4352, 0x41ebd139, 0x41ebd5b9, 0x41ebd739, 0x41ebd7b9, 0x41ebe539, 0x41ebe9b9,
+    0x41ebeb39, 0x41ec4ab9, 0x41ec4f39, 0x41ec8539, 0x41ec86b9, 0x41ec8739, 0x41ec8b39, 0x41ec8bb9,
+    0x41ed169a, 0x41edd162, 0x41ef3dda, 0x41ef64da, 0x41f03161, 0x41f15e5a, 0x41f21262, 0x41f24d61,
+    0x41f2ed61, 0x41f2ef61, 0x41f3439a, 0x41f34716, 0x41f381da, 0x41f3835a, 0x41f3aa5a, 0x41f3abda,
+    0x41f3ac5a, 0x41f3bdda, 0x41f3be5a, 0x41f3f785, 0x41f3fb79, 0x41f3fcd5, 0x41f3fd55, 0x41f435ca,
+    0x41f44dd1, 0x41f45e4a, 0x41f471c9, 0x41f47249, 0x41f567da, 0x41f5695a, 0x41f569da, 0x41f5a24a,
+    0x41f5ba5a, 0x41f5caca, 0x41f5de5a, 0x41f5deda, 0x41f5dfda, 0x41f61bca, 0x41f697b9, 0x41f69939,
+    0x41f699b9, 0x41f75909, 0x41f76416, 0x41f771d5, 0x41f7785a, 0x41f783d5, 0x41f78555, 0x41f785d5,
+    0x41f79a51, 0x41f7be49, 0x41f7c145, 0x41f7c45a, 0x41f7e6c9, 0x41f7ed5a, 0x41f7fa5a, 0x41f7fada,
+    0x41f7fbda, 0x41f813d1, 0x41f837c9, 0x41f83ac5, 0x41f87939, 0x41f87db9, 0x41f87f39, 0x41f8a1b9,
+    0x41f8a639, 0x41f8a7b9, 0x41f8a839, 0x41f8b3b9, 0x41f8b539, 0x41f8b5b9, 0x41f8b9b9, 0x41f8ba39,
+    0x41f8bbb9, 0x41f91b39, 0x41f92d39, 0x41f92eb9, 0x41f955b9, 0x41f95739, 0x41f957b9, 0x41f9d5da,
+    0x41f9d75a, 0x41fa11da, 0x41fa125a, 0x41fa25da, 0x41fa89ca, 0x41fac5c9, 0x41fbbbda, 0x41fbbd5a,
+    0x41fbbdda, 0x41fbcfda, 0x41fbd15a, 0x41fbf64a, 0x41fc325a, 0x41fc33da, 0x41fc465a, 0x41fc47da,
+    0x41fc83d5, 0x41fce7c5, 0x41fcebb9, 0x41fced39, 0x41fcedb9, 0x41fcffb9, 0x41fd0139, 0x41fdd7d5,
+    0x41fdd955, 0x41fdd9d5, 0x41fdebd5, 0x41fded55, 0x41fe1249, 0x41fe4e49, 0x41fe4ec9, 0x41fe4fc5,
+    0x41fe8bc9, 0x41fe9fd5, 0x41fecd39, 0x41fed1b9, 0x41fed339, 0x41fef551, 0x41ff07b9, 0x41ff0939,
+    0x41ff09b9, 0x41ff0db9, 0x41ff0e39, 0x41ff0fb9, 0x41ff1bb9, 0x41ff1d39, 0x41ff21b9, 0x41ff8139,
+    0x41ff82b9, 0x41ffbd39, 0x41ffbdb9, 0x41ffbf39, 0x42032d61, 0x42054961, 0x42065551, 0x420656d5,
+    0x42065759, 0x4206ba99, 0x4206bc26, 0x4206e319, 0x4206e499, 0x4206e519, 0x42073615, 0x420772dd,
+    0x42078711, 0x4207d625, 0x42080026, 0x420814e6, 0x4208df5a, 0x4208f191, 0x4208f319, 0x4208f399,
+    0x4209d065, 0x4209d1e5, 0x4209d265, 0x420a7265, 0x420a91c9, 0x420a94c5, 0x420aaa95, 0x420aaf15,
+    0x420ab119, 0x420abc95, 0x420abe15, 0x420ad926, 0x420aedda, 0x420afb59, 0x420b0d91, 0x420b0f11,
+    0x420b5311, 0x420b6755, 0x420bb665, 0x420bb865, 0x420bda65, 0x420bdee5, 0x420be065, 0x420be0e5,
+    0x420bec65, 0x420bede5, 0x420c0091, 0x420c0239, 0x420c1b66, 0x420c53f9, 0x420c5865, 0x420c65e5,
+    0x420c6766, 0x420c8e65, 0x420c8ff9, 0x420dda65, 0x420e8e66, 0x420f4559, 0x420f46e5, 0x420ff949,
+    0x42116159, 0x421162e5, 0x42116765, 0x42121549, 0x4215afd9, 0x4217cbd9, 0x42183155, 0x42184555,
+    0x4219b505, 0x4219b816, 0x4219f359, 0x421a1bd9, 0x421a1d59, 0x421a1dd9, 0x421a2f59, 0x421a2fd9,
+    0x421a6905, 0x421a6cd5, 0x421a6e55, 0x421a6ed5, 0x421aa74a, 0x421abf51, 0x421ae349, 0x421afa91,
+    0x421afc16, 0x421afcb9, 0x421b5fdd, 0x421b885d, 0x421b89f9, 0x421b8a79, 0x421bd955, 0x421bdad5,
+    0x421bdb55, 0x421c13ca, 0x421c2bd1, 0x421c4fc9, 0x421c5049, 0x421c5145, 0x421c8d4a, 0x421d0545,
+    0x421d0939, 0x421d0ab9, 0x421d0b39, 0x421d82b9, 0x421d84ba, 0x421d96d1, 0x421d9879, 0x421d98f9,
+    0x421dab39, 0x421dacba, 0x421dad3a, 0x421dbeb9, 0x421dbf39, 0x421dc0ba, 0x421dca89, 0x421dd516,
+    0x421de355, 0x421de9d5, 0x421df555, 0x421df6d5, 0x421df75a, 0x421e0bd1, 0x421e2fc9, 0x421e32c5,
+    0x421e5849, 0x421e6bda, 0x421e6c5a, 0x421e6d5a, 0x421e8551, 0x421ea949, 0x421eac45, 0x421eeab9,
+    0x421eef39, 0x421ef139, 0x421f1339, 0x421f17b9, 0x421f1939, 0x421f19b9, 0x421f2539, 0x421f26b9,
+    0x421f2739, 0x421f2b39, 0x421f2bb9, 0x421f2d39, 0x421f5455, 0x421f5679, 0x421f8cba, 0x421f9139,
+    0x421f933a, 0x421f9eb9, 0x421f9f46, 0x421fa0ba, 0x421fa539, 0x421fc739, 0x421fc8ba, 0x421fc93a,
+    0x421fcdb9, 0x42204959, 0x42205b59, 0x42227bc9, 0x422336b9, 0x42235d39, 0x42235eb9, 0x42235f39,
+    0x42237139, 0x422372b9, 0x4223d6b9, 0x4223d8ba, 0x4223eab9, 0x422412b9, 0x42241339, 0x422426b9,
+    0x422497c9, 0x42253eb9, 0x42254339, 0x42254539, 0x422552b9, 0x42255739, 0x42257939, 0x42257ab9,
+    0x42257b39, 0x42257f39, 0x42257fb9, 0x42258139, 0x42258d39, 0x42258eb9, 0x42259339, 0x4225f2b9,
+    0x4225f4ba, 0x4225f939, 0x422606b9, 0x42262eb9, 0x4229c561, 0x4229c761, 0x4229d961, 0x422be161,
+    0x422bf561, 0x422c9761, 0x422cdb19, 0x422d0519, 0x422d19da, 0x422d7d11, 0x422d7e91, 0x422d7f11,
+    0x422d8f09, 0x422de25d, 0x422de3dd, 0x422de45d, 0x422e0add, 0x422e0c5d, 0x422e0cdd, 0x422f4c5a,
+    0x422f7759, 0x422f9d89, 0x422fa085, 0x422fc855, 0x422fc9d5, 0x422fca55, 0x42300539, 0x423006b9,
+    0x42300739, 0x42301951, 0x42301ad1, 0x42301b51, 0x42302b49, 0x42302db9, 0x42302f39, 0x42302fb9,
+    0x42304139, 0x423041b9, 0x42304339, 0x42310591, 0x42310711, 0x423158d9, 0x42315d59, 0x42316849,
+    0x42316ad9, 0x42316c59, 0x42319359, 0x423194d9, 0x4231d6d5, 0x4231d855, 0x4231d8d5, 0x423200d1,
+    0x42320f39, 0x423213b9, 0x42321539, 0x423215b9, 0x42322139, 0x423222b9, 0x42322339, 0x42322739,
+    0x423227b9, 0x42322939, 0x42324b39, 0x42324bb9, 0x42324fb9, 0x42325039, 0x423251b9, 0x42325d39,
+    0x42325db9, 0x42325f39, 0x423263b9, 0x42328655, 0x423287f9, 0x4232c339, 0x4232c53a, 0x4232d6b9,
+    0x4232d739, 0x4233013a, 0x4233935a, 0x4235795a, 0x4235b3da, 0x4235b55a, 0x42362d49, 0x42366d39,
+    0x42366eb9, 0x42368151, 0x42369539, 0x423695b9, 0x42369739, 0x4236a939, 0x4237bbc9, 0x4237bd45,
+    0x4237c059, 0x4237fad9, 0x4237fb59, 0x4237fcd9, 0x42387539, 0x423876b9, 0x42387739, 0x42387949,
+    0x42387b39, 0x42387bb9, 0x42387c45, 0x42388939, 0x42388ab9, 0x42388f39, 0x42389d51, 0x4238b139,
+    0x4238b1b9, 0x4238b339, 0x4238b7b9, 0x42392849, 0x423928c9, 0x42392ab9, 0x42392b39, 0x42392bf9,
+    0x4239a289, 0x4239a585, 0x423a1e59, 0x423a1fd9, 0x423b1155, 0x423b12d5, 0x423bb109, 0x423bb405,
+    0x423bdbe1, 0x423bdd61, 0x423c2cd1, 0x423c2e51, 0x423d1fd1, 0x423d2151, 0x423dada1, 0x423daf21,
+    0x423dea55, 0x423debd5, 0x423f1a21, 0x423f1ba1, 0x423f93a1, 0x423f9526, 0x423ff689, 0x423ff985,
+    0x42400f55, 0x42401005, 0x424013d5, 0x42401445, 0x42401555, 0x424015d5, 0x42402155, 0x424022d5,
+    0x42402956, 0x424052a9, 0x4240626a, 0x42407251, 0x424073d1, 0x42408449, 0x42408745, 0x42408a49,
+    0x42408e99, 0x4240cc15, 0x42414405, 0x42416551, 0x424166d1, 0x42417749, 0x42417a45, 0x42417d65,
+    0x42418026, 0x424181a6, 0x4241b89d, 0x4241bd25, 0x4241bea6, 0x4241bf2a, 0x4241ca9d, 0x4241cc26,
+    0x4241d2a6, 0x4241f31d, 0x4241f49d, 0x4241f925, 0x42421949, 0x42421dd1, 0x42423215, 0x42423745,
+    0x42423895, 0x424241c9, 0x42424415, 0x424244c5, 0x42424595, 0x42424615, 0x42425a91, 0x42427e89,
+    0x424292c9, 0x424295c5, 0x4242a709, 0x4242ab99, 0x4242ad89, 0x4242b085, 0x4242b199, 0x4242bb09,
+    0x4242bd99, 0x4242bf19, 0x4242d411, 0x4242f809, 0x42433965, 0x424361e5, 0x42436865, 0x424373e5,
+    0x42437565, 0x424375e5, 0x424385c9, 0x424388c5, 0x42439e95, 0x4243a3a6, 0x4243a4a5, 0x4243b095,
+    0x4243b215, 0x4243db65, 0x4243e1e6, 0x4243ed65, 0x4243eee5, 0x42440191, 0x42440311, 0x424415e5,
+    0x42441765, 0x424417e5, 0x42441c66, 0x42441de6, 0x42442965, 0x424429e5, 0x42442b65, 0x42443e51,
+    0x42443fd1, 0x42445495, 0x42445649, 0x42446a56, 0x42449199, 0x42449619, 0x424497a6, 0x4244982a,
+    0x4244a399, 0x4244a526, 0x4244aba6, 0x4244cc19, 0x4244cd99, 0x4244cf89, 0x4244d219, 0x4244d299,
+    0x4244d419, 0x42451005, 0x42454e69, 0x42458465, 0x42458a65, 0x42459a09, 0x4245bf15, 0x4245c095,
+    0x4245c525, 0x4245c5a5, 0x4245c725, 0x4245fde9, 0x424613a6, 0x42463865, 0x424639e5, 0x42463c25,
+    0x42463e66, 0x42467555, 0x424676d5, 0x4246afc9, 0x4247a51d, 0x4247a69d, 0x42481e9d, 0x42482026,
+    0x424883d1, 0x42488551, 0x424895c9, 0x42489815, 0x424898c5, 0x42489995, 0x4248ac15, 0x4248ad95,
+    0x4248b226, 0x4248d299, 0x4248d71a, 0x4248e6a9, 0x42491199, 0x42491319, 0x42494c15, 0x42496009,
+    0x4249a169, 0x4249c7e5, 0x4249c965, 0x4249c9e5, 0x4249dbe5, 0x4249dd65, 0x4249e1e5, 0x424a0495,
+    0x424a0615, 0x424a4165, 0x424a42e5, 0x424a7d65, 0x424af799, 0x424af926, 0x424b7916, 0x424bee09,
+    0x424c2695, 0x424daa15, 0x424ee9c9, 0x424f0295, 0x424f14a2, 0x424f2b11, 0x424fa491, 0x425009e2,
+    0x42503261, 0x425045e2, 0x42504661, 0x4250abe1, 0x4250e7e1, 0x4251da05, 0x42521861, 0x42522a62,
+    0x42522c69, 0x425252e1, 0x42525461, 0x425254e1, 0x42526662, 0x425266e1, 0x42526861, 0x42534a49,
+    0x42534d45, 0x42534e95, 0x42535dd6, 0x42535e49, 0x42536156, 0x42539919, 0x42539d99, 0x42539faa,
+    0x4253c199, 0x4253c619, 0x4253c799, 0x4253c819, 0x4253d999, 0x4253da19, 0x4253db99, 0x42547e5d,
+    0x42548bdd, 0x4254b495, 0x4254b545, 0x4254b915, 0x4254ba96, 0x4254bb15, 0x4254cd15, 0x4254ce96,
+    0x4254f389, 0x4254f686, 0x425507aa, 0x42550a86, 0x42552f89, 0x42553009, 0x4255325d, 0x42553305,
+    0x425533dd, 0x42555691, 0x42557a89, 0x4255bbd9, 0x4255e459, 0x4255e985, 0x4255ead9, 0x4255f659,
+    0x4255f7d9, 0x4255f859, 0x42563555, 0x42568651, 0x4256aa49, 0x4256d989, 0x4256dc85, 0x4256ddd5,
+    0x425750e9, 0x42575569, 0x425756e9, 0x42575769, 0x42576049, 0x425768e9, 0x42576969, 0x42576ae9,
+    0x42578d95, 0x42578f89, 0x42579215, 0x42579396, 0x42579415, 0x4257a615, 0x4257d0e9, 0x4257e386,
+    0x425806d9, 0x42580b59, 0x42580cd9, 0x425843d5, 0x42584a55, 0x425855d5, 0x42585755, 0x425857d5,
+    0x42586c51, 0x425894e9, 0x42589969, 0x4258a851, 0x4258a8d1, 0x4258bd69, 0x4258c1e9, 0x4258c369,
+    0x4258c3e9, 0x4258d569, 0x4258d5e9, 0x4258d769, 0x4258f9d5, 0x4258fb96, 0x4258fc09, 0x4258fe55,
+    0x4258ff16, 0x42590f96, 0x425936e9, 0x42593b69, 0x42593d6a, 0x42594f6a, 0x425974c9, 0x42597769,
+    0x425977e9, 0x42597969, 0x425a2799, 0x425a2919, 0x425b5509, 0x425bce89, 0x425be289, 0x425c0fd9,
+    0x425c23e9, 0x425c4a59, 0x425c4bd9, 0x425c4c59, 0x425c5e59, 0x425c5fd9, 0x425c6459, 0x425c8955,
+    0x425c9d55, 0x425cfe49, 0x425d0145, 0x425d1249, 0x425d77c9, 0x425d7ac5, 0x425ea9d5, 0x425eabd5,
+    0x425f2369, 0x425f24e9, 0x425f9ce9, 0x425fa36a, 0x425fd8e9, 0x425fdf69, 0x42601655, 0x426017d5,
+    0x4261461d, 0x4261479d, 0x4261bf9d, 0x4261c121, 0x426224d1, 0x42622651, 0x4262b299, 0x4262b419,
+    0x4262c699, 0x42635491, 0x4263a595, 0x4263a721, 0x42649899, 0x42649a19, 0x42666a51, 0x42666bd1,
+    0x42667c49, 0x42667f45, 0x42668259, 0x4266bd99, 0x4266c219, 0x4266c399, 0x4266c42a, 0x4266cf99,
+    0x4266d119, 0x4266d7aa, 0x4266f819, 0x4266f999, 0x4266fe19, 0x42670019, 0x42670b99, 0x42670c19,
+    0x42670d99, 0x42673715, 0x426737c5, 0x42673b95, 0x42673d15, 0x42673d96, 0x42675115, 0x4267761e,
+    0x4267b209, 0x4267b289, 0x4267b585, 0x4267eb15, 0x4267ec95, 0x4267ed15, 0x42682589, 0x42686209,
+    0x42686505, 0x42688ac9, 0x42688dc5, 0x4268a395, 0x4268a999, 0x4268b309, 0x4268b405, 0x4268b595,
+    0x4268b715, 0x4268e59a, 0x4268f259, 0x4268f3d9, 0x4268f469, 0x42690691, 0x42690811, 0x42691ad9,
+    0x42691c59, 0x42692e59, 0x42692ed9, 0x42693059, 0x42695c16, 0x42696bd5, 0x42696d55, 0x42696dd5,
+    0x4269a649, 0x4269cec9, 0x4269d369, 0x4269d7e9, 0x4269d969, 0x4269e2c9, 0x4269e3c5, 0x4269e569,
+    0x4269e6e9, 0x4269ebe9, 0x4269f991, 0x4269fb11, 0x426a0b89, 0x426a4849, 0x426a4ce9, 0x426a5ee9,
+    0x426a6069, 0x426a8769, 0x426a88e9, 0x426a9ae9, 0x426a9b69, 0x426a9ce9, 0x426ac415, 0x426ac595,
+    0x426aca19, 0x426aca99, 0x426acc19, 0x426b18aa, 0x426b4119, 0x426b7c55, 0x426b7e09, 0x426b7e89,
+    0x426b8185, 0x426b9209, 0x426bb969, 0x426bbde9, 0x426bbf69, 0x426bbfea, 0x426bcb69, 0x426bcce9,
+    0x426bd1ea, 0x426bd36a, 0x426bf3e9, 0x426bf569, 0x426bf9e9, 0x426bfa69, 0x426bfbe9, 0x426c0769,
+    0x426c07e9, 0x426c0969, 0x426c0de9, 0x426c2e09, 0x426c3105, 0x426c6d69, 0x426c6ee9, 0x426c6f6a,
+    0x426c80e9, 0x426ca969, 0x426ca9e9, 0x426cab69, 0x426d23a9, 0x426d2529, 0x426d5fa9, 0x426d6029,
+    0x426d61a9, 0x426f082a, 0x426f09a9, 0x426f0b29, 0x426f441a, 0x426f466a, 0x426f471a, 0x426f47ea,
+    0x426f5a6a, 0x426f5bea, 0x426f605a, 0x426f826a, 0x426f82ea, 0x426fbfea, 0x426fc16a, 0x426fd3ea,
+    0x426fd56a, 0x426fd9ea, 0x42700e6a, 0x427036ea, 0x427037ea, 0x42703969, 0x42703ae9, 0x42703fe9,
+    0x42704d69, 0x4270b16a, 0x4270b2e9, 0x4270b469, 0x4271e629, 0x42721f69, 0x427220e9, 0x427225ea,
+    0x4272276a, 0x42725b69, 0x42725be9, 0x42725d69, 0x427261e9, 0x4272d4e9, 0x42757415, 0x42759c91,
+    0x42767b62, 0x4276a3e1, 0x42771d61, 0x427757e1, 0x4279c015, 0x427a3805, 0x427aefdd, 0x427ba3e6,
+    0x427ba566, 0x427bc811, 0x427bec09, 0x427c2d59, 0x427c55d9, 0x427c5c59, 0x427c67d9, 0x427c6959,
+    0x427c69d9, 0x427ca6d5, 0x427d1bc9, 0x427dc766, 0x427e7859, 0x427e7cd9, 0x427e7e59, 0x427ebbd5,
+    0x427f33c5, 0x427fe666, 0x42824009, 0x42825415, 0x42828159, 0x4282bbd9, 0x4282bd59, 0x4282bdd9,
+    0x4282cfd9, 0x4282d159, 0x4282d5d9, 0x4282fad5, 0x42830ed5, 0x42836fc9, 0x428372c5, 0x428383c9,
+    0x4283e949, 0x4283ec45, 0x4287cddd, 0x42889891, 0x4288fde2, 0x42892659, 0x42897762, 0x4289c851,
+    0x428b85d5, 0x428b99d5, 0x428bae51, 0x428bea51, 0x428cde11, 0x428d0209, 0x428d0505, 0x428d0985,
+    0x428d0d16, 0x428d4359, 0x428d47d9, 0x428d6bd9, 0x428d7059, 0x428d71d9, 0x428d7259, 0x428d7dd9,
+    0x428d7f59, 0x428d7fd9, 0x428d83d9, 0x428d8459, 0x428dbcd5, 0x428dbd85, 0x428dc179, 0x428dc355,
+    0x428dfbca, 0x428e31c9, 0x428e37c9, 0x428e3849, 0x428e7516, 0x428eb45d, 0x428edcdd, 0x428ede5d,
+    0x428ededd, 0x428f2955, 0x428f2dd5, 0x428f2f55, 0x428f2fd5, 0x428f8051, 0x428fa4c9, 0x428fe1ca,
+    0x42905939, 0x42905db9, 0x42905f39, 0x42905fb9, 0x4290d2b9, 0x4290d739, 0x4290fb39, 0x4290ffb9,
+    0x42910139, 0x429101b9, 0x42910d39, 0x42910eb9, 0x42910f39, 0x42911339, 0x429113b9, 0x42911539,
+    0x42913e55, 0x4291b349, 0x4291b645, 0x4291d9d1, 0x42923f39, 0x429267b9, 0x42926db9, 0x42926e39,
+    0x429279b9, 0x42927b39, 0x42927bb9, 0x4292aad6, 0x4292e139, 0x4292e646, 0x4292f339, 0x42931bb9,
+    0x42931d39, 0x42931db9, 0x42932239, 0x429323b9, 0x429503dd, 0x42953e5d, 0x42953fdd, 0x42957d55,
+    0x42959155, 0x4295f249, 0x42960649, 0x4296ad39, 0x4296b339, 0x4296b3b9, 0x4296c139, 0x4296c739,
+    0x429726b9, 0x42972b39, 0x42976139, 0x429762b9, 0x42976339, 0x42976739, 0x429767b9, 0x42976939,
+    0x42977539, 0x429776b9, 0x42977b39, 0x42989339, 0x4298cdb9, 0x4298cf39, 0x4298cfb9, 0x4298e1b9,
+    0x4298e339, 0x42994739, 0x42998339, 0x429983b9, 0x42998539, 0x429d1561, 0x429d2961, 0x429dc961,
+    0x429ddd61, 0x42a15add, 0x42a15f7a, 0x42a160dd, 0x42a1615d, 0x42a174dd, 0x42a1d45d, 0x42a1e65d,
+    0x42a1e7dd, 0x42a20edd, 0x42a2105d, 0x42a210dd, 0x42a23509, 0x42a24dd5, 0x42a25fd5, 0x42a26155,
+    0x42a261d5, 0x42a27651, 0x42a29a49, 0x42a29d45, 0x42a2c2c9, 0x42a2d6c9, 0x42a2d7c5, 0x42a2efd1,
+    0x42a313c9, 0x42a316c5, 0x42a35539, 0x42a35b39, 0x42a37db9, 0x42a383b9, 0x42a38439, 0x42a38fb9,
+    0x42a39139, 0x42a391b9, 0x42a397b9, 0x42a3f739, 0x42a40939, 0x42a40ab9, 0x42a431b9, 0x42a43339,
+    0x42a433b9, 0x42a44539, 0x42a445b9, 0x42a44739, 0x42a563b9, 0x42a569b9, 0x42a57739, 0x42a59fb9,
+    0x42a5a039, 0x42a5a639, 0x42a5b3b9, 0x42a617b9, 0x42a61939, 0x42a62b39, 0x42a653b9, 0x42a65439,
+    0x42a655b9, 0x42a6cb89, 0x42a6ce85, 0x42a6f611, 0x42a83a5d, 0x42a83bdd, 0x42a8765d, 0x42a876dd,
+    0x42a8785d, 0x42a8b189, 0x42a8b3d5, 0x42a8b485, 0x42a8b555, 0x42a8c7d5, 0x42a8c955, 0x42a8cdda,
+    0x42a8e252, 0x42a8ee59, 0x42a8f45a, 0x42a92ac9, 0x42a92bc5, 0x42a92d59, 0x42a92ed9, 0x42a94159,
+    0x42a967d5, 0x42a97bd5, 0x42a99652, 0x42a9cf7a, 0x42a9d151, 0x42a9d5fa, 0x42a9e3b9, 0x42a9e539,
+    0x42a9e5b9, 0x42a9f7b9, 0x42a9f939, 0x42a9fdb9, 0x42aa2055, 0x42aa21d5, 0x42aa5d39, 0x42aa5eb9,
+    0x42aa8551, 0x42aa9939, 0x42aa99b9, 0x42aa9b39, 0x42ab1359, 0x42ab14d9, 0x42ab4f59, 0x42ab4fd9,
+    0x42ab5159, 0x42ab94d6, 0x42abcb39, 0x42abf1fa, 0x42ac07b9, 0x42ac09c9, 0x42ac7cc9, 0x42ac7f39,
+    0x42acf955, 0x42acfad5, 0x42ae291d, 0x42ae2a9d, 0x42aea29d, 0x42aea426, 0x42af07d1, 0x42af0951,
+    0x42af9599, 0x42af9719, 0x42b08895, 0x42b08a39, 0x42b17b99, 0x42b17d26, 0x42b34d51, 0x42b34ed1,
+    0x42b35f49, 0x42b36245, 0x42b36549, 0x42b3a099, 0x42b3a519, 0x42b3a59a, 0x42b3a6a6, 0x42b3a719,
+    0x42b3b299, 0x42b3b426, 0x42b3baa6, 0x42b3db19, 0x42b3dc99, 0x42b3e119, 0x42b45d5d, 0x42b4ce15,
+    0x42b4cfb9, 0x42b4d425, 0x42b50889, 0x42b51166, 0x42b512e6, 0x42b56dc9, 0x42b570c5, 0x42b58695,
+    0x42b58c96, 0x42b59895, 0x42b59a15, 0x42b5c9da, 0x42b5d759, 0x42b5e991, 0x42b5eb11, 0x42b6b665,
+    0x42b6bb45, 0x42b6bc65, 0x42b6c865, 0x42b6c9e5, 0x42b6dc91, 0x42b6de39, 0x42b6f766, 0x42b72ff9,
+    0x42b731e6, 0x42b734e6, 0x42b735e6, 0x42b741e5, 0x42b74366, 0x42b76a65, 0x42b76bf9, 0x42b7a715,
+    0x42b7a895, 0x42b7ad15, 0x42b7ad95, 0x42b7af15, 0x42b7ba95, 0x42b7c115, 0x42b7e5d9, 0x42b7ea59,
+    0x42b7ebe5, 0x42b7fba6, 0x42b82409, 0x42b863d5, 0x42b89c65, 0x42b8a0e5, 0x42b8a145, 0x42b8a2e5,
+    0x42b8ae65, 0x42b8b4e5, 0x42b8d6e5, 0x42b8d865, 0x42b8dce5, 0x42b8dd65, 0x42b8dee5, 0x42b8ea65,
+    0x42b8f0e5, 0x42b91725, 0x42b95065, 0x42b951e6, 0x42b95666, 0x42b956e5, 0x42b95866, 0x42b963e6,
+    0x42b96a66, 0x42b992e5, 0x42ba06a5, 0x42ba0826, 0x42bbeca5, 0x42bbee25, 0x42bc271a, 0x42bc3d66,
+    0x42bc3ee6, 0x42bc4366, 0x42bcf166, 0x42bd1c65, 0x42bd1de5, 0x42bd95e5, 0x42bd9766, 0x42bec925,
+    0x42bf0265, 0x42bf08e5, 0x42bf0a66, 0x42bf44e5, 0x42bfb7e6, 0x42c13b5d, 0x42c52dd5, 0x42c52f55,
+    0x42c52fd5, 0x42c55651, 0x42c59251, 0x42c69c95, 0x42c6a115, 0x42c6a296, 0x42c6a315, 0x42c6b515,
+    0x42c6b696, 0x42c6db89, 0x42c6de86, 0x42c6dfd9, 0x42c6ef89, 0x42c6f286, 0x42c71189, 0x42c71789,
+    0x42c71809, 0x42c71b05, 0x42c7a3dd, 0x42c7a85d, 0x42c7aa5d, 0x42c7cc5d, 0x42c7d0dd, 0x42c7d25d,
+    0x42c7d2dd, 0x42c7dfdd, 0x42c7e45d, 0x42c7e4dd, 0x42c7e65d, 0x42c80a96, 0x42c80b09, 0x42c845f9,
+    0x42c84a5d, 0x42c84afa, 0x42c84c79, 0x42c857dd, 0x42c85e5d, 0x42c8805d, 0x42c8865d, 0x42c886dd,
+    0x42c88879, 0x42c8a689, 0x42c8bf55, 0x42c8c485, 0x42c8d155, 0x42c8d2d5, 0x42c8d355, 0x42c8e7d1,
+    0x42c90bc9, 0x42c90ec5, 0x42c93449, 0x42c938d9, 0x42c93ed9, 0x42c94849, 0x42c94945, 0x42c96151,
+    0x42c98549, 0x42c98845, 0x42c9c6b9, 0x42c9cb39, 0x42c9cd39, 0x42c9ef39, 0x42c9f3b9, 0x42c9f539,
+    0x42c9f5b9, 0x42ca0139, 0x42ca02b9, 0x42ca0339, 0x42ca0739, 0x42ca07b9, 0x42ca0939, 0x42ca2bf9,
+    0x42ca3055, 0x42ca31d6, 0x42ca3279, 0x42ca68ba, 0x42ca6d39, 0x42ca6f3a, 0x42ca7ab9, 0x42ca7cba,
+    0x42ca8139, 0x42caa339, 0x42caa4ba, 0x42caa53a, 0x42caa9b9, 0x42caab3a, 0x42cab6b9, 0x42cab739,
+    0x42cab8ba, 0x42cabd39, 0x42cb1ed9, 0x42cb20c9, 0x42cb2359, 0x42cb2559, 0x42cb3759, 0x42cb5959,
+    0x42cb5cc9, 0x42cb5f59, 0x42cb5fd9, 0x42cb6159, 0x42cb81d1, 0x42cb8355, 0x42cbaac5, 0x42cbd539,
+    0x42cbd9b9, 0x42cbdbb9, 0x42cbe739, 0x42cbe939, 0x42cc0fb9, 0x42cc1139, 0x42cc11b9, 0x42cc1639,
+    0x42cc17b9, 0x42cc2339, 0x42cc23b9, 0x42cc2539, 0x42cc2749, 0x42cc29b9, 0x42cc4fd5, 0x42cc5256,
+    0x42cc52d5, 0x42cc5456, 0x42cc6656, 0x42cc8939, 0x42cc8b3a, 0x42cc8fb9, 0x42cc9046, 0x42cc9d39,
+    0x42ccc5b9, 0x42ccc73a, 0x42ccc949, 0x42cccbb9, 0x42cd1816, 0x42cd3d09, 0x42cd4006, 0x42ce325d,
+    0x42ce33dd, 0x42ceabdd, 0x42cebfdd, 0x42cee7dd, 0x42cee85d, 0x42cf2309, 0x42cf2616, 0x42cf645a,
+    0x42cf73c9, 0x42cf9ed9, 0x42cfa059, 0x42d02eb9, 0x42d03339, 0x42d05539, 0x42d056b9, 0x42d05739,
+    0x42d05b39, 0x42d05bb9, 0x42d05d39, 0x42d06939, 0x42d06ab9, 0x42d06f39, 0x42d091d5, 0x42d09356,
+    0x42d0ceb9, 0x42d0cf46, 0x42d0d539, 0x42d0e2b9, 0x42d10ab9, 0x42d13316, 0x42d13516, 0x42d184d9,
+    0x42d18b59, 0x42d1c0d9, 0x42d1c759, 0x42d20656, 0x42d23b39, 0x42d23d39, 0x42d24f39, 0x42d27739,
+    0x42d277b9, 0x42d27939, 0x42d27b49, 0x42d2f139, 0x42d3a7a1, 0x42d3a921, 0x42d58da1, 0x42d58f21,
+    0x42d6bd61, 0x42d6bee1, 0x42d6d161, 0x42d736e1, 0x42d8a361, 0x42d8a4e1, 0x42d9d315, 0x42d9d495,
+    0x42d9d919, 0x42da0d89, 0x42da8d09, 0x42da8d89, 0x42dac85e, 0x42dac91e, 0x42daccde, 0x42dace5e,
+    0x42dacede, 0x42dada5d, 0x42dadbdd, 0x42dae25d, 0x42db02dd, 0x42db045d, 0x42db08dd, 0x42db095d,
+    0x42db0add, 0x42db165d, 0x42db16dd, 0x42db185d, 0x42db3d09, 0x42db7c5d, 0x42db7df9, 0x42db7e79,
+    0x42db8fdd, 0x42db905d, 0x42dbb85d, 0x42dbb8dd, 0x42dbba79, 0x42dbe191, 0x42dbe311, 0x42dc34da,
+    0x42dc3ada, 0x42dc4449, 0x42dc46d9, 0x42dc4859, 0x42dc6f59, 0x42dc70d9, 0x42dc8359, 0x42dcae56,
+    0x42dcb456, 0x42dcfd39, 0x42dcfeb9, 0x42dcff39, 0x42dd0339, 0x42dd03b9, 0x42dd0539, 0x42dd1151,
+    0x42dd1351, 0x42dd17d1, 0x42dd2739, 0x42dd2bb9, 0x42dd2c39, 0x42dd2db9, 0x42dd3939, 0x42dd3b39,
+    0x42dd3fb9, 0x42dd6255, 0x42dd63f9, 0x42dd9f39, 0x42dd9ff9, 0x42ddb339, 0x42ddc751, 0x42de1c19,
+    0x42de5559, 0x42de56d9, 0x42de5b59, 0x42de5bd9, 0x42de5d59, 0x42de68d9, 0x42de6f59, 0x42de9159,
+    0x42de97d9, 0x42decf45, 0x42ded4d5, 0x42ded555, 0x42ded6d5, 0x42dee8d5, 0x42df0bb9, 0x42df0d39,
+    0x42df0db9, 0x42df0f49, 0x42df1239, 0x42df13b9, 0x42df2139, 0x42df2349, 0x42df49b9, 0x42df4bc9,
+    0x42df84d5, 0x42df8679, 0x42dfc139, 0x42dfc1b9, 0x44f23c59, 0x44f2b5d5, 0x44f84fd5, 0x44f85085,
+    0x44f85455, 0x44f855d5, 0x44f867d5, 0x44f869d5, 0x44f8a249, 0x44f8a2ea, 0x44f8b8d1, 0x44f8cac9,
+    0x44f8cc45, 0x44f95ba5, 0x44f97fa6, 0x44f98425, 0x44f985a5, 0x44f997a5, 0x44f99825, 0x44f999a5,
+    0x44f9abd1, 0x44f9bdc9, 0x44f9bf45, 0x44f9f925, 0x44f9fda5, 0x44f9ff25, 0x44fa1125, 0x44fa11aa,
+    0x44fa132a, 0x44fa39a5, 0x44febbd5, 0x44febdd5, 0x44fef649, 0x44fef6ea, 0x44ff7ee6, 0x44ffa6a5,
+    0x44ffafa5, 0x44ffbea6, 0x44ffc325, 0x44ffeba5, 0x44ffec25, 0x44ffeda5, 0x44fff926, 0x45006525,
+    0x450065aa, 0x4500672a, 0x450072a5, 0x45057519, 0x450b8dc5, 0x450b9e49, 0x450b9eea, 0x450ba1ea,
+    0x450bb711, 0x450bde19, 0x450bdf99, 0x450c0699, 0x450c0819, 0x450c1a19, 0x450c1a99, 0x450c1c19,
+    0x450c95e9, 0x450cce89, 0x450cd185, 0x450cf515, 0x450cf995, 0x450cfb15, 0x450d0d15, 0x450d3705,
+    0x450d37e9, 0x450d4569, 0x450d4789, 0x450d482a, 0x450d49e9, 0x450d4b2a, 0x450d7009, 0x4511f249,
+    0x4511f5c5, 0x45123219, 0x45123399, 0x4512342a, 0x45124599, 0x45126e19, 0x45126e99, 0x45127019,
+    0x4512e485, 0x4512e869, 0x4512e9e9, 0x4512fbe9, 0x4512fde9, 0x45136115, 0x45136315, 0x45139969,
+    0x45139b89, 0x45139c2a, 0x45139f2a, 0x4513ad69, 0x45196421, 0x451eb0d1, 0x451ec2c9, 0x451ec445,
+    0x451f0299, 0x451f0419, 0x451f1619, 0x451f16aa, 0x451f182a, 0x451f3e99, 0x45203195, 0x45206c09,
+    0x45256a19, 0x45256aaa, 0x45256c2a, 0x453fd7e1, 0x45408761, 0x45408be1, 0x45454d96, 0x454589ed,
+    0x4545c2ae, 0x4545c5ae, 0x4546b596, 0x4546b896, 0x4546f4ee, 0x4546f66e, 0x45471d6e, 0x45471eee,
+    0x454bddd9, 0x454c904a, 0x454ccf7a, 0x454d446d, 0x454d48ed, 0x454d4a6d, 0x454d5c6d, 0x454d84ed,
+    0x454d856d, 0x454d86ed, 0x4559777a, 0x455978ed, 0x4559a16d, 0x4559b37a, 0x4559b56d, 0x455a14ed,
+    0x455a196d, 0x455a1aed, 0x455a2ced, 0x455a556d, 0x455fcced, 0x455fdefa, 0x4560077a, 0x4560096d,
+    0x456080ed, 0x45664721, 0x456b93d1, 0x456ba5c9, 0x456ba745, 0x456be119, 0x456be599, 0x456be719,
+    0x456bf919, 0x456bf999, 0x456bfb19, 0x456c1ba5, 0x456c1d19, 0x456c2199, 0x456d1495, 0x456d4f09,
+    0x45724d19, 0x45724d99, 0x45724f19, 0x4572c695, 0x4572d426, 0x4572ff65, 0x45797fe1, 0x457981e1,
+    0x457a317a, 0x457ee195, 0x457ee315, 0x457ef515, 0x457ef715, 0x457f1f05, 0x457f2f89, 0x457f3009,
+    0x457f5809, 0x457fe8ed, 0x457fea6d, 0x457feaed, 0x4580116d, 0x458012ed, 0x458024ed, 0x4580256d,
+    0x458026ed, 0x45804b09, 0x45808679, 0x45808aed, 0x45808c79, 0x45809e6d, 0x45809eed, 0x4580a079,
+    0x4580c0ed, 0x4580c6ed, 0x45854915, 0x45854b15, 0x45858389, 0x45858409, 0x458599d9, 0x45863ced,
+    0x45863e6d, 0x45863eed, 0x4586506d, 0x458678ed, 0x4586796d, 0x45867aed, 0x4586f26d, 0x4586f2ed,
+    0x4586f479, 0x4586ffed, 0x4587286d, 0x45921995, 0x45925409, 0x45930d6d, 0x45930eed, 0x459320ed,
+    0x4593216d, 0x459322ed, 0x4593496d, 0x4593c2ed, 0x4593f8ed, 0x459974ed, 0x4599756d, 0x459976ed,
+    0x459b3259, 0x459c2555, 0x459cd885, 0x459cdc55, 0x459cddd5, 0x459cde55, 0x459d1919, 0x459d1a99,
+    0x459d52c9, 0x459d5445, 0x459d9295, 0x459d9415, 0x459dcd0a, 0x459e0c25, 0x459e0da1, 0x459e0e25,
+    0x459e45c9, 0x459e4745, 0x459e85a1, 0x459e8721, 0x459e87aa, 0x459ec1a1, 0x459ef855, 0x459efe55,
+    0x459f3519, 0x459f3699, 0x459fac66, 0x459faea5, 0x459faf66, 0x459fb025, 0x459fb3c5, 0x459ff3a1,
+    0x45a02826, 0x45a029a6, 0x45a02e21, 0x45a0a1a1, 0x45a0a321, 0x45a0a7a1, 0x45a123ea, 0x45a172e5,
+    0x45a17451, 0x45a251a5, 0x45a2531d, 0x45a253a5, 0x45a265d1, 0x45a26751, 0x45a27ac5, 0x45a28bea,
+    0x45a28eea, 0x45a2cb1d, 0x45a2cc9d, 0x45a2f3a5, 0x45a2f51d, 0x45a34495, 0x45a34615, 0x45a37f0a,
+    0x45a47466, 0x45a475e5, 0x45a4b32a, 0x45a4ede5, 0x45a4ef65, 0x45a50225, 0x45a50391, 0x45a52b05,
+    0x45a56096, 0x45a56215, 0x45a5ce19, 0x45a66ea5, 0x45a67011, 0x45a69066, 0x45a691e5, 0x45a6bb15,
+    0x45a6bf95, 0x45a6c115, 0x45a6e391, 0x45a6e811, 0x45a6e991, 0x45a709e5, 0x45a70b65, 0x45a7112a,
+    0x45a775d5, 0x45a77755, 0x45a777d5, 0x45a7da51, 0x45a7efc5, 0x45a80299, 0x45a8a5a5, 0x45a8a71d,
+    0x45a8a7a5, 0x45a8b91d, 0x45a8cd51, 0x45a8e2c5, 0x45a91f1d, 0x45a9209d, 0x45a9212a, 0x45a9329d,
+    0x45a95b1d, 0x45a95d1d, 0x45a98085, 0x45a98451, 0x45a985d1, 0x45a98651, 0x45a99649, 0x45a99895,
+    0x45a99a15, 0x45a9a9c9, 0x45a9ac15, 0x45a9ac95, 0x45a9c111, 0x45a9c291, 0x45a9d30a, 0x45a9e689,
+    0x45a9e729, 0x45a9e805, 0x45a9e999, 0x45a9eb19, 0x45a9ebaa, 0x45a9fac9, 0x45a9fc45, 0x45aa1225,
+    0x45aa1399, 0x45aa1425, 0x45aa2599, 0x45aa3a91, 0x45aa3c11, 0x45aa4c8a, 0x45aa6009, 0x45aa6089,
+    0x45aa6185, 0x45aa6315, 0x45aa6495, 0x45aa9c05, 0x45aa9fe5, 0x45aaa165, 0x45aaa1e9, 0x45aab591,
+    0x45aac866, 0x45aac9e5, 0x45aadb05, 0x45aadbe5, 0x45aadc66, 0x45aadde5, 0x45aaedc9, 0x45aaef45,
+    0x45ab0515, 0x45ab0695, 0x45ab0715, 0x45ab1895, 0x45ab2f11, 0x45ab41e5, 0x45ab5565, 0x45ab55e9,
+    0x45ab6991, 0x45ab91e5, 0x45aba051, 0x45aba651, 0x45abb495, 0x45abb615, 0x45abb849, 0x45abb9c5,
+    0x45abc745, 0x45abc815, 0x45abc896, 0x45abdd11, 0x45abde91, 0x45abef09, 0x45abf819, 0x45abf999,
+    0x45abfa2a, 0x45ac0329, 0x45ac0405, 0x45ac0599, 0x45ac0b99, 0x45ac2c85, 0x45ac2e25, 0x45ac2f99,
+    0x45ac3419, 0x45ac3619, 0x45ac4199, 0x45ac56a5, 0x45ac5766, 0x45ac5825, 0x45ac5bc5, 0x45ac68a5,
+    0x45ac7195, 0x45ac7315, 0x45ac7ca5, 0x45ac7da5, 0x45ac7f26, 0x45ac80a6, 0x45ac8515, 0x45aca9e5,
+    0x45acae65, 0x45acbbe5, 0x45acbd65, 0x45acd1a6, 0x45acd611, 0x45ace466, 0x45ace5e5, 0x45ace985,
+    0x45acf726, 0x45acf7e5, 0x45acf866, 0x45acf9e5, 0x45acfe65, 0x45ad2115, 0x45ad2295, 0x45ad2715,
+    0x45ad2915, 0x45ad3495, 0x45ad4991, 0x45ad4f91, 0x45ad5de5, 0x45ad7085, 0x45ad71e9, 0x45ae3099,
+    0x45b01515, 0x45b01695, 0x45b04f8a, 0x45b08e99, 0x45b09019, 0x45b09099, 0x45b144e1, 0x45b14661,
+    0x45b1be61, 0x45b1bfe1, 0x45b23119, 0x45b23299, 0x45b27189, 0x45b2aa9a, 0x45b32c61, 0x45b39d95,
+    0x45b3d809, 0x45b3da61, 0x45b3dbe1, 0x45b3e061, 0x45b4586a, 0x45b45b6a, 0x45b4a96a, 0x45b4ac6a,
+    0x45b4d06a, 0x45b4d42a, 0x45b4d62a, 0x45b58be9, 0x45b58c69, 0x45b60569, 0x45b6182a, 0x45b62d2a,
+    0x45b6f6e9, 0x45b6f869, 0x45b7eb69, 0x45b838aa, 0x45b8636a, 0x45b864ea, 0x45b8656a, 0x45b8de69,
+    0x45b8ec9a, 0x45b8f12a, 0x45b912da, 0x45b9145a, 0x45b9cfea, 0x45b9d16a, 0x45b9d1ea, 0x45b9dfaa,
+    0x45ba05d6, 0x45ba0756, 0x45ba2269, 0x45ba4aea, 0x45ba6d6a, 0x45ba71ea, 0x45bad891, 0x45bafc89,
+    0x45bb2a19, 0x45bb5211, 0x45bb628a, 0x45bb7609, 0x45bb7689, 0x45bb7785, 0x45bb8b0a, 0x45bbb205,
+    0x45bbb5dd, 0x45bbb75d, 0x45bbb7e9, 0x45bbda85, 0x45bbde5d, 0x45bbdfdd, 0x45bbe05d, 0x45bbf1dd,
+    0x45bbf25d, 0x45bbf3dd, 0x45bc1d15, 0x45bc595d, 0x45bc6b5d, 0x45bc6d69, 0x45bc9505, 0x45bca7de,
+    0x45bcbd11, 0x45bcbe91, 0x45bccf0a, 0x45bce289, 0x45bce309, 0x45bce405, 0x45bd1e85, 0x45bd2259,
+    0x45bd23d9, 0x45bd2469, 0x45bd3691, 0x45bd3811, 0x45bd3891, 0x45bd4889, 0x45bd4ad9, 0x45bd4c59,
+    0x45bd5e59, 0x45bd5ed9, 0x45bd6059, 0x45bd9bd5, 0x45bd9d55, 0x45bd9dd5, 0x45bdd64a, 0x45bdfeca,
+    0x45be1249, 0x45be12c9, 0x45be1569, 0x45be16e9, 0x45be1769, 0x45be3dd5, 0x45be3f55, 0x45be5085,
+    0x45be5155, 0x45be51d5, 0x45be6651, 0x45be67d1, 0x45be784a, 0x45be8bc9, 0x45be8c69, 0x45be8d45,
+    0x45be8ee9, 0x45beb449, 0x45beb5c5, 0x45beb769, 0x45beb8e9, 0x45beb969, 0x45bec849, 0x45becae9,
+    0x45bed919, 0x45beda99, 0x45beeb19, 0x45beff19, 0x45bf0019, 0x45bf2c59, 0x45bf3259, 0x45bf3e59,
+    0x45bf3fd9, 0x45bf529a, 0x45bf66d9, 0x45bf6859, 0x45bf7a5a, 0x45bf7ada, 0x45bf7c5a, 0x45bfe4ca,
+    0x45c023e9, 0x45c02569, 0x45c025e9, 0x45c04591, 0x45c059d5, 0x45c05b55, 0x45c06d56, 0x45c06dd6,
+    0x45c08251, 0x45c083d1, 0x45c09449, 0x45c09d69, 0x45c09f6a, 0x45c0a869, 0x45c0a945, 0x45c0aae9,
+    0x45c0d1c5, 0x45c0d369, 0x45c0d4e9, 0x45c0d969, 0x45c0db69, 0x45c12a55, 0x45c25a1d, 0x45c2d39d,
+    0x45c34ac9, 0x45c34c45, 0x45c38a99, 0x45c38c19, 0x45c38caa, 0x45c3c699, 0x45c40415, 0x45c40595,
+    0x45c40615, 0x45c440e1, 0x45c44261, 0x45c4b995, 0x45c4ba15, 0x45c4bb95, 0x45c5a699, 0x45c5ac99,
+    0x45c62015, 0x45c62195, 0x45c62615, 0x45c65a89, 0x45c65ce1, 0x45c65e61, 0x45c6dc15, 0x45c76ad5,
+    0x45c76c51, 0x45c793c5, 0x45c7a549, 0x45c7a845, 0x45c7d019, 0x45c7d199, 0x45c7d22a, 0x45c7fa19,
+    0x45c80e19, 0x45c8eb95, 0x45c8ed15, 0x45c90115, 0x45c91411, 0x45c91591, 0x45c92905, 0x45c93a2a,
+    0x45c93d2a, 0x45c9f2d9, 0x45c9f459, 0x45ca2ed9, 0x45ca6dd5, 0x45caa6ca, 0x45cae2c9, 0x45cae769,
+    0x45cafa15, 0x45cb3489, 0x45cb5f69, 0x45cb60e9, 0x45cb616a, 0x45cb8969, 0x45cb9b69, 0x45cb9d69,
+    0x45cbaa45, 0x45cbc015, 0x45cbc495, 0x45cbc615, 0x45cbd395, 0x45cbda15, 0x45cbe891, 0x45cbed11,
+    0x45cbee91, 0x45cc0ed9, 0x45cc1059, 0x45cc10e9, 0x45cc132a, 0x45cc162a, 0x45cc2491, 0x45cc4ada,
+    0x45cc8856, 0x45cc8905, 0x45cc89d5, 0x45ccc2c9, 0x45ccc769, 0x45cccbe9, 0x45cccd69, 0x45ccf5e9,
+    0x45cd0369, 0x45cd07e9, 0x45cd09e9, 0x45cd1791, 0x45cd5385, 0x45cd6969, 0x45cd6de9, 0x45cd6f69,
+    0x45cd7b69, 0x45cd7ce9, 0x45cd7d6a, 0x45cd8169, 0x45cd836a, 0x45cda569, 0x45cdd251, 0x45cde7c5,
+    0x45cdfa95, 0x45ce2419, 0x45ce2599, 0x45ce262a, 0x45ce3799, 0x45ce6019, 0x45ce6219, 0x45cf2a5d,
+    0x45cf5315, 0x45cf5515, 0x45cf912a, 0x45cfa3e9, 0x45cfcc5d, 0x45cff2c9, 0x45cff445, 0x45d00709,
+    0x45d00885, 0x45d00a15, 0x45d00b95, 0x45d00c16, 0x45d01d95, 0x45d03291, 0x45d03411, 0x45d034aa,
+    0x45d04319, 0x45d0449a, 0x45d046d9, 0x45d04859, 0x45d05a59, 0x45d05ae9, 0x45d05c69, 0x45d06e91,
+    0x45d082d9, 0x45d084d9, 0x45d096d9, 0x45d0ad91, 0x45d0bc95, 0x45d0c056, 0x45d0c1d5, 0x45d0d305,
+    0x45d0d3d5, 0x45d0d5d5, 0x45d0ea51, 0x45d10e49, 0x45d10ee9, 0x45d10fc5, 0x45d11169, 0x45d112e9,
+    0x45d1136a, 0x45d136c9, 0x45d13846, 0x45d13b69, 0x45d14d69, 0x45d16191, 0x45d16215, 0x45d16391,
+    0x45d17505, 0x45d1b049, 0x45d1b0e9, 0x45d1b1c5, 0x45d1b369, 0x45d1b4e9, 0x45d1b56a, 0x45d1c6e9,
+    0x45d1c76a, 0x45d1c8ea, 0x45d1ef69, 0x45d1f169, 0x45d20369, 0x45d22485, 0x45d22615, 0x45d22795,
+    0x45d22c15, 0x45d22e15, 0x45d23995, 0x45d24e91, 0x45d262d9, 0x45d26459, 0x45d27659, 0x45d276e9,
+    0x45d27869, 0x45d29ed9, 0x45d2c991, 0x45d2ce11, 0x45d2dc56, 0x45d2ddd5, 0x45d2e185, 0x45d2ef05,
+    0x45d2efd5, 0x45d2f056, 0x45d2f1d5, 0x45d304d1, 0x45d30651, 0x45d316c9, 0x45d31b69, 0x45d31fe9,
+    0x45d32169, 0x45d32ae9, 0x45d32bc5, 0x45d32d69, 0x45d32ee9, 0x45d33369, 0x45d35446, 0x45d35769,
+    0x45d35be9, 0x45d35de9, 0x45d36969, 0x45d3cce9, 0x45d3cdc5, 0x45d3cf69, 0x45d3d0e9, 0x45d3d569,
+    0x45d3d76a, 0x45d3e2e9, 0x45d3e96a, 0x45d411e9, 0x45d68695, 0x45d68815, 0x45d6c10a, 0x45d7b666,
+    0x45d7b7e1, 0x45d7f315, 0x45d7f495, 0x45d82fe1, 0x45d83161, 0x45d86b05, 0x45d8a296, 0x45d8a415,
+    0x45d95fba, 0x45d96115, 0x45d9d266, 0x45d9d3e5, 0x45d9d7ba, 0x45da1095, 0x45da1515, 0x45da4be1,
+    0x45da4d61, 0x45db47a6, 0x45dc3a96, 0x45dcafa6, 0x45dcb2a6, 0x45dd6866, 0x45dd69e5, 0x45ded6e6,
+    0x45df1396, 0x45df845a, 0x45df85da, 0x45e04166, 0x45e07756, 0x45e07b96, 0x45e07e96, 0x45e0b666,
+    0x45e0bae6, 0x45e0dee6, 0x45e0e366, 0x45e0e4e6, 0x45e3195e, 0x45e32e91, 0x45e33011, 0x45e3408a,
+    0x45e35409, 0x45e35495, 0x45e35585, 0x45e39005, 0x45e393d9, 0x45e39559, 0x45e3bc66, 0x45e3bdd9,
+    0x45e3cfd9, 0x45e3d066, 0x45e3d1d9, 0x45e40d79, 0x45e40ed5, 0x45e40f55, 0x45e447ca, 0x45e48466,
+    0x45e48865, 0x45e49b11, 0x45e49c91, 0x45e4e9ca, 0x45e50065, 0x45e501e5, 0x45e51305, 0x45e528e5,
+    0x45e52a65, 0x45e539c9, 0x45e53c65, 0x45e54a95, 0x45e54c11, 0x45e55c89, 0x45e57096, 0x45e57199,
+    0x45e59dd9, 0x45e5afd9, 0x45e5b159, 0x45e5d866, 0x45e5d9d9, 0x45e5ebda, 0x45e5ec5a, 0x45e5edda,
+    0x45e607ba, 0x45e60911, 0x45e61765, 0x45e62ae5, 0x45e663e5, 0x45e66866, 0x45e66e65, 0x45e67a66,
+    0x45e67fba, 0x45e696e5, 0x45e6a066, 0x45e6a466, 0x45e6b891, 0x45e6bd11, 0x45e6d085, 0x45e6ded6,
+    0x45e705c9, 0x45e70ee5, 0x45e71ac5, 0x45e71c65, 0x45e71de5, 0x45e72265, 0x45e74665, 0x45e74ae5,
+    0x45e94761, 0x45ea38e1, 0x45ea3a61, 0x45eb2d61, 0x45eba562, 0x45eba6e2, 0x45ec2061, 0x45ec54da,
+    0x45ec565a, 0x45ed47d6, 0x45ed4956, 0x45ed86e2, 0x45f4ab59, 0x45f51f85, 0x45f52379, 0x45f524d5,
+    0x45f52555, 0x45f55dca, 0x45f5864a, 0x45f599c9, 0x45f59a49, 0x45f68fd5, 0x45f69155, 0x45f691d5,
+    0x45f6ca4a, 0x45f706c9, 0x45f743ca, 0x45f7bfb9, 0x45f7c045, 0x45f7c139, 0x45f7c1b9, 0x45f7d3d1,
+    0x45f7d551, 0x45f7e5ca, 0x45f7f949, 0x45f7f9d5, 0x45f7fac5, 0x45f7fc55, 0x45f7fdd5, 0x45f83545,
+    0x45f83939, 0x45f83ab9, 0x45f84d51, 0x45f84ed1, 0x45f85dc5, 0x45f861b9, 0x45f86339, 0x45f863b9,
+    0x45f87445, 0x45f87539, 0x45f875b9, 0x45f87739, 0x45f899d9, 0x45f8ad59, 0x45f8c851, 0x45f8e659,
+    0x45f8ec49, 0x45f8fcd9, 0x45f922da, 0x45f9a5b9, 0x45f9a739, 0x45f9ce39, 0x45f9cfb9, 0x45f9d039,
+    0x45f9e1b9, 0x45f9e239, 0x45f9e3b9, 0x45f9efd1, 0x45f9f151, 0x45fa01c9, 0x45fa15d6, 0x45fa16d6,
+    0x45fa2a49, 0x45fa4339, 0x45fa47b9, 0x45fa4939, 0x45fa5539, 0x45fa56b9, 0x45fa5a45, 0x45fa5b39,
+    0x45fa7db9, 0x45fa7f39, 0x45fa7fb9, 0x45fa83b9, 0x45fa8439, 0x45fdafd5, 0x45fde8ca, 0x45fe2961,
+    0x45fe6305, 0x45fea161, 0x45fea2e1, 0x45fedd61, 0x45fedf61, 0x45ffca56, 0x45ffcb05, 0x45ffcbd5,
+    0x45ffcfba, 0x46000961, 0x46000f61, 0x46004561, 0x460049fa, 0x4600bd61, 0x4600bee1, 0x4600c361,
+    0x46013f96, 0x4602a796, 0x4602aa96, 0x46036056, 0x460361d5, 0x46039aca, 0x4603d6c9, 0x460491b9,
+    0x4604ced6, 0x460509b9, 0x46050b39, 0x460533b9, 0x460545b9, 0x460547b9, 0x46057dd5, 0x4605b6c9,
+    0x460671b9, 0x460677b9, 0x4606a039, 0x4606adb9, 0x4606b439, 0x460713b9, 0x46071839, 0x460719b9,
+    0x460725b9, 0x46072739, 0x46072bb9, 0x46074fb9, 0x46075439, 0x46081e59, 0x4609b086, 0x4609b456,
+    0x4609b5d5, 0x4609c7d5, 0x4609c9d5, 0x4609dcd1, 0x4609eeca, 0x460a0249, 0x460a03c5, 0x460a2ac9,
+    0x460a57d1, 0x460a684a, 0x460a7bc9, 0x460a7d79, 0x460a8055, 0x460a90ca, 0x460ab7c5, 0x460abbb9,
+    0x460abd39, 0x460ad151, 0x460ae046, 0x460ae5b9, 0x460af7b9, 0x460af9b9, 0x460b0b05, 0x460b20d5,
+    0x460b2255, 0x460b3455, 0x460b4951, 0x460b4ad1, 0x460b59c5, 0x460b5db9, 0x460b5f39, 0x460b7139,
+    0x460b8551, 0x460b8751, 0x460b98c5, 0x460b99b9, 0x460b9bb9, 0x460badb9, 0x460bd056, 0x460bd1d5,
+    0x460be3d5, 0x460be456, 0x460be5d5, 0x460c1fc5, 0x460c7256, 0x460c7305, 0x460c73d1, 0x460c77ba,
+    0x460c8456, 0x460c8ed5, 0x460c9856, 0x460c9979, 0x460c9c55, 0x460cb151, 0x460cb751, 0x460cc5b9,
+    0x460cca39, 0x460ccbb9, 0x460cd7b9, 0x460cd939, 0x460ced51, 0x460cf1fa, 0x460d01b9, 0x460d0839,
+    0x460d13b9, 0x460d15b9, 0x460d1a39, 0x460d3e55, 0x460d42d5, 0x460d6551, 0x460d66d1, 0x460d6b51,
+    0x460d79b9, 0x460d7b39, 0x460d7ec5, 0x460d8c45, 0x460d8d39, 0x460db5b9, 0x460db7b9, 0x460dbc39,
+    0x460e0d55, 0x460f3d1d, 0x460fb69d, 0x46102dc9, 0x46102f45, 0x46106d99, 0x46106f19, 0x46106f99,
+    0x4610a999, 0x4610e715, 0x4610e895, 0x4610e915, 0x46115f05, 0x46119c95, 0x46128999, 0x46128f99,
+    0x46130326, 0x461304a6, 0x46130915, 0x46144dd1, 0x46144f51, 0x461462c5, 0x461473c9, 0x461476c5,
+    0x4614dba5, 0x4614dd19, 0x4614efa5, 0x4614f119, 0x4615ce95, 0x4615d039, 0x4615e295, 0x4615e439,
+    0x46166e49, 0x46169915, 0x46169a95, 0x46169b15, 0x4616ea25, 0x4616eb91, 0x4617c8e5, 0x4617ca65,
+    0x4617cae5, 0x4617dd11, 0x46184265, 0x461843f9, 0x46184479, 0x46186ae5, 0x46186c79, 0x46187e65,
+    0x46187ee5, 0x46188079, 0x46188a49, 0x4618a315, 0x4618a795, 0x4618a915, 0x4618b515, 0x4618bb95,
+    0x4618bd15, 0x46190625, 0x46194526, 0x46194991, 0x46194b11, 0x4619aee5, 0x4619b065, 0x4619d2e6,
+    0x4619d765, 0x4619d8e5, 0x4619e4e6, 0x4619eae5, 0x4619eb65, 0x4619ece5, 0x4619f911, 0x461a4c79,
+    0x461a50e5, 0x461a5279, 0x461a5e65, 0x461a5ff9, 0x461a6465, 0x461a64e5, 0x461a6679, 0x461a86e5,
+    0x461ab551, 0x461ac7c9, 0x461acac5, 0x461b0719, 0x461b0899, 0x461b0919, 0x461b1a99, 0x461b4319,
+    0x461b43a5, 0x461b4519, 0x461c3615, 0x461c3695, 0x461c3839, 0x461cd5c9, 0x461cd745, 0x461ced15,
+    0x461cee95, 0x461cef15, 0x461d0095, 0x461d3dd9, 0x461d5191, 0x461d8f11, 0x461d9091, 0x461d9111,
+    0x461db605, 0x461df1c9, 0x461df465, 0x461df5e5, 0x461df665, 0x461e0705, 0x461e1ce5, 0x461e1e65,
+    0x461e1ee5, 0x461e3065, 0x461e4491, 0x461e9665, 0x461e97f9, 0x461e9879, 0x461ea9e5, 0x461ed265,
+    0x461ed2e5, 0x461ed479, 0x461f0915, 0x461f0a95, 0x461f0f15, 0x461f0f95, 0x461f1115, 0x461f1c95,
+    0x461f59d9, 0x461fab26, 0x461faca6, 0x461fb111, 0x461fc485, 0x461fd226, 0x462002e5, 0x46200465,
+    0x462004e5, 0x46200de5, 0x46201066, 0x462011e6, 0x46201665, 0x462038e6, 0x46203a66, 0x46203ee5,
+    0x46203f65, 0x462040e5, 0x46204c66, 0x4620b265, 0x4620b3f9, 0x4620b865, 0x4620b8e5, 0x4620ba79,
+    0x4620c5e5, 0x4620ee65, 0x4622f17a, 0x46249961, 0x46249ae1, 0x46249b61, 0x462512e1, 0x46254ee1,
+    0x4625ca59, 0x46267f61, 0x4626bb61, 0x46272ee1, 0x4627b115, 0x4627ed59, 0x46280011, 0x46281505,
+    0x46282609, 0x46286555, 0x46289fca, 0x4628dbc9, 0x4628dc49, 0x4628dedd, 0x4628e0dd, 0x46291909,
+    0x46295a79, 0x462980dd, 0x46298279, 0x462994dd, 0x4629d1d5, 0x462a0c4a, 0x462a2089, 0x462a4b59,
+    0x462a4d59, 0x462b01b9, 0x462b0339, 0x462b03b9, 0x462b7b39, 0x462b7cba, 0x462b8f51, 0x462bb549,
+    0x462bb739, 0x462bb7b9, 0x462beb9a, 0x462bee9a, 0x462bf209, 0x462c0a51, 0x462c2e49, 0x462c3359,
+    0x462c3c9a, 0x462c3f9a, 0x462c555a, 0x462c59d9, 0x462c5b59, 0x462c675a, 0x462c695a, 0x462c6dd9,
+    0x462ce7b9, 0x462ce939, 0x462ce9b9, 0x462cfbd1, 0x462d21c9, 0x462d2439, 0x462d25b9, 0x462d2f89,
+    0x462d5a55, 0x462d60d5, 0x462d89b9, 0x462d8b3a, 0x462d94c9, 0x462d9739, 0x462d98ba, 0x462d9b49,
+    0x462d9d39, 0x462d9db9, 0x462d9f3a, 0x462dab51, 0x462dbd49, 0x462e0515, 0x462e5559, 0x462e7a09,
+    0x462e7d05, 0x462f07c9, 0x462f32dd, 0x462f34dd, 0x462f6d09, 0x462fae79, 0x462fe8dd, 0x462fea79,
+    0x46307449, 0x46309f59, 0x4630a0d9, 0x4630a159, 0x46312d39, 0x46312eb9, 0x46312f39, 0x46314151,
+    0x463142d1, 0x46314351, 0x463155b9, 0x46315739, 0x463157b9, 0x46316939, 0x463169b9, 0x46316b39,
+    0x4631a5d5, 0x4631cf39, 0x4631d0ba, 0x4631e2b9, 0x4631e339, 0x4631e4ba, 0x46320bb9, 0x46321f39,
+    0x46328759, 0x46329059, 0x4632bb5a, 0x4632bd5a, 0x4632c1d9, 0x4632c359, 0x46333bb9, 0x46333d39,
+    0x46333db9, 0x46334f39, 0x46334fb9, 0x46335139, 0x46337839, 0x463379b9, 0x46338bb9, 0x4633ae55,
+    0x4633b4d5, 0x4633eb39, 0x4633ecba, 0x4633f139, 0x4633f1b9, 0x4633feb9, 0x4633ff39, 0x463400ba,
+    0x46340539, 0x4634bb99, 0x4636a195, 0x46375705, 0x46379561, 0x463796e1, 0x46379761, 0x4637d161,
+    0x46384ae1, 0x46384b61, 0x46384cf9, 0x46388761, 0x4639b161, 0x4639b2e1, 0x4639b761, 0x463a6d61,
+    0x463ad395, 0x463ad515, 0x463ae795, 0x463ae915, 0x463afc11, 0x463afd91, 0x463b1105, 0x463b2209,
+    0x463b2505, 0x463bdadd, 0x463bdc5d, 0x463bdcdd, 0x463c04dd, 0x463c18dd, 0x463c7cdd, 0x463c7e79,
+    0x463c90dd, 0x463c9279, 0x463ce215, 0x463ce391, 0x463d1c89, 0x463d4759, 0x463d48d9, 0x463d4959,
+    0x463d7159, 0x463dfdb9, 0x463dff39, 0x463dffb9, 0x463e1351, 0x463e39b9, 0x463e62d5, 0x463e6479,
+    0x463e8b51, 0x463e9fb9, 0x463eb339, 0x463eb3b9, 0x463efe15, 0x463eff91, 0x463f3889, 0x463f5159,
+    0x463f55d9, 0x463f5759, 0x463f6359, 0x463f64d9, 0x463f69d9, 0x463f6b59, 0x463f8d59, 0x463fcad5,
+    0x463fcf55, 0x463fd0d5, 0x463fde55, 0x463fe355, 0x463fe4d5, 0x463ff351, 0x463ff7d1, 0x463ff951,
+    0x464007b9, 0x46400c39, 0x46400db9, 0x464019b9, 0x46401b39, 0x46401bb9, 0x46401fb9, 0x46402039,
+    0x464021b9, 0x46402f51, 0x46407ed5, 0x46408079, 0x4640a751, 0x4640a8f9, 0x4640c1b9, 0x46413b15,
+    0x46413b95, 0x46413d15, 0x46417609, 0x46417905, 0x46418bd9, 0x46422ede, 0x4642305e, 0x464230de,
+    0x4642425d, 0x46426add, 0x46426cdd, 0x4642e45d, 0x4642e4dd, 0x4642e679, 0x46434991, 0x464371d5,
+    0x46439b5a, 0x46439cda, 0x46439d5a, 0x4643ac49, 0x4643aed9, 0x4643d759, 0x4643ff05, 0x464414d6,
+    0x46441656, 0x464416d6, 0x464425c9, 0x46442855, 0x46443d52, 0x46443ed2, 0x46443f52, 0x46446539,
+    0x464465b9, 0x46446739, 0x46447951, 0x46448db9, 0x46448fb9, 0x4644a1b9, 0x4644ca55, 0x4644cad5,
+    0x4644cc79, 0x4644de55, 0x4644f2d1, 0x4644f351, 0x46450739, 0x464507b9, 0x46451b39, 0x46452f51,
+    0x464543b9, 0x4645b5c5, 0x4645b759, 0x4645b8d9, 0x4645bd59, 0x4645bdd9, 0x4645bf59, 0x4645cad9,
+    0x4645f359, 0x464630d5, 0x46463255, 0x464636d5, 0x46464455, 0x46465951, 0x46465f51, 0x46466db9,
+    0x46466f39, 0x46466fb9, 0x464673b9, 0x46467439, 0x46468139, 0x464681b9, 0x46468339, 0x464687b9,
+    0x4646abb9, 0x4646b039, 0x4646ecd5, 0x46472339, 0x464723b9, 0x4649d455, 0x4649da55, 0x464a1119,
+    0x464a1299, 0x464a8b66, 0x464a8c25, 0x464a8fc5, 0x464ac525, 0x464acfa1, 0x464b0426, 0x464b05a6,
+    0x464b0a21, 0x464b7da1, 0x464b7f21, 0x464b83a1, 0x464bfcd5, 0x464c376a, 0x464cf021, 0x464cf0aa,
+    0x464d2ca1, 0x464da62a, 0x464e0885, 0x464e0c55, 0x464e0dd5, 0x464e1fd5, 0x464e21d5, 0x464e5a49,
+    0x464e5aea, 0x464e70d1, 0x464e82c9, 0x464e8445, 0x464f4f9d, 0x464f63d1, 0x464f75c9, 0x464f7745,
+    0x464fb11d, 0x464fb59d, 0x464fb71d, 0x464fc91d, 0x464fc9aa, 0x464fcb2a, 0x464ff19d, 0x46501651,
+    0x46501ad1, 0x46501c51, 0x46502fc5, 0x46503e15, 0x46507709, 0x46508019, 0x46508199, 0x4650a425,
+    0x4650a8a5, 0x4650aa19, 0x4650bc19, 0x4650bca5, 0x4650be19, 0x4650f526, 0x4650f995, 0x4650fb15,
+    0x465131e5, 0x46514626, 0x46514aa5, 0x46514c11, 0x46516de5, 0x46517e49, 0x46519715, 0x46519b95,
+    0x46519d15, 0x4651a915, 0x4651af15, 0x4651af95, 0x4651b115, 0x4651bf91, 0x4651c411, 0x4651c591,
+    0x4651e5e5, 0x4651e765, 0x4651fa25, 0x46520011, 0x46524ec9, 0x465262c9, 0x46528a19, 0x46528e99,
+    0x46529019, 0x4652a219, 0x4652a2aa, 0x4652a42a, 0x4652ca99, 0x4652de99, 0x465303a6, 0x46530815,
+    0x46530995, 0x46531b95, 0x46536c91, 0x46539289, 0x4653bd95, 0x4653d195, 0x4653e611, 0x46540c2a,
+    0x465473d5, 0x465475d5, 0x4654ae49, 0x4654aeea, 0x4655679e, 0x4655a39d, 0x4655a59d, 0x46561d1d,
+    0x46561daa, 0x46561f2a, 0x46567c55, 0x46568251, 0x465690a6, 0x46569215, 0x46569449, 0x465695c5,
+    0x4656a345, 0x4656a415, 0x4656a4a6, 0x4656b911, 0x4656ba91, 0x4656d59a, 0x4656e005, 0x4656e199,
+    0x4656e799, 0x465708a6, 0x46571019, 0x46571d99, 0x465732a6, 0x46573366, 0x46573425, 0x465737c5,
+    0x46574d96, 0x46574f16, 0x465759a5, 0x46575b26, 0x46575ca6, 0x46576115, 0x46577792, 0x465797e5,
+    0x46579965, 0x4657ada6, 0x4657b211, 0x4657c1e5, 0x4657c585, 0x4657d326, 0x4657d3e5, 0x4657d5e5,
+    0x4657da65, 0x46580315, 0x46581095, 0x46582591, 0x46582b91, 0x465839e5, 0x4658b6c9, 0x4658f619,
+    0x4658f6aa, 0x4658f82a, 0x46590399, 0x46590a2a, 0x46593299, 0x46596f95, 0x46597d26, 0x465a2595,
+    0x465d0e99, 0x465d4799, 0x465d869a, 0x465e06e1, 0x465e0861, 0x465eb661, 0x465eb7e1, 0x465ebc61,
+    0x466028e1, 0x4660d861, 0x466142c9, 0x466145c5, 0x46615649, 0x466156c9, 0x466159c5, 0x46616f11,
+    0x46619619, 0x46619799, 0x4661982a, 0x4661be99, 0x4661c019, 0x4661d219, 0x4661d299, 0x4661d419,
+    0x46624ddd, 0x4662ad15, 0x4662b195, 0x4662b315, 0x4662c515, 0x4662c595, 0x4662c715, 0x4662ec09,
+    0x4662ef05, 0x4662ff89, 0x4663002a, 0x4663032a, 0x46632809, 0x4663b459, 0x4663ba59, 0x4663c89a,
+    0x4663e205, 0x4663f059, 0x4663f0d9, 0x46646cca, 0x4664abe9, 0x4664ad69, 0x4664d505, 0x4664e355,
+    0x4664fe51, 0x46651c49, 0x46652569, 0x466526e9, 0x46653089, 0x46654969, 0x46654de9, 0x46654f69,
+    0x46655b69, 0x46656169, 0x466561e9, 0x46656369, 0x4665861a, 0x46658a95, 0x46658c15, 0x46659e15,
+    0x46659e95, 0x4665a015, 0x4665b009, 0x4665c8d9, 0x4665d659, 0x4665dad9, 0x4665dce9, 0x46664255,
+    0x46665655, 0x46666ad1, 0x466691e9, 0x46669369, 0x466693ea, 0x4666ba69, 0x4666bbe9, 0x4666cde9,
+    0x4666ce69, 0x4666cfe9, 0x46671a51, 0x46671ed1, 0x46672f69, 0x466733e9, 0x46673569, 0x46674769,
+    0x466747ea, 0x4667496a, 0x46676fe9, 0x4667aa49, 0x4667aac9, 0x4667adc5, 0x4667ea19, 0x4667eb99,
+    0x4667ec2a, 0x4667fd99, 0x46682619, 0x46682699, 0x46682819, 0x46689e1e, 0x4668a11e, 0x46691915,
+    0x46691995, 0x46691b15, 0x46695389, 0x4669542a, 0x4669572a, 0x4669b519, 0x4669b699, 0x4669dc19,
+    0x466a1a59, 0x466a1bd9, 0x466a2e9a, 0x466a4459, 0x466a5659, 0x466a56d9, 0x466a5859, 0x466a5cd9,
+    0x466a99d5, 0x466a9a55, 0x466ad449, 0x466ad4e9, 0x466ad5c5, 0x466ad769, 0x466afcc9, 0x466afe45,
+    0x466affe9, 0x466b0169, 0x466b10c9, 0x466b1369, 0x466b35d5, 0x466b3755, 0x466b4955, 0x466b49d5,
+    0x466b5e51, 0x466b5fd1, 0x466b7049, 0x466b7969, 0x466b7ae9, 0x466b8545, 0x466b86e9, 0x466b8ce9,
+    0x466badc5, 0x466baf69, 0x466bb0e9, 0x466bb569, 0x466bb5e9, 0x466bb769, 0x466bc2e9, 0x466bf215,
+    0x466bf295, 0x466bf415, 0x466bff9a, 0x466c30e9, 0x466caa55, 0x466ce5e9, 0x466ce769, 0x466ce7ea,
+    0x466cf969, 0x466d21e9, 0x466d2269, 0x466d23e9, 0x466d35e9, 0x466d9b69, 0x466d9bea, 0x466d9d6a,
+    0x466da8e9, 0x466dd7e9, 0x46708299, 0x46708899, 0x4670fc15, 0x4670fd95, 0x46710215, 0x467138e1,
+    0x46713a61, 0x4671b815, 0x4672ab2a, 0x467468d1, 0x46747ac9, 0x46747c45, 0x4674ba99, 0x4674bc19,
+    0x4674ce19, 0x4674ceaa, 0x4674d02a, 0x4674f699, 0x4675e995, 0x46762409, 0x46768645, 0x46769c15,
+    0x4676a095, 0x4676a215, 0x4676af95, 0x4676b415, 0x4676b495, 0x4676b615, 0x4676c491, 0x4676db1a,
+    0x4676de1a, 0x4676ead9, 0x4676ec59, 0x46770091, 0x46770511, 0x467726d9, 0x46773e15, 0x46774295,
+    0x46774411, 0x467765d5, 0x46779ec9, 0x4677a369, 0x4677a7e9, 0x4677a969, 0x4677d1e9, 0x4677df69,
+    0x4677e3e9, 0x4677e5e9, 0x4677f215, 0x4677f391, 0x4677f811, 0x46782c89, 0x46784569, 0x467849e9,
+    0x46784b69, 0x46785769, 0x467858e9, 0x4678596a, 0x46785d69, 0x46785dea, 0x46785f6a, 0x46788169,
+    0x467885e9, 0x467899e9, 0x4678c295, 0x4678d695, 0x46796491, 0x4679b1e9, 0x4679b669, 0x4679b7e9,
+    0x4679c9e9, 0x4679ca6a, 0x4679cbea, 0x4679f269, 0x467a0669, 0x467a6be9, 0x467a7fea, 0x467b2229,
+    0x467b22aa, 0x467b242a, 0x467d00aa, 0x467d0829, 0x467d15a9, 0x467d2aa9, 0x467d3eea, 0x467d406a,
+    0x467d526a, 0x467d52ea, 0x467d546a, 0x467d7aea, 0x467da5a9, 0x467daa29, 0x467db856, 0x467db9ea,
+    0x467dbd96, 0x467dcb29, 0x467dcbea, 0x467dcc56, 0x467dcdea, 0x467de0ea, 0x467de26a, 0x467e07ea,
+    0x467e0969, 0x467e0ae9, 0x467e0f69, 0x467e3046, 0x467e37e9, 0x467e39e9, 0x467e4569, 0x467ea9ea,
+    0x467eab69, 0x467ead6a, 0x467eb169, 0x467ebee9, 0x467ebf6a, 0x467ec56a, 0x467eede9, 0x467f2aa9,
+    0x46801de9, 0x46801e6a, 0x46801fea, 0x46802b69, 0x468031ea, 0x46805a69, 0x4680d3ea, 0x46838015,
+    0x4683b909, 0x46843bba, 0x46843d15, 0x468473e5, 0x4684afe5, 0x4684b3ba, 0x4684eb15, 0x4684ec95,
+    0x4684f115, 0x468527e1, 0x46852961, 0x46865dba, 0x468a25d9, 0x468a61d9, 0x468b1ee5, 0x468b9265,
+    0x468b96e5, 0x468bbae5, 0x468bbf65, 0x468bc0e5, 0x468bcce5, 0x468bd2e5, 0x468bd365, 0x468bd4e5,
+    0x468c1e85, 0x468c3459, 0x468c7289, 0x468cd665, 0x468d2d65, 0x468d4165, 0x468d8bd1, 0x468d9f45,
+    0x468da0e5, 0x468da565, 0x468de165, 0x46902449, 0x46902695, 0x46902811, 0x46904d99, 0x46904f1a,
+    0x46908bd9, 0x46908d59, 0x4690a025, 0x4690b466, 0x4690b5d9, 0x4690c7d9, 0x4690c866, 0x4690c9d9,
+    0x4690ce59, 0x4690df26, 0x4690e3ba, 0x4690e511, 0x469106e5, 0x46913fe5, 0x46914466, 0x46914a65,
+    0x46915666, 0x46915bba, 0x469172e5, 0x46917ee6, 0x46918066, 0x46919311, 0x46919491, 0x46919911,
+    0x4691ac85, 0x4691bad5, 0x4691e1c9, 0x4691eae5, 0x4691f6c5, 0x4691f865, 0x4691f9e5, 0x4691fe65,
+    0x469220e5, 0x46922265, 0x469226e5, 0x46922765, 0x469228e5, 0x46923465, 0x469305ba, 0x469358e5,
+    0x4693937a, 0x46939565, 0x46940ce5, 0x46941a65, 0x46944965, 0x4696f659, 0x4696fc59, 0x46973259,
+    0x4697aeca, 0x46982555, 0x46985e49, 0x46989d61, 0x46991859, 0x46991cd9, 0x469b0596, 0x469b41d9,
+    0x469bf44a, 0x469c3049, 0x469c30c9, 0x469c6d96, 0x469c7096, 0x469cacdd, 0x469cae5d, 0x469cd55d,
+    0x469cd6dd, 0x469e57b9, 0x469e5839, 0x469ecb39, 0x469ecfb9, 0x469ed139, 0x469ef3b9, 0x469ef839,
+    0x469ef9b9, 0x469f05b9, 0x469f0739, 0x469f07b9, 0x469f0bb9, 0x469f0c39, 0x469f0db9, 0x469f3655,
+    0x469f4696, 0x469f4996, 0x469f4a55, 0x469f58d9, 0x469f5ed1, 0x469fae59, 0x469fafd9, 0x46a03db9,
+    0x46a06639, 0x46a075c9, 0x46a07a39, 0x46a0c3c5, 0x46a0d9b9, 0x46a0dfb9, 0x46a0ebb9, 0x46a0ed39,
+    0x46a0f1b9, 0x46a11439, 0x46a115b9, 0x46a117c9, 0x46a2877a, 0x46a2fc5d, 0x46a300dd, 0x46a3025d,
+    0x46a3145d, 0x46a33cdd, 0x46a33d5d, 0x46a33edd, 0x46a38959, 0x46a3c259, 0x46a3d69a, 0x46a3d8d9,
+    0x46a3ead9, 0x46a4015a, 0x46a441c9, 0x46a44255, 0x46a47dc5, 0x46a481b9, 0x46a48339, 0x46a4a645,
+    0x46a4aa39, 0x46a4abb9, 0x46a4ac39, 0x46a4bdb9, 0x46a4be39, 0x46a4bfb9, 0x46a4cbd1, 0x46a4cd51,
+    0x46a4ddc9, 0x46a4f2c5, 0x46a4fa55, 0x46a51f39, 0x46a523b9, 0x46a52539, 0x46a53139, 0x46a532b9,
+    0x46a53739, 0x46a54551, 0x46a559b9, 0x46a55b39, 0x46a55bb9, 0x46a55fb9, 0x46a56039, 0x46a561b9,
+    0x46a56d39, 0x46a56db9, 0x46a56f39, 0x46a573b9, 0x46a59e55, 0x46a615d9, 0x46a691b9, 0x46a6a3b9,
+    0x46a6ce39, 0x46a73fb9, 0x46a74139, 0x46a75339, 0x46a77bb9, 0x46a77c39, 0x46a77db9, 0x46aaa705,
+    0x46aaa7d5, 0x46aaabba, 0x46aae0c9, 0x46aae561, 0x46aaeb61, 0x46ab2161, 0x46ab25fa, 0x46ab9961,
+    0x46ab9ae1, 0x46ab9f61, 0x46abdbe1, 0x46af2f7a, 0x46af30dd, 0x46af595d, 0x46af6b7a, 0x46af6d5d,
+    0x46afccdd, 0x46afd15d, 0x46afd2dd, 0x46afe4dd, 0x46b00d5d, 0x46b059d5, 0x46b092c9, 0x46b14db9,
+    0x46b153b9, 0x46b17c39, 0x46b189b9, 0x46b19039, 0x46b1efb9, 0x46b1f439, 0x46b1f5b9, 0x46b201b9,
+    0x46b20339, 0x46b22bb9, 0x46b23039, 0x46b23db9, 0x46b2e659, 0x46b34645, 0x46b35c39, 0x46b36fb9,
+    0x46b39839, 0x46b3ac39, 0x46b41039, 0x46b411b9, 0x46b423b9, 0x46b44c39, 0x46b48f95, 0x46b49016,
+    0x46b49196, 0x46b596fa, 0x46b5bf7a, 0x46b5c15d, 0x46b638dd, 0x46b69815, 0x46b69991, 0x46b69e11,
+    0x46b6ac56, 0x46b6add5, 0x46b6bf05, 0x46b6bfd5, 0x46b6c056, 0x46b6c1d5, 0x46b6d289, 0x46b6d4d1,
+    0x46b6e6d9, 0x46b6fbc5, 0x46b6fd59, 0x46b6fed9, 0x46b70359, 0x46b72446, 0x46b72759, 0x46b72bd9,
+    0x46b73959, 0x46b74e56, 0x46b74f05, 0x46b74fd1, 0x46b753ba, 0x46b76ad6, 0x46b77579, 0x46b776fa,
+    0x46b77855, 0x46b77cfa, 0x46b788d1, 0x46b78d52, 0x46b7b3b9, 0x46b7b539, 0x46b7c951, 0x46b7cdfa,
+    0x46b7ddb9, 0x46b7e439, 0x46b7eefa, 0x46b7efb9, 0x46b7f1b9, 0x46b7f639, 0x46b818d5, 0x46b81a55,
+    0x46b81ed5, 0x46b82c55, 0x46b832d6, 0x46b84151, 0x46b84751, 0x46b855b9, 0x46b85739, 0x46b86939,
+    0x46b891b9, 0x46b893b9, 0x46b8d296, 0x46b911d9, 0x46b91f59, 0x46b94e59, 0x46b98b7a, 0x46b998fa,
+    0x46b9c3b9, 0x46ba0039, 0x46ba4156, 0x46bd6599, 0x46bd6b99, 0x46bddf26, 0x46bde0a6, 0x46bde515,
+    0x46c14bd1, 0x46c15dc9, 0x46c15f45, 0x46c19d99, 0x46c19f19, 0x46c1b119, 0x46c1b199, 0x46c1b319,
+    0x46c1d999, 0x46c2cc95, 0x46c30709, 0x46c36649, 0x46c37f1a, 0x46c38395, 0x46c38515, 0x46c39115,
+    0x46c39715, 0x46c39795, 0x46c39915, 0x46c3e225, 0x46c3e811, 0x46c3fa09, 0x46c42126, 0x46c42591,
+    0x46c42711, 0x46c48ae5, 0x46c48c65, 0x46c48ce5, 0x46c4aee6, 0x46c4b365, 0x46c4b4e5, 0x46c4c0e6,
+    0x46c4c6e5, 0x46c4c765, 0x46c4c8e5, 0x46c4d511, 0x46c4db11, 0x46c52879, 0x46c52ce5, 0x46c52e79,
+    0x46c53a65, 0x46c53bf9, 0x46c54065, 0x46c540e5, 0x46c54279, 0x46c562e5, 0x46c568e5, 0x46c57665,
+    0x46c5a595, 0x46c5b995, 0x46c5e009, 0x46c64791, 0x46c694e6, 0x46c69965, 0x46c69ae5, 0x46c6ace5,
+    0x46c6ad65, 0x46c6aee5, 0x46c6cf66, 0x46c6d0e6, 0x46c6d565, 0x46c6e2e6, 0x46c6e965, 0x46c74ee5,
+    0x46c762e5, 0x46c784e5, 0x46c80525, 0x46c805a5, 0x46c80725, 0x46c9eb25, 0x46c9f8a5, 0x46ca0da5,
+    0x46ca35e6, 0x46ca88a6, 0x46ca8d25, 0x46caa096, 0x46caae26, 0x46caec66, 0x46caede6, 0x46caf265,
+    0x46cb1ae5, 0x46cb1ce5, 0x46cb2866, 0x46cb8e65, 0x46cb9465, 0x46cba1e5, 0x46cbca65, 0x46cc0da5,
+    0x46cd00e5, 0x46cd0165, 0x46cd02e5, 0x46cd0e66, 0x46cd14e5, 0x46cd36e6, 0x46cd38e6, 0x46cd3d65,
+    0x46cdb6e5, 0x46d15b61, 0x46d19761, 0x46d20ae1, 0x46d49995, 0x46d49b15, 0x46d4ad15, 0x46d4ad95,
+    0x46d4af15, 0x46d4d409, 0x46d4d705, 0x46d4e789, 0x46d4e809, 0x46d4eb05, 0x46d51009, 0x46d5a0dd,
+    0x46d5a25d, 0x46d5a2dd, 0x46d5c95d, 0x46d5cadd, 0x46d5dcdd, 0x46d5dd5d, 0x46d5dedd, 0x46d60309,
+    0x46d63e79, 0x46d642dd, 0x46d64479, 0x46d6565d, 0x46d656dd, 0x46d65879, 0x46d67a79, 0x46d67edd,
+    0x46d6bd05, 0x46d70459, 0x46d70ed9, 0x46d7189a, 0x46d7315a, 0x46d735d9, 0x46d73759, 0x46d7435a,
+    0x46d74959, 0x46d749d9, 0x46d7c3b9, 0x46d7c539, 0x46d7c5b9, 0x46d7d7d1, 0x46d7fd49, 0x46d7ffb9,
+    0x46d80039, 0x46d801b9, 0x46d82479, 0x46d82a79, 0x46d865b9, 0x46d8673a, 0x46d87339, 0x46d874ba,
+    0x46d87939, 0x46d879b9, 0x46d88751, 0x46d89f49, 0x46d8af39, 0x46d8afb9, 0x46d9175a, 0x46d91bd9,
+    0x46d91d59, 0x46d92cc9, 0x46d92f59, 0x46d92fd9, 0x46d93159, 0x46d951da, 0x46d9535a, 0x46d957d9,
+    0x46d9655a, 0x46d96bd9, 0x46d9d3b9, 0x46d9e5b9, 0x46d9e7b9, 0x46da1fc9, 0x46da4ad5, 0x46da5ed5,
+    0x46da81b9, 0x46da833a, 0x46da8549, 0x46da87b9, 0x46da9539, 0x46da95b9, 0x46da9bb9, 0x46db0115,
+    0x46db0195, 0x46db0315, 0x46db3b89, 0x46db3c09, 0x46db3f05, 0x46dbf11e, 0x46dbf4de, 0x46dbf65e,
+    0x46dbf6de, 0x46dc085d, 0x46dc30dd, 0x46dc315d, 0x46dc32dd, 0x46dcaa5d, 0x46dcaadd, 0x46dcac79,
+    0x46dd099a, 0x46dd0b1a, 0x46dd0f91, 0x46dd309a, 0x46dd6eda, 0x46dd74d9, 0x46dd995a, 0x46dd9d59,
+    0x46dd9dd9, 0x46dd9f59, 0x46ddaada, 0x46ddee55, 0x46de2bb9, 0x46de2d39, 0x46de3f51, 0x46de5439,
+    0x46de55b9, 0x46de9055, 0x46de90d5, 0x46de9dd5, 0x46deb2d1, 0x46deb8d1, 0x46decdb9, 0x46dedb39,
+    0x46dee139, 0x46df4409, 0x46df8359, 0x46df83d9, 0x46df8559, 0x46df90da, 0x46df9759, 0x46dfb95a,
+    0x46dfb9da, 0x46dfbfd9, 0x46dffcd5, 0x46dffd55, 0x46e010d5, 0x46e02551, 0x46e03bb9, 0x46e04db9,
+    0x46e0b2d5, 0x46e0e939, 0x46e0e9b9, 0x46e0ed49, 0x46e48d61, 0x46e48ee1, 0x46e49361, 0x46e7d195,
+    0x46e80c09, 0x46e8c55e, 0x46e8c6de, 0x46e8d8dd, 0x46e8d95d, 0x46e8dadd, 0x46e9015d, 0x46e97add,
+    0x46e9da15, 0x46e9db91, 0x46e9e011, 0x46ea1489, 0x46ea2d5a, 0x46ea31da, 0x46ea335a, 0x46ea3f59,
+    0x46ea40d9, 0x46ea4559, 0x46ea45d9, 0x46ea4759, 0x46ea6959, 0x46ea6dd9, 0x46ea7b59, 0x46eaa6d6,
+    0x46eaab56, 0x46eaacd6, 0x46eab8d5, 0x46eaba55, 0x46eabed5, 0x46eabf55, 0x46eac0d5, 0x46eacf52,
+    0x46ead3d2, 0x46ead552, 0x46eaf7b9, 0x46eafc39, 0x46eafdb9, 0x46eb0b51, 0x46eb0fd1, 0x46eb5ad5,
+    0x46eb5c79, 0x46eb60d5, 0x46eb74d5, 0x46eb8351, 0x46eb8951, 0x46ec53d9, 0x46ec67d9, 0x46ec89d9,
+    0x46eccd55, 0x46ece155, 0x46ecf5d1, 0x46ed0439, 0x46ed05b9, 0x46ed1839, 0x46ed19b9, 0x46edb9b9,
+    0x47137de9, 0x47a3ad09, 0x47a3ae85, 0x47a3c149, 0x47a3c2c5, 0x47a3c455, 0x47a3c5d5, 0x47a3c656,
+    0x47a3d549, 0x47a3d7e1, 0x47a3d855, 0x47a3e9c9, 0x47a3eb45, 0x47a3fd59, 0x47a40119, 0x47a40299,
+    0x47a41529, 0x47a416a9, 0x47a428d1, 0x47a46651, 0x47a467d1, 0x47a476d5, 0x47a47a95, 0x47a47c15,
+    0x47a48d61, 0x47a48e95, 0x47a49015, 0x47a49f51, 0x47a4a311, 0x47a4a491, 0x47a4c8a2, 0x47a4ca22,
+    0x47a4cba1, 0x47a4cdaa, 0x47a4de45, 0x47a4f109, 0x47a4f285, 0x47a4f425, 0x47a4f5a1, 0x47a4f625,
+    0x47a507a1, 0x47a50825, 0x47a509a1, 0x47a51be5, 0x47a56aa6, 0x47a56c26, 0x47a56da5, 0x47a56f25,
+    0x47a56faa, 0x47a581aa, 0x47a5a9a5, 0x47a5bda5, 0x47a5ca85, 0x47a5dec5, 0x47a5e055, 0x47a5e1d5,
+    0x47a5e655, 0x47a5f3e1, 0x47a5f5d5, 0x47a60745, 0x47a61d19, 0x47a63129, 0x47a632a9, 0x47a644d1,
+    0x47a65845, 0x47a68251, 0x47a683d1, 0x47a68851, 0x47a69695, 0x47a6a961, 0x47a6aa95, 0x47a6ac15,
+    0x47a6bf11, 0x47a6d5a1, 0x47a6da21, 0x47a6e921, 0x47a6e9aa, 0x47a6fa45, 0x47a70e85, 0x47a71025,
+    0x47a711a1, 0x47a71621, 0x47a71821, 0x47a723a1, 0x47a725a1, 0x47a72a21, 0x47a737d1, 0x47a74b45,
+    0x47a78805, 0x47a789a1, 0x47a78b21, 0x47a78fa5, 0x47a79d21, 0x47a79daa, 0x47a79f2a, 0x47a7a3aa,
+    0x47a7c5a1, 0x47a7c7a1, 0x47a7cc25, 0x47a8969a, 0x47aa28c6, 0x47aa2ca6, 0x47aa2e15, 0x47aa3dc9,
+    0x47aa4015, 0x47aa40a6, 0x47aa4215, 0x47aa5145, 0x47aa5511, 0x47aa5691, 0x47aa670a, 0x47aa7a89,
+    0x47aa7c05, 0x47aa7f19, 0x47aab999, 0x47aace95, 0x47aae08a, 0x47aaf409, 0x47aaf5a5, 0x47aaf72a,
+    0x47aaf895, 0x47ab090a, 0x47ab3005, 0x47ab33e5, 0x47ab3565, 0x47ab5886, 0x47ab5c66, 0x47ab5de5,
+    0x47ab6f2a, 0x47ab6fe5, 0x47ab7066, 0x47ab71e5, 0x47abaca5, 0x47abd226, 0x47abd5e6, 0x47abd766,
+    0x47abe9e6, 0x47ac25e6, 0x47ac4895, 0x47ac5b45, 0x47ac5c15, 0x47ac5c96, 0x47ac5e15, 0x47ac7111,
+    0x47ac8309, 0x47ac9805, 0x47ac9999, 0x47ac9b19, 0x47acd599, 0x47acea95, 0x47acfc89, 0x47ad11a5,
+    0x47ad132a, 0x47ad1495, 0x47ad192a, 0x47ad2509, 0x47ad3de5, 0x47ad4fe5, 0x47ad5165, 0x47ad7866,
+    0x47ad79e5, 0x47ad8b2a, 0x47ad8be5, 0x47ad8c66, 0x47ad8de5, 0x47adb72a, 0x47adc895, 0x47adf1e5,
+    0x47ae0485, 0x47b07fd1, 0x47b091c9, 0x47b09415, 0x47b0ce99, 0x47b0d019, 0x47b0d19a, 0x47b0d31a,
+    0x47b0d39a, 0x47b0e5aa, 0x47b0e72a, 0x47b10d99, 0x47b10f99, 0x47b12199, 0x47b14815, 0x47b14995,
+    0x47b14b16, 0x47b14c96, 0x47b15f2a, 0x47b16095, 0x47b17392, 0x47b17512, 0x47b17592, 0x47b19d69,
+    0x47b1af91, 0x47b1b025, 0x47b1b191, 0x47b1c3e5, 0x47b200a5, 0x47b214a5, 0x47b229aa, 0x47b22b2a,
+    0x47b23d66, 0x47b29bd1, 0x47b29c51, 0x47b2af45, 0x47b2b015, 0x47b2ec05, 0x47b2ed99, 0x47b2ef19,
+    0x47b2f399, 0x47b301aa, 0x47b3032a, 0x47b307aa, 0x47b32999, 0x47b32a25, 0x47b32b99, 0x47b33019,
+    0x47b36585, 0x47b36715, 0x47b36895, 0x47b36915, 0x47b36d15, 0x47b37b2a, 0x47b37c95, 0x47b3812a,
+    0x47b38f91, 0x47b39111, 0x47b391aa, 0x47b39591, 0x47b3a3e5, 0x47b3a565, 0x47b3b969, 0x47b3cb91,
+    0x47b3cd91, 0x47b3d211, 0x47b3df05, 0x47b3dfe5, 0x47b41c95, 0x47b41d15, 0x47b41e95, 0x47b44511,
+    0x47b445aa, 0x47b4472a, 0x47b45885, 0x47b45965, 0x47b51899, 0x47b5ba91, 0x47b6f945, 0x47b6fd15,
+    0x47b6fe95, 0x47b71115, 0x47b71295, 0x47b721c5, 0x47b72591, 0x47b72711, 0x47b7378a, 0x47b78a99,
+    0x47b79f11, 0x47b7b10a, 0x47b7d98a, 0x47b800a2, 0x47b80462, 0x47b805e2, 0x47b818aa, 0x47b81a11,
+    0x47b82905, 0x47b82ce1, 0x47b82e61, 0x47b840e1, 0x47b84261, 0x47b85249, 0x47b853c5, 0x47b86995,
+    0x47b86b15, 0x47b86baa, 0x47b87d21, 0x47b87daa, 0x47b87f2a, 0x47b89211, 0x47b89391, 0x47b8a285,
+    0x47b8a661, 0x47b8a7e1, 0x47b8ce11, 0x47b91915, 0x47b92d15, 0x47b92e95, 0x47b94191, 0x47b95389,
+    0x47b99499, 0x47b9bb11, 0x47b9cd09, 0x47b9f589, 0x47ba0e61, 0x47ba1461, 0x47ba2062, 0x47ba21e2,
+    0x47ba34aa, 0x47ba48e1, 0x47ba5ce1, 0x47ba5e61, 0x47ba8b95, 0x47ba9f95, 0x47bab411, 0x47bac261,
+    0x47bc4b69, 0x47bced69, 0x47bcff69, 0x47bd2869, 0x47bd3bde, 0x47bd630a, 0x47bd76a9, 0x47bd7829,
+    0x47bd8b8a, 0x47bdb2a9, 0x47bdb669, 0x47bdb7e9, 0x47bddee9, 0x47bde069, 0x47bdf269, 0x47bdf2e9,
+    0x47bdf469, 0x47be050a, 0x47be2c29, 0x47be2fe9, 0x47be3169, 0x47be6a4a, 0x47be80e9, 0x47be92ca,
+    0x47beaaea, 0x47bee32a, 0x47bee4aa, 0x47bf0c4a, 0x47bf22ea, 0x47bf246a, 0x47bf4b6a, 0x47bf4cea,
+    0x47bf4d6a, 0x47bf5c69, 0x47bf5eea, 0x47bf5f6a, 0x47bf60ea, 0x47bf7f29, 0x47bf83aa, 0x47bf9429,
+    0x47bf972a, 0x47bf9baa, 0x47bfa7a9, 0x47bfc069, 0x47bfd269, 0x47bfd3e9, 0x47bff8aa, 0x47bffae9,
+    0x47bffbaa, 0x47bffc69, 0x47c00e5a, 0x47c00eda, 0x47c0105a, 0x47c02129, 0x47c039e9, 0x47c04be9,
+    0x47c04d69, 0x47c06269, 0x47c08669, 0x47c09ce9, 0x47c0aee9, 0x47c0c6ea, 0x47c0cb6a, 0x47c0ebaa,
+    0x47c12869, 0x47c12cea, 0x47c13eea, 0x47c1406a, 0x47c1676a, 0x47c168ea, 0x47c1696a, 0x47c16d6a,
+    0x47c1be15, 0x47c2b369, 0x47c2eddd, 0x47c3535d, 0x47c36769, 0x47c38fdd, 0x47c3ca89, 0x47c3cc05,
+    0x47c3de89, 0x47c40699, 0x47c40a59, 0x47c40bd9, 0x47c41e69, 0x47c41fe9, 0x47c43291, 0x47c44659,
+    0x47c446d9, 0x47c44859, 0x47c45a59, 0x47c48015, 0x47c483d5, 0x47c48555, 0x47c497d5, 0x47c49955,
+    0x47c4d269, 0x47c4fa49, 0x47c4fbc5, 0x47c4fd69, 0x47c4fee9, 0x47c4ff69, 0x47c51169, 0x47c512e9,
+    0x47c52511, 0x47c52591, 0x47c52711, 0x47c53709, 0x47c53885, 0x47c573c9, 0x47c57545, 0x47c576e9,
+    0x47c57869, 0x47c578ea, 0x47c58aea, 0x47c58c6a, 0x47c5b2e9, 0x47c5b369, 0x47c5b4e9, 0x47c5c6e9,
+    0x47c5d511, 0x47c5e805, 0x47c60395, 0x47c62659, 0x47c627d9, 0x47c62869, 0x47c63a69, 0x47c63be9,
+    0x47c64e91, 0x47c66259, 0x47c662d9, 0x47c69fd5, 0x47c6a155, 0x47c6a1d5, 0x47c6b3d5, 0x47c6b555,
+    0x47c6ca69, 0x47c6da49, 0x47c6dee9, 0x47c6e369, 0x47c717c5, 0x47c71969, 0x47c71ae9, 0x47c71b69,
+    0x47c71f69, 0x47c71fe9, 0x47c72d69, 0x47c72ee9, 0x47c73369, 0x47c79145, 0x47c792e9, 0x47c79469,
+    0x47c798e9, 0x47c7acea, 0x47c7cee9, 0x47c7cf69, 0x47c7d0e9, 0x47c7d569, 0x47ca20d9, 0x47ca729a,
+    0x47ca741a, 0x47ca749a, 0x47ca86aa, 0x47caae99, 0x47cab099, 0x47cac299, 0x47cad4c9, 0x47cad645,
+    0x47caec16, 0x47caed96, 0x47caee16, 0x47caffa1, 0x47cb0015, 0x47cb0195, 0x47cb1492, 0x47cb5091,
+    0x47cc3cd1, 0x47cc8e99, 0x47cc9019, 0x47cc90aa, 0x47cc9499, 0x47cca2aa, 0x47cca42a, 0x47ccca99,
+    0x47cccc99, 0x47ccd119, 0x47ccf245, 0x47cd0815, 0x47cd0995, 0x47cd0e15, 0x47cd1ba1, 0x47cd1d95,
+    0x47cd222a, 0x47cd3091, 0x47cd3211, 0x47cd6c91, 0x47cdbd95, 0x47cdbf95, 0x47cde611, 0x47ce8e9a,
+    0x47cfbe5d, 0x47d0af1a, 0x47d0b199, 0x47d0dada, 0x47d0ee5a, 0x47d0eeda, 0x47d0f05a, 0x47d116da,
+    0x47d12ada, 0x47d15456, 0x47d16589, 0x47d16705, 0x47d167d5, 0x47d16856, 0x47d169d5, 0x47d1a249,
+    0x47d1a3c5, 0x47d1a569, 0x47d1a6e9, 0x47d1cac9, 0x47d1cf69, 0x47d1e169, 0x47d1e369, 0x47d2b885,
+    0x47d2cd95, 0x47d2f6d9, 0x47d2f859, 0x47d30a59, 0x47d30ae9, 0x47d30c69, 0x47d332d9, 0x47d37056,
+    0x47d371d5, 0x47d38305, 0x47d383d5, 0x47d38456, 0x47d385d5, 0x47d3aac9, 0x47d3af69, 0x47d3b3e9,
+    0x47d3bfc5, 0x47d3c169, 0x47d3c2e9, 0x47d3c769, 0x47d3eb69, 0x47d3efe9, 0x47d3f1e9, 0x47d3fd69,
+    0x47d3ff69, 0x47d403e9, 0x47d461c5, 0x47d46369, 0x47d464e9, 0x47d476e9, 0x47d49f69, 0x47d4a169,
+    0x47d70599, 0x47d71999, 0x47d72eaa, 0x47d7425a, 0x47d7a791, 0x47d7a816, 0x47d7a996, 0x47d7b996,
+    0x47d7bb16, 0x47d7bbd5, 0x47d80d6a, 0x47d80eea, 0x47d83569, 0x47d83769, 0x47d84969, 0x47d92195,
+    0x47d92215, 0x47d92395, 0x47d94aaa, 0x47d95e59, 0x47d9c391, 0x47d9c591, 0x47d9d7d5, 0x47da1569,
+    0x47da16e9, 0x47da176a, 0x47da1b69, 0x47da296a, 0x47da2aea, 0x47da5169, 0x47da5369, 0x47da57e9,
+    0x47dacae9, 0x47dacb6a, 0x47daccea, 0x47dbd89a, 0x47dd6ac6, 0x47dd6ea6, 0x47dd7015, 0x47dd8295,
+    0x47dd8415, 0x47dd9345, 0x47dd9711, 0x47dd9891, 0x47dda90a, 0x47ddf909, 0x47de228a, 0x47de393a,
+    0x47de3aa1, 0x47de3b16, 0x47de4b0a, 0x47de7222, 0x47de75e2, 0x47de7762, 0x47de8b91, 0x47de9a86,
+    0x47de9e66, 0x47de9fe1, 0x47deb13a, 0x47deb266, 0x47deb3e1, 0x47dec565, 0x47deef16, 0x47def096,
+    0x47df03a5, 0x47df0525, 0x47df1426, 0x47df17e6, 0x47df1966, 0x47df3fa5, 0x47df67e6, 0x47df8a95,
+    0x47df9e96, 0x47dfa015, 0x47dfb311, 0x47dfc509, 0x47e03e89, 0x47e0553a, 0x47e056a1, 0x47e05716,
+    0x47e05b3a, 0x47e05b96, 0x47e06709, 0x47e06b91, 0x47e0703a, 0x47e07fe1, 0x47e091e2, 0x47e0a791,
+    0x47e0ac3a, 0x47e0ba66, 0x47e0cd3a, 0x47e0ce66, 0x47e0cfe1, 0x47e0e151, 0x47e0f715, 0x47e0f895,
+    0x47e11f91, 0x47e12111, 0x47e125a5, 0x47e133e1, 0x47e146a1, 0x47e16f05, 0x47e3ad5e, 0x47e3d48a,
+    0x47e3e825, 0x47e3e9a5, 0x47e3fd0a, 0x47e42425, 0x47e427e5, 0x47e42965, 0x47e451e5, 0x47e463e5,
+    0x47e46466, 0x47e465e5, 0x47e4768a, 0x47e49da5, 0x47e4a2e5, 0x47e4dbca, 0x47e4f266, 0x47e5044a,
+    0x47e51ae6, 0x47e51c66, 0x47e51ce6, 0x47e57dca, 0x47e5cde6, 0x47e5f0a5, 0x47e605a5, 0x47e61925,
+    0x47e631e5, 0x47e643e5, 0x47e64565, 0x47e66c66, 0x47e66de5, 0x47e67fda, 0x47e6805a, 0x47e681da,
+    0x47e692a5, 0x47e6ab65, 0x47e6bee5, 0x47e6d3e5, 0x47e6f7e5, 0x47e6fc66, 0x47e70e66, 0x47e736e6,
+    0x47e73866, 0x47e738e6, 0x47e73ce6, 0x47e799e5, 0x47e7b066, 0x47e7b1e6, 0x47e7d8e6, 0x47e7da66,
+    0x47e7dae6, 0x47ea3c09, 0x47ea3d95, 0x47ea7819, 0x47ea7d59, 0x47eab7d9, 0x47eacbd9, 0x47eae13a,
+    0x47eaf195, 0x47eaf6d5, 0x47eb0ad5, 0x47eb6bc9, 0x47eb6d79, 0x47eb7065, 0x47eb82fa, 0x47eb8465,
+    0x47ebaa25, 0x47ebe566, 0x47ebe6e6, 0x47ebe865, 0x47ebe9e5, 0x47ec2465, 0x47ec2665, 0x47ec3865,
+    0x47ec5985, 0x47ec97d9, 0x47ec9959, 0x47ecd3d9, 0x47ed0396, 0x47ed1179, 0x47ed12d5, 0x47ed26d5,
+    0x47ed4bc9, 0x47ed5065, 0x47ed54fa, 0x47ed8979, 0x47ed8c65, 0x47ed8ce5, 0x47ed90fa, 0x47ed92e5,
+    0x47ed9efa, 0x47eda065, 0x47eda4fa, 0x47edc605, 0x47edee91, 0x47ee02c5, 0x47ee0465, 0x47ee05e5,
+    0x47ee0a65, 0x47ee4065, 0x47ee4265, 0x47ee46e5, 0x47ef8d62, 0x47f02f61, 0x47f07dde, 0x47f0a50a,
+    0x47f0cd8a, 0x47f0f862, 0x47f0f9e2, 0x47f120e1, 0x47f12261, 0x47f134e1, 0x47f13661, 0x47f1470a,
+    0x47f171e2, 0x47f1d4ca, 0x47f1eb62, 0x47f1ece2, 0x47f1ed62, 0x47f1ffa2, 0x47f20122, 0x47f226a2,
+    0x47f24e4a, 0x47f264e2, 0x47f26662, 0x47f277a2, 0x47f28d62, 0x47f28ee2, 0x47f28f62, 0x47f29e61,
+    0x47f2a0e2, 0x47f2a162, 0x47f2a2e2, 0x47f2c121, 0x47f2e9a1, 0x47f30261, 0x47f31462, 0x47f33ce1,
+    0x47f350da, 0x47f3525a, 0x47f36321, 0x47f367a2, 0x47f37be1, 0x47f38de2, 0x47f3a461, 0x47f3cce2,
+    0x47f3f0e1, 0x47f40762, 0x47f408e2, 0x47f40962, 0x47f40d62, 0x47f45da2, 0x47f46a61, 0x47f47362,
+    0x47f48262, 0x47f486e2, 0x47f4a962, 0x47f4ab62, 0x47f4af62, 0x47fb9359, 0x47fbe1d9, 0x47fc3552,
+    0x47fd7405, 0x47fd77d5, 0x47fd7955, 0x47fd8bd5, 0x47fd8d55, 0x47fda1d2, 0x47fdb24a, 0x47fdee49,
+    0x47fdefc5, 0x47fe0249, 0x47fe2bca, 0x47fe3fd5, 0x47fe937a, 0x47fea3c5, 0x47fea7b9, 0x47fea939,
+    0x47fea9b9, 0x47febbb9, 0x47febd39, 0x47fece91, 0x47fee455, 0x47fee5d5, 0x47fee656, 0x47fef856,
+    0x47fef9d6, 0x47ff0cd1, 0x47ff0e51, 0x47ff1d45, 0x47ff2139, 0x47ff22b9, 0x47ff48d1, 0x47ff4ad1,
+    0x47ff5c45, 0x47ff5d39, 0x47ff5db9, 0x47ff5f39, 0x47ff7139, 0x47ff93d5, 0x47ff9555, 0x47ff95d5,
+    0x47ffa7d5, 0x47ffa955, 0x47ffbc52, 0x47ffce49, 0x47fff8d1, 0x48000bc5, 0x480035d2, 0x480037d5,
+    0x480047c9, 0x48007052, 0x48008939, 0x48008f39, 0x4800af7a, 0x4800b151, 0x4800c3b9, 0x4800c539,
+    0x4800c5b9, 0x4800d7b9, 0x4800d939, 0x4800ddb9, 0x48012ed1, 0x48013d39, 0x48013eb9, 0x48014245,
+    0x48014339, 0x48017939, 0x480179b9, 0x48017b39, 0x48017fb9, 0x4801d09a, 0x48030079, 0x48041cda,
+    0x48046cda, 0x48048391, 0x48049656, 0x4804a93a, 0x4804e77a, 0x4804e8e1, 0x48051161, 0x4805237a,
+    0x48052561, 0x48069f91, 0x4806a43a, 0x4806c53a, 0x4806f161, 0x4806f5fa, 0x4807037a, 0x480704e1,
+    0x4807097a, 0x48072d61, 0x480731fa, 0x480733e1, 0x48073f7a, 0x48074161, 0x480745fa, 0x48075391,
+    0x48076705, 0x48078f85, 0x4807a561, 0x4807a6e1, 0x4807b8e1, 0x4807e161, 0x4807e361, 0x4808625a,
+    0x4808b25a, 0x4809164a, 0x480a4856, 0x480a5bda, 0x480a5c56, 0x480a5dda, 0x480a70da, 0x480a82ca,
+    0x480a965a, 0x480a97da, 0x480abeda, 0x480ad2da, 0x480b0fc9, 0x480b1179, 0x480b12fa, 0x480b1455,
+    0x480b24ca, 0x480b4bc5, 0x480b4fb9, 0x480b5139, 0x480b79b9, 0x480b8afa, 0x480b8bb9, 0x480b8db9,
+    0x480c6456, 0x480c65d5, 0x480c77d5, 0x480c7856, 0x480c79d5, 0x480c8cd1, 0x480c9ec9, 0x480cb3c5,
+    0x480d0656, 0x480d1856, 0x480d2d79, 0x480d2efa, 0x480d3055, 0x480d34fa, 0x480d40c9, 0x480d59b9,
+    0x480d5fb9, 0x480d6bb9, 0x480d6d39, 0x480d95b9, 0x480d9c39, 0x480da6fa, 0x480da7b9, 0x480da9b9,
+    0x480dae39, 0x480dd2d6, 0x480e0db9, 0x480e0f39, 0x480e2045, 0x480e2139, 0x480e49b9, 0x480e4bb9,
+    0x4810afda, 0x4810ea5a, 0x4811513a, 0x481163d5, 0x48116856, 0x48117ad6, 0x48118f52, 0x481190d2,
+    0x4811dfb9, 0x4812cbd5, 0x48138455, 0x481396d6, 0x48139cd6, 0x4813acd1, 0x4813bfb9, 0x4813c139,
+    0x4813e951, 0x4813edfa, 0x4813fbb9, 0x48143855, 0x481460d1, 0x48147445, 0x48147539, 0x481703d1,
+    0x4817559a, 0x4817571a, 0x4817579a, 0x48176689, 0x48176999, 0x48179199, 0x4817a599, 0x4817b945,
+    0x4817cf16, 0x4817d096, 0x4817d116, 0x4817e2a1, 0x4817e315, 0x4817e495, 0x48181fe1, 0x48182161,
+    0x48183391, 0x481884a5, 0x481898a5, 0x4818ad25, 0x48191fd1, 0x48197199, 0x48197319, 0x48197799,
+    0x48198599, 0x48198719, 0x48198b99, 0x4819ad99, 0x4819af99, 0x4819b419, 0x4819d545, 0x4819eb15,
+    0x4819ec95, 0x4819ed15, 0x4819f115, 0x4819fea1, 0x4819ff15, 0x481a0095, 0x481a0515, 0x481a1391,
+    0x481a1511, 0x481a3be1, 0x481a3d61, 0x481a41e1, 0x481a4f91, 0x481aa095, 0x481aa115, 0x481ac911,
+    0x481d9209, 0x481d9495, 0x481dd159, 0x481dd1d9, 0x481dd35a, 0x481e4a05, 0x481e4ad5, 0x481e4b55,
+    0x481e4cd5, 0x481e85c9, 0x481e8865, 0x481e89e5, 0x481e8a65, 0x481eb0e5, 0x481eb265, 0x481eb2e5,
+    0x481ec465, 0x481ec4e5, 0x481ec665, 0x481f3de5, 0x481fb095, 0x481fed59, 0x481fedd9, 0x481fef59,
+    0x481ff3d9, 0x48206605, 0x482066d5, 0x48206755, 0x48209265, 0x482096e5, 0x4820a465, 0x4820a5e5,
+    0x4820a665, 0x4820aa65, 0x4820aae5, 0x4820cce5, 0x4820ce65, 0x4820d2e5, 0x4820d4e5, 0x4820e065,
+    0x4820e0e5, 0x4820e265, 0x4820e6e5, 0x48214665, 0x482147f9, 0x482159e5, 0x48215a65, 0x48218265,
+    0x482182e5, 0x48218479, 0x4822ccdd, 0x4823e895, 0x4823e915, 0x4823fc95, 0x48248a91, 0x48248b11,
+    0x4824ed49, 0x4824f065, 0x4824f1e5, 0x48251865, 0x482518e5, 0x48251a65, 0x48252c65, 0x482591e5,
+    0x48259265, 0x4825a5e5, 0x4825ce65, 0x48260495, 0x48260515, 0x48260695, 0x48260b15, 0x4826a691,
+    0x4826a711, 0x4826f865, 0x4826f9e5, 0x4826fa65, 0x4826fe65, 0x4826fee5, 0x48270c65, 0x48270de5,
+    0x48271265, 0x48273465, 0x482734e5, 0x48273665, 0x48273ae5, 0x4827ade5, 0x4827ae65, 0x4827aff9,
+    0x4827b465, 0x482a6289, 0x482aa259, 0x482aa3d9, 0x482b1d55, 0x482b5649, 0x482b8161, 0x482b82e1,
+    0x482b8361, 0x482b9561, 0x482ba911, 0x482bfae1, 0x482bfc79, 0x482c0e61, 0x482c0ee1, 0x482c36e1,
+    0x482c4ae1, 0x482cbe59, 0x482cbfd9, 0x482cc459, 0x482d37d5, 0x482d3955, 0x482d9d61, 0x482d9f61,
+    0x482da3e1, 0x482da561, 0x482db161, 0x482e16e1, 0x482e1ce1, 0x482e30e1, 0x482e5361, 0x482e5961,
+    0x482ed559, 0x482ed5d9, 0x482ee759, 0x482f1059, 0x482f23d9, 0x482f7751, 0x4830b9d5, 0x4830cd55,
+    0x4830cdd5, 0x4830cf55, 0x4830e251, 0x4830e3d1, 0x4830f44a, 0x483107c9, 0x48310849, 0x48310945,
+    0x48313049, 0x483131c5, 0x48314449, 0x48315bd1, 0x48316dca, 0x48318149, 0x483181c9, 0x483182c5,
+    0x4831964a, 0x4831bd45, 0x4831c139, 0x4831c2b9, 0x4831c339, 0x4831e5c5, 0x4831e9b9, 0x4831eb39,
+    0x4831ebb9, 0x4831fd39, 0x4831fdb9, 0x4831ff39, 0x483239d5, 0x48326339, 0x483264ba, 0x4832653a,
+    0x483276b9, 0x48327739, 0x483278ba, 0x48329fb9, 0x4832b339, 0x4832d5d5, 0x4832e955, 0x4832e9d5,
+    0x4832eb5a, 0x4832fe51, 0x48331049, 0x48332545, 0x48332cd9, 0x48334dc5, 0x48334f59, 0x483377d1,
+    0x483389c9, 0x48339ec5, 0x4833b249, 0x4833cb39, 0x4833cfb9, 0x4833d139, 0x4833d1b9, 0x4833dd39,
+    0x4833deb9, 0x4833df39, 0x4833e339, 0x4833e539, 0x483405b9, 0x48340739, 0x483407b9, 0x48340c39,
+    0x48340db9, 0x48341939, 0x483419b9, 0x48341b39, 0x48341fb9, 0x48347f39, 0x48348539, 0x483485b9,
+    0x483492b9, 0x48349339, 0x483494ba, 0x48349939, 0x48354f59, 0x48376fc9, 0x48379b59, 0x48382939,
+    0x48382ab9, 0x48383d51, 0x483851b9, 0x48385339, 0x48386539, 0x48388dd5, 0x48388e55, 0x48388ff9,
+    0x4838a1d5, 0x4838b651, 0x4838b6d1, 0x4838cab9, 0x4838cb39, 0x4838deb9, 0x4838f2d1, 0x48390739,
+    0x48396651, 0x483994d9, 0x4839b759, 0x483a3139, 0x483a32b9, 0x483a3339, 0x483a3739, 0x483a37b9,
+    0x483a4539, 0x483a46b9, 0x483a4b39, 0x483a5951, 0x483a6db9, 0x483a6f39, 0x483a73b9, 0x483ab055,
+    0x483ae6b9, 0x483ae739, 0x483d8999, 0x483d9d99, 0x483e2b91, 0x483e9161, 0x483e92e1, 0x483eb961,
+    0x483ebb61, 0x483ecd61, 0x483fa595, 0x483fa795, 0x483fac19, 0x48404791, 0x48409961, 0x48409ae1,
+    0x48409b61, 0x48409f61, 0x48409fe1, 0x4840a161, 0x4840ad61, 0x4840aee1, 0x4840b361, 0x4840d561,
+    0x4840d761, 0x4840dbe1, 0x48414ee1, 0x48414f61, 0x484150f9, 0x48421fda, 0x4844405a, 0x484442d9,
+    0x4844bc55, 0x4844f939, 0x4844f9b9, 0x4844fb39, 0x484535b9, 0x48465ed9, 0x48468759, 0x4846d855,
+    0x484701b9, 0x484703b9, 0x48471539, 0x484715b9, 0x48471739, 0x48471bb9, 0x484a96da, 0x484a975a,
+    0x484aaad9, 0x484b1056, 0x484b10d6, 0x484b1256, 0x484b2455, 0x484b38d2, 0x484b3952, 0x484b6139,
+    0x484b7551, 0x484cb2d9, 0x484cb359, 0x484cb4d9, 0x484cb959, 0x484d2c55, 0x484d2cd5, 0x484d2e55,
+    0x484d32d5, 0x484d54d1, 0x484d5551, 0x484d6939, 0x4850a685, 0x4850bac5, 0x4850bc55, 0x4850bdd5,
+    0x4850c255, 0x4850cfe1, 0x4850d055, 0x4850d1d5, 0x4850e345, 0x4850f919, 0x48510d29, 0x48510ea9,
+    0x48511329, 0x485120d1, 0x48515e51, 0x48515fd1, 0x48516451, 0x48517295, 0x48518561, 0x48518695,
+    0x48518815, 0x48518c95, 0x48519b11, 0x4851c222, 0x4851c5aa, 0x4851cbaa, 0x4851d645, 0x4851ea85,
+    0x4851ec25, 0x4851eda1, 0x4851f221, 0x4851f421, 0x4851ffa1, 0x48520025, 0x485201a1, 0x48520621,
+    0x485213d1, 0x48526405, 0x485265a1, 0x48526721, 0x48526ba5, 0x48526c2a, 0x485279aa, 0x48527b2a,
+    0x4852a1a1, 0x4852a3a1, 0x4852a825, 0x4852de55, 0x4852ded5, 0x4852e055, 0x4852e4d5, 0x48538051,
+    0x4853d221, 0x4853d3a1, 0x4853d8aa, 0x4853da2a, 0x4853e7aa, 0x4853ec2a, 0x48540e21, 0x48541021,
+    0x485414a1, 0x485487a1, 0x4854882a, 0x485489aa, 0x48548e2a, 0x48572495, 0x48573745, 0x48573815,
+    0x48573895, 0x48573a15, 0x48573e95, 0x48574d11, 0x4857639a, 0x48577405, 0x48577599, 0x48577b99,
+    0x4857a419, 0x4857b199, 0x4857c691, 0x4857ed85, 0x4857ef15, 0x4857f095, 0x4857f515, 0x48582be5,
+    0x48582d65, 0x48585466, 0x485855e5, 0x48586705, 0x485867e5, 0x48586866, 0x485869e5, 0x48586e65,
+    0x4858a495, 0x4858cde5, 0x48593251, 0x48594ac9, 0x48598419, 0x48598599, 0x48598aaa, 0x48598c2a,
+    0x48599799, 0x48599e2a, 0x4859c019, 0x4859c699, 0x4859fd95, 0x4859ff15, 0x485a1115, 0x485a17aa,
+    0x485ab315, 0x485ab9a5, 0x485baca9, 0x485c2615, 0x485d77d1, 0x485d8b45, 0x485d8c15, 0x485d8ca6,
+    0x485d92a6, 0x485dc819, 0x485dc99a, 0x485dcb1a, 0x485dcf9a, 0x485dd01a, 0x485dddaa, 0x485ddf2a,
+    0x485de3aa, 0x485e0599, 0x485e0799, 0x485e4195, 0x485e4316, 0x485e4496, 0x485e4916, 0x485e5895,
+    0x485e5d2a, 0x485e6b92, 0x485e6d12, 0x485e6d92, 0x485e7192, 0x485e7212, 0x485ea791, 0x485ebbe5,
+    0x485ebc66, 0x485ec265, 0x485ef895, 0x485ef915, 0x485f2111, 0x485f21aa, 0x485f3565, 0x485feb99,
+    0x485fec2a, 0x485fedaa, 0x485ff22a, 0x48606515, 0x48606715, 0x48606baa, 0x48608d91, 0x4860a1e5,
+    0x4860a62a, 0x4863f515, 0x48640915, 0x48640a95, 0x48640f15, 0x48641d91, 0x48646e99, 0x48647099,
+    0x48648299, 0x48649711, 0x4864fc62, 0x48651091, 0x486524e1, 0x486538e1, 0x48653a61, 0x48653ee1,
+    0x48656795, 0x48657b95, 0x48659011, 0x48659e61, 0x48669119, 0x48670c61, 0x48672069, 0x48678a15,
+    0x486a7005, 0x486aae59, 0x486aafd9, 0x486ad6d9, 0x486ad859, 0x486aea59, 0x486aead9, 0x486aec59,
+    0x486af0d9, 0x486b27d5, 0x486b2955, 0x486b6b69, 0x486b93e9, 0x486ba169, 0x486ba2e9, 0x486ba769,
+    0x486ba7e9, 0x486c08e9, 0x486c1ae9, 0x486c20e9, 0x486c4369, 0x486c44e9, 0x486c4969, 0x486c56e9,
+    0x486c5769, 0x486c58e9, 0x486c5d69, 0x486c8015, 0x486c8195, 0x486c9395, 0x486cba89, 0x486cf805,
+    0x486d6051, 0x486d7569, 0x486d7bea, 0x486d8769, 0x486d88e9, 0x486dafe9, 0x486db169, 0x486db669,
+    0x486db7e9, 0x486dc369, 0x486dc3e9, 0x486dc569, 0x486dc9e9, 0x486deb05, 0x486df009, 0x486e2969,
+    0x486e2ae9, 0x486e2fea, 0x486e316a, 0x486e3ce9, 0x486e436a, 0x486e6569, 0x486e6be9, 0x486ea895,
+    0x486fd85d, 0x4870b092, 0x4870c405, 0x48710259, 0x487103d9, 0x48711669, 0x487117e9, 0x48711c69,
+    0x48712a91, 0x48713e59, 0x48713ed9, 0x48714059, 0x487144d9, 0x48717bd5, 0x48717d55, 0x48718fd5,
+    0x48719155, 0x487195d5, 0x4871f3c5, 0x4871f569, 0x4871f6e9, 0x4871f769, 0x4871fb69, 0x4871fbe9,
+    0x48720969, 0x48720ae9, 0x48720f69, 0x48726d45, 0x48726ee9, 0x48727069, 0x487274e9, 0x4872756a,
+    0x487288ea, 0x4872aae9, 0x4872ab69, 0x4872ace9, 0x4872b169, 0x4872e795, 0x4872e815, 0x4872e995,
+    0x48739dd5, 0x48739fd5, 0x4873c652, 0x4873db69, 0x4873dce9, 0x4873e36a, 0x48741769, 0x487417e9,
+    0x48741969, 0x48741de9, 0x487490e9, 0x4874916a, 0x487492ea, 0x4874976a, 0x487718d1, 0x48772c45,
+    0x48776a9a, 0x48776c1a, 0x48776c9a, 0x4877709a, 0x48777eaa, 0x4877802a, 0x4877a699, 0x4877a899,
+    0x4877ad19, 0x4877ce51, 0x4877e416, 0x4877e596, 0x4877ea16, 0x4877f995, 0x4877fe2a, 0x48780c92,
+    0x48784891, 0x48785c05, 0x48789995, 0x4878c211, 0x48798c99, 0x48798d2a, 0x48798eaa, 0x4879932a,
+    0x487a0615, 0x487a0815, 0x487a0caa, 0x487a2e91, 0x487d9485, 0x487da995, 0x487dd2d9, 0x487dd39a,
+    0x487de659, 0x487de6e9, 0x487de869, 0x487decda, 0x487e0ed9, 0x487e4c56, 0x487e5f05, 0x487e5fd5,
+    0x487e6056, 0x487e61d5, 0x487e6655, 0x487e9bc5, 0x487e9d69, 0x487e9ee9, 0x487ea369, 0x487ec446,
+    0x487ec769, 0x487ecbe9, 0x487ecde9, 0x487ed969, 0x487edb69, 0x487edfe9, 0x487f3dc5, 0x487f3f69,
+    0x487f40e9, 0x487f416a, 0x487f52e9, 0x487f536a, 0x487f7b69, 0x487f7d69, 0x487fb815, 0x487fbe99,
+    0x487ff405, 0x48807289, 0x4880abe9, 0x4880ad69, 0x4880b26a, 0x4880b3ea, 0x4880bf69, 0x4880c5ea,
+    0x4880e7e9, 0x4880e9e9, 0x4880ee69, 0x48816169, 0x4883fda9, 0x488426aa, 0x48843a6a, 0x48843aea,
+    0x488440da, 0x4884b316, 0x4884b3ea, 0x4884b456, 0x4884ba6a, 0x4885056a, 0x488506ea, 0x48852d69,
+    0x48852f69, 0x488533e9, 0x4885a6e9, 0x4885a76a, 0x4885a8ea, 0x48871369, 0x4887156a, 0x488719ea,
+    0x488a6695, 0x488a7a95, 0x488a7c15, 0x488a8095, 0x488a8f11, 0x488b313a, 0x488b32a1, 0x488b3316,
+    0x488b373a, 0x488b3796, 0x488b3916, 0x488b4792, 0x488b6de2, 0x488b8391, 0x488b883a, 0x488b9666,
+    0x488ba93a, 0x488baa66, 0x488babe1, 0x488bb079, 0x488bbd45, 0x488bd315, 0x488bd495, 0x488bd516,
+    0x488be6a1, 0x488be716, 0x488be896, 0x488bed16, 0x488bfb91, 0x488bfd11, 0x488c01a5, 0x488c0fe1,
+    0x488c3791, 0x488d533a, 0x488d5396, 0x488d5516, 0x488d5996, 0x488d6991, 0x488da43a, 0x488df596,
+    0x488df716, 0x488e1d91, 0x4890e185, 0x4890e915, 0x48911fd9, 0x48912159, 0x48914866, 0x489149d9,
+    0x48915bd9, 0x48915c66, 0x48915dd9, 0x48916259, 0x48919979, 0x48919ad5, 0x4891d865, 0x489200e5,
+    0x48921465, 0x489214e5, 0x489218fa, 0x48928c65, 0x48928de5, 0x48929265, 0x4892b4e5, 0x4892b665,
+    0x4892c865, 0x4892c8e5, 0x4892ca65, 0x489422e5, 0x489436e5, 0x48943b7a, 0x4894ae65, 0x4894d6e5,
+    0x48951a15, 0x489649f9, 0x48973595, 0x48973d1a, 0x48974b16, 0x48975116, 0x48977559, 0x48979b91,
+    0x4897afd9, 0x4897b066, 0x4897b659, 0x4897d93a, 0x4897df3a, 0x4897eed5, 0x48986579, 0x48986865,
+    0x489868e5, 0x48986cfa, 0x48986ee5, 0x48987afa, 0x48987c65, 0x489880fa, 0x48988e91, 0x4898dec5,
+    0x4898e065, 0x4898e1e5, 0x4898e665, 0x48991c65, 0x48991ce5, 0x48991e65, 0x489922e5, 0x489a4cfa,
+    0x489a4e65, 0x489a88fa, 0x489a897a, 0x489a8ae5, 0x489a8f7a, 0x489b0265, 0x489df062, 0x489e18d9,
+    0x489e2cd9, 0x489e2e59, 0x489e32d9, 0x489e69e2, 0x489ed161, 0x489ed5fa, 0x489ee561, 0x489ee9fa,
+    0x489efd91, 0x489f62e1, 0x489f8561, 0x489f8761, 0x489f8b61, 0x489f9961, 0x489f9f61, 0x48a0a251,
+    0x48a1a7e1, 0x48a1ade1, 0x48a229d9, 0x48a23bd9, 0x48a264d9, 0x48a27859, 0x48a409d5, 0x48a41bd5,
+    0x48a41d55, 0x48a41dd5, 0x48a421d5, 0x48a42255, 0x48a43851, 0x48a493c5, 0x48a51139, 0x48a51739,
+    0x48a539b9, 0x48a53fb9, 0x48a54039, 0x48a54bb9, 0x48a54d39, 0x48a54db9, 0x48a551b9, 0x48a55239,
+    0x48a553b9, 0x48a58e55, 0x48a5b339, 0x48a5b7b9, 0x48a5b939, 0x48a5c539, 0x48a5c6b9, 0x48a5cb39,
+    0x48a5edb9, 0x48a5ef39, 0x48a5efb9, 0x48a5f439, 0x48a5f5b9, 0x48a60139, 0x48a601b9, 0x48a60339,
+    0x48a607b9, 0x48a6abd9, 0x48a71fb9, 0x48a725b9, 0x48a73339, 0x48a75bb9, 0x48a75c39, 0x48a76fb9,
+    0x48a79ed6, 0x48a7d3b9, 0x48a7d539, 0x48a7e739, 0x48a81039, 0x48a811b9, 0x48a813c9, 0x48a8cc59,
+    0x48aa6fd5, 0x48aa7155, 0x48aa83d5, 0x48aa8555, 0x48aa89d5, 0x48aa99d2, 0x48aae7c5, 0x48aafd59,
+    0x48ab8b7a, 0x48ab8d51, 0x48ab9fb9, 0x48aba139, 0x48aba1b9, 0x48abb3b9, 0x48abb539, 0x48abb9b9,
+    0x48abe255, 0x48abf656, 0x48ac0ad1, 0x48ac1939, 0x48ac1ab9, 0x48ac4151, 0x48ac5539, 0x48ac55b9,
+    0x48ac5739, 0x48ac5bb9, 0x48ad0bd9, 0x48ad33d2, 0x48ad8739, 0x48adadfa, 0x48adc1b9, 0x48adc3b9,
+    0x48adc839, 0x48b0eba1, 0x48b0ec16, 0x48b1009a, 0x48b13c91, 0x48b17b91, 0x48b1803a, 0x48b1a13a,
+    0x48b1df7a, 0x48b20961, 0x48b20dfa, 0x48b20fe1, 0x48b21b7a, 0x48b21d61, 0x48b221fa, 0x48b22f91,
+    0x48b28161, 0x48b282e1, 0x48b294e1, 0x48b2bd61, 0x48b2bf61, 0x48b39c3a, 0x48b3edfa, 0x48b3ef61,
+    0x48b4017a, 0x48b429fa, 0x48b42be1, 0x48b4307a, 0x48b4a361, 0x48b74056, 0x48b75305, 0x48b753d5,
+    0x48b75456, 0x48b755d5, 0x48b75a5a, 0x48b768d1, 0x48b78fc5, 0x48b79159, 0x48b79759, 0x48b7cd59,
+    0x48b80979, 0x48b80c55, 0x48b810fa, 0x48b847b9, 0x48b84939, 0x48b871b9, 0x48b87839, 0x48b883b9,
+    0x48b885b9, 0x48b88a39, 0x48b8c055, 0x48b8c256, 0x48b8e9b9, 0x48b8eb39, 0x48b8fd39, 0x48b925b9,
+    0x48b9b359, 0x48ba3356, 0x48ba9439, 0x48bd9391, 0x48bda71a, 0x48bda7d5, 0x48bda856, 0x48bdae5a,
+    0x48be2159, 0x48be2359, 0x48be27d9, 0x48be493a, 0x48be5ed6, 0x48be6056, 0x48be64d6, 0x48be7456,
+    0x48be78d6, 0x48be8752, 0x48be88d2, 0x48bec37a, 0x48bed6fa, 0x48bed7b9, 0x48bede39, 0x48bf1455,
+    0x48bf14d6, 0x48bf1656, 0x48bf3cd1, 0x48bf5139, 0x48c00759, 0x48c080fa, 0x48c082d6, 0x48c08756,
+    0x48c0a97a, 0x48c0bdb9, 0x48c3fbd1, 0x48c40f45, 0x48c44d9a, 0x48c44f1a, 0x48c4539a, 0x48c46199,
+    0x48c46319, 0x48c48999, 0x48c48b99, 0x48c49019, 0x48c4b151, 0x48c4c716, 0x48c4c896, 0x48c4cd16,
+    0x48c4dc95, 0x48c4e115, 0x48c4ef92, 0x48c517e1, 0x48c51961, 0x48c51de1, 0x48c52b91, 0x48c53f05,
+    0x48c57c95, 0x48c5a511, 0x48c66f99, 0x48c67019, 0x48c67199, 0x48c67619, 0x48c6e915, 0x48c6eb15,
+    0x48c6ef95, 0x48c71191, 0x48ca7f15, 0x48ca8c95, 0x48cac959, 0x48cac9d9, 0x48cacb59, 0x48cacfd9,
+    0x48cb4205, 0x48cb8065, 0x48cb81e5, 0x48cb8265, 0x48cb8665, 0x48cb86e5, 0x48cba8e5, 0x48cbaa65,
+    0x48cbaee5, 0x48cbb0e5, 0x48cbbc65, 0x48cbbce5, 0x48cbbe65, 0x48cbc2e5, 0x48cc2265, 0x48cc23f9,
+    0x48cc2865, 0x48cc35e5, 0x48cc3665, 0x48cc5e65, 0x48cc6079, 0x48cc9b15, 0x48cca195, 0x48cd8ee5,
+    0x48cd9065, 0x48cd9565, 0x48cd96e5, 0x48cda265, 0x48cda2e5, 0x48cda465, 0x48cda8e5, 0x48cdcae5,
+    0x48cdcce5, 0x48cdd165, 0x48ce4465, 0x48ce4ae5, 0x48cfb766, 0x48d0e0a5, 0x48d11de6, 0x48d123e6,
+    0x48d19616, 0x48d1e865, 0x48d1e9e5, 0x48d1ee65, 0x48d21065, 0x48d21265, 0x48d216e5, 0x48d289e5,
+    0x48d28a65, 0x48d3f665, 0x48d3f6e5, 0x48d3f865, 0x48d3fce5, 0x48d75d21, 0x48d79a59, 0x48d79bd9,
+    0x48d7a059, 0x48d812a1, 0x48d850e1, 0x48d86385, 0x48d87961, 0x48d87b61, 0x48d87fe1, 0x48d88161,
+    0x48d88ce1, 0x48d88d61, 0x48d8f2e1, 0x48d8f8e1, 0x48d8f961, 0x48d90661, 0x48d90ce1, 0x48d92f61,
+    0x48d93561, 0x48da6761, 0x48da72e1, 0x48da9be1, 0x48db14e1, 0x48db1561, 0x48db1b61, 0x48ddb1d5,
+    0x48ddc485, 0x48ddc555, 0x48ddc5d5, 0x48ddda51, 0x48ddf0da, 0x48de0145, 0x48de02d9, 0x48de08d9,
+    0x48de29c5, 0x48de2b59, 0x48de3159, 0x48de3ed9, 0x48de53d1, 0x48de7ac5, 0x48de7c55, 0x48de7dd5,
+    0x48de8255, 0x48deb939, 0x48debab9, 0x48debb39, 0x48dec139, 0x48dee1b9, 0x48dee339, 0x48dee3b9,
+    0x48dee839, 0x48dee9b9, 0x48def445, 0x48def539, 0x48def5b9, 0x48def739, 0x48defbb9, 0x48df2455,
+    0x48df31d5, 0x48df3855, 0x48df5b39, 0x48df61b9, 0x48df6eb9, 0x48df6f39, 0x48df70ba, 0x48df7539,
+    0x48dfd305, 0x48e01159, 0x48e012d9, 0x48e017d9, 0x48e024d9, 0x48e02559, 0x48e026d9, 0x48e04d59,
+    0x48e053d9, 0x48e09e55, 0x48e0c7b9, 0x48e0c939, 0x48e0cbc9, 0x48e0cfb9, 0x48e0dbb9, 0x48e0dd39,
+    0x48e14055, 0x48e146d5, 0x48e17c45, 0x48e17d39, 0x48e17db9, 0x48e183b9, 0x48e239d9, 0x48e40511,
+    0x48e41885, 0x48e441d2, 0x48e456da, 0x48e46ad9, 0x48e46c59, 0x48e470d9, 0x48e492d9, 0x48e49359,
+    0x48e494d9, 0x48e49959, 0x48e4ba91, 0x48e4d056, 0x48e4d1d6, 0x48e4d256, 0x48e4d656, 0x48e4d6d6,
+    0x48e4e455, 0x48e4e5d5, 0x48e4ea55, 0x48e4f8d2, 0x48e4fa52, 0x48e4fed2, 0x48e52139, 0x48e522b9,
+    0x48e52739, 0x48e534d1, 0x48e53551, 0x48e54845, 0x48e549b9, 0x48e54fb9, 0x48e585d5, 0x48e58655,
+    0x48e58c55, 0x48e5ae51, 0x48e5c339, 0x48e5c939, 0x48e678d9, 0x48e67959, 0x48e67ad9, 0x48e67f59,
+    0x48e6f255, 0x48e6f2d5, 0x48e6f455, 0x48e6f8d5, 0x48e71ad1, 0x48e72f39, 0x48e72fb9, 0x48e73139,
+    0x48e73349, 0x48ea81a1, 0x48eb3716, 0x48eb8961, 0x48eb8ae1, 0x48eb8f61, 0x48ebb161, 0x48ebb361,
+    0x48ebb7e1, 0x48ec2ae1, 0x48ed9761, 0x48ed97e1, 0x48ed9961, 0x48ed9de1, 0x48f0d591, 0x48f0e905,
+    0x48f1275a, 0x48f128da, 0x48f1295a, 0x48f12d5a, 0x48f13ad9, 0x48f13b59, 0x48f13cd9, 0x48f16359,
+    0x48f16559, 0x48f169d9, 0x48f18b05, 0x48f1a0d6, 0x48f1a256, 0x48f1a2d6, 0x48f1a6d6, 0x48f1a756,
+    0x48f1b455, 0x48f1b655, 0x48f1bad5, 0x48f1c952, 0x48f1f139, 0x48f1f1b9, 0x48f1f339, 0x48f1f7b9,
+    0x48f20551, 0x48f25655, 0x48f256d5, 0x48f27ed1, 0x48f34959, 0x48f349d9, 0x48f34fd9, 0x48f3c2d5,
+    0x48f3c4d5, 0x48f3c955, 0x48f3eb51, 0x48f403c9, 0x4db8a289, 0x4db8a585, 0x4db8c9a1, 0x4db8cd61,
+    0x4db8cee1, 0x4db8cf55, 0x4db91a85, 0x4db91e59, 0x4db91fd1, 0x4db943e1, 0x4db94561, 0x4db9d249,
+    0x4db9d545, 0x4db9fd2a, 0x4db9fea1, 0x4db9ff21, 0x4dba1165, 0x4dba12e5, 0x4dba78aa, 0x4dba87e5,
+    0x4dbaa0a5, 0x4dbac185, 0x4dbac611, 0x4dbadbd5, 0x4dbae961, 0x4dbaeae1, 0x4dbaeb55, 0x4dbb3a51,
+    0x4dbb3bd1, 0x4dbb53c5, 0x4dbb7951, 0x4dbb7dea, 0x4dbbf145, 0x4dbbf5ea, 0x4dbc0721, 0x4dbc192a,
+    0x4dbc1aa1, 0x4dbc1b21, 0x4dbc1f2a, 0x4dbc2d51, 0x4dbc2ed1, 0x4dbc46e5, 0x4dbc8525, 0x4dbc92a1,
+    0x4dbc9421, 0x4dbc94aa, 0x4dbcbb21, 0x4dbcbca1, 0x4dbcc125, 0x4dbd4f99, 0x4dbd7826, 0x4dbd7999,
+    0x4dbd7a26, 0x4dbd8c1a, 0x4dbdca95, 0x4dbe038a, 0x4dbe3f89, 0x4dbe6b26, 0x4dbe7f26, 0x4dbe93a6,
+    0x4dbf3349, 0x4dbf3599, 0x4dbf3645, 0x4dbf3715, 0x4dbfab45, 0x4dbfaf2a, 0x4dbfb099, 0x4dbfb119,
+    0x4dc06605, 0x4dc066e5, 0x4dc06765, 0x4dc079a6, 0x4dc09e65, 0x4dc0a225, 0x4dc0a3a5, 0x4dc0a425,
+    0x4dc0dee6, 0x4dc0e066, 0x4dc108e6, 0x4dc10966, 0x4dc118a5, 0x4dc11a25, 0x4dc11ae6, 0x4dc11b66,
+    0x4dc11ce6, 0x4dc13f95, 0x4dc14615, 0x4dc15195, 0x4dc15245, 0x4dc15315, 0x4dc16811, 0x4dc1a345,
+    0x4dc1cb19, 0x4dc1cc99, 0x4dc1e191, 0x4dc246e5, 0x4dc26f65, 0x4dc27565, 0x4dc275e5, 0x4dc28169,
+    0x4dc28205, 0x4dc282e5, 0x4dc28365, 0x4dc28965, 0x4dc29645, 0x4dc2ae26, 0x4dc2be15, 0x4dc2bf95,
+    0x4dc2e8e5, 0x4dc2ef66, 0x4dc2fae5, 0x4dc2fb85, 0x4dc300e6, 0x4dc31091, 0x4dc32365, 0x4dc32405,
+    0x4dc324e5, 0x4dc32565, 0x4dc329e6, 0x4dc41e95, 0x4dc49389, 0x4dc57191, 0x4dc57551, 0x4dc576d1,
+    0x4dc58749, 0x4dc58a45, 0x4dc58b15, 0x4dc58b95, 0x4dc59b49, 0x4dc59d95, 0x4dc59f15, 0x4dc5d829,
+    0x4dc5dcaa, 0x4dc5ebd1, 0x4dc5ed51, 0x4dc5ff45, 0x4dc60319, 0x4dc60499, 0x4dc61719, 0x4dc61899,
+    0x4dc65189, 0x4dc692e9, 0x4dc6a52a, 0x4dc6a691, 0x4dc6b585, 0x4dc6b969, 0x4dc6bae5, 0x4dc6bb65,
+    0x4dc6cd69, 0x4dc6cee5, 0x4dc6f265, 0x4dc6f625, 0x4dc6f7a5, 0x4dc70a25, 0x4dc70ba5, 0x4dc72f26,
+    0x4dc732e6, 0x4dc73466, 0x4dc734e6, 0x4dc746e6, 0x4dc74866, 0x4dc76ca5, 0x4dc76e25, 0x4dc76ee6,
+    0x4dc782e6, 0x4dc79151, 0x4dc792d1, 0x4dc7a595, 0x4dc7a645, 0x4dc7a715, 0x4dc7aac5, 0x4dc7b995,
+    0x4dc7bb15, 0x4dc7e919, 0x4dc7f8aa, 0x4dc81f19, 0x4dc82099, 0x4dc82519, 0x4dc83319, 0x4dc83499,
+    0x4dc85e15, 0x4dc87215, 0x4dc89ae5, 0x4dc8a0e5, 0x4dc8a169, 0x4dc8b4e9, 0x4dc8c12a, 0x4dc8c291,
+    0x4dc8c72a, 0x4dc8d569, 0x4dc8d605, 0x4dc8d6e5, 0x4dc8d765, 0x4dc8db69, 0x4dc8e969, 0x4dc8eae5,
+    0x4dc8ef69, 0x4dc91215, 0x4dc91395, 0x4dc91825, 0x4dc92615, 0x4dc92795, 0x4dc93a91, 0x4dc93c11,
+    0x4dc94ee5, 0x4dc94f85, 0x4dc95065, 0x4dc962e9, 0x4dc96469, 0x4dc98a05, 0x4dc98ae5, 0x4dca9b22,
+    0x4dcc0622, 0x4dcc07a2, 0x4dcd47c9, 0x4dcd4ac5, 0x4dcd6ee1, 0x4dcd72a1, 0x4dcd7421, 0x4dcd74aa,
+    0x4dcdaf62, 0x4dcdb0e2, 0x4dcdbfc5, 0x4dcdc391, 0x4dcdc511, 0x4dcdd7e1, 0x4dcdd961, 0x4dcde921,
+    0x4dcdeaa1, 0x4dcdeb62, 0x4dce1015, 0x4dce2222, 0x4dce2761, 0x4dce3891, 0x4dceb211, 0x4dced922,
+    0x4dcf1762, 0x4dcf3fe1, 0x4dcf45e1, 0x4dcf5362, 0x4dcf53e1, 0x4dcf572a, 0x4dcf6b51, 0x4dcf8115,
+    0x4dcfb961, 0x4dcfbde1, 0x4dcfd0a1, 0x4dcfd162, 0x4dcff905, 0x4dd17ce9, 0x4dd17d69, 0x4dd1f4e9,
+    0x4dd21d69, 0x4dd21ee9, 0x4dd230de, 0x4dd2315e, 0x4dd2e969, 0x4dd3d8aa, 0x4dd3dae9, 0x4dd3dbaa,
+    0x4dd450aa, 0x4dd4546a, 0x4dd455ea, 0x4dd4566a, 0x4dd4912a, 0x4dd4c969, 0x4dd4f1e9, 0x4dd4f869,
+    0x4dd503da, 0x4dd5055a, 0x4dd505da, 0x4dd5092a, 0x4dd542e9, 0x4dd5fc2a, 0x4dd63a6a, 0x4dd65e6a,
+    0x4dd66069, 0x4dd7d0dd, 0x4dd7d15d, 0x4dd848dd, 0x4dd85ce9, 0x4dd884dd, 0x4dd898de, 0x4dd8d409,
+    0x4dd91569, 0x4dd93bd9, 0x4dd93d59, 0x4dd93dd9, 0x4dd94fd9, 0x4dd95159, 0x4dd98ed5, 0x4dd9efca,
+    0x4dda03c9, 0x4dda16d1, 0x4dda1a91, 0x4dda1c11, 0x4dda2c89, 0x4dda2f85, 0x4dda4089, 0x4dda694a,
+    0x4dda9111, 0x4dda9291, 0x4ddaa485, 0x4ddaa869, 0x4ddaa9e9, 0x4ddab949, 0x4ddabc69, 0x4ddabde9,
+    0x4ddacf51, 0x4ddae515, 0x4ddaf92a, 0x4ddb1d59, 0x4ddb3169, 0x4ddb57d9, 0x4ddb5959, 0x4ddb59d9,
+    0x4ddb5d05, 0x4ddb6bda, 0x4ddb6d5a, 0x4ddb96d5, 0x4ddbaad5, 0x4ddbd5ca, 0x4ddc0ec5, 0x4ddc28ea,
+    0x4ddc5005, 0x4ddc7891, 0x4ddc8845, 0x4ddc8e69, 0x4ddca26a, 0x4ddcca69, 0x4ddf1659, 0x4ddf17d9,
+    0x4ddf7daa, 0x4ddf8cd9, 0x4ddfa599, 0x4ddfb999, 0x4ddfca49, 0x4ddfcd45, 0x4ddff161, 0x4ddff52a,
+    0x4ddff6a1, 0x4ddff715, 0x4de03362, 0x4de04245, 0x4de0462a, 0x4de04791, 0x4de06ba1, 0x4de06d2a,
+    0x4de13251, 0x4de133d1, 0x4de14bd9, 0x4de15961, 0x4de18a19, 0x4de199aa, 0x4de1aa51, 0x4de1c035,
+    0x4de1c199, 0x4de1c619, 0x4de1e945, 0x4de1edea, 0x4de1ff15, 0x4de203aa, 0x4de2112a, 0x4de212a1,
+    0x4de21315, 0x4de2172a, 0x4de253e2, 0x4de26391, 0x4de27baa, 0x4de2892a, 0x4de29d51, 0x4de2b315,
+    0x4de2b495, 0x4de2db91, 0x4de302a1, 0x4de32b05, 0x4de57e9a, 0x4de5a359, 0x4de5a49a, 0x4de5a719,
+    0x4de5a899, 0x4de5a919, 0x4de5e3da, 0x4de5e55a, 0x4de5e5da, 0x4de60c5a, 0x4de60dda, 0x4de60e5a,
+    0x4de61d99, 0x4de61f19, 0x4de61fda, 0x4de6205a, 0x4de621da, 0x4de65b09, 0x4de65d69, 0x4de65e05,
+    0x4de65f55, 0x4de697ca, 0x4de6d305, 0x4de6d3c9, 0x4de6d6ea, 0x4de6d869, 0x4de6d8f5, 0x4de7c315,
+    0x4de7c495, 0x4de7ffd9, 0x4de80159, 0x4de801e9, 0x4de805da, 0x4de81591, 0x4de829d9, 0x4de82a76,
+    0x4de82eda, 0x4de83b19, 0x4de83bda, 0x4de83c5a, 0x4de83dda, 0x4de87969, 0x4de87b55, 0x4de8e0f5,
+    0x4de8f2ea, 0x4de8f469, 0x4de8f4f5, 0x4de90891, 0x4de92e15, 0x4de96c69, 0x4de96de9, 0x4de994f5,
+    0x4de99669, 0x4debf759, 0x4debfb1a, 0x4debfc99, 0x4dec0f19, 0x4dec1099, 0x4dec4d5a, 0x4dec7199,
+    0x4dec7319, 0x4dec73da, 0x4dec87da, 0x4dec9951, 0x4dec9d2a, 0x4dec9e91, 0x4decaf16, 0x4decb216,
+    0x4decc32a, 0x4decda92, 0x4ded046a, 0x4ded1391, 0x4ded152a, 0x4ded2705, 0x4ded27c9, 0x4ded2aea,
+    0x4ded2c69, 0x4ded3bc9, 0x4ded3eea, 0x4ded4069, 0x4dee0151, 0x4dee1715, 0x4dee1895, 0x4dee1d19,
+    0x4dee2b2a, 0x4dee2c95, 0x4dee8f05, 0x4dee8fd9, 0x4deeb92a, 0x4deeba91, 0x4deebf2a, 0x4deed2aa,
+    0x4def0c69, 0x4def0dc9, 0x4def10ea, 0x4def206a, 0x4def312a, 0x4def46ea, 0x4def4869, 0x4def4cea,
+    0x4def5aea, 0x4def5c69, 0x4def8205, 0x4defaa91, 0x4defc069, 0x4defc1e9, 0x4defd46a, 0x4defd5ea,
+    0x4deffc69, 0x4deffe69, 0x4df2f11a, 0x4df3a50a, 0x4df420e2, 0x4df42262, 0x4df44966, 0x4df45ce2,
+    0x4df46d51, 0x4df46e05, 0x4df471da, 0x4df47351, 0x4df49761, 0x4df4e551, 0x4df4e851, 0x4df4fb19,
+    0x4df50119, 0x4df525ca, 0x4df528c5, 0x4df54c21, 0x4df55221, 0x4df55296, 0x4df59d11, 0x4df59dca,
+    0x4df5a311, 0x4df5b161, 0x4df5c421, 0x4df5d851, 0x4df5db65, 0x4df5ee15, 0x4df5f425, 0x4df61691,
+    0x4df63da1, 0x4df642e2, 0x4df66605, 0x4df66925, 0x4df7ee65, 0x4df7eee5, 0x4df86666, 0x4df88ee6,
+    0x4df89066, 0x4df8a25e, 0x4df8a2de, 0x4df95ae5, 0x4dfa4c66, 0x4dfac5e6, 0x4dfb0426, 0x4dfb3ae5,
+    0x4dfb4f26, 0x4dfb6365, 0x4dfb69e6, 0x4dfb755a, 0x4dfb76da, 0x4dfb775a, 0x4dfb7926, 0x4dfbb465,
+    0x4dfc2de6, 0x4dfc33e6, 0x4dfc4226, 0x4dfc6c26, 0x4dfca766, 0x4dfcd1e6, 0x4dfe425d, 0x4dfe565d,
+    0x4dfeba66, 0x4dfebbe6, 0x4dfef666, 0x4dff0a5e, 0x4dff4595, 0x4dff4a16, 0x4dff991a, 0x4dff9a91,
+    0x4dffad59, 0x4dffaed9, 0x4dffaf66, 0x4dffc159, 0x4dffc2d9, 0x4e000055, 0x4e004d0a, 0x4e00614a,
+    0x4e007549, 0x4e0079e5, 0x4e00a066, 0x4e00b466, 0x4e00daca, 0x4e011b65, 0x4e012ae6, 0x4e012f65,
+    0x4e013f51, 0x4e015215, 0x4e015815, 0x4e016616, 0x4e018ed9, 0x4e01b51a, 0x4e01c959, 0x4e01ca05,
+    0x4e01cad9, 0x4e01cb59, 0x4e01cd09, 0x4e01dd5a, 0x4e01deda, 0x4e01f411, 0x4e01fa11, 0x4e020855,
+    0x4e026c11, 0x4e028045, 0x4e0281e5, 0x4e0287e5, 0x4e0295e5, 0x4e029be5, 0x4e02bd05, 0x4e02c025,
+    0x4e02e591, 0x4e02f9c5, 0x4e02fb65, 0x4e030165, 0x4e0335e5, 0x4e033765, 0x4e0337e5, 0x4e033be5,
+    0x4e0536e2, 0x4e071aa2, 0x4e071ce2, 0x4e071da2, 0x4e076ba2, 0x4e076ea2, 0x4e079662, 0x4e079862,
+    0x4e07cf62, 0x4e07d31a, 0x4e080b62, 0x4e0833e1, 0x4e0884e2, 0x4e088a22, 0x4e091362, 0x4e091722,
+    0x4e0918a2, 0x4e093ca2, 0x4e0977e2, 0x4e0978a2, 0x4e097c62, 0x4e098da2, 0x4e09a062, 0x4e09a4e2,
+    0x4e09a662, 0x4e11b655, 0x4e11ca55, 0x4e11f0ca, 0x4e1282d5, 0x4e12f7c9, 0x4e13b2b5, 0x4e13c4d2,
+    0x4e13ef56, 0x4e143e51, 0x4e143fd1, 0x4e1452b5, 0x4e145435, 0x4e1454b5, 0x4e146449, 0x4e1466b5,
+    0x4e146835, 0x4e147751, 0x4e147b1a, 0x4e148ad5, 0x4e148d09, 0x4e149005, 0x4e14a116, 0x4e14b352,
+    0x4e14f31a, 0x4e150505, 0x4e1508da, 0x4e150a59, 0x4e150ad9, 0x4e151cda, 0x4e152cd2, 0x4e152f0a,
+    0x4e155bd6, 0x4e15a70a, 0x4e15ac51, 0x4e15bab5, 0x4e15c0b5, 0x4e15c135, 0x4e15ceb5, 0x4e15d0ca,
+    0x4e15d4b5, 0x4e15e491, 0x4e15f805, 0x4e15fbd5, 0x4e15fd55, 0x4e15fdd6, 0x4e160fd6, 0x4e162091,
+    0x4e162451, 0x4e163435, 0x4e163649, 0x4e1638b5, 0x4e163945, 0x4e166eb5, 0x4e167035, 0x4e1670b5,
+    0x4e167249, 0x4e1673c5, 0x4e1674b5, 0x4e167535, 0x4e19275a, 0x4e194e5a, 0x4e199d0a, 0x4e1a1a61,
+    0x4e1a1af5, 0x4e1add45, 0x4e1ae059, 0x4e1ae1da, 0x4e1af315, 0x4e1af919, 0x4e1b051a, 0x4e1b06a1,
+    0x4e1b47da, 0x4e1b5791, 0x4e1b6b05, 0x4e1b6e19, 0x4e1b9511, 0x4e1b95ca, 0x4e1b9b11, 0x4e1bbf0a,
+    0x4e1bfa61, 0x4e1c0061, 0x4e1c0d05, 0x4e1c100a, 0x4e1c22f5, 0x4e1c28e1, 0x4e1c3661, 0x4e1c3ce1,
+    0x4e1c4a91, 0x4e1c5e05, 0x4e1c9c61, 0x4e1cae61, 0x4e1cafe1, 0x4e1cd861, 0x4e1f515a, 0x4e1f52da,
+    0x4e1f8bca, 0x4e1fc85a, 0x4e1fcada, 0x4e20054a, 0x4e2082b5, 0x4e208336, 0x4e215b55, 0x4e2161da,
+    0x4e216d59, 0x4e216ed5, 0x4e217119, 0x4e2183d1, 0x4e21aac5, 0x4e21d6da, 0x4e21e859, 0x4e21fd51,
+    0x4e222445, 0x4e2225d5, 0x4e222bd5, 0x4e2262b5, 0x4e2268b5, 0x4e228b36, 0x4e229135, 0x4e2291b6,
+    0x4e229dc5, 0x4e229eb5, 0x4e229f36, 0x4e22a0ca, 0x4e22a535, 0x4e22db55, 0x4e2304b5, 0x4e2316b5,
+    0x4e231745, 0x4e231835, 0x4e233f36, 0x4e2340b5, 0x4e234136, 0x4e262059, 0x4e263459, 0x4e26450a,
+    0x4e2671d6, 0x4e26c251, 0x4e26d6b5, 0x4e26d736, 0x4e26e6ca, 0x4e26eab5, 0x4e27ad1a, 0x4e27ae91,
+    0x4e27c519, 0x4e280059, 0x4e280659, 0x4e28251a, 0x4e283c59, 0x4e2840da, 0x4e284eda, 0x4e285059,
+    0x4e28670a, 0x4e2879d5, 0x4e287fd5, 0x4e288dd6, 0x4e2893d6, 0x4e28a251, 0x4e28a851, 0x4e28b6b5,
+    0x4e28bcb5, 0x4e28de51, 0x4e28f1c5, 0x4e28f2b5, 0x4e28f336, 0x4e28f4ca, 0x4e2906b5, 0x4e292f55,
+    0x4e2941d6, 0x4e294356, 0x4e295651, 0x4e2957d1, 0x4e296ab5, 0x4e296b45, 0x4e296c35, 0x4e29a5c5,
+    0x4e29a6b5, 0x4e2bf585, 0x4e2bf951, 0x4e2bfad1, 0x4e2c1ee1, 0x4e2c2061, 0x4e2c6099, 0x4e2c6fc9,
+    0x4e2c7145, 0x4e2c8719, 0x4e2c8899, 0x4e2c9aa1, 0x4e2c9b19, 0x4e2c9c99, 0x4e2cad49, 0x4e2cb045,
+    0x4e2cd821, 0x4e2cd9a1, 0x4e2cda15, 0x4e2d2545, 0x4e2d2911, 0x4e2d2a91, 0x4e2d4ea1, 0x4e2d62e5,
+    0x4e2d6465, 0x4e2d7a25, 0x4e2d7ba5, 0x4e2d8e25, 0x4e2d8fa5, 0x4e2da2a5, 0x4e2da425, 0x4e2ddea5,
+    0x4e2e1551, 0x4e2e16d1, 0x4e2e2ec5, 0x4e2e3c61, 0x4e2e6d19, 0x4e2e7c99, 0x4e2e8d51, 0x4e2ea319,
+    0x4e2ea499, 0x4e2ea919, 0x4e2ecc45, 0x4e2ed0c5, 0x4e2ee215, 0x4e2ef421, 0x4e2ef5a1, 0x4e2ef615,
+    0x4e2efa21, 0x4e2efa95, 0x4e2efc15, 0x4e2f0f11, 0x4e2f1091, 0x4e2f2361, 0x4e2f4511, 0x4e2f4691,
+    0x4e2f4b11, 0x4e2f6c21, 0x4e2f8051, 0x4e2f9615, 0x4e2f9795, 0x4e2f9c25, 0x4e2fbe91, 0x4e2fc011,
+    0x4e2fe5a1, 0x4e300e05, 0x4e315a5d, 0x4e315c5d, 0x4e3182dd, 0x4e31965d, 0x4e3196dd, 0x4e31fe66,
+    0x4e328645, 0x4e328a15, 0x4e328b95, 0x4e328c15, 0x4e32c8d9, 0x4e330089, 0x4e330205, 0x4e334055,
+    0x4e334105, 0x4e33b9e5, 0x4e33bb65, 0x4e33bbe5, 0x4e33f3a5, 0x4e33f525, 0x4e343365, 0x4e3434e5,
+    0x4e343565, 0x4e346f65, 0x4e34a615, 0x4e34a795, 0x4e34d759, 0x4e34f891, 0x4e351e19, 0x4e3550d5,
+    0x4e35c3e5, 0x4e35d5e5, 0x4e35d765, 0x4e35d7e5, 0x4e35dbe5, 0x4e35eb91, 0x4e3604e6, 0x4e361115,
+    0x4e363f66, 0x4e364f65, 0x4e3650e5, 0x4e3677e5, 0x4e367965, 0x4e37c3dd, 0x4e37ea5d, 0x4e37fe5d,
+    0x4e3877e6, 0x4e38c6d1, 0x4e38c851, 0x4e38da45, 0x4e38de15, 0x4e38df95, 0x4e38ef09, 0x4e38f215,
+    0x4e38f395, 0x4e392ed9, 0x4e393059, 0x4e394291, 0x4e395489, 0x4e395605, 0x4e398011, 0x4e398191,
+    0x4e39a855, 0x4e39a9d5, 0x4e39bd92, 0x4e39e2c9, 0x4e39e765, 0x4e39f691, 0x4e3a0de5, 0x4e3a0f65,
+    0x4e3a0fe5, 0x4e3a1ec9, 0x4e3a21e5, 0x4e3a2365, 0x4e3a47a5, 0x4e3a4925, 0x4e3a8765, 0x4e3a88e5,
+    0x4e3a8965, 0x4e3a9b65, 0x4e3a9ce5, 0x4e3ac365, 0x4e3ac565, 0x4e3ad765, 0x4e3ae451, 0x4e3afa15,
+    0x4e3afb95, 0x4e3b0015, 0x4e3b0e15, 0x4e3b0f95, 0x4e3b4ad9, 0x4e3b4c59, 0x4e3b50d9, 0x4e3b7205,
+    0x4e3b9c11, 0x4e3b9d91, 0x4e3ba211, 0x4e3bc455, 0x4e3bc5d5, 0x4e3bca55, 0x4e3bef65, 0x4e3bf3e5,
+    0x4e3bf565, 0x4e3c0365, 0x4e3c07e5, 0x4e3c0965, 0x4e3c1411, 0x4e3c29e5, 0x4e3c2b65, 0x4e3c2fe5,
+    0x4e3c3065, 0x4e3c31e5, 0x4e3c3de5, 0x4e3c3f65, 0x4e3c43e5, 0x4e3c6505, 0x4e3c8d91, 0x4e3ca365,
+    0x4e3ca4e5, 0x4e3ca565, 0x4e3ca965, 0x4e3cb765, 0x4e3cb8e5, 0x4e3cdf65, 0x4e3cdfe5, 0x4e3ce165,
+    0x4e4010e2, 0x4e408a61, 0x4e408be1, 0x4e408c61, 0x4e409ac5, 0x4e409e91, 0x4e40a011, 0x4e40c421,
+    0x4e40c5a1, 0x4e4103e1, 0x4e410576, 0x4e4105e1, 0x4e411509, 0x4e411685, 0x4e412c61, 0x4e412de1,
+    0x4e412e61, 0x4e413fe1, 0x4e414061, 0x4e4141e1, 0x4e417ca1, 0x4e421ad5, 0x4e422ed5, 0x4e427061,
+    0x4e42ac61, 0x4e42ace1, 0x4e42ae61, 0x4e42d405, 0x4e431261, 0x4e431fe1, 0x4e4321e1, 0x4e4325f6,
+    0x4e434861, 0x4e4349e1, 0x4e434e61, 0x4e445655, 0x4e4457d5, 0x4e445855, 0x4e44f855, 0x4e450bd5,
+    0x4e450c55, 0x4e4520d1, 0x4e4547c5, 0x4e45c2d5, 0x4e45c455, 0x4e45c4d5, 0x4e45fd4a, 0x4e4639c9,
+    0x4e4676ca, 0x4e46f2b5, 0x4e46f435, 0x4e46f4b5, 0x4e4706d1, 0x4e472b85, 0x4e472f55, 0x4e4730d5,
+    0x4e473155, 0x4e476c35, 0x4e476e35, 0x4e4794b5, 0x4e479635, 0x4e4796b5, 0x4e47a5c9, 0x4e47a745,
+    0x4e47a835, 0x4e47a8b5, 0x4e47aa35, 0x4e47ccd5, 0x4e47d355, 0x4e47ded5, 0x4e47e055, 0x4e47e0d5,
+    0x4e47e405, 0x4e47f551, 0x4e481c45, 0x4e485e59, 0x4e486ed1, 0x4e4895c5, 0x4e48d435, 0x4e48d8b5,
+    0x4e48dab5, 0x4e48fcb5, 0x4e490135, 0x4e4902b5, 0x4e490335, 0x4e490eb5, 0x4e491035, 0x4e4910b5,
+    0x4e4914b5, 0x4e491535, 0x4e4916b5, 0x4e493b49, 0x4e495155, 0x4e497635, 0x4e497ab5, 0x4e497cb5,
+    0x4e498835, 0x4e498a35, 0x4e498d45, 0x4e498eb5, 0x4e49b0b5, 0x4e49b235, 0x4e49b2b5, 0x4e49b735,
+    0x4e4c2ad5, 0x4e4c2c55, 0x4e4c6549, 0x4e4cdec9, 0x4e4d2035, 0x4e4d46b5, 0x4e4d4835, 0x4e4d48b5,
+    0x4e4d5ab5, 0x4e4d5c35, 0x4e4d6c11, 0x4e4d6d91, 0x4e4d7f85, 0x4e4d8355, 0x4e4d84d5, 0x4e4d8555,
+    0x4e4d9755, 0x4e4d98d5, 0x4e4dabd1, 0x4e4dad76, 0x4e4dc035, 0x4e4dc235, 0x4e4dd435, 0x4e4dd5b5,
+    0x4e4de7d1, 0x4e4df9c9, 0x4e4dfb45, 0x4e4dfc35, 0x4e4e1035, 0x4e4e3805, 0x4e4e46d5, 0x4e4e4855,
+    0x4e4e4cd5, 0x4e4e7659, 0x4e4eb259, 0x4e4ec659, 0x4e4f2835, 0x4e4f2cb5, 0x4e4f2eb5, 0x4e4f3c35,
+    0x4e4f40b5, 0x4e4f4235, 0x4e4f62b5, 0x4e4f6435, 0x4e4f64b5, 0x4e4f68b5, 0x4e4f76b5, 0x4e4f7835,
+    0x4e4f7cb5, 0x4e4fa555, 0x4e4fb955, 0x4e4fdc35, 0x4e4fde35, 0x4e4fe145, 0x4e4ff035, 0x4e4ff1b5,
+    0x4e4ff635, 0x4e501835, 0x4e5267d9, 0x4e526959, 0x4e527f19, 0x4e528099, 0x4e529319, 0x4e529499,
+    0x4e52e399, 0x4e531d45, 0x4e532111, 0x4e532291, 0x4e5346a1, 0x4e534821, 0x4e538661, 0x4e5387e1,
+    0x4e538861, 0x4e539789, 0x4e539905, 0x4e53aef5, 0x4e53b061, 0x4e53c261, 0x4e53c2f5, 0x4e53c461,
+    0x4e548545, 0x4e549b15, 0x4e549c95, 0x4e54a119, 0x4e54aea1, 0x4e54b095, 0x4e54ff91, 0x4e551305,
+    0x4e553d11, 0x4e553e91, 0x4e554311, 0x4e555685, 0x4e559061, 0x4e5594e1, 0x4e559661, 0x4e55a261,
+    0x4e55a3e1, 0x4e55a461, 0x4e55a861, 0x4e55a8e1, 0x4e55aa61, 0x4e55b505, 0x4e55caf5, 0x4e55cc61,
+    0x4e55d0e1, 0x4e55de61, 0x4e55e061, 0x4e55e4e1, 0x4e55f291, 0x4e560605, 0x4e564461, 0x4e5645e1,
+    0x4e5657e1, 0x4e565861, 0x4e5659e1, 0x4e568061, 0x4e568261, 0x4e58f899, 0x4e58fa19, 0x4e5935da,
+    0x4e593859, 0x4e5939d9, 0x4e593a59, 0x4e597459, 0x4e598951, 0x4e59ae05, 0x4e59b1d5, 0x4e59b355,
+    0x4e59b3d5, 0x4e59eeb5, 0x4e59f035, 0x4e59f0b5, 0x4e5a1736, 0x4e5a18b5, 0x4e5a1936, 0x4e5a2849,
+    0x4e5a29c5, 0x4e5a2ab5, 0x4e5a2b36, 0x4e5a2cb5, 0x4e5b1605, 0x4e5b5459, 0x4e5b55d9, 0x4e5b7e59,
+    0x4e5b9059, 0x4e5bcdd5, 0x4e5bcf55, 0x4e5bd3d5, 0x4e5bf8b5, 0x4e5bfd35, 0x4e5bfeb5, 0x4e5bff35,
+    0x4e5c0ab5, 0x4e5c0c35, 0x4e5c0cb5, 0x4e5c10b5, 0x4e5c1135, 0x4e5c34b5, 0x4e5c3935, 0x4e5c39b6,
+    0x4e5c3b35, 0x4e5c45c5, 0x4e5c46b5, 0x4e5c48b5, 0x4e5c4d35, 0x4e5c7155, 0x4e5c8355, 0x4e5cacb5,
+    0x4e5caeb5, 0x4e5cbf45, 0x4e5cc0b5, 0x4e5ceab5, 0x4e5f4c99, 0x4e5f4e19, 0x4e5f62da, 0x4e5f8c5a,
+    0x4e5f8dda, 0x4e5f9d5a, 0x4e5fa059, 0x4e5fa1d9, 0x4e5fc859, 0x4e5fdc59, 0x4e5fee91, 0x4e5ff011,
+    0x4e600216, 0x4e6005d6, 0x4e600756, 0x4e6016c9, 0x4e6019d5, 0x4e601b55, 0x4e602e52, 0x4e602fd2,
+    0x4e6056b5, 0x4e605835, 0x4e606a51, 0x4e607c49, 0x4e607dc5, 0x4e607eb5, 0x4e6092b5, 0x4e615691,
+    0x4e616a05, 0x4e61a859, 0x4e61a9d9, 0x4e61ae59, 0x4e61bc59, 0x4e61bdd9, 0x4e61e459, 0x4e61e4f5,
+    0x4e61e659, 0x4e6221d5, 0x4e622355, 0x4e6227d5, 0x4e6235d5, 0x4e623755, 0x4e623bd5, 0x4e624a51,
+    0x4e624bd1, 0x4e625051, 0x4e625eb5, 0x4e626035, 0x4e6260b5, 0x4e6264b5, 0x4e626535, 0x4e6272b5,
+    0x4e627435, 0x4e6278b5, 0x4e628651, 0x4e6299c5, 0x4e629ab5, 0x4e62d755, 0x4e62d7d5, 0x4e62d955,
+    0x4e62ffd1, 0x4e631345, 0x4e631435, 0x4e6314b5, 0x4e659d85, 0x4e65a211, 0x4e65b7da, 0x4e65c561,
+    0x4e65c6e1, 0x4e661651, 0x4e6617d1, 0x4e662fc5, 0x4e665551, 0x4e66cd45, 0x4e66d1ea, 0x4e66e321,
+    0x4e66e7aa, 0x4e66f52a, 0x4e66f6a1, 0x4e66fb2a, 0x4e670951, 0x4e670ad1, 0x4e6722e5, 0x4e679721,
+    0x4e6798a1, 0x4e679d25, 0x4e67edea, 0x4e6875ea, 0x4e69172a, 0x4e6917aa, 0x4e691daa, 0x4e69912a,
+    0x4e6a7819, 0x4e6b69a6, 0x4e6b6b26, 0x4e6c1b95, 0x4e6c2215, 0x4e6c2d95, 0x4e6c2e45, 0x4e6c2f15,
+    0x4e6c2f95, 0x4e6c32c5, 0x4e6c4411, 0x4e6c7119, 0x4e6ca719, 0x4e6ca899, 0x4e6cad19, 0x4e6cbd91,
+    0x4e6d22e5, 0x4e6d4b65, 0x4e6d51e5, 0x4e6d5d69, 0x4e6d5ee5, 0x4e6d5f65, 0x4e6d8a26, 0x4e6d9a15,
+    0x4e6d9b95, 0x4e6da025, 0x4e6dc4e5, 0x4e6dcb66, 0x4e6dd6e5, 0x4e6dd865, 0x4e6dff65, 0x4e6e00e5,
+    0x4e6e0165, 0x4e6e05e6, 0x4e6e0766, 0x4e6e12e5, 0x4e6e1365, 0x4e6e14e5, 0x4e6e3e15, 0x4e6e8e99,
+    0x4e6eb719, 0x4e6f37e9, 0x4e6f6de5, 0x4e6f73e5, 0x4e6f7eaa, 0x4e6faa15, 0x4e6fe769, 0x4e6ff805,
+    0x4e7021e5, 0x4e702365, 0x4e7027e6, 0x4e726d51, 0x4e726ed1, 0x4e728195, 0x4e728245, 0x4e728315,
+    0x4e7286da, 0x4e729595, 0x4e729715, 0x4e729ba6, 0x4e72fb19, 0x4e72fc99, 0x4e730119, 0x4e730f19,
+    0x4e731099, 0x4e731519, 0x4e733a16, 0x4e733e96, 0x4e734e15, 0x4e739d2a, 0x4e739e91, 0x4e73a32a,
+    0x4e73b169, 0x4e73b2e5, 0x4e73b366, 0x4e73b6aa, 0x4e73c569, 0x4e73c6e5, 0x4e73cb69, 0x4e73ee15,
+    0x4e73ef95, 0x4e740215, 0x4e740395, 0x4e741691, 0x4e741811, 0x4e742ae5, 0x4e742c65, 0x4e745291,
+    0x4e7466e5, 0x4e74e299, 0x4e74f6aa, 0x4e751d19, 0x4e751f19, 0x4e761015, 0x4e761095, 0x4e761215,
+    0x4e763891, 0x4e764c05, 0x4e78ec15, 0x4e78fe22, 0x4e791491, 0x4e798e11, 0x4e79f362, 0x4e7a1be1,
+    0x4e7a2f62, 0x4e7a2fe1, 0x4e7a4745, 0x4e7a5d15, 0x4e7a70a1, 0x4e7a9561, 0x4e7ac191, 0x4e7ad161,
+    0x4e7ad505, 0x4e7bb011, 0x4e7c01e1, 0x4e7c13e2, 0x4e7c1562, 0x4e7c15e9, 0x4e7c3c69, 0x4e7c3de1,
+    0x4e7c3e61, 0x4e7c4fe2, 0x4e7c5069, 0x4e7c51e1, 0x4e7c9316, 0x4e7d3815, 0x4e7e67dd, 0x4e7f1bdd,
+    0x4e7f1d5d, 0x4e7f4011, 0x4e7fa559, 0x4e7fcdd9, 0x4e7fd459, 0x4e7fdfd9, 0x4e7fe159, 0x4e7fe1d9,
+    0x4e801ed5, 0x4e806fd1, 0x4e80c755, 0x4e80d805, 0x4e811669, 0x4e814c69, 0x4e814de9, 0x4e815269,
+    0x4e817909, 0x4e81ba69, 0x4e81f059, 0x4e81f4d9, 0x4e81f659, 0x4e822d55, 0x4e8233d5, 0x4e823f69,
+    0x4e8240d5, 0x4e824155, 0x4e8255d1, 0x4e8291d1, 0x4e82b8ea, 0x4e82ba69, 0x4e82e355, 0x4e82e7d5,
+    0x4e832069, 0x4e833269, 0x4e8333f6, 0x4e835c69, 0x4e85f959, 0x4e8633d9, 0x4e863559, 0x4e8635d9,
+    0x4e8647d9, 0x4e864959, 0x4e864dd9, 0x4e8672d5, 0x4e8686d5, 0x4e86eac5, 0x4e871891, 0x4e872c05,
+    0x4e876445, 0x4e876a69, 0x4e877e6a, 0x4e87a669, 0x4e87b469, 0x4e87b5e9, 0x4e87ba69, 0x4e8920ea,
+    0x4e892269, 0x4e898669, 0x4e8987f6, 0x4e89a06a, 0x4e89c269, 0x4e89c2e9, 0x4e89c469, 0x4e89c8e9,
+    0x4e8c0e51, 0x4e8c0fd1, 0x4e8c27da, 0x4e8c9c35, 0x4e8c9d99, 0x4e8ca219, 0x4e8cb199, 0x4e8cb619,
+    0x4e8cc551, 0x4e8cc9ea, 0x4e8cdb16, 0x4e8cdf96, 0x4e8ced2a, 0x4e8cef15, 0x4e8cf32a, 0x4e8d3f91,
+    0x4e8d5305, 0x4e8d57aa, 0x4e8d8f15, 0x4e8d9095, 0x4e8da315, 0x4e8da495, 0x4e8f15aa, 0x4e927745,
+    0x4e929f15, 0x4e92a095, 0x4e92a519, 0x4e92dbd9, 0x4e92dd59, 0x4e92f035, 0x4e92f191, 0x4e9305d9,
+    0x4e9317d9, 0x4e931876, 0x4e9319d9, 0x4e935569, 0x4e935755, 0x4e935aaa, 0x4e9398ea, 0x4e93bcf5,
+    0x4e93ceea, 0x4e93d069, 0x4e93d4ea, 0x4e93e311, 0x4e93e491, 0x4e944869, 0x4e9449e9, 0x4e9470f5,
+    0x4e947269, 0x4e948469, 0x4e94af15, 0x4e94c115, 0x4e9565d5, 0x4e95b669, 0x4e95dee9, 0x4e95f0ea,
+    0x4e965869, 0x4e966a69, 0x4e98f329, 0x4e98f4a9, 0x4e99072a, 0x4e9908a9, 0x4e9949da, 0x4e996bea,
+    0x4e99aa16, 0x4e99ae96, 0x4e99c36a, 0x4e99fc6a, 0x4e9a22ea, 0x4e9a2469, 0x4e9a28ea, 0x4e9a36ea,
+    0x4e9a3869, 0x4e9a3cea, 0x4e9a9c69, 0x4e9a9de9, 0x4e9ab06a, 0x4e9ab1ea, 0x4e9ad869, 0x4e9b1529,
+    0x4e9b1729, 0x4e9c0a69, 0x4e9c1e6a, 0x4e9c44ea, 0x4e9c46e9, 0x4e9cbe69, 0x4e9cbeea, 0x4e9cc06a,
+    0x4e9f4951, 0x4e9f4a05, 0x4e9f4dda, 0x4e9f4f51, 0x4e9f5d95, 0x4e9f7361, 0x4e9f74da, 0x4e9f8611,
+    0x4e9fc145, 0x4e9fc449, 0x4e9fc5da, 0x4e9fd719, 0x4e9fdd19, 0x4e9fe91a, 0x4e9feaa1, 0x4e9fef1a,
+    0x4ea001ca, 0x4ea004c5, 0x4ea02821, 0x4ea02e21, 0x4ea02e96, 0x4ea064e2, 0x4ea07911, 0x4ea079ca,
+    0x4ea07f11, 0x4ea08d61, 0x4ea0b445, 0x4ea0b765, 0x4ea0ca15, 0x4ea0d025, 0x4ea0dc21, 0x4ea0dda1,
+    0x4ea0de16, 0x4ea0e296, 0x4ea0f291, 0x4ea0f725, 0x4ea106e1, 0x4ea12d11, 0x4ea12e91, 0x4ea13325,
+    0x4ea14161, 0x4ea2119a, 0x4ea30496, 0x4ea4d95d, 0x4ea58d66, 0x4ea58ee6, 0x4ea5b191, 0x4ea5e015,
+    0x4ea616d9, 0x4ea63f59, 0x4ea645e6, 0x4ea65159, 0x4ea652d9, 0x4ea65359, 0x4ea65509, 0x4ea69055,
+    0x4ea69585, 0x4ea709e5, 0x4ea70fe5, 0x4ea71065, 0x4ea738e6, 0x4ea74825, 0x4ea78965, 0x4ea7ade6,
+    0x4ea7bde5, 0x4ea7bf65, 0x4ea7c3e5, 0x4ea861d9, 0x4ea86659, 0x4ea867d9, 0x4ea8a555, 0x4ea954d5,
+    0x4eac1b51, 0x4eac1cda, 0x4eac2e15, 0x4eac3415, 0x4eac4216, 0x4eac4696, 0x4eac6ad9, 0x4eac911a,
+    0x4eac9291, 0x4eac971a, 0x4eaca559, 0x4eaca6d9, 0x4eaca759, 0x4eaca909, 0x4eacb959, 0x4eacbad9,
+    0x4eacbf59, 0x4eacd011, 0x4eacd0ca, 0x4eacd611, 0x4eace455, 0x4ead1212, 0x4ead5c45, 0x4ead5de5,
+    0x4ead63e5, 0x4ead71e5, 0x4ead8411, 0x4ead8591, 0x4ead9c25, 0x4eadd5c5, 0x4eadd765, 0x4eaddbe5,
+    0x4eaddd65, 0x4eae11e5, 0x4eae1365, 0x4eae13e5, 0x4eae17e5, 0x4eae25e5, 0x4eae2765, 0x4eae2be5,
+    0x4eae6296, 0x4eae6896, 0x4eaf93e5, 0x4eaff7e5, 0x4eb03465, 0x4eb035e5, 0x4eb28211, 0x4eb2e762,
+    0x4eb30fd9, 0x4eb360e2, 0x4eb3b1d1, 0x4eb3ef45, 0x4eb3f311, 0x4eb3f491, 0x4eb418a1, 0x4eb41a21,
+    0x4eb453e1, 0x4eb45861, 0x4eb46989, 0x4eb46b05, 0x4eb480e1, 0x4eb48261, 0x4eb48fe1, 0x4eb49061,
+    0x4eb49461, 0x4eb494e1, 0x4eb56f55, 0x4eb582e2, 0x4eb58355, 0x4eb597d1, 0x4eb5d3d1, 0x4eb75b59,
+    0x4eb75bd9, 0x4eb76d59, 0x4eb76dd9, 0x4eb7ac55, 0x4eb7acd5, 0x4eb84cd5, 0x4eb86055, 0x4eb860d5,
+    0x4eb89c45, 0x4eb912d5, 0x4eb91759, 0x4eb918d5, 0x4eb91955, 0x4eb98e49, 0x4eba42b5, 0x4eba48b5,
+    0x4eba4935, 0x4eba5b51, 0x4eba83d5, 0x4eba8555, 0x4ebabc35, 0x4ebac0b5, 0x4ebae4b5, 0x4ebae935,
+    0x4ebaeab5, 0x4ebaeb35, 0x4ebaf6b5, 0x4ebaf835, 0x4ebaf8b5, 0x4ebafa49, 0x4ebafbc5, 0x4ebafcb5,
+    0x4ebafd35, 0x4ebafeb5, 0x4ebb27d5, 0x4ebb9cc9, 0x4ebbc351, 0x4ebc28b5, 0x4ebc5135, 0x4ebc5735,
+    0x4ebc57b5, 0x4ebc64b5, 0x4ebc6535, 0x4ebc8fd5, 0x4ebccf35, 0x4ebcdcb5, 0x4ebd0535, 0x4ebd0735,
+    0x4ebd0bb5, 0x4ebd0d35, 0x4ebf66d5, 0x4ec096b5, 0x4ec09cb5, 0x4ec09d35, 0x4ec0aab5, 0x4ec0b0b5,
+    0x4ec0c091, 0x4ec0c211, 0x4ec0d7d5, 0x4ec0d955, 0x4ec0ebd6, 0x4ec10051, 0x4ec11035, 0x4ec114b5,
+    0x4ec13c51, 0x4ec14ab5, 0x4ec14c35, 0x4ec14cb5, 0x4ec14e49, 0x4ec14fc5, 0x4ec150b5, 0x4ec15eb5,
+    0x4ec16035, 0x4ec164b5, 0x4ec27cb5, 0x4ec2b8b5, 0x4ec2b935, 0x4ec2ccb5, 0x4ec5b945, 0x4ec5bc59,
+    0x4ec5bdda, 0x4ec5cf15, 0x4ec5d519, 0x4ec5e11a, 0x4ec5e2a1, 0x4ec63391, 0x4ec6381a, 0x4ec67111,
+    0x4ec671ca, 0x4ec67711, 0x4ec69821, 0x4ec69b0a, 0x4ec6b312, 0x4ec6d661, 0x4ec6dc61, 0x4ec6e905,
+    0x4ec6ec0a, 0x4ec6fef5, 0x4ec704e1, 0x4ec71261, 0x4ec718e1, 0x4ec72511, 0x4ec72691, 0x4ec77861,
+    0x4ec78a61, 0x4ec78be1, 0x4ec7b2f5, 0x4ec7b461, 0x4ec7c661, 0x4ec7c861, 0x4ec80396, 0x4ec80996,
+    0x4ecc3755, 0x4ecc4959, 0x4ecc4a05, 0x4ecc4ad5, 0x4ecc4d19, 0x4ecc5fd1, 0x4ecc86c5, 0x4ecc8e59,
+    0x4eccc459, 0x4eccc8da, 0x4eccd951, 0x4ecd0045, 0x4ecd01d5, 0x4ecd07d5, 0x4ecd0856, 0x4ecd3eb5,
+    0x4ecd44b5, 0x4ecd6736, 0x4ecd6d35, 0x4ecd6db6, 0x4ecd79c5, 0x4ecd7ab5, 0x4ecd7b36, 0x4ecd7cca,
+    0x4ecd8135, 0x4ecdb5d5, 0x4ecdb755, 0x4ecde0b5, 0x4ecdf2b5, 0x4ecdf435, 0x4ece1b36, 0x4ece1cb5,
+    0x4ece1d36, 0x4ece2eb5, 0x4ece2f36, 0x4ece30b5, 0x4ecf4d35, 0x4ecf89b6, 0x4ecf8fb5, 0x4ed03db6,
+    0x4ed03f35, 0x4ed2891a, 0x4ed28a91, 0x4ed29e05, 0x4ed2a11a, 0x4ed2b75a, 0x4ed2dc5a, 0x4ed2e25a,
+    0x4ed316da, 0x4ed31859, 0x4ed31cda, 0x4ed32ada, 0x4ed32c59, 0x4ed330da, 0x4ed34011, 0x4ed3430a,
+    0x4ed355d6, 0x4ed35bd6, 0x4ed369d6, 0x4ed36fd6, 0x4ed37e52, 0x4ed38452, 0x4ed3ba51, 0x4ed3cdc5,
+    0x4ed3ceb5, 0x4ed3cf36, 0x4ed3d0ca, 0x4ed3e2b5, 0x4ed409d5, 0x4ed40b55, 0x4ed41dd6, 0x4ed41f56,
+    0x4ed43251, 0x4ed433d1, 0x4ed446b5, 0x4ed44835, 0x4ed46e51, 0x4ed482b5, 0x4ed4ab1a, 0x4ed4fcda,
+    0x4ed4fe59, 0x4ed538da, 0x4ed53ad9, 0x4ed58bd6, 0x4ed5b4b5, 0x4ed62bd5, 0x4ed62c56, 0x4ed62dd6,
+    0x4ed65451, 0x4ed8f151, 0x4ed8f2d1, 0x4ed90ad5, 0x4ed9491a, 0x4ed97f21, 0x4ed98099, 0x4ed98519,
+    0x4ed99499, 0x4ed9a851, 0x4ed9acd1, 0x4ed9be16, 0x4ed9c296, 0x4ed9d695, 0x4ed9d815, 0x4ed9eb12,
+    0x4ed9ec92, 0x4eda2291, 0x4eda2711, 0x4eda3605, 0x4eda3a85, 0x4eda7215, 0x4eda7395, 0x4eda8615,
+    0x4eda8795, 0x4eda9a91, 0x4eda9c11, 0x4edab425, 0x4edad691, 0x4edbf295, 0x4edbf415, 0x4edbf895,
+    0x4ede46dd, 0x4edefae6, 0x4edefc66, 0x4edf5a45, 0x4edf8215, 0x4edf8395, 0x4edf8815, 0x4edfb359,
+    0x4edfc0d9, 0x4edfd311, 0x4edfd491, 0x4ee01211, 0x4ee02cd5, 0x4ee07be5, 0x4ee09fe5, 0x4ee0b1e5,
+    0x4ee0b365, 0x4ee0b7e5, 0x4ee0c611, 0x4ee0c791, 0x4ee0e0e6, 0x4ee11b66, 0x4ee12b65, 0x4ee12ce5,
+    0x4ee13165, 0x4ee153e5, 0x4ee15565, 0x4ee16765, 0x4ee167e5, 0x4ee16965, 0x4ee19215, 0x4ee1a415,
+    0x4ee1a495, 0x4ee1a615, 0x4ee1cf59, 0x4ee1d3d9, 0x4ee1d559, 0x4ee24d55, 0x4ee29965, 0x4ee2c1e5,
+    0x4ee2d3e5, 0x4ee2d465, 0x4ee2d5e5, 0x4ee33b65, 0x4ee34d65, 0x4ee34de5, 0x4ee34f65, 0x4ee5d625,
+    0x4ee5d7a5, 0x4ee5ea25, 0x4ee5eba5, 0x4ee6181a, 0x4ee626e6, 0x4ee62866, 0x4ee62ce6, 0x4ee68d16,
+    0x4ee69196, 0x4ee6a066, 0x4ee6df65, 0x4ee6e3e5, 0x4ee6e565, 0x4ee705e5, 0x4ee70765, 0x4ee70be5,
+    0x4ee719e5, 0x4ee71b65, 0x4ee71fe5, 0x4ee77f65, 0x4ee780e5, 0x4ee79365, 0x4ee794e5, 0x4ee7bb65,
+    0x4ee7f825, 0x4ee7f8a5, 0x4ee7fa25, 0x4ee8ed65, 0x4ee8ffe5, 0x4ee90165, 0x4ee905e5, 0x4ee927e5,
+    0x4ee929e5, 0x4ee9a165, 0x4ee9a1e5, 0x4ee9a365, 0x4eec52a1, 0x4eec5421, 0x4eeca391, 0x4eed09a1,
+    0x4eed0e21, 0x4eed4c61, 0x4eed8261, 0x4eed83e1, 0x4eed8861, 0x4eed88e1, 0x4eed8a61, 0x4eed9c91,
+    0x4eedb005, 0x4eedee61, 0x4eedfbe1, 0x4eee2461, 0x4eee25e1, 0x4eee2a61, 0x4eee37e1, 0x4eee3861,
+    0x4eee39e1, 0x4eef1755, 0x4eef18d5, 0x4eef2b55, 0x4eef3fd1, 0x4eef7bd1, 0x4eefa4e1, 0x4eefaae1,
+    0x4ef01e61, 0x4ef02476, 0x4ef0c959, 0x4ef2a8d5, 0x4ef2af55, 0x4ef2bad5, 0x4ef2bb85, 0x4ef2bc55,
+    0x4ef2bcd5, 0x4ef2d151, 0x4ef2f845, 0x4ef2fe59, 0x4ef33459, 0x4ef335d9, 0x4ef33a59, 0x4ef34ad1,
+    0x4ef371c5, 0x4ef37355, 0x4ef377d5, 0x4ef3b035, 0x4ef3b4b5, 0x4ef3b6b5, 0x4ef3d8b5, 0x4ef3dd35,
+    0x4ef3deb5, 0x4ef3df35, 0x4ef3eab5, 0x4ef3eb45, 0x4ef3ec35, 0x4ef3ecb5, 0x4ef3efc5, 0x4ef3f0b5,
+    0x4ef3f135, 0x4ef3f2b5, 0x4ef42755, 0x4ef428d5, 0x4ef42d55, 0x4ef45235, 0x4ef456b5, 0x4ef458b5,
+    0x4ef46435, 0x4ef46635, 0x4ef46ab5, 0x4ef48cb5, 0x4ef48e35, 0x4ef48eb5, 0x4ef49335, 0x4ef494b5,
+    0x4ef4a035, 0x4ef4a0b5, 0x4ef4a235, 0x4ef4a6b5, 0x4ef50859, 0x4ef50a49, 0x4ef51bf6, 0x4ef54459,
+    0x4ef556d9, 0x4ef56b51, 0x4ef56cd1, 0x4ef5beb5, 0x4ef5c335, 0x4ef5c535, 0x4ef5d0b5, 0x4ef5d235,
+    0x4ef5d2b5, 0x4ef5f935, 0x4ef5fab5, 0x4ef5fb35, 0x4ef5ffb5, 0x4ef60135, 0x4ef60cb5, 0x4ef60d35,
+    0x4ef60eb5, 0x4ef61335, 0x4ef674b5, 0x4ef67935, 0x4ef67ab5, 0x4ef6af35, 0x4ef6b0b5, 0x4ef6b535,
+    0x4ef8fa91, 0x4ef8fc11, 0x4ef90091, 0x4ef90f85, 0x4ef96659, 0x4ef98859, 0x4ef989d9, 0x4ef98e59,
+    0x4ef99c59, 0x4ef99dd9, 0x4ef9a259, 0x4ef9b191, 0x4ef9b611, 0x4ef9c756, 0x4ef9cbd6, 0x4ef9db55,
+    0x4ef9dfd5, 0x4ef9e155, 0x4ef9f452, 0x4ef9f5d2, 0x4efa1835, 0x4efa1cb5, 0x4efa2a51, 0x4efa2bd1,
+    0x4efa3051, 0x4efa3eb5, 0x4efa3f45, 0x4efa4035, 0x4efa40b5, 0x4efa43c5, 0x4efa44b5, 0x4efa52b5,
+    0x4efa5435, 0x4efa58b5, 0x4efa7b55, 0x4efa7cd5, 0x4efa8155, 0x4efa8f55, 0x4efa90d5, 0x4efa9555,
+    0x4efaa3d1, 0x4efaa576, 0x4efab835, 0x4efaba35, 0x4efabd45, 0x4efacc35, 0x4efacdb5, 0x4efadfd1,
+    0x4efaf435, 0x4efb1c91, 0x4efb6ff6, 0x4efb83f6, 0x4efbaa59, 0x4efbaad9, 0x4efbac59, 0x4efbfbd5,
+    0x4efbfd55, 0x4efc01d5, 0x4efc24b5, 0x4efc26b5, 0x4efc38b5, 0x4efc4c51, 0x4efc60b5, 0x4efc6135,
+    0x4efc62b5, 0x4efc9d55, 0x4efc9dd5, 0x4efc9f55, 0x4efcc5f6, 0x4eff7721, 0x4eff78a1, 0x4effb91a,
+    0x4f002e16, 0x4f003296, 0x4f008061, 0x4f0084e1, 0x4f008661, 0x4f00a861, 0x4f00ace1, 0x4f00bc61,
+    0x4f00c0e1, 0x4f012061, 0x4f0121e1, 0x4f013461, 0x4f0135e1, 0x4f015c61, 0x4f02a0e1, 0x4f02a261,
+    0x4f02a6e1, 0x4f04015a, 0x4f05cb11, 0x4f05cc91, 0x4f05d119, 0x4f05e75a, 0x4f061e5a, 0x4f063059,
+    0x4f0631d9, 0x4f063659, 0x4f0658f5, 0x4f065a59, 0x4f066c59, 0x4f066e59, 0x4f0672d9, 0x4f068205,
+    0x4f068685, 0x4f0697d6, 0x4f06a9d5, 0x4f06ab55, 0x4f06abd5, 0x4f06afd5, 0x4f06b055, 0x4f06b1d5,
+    0x4f06c052, 0x4f06c4d2, 0x4f06c652, 0x4f06e6b5, 0x4f06e835, 0x4f06e8b5, 0x4f06ecb5, 0x4f06ed35,
+    0x4f06fc51, 0x4f0700d1, 0x4f0710b5, 0x4f071535, 0x4f0715b6, 0x4f071735, 0x4f0722b5, 0x4f0724b5,
+    0x4f072935, 0x4f074bd5, 0x4f074d55, 0x4f075f55, 0x4f075fd5, 0x4f076155, 0x4f077451, 0x4f0775d1,
+    0x4f0788b5, 0x4f078ab5, 0x4f079cb5, 0x4f07b051, 0x4f080355, 0x4f0807da, 0x4f084059, 0x4f085259,
+    0x4f0852d9, 0x4f085459, 0x4f08cc55, 0x4f08cdd5, 0x4f08d255, 0x4f08f535, 0x4f08f735, 0x4f08fbb5,
+    0x4f08fd35, 0x4f093335, 0x4f09ab35, 0x4f09acb5, 0x53cdc415, 0x53ce10c9, 0x53ce13c5, 0x53ce3ba1,
+    0x53ce3d21, 0x53ce3d99, 0x53cef3e1, 0x53cf6b62, 0x53cf6ce2, 0x53cf6d66, 0x53cf7fa5, 0x53cf8125,
+    0x53cf93e6, 0x53cf9566, 0x53cfa762, 0x53cfa7e6, 0x53cfb7d1, 0x53cfb891, 0x53cfb952, 0x53cfbc51,
+    0x53cfbdd1, 0x53cfcc15, 0x53cfce49, 0x53cfd095, 0x53cfd145, 0x53cfd215, 0x53cfdee1, 0x53cfdfa2,
+    0x53cfe015, 0x53cfe422, 0x53cfe49a, 0x53cfe61a, 0x53cff491, 0x53cff545, 0x53cff911, 0x53cffaa5,
+    0x53d00b0a, 0x53d01ea2, 0x53d01f29, 0x53d02022, 0x53d02fd1, 0x53d04599, 0x53d04645, 0x53d04a19,
+    0x53d04b99, 0x53d07411, 0x53d09822, 0x53d09889, 0x53d0ad0a, 0x53d0d362, 0x53d0d422, 0x53d0d7e2,
+    0x53d0d962, 0x53d0d9e9, 0x53d0e845, 0x53d0ed91, 0x53d0fbe1, 0x53d10069, 0x53d101e1, 0x53d10ea1,
+    0x53d10fe1, 0x53d111a1, 0x53d122d1, 0x53d12392, 0x53d13895, 0x53d13965, 0x53d13d25, 0x53d13ea5,
+    0x53d17561, 0x53d179e6, 0x53d17b66, 0x53d18762, 0x53d18821, 0x53d188e2, 0x53d18969, 0x53d18d62,
+    0x53d18de6, 0x53d18f66, 0x53d1afe1, 0x53d1b085, 0x53d1b161, 0x53d1b3a5, 0x53d1b5e6, 0x53d4a3d9,
+    0x53d4a485, 0x53d4a559, 0x53d4a5d9, 0x53d596e6, 0x53d59866, 0x53d598e6, 0x53d5e7e6, 0x53d5e966,
+    0x53d60ca5, 0x53d61065, 0x53d611e5, 0x53d61265, 0x53d62011, 0x53d62249, 0x53d62499, 0x53d62545,
+    0x53d62615, 0x53d64705, 0x53d64895, 0x53d64955, 0x53d64a1a, 0x53d64a9a, 0x53d64d2a, 0x53d64ea6,
+    0x53d64f2a, 0x53d65f0a, 0x53d68559, 0x53d68605, 0x53d68789, 0x53d689d9, 0x53d68a85, 0x53d69991,
+    0x53d69a51, 0x53d69e2a, 0x53d69f91, 0x53d6add9, 0x53d6b009, 0x53d6b259, 0x53d6b305, 0x53d6b3d9,
+    0x53d6b459, 0x53d6bfda, 0x53d6c099, 0x53d6c15a, 0x53d6c1da, 0x53d6fed5, 0x53d704d5, 0x53d70555,
+    0x53d73dca, 0x53d755d1, 0x53d776c5, 0x53d77865, 0x53d7792a, 0x53d779c9, 0x53d77a49, 0x53d77e65,
+    0x53d77ee5, 0x53d78c91, 0x53d78d65, 0x53d79125, 0x53d792a6, 0x53d7a0d5, 0x53d7a566, 0x53d7a6e6,
+    0x53d7b395, 0x53d7b456, 0x53d7b8d6, 0x53d7b956, 0x53d7bad6, 0x53d7c951, 0x53d7cde6, 0x53d7f045,
+    0x53d7f1e5, 0x53d7f2a6, 0x53d7f366, 0x53d7f3e6, 0x53d7f4e6, 0x53d7f665, 0x53d7f7e6, 0x53d7f86a,
+    0x53d81a65, 0x53d81b25, 0x53d81c66, 0x53d81ee5, 0x53d82065, 0x53d820e5, 0x53da9495, 0x53dad169,
+    0x53dae511, 0x53daf959, 0x53daf9d9, 0x53db4ad5, 0x53dbabca, 0x53dbbfc9, 0x53dbc465, 0x53dbeae6,
+    0x53dbec66, 0x53dbece6, 0x53dbfee6, 0x53dc254a, 0x53dc3dea, 0x53dc60a5, 0x53dc6465, 0x53dc65e5,
+    0x53dc6665, 0x53dc7865, 0x53dc79e5, 0x53dc86d1, 0x53dc9b05, 0x53dc9c95, 0x53dc9d45, 0x53dc9e09,
+    0x53dc9e89, 0x53dca115, 0x53dca295, 0x53dca315, 0x53dcb095, 0x53dcb52a, 0x53dcd959, 0x53dcda05,
+    0x53dcddd9, 0x53dcdf65, 0x53dcdfe9, 0x53dced69, 0x53dcefaa, 0x53dd13d9, 0x53dd1485, 0x53dd1559,
+    0x53dd15d9, 0x53dd1789, 0x53dd1809, 0x53dd19d9, 0x53dd1a59, 0x53dd27da, 0x53dd295a, 0x53dd432a,
+    0x53dd52d5, 0x53dd5769, 0x53dd58d5, 0x53dd5955, 0x53dd66d5, 0x53dd91ca, 0x53ddb691, 0x53ddb991,
+    0x53ddcac5, 0x53ddcc65, 0x53ddcd05, 0x53ddcdc9, 0x53ddce49, 0x53ddd0ea, 0x53ddd265, 0x53dde065,
+    0x53de06d5, 0x53de0785, 0x53de0855, 0x53de08d5, 0x53de0aa5, 0x53de0d66, 0x53de3011, 0x53de4445,
+    0x53de45e5, 0x53de46a5, 0x53de47e6, 0x53de4a65, 0x53de4be6, 0x53de4c6a, 0x53de59ea, 0x53de81e5,
+    0x53de8665, 0x53de86e5, 0x53e26762, 0x53e26955, 0x53e2b609, 0x53e2b905, 0x53e2b9d1, 0x53e2dd21,
+    0x53e2e0e1, 0x53e2e261, 0x53e2e2e1, 0x53e2f091, 0x53e2f511, 0x53e2f695, 0x53e319e1, 0x53e31aa2,
+    0x53e31b15, 0x53e31c22, 0x53e32f8a, 0x53e355e2, 0x53e35a62, 0x53e36b92, 0x53e37e59, 0x53e382d9,
+    0x53e38459, 0x53e3925a, 0x53e3965a, 0x53e396da, 0x53e3cf62, 0x53e3d022, 0x53e3d3e2, 0x53e3d562,
+    0x53e3d5d5, 0x53e42651, 0x53e44762, 0x53e449a1, 0x53e44a62, 0x53e44ac9, 0x53e45dc5, 0x53e46191,
+    0x53e46316, 0x53e47155, 0x53e47389, 0x53e475d5, 0x53e47685, 0x53e47755, 0x53e484d6, 0x53e48716,
+    0x53e489d6, 0x53e48b56, 0x53e499d1, 0x53e49e51, 0x53e4c0e2, 0x53e4c306, 0x53e4c562, 0x53e4d5d2,
+    0x53e4d811, 0x53e4eb85, 0x53e4ef61, 0x53e4f0e1, 0x53e946ea, 0x53e94929, 0x53e949ea, 0x53e94aa9,
+    0x53e94b29, 0x53e98169, 0x53e983aa, 0x53e985e9, 0x53e986aa, 0x53e9c04a, 0x53e9d4aa, 0x53e9d7aa,
+    0x53e9d869, 0x53e9f95a, 0x53e9faea, 0x53e9fbaa, 0x53e9fc5a, 0x53e9fcda, 0x53e9fdda, 0x53ea00ea,
+    0x53ea016a, 0x53ea39ca, 0x53eab129, 0x53eab36a, 0x53eab66a, 0x53eab729, 0x53eab7a9, 0x53eac569,
+    0x53eac7aa, 0x53eac9e9, 0x53eacaaa, 0x53eaedea, 0x53eaeeaa, 0x53eaef56, 0x53eaefd6, 0x53eaf26a,
+    0x53eaf3d6, 0x53eaf46a, 0x53eb2aa9, 0x53eb2cea, 0x53eb2f29, 0x53eb2fc6, 0x53eb3eea, 0x53eb3faa,
+    0x53eb436a, 0x53eb44ea, 0x53eb5329, 0x53eb556a, 0x53eb57a9, 0x53eb586a, 0x53eb5929, 0x53eb59a9,
+    0x53eefd29, 0x53ef39d5, 0x53ef76a9, 0x53ef8511, 0x53ef88d1, 0x53ef8a51, 0x53ef9ac9, 0x53ef9d29,
+    0x53ef9dc5, 0x53ef9ea9, 0x53ef9f29, 0x53efaec9, 0x53efb129, 0x53efb2a9, 0x53efc111, 0x53efc1d1,
+    0x53efc591, 0x53efd555, 0x53efd789, 0x53efd9d5, 0x53efda85, 0x53efdb55, 0x53efdbd5, 0x53efe955,
+    0x53efeb89, 0x53f00306, 0x53f0144a, 0x53f02cea, 0x53f04ed9, 0x53f04f85, 0x53f05049, 0x53f050c9,
+    0x53f05359, 0x53f054d9, 0x53f05559, 0x53f062d9, 0x53f06759, 0x53f0e329, 0x53f0f0d1, 0x53f0f191,
+    0x53f0f6d1, 0x53f10529, 0x53f10749, 0x53f109a9, 0x53f10a45, 0x53f10b29, 0x53f10ba9, 0x53f11929,
+    0x53f11b49, 0x53f11da9, 0x53f11f29, 0x53f12f16, 0x53f14045, 0x53f141d5, 0x53f14285, 0x53f143c9,
+    0x53f14655, 0x53f147d6, 0x53f14855, 0x53f155d5, 0x53f15a55, 0x53f16a51, 0x53f16b06, 0x53f16ed1,
+    0x53f17ea9, 0x53f180c9, 0x53f18329, 0x53f183c6, 0x53f18529, 0x53f192a9, 0x53f194ea, 0x53f1b929,
+    0x53f1b9c5, 0x53f1baa9, 0x53f1bb29, 0x53f1bcc9, 0x53f1bd49, 0x53f1be45, 0x53f1bf29, 0x53f1bfa9,
+    0x53f627c5, 0x53f63d95, 0x53f63e59, 0x53f64219, 0x53f64399, 0x53f65121, 0x53f6679a, 0x53f6805a,
+    0x53f68de2, 0x53f6925a, 0x53f6a091, 0x53f6a211, 0x53f6b585, 0x53f6b899, 0x53f6e045, 0x53f6e42a,
+    0x53f6e591, 0x53f6f3d5, 0x53f6f609, 0x53f6f905, 0x53f70762, 0x53f707d5, 0x53f709a1, 0x53f71c51,
+    0x53f72251, 0x53f74662, 0x53f75785, 0x53f75851, 0x53f75a89, 0x53f76d61, 0x53f76e05, 0x53f771ea,
+    0x53f77361, 0x53f77f6a, 0x53f780e1, 0x53f78161, 0x53f7856a, 0x53f79391, 0x53f79511, 0x53f7a885,
+    0x53f7d1d1, 0x53f7e6e1, 0x53f7f8e1, 0x53f7fa61, 0x53f82161, 0x53f822e1, 0x53fc9191, 0x53fc9259,
+    0x53fc9619, 0x53fc9799, 0x53fca5d5, 0x53fcb7d5, 0x53fcb885, 0x53fcb955, 0x53fcb9d5, 0x53fcd45a,
+    0x53fcf6d9, 0x53fcf799, 0x53fcf85a, 0x53fcfb59, 0x53fcfcd9, 0x53fcfd6a, 0x53fd0985, 0x53fd1f59,
+    0x53fd2019, 0x53fd23d9, 0x53fd2559, 0x53fd25d9, 0x53fd32d9, 0x53fd47d1, 0x53fd4a09, 0x53fd4d05,
+    0x53fd6ec5, 0x53fd7055, 0x53fd7105, 0x53fd74ea, 0x53fd7655, 0x53fd76d5, 0x53fdad29, 0x53fdaf49,
+    0x53fdb1a9, 0x53fdb245, 0x53fdb329, 0x53fdb3a9, 0x53fdc151, 0x53fdc205, 0x53fdc5ea, 0x53fdc751,
+    0x53fdd5a9, 0x53fdd7c9, 0x53fdda29, 0x53fddac5, 0x53fddba9, 0x53fddc29, 0x53fde7a9, 0x53fde845,
+    0x53fde929, 0x53fde9a9, 0x53fdeb49, 0x53fdebc9, 0x53fdeda9, 0x53fdee29, 0x53fdefa9, 0x53fdfc85,
+    0x53fe1255, 0x53fe25d5, 0x53fe2655, 0x53fe4f29, 0x53fe6129, 0x53fe61c5, 0x53fe62a9, 0x53fe6329,
+    0x53fe76d1, 0x53fe89a9, 0x53fe8a45, 0x53fe8b29, 0x53fe8ba9, 0x5402f911, 0x54030bd5, 0x54030c85,
+    0x54030d55, 0x54030dd5, 0x54030f99, 0x54031fd5, 0x54032155, 0x54034ad9, 0x54034c5a, 0x54034f59,
+    0x540350d9, 0x5403516a, 0x54035eea, 0x54038559, 0x540386d9, 0x54038b59, 0x54038bd9, 0x54039ad9,
+    0x5403b191, 0x5403c2c5, 0x5403c505, 0x5403c8ea, 0x5403ca55, 0x5403cad5, 0x5403d855, 0x5403dcea,
+    0x54040129, 0x540405a9, 0x54040729, 0x540407a9, 0x54041529, 0x54041b29, 0x5404276a, 0x540428d1,
+    0x54042d6a, 0x54043ba9, 0x54043c45, 0x54043d29, 0x54043da9, 0x54043f49, 0x54043fc9, 0x540441a9,
+    0x54044229, 0x540443a9, 0x54044fa9, 0x54045129, 0x540455a9, 0x54047855, 0x540479d5, 0x54047a55,
+    0x54048dd5, 0x5404a0d1, 0x5404b529, 0x5404b5c5, 0x5404b6a9, 0x5404b729, 0x5404c929, 0x5404caa9,
+    0x5404f129, 0x5404f1a9, 0x5404f329, 0x5407e7d9, 0x5408dae6, 0x54094f62, 0x54096449, 0x54096745,
+    0x54096811, 0x54098aa1, 0x54098c22, 0x54098c95, 0x54098f1a, 0x540990a1, 0x54099116, 0x5409a10a,
+    0x5409c762, 0x5409c822, 0x5409cbe2, 0x5409cd62, 0x5409db91, 0x5409e01a, 0x5409e191, 0x5409efd9,
+    0x5409f459, 0x5409f5d9, 0x540a03da, 0x540a085a, 0x540a09da, 0x540a430a, 0x540a46e2, 0x540a4755,
+    0x540a940a, 0x540a9705, 0x540a97d1, 0x540aba61, 0x540abb0a, 0x540abc49, 0x540ac061, 0x540ac0e1,
+    0x540ace91, 0x540ad325, 0x540ad4a6, 0x540ae2d5, 0x540ae766, 0x540ae8e6, 0x540af656, 0x540afb56,
+    0x540afcd6, 0x540b0b51, 0x540b0fe6, 0x540b3262, 0x540b33e1, 0x540b36e2, 0x540b5c61, 0x540b6265,
+    0x540fbaa6, 0x540fbc26, 0x540fbca6, 0x540ff2e5, 0x540ff526, 0x540ff826, 0x540ff8e5, 0x541031ca,
+    0x54104626, 0x54104926, 0x541049e5, 0x54106ada, 0x54106c66, 0x54106e5a, 0x541070da, 0x54107266,
+    0x541072e6, 0x541122a5, 0x541124ca, 0x541127e6, 0x541128a5, 0x54112925, 0x541136e5, 0x54113b66,
+    0x54115f66, 0x541160d6, 0x54116156, 0x541163e6, 0x54116566, 0x541165d6, 0x54119c25, 0x5411a0a6,
+    0x5411a166, 0x5411b4e6, 0x5411c4a5, 0x5411c926, 0x5411c9e6, 0x5411caa6, 0x5411cb26, 0x54143ed5,
+    0x5414b859, 0x54156ea5, 0x54160ea6, 0x54161026, 0x541610a6, 0x541622a6, 0x54162426, 0x54163291,
+    0x5416371a, 0x54163891, 0x541646d5, 0x54164909, 0x54164b59, 0x54164c05, 0x54164cd5, 0x54164d55,
+    0x54165ad5, 0x54165d16, 0x541685ca, 0x5416c059, 0x5416c1c9, 0x5416c249, 0x5416c4da, 0x5416c659,
+    0x5416c6d9, 0x5416d459, 0x5416d8da, 0x5416da59, 0x5416eb0a, 0x541717d6, 0x54176251, 0x5417630a,
+    0x54176851, 0x541776a5, 0x541778ca, 0x54177bc5, 0x54177ca5, 0x54177d25, 0x54178aa5, 0x54178cca,
+    0x541790a5, 0x5417b355, 0x5417b566, 0x5417b7e5, 0x5417b965, 0x5417b9d6, 0x5417c756, 0x5417cbd6,
+    0x5417cd56, 0x5417dbd1, 0x5417f025, 0x5417f4a6, 0x5417f626, 0x54182aa5, 0x54182b45, 0x54182c25,
+    0x54182ca5, 0x541830a6, 0x54183126, 0x541c88e2, 0x541c8b22, 0x541c8be2, 0x541c8ca2, 0x541c8d21,
+    0x541cc362, 0x541cc5a2, 0x541cc7e2, 0x541cc8a2, 0x541cc962, 0x541d1a61, 0x541d3e5a, 0x541d3eda,
+    0x541df54a, 0x541df862, 0x541df922, 0x541df9a1, 0x541e0761, 0x541e09a2, 0x541e0be1, 0x541e0ca2,
+    0x541e3462, 0x541e35d6, 0x541e3656, 0x541e6ca2, 0x541e6ee2, 0x541e7122, 0x541e8562, 0x541e86e2,
+    0x541e9521, 0x541e9762, 0x541e99a1, 0x541e9a62, 0x541e9b21, 0x5428e415, 0x54296b52, 0x54299a56,
+    0x5429e95a, 0x5429f919, 0x5429fb49, 0x5429fd99, 0x5429fe45, 0x5429ff19, 0x5429ff99, 0x542a0d1a,
+    0x542a0f59, 0x542a5095, 0x542a9d4a, 0x542aa112, 0x542adc51, 0x542addd6, 0x542aec15, 0x542aee49,
+    0x542af095, 0x542af145, 0x542af215, 0x542af295, 0x542b0016, 0x542b0256, 0x542b1492, 0x542b1912,
+    0x542b19c6, 0x542b6645, 0x542b6789, 0x542fd391, 0x542fd81a, 0x542fd999, 0x542ffaa1, 0x5430165a,
+    0x54303a5a, 0x54304b91, 0x54306159, 0x54306759, 0x543089d1, 0x54308c0a, 0x54308f05, 0x5430b261,
+    0x5430b30a, 0x5430b861, 0x5430b8d6, 0x5430ef22, 0x5430f522, 0x54310351, 0x5431040a, 0x54310951,
+    0x543117a1, 0x54311da1, 0x54312a61, 0x54312b22, 0x54312ba1, 0x543131a1, 0x54313e91, 0x54315455,
+    0x54317cd1, 0x54319121, 0x5431a3e1, 0x5431a4a2, 0x5431cc45, 0x54363bd1, 0x543662c5, 0x54366455,
+    0x5436665a, 0x543668da, 0x54366a59, 0x54366ad6, 0x5436a119, 0x5436a71a, 0x5436b551, 0x5436b9da,
+    0x5436c999, 0x5436cf9a, 0x5436d01a, 0x5436db9a, 0x5436dc59, 0x5436dd1a, 0x5436dd9a, 0x54371a95,
+    0x54371cca, 0x54371fc5, 0x54372095, 0x54372115, 0x54376b91, 0x54376dca, 0x543770c5, 0x54377191,
+    0x54379285, 0x543794ca, 0x5437a851, 0x5437bc95, 0x5437ce96, 0x5437cf55, 0x5437e511, 0x543ca291,
+    0x543cb855, 0x543cb919, 0x543cbcda, 0x543cbe59, 0x543cbed6, 0x543ccc56, 0x543cd0d6, 0x543cd256,
+    0x543cf519, 0x543cfb1a, 0x543d1b5a, 0x543d2f99, 0x543d3045, 0x543d3119, 0x543d3199, 0x543d3359,
+    0x543d33d9, 0x543d439a, 0x543d451a, 0x543d5a51, 0x543d5b0a, 0x543d6051, 0x543d6e95, 0x543d70ca,
+    0x543d73c5, 0x543d8295, 0x543d84ca, 0x543dd251, 0x543de8ca, 0x543e2345, 0x543e4bd1, 0x5440ebc9,
+    0x5440eec5, 0x544116a1, 0x54411821, 0x54411895, 0x54415559, 0x54416791, 0x54416911, 0x54418ea1,
+    0x54421b89, 0x54421dd1, 0x54421e85, 0x544242a1, 0x54424661, 0x544247e1, 0x54424861, 0x54425aa5,
+    0x54425c25, 0x54426ee6, 0x54427066, 0x54429766, 0x544298e6, 0x5442c166, 0x5442c1e5, 0x5442e865,
+    0x5442e9e5, 0x54430ac5, 0x54432095, 0x54432145, 0x54432515, 0x54432695, 0x544332a1, 0x54433421,
+    0x54437159, 0x544375d9, 0x54437765, 0x54438511, 0x54439885, 0x54439b89, 0x5443c291, 0x5443c345,
+    0x5443c711, 0x5443c891, 0x5443db55, 0x5443dcd5, 0x5443e9a1, 0x5443eca1, 0x5443ee21, 0x5443eee2,
+    0x5443ef55, 0x5443f0d5, 0x544403d1, 0x54440565, 0x544429c9, 0x54442ae2, 0x54442de6, 0x54443a85,
+    0x54443d89, 0x54443f05, 0x54443fd1, 0x54445061, 0x544454e1, 0x54445661, 0x54446261, 0x544463e1,
+    0x54446861, 0x54447691, 0x54447811, 0x54448b85, 0x54448c55, 0x54448ea5, 0x544490e6, 0x5444b4e5,
+    0x5444b966, 0x5444c9e1, 0x5444ce65, 0x5444cfe6, 0x5444dbe1, 0x5444dd66, 0x54450461, 0x544505e1,
+    0x54450a65, 0x54477f85, 0x544780d5, 0x5447d085, 0x5447f859, 0x5447f9d9, 0x5447fa59, 0x5448ac49,
+    0x5448aea5, 0x5448af45, 0x5448b025, 0x5448b0a5, 0x5448c2e6, 0x5448c466, 0x5448e7a5, 0x5448eb65,
+    0x5448ece5, 0x5448ed65, 0x54492a26, 0x54493c65, 0x54493de5, 0x544950a6, 0x54495226, 0x544952a6,
+    0x544961e5, 0x54496265, 0x54496365, 0x544964a6, 0x54496626, 0x54497491, 0x54497545, 0x54497911,
+    0x54497a91, 0x54498b09, 0x54498d55, 0x54498e05, 0x54498ed5, 0x54498f55, 0x54499b85, 0x54499e95,
+    0x5449a15a, 0x5449a2da, 0x5449b765, 0x5449d9d9, 0x5449da85, 0x5449dbc9, 0x5449de59, 0x5449dfe6,
+    0x5449e059, 0x5449ec85, 0x5449ef91, 0x544a0259, 0x544a0305, 0x544a06d9, 0x544a0859, 0x544a08d9,
+    0x544a1459, 0x544a15d9, 0x544a2d09, 0x544a2f51, 0x544a3005, 0x544a30d1, 0x544a5355, 0x544a57d5,
+    0x544a5955, 0x544a59d5, 0x544a94a5, 0x544a9625, 0x544a96a5, 0x544aa451, 0x544aa8d1, 0x544aaa51,
+    0x544abac9, 0x544abd25, 0x544abea5, 0x544abf25, 0x544acaa5, 0x544acb45, 0x544acc25, 0x544ace49,
+    0x544acec9, 0x544acfc5, 0x544ad0a5, 0x544ad125, 0x544ad2a5, 0x544adf85, 0x544ae051, 0x544ae2a5,
+    0x544ae4e6, 0x544af555, 0x544af766, 0x544af9e5, 0x544afb65, 0x544afbe5, 0x544b0755, 0x544b08d5,
+    0x544b3225, 0x544b36a6, 0x544b3826, 0x544b38a6, 0x544b4425, 0x544b44c5, 0x544b45a5, 0x544b4625,
+    0x544b47e6, 0x544b4865, 0x544b4aa6, 0x544b4c26, 0x544b59d1, 0x544b6ca5, 0x544b6d45, 0x544b6e25,
+    0x544b6ea5, 0x544b7065, 0x544b72a6, 0x544b7326, 0x544dc011, 0x544dd4d5, 0x544e25d9, 0x544e4dd9,
+    0x544e4e59, 0x544e9ac9, 0x544e9f55, 0x544edc25, 0x544eea91, 0x544eee51, 0x544eefd1, 0x544f0049,
+    0x544f02a5, 0x544f0345, 0x544f04a5, 0x544f1449, 0x544f16a5, 0x544f1825, 0x544f3ba5, 0x544f3f65,
+    0x544f40e5, 0x544f4165, 0x544f5365, 0x544f54e5, 0x544f6966, 0x544f7c26, 0x544f7e26, 0x544f8de5,
+    0x544f9026, 0x544f91a6, 0x544fb5e5, 0x544fb765, 0x544fdc11, 0x544fef85, 0x544ff289, 0x544ff309,
+    0x544ff555, 0x545002d5, 0x54500455, 0x545008da, 0x54502dd9, 0x54502fc9, 0x54503259, 0x545033e6,
+    0x54503459, 0x545041d9, 0x54504659, 0x545069d9, 0x54506e59, 0x54506ed9, 0x54507c59, 0x54507dd9,
+    0x54509191, 0x54509491, 0x54509611, 0x5450a755, 0x5450a949, 0x5450abd5, 0x5450ad55, 0x5450bb55,
+    0x5450bfd5, 0x5450c155, 0x5450d5e6, 0x5450e8a5, 0x5450eaa5, 0x5450f825, 0x5450fca5, 0x5450fe25,
+    0x54510a51, 0x54510bd1, 0x54511051, 0x54511ea5, 0x54511f45, 0x54512249, 0x545123c5, 0x545124a5,
+    0x54512525, 0x545132a5, 0x54513425, 0x545138a5, 0x54515b55, 0x54515cd5, 0x54516165, 0x545161e5,
+    0x54516f55, 0x545170d5, 0x545183d1, 0x54518566, 0x54519825, 0x545198c5, 0x54519a25, 0x54519ea6,
+    0x5451ac25, 0x5451ada5, 0x5451b226, 0x54557f22, 0x545580a2, 0x54558121, 0x54559109, 0x54559351,
+    0x54559405, 0x545594d5, 0x5455b821, 0x5455bbe1, 0x5455bd56, 0x5455bdd5, 0x5455f8a2, 0x5455faa1,
+    0x54560905, 0x54560cd1, 0x54560e51, 0x54562121, 0x545622a1, 0x54563261, 0x545633e1, 0x54563521,
+    0x545636a1, 0x54566c21, 0x545670a1, 0x54567355, 0x5456ac49, 0x5456bd11, 0x5456d2d9, 0x5456d385,
+    0x5456d759, 0x5456d8d9, 0x5456ffd1, 0x54570085, 0x54570155, 0x545723e1, 0x545724a1, 0x545726e2,
+    0x54572861, 0x545729d6, 0x54572a55, 0x54576522, 0x54576721, 0x545774d1, 0x54577951, 0x54577ad1,
+    0x54578921, 0x54578da1, 0x54578f21, 0x54579be1, 0x54579d21, 0x5457a061, 0x5457a122, 0x5457a1a1,
+    0x5457a321, 0x5457b005, 0x5457b0d5, 0x5457b316, 0x5457b485, 0x5457b555, 0x5457c685, 0x5457c8c5,
+    0x5457ca55, 0x5457cbd6, 0x5457d956, 0x5457ddd6, 0x5457ee51, 0x5457f145, 0x5457f2d1, 0x545802a1,
+    0x54580721, 0x545814a2, 0x54581546, 0x545816a1, 0x545819c6, 0x54581b21, 0x54582a51, 0x54582ed1,
+    0x54583d21, 0x54583dc5, 0x54583ea1, 0x545840c9, 0x54584245, 0x54584321, 0x545c21c9, 0x545c2415,
+    0x545c24c5, 0x545c2615, 0x545c72c9, 0x545c7511, 0x545c75c5, 0x545c7691, 0x545c99c5, 0x545c9a89,
+    0x545c9c05, 0x545cad51, 0x545caf89, 0x545cb285, 0x545cb355, 0x545cd445, 0x545cd5d5, 0x545cd685,
+    0x545cda55, 0x545cdbd6, 0x545cdc55, 0x545d1299, 0x545d14c9, 0x545d1719, 0x545d17c6, 0x545d1919,
+    0x545d26d1, 0x545d2785, 0x545d2b51, 0x545d2cd1, 0x545d3b19, 0x545d3d49, 0x545d3f99, 0x545d4045,
+    0x545d4119, 0x545d4199, 0x545d4d1a, 0x545d4dd9, 0x545d4e9a, 0x545d4f1a, 0x545d50d9, 0x545d5159,
+    0x545d5259, 0x545d539a, 0x545d551a, 0x545d8c15, 0x545d8e49, 0x545d9095, 0x545d9145, 0x545d9215,
+    0x545d9295, 0x545ddf49, 0x545de191, 0x545de245, 0x545de311, 0x545e0405, 0x545e0645, 0x545e0885,
+    0x545e19d1, 0x545e1a85, 0x545e1cc5, 0x545e1e51, 0x545e1fd6, 0x545e2e15, 0x545e3049, 0x545e3295,
+    0x545e3345, 0x545e3415, 0x545e3495, 0x545e4016, 0x545e40d5, 0x545e4196, 0x545e4216, 0x545e43d6,
+    0x545e4455, 0x545e4555, 0x545e4696, 0x545e4816, 0x545e5691, 0x545e5b11, 0x545e5bc6, 0x545e7fc6,
+    0x545e8109, 0x545e9292, 0x545e94d1, 0x545e9712, 0x545ea845, 0x545ea989, 0x5461d815, 0x54626011,
+    0x546263d1, 0x54626556, 0x546275c9, 0x546278c5, 0x54627a15, 0x546289c9, 0x5462a146, 0x5462da51,
+    0x5462dbd1, 0x5462edc5, 0x54631411, 0x54631891, 0x546329d5, 0x54632a85, 0x54632e55, 0x54632fd6,
+    0x54633055, 0x54633dd5, 0x54634255, 0x546368c9, 0x54636bc6, 0x54636d19, 0x54637a99, 0x54637cc9,
+    0x54637f19, 0x5463a119, 0x5463a1c5, 0x5463a4c9, 0x5463a549, 0x5463a645, 0x5463a799, 0x5463b51a,
+    0x5463b69a, 0x5463bb1a, 0x5463cbd1, 0x5463cc91, 0x5463d051, 0x5463d1d6, 0x5463e249, 0x5463e495,
+    0x5463e545, 0x5463e695, 0x5463f649, 0x5463f895, 0x5463fa15, 0x54640dc6, 0x54643309, 0x546443d1,
+    0x54644851, 0x54645a45, 0x54645b89, 0x54648156, 0x546485d6, 0x54649415, 0x546494c5, 0x54649615,
+    0x546497d6, 0x54649849, 0x54649945, 0x5464ae16, 0x5464bd46, 0x5464c1c6, 0x5464d3c6, 0x5464d509,
+    0x54697d11, 0x54699399, 0x5469ced9, 0x5469d359, 0x5469d4d9, 0x546a0959, 0x546a0ad9, 0x546a0f59,
+    0x546a1d59, 0x546a3285, 0x546a3589, 0x546a3705, 0x546a4855, 0x546a4905, 0x546a4cd5, 0x546a4e55,
+    0x546a5a61, 0x546a5be1, 0x546a6061, 0x546a70d1, 0x546a7551, 0x546a76d1, 0x546a8521, 0x546a89a1,
+    0x546a8b21, 0x546a9722, 0x546a9921, 0x546a9d22, 0x546a9f21, 0x546aab51, 0x546aacd1, 0x546ab151,
+    0x546abfa1, 0x546ac121, 0x546ac349, 0x546ac5a1, 0x546ad3a1, 0x546afc55, 0x546afdd5, 0x546b11d5,
+    0x546b24d1, 0x546b2651, 0x546b3aa1, 0x546b4ea1, 0x546fe485, 0x546fe799, 0x546ffa55, 0x546ffb19,
+    0x546ffed9, 0x54700059, 0x547000d9, 0x54700c55, 0x54700dd5, 0x54703b9a, 0x54703d1a, 0x54704919,
+    0x547049c5, 0x54704b19, 0x54704cd9, 0x54704d59, 0x54704f9a, 0x5470511a, 0x54705ed1, 0x54707199,
+    0x54707245, 0x54707399, 0x54707559, 0x547075d9, 0x5470851a, 0x5470859a, 0x54709c51, 0x54709d05,
+    0x5470a0d1, 0x5470a251, 0x5470b095, 0x5470b2c9, 0x5470b515, 0x5470b5c5, 0x5470b715, 0x5470c295,
+    0x5470c345, 0x5470c415, 0x5470c649, 0x5470c6c9, 0x5470c7c5, 0x5470ca95, 0x5470d911, 0x5470dd91,
+    0x5470de45, 0x5470df11, 0x54710005, 0x54710245, 0x54710389, 0x54711391, 0x54711445, 0x54711511,
+    0x54711749, 0x54711991, 0x54712ac5, 0x54715051, 0x547151d1, 0x54716545, 0x54716695, 0x54718dc5,
+    0x54718e91, 0x54766055, 0x547661d5, 0x54766659, 0x547666d9, 0x54767455, 0x547675d5, 0x54769d19,
+    0x54769dc5, 0x54769e99, 0x54769f19, 0x5476a159, 0x5476a39a, 0x5476b119, 0x5476b299, 0x5476b71a,
+    0x5476d919, 0x5476d999, 0x54770251, 0x547703d1, 0x54770851, 0x54771695, 0x54771745, 0x54771a49,
+    0x54771ac9, 0x54771bc5, 0x54771e95, 0x54772a95, 0x54772c15, 0x54773095, 0x54773fd1, 0x54774451,
+    0x54775645, 0x54775789, 0x5477ce15, 0x54788605, 0x547889d5, 0x54788b55, 0x54790049, 0x5479f365,
+    0x547a3325, 0x547a34a6, 0x547a6f25, 0x547a93d1, 0x547a9491, 0x547aaa49, 0x547aad45, 0x547aae15,
+    0x547abae1, 0x547ac095, 0x547ad6a5, 0x547afb29, 0x547b0bc5, 0x547b2199, 0x547b2245, 0x547b2619,
+    0x547b2799, 0x547b33a1, 0x547b3521, 0x547b5011, 0x547b7489, 0x547baf62, 0x547bb3e2, 0x547bb562,
+    0x547bb5e9, 0x547bd7e1, 0x547bdc69, 0x547bdde1, 0x547beaa1, 0x547beb62, 0x547bebe1, 0x547befe2,
+    0x547bf069, 0x547bfec5, 0x547c1495, 0x547c1565, 0x547c1925, 0x547c1aa5, 0x547c26a1, 0x547c2821,
+    0x547c5161, 0x547c55e6, 0x547c5766, 0x547c64e2, 0x547c6569, 0x547c69e6, 0x547c7791, 0x547c7911,
+    0x547c8fa5, 0x547c91e6, 0x547cc945, 0x547cca15, 0x547ccc49, 0x547cce95, 0x547cf2a5, 0x547cf725,
+    0x547d0605, 0x547d0925, 0x547d0a85, 0x547d0c19, 0x547d0da6, 0x547d4399, 0x547d4819, 0x547d6c11,
+    0x547d70a9, 0x547d7f85, 0x547d8289, 0x547dab25, 0x547daca9, 0x547dbde1, 0x547dbe85, 0x547dc269,
+    0x547dc3e5, 0x547dcfe2, 0x547dd162, 0x547df869, 0x547df9e1, 0x547dfe69, 0x547e3695, 0x547e3b25,
+    0x547e71e1, 0x547e7365, 0x547e77e6, 0x547eda05, 0x547edf51, 0x547eefc9, 0x547ef2c5, 0x547ef415,
+    0x547f0349, 0x547f0795, 0x547f44a6, 0x547f452a, 0x547f5449, 0x547f67c5, 0x547f6b99, 0x547f6d19,
+    0x547f6d99, 0x547f7f19, 0x547ffb69, 0x548023dd, 0x5480375d, 0x54804765, 0x54805ae5, 0x54805ea5,
+    0x54806025, 0x548060a5, 0x54807225, 0x54809b66, 0x54809ce6, 0x5480af66, 0x5480c325, 0x5480d525,
+    0x5480d5a5, 0x5480fc11, 0x5480fe49, 0x54810145, 0x54810211, 0x54812495, 0x54812545, 0x54812689,
+    0x54812915, 0x54812a95, 0x54812b15, 0x54816159, 0x548165d9, 0x54816765, 0x548167e9, 0x54817591,
+    0x54817645, 0x54817a11, 0x54817b91, 0x548189d9, 0x54818c09, 0x54818e59, 0x54818f05, 0x54818fd9,
+    0x54819059, 0x54819bd9, 0x54819c85, 0x54819d59, 0x54819dd9, 0x54819f89, 0x5481a105, 0x5481a1d9,
+    0x5481a259, 0x5481a3d9, 0x5481dad5, 0x5481e0d5, 0x5481e155, 0x548231d1, 0x54825465, 0x54826891,
+    0x54826965, 0x54826d25, 0x54826ea5, 0x54827cd5, 0x54828166, 0x548282e6, 0x54828366, 0x54828f85,
+    0x54829055, 0x548290d5, 0x548292a5, 0x54829566, 0x548296e6, 0x5482a551, 0x5482a9e6, 0x5482ab66,
+    0x5482cc45, 0x5482cde5, 0x5482cfe6, 0x5482d265, 0x5482d3e6, 0x5482d46a, 0x5482e085, 0x5482e3a5,
+    0x5482e5e6, 0x5482f665, 0x5482fae5, 0x5482fc65, 0x5482fce5, 0x54830865, 0x548309e5, 0x54830e65,
+    0x54831d45, 0x54831e11, 0x54832049, 0x54832291, 0x54833185, 0x54833315, 0x548333c5, 0x54833489,
+    0x54833795, 0x54833915, 0x54834695, 0x54834b15, 0x54834d16, 0x54835e85, 0x54836fd9, 0x54837085,
+    0x54837459, 0x548375e5, 0x548381d9, 0x54838365, 0x548383e9, 0x548385a6, 0x5483862a, 0x548387e5,
+    0x54839791, 0x54839c11, 0x5483aa59, 0x5483ab05, 0x5483abd9, 0x5483ac59, 0x5483ae09, 0x5483ae89,
+    0x5483b059, 0x5483b0d9, 0x5483d689, 0x5483e955, 0x5483ede9, 0x5483ef55, 0x5483efd5, 0x5483fcd5,
+    0x5483fd55, 0x54840169, 0x54840355, 0x54841285, 0x54841669, 0x548417e5, 0x5484284a, 0x5484676a,
+    0x548468e5, 0x54846965, 0x548474ea, 0x54847665, 0x54847aea, 0x54847ce5, 0x54848a91, 0x54848f25,
+    0x54849d55, 0x54849e05, 0x54849ed5, 0x5484a125, 0x5484a366, 0x5484b756, 0x5484c5d1, 0x5484c765,
+    0x5484cbe6, 0x5484dac5, 0x5484dc65, 0x5484df66, 0x5484e0e5, 0x5484e266, 0x5484ee65, 0x5484efe6,
+    0x5484f466, 0x5484f4ea, 0x5484f666, 0x54851865, 0x54851ce5, 0x54851d65, 0x54855759, 0x5485971a,
+    0x548598a6, 0x5485992a, 0x5485aca6, 0x5485d319, 0x5485d519, 0x54861216, 0x54868709, 0x54870366,
+    0x548762d1, 0x54877895, 0x54877955, 0x54877d1a, 0x54877e96, 0x54878c95, 0x5487b559, 0x5487b79a,
+    0x5487ba9a, 0x5487c969, 0x5487dd11, 0x5487efd9, 0x5487f085, 0x5487f159, 0x5487f1d9, 0x5487f399,
+    0x5487f519, 0x548803d9, 0x54880559, 0x548809e6, 0x54882ed5, 0x548842d5, 0x54889291, 0x5488a6c5,
+    0x5488a865, 0x5488acea, 0x5488ae65, 0x5488bc65, 0x5488d011, 0x5488e2d5, 0x5488e385, 0x5488e455,
+    0x5488e966, 0x54892045, 0x548921e5, 0x548922a5, 0x548927e6, 0x548935ea, 0x54895c65, 0x54895de5,
+    0x54897065, 0x548971e5, 0x54899a95, 0x54899f19, 0x5489ae96, 0x5489d7e9, 0x5489d9a6, 0x5489da2a,
+    0x548a5155, 0x548a5309, 0x548a53aa, 0x548a92ea, 0x548a9466, 0x548aca65, 0x548aceea, 0x548ad0e5,
+    0x548adcea, 0x548ade65, 0x548b4265, 0x548b43e6, 0x548b566a, 0x548b57e6, 0x548b7e65, 0x548b7ee5,
+    0x548b8065, 0x548cf3dd, 0x548d2b45, 0x548d2f15, 0x548d3096, 0x548da589, 0x548dcc91, 0x548dd295,
+    0x548df709, 0x548e31e2, 0x548e3662, 0x548e3869, 0x548e5a59, 0x548e5ed9, 0x548e6059, 0x548e6de2,
+    0x548e6e59, 0x548e7262, 0x548e72d9, 0x548eab62, 0x548eafe2, 0x548eb162, 0x548eb1d5, 0x548f0251,
+    0x548f39c5, 0x548f3f16, 0x548f4d55, 0x548f4f89, 0x548f51d5, 0x548f5285, 0x548f5355, 0x548f60e2,
+    0x548f6155, 0x548f6316, 0x548f64a1, 0x548f65d5, 0x548f75d1, 0x548f7a51, 0x548f9ce2, 0x548fb409,
+    0x548fb651, 0x548fc785, 0x548fcb61, 0x548fcce1, 0x548fdee1, 0x548fee95, 0x548ff315, 0x54900205,
+    0x54900515, 0x54900685, 0x54902f05, 0x54904059, 0x54904105, 0x549044d9, 0x54905262, 0x54907ad9,
+    0x54907c59, 0x549080d9, 0x5490a715, 0x5490a8a9, 0x5490b9d5, 0x5490ba85, 0x5490be69, 0x5490bfd5,
+    0x5490cd62, 0x5490cdd5, 0x5490e305, 0x5490e6e9, 0x5490f8ca, 0x54911e51, 0x549122e9, 0x549134c9,
+    0x54916dd5, 0x54916f55, 0x54917196, 0x549173d5, 0x5491ab45, 0x5491afc5, 0x5491b161, 0x5491ed61,
+    0x54923b45, 0x54923f15, 0x54924096, 0x54924115, 0x54927989, 0x54927c86, 0x54927de9, 0x54928c45,
+    0x54929191, 0x5492a209, 0x5492a505, 0x5492a5d9, 0x5492a659, 0x5492b589, 0x5492b609, 0x5492b9d9,
+    0x5492f755, 0x549347d1, 0x5493705d, 0x549370dd, 0x54937f45, 0x54938311, 0x54938496, 0x54939509,
+    0x54939755, 0x54939805, 0x549398d5, 0x5493a896, 0x5493a909, 0x5493ab55, 0x5493e85d, 0x5493ea6a,
+    0x5493f989, 0x54940d05, 0x549410dd, 0x5494125d, 0x549412dd, 0x5494245d, 0x549424dd, 0x54945d55,
+    0x54945f89, 0x549461d5, 0x54946285, 0x54946355, 0x549463d5, 0x5494b089, 0x5494b451, 0x5494d6d9,
+    0x5494d785, 0x5494db59, 0x5494dcd9, 0x5494dd59, 0x54958d29, 0x549591a9, 0x54959329, 0x549593a9,
+    0x5495a151, 0x5495a389, 0x5495a5d1, 0x5495a685, 0x5495a755, 0x5495c845, 0x5495c9d5, 0x5495ca85,
+    0x5495cbc9, 0x5495ce55, 0x5495cfd6, 0x5495d055, 0x549606a9, 0x54960b29, 0x54960bc6, 0x54960d29,
+    0x54961ad1, 0x54961b85, 0x54961f51, 0x549620d1, 0x54962f29, 0x54963149, 0x549633a9, 0x54963445,
+    0x54963529, 0x549635a9, 0x54964129, 0x549641c5, 0x549642a9, 0x54964329, 0x549644c9, 0x54964549,
+    0x54964645, 0x54964729, 0x549647a9, 0x54964929, 0x54965791, 0x54965845, 0x54965a85, 0x54965c11,
+    0x54965d96, 0x54966bd5, 0x54966e09, 0x54967055, 0x54967105, 0x549671d5, 0x54967255, 0x54967e85,
+    0x54967f55, 0x54967fd5, 0x54968196, 0x54968209, 0x549683d5, 0x54968455, 0x549698d1, 0x5496aaca,
+    0x5496bcd9, 0x5496bee9, 0x5496c159, 0x5496c36a, 0x5496cf85, 0x5496d051, 0x5496d289, 0x5496d4d1,
+    0x5496e559, 0x5496e605, 0x5496e6c9, 0x5496e9d9, 0x5496eb59, 0x5496ebd9, 0x5496f759, 0x5496f8d9,
+    0x5496fd59, 0x5496fdd9, 0x54970e85, 0x54971269, 0x549713d5, 0x5497244a, 0x54973849, 0x54974cca,
+    0x54977329, 0x549777a9, 0x549779a9, 0x549788c9, 0x54979ba9, 0x5497a029, 0x5497a1a9, 0x5497a229,
+    0x5497ada9, 0x5497ae45, 0x5497af29, 0x5497afa9, 0x5497b149, 0x5497b1c9, 0x5497b3a9, 0x5497b429,
+    0x5497b5a9, 0x5497c1d1, 0x5497c285, 0x5497c355, 0x5497c596, 0x5497c7d5, 0x5497d6c5, 0x5497d855,
+    0x5497d905, 0x5497db45, 0x5497dcd5, 0x5497de56, 0x5497ded5, 0x5497ea55, 0x5497ebd6, 0x5497f056,
+    0x5497f0d5, 0x5497f256, 0x54981529, 0x54981749, 0x549819a9, 0x54982729, 0x549827c6, 0x54982b6a,
+    0x54983cd1, 0x54984151, 0x54984fa9, 0x54985045, 0x54985129, 0x549851a9, 0x54985349, 0x549853c9,
+    0x549855a9, 0x54985629, 0x54988f45, 0x54989315, 0x54989496, 0x54989515, 0x5498cd89, 0x5498d086,
+    0x5498d1e9, 0x5498e1aa, 0x54990989, 0x54990a09, 0x54994b55, 0x5499c2ea, 0x5499c45d, 0x5499c4dd,
+    0x5499d85d, 0x5499fc96, 0x5499fd09, 0x5499ff55, 0x549a3c5d, 0x549a3e6a, 0x549a785d, 0x549a78dd,
+    0x549a7a5d, 0x549a9d11, 0x549aa191, 0x549ab155, 0x549ab389, 0x549ab685, 0x549ab7d5, 0x549ac555,
+    0x549ac789, 0x549b08ea, 0x549b2945, 0x549b2ad9, 0x549b2b85, 0x549b2f59, 0x549b30d9, 0x549b3159,
+    0x549b3ed9, 0x549b4359, 0x549b44d9, 0x549be129, 0x549be729, 0x549be7a9, 0x549bf529, 0x549bfb29,
+    0x549c0b16, 0x549c0c91, 0x549c1c45, 0x549c1dd5, 0x549c1e85, 0x549c2255, 0x549c23d6, 0x549c2455,
+    0x549c31d5, 0x549c3655, 0x549c5aa9, 0x549c5cc9, 0x549c5f29, 0x549c5fc6, 0x549c6129, 0x549c6ea9,
+    0x549c70ea, 0x549c86d1, 0x549c9529, 0x549c95c5, 0x549c96a9, 0x549c9729, 0x549c98c9, 0x549c9a45,
+    0x549c9b29, 0x549c9ba9, 0x549c9d29, 0x549ca929, 0x549caaa9, 0x549caf29, 0x549cd285, 0x549cd3d5,
+    0x549cd596, 0x549cd609, 0x549d10d9, 0x549d1559, 0x549d176a, 0x549d24ea, 0x549d4b59, 0x549d4cd9,
+    0x549d5159, 0x549d51d9, 0x549d5359, 0x549d5f59, 0x549d60d9, 0x549dc729, 0x549dcda9, 0x549ddb29,
+    0x549e01a9, 0x549e0245, 0x549e0329, 0x549e03a9, 0x549e0549, 0x549e09a9, 0x549e15a9, 0x549e1729,
+    0x549e3e55, 0x549e3fd6, 0x549e4456, 0x549e44d5, 0x549e5255, 0x549e7b29, 0x549e7bc6, 0x549e7d29,
+    0x549e7f6a, 0x549e81a9, 0x549eb929, 0x549ef859, 0x549f381a, 0x549f3999, 0x549f7419, 0x549fadc5,
+    0x549fb1aa, 0x549fb315, 0x549fefdd, 0x54a02809, 0x54a103d1, 0x54a11995, 0x54a11a59, 0x54a11e1a,
+    0x54a11f99, 0x54a15c5a, 0x54a17c91, 0x54a17e11, 0x54a19185, 0x54a19499, 0x54a1bc49, 0x54a1c02a,
+    0x54a1cfd5, 0x54a1d216, 0x54a1d516, 0x54a1e72a, 0x54a1f851, 0x54a1fa92, 0x54a1fe51, 0x54a2382a,
+    0x54a24961, 0x54a24a05, 0x54a24dea, 0x54a24f61, 0x54a25b6a, 0x54a25d61, 0x54a261ea, 0x54a27111,
+    0x54a28485, 0x54a2c2e1, 0x54a2fd61, 0x54a2fee1, 0x54a31161, 0x54a33b95, 0x54a34019, 0x54a37859,
+    0x54a37cda, 0x54a3f1d5, 0x54a3f409, 0x54a41a62, 0x54a41ee9, 0x54a430c9, 0x54a433ea, 0x54a43561,
+    0x54a46b61, 0x54a46fea, 0x54a47dea, 0x54a4e4e1, 0x54a4f76a, 0x54a4f8ea, 0x54a54c59, 0x54a55fd9,
+    0x54a56399, 0x54a56519, 0x54a56599, 0x54a57719, 0x54a5a1da, 0x54a5b22a, 0x54a5c819, 0x54a5da19,
+    0x54a5da99, 0x54a601c5, 0x54a605aa, 0x54a60711, 0x54a61789, 0x54a61a85, 0x54a62b09, 0x54a62baa,
+    0x54a643d1, 0x54a66705, 0x54a66aea, 0x54a66c5d, 0x54a66cea, 0x54a67c09, 0x54a68f85, 0x54a6936a,
+    0x54a694dd, 0x54a6955d, 0x54a6a6ea, 0x54a6a76a, 0x54a6a8dd, 0x54a76d91, 0x54a76e59, 0x54a77219,
+    0x54a77399, 0x54a793d5, 0x54a79485, 0x54a79555, 0x54a795d5, 0x54a79799, 0x54a7b05a, 0x54a7d2d9,
+    0x54a7d759, 0x54a7d8d9, 0x54a7d96a, 0x54a7e585, 0x54a7e899, 0x54a7fb59, 0x54a7ffd9, 0x54a80159,
+    0x54a801d9, 0x54a80d59, 0x54a80ed9, 0x54a81359, 0x54a823d1, 0x54a82609, 0x54a82905, 0x54a84c55,
+    0x54a84d05, 0x54a850ea, 0x54a85255, 0x54a852d5, 0x54a88929, 0x54a88f29, 0x54a89d51, 0x54a89e05,
+    0x54a8a1ea, 0x54a8a351, 0x54a8b1a9, 0x54a8b3c9, 0x54a8b829, 0x54a8c3a9, 0x54a8c445, 0x54a8c529,
+    0x54a8c5a9, 0x54a8c749, 0x54a8c7c9, 0x54a8c8ea, 0x54a8d885, 0x54a8ee55, 0x54a90055, 0x54a901d5,
+    0x54a90255, 0x54a92b29, 0x54a93d29, 0x54a93ea9, 0x54a95151, 0x54a952d1, 0x54a965a9, 0x54a96729,
+    0x54a967a9, 0x54a979a9, 0x54a97b29, 0x54a98f91, 0x54a99419, 0x54a9a305, 0x54a9a619, 0x54a9cc51,
+    0x54a9d0da, 0x54a9e159, 0x54a9e2da, 0x54a9e5d9, 0x54a9e759, 0x54a9e7ea, 0x54a9f359, 0x54a9f4d9,
+    0x54a9f959, 0x54a9f9ea, 0x54a9fb6a, 0x54aa1bd9, 0x54aa1d59, 0x54aa21d9, 0x54aa2259, 0x54aa2f59,
+    0x54aa45d1, 0x54aa4809, 0x54aa5ad5, 0x54aa5b85, 0x54aa5f6a, 0x54aa60d5, 0x54aa6155, 0x54aa72ea,
+    0x54aa74d5, 0x54aa84c9, 0x54aa97a9, 0x54aa99c9, 0x54aa9da9, 0x54aaab29, 0x54aaaba9, 0x54aaad49,
+    0x54aaadea, 0x54aaafa9, 0x54aac3ea, 0x54aad3a9, 0x54aad429, 0x54aad5c9, 0x54aad649, 0x54aae7a9,
+    0x54ab1055, 0x54ab10d5, 0x54ab2255, 0x54ab4c45, 0x54ab4d29, 0x54ab4da9, 0x54ab5f29, 0x54ab8829,
+    0x54ac7f29, 0x54ac7faa, 0x54acbb1e, 0x54acbede, 0x54acc05e, 0x54acc0de, 0x54acd46a, 0x54acfaea,
+    0x54acfb6a, 0x54acfce9, 0x54ad0eea, 0x54ade7ea, 0x54ade8a9, 0x54ade96a, 0x54adfbea, 0x54adfd6a,
+    0x54ae26da, 0x54ae279a, 0x54ae2cda, 0x54ae3aea, 0x54ae6169, 0x54ae62e9, 0x54ae7569, 0x54ae76e9,
+    0x54ae8f2a, 0x54aea116, 0x54aea4d6, 0x54aea656, 0x54aef12a, 0x54af17aa, 0x54af1869, 0x54af192a,
+    0x54af19aa, 0x54af1b69, 0x54af1cea, 0x54af2baa, 0x54af2d2a, 0x54af31aa, 0x54af55e9, 0x54af6869,
+    0x54af69e9, 0x54af912a, 0x54af92aa, 0x54afcdaa, 0x54afcf2a, 0x54b04769, 0x54b048e9, 0x54b05cea,
+    0x54b083e9, 0x54b08569, 0x54b0c6ea, 0x54b0c8e9, 0x54b0ff2a, 0x54b10169, 0x54b17869, 0x54b21c05,
+    0x54b22151, 0x54b24561, 0x54b29651, 0x54b2af19, 0x54b38965, 0x54b3a225, 0x54b3dd66, 0x54b41725,
+    0x54b44049, 0x54b44345, 0x54b44411, 0x54b466a1, 0x54b46761, 0x54b46895, 0x54b46b1a, 0x54b46ca1,
+    0x54b46d16, 0x54b4a362, 0x54b4a7e2, 0x54b4a962, 0x54b4b791, 0x54b4b845, 0x54b4bc1a, 0x54b4bd91,
+    0x54b4cbd9, 0x54b4d059, 0x54b4d1d9, 0x54b4dea1, 0x54b4df62, 0x54b4dfd9, 0x54b4e1a1, 0x54b4e31a,
+    0x54b4e3e2, 0x54b4e459, 0x54b51f0a, 0x54b522e2, 0x54b52355, 0x54b5700a, 0x54b57305, 0x54b573d1,
+    0x54b59661, 0x54b59849, 0x54b59c61, 0x54b59ce1, 0x54b5aa91, 0x54b5af25, 0x54b5b0a5, 0x54b5bed5,
+    0x54b5c366, 0x54b5c4e6, 0x54b5d1a1, 0x54b5d262, 0x54b5d2d5, 0x54b5d766, 0x54b5e751, 0x54b5ebe6,
+    0x54b5ed66, 0x54b60e62, 0x54b62285, 0x54b625a5, 0x54b627e6, 0x54b63861, 0x54b63e65, 0x54b64a61,
+    0x54b64be1, 0x54b65f45, 0x54b66011, 0x54b66249, 0x54b66499, 0x54b67385, 0x54b67689, 0x54b67b15,
+    0x54b688a1, 0x54b68d1a, 0x54b69f25, 0x54b6a099, 0x54b6b1d9, 0x54b6b285, 0x54b6b659, 0x54b6b7e5,
+    0x54b6c3e2, 0x54b6c562, 0x54b6d991, 0x54b6de1a, 0x54b6ec59, 0x54b6edd9, 0x54b6f009, 0x54b6f259,
+    0x54b71711, 0x54b717ca, 0x54b71889, 0x54b72b55, 0x54b73155, 0x54b73ee2, 0x54b753d1, 0x54b75489,
+    0x54b759e5, 0x54b76a4a, 0x54b76d46, 0x54b78f05, 0x54b7a4e1, 0x54b7aae1, 0x54b7b861, 0x54b7cb11,
+    0x54b7cc91, 0x54b7d125, 0x54b7df55, 0x54b7e0d5, 0x54b7e566, 0x54b80965, 0x54b80de6, 0x54b81cc5,
+    0x54b82166, 0x54b82466, 0x54b83061, 0x54b831e6, 0x54b858e1, 0x54b85a61, 0x54b85ee5, 0x54b8acc5,
+    0x54b8b215, 0x54b8b296, 0x54b8fdc5, 0x54b90311, 0x54b91685, 0x54b917d9, 0x54b92719, 0x54b92b5a,
+    0x54b968d5, 0x54b9e1dd, 0x54b9f0e5, 0x54ba08e6, 0x54ba0a66, 0x54ba1a25, 0x54ba1ce6, 0x54ba3166,
+    0x54ba5b66, 0x54ba6b25, 0x54ba83e5, 0x54ba8465, 0x54baced5, 0x54bad109, 0x54bad405, 0x54bad4d5,
+    0x54bad555, 0x54bb2209, 0x54bb2505, 0x54bb4859, 0x54bb4905, 0x54bb4a49, 0x54bb4cda, 0x54bb4e59,
+    0x54bb4ed9, 0x54bbfea5, 0x54bc03c5, 0x54bc04a5, 0x54bc0525, 0x54bc12d1, 0x54bc1766, 0x54bc18e6,
+    0x54bc3b55, 0x54bc3c25, 0x54bc3d66, 0x54bc3fe5, 0x54bc4165, 0x54bc41d6, 0x54bc7825, 0x54bc7ca6,
+    0x54bc7e26, 0x54bc8c51, 0x54bc8d25, 0x54bc90e5, 0x54bc9265, 0x54bca0a5, 0x54bca526, 0x54bca6a6,
+    0x54bca726, 0x54bcb2a5, 0x54bcb345, 0x54bcb425, 0x54bcb4a5, 0x54bcb665, 0x54bcb8a6, 0x54bcb926,
+    0x54bcbaa6, 0x54bcc911, 0x54bcc9c5, 0x54bcca89, 0x54bccf11, 0x54bcdd55, 0x54bce1d9, 0x54bce355,
+    0x54bcf005, 0x54bcf0d5, 0x54bcf155, 0x54bcf315, 0x54bcf396, 0x54bcf55a, 0x54bd05d1, 0x54bd0685,
+    0x54bd0a59, 0x54bd0be5, 0x54bd1c4a, 0x54bd3466, 0x54bd4105, 0x54bd4411, 0x54bd56d9, 0x54bd58c9,
+    0x54bd5cd9, 0x54bd5d59, 0x54bd6a59, 0x54bd8551, 0x54bdbe4a, 0x54bdc146, 0x54bde4a5, 0x54bdeaa5,
+    0x54bdf8d1, 0x54be0d25, 0x54be1325, 0x54be13a5, 0x54be1fc5, 0x54be20a5, 0x54be2125, 0x54be22ca,
+    0x54be234a, 0x54be2725, 0x54be3351, 0x54be3405, 0x54be34d1, 0x54be3725, 0x54be3966, 0x54be4845,
+    0x54be49d5, 0x54be4ce6, 0x54be4fe5, 0x54be5d55, 0x54be70c5, 0x54be7566, 0x54be86a5, 0x54be8b26,
+    0x54be8ca6, 0x54be98a5, 0x54be9945, 0x54be9a25, 0x54be9c66, 0x54be9ea6, 0x54beae51, 0x54bec125,
+    0x54bec1c5, 0x54bec2a5, 0x54bec325, 0x54bec4e5, 0x54bec726, 0x54bec7a6, 0x54beed51, 0x54bf0615,
+    0x54bf0696, 0x54bf7b09, 0x54bf7b89, 0x54bf7f59, 0x54c035dd, 0x54c06e25, 0x54c070e6, 0x54c0af66,
+    0x54c0e9e5, 0x54c0ea65, 0x54c10e91, 0x54c10f51, 0x54c1131a, 0x54c11491, 0x54c122d5, 0x54c12509,
+    0x54c12805, 0x54c136d5, 0x54c13916, 0x54c18691, 0x54c18991, 0x54c18b1a, 0x54c19ac5, 0x54c19c59,
+    0x54c19d05, 0x54c1a0da, 0x54c1a259, 0x54c1b059, 0x54c1b4da, 0x54c1b659, 0x54c1c70a, 0x54c1f3d6,
+    0x54c23e51, 0x54c24451, 0x54c252a5, 0x54c258a5, 0x54c25925, 0x54c266a5, 0x54c26ca5, 0x54c27991,
+    0x54c28dc5, 0x54c28f55, 0x54c29025, 0x54c293e5, 0x54c29565, 0x54c2a356, 0x54c2a956, 0x54c2cc25,
+    0x54c2d0a6, 0x54c2f251, 0x54c2f3d1, 0x54c306a5, 0x54c30745, 0x54c30825, 0x54c308a5, 0x54c30a65,
+    0x54c30ca6, 0x54c30d26, 0x54c30ea6, 0x54c31aa5, 0x54c31c25, 0x54c320a6, 0x54c33091, 0x54c3351a,
+    0x54c34405, 0x54c34555, 0x54c34709, 0x54c34796, 0x54c38866, 0x54c3be59, 0x54c3c2da, 0x54c3c35a,
+    0x54c3d259, 0x54c3fbd5, 0x54c40256, 0x54c438a5, 0x54c46051, 0x54c474a5, 0x54c47525, 0x54c4774a,
+    0x54c47b25, 0x54c488a5, 0x54c4afd5, 0x54c4b155, 0x54c4b5e5, 0x54c4c556, 0x54c4d851, 0x54c4eca5,
+    0x54c4ed45, 0x54c52aa5, 0x54c57d61, 0x54c5be86, 0x54c5ce45, 0x54c5d391, 0x54c5e7d9, 0x54c5f7a1,
+    0x54c6c145, 0x54c6c696, 0x54c6d955, 0x54c6ea96, 0x54c701d1, 0x54c70286, 0x54c72686, 0x54c73b91,
+    0x54c7545d, 0x54c79f62, 0x54c7a3e2, 0x54c7a562, 0x54c7a5d5, 0x54c7f289, 0x54c7f585, 0x54c7f651,
+    0x54c818e1, 0x54c819a1, 0x54c81ac9, 0x54c81d5a, 0x54c81ee1, 0x54c81f59, 0x54c8cf22, 0x54c8d522,
+    0x54c8d5a1, 0x54c8e351, 0x54c8e589, 0x54c8e7d1, 0x54c8e885, 0x54c8e955, 0x54c90a62, 0x54c90be1,
+    0x54c90ca1, 0x54c91061, 0x54c911d6, 0x54c91256, 0x54c948a2, 0x54c94d22, 0x54c94dc6, 0x54c95cd1,
+    0x54c95d85, 0x54c96151, 0x54c962d1, 0x54c97121, 0x54c975a1, 0x54c97721, 0x54c983e1, 0x54c984a2,
+    0x54c98521, 0x54c986e1, 0x54c98861, 0x54c98922, 0x54c989a1, 0x54c98b21, 0x54c99b15, 0x54c99c99,
+    0x54c9add5, 0x54c9b259, 0x54c9b3d5, 0x54c9c0a1, 0x54c9c162, 0x54c9d651, 0x54c9d705, 0x54c9dad9,
+    0x54c9ecca, 0x54c9ff86, 0x54ca1191, 0x54ca1252, 0x54ca1489, 0x54ca16d9, 0x54ca2759, 0x54ca28c9,
+    0x54ca2d59, 0x54ca3f5a, 0x54ca5089, 0x54ca5505, 0x54ca55d5, 0x54ca664a, 0x54ca6946, 0x54ca7861,
+    0x54ca7e56, 0x54ca7ed6, 0x54ca8eca, 0x54ca91c6, 0x54cab522, 0x54caba46, 0x54cac951, 0x54cacac9,
+    0x54cacf51, 0x54cadda1, 0x54cae3a1, 0x54caf061, 0x54caf122, 0x54caf1a1, 0x54caf7a1, 0x54cb0485,
+    0x54cb0555, 0x54cb0796, 0x54cb09d5, 0x54cb18c5, 0x54cb1d45, 0x54cb2056, 0x54cb2dd6, 0x54cb3256,
+    0x54cb4145, 0x54cb42d1, 0x54cb4386, 0x54cb45c5, 0x54cb5721, 0x54cb5ba1, 0x54cb6922, 0x54cb69c6,
+    0x54cb7ed1, 0x54cb8351, 0x54cb91a1, 0x54cb9245, 0x54cb9321, 0x54cb9549, 0x54cb97a1, 0x54cbe709,
+    0x54cbe959, 0x54cbea05, 0x54cbeb55, 0x54cc3bd1, 0x54cc5f05, 0x54cc5fc9, 0x54cc62da, 0x54cc6459,
+    0x54cc64d9, 0x54cc9d4a, 0x54cca046, 0x54cd16ca, 0x54cd1a9d, 0x54cd1b1d, 0x54cd2b09, 0x54cd2d51,
+    0x54cd2e05, 0x54cd5205, 0x54cd5445, 0x54cd55d5, 0x54cd5756, 0x54cd57d6, 0x54cd9049, 0x54cd929d,
+    0x54cd9346, 0x54cda305, 0x54cda6d1, 0x54cda851, 0x54cdb8c9, 0x54cdbb1d, 0x54cdbbc5, 0x54cdbc9d,
+    0x54cdbd1d, 0x54cdcc5d, 0x54cdce9e, 0x54cdcf1e, 0x54cdd09e, 0x54ce8119, 0x54ce8349, 0x54ce8599,
+    0x54ce8645, 0x54ce8719, 0x54ce8799, 0x54cf7415, 0x54cf7649, 0x54cf7895, 0x54cf7945, 0x54cf7a15,
+    0x54cf7a95, 0x54cfc511, 0x54cfc749, 0x54cfc991, 0x54cfca45, 0x54cfcb11, 0x54cfec05, 0x54cfee45,
+    0x54cfef89, 0x54d001d1, 0x54d00409, 0x54d00659, 0x54d00705, 0x54d007d5, 0x54d028c5, 0x54d02a55,
+    0x54d02b05, 0x54d02c55, 0x54d02eda, 0x54d03056, 0x54d030d6, 0x54d040ca, 0x54d06719, 0x54d06949,
+    0x54d06b99, 0x54d06c46, 0x54d07b51, 0x54d07c05, 0x54d07cc9, 0x54d07fda, 0x54d08151, 0x54d08f99,
+    0x54d091c9, 0x54d09419, 0x54d094c5, 0x54d09599, 0x54d09619, 0x54d0a19a, 0x54d0a259, 0x54d0a31a,
+    0x54d0a39a, 0x54d0a559, 0x54d0a5d9, 0x54d0a79a, 0x54d0a81a, 0x54d0a99a, 0x54d0ba4a, 0x54d0bd46,
+    0x54d0e095, 0x54d0e2ca, 0x54d0e695, 0x54d0e715, 0x54d133ca, 0x54d136c5, 0x54d13791, 0x54d15aca,
+    0x54d15c09, 0x54d16e51, 0x54d16f05, 0x54d17145, 0x54d172d1, 0x54d17456, 0x54d18295, 0x54d184c9,
+    0x54d18715, 0x54d187c5, 0x54d18895, 0x54d19496, 0x54d19555, 0x54d19616, 0x54d19856, 0x54d198d6,
+    0x54d19a96, 0x54d19b16, 0x54d1ab11, 0x54d1af91, 0x54d1b046, 0x54d1d446, 0x54d1e712, 0x54d1e951,
+    0x54d1eb92, 0x54d1fa85, 0x54d1fcc5, 0x54d1fd89, 0x54d1fe09, 0x54d1ff05, 0x54d22551, 0x54d23b09,
+    0x54d23e05, 0x54d23f55, 0x54d24f16, 0x54d26686, 0x54d29f91, 0x54d2b305, 0x54d2b6da, 0x54d2b859,
+    0x54d2b8d9, 0x54d2cada, 0x54d2cc59, 0x54d2dd0a, 0x54d309d6, 0x54d36aca, 0x54d36f1d, 0x54d37eca,
+    0x54d39296, 0x54d3a605, 0x54d3a9d5, 0x54d3ab56, 0x54d3abd6, 0x54d3ce86, 0x54d3e449, 0x54d3e746,
+    0x54d42049, 0x54d420c9, 0x54d4231d, 0x54d4249d, 0x54d4c0d1, 0x54d4c191, 0x54d4c55a, 0x54d4c6d1,
+    0x54d4d519, 0x54d4d749, 0x54d4da45, 0x54d4db99, 0x54d4e919, 0x54d4eb49, 0x54d5794a, 0x54d5b3d1,
+    0x54d5b491, 0x54d5b851, 0x54d5b9d6, 0x54d5c815, 0x54d5ca49, 0x54d5cd45, 0x54d5ce95, 0x54d5dc15,
+    0x54d5de56, 0x54d5f092, 0x54d5f5c6, 0x54d62bd1, 0x54d62ed1, 0x54d63051, 0x54d64005, 0x54d64245,
+    0x54d66891, 0x54d67e55, 0x54d67f05, 0x54d682da, 0x54d68456, 0x54d684d6, 0x54d69256, 0x54d6a786,
+    0x54d6bd49, 0x54d6c046, 0x54d6e75a, 0x54d6f645, 0x54d6f799, 0x54d6f949, 0x54d6f9c9, 0x54d6fc19,
+    0x54d6fd99, 0x54d72051, 0x54d72656, 0x54d736ca, 0x54d73b15, 0x54d76246, 0x54d79851, 0x54d7aeca,
+    0x54d7b009, 0x54d7d5d6, 0x54d7da56, 0x54d7e945, 0x54d7ea95, 0x54d7ec56, 0x54d7ecd6, 0x54d7ef15,
+    0x54d811c6, 0x54d82846, 0x54d88e59, 0x54d8a719, 0x54d8e3da, 0x54d91c19, 0x54d943ca, 0x54d94911,
+    0x54d96d0a, 0x54d985d1, 0x54d9be0a, 0x54d9d6dd, 0x54daaf91, 0x54dab41a, 0x54dab599, 0x54dad6a1,
+    0x54daf25a, 0x54db2785, 0x54db2a99, 0x54db3d59, 0x54db4359, 0x54db4f5a, 0x54db50e1, 0x54db65d1,
+    0x54db680a, 0x54db6b05, 0x54db8e61, 0x54db8f0a, 0x54db9461, 0x54db94d6, 0x54dbcb22, 0x54dbcd4a,
+    0x54dbd122, 0x54dbdf51, 0x54dbe00a, 0x54dbe551, 0x54dbf3a1, 0x54dbf9a1, 0x54dc0661, 0x54dc0722,
+    0x54dc07a1, 0x54dc094a, 0x54dc1a85, 0x54dc3055, 0x54dc4261, 0x54dc43e1, 0x54dc58d1, 0x54dc6d21,
+    0x54dc80a2, 0x54dc9351, 0x54dc94d1, 0x54dca921, 0x54dcd191, 0x54dcd61a, 0x54dd0e51, 0x54dd12da,
+    0x54dd24da, 0x54dd2959, 0x54dd5f59, 0x54dd63da, 0x54dd8705, 0x54dd87d1, 0x54dd8a0a, 0x54dd9cd5,
+    0x54dda2d5, 0x54ddb061, 0x54ddc3c5, 0x54ddc551, 0x54ddc6c9, 0x54ddd9a1, 0x54dddfa1, 0x54dded22,
+    0x54de0151, 0x54de15a1, 0x54de17ca, 0x54de29a1, 0x54de50d5, 0x54de5255, 0x54de7951, 0x54de8da1,
+    0x54de8f21, 0x54dea122, 0x54def5d9, 0x54defb19, 0x54df1f19, 0x54df37da, 0x54df5b19, 0x54df6059,
+    0x54df7019, 0x54df8399, 0x54df88d9, 0x54df8959, 0x54dfad8a, 0x54dfb085, 0x54dfd48a, 0x54dfd9d5,
+    0x54dfda56, 0x54e012ca, 0x54e015c5, 0x54e0169d, 0x54e0258a, 0x54e02ad1, 0x54e03b4a, 0x54e03e45,
+    0x54e03f9d, 0x54e04eca, 0x54e04f4a, 0x54e0531d, 0x54e117d1, 0x54e13ec5, 0x54e14055, 0x54e14119,
+    0x54e144da, 0x54e14659, 0x54e146d6, 0x54e17d19, 0x54e1831a, 0x54e19151, 0x54e19219, 0x54e195da,
+    0x54e19759, 0x54e1a599, 0x54e1ac1a, 0x54e1b799, 0x54e1b845, 0x54e1b919, 0x54e1b999, 0x54e1bb59,
+    0x54e1bf9a, 0x54e1f695, 0x54e1f8ca, 0x54e1fbc5, 0x54e24791, 0x54e249ca, 0x54e24cc5, 0x54e24d91,
+    0x54e26e85, 0x54e270ca, 0x54e28451, 0x54e29895, 0x54e2aa95, 0x54e2ab45, 0x54e2c111, 0x54e2fc45,
+    0x54e2fd11, 0x54e33905, 0x54e33c19, 0x54e34ed5, 0x54e34f99, 0x54e354d9, 0x54e360da, 0x54e36255,
+    0x54e378da, 0x54e3919a, 0x54e39d99, 0x54e39e45, 0x54e39f19, 0x54e3a159, 0x54e3a39a, 0x54e3b351,
+    0x54e3c6c5, 0x54e3c819, 0x54e3c9d9, 0x54e3ca59, 0x54e3f0d1, 0x54e3f18a, 0x54e3f6d1, 0x54e40515,
+    0x54e4074a, 0x54e40a45, 0x54e417c5, 0x54e41895, 0x54e41915, 0x54e41aca, 0x54e41b4a, 0x54e42d91,
+    0x54e432c5, 0x54e43391, 0x54e44706, 0x54e45485, 0x54e456ca, 0x54e468c5, 0x54e46991, 0x54e46bca,
+    0x54e47f4a, 0x54e4a4d1, 0x54e4a651, 0x54e4b9c5, 0x54e4e191, 0x54e4e245, 0x54e4e311, 0x54e4f685,
+    0x54e57319, 0x54e57396, 0x54e5af1a, 0x54e5b459, 0x54e5eeda, 0x54e5ef5a, 0x54e5f0d9, 0x54e6150a,
+    0x54e6288a, 0x54e62dd5, 0x54e62e56, 0x54e641d6, 0x54e666ca, 0x54e669de, 0x54e6a2ca, 0x54e6a34a,
+    0x54e6a71d, 0x54e77e91, 0x54e79455, 0x54e7951a, 0x54e798da, 0x54e79a59, 0x54e7a856, 0x54e7ae56,
+    0x54e7be52, 0x54e7d65a, 0x54e7f75a, 0x54e7f8d1, 0x54e80b99, 0x54e80c45, 0x54e80d19, 0x54e80d99,
+    0x54e80f59, 0x54e8139a, 0x54e81f99, 0x54e82119, 0x54e8259a, 0x54e83651, 0x54e8370a, 0x54e83c51,
+    0x54e84cca, 0x54e84fd6, 0x54e85e95, 0x54e87852, 0x54e8ae51, 0x54e8b14a, 0x54e8c285, 0x54e8c4ca,
+    0x54e8ea51, 0x54e8ebd1, 0x54e8fe95, 0x54e8ff45, 0x54e927d1, 0x54e9b655, 0x54e9bada, 0x54e9c8d6,
+    0x54e9ca56, 0x54e9f245, 0x54ea5851, 0x54ea6eca, 0x54ea6f4a, 0x54ea9451, 0x54ea9512, 0x54eaa885,
+    0x54eaaaca, 0x54eb4912, 0x54ebdb59, 0x54ec1b19, 0x54ec1ca6, 0x54ec5719, 0x54ec9616, 0x54ecd15d,
+    0x54ed0b09, 0x54ede6d1, 0x54edfc95, 0x54edfd55, 0x54ee0115, 0x54ee0296, 0x54ee3b9a, 0x54ee3e9a,
+    0x54ee51e6, 0x54ee5f91, 0x54ee6111, 0x54ee7485, 0x54ee7799, 0x54ee9e91, 0x54ee9f51, 0x54eea311,
+    0x54eea496, 0x54eeb516, 0x54eeb755, 0x54eeb816, 0x54eedfd1, 0x54ef05c9, 0x54ef09e6, 0x54ef1691,
+    0x54ef1b11, 0x54ef2c61, 0x54ef2d05, 0x54ef30e1, 0x54ef3261, 0x54ef5291, 0x54ef5411, 0x54ef6785,
+    0x54ef6855, 0x54ef6ce6, 0x54ef90e5, 0x54ef9566, 0x54efa5e1, 0x54efa6a5, 0x54efa8e6, 0x54efaa65,
+    0x54efabe6, 0x54efb966, 0x54efe061, 0x54efe1e1, 0x54eff5e1, 0x54f01e95, 0x54f02319, 0x54f0d709,
+    0x54f0d955, 0x54f101e5, 0x54f11545, 0x54f116e1, 0x54f11866, 0x54f14e61, 0x54f152e1, 0x54f166e1,
+    0x54f188d5, 0x54f1b165, 0x54f1c7e6, 0x54f1d9e6, 0x54f1dbe6, 0x54f22f49, 0x54f242c5, 0x54f24695,
+    0x54f24815, 0x54f25a15, 0x54f25c15, 0x54f28359, 0x54f294a6, 0x54f29509, 0x54f29759, 0x54f298e5,
+    0x54f2ab11, 0x54f2bd09, 0x54f2fcd5, 0x54f310d5, 0x54f31255, 0x54f32551, 0x54f3765d, 0x54f377dd,
+    0x54f3785d, 0x54f389dd, 0x54f39e25, 0x54f3b025, 0x54f3efe5, 0x54f3f166, 0x54f40366, 0x54f403e5,
+    0x54f40566, 0x54f42be5, 0x54f45091, 0x54f45145, 0x54f45511, 0x54f45691, 0x54f46709, 0x54f46955,
+    0x54f46a05, 0x54f47785, 0x54f47a89, 0x54f47d55, 0x54f47ed5, 0x54f4b5d9, 0x54f4b7c9, 0x54f4ba59,
+    0x54f4bbe6, 0x54f4bc59, 0x54f4c885, 0x54f4cb89, 0x54f4de59, 0x54f4e2d9, 0x54f4e459, 0x54f4e4d9,
+    0x54f4f059, 0x54f4f1d9, 0x54f4f659, 0x54f50909, 0x54f50b51, 0x54f50c05, 0x54f52f55, 0x54f533d5,
+    0x54f53555, 0x54f535d5, 0x54f570a5, 0x54f572a5, 0x54f58051, 0x54f584d1, 0x54f58651, 0x54f596c9,
+    0x54f59925, 0x54f59aa5, 0x54f59b25, 0x54f5a6a5, 0x54f5a745, 0x54f5aca5, 0x54f5ad25, 0x54f5aea5,
+    0x54f5bb85, 0x54f5bc51, 0x54f5bea5, 0x54f5c0e6, 0x54f5d155, 0x54f5d5e5, 0x54f5d765, 0x54f5e355,
+    0x54f5e4d5, 0x54f5e965, 0x54f5fce6, 0x54f60e25, 0x54f612a6, 0x54f61426, 0x54f62025, 0x54f621a5,
+    0x54f62225, 0x54f626a6, 0x54f62826, 0x54f63451, 0x54f635d1, 0x54f63a65, 0x54f648a5, 0x54f64a25,
+    0x54f64aa5, 0x54f64ea6, 0x54f65ca5, 0x54f67291, 0x54f67711, 0x54f68605, 0x54f686d5, 0x54f68909,
+    0x54f68b55, 0x54f69ad5, 0x54f6c2c5, 0x54f6c459, 0x54f6c5e5, 0x54f6c745, 0x54f6c8d9, 0x54f6ca66,
+    0x54f6d659, 0x54f6d7e6, 0x54f6dc66, 0x54f6dcd9, 0x54f6de66, 0x54f70059, 0x54f704d9, 0x54f712d9,
+    0x54f71459, 0x54f72d51, 0x54f73c45, 0x54f73f49, 0x54f740c5, 0x54f757d5, 0x54f76945, 0x54f77aa5,
+    0x54f77f25, 0x54f780a5, 0x54f78ea5, 0x54f792a5, 0x54f79325, 0x54f794a5, 0x54f7b525, 0x54f7b6a5,
+    0x54f7bb25, 0x54f7caa5, 0x54f7f355, 0x54f7f7e5, 0x54f80555, 0x54f805d5, 0x54f80755, 0x54f82ea5,
+    0x54f83025, 0x54f834a6, 0x54f84425, 0x54f86aa5, 0x54f96225, 0x54f9a1de, 0x54f9a35e, 0x54f9dde5,
+    0x54f9dfe5, 0x54facba5, 0x54fb09da, 0x54fb0a9a, 0x54fb0e5a, 0x54fb0fda, 0x54fb1de5, 0x54fb4465,
+    0x54fb45e5, 0x54fb5865, 0x54fb59e5, 0x54fb8356, 0x54fb8416, 0x54fb87d6, 0x54fbb1d2, 0x54fbd426,
+    0x54fbfaa6, 0x54fbfb65, 0x54fbfe65, 0x54fbffe5, 0x54fc0ea6, 0x54fc1026, 0x54fc14a6, 0x54fc3765,
+    0x54fc38e5, 0x54fc4b65, 0x54fc4ce5, 0x54fc7426, 0x54fc7626, 0x54fc8826, 0x54fc89a6, 0x54fd2a65,
+    0x54fd2be6, 0x54fd3e65, 0x54fd3fe6, 0x54fda9e5, 0x54fdabe5, 0x54fde2a6, 0x54ffcd55, 0x55008096,
+    0x5500c05d, 0x5500fc5d, 0x55012111, 0x55014821, 0x55018849, 0x55019905, 0x5501aed9, 0x5501c0e1,
+    0x5501c261, 0x5501d989, 0x5501dbd1, 0x5501dc85, 0x5501ffe1, 0x550200a1, 0x55020461, 0x550205d6,
+    0x55020655, 0x55024122, 0x55024321, 0x550250d1, 0x55025551, 0x550256d1, 0x550269a1, 0x55026b21,
+    0x550277e1, 0x55027c61, 0x55027d22, 0x55027da1, 0x55027f21, 0x55028c05, 0x55028cd5, 0x55028f16,
+    0x55029085, 0x55029155, 0x5502a1d5, 0x5502a285, 0x5502a655, 0x5502a7d6, 0x5502b3e1, 0x5502b556,
+    0x5502b9d6, 0x5502ca51, 0x5502cd45, 0x5502ced1, 0x5502dea1, 0x5502e0c9, 0x5502e321, 0x5502e3c6,
+    0x5502f0a2, 0x5502f2a1, 0x5502f721, 0x550304d1, 0x55030651, 0x55030ad1, 0x55031921, 0x55031aa1,
+    0x55031cc9, 0x55031f21, 0x55032d21, 0x5503f885, 0x5503fdd5, 0x55041145, 0x55042061, 0x550421d6,
+    0x550436d1, 0x550439c5, 0x55044fa1, 0x55045d22, 0x55045f21, 0x550463a1, 0x55047151, 0x550472d1,
+    0x550485a1, 0x55048721, 0x55048ba1, 0x550499a1, 0x5504c856, 0x5504ff21, 0x55053b21, 0x55056745,
+    0x55056c96, 0x55057d09, 0x55057f55, 0x55058005, 0x55059096, 0x55059109, 0x55059355, 0x550594d5,
+    0x5505cc86, 0x5505d059, 0x5505d259, 0x5505e189, 0x5505f505, 0x5505f8d9, 0x5505fa59, 0x5505fad9,
+    0x55060c59, 0x55060cd9, 0x55060e59, 0x55062151, 0x55068449, 0x5506869d, 0x5506889d, 0x5506acc9,
+    0x5506af1d, 0x5506c049, 0x5506c0c9, 0x5506c31d, 0x5506c49d, 0x5506d496, 0x5506e805, 0x5506ebd5,
+    0x5506ed56, 0x5506ff56, 0x5506ffd5, 0x55070156, 0x55072649, 0x5507289d, 0x55072946, 0x55073a49,
+    0x55073c9d, 0x55075051, 0x55076249, 0x550762c9, 0x55078951, 0x55078b89, 0x55078e85, 0x5507b045,
+    0x5507b1d5, 0x5507b285, 0x5507b655, 0x5507b7d6, 0x5507b855, 0x5507ee99, 0x5507f0c9, 0x5507f3c6,
+    0x5507f519, 0x550802d1, 0x55080385, 0x55080751, 0x550808d1, 0x55081719, 0x55081949, 0x55081b99,
+    0x55081c45, 0x55081d99, 0x55082919, 0x550829c5, 0x55082a99, 0x55082b19, 0x55082cc9, 0x55082d49,
+    0x55082f99, 0x55083119, 0x55086815, 0x55086a49, 0x55086c95, 0x55086d45, 0x55086e95, 0x5508bb49,
+    0x5508bd91, 0x5508be45, 0x5508bf11, 0x5508e245, 0x5508f5d1, 0x5508f685, 0x5508fa51, 0x5508fbd6,
+    0x55090a15, 0x55090c49, 0x55090e95, 0x55090f45, 0x55091015, 0x55091c15, 0x55091cc5, 0x55091d95,
+    0x55091e15, 0x55091fd6, 0x55092049, 0x55092145, 0x55092295, 0x55092415, 0x55093291, 0x55093711,
+    0x550937c6, 0x55095985, 0x55095bc6, 0x55095d09, 0x55096dc5, 0x55096e91, 0x550970c9, 0x55097311,
+    0x55098445, 0x5509aa85, 0x5509ad96, 0x5509bec5, 0x5509c055, 0x5509c105, 0x5509c1d5, 0x5509c345,
+    0x5509c4d5, 0x5509c656, 0x5509d255, 0x5509d3d6, 0x5509d8d5, 0x5509da56, 0x5509fd19, 0x5509ff49,
+    0x550a0199, 0x550a0246, 0x550a0fc6, 0x550a1119, 0x550a1349, 0x550a1599, 0x550a24d1, 0x550a2951,
+    0x550a3845, 0x550a3919, 0x550a3b49, 0x550a3d99, 0x550a4d1a, 0x550a6251, 0x550a6305, 0x550a6545,
+    0x550a66d1, 0x550a6856, 0x550a7695, 0x550a78c9, 0x550a7b15, 0x550a7bc5, 0x550a7c95, 0x550a8895,
+    0x550a8945, 0x550a8a15, 0x550a8a95, 0x550a8c56, 0x550a8cc9, 0x550a8e95, 0x550a8f15, 0x550a9095,
+    0x550aa391, 0x550aa446, 0x550ac846, 0x550ac989, 0x550ada45, 0x550adb11, 0x550add49, 0x550adf91,
+    0x550af0c5, 0x550af189, 0x550b1651, 0x550b17d6, 0x550b1c56, 0x550b2a95, 0x550b2b45, 0x550b2c15,
+    0x550b2e56, 0x550b3095, 0x550b4016, 0x550b5311, 0x550b53c6, 0x550b6805, 0x550b6a46, 0x550b6c85,
+    0x550b8f12, 0x550be496, 0x550be509, 0x550c2086, 0x550c2459, 0x550c2659, 0x550c3859, 0x550c6059,
+    0x550c60d9, 0x550c6259, 0x550c9f56, 0x550cd85e, 0x550cdc9d, 0x550cec49, 0x550d1449, 0x550d14c9,
+    0x550d53d5, 0x550d5556, 0x550d8e49, 0x550df011, 0x550e05d5, 0x550e0696, 0x550e0a55, 0x550e0bd6,
+    0x550e0c55, 0x550e19d5, 0x550e1e55, 0x550e44da, 0x550e47c6, 0x550e4919, 0x550e5699, 0x550e58c9,
+    0x550e68d1, 0x550e6a51, 0x550e7d19, 0x550e7dc5, 0x550e80c9, 0x550e8149, 0x550e8245, 0x550e9119,
+    0x550ea7d1, 0x550ea891, 0x550eac51, 0x550eadd6, 0x550ebe56, 0x550ec156, 0x550ed015, 0x550ed249,
+    0x550ee9c6, 0x550f0f09, 0x550f1fd1, 0x550f2451, 0x550f3405, 0x550f3645, 0x550f5bd1, 0x550f5d56,
+    0x550f61d6, 0x550f7015, 0x550f70c5, 0x550f73d6, 0x550f7449, 0x550f7545, 0x550f7815, 0x550f9946,
+    0x550f9dc6, 0x550fafc6, 0x550fb109, 0x55102655, 0x551027d6, 0x55102cd5, 0x55103a55, 0x55103bd6,
+    0x551063c6, 0x55106519, 0x55106749, 0x55106999, 0x55107719, 0x55109f99, 0x5510a119, 0x5510c851,
+    0x5510c9d6, 0x5510dc95, 0x5510dd45, 0x5510de95, 0x5510e056, 0x5510e0c9, 0x5510e495, 0x551105c6,
+    0x55111d89, 0x55119415, 0x55130321, 0x551342de, 0x5513445e, 0x55137ee1, 0x55146ca1, 0x5514aada,
+    0x5514ab9a, 0x5514af5a, 0x5514b0da, 0x5514e561, 0x5514e6e1, 0x55151321, 0x55152456, 0x55152516,
+    0x551528d6, 0x55152a56, 0x551552d2, 0x551579a2, 0x55157b22, 0x55159c61, 0x55159f61, 0x5515a0e1,
+    0x5515d861, 0x5515d9e1, 0x551616a2, 0x5516cce1, 0x55174ae1, 0x551787a2, 0x5518a319, 0x5518b519,
+    0x5518f119, 0x5518f4d9, 0x5518f659, 0x55190859, 0x551908d9, 0x55190a59, 0x551930d9, 0x55195709,
+    0x55196a85, 0x55196e55, 0x55196fd5, 0x551981d5, 0x551983d5, 0x5519a8de, 0x5519abde, 0x5519ac9d,
+    0x5519bc49, 0x5519bcc9, 0x5519c09d, 0x5519d2d1, 0x5519e4c9, 0x5519e549, 0x551ac085, 0x551ac399,
+    0x551ad655, 0x551ad719, 0x551adad9, 0x551adc59, 0x551ae855, 0x551ae9d5, 0x551aee59, 0x551b155a,
+    0x551b185a, 0x551b191a, 0x551b2519, 0x551b25c5, 0x551b2719, 0x551b2b9a, 0x551b2d1a, 0x551b3951,
+    0x551b3ad1, 0x551b3f59, 0x551b4d99, 0x551b4e45, 0x551b6199, 0x551b7851, 0x551b7905, 0x551b7cd1,
+    0x551b7e51, 0x551b8c95, 0x551b8ed6, 0x551b91d6, 0x551b9e95, 0x551b9f45, 0x551ba249, 0x551ba2c9,
+    0x551ba3c5, 0x551ba695, 0x551bb511, 0x551bba52, 0x551bde45, 0x551bf045, 0x551bf349, 0x551bf4c5,
+    0x551c06c5, 0x551c2c51, 0x551c2dd1, 0x551c4145, 0x551c69c5, 0x551c6a91, 0x551cf855, 0x551cfcd9,
+    0x551d0ad5, 0x551d0c55, 0x551d3445, 0x551d399a, 0x551d4799, 0x551d4919, 0x551d98d1, 0x551d9ed1,
+    0x551dad15, 0x551dadc5, 0x551dae95, 0x551db0c9, 0x551dc115, 0x551dc295, 0x551dd591, 0x551dd645,
+    0x551dd711, 0x551ddb91, 0x551dea85, 0x551decc5, 0x551ded89, 0x57e43f95, 0x57e44126, 0x57e441c5,
+    0x57e44289, 0x57e44316, 0x57e44415, 0x57e445aa, 0x57e44715, 0x57e447aa, 0x57e47dd9, 0x57e47e85,
+    0x57e48259, 0x57e483d9, 0x57e4b85a, 0x57e4b9da, 0x57e4ba5a, 0x57e4bc19, 0x57e4bd99, 0x57e4be5a,
+    0x57e4beda, 0x57e4f805, 0x57e4fbe9, 0x57e4fd55, 0x57e4fdd5, 0x57e5364a, 0x57e53946, 0x57e56f65,
+    0x57e571aa, 0x57e57249, 0x57e572e6, 0x57e573e9, 0x57e5756a, 0x57e576e5, 0x57e5ab56, 0x57e5acd6,
+    0x57e5ad56, 0x57e5af15, 0x57e5b095, 0x57e5b156, 0x57e5b1d6, 0x57e5e8c5, 0x57e5eb05, 0x57e5ec69,
+    0x57e5ed45, 0x57e5eee5, 0x57e5f065, 0x57ea7f45, 0x57ea8011, 0x57ea83c5, 0x57ea9515, 0x57ea95c5,
+    0x57ea9709, 0x57ea9995, 0x57ea9b15, 0x57ea9b95, 0x57eaad15, 0x57ead1d9, 0x57ead659, 0x57ead7d9,
+    0x57ead869, 0x57eae5e9, 0x57eae82a, 0x57eae9d9, 0x57eaf991, 0x57eafe11, 0x57eb0dd9, 0x57eb0e66,
+    0x57eb1009, 0x57eb10a5, 0x57eb1185, 0x57eb1259, 0x57eb12e6, 0x57eb3726, 0x57eb3baa, 0x57eb3d11,
+    0x57eb4b65, 0x57eb4fe9, 0x57eb5155, 0x57eb51d5, 0x57eb5e26, 0x57eb5ee5, 0x57eb5f65, 0x57eb61aa,
+    0x57eb62aa, 0x57eb6555, 0x57eb73e5, 0x57eb9ae5, 0x57eb9dc9, 0x57ebae66, 0x57ebaf26, 0x57ebafe5,
+    0x57ebb3aa, 0x57ebc365, 0x57ebc6e6, 0x57ebc96a, 0x57ebcae5, 0x57ebd6e6, 0x57ebd866, 0x57ebd8e6,
+    0x57ebdcea, 0x57ebdee5, 0x57ebec91, 0x57ebf111, 0x57ebff55, 0x57ec0005, 0x57ec00d5, 0x57ec0155,
+    0x57ec0309, 0x57ec0389, 0x57ec0485, 0x57ec0555, 0x57ec05d5, 0x57ec3e65, 0x57ec4069, 0x57ec42e5,
+    0x57ec4465, 0x57ec44ea, 0x57ec5065, 0x57ec51e5, 0x57ec5665, 0x57ec586a, 0x57ec7a65, 0x57ec7ee5,
+    0x57ec7f65, 0x57ec80e5, 0x57f77c2a, 0x57f77f2a, 0x57f77fe9, 0x57f7b8ca, 0x57f7f4da, 0x57f7f55a,
+    0x57f7f65a, 0x57f7f7ea, 0x57f7f96a, 0x57f7f9ea, 0x57f8324a, 0x57f83546, 0x57f8abea, 0x57f8aeea,
+    0x57f8afa9, 0x57f8b029, 0x57f8e4d6, 0x57f8e66a, 0x57f8e856, 0x57f8e956, 0x57f92329, 0x57f9256a,
+    0x57f927a9, 0x57f9286a, 0x57f92929, 0x57fdba45, 0x57fdbf91, 0x57fdd009, 0x57fdd255, 0x57fdd305,
+    0x57fdd3d5, 0x57fdd455, 0x57fde389, 0x57fde409, 0x57fde5d5, 0x57fe21c5, 0x57fe24d9, 0x57fe256a,
+    0x57fe3489, 0x57fe4805, 0x57fe4949, 0x57fe4bd9, 0x57fe4d59, 0x57fe4dd9, 0x57fe5f59, 0x57fe5fd9,
+    0x57fe99c9, 0x57fed5c5, 0x57fed9a9, 0x57fedb29, 0x57fedba9, 0x57feef51, 0x57ff0229, 0x57ff03a9,
+    0x57ff0429, 0x57ff13c9, 0x57ff15a9, 0x57ff1629, 0x57ff17a9, 0x57ff23d1, 0x57ff2485, 0x57ff2551,
+    0x57ff2789, 0x57ff2905, 0x57ff38c5, 0x57ff3a55, 0x57ff3b05, 0x57ff3c49, 0x57ff3ed5, 0x57ff4055,
+    0x57ff40d5, 0x57ff4dd5, 0x57ff5255, 0x57ff52d5, 0x57ff7729, 0x57ff7ba9, 0x57ff7d29, 0x57ff7da9,
+    0x57ff8929, 0x57ff89c5, 0x57ff8aa9, 0x57ff8b29, 0x57ff8cc9, 0x57ff8d6a, 0x57ff8e45, 0x57ff8f29,
+    0x57ff8fa9, 0x57ff9129, 0x57ff9ed1, 0x57ffa351, 0x57ffb1a9, 0x57ffb245, 0x57ffb329, 0x57ffb3a9,
+    0x57ffb549, 0x57ffb5c9, 0x57ffb6c5, 0x57ffb7a9, 0x57ffb829, 0x580ab409, 0x580ab585, 0x580af005,
+    0x580af0c9, 0x580af3d9, 0x580af559, 0x580af5ea, 0x580b2fd9, 0x580b6985, 0x580b6ed5, 0x580ba7c9,
+    0x580baac5, 0x580baba9, 0x580bac29, 0x580be3c9, 0x580be56a, 0x580be829, 0x580c22d5, 0x580c59a9,
+    0x580c5a45, 0x580c5b29, 0x580c5ba9, 0x580c5d49, 0x580c5dea, 0x580c5ec5, 0x580c5fa9, 0x580c6029,
+    0x5810f611, 0x58110809, 0x58110895, 0x58110985, 0x581147d9, 0x58114959, 0x581149ea, 0x58115b59,
+    0x581183d9, 0x581185d9, 0x5811abaa, 0x5811c2d5, 0x5811d4ea, 0x5811d6d5, 0x5811e9ea, 0x5811eb51,
+    0x5811fe29, 0x5811ffa9, 0x58120029, 0x58120fea, 0x581213a9, 0x581225ea, 0x58123c29, 0x58127255,
+    0x581276d5, 0x58127755, 0x5812af29, 0x5812afa9, 0x5812b149, 0x5812b1ea, 0x5812b3a9, 0x5812b429,
+    0x5812eba9, 0x581deda6, 0x581df0a6, 0x581df165, 0x581e2a4a, 0x581e2d46, 0x581e635a, 0x581e665a,
+    0x581e66da, 0x581e67da, 0x581e695a, 0x581e6b66, 0x581ea3ca, 0x581ea6c6, 0x581f1d4a, 0x581f2066,
+    0x581f2125, 0x581f21a6, 0x581f5656, 0x581f57e6, 0x581f59d6, 0x581f5ad6, 0x581f5c66, 0x581f5de6,
+    0x581f5e56, 0x581f94a5, 0x581f96e6, 0x581f9925, 0x581f99e6, 0x581f9aa5, 0x58242b11, 0x58242bc5,
+    0x58242f9a, 0x58243111, 0x58243f55, 0x58244189, 0x582443d9, 0x58244485, 0x58244555, 0x582445d5,
+    0x58245356, 0x58245509, 0x58245596, 0x5824569a, 0x582467d1, 0x582491c9, 0x58249659, 0x5824a305,
+    0x5824a3d1, 0x5824a609, 0x5824a79a, 0x5824b8e5, 0x5824b985, 0x5824bae6, 0x5824bd5a, 0x5824bed9,
+    0x5824bf65, 0x5824d0da, 0x5824d2d9, 0x5824e165, 0x5824e38a, 0x5824e685, 0x58250865, 0x582509e6,
+    0x58250fd5, 0x58251056, 0x582546a5, 0x58254ca5, 0x582560d1, 0x58256f26, 0x58257525, 0x582575a6,
+    0x582581e6, 0x582582a5, 0x58258326, 0x5825854a, 0x58258925, 0x58259605, 0x58259909, 0x58259a85,
+    0x5825abd5, 0x5825ac85, 0x5825add5, 0x5825b055, 0x5825b1d5, 0x5825b256, 0x5825bf55, 0x5825c3d5,
+    0x5825c5d6, 0x5825d451, 0x5825d8d1, 0x5825da51, 0x5825e8a5, 0x5825ed25, 0x5825eea5, 0x5825faa5,
+    0x5825fb45, 0x5825fc25, 0x5825fe49, 0x5825ffc5, 0x582600a5, 0x58261051, 0x582614d1, 0x58262326,
+    0x582623c5, 0x582624a5, 0x58262526, 0x582626c9, 0x58262765, 0x58262845, 0x58262925, 0x582629a6,
+    0x58376609, 0x58376905, 0x58378d05, 0x58378dc9, 0x583790da, 0x58379255, 0x583792d6, 0x5837c9c5,
+    0x5837cd99, 0x5837ce45, 0x5837cf19, 0x5837de05, 0x5837e1da, 0x5837e351, 0x5837f3c9, 0x5837f619,
+    0x5837f6c5, 0x5837f799, 0x5837f819, 0x58380759, 0x583807d9, 0x5838099a, 0x583844ca, 0x583847c5,
+    0x58384895, 0x58384915, 0x5838818a, 0x58388486, 0x583895ca, 0x583898c5, 0x58389991, 0x5838bcca,
+    0x5838d051, 0x5838d105, 0x5838d4d1, 0x5838d651, 0x5838e495, 0x5838e6c9, 0x5838e915, 0x5838e9c5,
+    0x5838ea95, 0x5838eb15, 0x5838f696, 0x5838f816, 0x5838f896, 0x5838fa55, 0x5838fad6, 0x5838fc96,
+    0x58390d11, 0x58391191, 0x58391245, 0x58391311, 0x58393405, 0x58393645, 0x58393885, 0x58394792,
+    0x58394912, 0x58394b51, 0x58395c85, 0x58395ec5, 0x58396009, 0x5844615a, 0x58446356, 0x58449bc9,
+    0x58449ec5, 0x58449f99, 0x58451915, 0x58458d4a, 0x584606c5, 0x584a9e09, 0x584a9f9a, 0x584ab185,
+    0x584ab55a, 0x584ab6d5, 0x584ab756, 0x584ac8da, 0x584acad6, 0x584addda, 0x584adf51, 0x584aefc9,
+    0x584af2c5, 0x584af399, 0x584b0349, 0x584b19da, 0x584b2bc9, 0x584b538a, 0x584b58d1, 0x584b7d4a,
+    0x584b94c5, 0x584bb8ca, 0x584bcdca, 0x584c0851, 0x584c0cd1, 0x584c1ec9, 0x584c1f56, 0x584c2045,
+    0x584c4445, 0x584c48c5, 0x584c5ac5, 0x58579405, 0x58579709, 0x58579795, 0x58579885, 0x585799d6,
+    0x5857d449, 0x5857d6d9, 0x5857d859, 0x5857d8d9, 0x58580e59, 0x585812d9, 0x58584be6, 0x58584dc9,
+    0x58584ec5, 0x58585055, 0x585851d5, 0x58585255, 0x58588d25, 0x58588ea5, 0x58588f25, 0x5858c3e6,
+    0x5858c6c9, 0x5858c765, 0x5858c845, 0x5858c925, 0x5858c9a6, 0x5858cb25, 0x58590155, 0x585905d5,
+    0x585907d5, 0x58593ca5, 0x58593d45, 0x58593e25, 0x58593ea5, 0x58594049, 0x585940c9, 0x585941c5,
+    0x585942a5, 0x58594325, 0x585944a5, 0x585dd491, 0x585dd911, 0x585deb09, 0x585deb89, 0x585dec85,
+    0x585dedd5, 0x585e2659, 0x585e2849, 0x585e2ad9, 0x585e2c59, 0x585e2cd9, 0x585e3e59, 0x585e6259,
+    0x585e66d9, 0x585e6765, 0x585e8a26, 0x585e8e85, 0x585e9fe6, 0x585ea1c9, 0x585ea455, 0x585ea5d5,
+    0x585eb1e6, 0x585eb366, 0x585eb3e6, 0x585eb7d5, 0x585eb855, 0x585eb9d5, 0x585eccd1, 0x585ece51,
+    0x585ee125, 0x585ee325, 0x585ef0a5, 0x585ef4a5, 0x585ef525, 0x585ef6a5, 0x585f02e6, 0x585f0466,
+    0x585f08d1, 0x585f1c45, 0x585f1d25, 0x585f1da6, 0x585f53d5, 0x585f5555, 0x585f59d5, 0x585f5a55,
+    0x585f7c51, 0x585f7dd1, 0x585f8251, 0x585f92a5, 0x585f9449, 0x585f94c9, 0x585f9725, 0x585fa4a5,
+    0x585fa625, 0x586acf05, 0x586ad049, 0x586ad2d5, 0x586ad455, 0x586ad4d5, 0x586b0d49, 0x586b0f99,
+    0x586b1045, 0x586b1119, 0x586b1199, 0x586b4959, 0x586b4ad9, 0x586b4c1a, 0x586b86c9, 0x586b8915,
+    0x586b89c5, 0x586b8a95, 0x586b8b15, 0x586bfec5, 0x586c0009, 0x586c0105, 0x586c3896, 0x586c3a96,
+    0x586c3c55, 0x586c3dd5, 0x586c3f16, 0x586c7605, 0x586c7845, 0x586c7989, 0x586c7a85, 0x58710f89,
+    0x58711105, 0x58712305, 0x58712449, 0x587126d5, 0x58712855, 0x587128d5, 0x58713a55, 0x58713ad5,
+    0x58713c55, 0x58716149, 0x58716445, 0x58716599, 0x587174c9, 0x58717549, 0x58717799, 0x58717919,
+    0x58718b51, 0x58719d49, 0x58719dc9, 0x5871a019, 0x5871c505, 0x5871c8d1, 0x5871ca51, 0x5871dac9,
+    0x5871dd15, 0x5871ddc5, 0x5871df15, 0x5871ee49, 0x5871eec9, 0x5871efc5, 0x5871f095, 0x5871f115,
+    0x5871f295, 0x58720645, 0x58722a45, 0x58722c85, 0x58723f49, 0x587240c5, 0x587252c5, 0x58725409,
+    0x58727851, 0x587279d1, 0x58727e51, 0x58728c95, 0x58728d45, 0x58728e95, 0x58729049, 0x587290c9,
+    0x58729315, 0x5872b511, 0x5872b5c5, 0x5872ba45, 0x5872cc45, 0x5872cd89, 0x587e0ad5, 0x587e4549,
+    0x587e45c9, 0x587e4819, 0x587e4999, 0x587ebec9, 0x587ebf55, 0x587ec045, 0x587ec315, 0x587efac5,
+    0x587efc09, 0x587f7296, 0x58845ed5, 0x58845f55, 0x58849949, 0x588499c9, 0x58849c19, 0x588500d1,
+    0x58851355, 0x58851445, 0x58851596, 0x58853cc5, 0x58854ec5, 0x58855009, 0x588cfbc9, 0x588cfc49,
+    0x588d0015, 0x588d3b99, 0x588d3d19, 0x588d3daa, 0x588d7799, 0x588d7825, 0x588d7999, 0x588df3e9,
+    0x588e2fdd, 0x588e6a95, 0x588e6b15, 0x588e6c95, 0x588ea509, 0x588ea7e9, 0x588ea969, 0x588f1d15,
+    0x588f1dc5, 0x588f1f09, 0x588f2195, 0x588f2315, 0x588f2395, 0x588f59d9, 0x588f5e59, 0x588f5fd9,
+    0x588f6069, 0x588f95d9, 0x588f9666, 0x588f9809, 0x588f9985, 0x588f9ae6, 0x588f9c59, 0x588fd365,
+    0x588fd7e9, 0x588fd955, 0x588fd9d5, 0x58904b65, 0x5890516a, 0x589052e5, 0x58908805, 0x589088d5,
+    0x58908955, 0x58908b09, 0x58908c85, 0x58908d55, 0x58908dd5, 0x5890c4c5, 0x5890c665, 0x5890c869,
+    0x5890cae5, 0x5890cc65, 0x5890ccea, 0x58910265, 0x589106e5, 0x589108e5, 0x58913f15, 0x58914395,
+    0x5891442a, 0x58917c69, 0x58917e09, 0x58917eaa, 0x58918269, 0x5891f5e5, 0x5892376a, 0x589238e5,
+    0x58926ee6, 0x5892736a, 0x589273ea, 0x58927565, 0x5892e6e5, 0x5892e865, 0x5892ece5, 0x5892ed6a,
+    0x5892eeea, 0x58934fc9, 0x58938f9a, 0x58939119, 0x589391aa, 0x5893cb99, 0x5894be95, 0x5894f909,
+    0x5894f9aa, 0x5894fbe9, 0x58955fc5, 0x589571c5, 0x5895759a, 0x58957715, 0x58958915, 0x5895da11,
+    0x5895ec09, 0x5895ed85, 0x58961326, 0x589617aa, 0x58963a26, 0x58963ae5, 0x58963b66, 0x58963eaa,
+    0x589676e5, 0x58967cea, 0x58968b26, 0x58968be5, 0x58968faa, 0x58969f66, 0x5896a0e6, 0x5896a56a,
+    0x5896a6e5, 0x5896b466, 0x5896b4e6, 0x5896b8ea, 0x5896bae5, 0x5896cd11, 0x5896dc05, 0x5896dcd5,
+    0x5896df09, 0x5896e085, 0x5896e1e6, 0x589718c5, 0x58971c69, 0x58971ee5, 0x58972065, 0x58972de5,
+    0x58973265, 0x58975665, 0x58975ae5, 0x58979795, 0x5897d069, 0x5897d209, 0x5897d2aa, 0x589839aa,
+    0x589849e6, 0x58988b6a, 0x58988ce5, 0x5898c76a, 0x5898c7ea, 0x5898d6e6, 0x58993ae5, 0x58993c65,
+    0x589940e5, 0x58994eea, 0x58a033c5, 0x58a03795, 0x58a03915, 0x58a03995, 0x58a07209, 0x58a07505,
+    0x58a075d9, 0x58a07669, 0x58a0ae09, 0x58a0ae89, 0x58a0b259, 0x58a0efd5, 0x58a168dd, 0x58a1695d,
+    0x58a1a109, 0x58a1a189, 0x58a1a3d5, 0x58a1a555, 0x58a1dd05, 0x58a1e0dd, 0x58a1e25d, 0x58a1e2ea,
+    0x58a21cdd, 0x58a21d5d, 0x58a25809, 0x58a25a55, 0x58a25b05, 0x58a25bd5, 0x58a25c55, 0x58a2d005,
+    0x58a2d3d9, 0x58a2d559, 0x58a2d5d9, 0x58a38a29, 0x58a38ba9, 0x58a38c29, 0x58a3c0c5, 0x58a3c255,
+    0x58a3c305, 0x58a3c449, 0x58a3c6d5, 0x58a3c855, 0x58a3c8d5, 0x58a3ff29, 0x58a403a9, 0x58a40445,
+    0x58a40529, 0x58a405a9, 0x58a43a45, 0x58a43b29, 0x58a43ba9, 0x58a43d49, 0x58a43dc9, 0x58a43ec5,
+    0x58a43fa9, 0x58a44029, 0x58a441a9, 0x58a4771a, 0x58a47859, 0x58a47a09, 0x58a47a89, 0x58a47b85,
+    0x58a47cd5, 0x58a47e55, 0x58a4b55a, 0x58a4b769, 0x58a4b9d9, 0x58a4bb59, 0x58a4bbea, 0x58a4f15a,
+    0x58a4f5d9, 0x58a4f659, 0x58a4f7d9, 0x58a530c9, 0x58a5336a, 0x58a571a9, 0x58a57229, 0x58a5a9c9,
+    0x58a5aa49, 0x58a5ab6a, 0x58a5aca9, 0x58a5ae29, 0x58a5e2d5, 0x58a5e455, 0x58a5e8d5, 0x58a5e955,
+    0x58a5ead5, 0x58a61fa9, 0x58a62045, 0x58a62129, 0x58a621a9, 0x58a62349, 0x58a623ea, 0x58a625a9,
+    0x58a62629, 0x58a627a9, 0x58a687c5, 0x58a68b95, 0x58a68d15, 0x58a68d95, 0x58a6a115, 0x58a6c609,
+    0x58a6c905, 0x58a6ca69, 0x58a6d989, 0x58a6da2a, 0x58a70209, 0x58a70289, 0x58a743d5, 0x58a7945d,
+    0x58a7bb6a, 0x58a7bcdd, 0x58a7bd5d, 0x58a7d0dd, 0x58a7f509, 0x58a7f589, 0x58a7f7d5, 0x58a83105,
+    0x58a834dd, 0x58a8365d, 0x58a836ea, 0x58a8485d, 0x58a84a6a, 0x58a870dd, 0x58a8715d, 0x58a89645,
+    0x58a89b91, 0x58a8ac09, 0x58a8af05, 0x58a8b055, 0x58a8bf89, 0x58a8c009, 0x58a91089, 0x58a927d9,
+    0x58a92959, 0x58a929d9, 0x58a93b59, 0x58a93bd9, 0x58a975c9, 0x58a97649, 0x58a97769, 0x58a9b1c5,
+    0x58a9b5a9, 0x58a9b729, 0x58a9b7a9, 0x58a9da45, 0x58a9de29, 0x58a9dfa9, 0x58a9e029, 0x58a9f1a9,
+    0x58a9f229, 0x58a9f3a9, 0x58aa0085, 0x58aa0151, 0x58aa0389, 0x58aa14c5, 0x58aa1655, 0x58aa1ad5,
+    0x58aa1c55, 0x58aa1cd5, 0x58aa29d5, 0x58aa2e55, 0x58aa2ed5, 0x58aa5329, 0x58aa57a9, 0x58aa5845,
+    0x58aa5929, 0x58aa59a9, 0x58aa66a9, 0x58aa6729, 0x58aa6b29, 0x58aa6d29, 0x58aa7ad1, 0x58aa7f51,
+    0x58aa8e45, 0x58aa8f29, 0x58aa8fa9, 0x58aa91c9, 0x58aa93a9, 0x58aa9429, 0x58aaa329, 0x58aacc59,
+    0x58aace09, 0x58ab095a, 0x58ab0b69, 0x58ab0dd9, 0x58ab0f59, 0x58ab0fea, 0x58ab2159, 0x58ab236a,
+    0x58ab455a, 0x58ab49d9, 0x58ab4a59, 0x58abc5a9, 0x58abc629, 0x58abd7a9, 0x58ac00a9, 0x58ac36d5,
+    0x58ac3855, 0x58ac3cd5, 0x58ac73a9, 0x58ac7445, 0x58ac7529, 0x58ac75a9, 0x58ac7749, 0x58ac77ea,
+    0x58ac7a29, 0x58ac8929, 0x58acb029, 0x58b36f95, 0x58b37015, 0x58b37195, 0x58b3aa09, 0x58b3aaaa,
+    0x58b4636a, 0x58b464dd, 0x58b49f6a, 0x58b4a15d, 0x58b518dd, 0x58b5196a, 0x58b51aea, 0x58b59009,
+    0x58b59185, 0x58b5cfd9, 0x58b5d159, 0x58b5d1ea, 0x58b60bd9, 0x58b64345, 0x58b6496a, 0x58b64ad5,
+    0x58b681a9, 0x58b687a9, 0x58b6bda9, 0x58b6fa55, 0x58b6fed5, 0x58b73645, 0x58b73729, 0x58b739ea,
+    0x58b73ba9, 0x58b73da9, 0x58b7ebd9, 0x58b7ed59, 0x58b7edea, 0x58b7f1d9, 0x58b7f26a, 0x58b7f3ea,
+    0x58b866d5, 0x58b86b6a, 0x58b86d55, 0x58b8a3a9, 0x58b8a429, 0x58b8e029, 0x58b959a9, 0x58b9c3a9,
+    0x58b9fe29, 0x58bab75e, 0x58bab8de, 0x58baf36a, 0x58bb6ce9, 0x58bbd229, 0x58bbe429, 0x58bbe5a9,
+    0x58bc23da, 0x58bc255a, 0x58bc3769, 0x58bc5fe9, 0x58bc8329, 0x58bc83ea, 0x58bc87aa, 0x58bc98d6,
+    0x58bc9d56, 0x58bc9ed6, 0x58bcac69, 0x58bcc152, 0x58bcc5d2, 0x58bce92a, 0x58bce9aa, 0x58bcfd69,
+    0x58bd11aa, 0x58bd25aa, 0x58bd4e69, 0x58bd52e9, 0x58bd8b2a, 0x58bd902a, 0x58be3fe9, 0x58be4169,
+    0x58be45e9, 0x58bebf6a, 0x58bef82a, 0x58c6a545, 0x58c6aa95, 0x58c71f89, 0x58c7211a, 0x58c81289,
+    0x58c853dd, 0x58c88e5d, 0x58c8c989, 0x58c8cbd9, 0x58c8cc85, 0x58c8cd55, 0x58c94185, 0x58c9455a,
+    0x58c946d9, 0x58c9f726, 0x58c9fd25, 0x58ca3245, 0x58ca33d5, 0x58ca3485, 0x58ca3855, 0x58ca39d5,
+    0x58ca70a5, 0x58ca7525, 0x58ca76a5, 0x58caabc5, 0x58caaca5, 0x58caaec9, 0x58cab045, 0x58cab125,
+    0x58cae885, 0x58caeb89, 0x58caed1a, 0x58cb2cd9, 0x58cb62d9, 0x58cb675a, 0x58cba066, 0x58cbdd25,
+    0x58cc1866, 0x58cc55d5, 0x58cc5a55, 0x58cc9125, 0x58cc91c5, 0x58cc92a5, 0x58cf07c5, 0x58cf0b9a,
+    0x58cf0d11, 0x58cf2085, 0x58cf3109, 0x58cf329a, 0x58cf8209, 0x58cf839a, 0x58cf9ad9, 0x58cfacda,
+    0x58cfaed9, 0x58cfbd65, 0x58cfbf8a, 0x58cfc285, 0x58cfe465, 0x58cfe5e6, 0x58cfebd5, 0x58cfec56,
+    0x58d022a5, 0x58d036e6, 0x58d03cd1, 0x58d04b26, 0x58d05125, 0x58d051a6, 0x58d05de6, 0x58d05ea5,
+    0x58d05f26, 0x58d06525, 0x58d07205, 0x58d07509, 0x58d07685, 0x58d08645, 0x58d087d5, 0x58d08c55,
+    0x58d08dd5, 0x58d09b55, 0x58d09fd5, 0x58d0b051, 0x58d0b4d1, 0x58d0b651, 0x58d0c4a5, 0x58d0c925,
+    0x58d0caa5, 0x58d0d825, 0x58d0ec51, 0x58d0f0d1, 0x58d0ffc5, 0x58d100a5, 0x58d10126, 0x58d10445,
+    0x58d10525, 0x58d105a6, 0x58d114a5, 0x58d13c85, 0x58d17c49, 0x58d17dd9, 0x58d1b6d9, 0x58d1bb5a,
+    0x58d1dea6, 0x58d21b65, 0x58d231c9, 0x58d23725, 0x58d26da6, 0x58d28125, 0x58d2a855, 0x58d2a9d5,
+    0x58d2ae55, 0x58d2e525, 0x58d2e6a5, 0x58d2eb25, 0x58d321a6, 0x58d9df89, 0x58d9e285, 0x58da5785,
+    0x58da5b5a, 0x58da5cd9, 0x58da5d59, 0x58db0f4a, 0x58db131d, 0x58db139d, 0x58db4a85, 0x58db4e55,
+    0x58db4fd5, 0x58db88c9, 0x58db8b1d, 0x58db8bc5, 0x58db8c9d, 0x58dbc4dd, 0x58dbc55d, 0x58dbc79e,
+    0x58dbc91e, 0x58dc7bc9, 0x58dc7e19, 0x58dc7ec5, 0x58dc7f99, 0x58dc8019, 0x58dd6c95, 0x58dd6ec9,
+    0x58dd7115, 0x58dd71c5, 0x58dd7295, 0x58dde485, 0x58dde6c5, 0x58dde809, 0x58de22da, 0x58de2385,
+    0x58de275a, 0x58de28d5, 0x58de5f99, 0x58de61c9, 0x58de64c5, 0x58de6599, 0x58de9ada, 0x58de9c1a,
+    0x58de9dd9, 0x58de9e59, 0x58de9f5a, 0x58dea09a, 0x58dea21a, 0x58dedb4a, 0x58dede45, 0x58dedf15,
+    0x58df534a, 0x58df5489, 0x58df8dd5, 0x58df90d5, 0x58df9255, 0x58dfccc5, 0x58e01dc5, 0x58e02311,
+    0x58e03685, 0x58e04709, 0x58e04796, 0x58e08305, 0x58e086da, 0x58e08859, 0x58e09809, 0x58e0ab85,
+    0x58e0af5a, 0x58e0b0d9, 0x58e0b159, 0x58e0c2da, 0x58e0c35a, 0x58e0c4d9, 0x58e0d58a, 0x58e0fc8a,
+    0x58e13aca, 0x58e13e9d, 0x58e14d8a, 0x58e1634a, 0x58e1679d, 0x58e1774a, 0x58e17b1d, 0x58e18b09,
+    0x58e19e85, 0x58e1a3d5, 0x58e1b5d5, 0x58e1dcc9, 0x58e1dfc5, 0x58e1f049, 0x58e206d1, 0x58e218c9,
+    0x58e21949, 0x58e21b9d, 0x58e24209, 0x58e24505, 0x58e26905, 0x58e26cda, 0x58e26e55, 0x58e26ed6,
+    0x58e2aa45, 0x58e2ba05, 0x58e2bdda, 0x58e2bf51, 0x58e2cfc9, 0x58e2d2c5, 0x58e2d419, 0x58e2e349,
+    0x58e2e3c9, 0x58e2e4da, 0x58e31f49, 0x58e320ca, 0x58e323c5, 0x58e32495, 0x58e32515, 0x58e35d8a,
+    0x58e36086, 0x58e371ca, 0x58e374c5, 0x58e3860a, 0x58e398ca, 0x58e39989, 0x58e39a09, 0x58e3ac51,
+    0x58e3ad05, 0x58e3b0d1, 0x58e3b251, 0x58e3c095, 0x58e3c2c9, 0x58e3c5c5, 0x58e3d345, 0x58e3d415,
+    0x58e3d495, 0x58e3d649, 0x58e3d6d6, 0x58e3d7c5, 0x58e3e911, 0x58e3ee45, 0x58e40286, 0x58e41005,
+    0x58e41245, 0x58e42445, 0x58e42511, 0x58e42749, 0x58e428c5, 0x58e43885, 0x58e43ac5, 0x58e43c09,
+    0x58e46409, 0x58e476da, 0x58e47785, 0x58e47b5a, 0x58e47cd5, 0x58e48eda, 0x58e4b445, 0x58e4b5c9,
+    0x58e4b819, 0x58e4b8c5, 0x58e4b999, 0x58e4c949, 0x58e4dfda, 0x58e4eeda, 0x58e4f019, 0x58e4f1c9,
+    0x58e4f249, 0x58e4f499, 0x58e5198a, 0x58e51ed1, 0x58e52f4a, 0x58e53245, 0x58e54715, 0x58e55ac5,
+    0x58e55b91, 0x58e56c0a, 0x58e56f06, 0x58e57eca, 0x58e5a74a, 0x58e5a889, 0x58e5ccd1, 0x58e5ce51,
+    0x58e5d2d1, 0x58e5e1c5, 0x58e5e4c9, 0x58e60a45, 0x58e60ec5, 0x58e61e85, 0x58e620c5, 0x58e62189,
+    0x58e62305, 0x58ed1789, 0x58ed1816, 0x58ed191a, 0x58ed5385, 0x58ed575a, 0x58ed58d9, 0x58ed935a,
+    0x58ed9559, 0x58ee0b4a, 0x58ee474a, 0x58ee4b9d, 0x58ee8655, 0x58ee8856, 0x58eec0c9, 0x58ef3985,
+    0x58ef3d5a, 0x58ef3ed5, 0x58ef3f56, 0x58ef77c9, 0x58ef7ac5, 0x58ef7b99, 0x58efb3c9, 0x58efb819,
+    0x58f0a3c5, 0x58f0a6c9, 0x58f0a845, 0x58f0e2c5, 0x58f15ad5, 0x58f15f5a, 0x58f15fd6, 0x58f16156,
+    0x58f196c5, 0x58f19799, 0x58f199c9, 0x58f21045, 0x58f21115, 0x58f21196, 0x58f24d05, 0x58f24f4a,
+    0x58f36b89, 0x58f3a79a, 0x58f3ab5a, 0x58f3acd9, 0x58f3e75a, 0x58f4210a, 0x58f45f4a, 0x58f4625e,
+    0x58f49b4a, 0x58f4da55, 0x58f514c9, 0x58f5171d, 0x58f57a09, 0x58f57b9a, 0x58f58d9a, 0x58f5915a,
+    0x58f592d5, 0x58f5a4da, 0x58f5b9da, 0x58f5bb51, 0x58f5cbda, 0x58f5ceda, 0x58f5f5da, 0x58f607c9,
+    0x58f6095a, 0x58f62f8a, 0x58f634d1, 0x58f6454a, 0x58f64856, 0x58f66dca, 0x58f670d2, 0x58f694ca,
+    0x58f6a9ca, 0x58f6bd4a, 0x58f6e451, 0x58f6e8d1, 0x58f6f7c5, 0x58f6fac9, 0x58f6fc45, 0x58f72045,
+    0x58f72111, 0x58f724c5, 0x58f72591, 0x58f736c5, 0x58f7aed5, 0x58f7b35a, 0x58f7d5da, 0x58f7eac5,
+    0x58f7edc9, 0x58f7f019, 0x58f850d1, 0x58f88cc5, 0x58f88d91, 0x58f8a105, 0x58f8a34a, 0x58f8a409,
+    0x59005295, 0x59008d09, 0x5901465d, 0x590147dd, 0x5901825d, 0x5901fbdd, 0x59027309, 0x59027485,
+    0x5902b2d9, 0x5902b459, 0x5902eed9, 0x59032c55, 0x59032dd5, 0x59036925, 0x59036aa5, 0x5903a445,
+    0x5903a525, 0x5903dd55, 0x5903e1d5, 0x59041a25, 0x59041ea5, 0x5904ced9, 0x5904d059, 0x5904d4d9,
+    0x5906a6a5, 0x5906e125, 0x59079a5e, 0x59079bde, 0x5907d665, 0x59084fe5, 0x5908b525, 0x5908c725,
+    0x5908c8a5, 0x590906da, 0x5909085a, 0x59091a65, 0x590942e5, 0x59096aa5, 0x59098056, 0x590981d6,
+    0x590993e5, 0x590995e5, 0x5909a8d2, 0x5909e4e5, 0x590a3165, 0x590a35e5, 0x590a59e5, 0x590a5e65,
+    0x590b2465, 0x590b28e5, 0x590ba265, 0x590bcae5, 0x59138909, 0x5913c505, 0x5913c8d9, 0x5913ca59,
+    0x591404d9, 0x59147cc9, 0x5914b8c9, 0x5914f7d5, 0x59153249, 0x5915ab05, 0x5915aed5, 0x5915b055,
+    0x5915e949, 0x5915ec45, 0x59162549, 0x591626c5, 0x591662c9, 0x59166515, 0x591665c5, 0x59166695,
+    0x59169f8a, 0x5916dac5, 0x5916db89, 0x59171545, 0x59171615, 0x59171849, 0x591719c5, 0x59171a95,
+    0x59175205, 0x59175445, 0x5917cada, 0x5917cc5a, 0x5917d0d5, 0x59180b49, 0x59188645, 0x5918c0c5,
+    0x5919dd09, 0x591a1905, 0x591a1cd9, 0x591a1e59, 0x591a3059, 0x591a30d9, 0x591a3259, 0x591a58d9,
+    0x591a5959, 0x591ad0de, 0x591ad3de, 0x591ae449, 0x591ae4c9, 0x591ae71d, 0x591ae89d, 0x591b0cc9,
+    0x591b0d49, 0x591b4bd5, 0x591b8649, 0x591beb89, 0x591bed05, 0x591bff05, 0x591c02d5, 0x591c0455,
+    0x591c1655, 0x591c16d5, 0x591c3d5a, 0x591c5149, 0x591c5519, 0x591c6751, 0x591c7949, 0x591c7ac5,
+    0x591ca105, 0x591ca4d1, 0x591ca651, 0x591cb6d6, 0x591cb9d6, 0x591cca49, 0x591ccac9, 0x591ccbc5,
+    0x591ccc95, 0x591ccd15, 0x591ce252, 0x591d0645, 0x591d0709, 0x591d0789, 0x591d0885, 0x591d1b49,
+    0x591d1cc5, 0x591d2ec5, 0x591d2f89, 0x591d3105, 0x591d55d1, 0x591d5a51, 0x591d6945, 0x591d6c49,
+    0x591d6dc5, 0x591d91c5, 0x591d9645, 0x591da845, 0x591e205a, 0x591e24d5, 0x591e5f49, 0x591f14c5,
+    0x592700d9, 0x5927b4c9, 0x5928e6d5, 0x59299c45, 0x5929d6c5, 0x59e4c3c5, 0x59e50219, 0x59e53e19,
+    0x59e565ea, 0x59e58f2a, 0x59e63125, 0x59eb2f15, 0x59ebcfaa, 0x59ebd111, 0x59ebe189, 0x59ec3665,
+    0x59ec5d6a, 0x59ec5ee5, 0x59ec9725, 0x59ecd865, 0x59f2372a, 0x59f288ea, 0x59f2c4ea, 0x59f33e65,
+    0x59f9416a, 0x59f96905, 0x59f9a761, 0x59f9bae1, 0x59f9e361, 0x59ffbbaa, 0x59ffd46a, 0x59ffe66a,
+    0x5a0020ea, 0x5a00226a, 0x5a00496a, 0x5a05c329, 0x5a05c3a9, 0x5a063a55, 0x5a0662d1, 0x5a067645,
+    0x5a067729, 0x5a1e5849, 0x5a1e59da, 0x5a1e6f9a, 0x5a1e7115, 0x5a1e831a, 0x5a1ed41a, 0x5a1ee609,
+    0x5a1f0dca, 0x5a1f1311, 0x5a1f7861, 0x5a1fa0e1, 0x5a1fc725, 0x5a200325, 0x5a2018e5, 0x5a201a65,
+    0x5a2054e5, 0x5a24d8a6, 0x5a2552e6, 0x5a25778a, 0x5a257aa6, 0x5a25a3e6, 0x5a25a456, 0x5a2640a6,
+    0x5a26bae6, 0x5a2b7e59, 0x5a2bf7d5, 0x5a2c0bd6, 0x5a2c2051, 0x5a2ce665, 0x5a324b22, 0x5a327462,
+    0x5a32c562, 0x5a32fda2, 0x5a32ff22, 0x5a331122, 0x5a3314e2, 0x5a331662, 0x5a332862, 0x5a333d62,
+    0x5a336462, 0x5a337962, 0x5a338b62, 0x5a338ce2, 0x5a3f1c51, 0x5a3fd051, 0x5a3fe249, 0x5a400c51,
+    0x5a401e45, 0x5a581915, 0x5a58bb11, 0x5a590ce1, 0x5a590e61, 0x5a592061, 0x5a5920e1, 0x5a592261,
+    0x5a5948e1, 0x5a59c265, 0x5a5ec059, 0x5a5f3855, 0x5a5f39d5, 0x5a5f4bd5, 0x5a602865, 0x5a659fd5,
+    0x5a65c851, 0x5a6bf305, 0x5a6c1c61, 0x5a6c3151, 0x5a6c32d1, 0x5a6c6d51, 0x5a6cbe55, 0x5a6ce6d1,
+    0x5a725cd1, 0x5a7271c5, 0x5a729a45, 0x5a732449, 0x5a736045, 0x5a8f9fda, 0x5a901a19, 0x5a9041ea,
+    0x5a905796, 0x5a906b2a, 0x5a90cfaa, 0x5a93e3c9, 0x5a942519, 0x5a945f99, 0x5a949d2a, 0x5a94d79e,
+    0x5a9552a5, 0x5a961d15, 0x5a9710ea, 0x5a974cea, 0x5a97c665, 0x5a982715, 0x5a982b95, 0x5a986609,
+    0x5a9920e5, 0x5a992e65, 0x5a9956e5, 0x5a995b6a, 0x5a99d065, 0x5a99d4e5, 0x5a9d132a, 0x5a9d2696,
+    0x5a9da0ea, 0x5a9f8265, 0x5aa41dea, 0x5aa43191, 0x5aa44505, 0x5aa48361, 0x5aa4bf61, 0x5aa5add5,
+    0x5aa5d651, 0x5aa71bc5, 0x5aa71f95, 0x5aa72115, 0x5aa75a09, 0x5aa75d05, 0x5aa76d89, 0x5aa76e2a,
+    0x5aa79609, 0x5aa8285d, 0x5aa84f6a, 0x5aa850dd, 0x5aa864dd, 0x5aa88909, 0x5aa8c8dd, 0x5aa8ca5d,
+    0x5aa8dc5d, 0x5aa904dd, 0x5aa94009, 0x5aa99359, 0x5aa9bbd9, 0x5aa9cf59, 0x5aaa6fc9, 0x5aaaaed5,
+    0x5aaac255, 0x5aab4b91, 0x5aab5f05, 0x5aab6209, 0x5aab9d59, 0x5aaba1d9, 0x5aaba359, 0x5aabaf59,
+    0x5aabb0d9, 0x5aabb559, 0x5aabd7d9, 0x5aabd959, 0x5aabddd9, 0x5aac01d1, 0x5aac6729, 0x5aac8fa9,
+    0x5aaccc55, 0x5aacd0d5, 0x5aad0845, 0x5aad0b49, 0x5ab02359, 0x5ab11655, 0x5ab204d9, 0x5ab2bb29,
+    0x5ab6c796, 0x5ab741ea, 0x5aba5799, 0x5abb0b89, 0x5abb479e, 0x5abb4cde, 0x5abb876a, 0x5abccb59,
+    0x5abd44ea, 0x5abed559, 0x5abed9d9, 0x5abf536a, 0x5abf8dc9, 0x5ac93449, 0x5ac935da, 0x5ac94d15,
+    0x5ac95f1a, 0x5ac95f96, 0x5ac9b01a, 0x5ac9e9ca, 0x5ac9ef11, 0x5aca2b12, 0x5aca5461, 0x5aca7ce1,
+    0x5aca90e1, 0x5acaa325, 0x5acaf665, 0x5acb30e5, 0x5acc5b45, 0x5acc7061, 0x5acc98e1, 0x5acf9bc5,
+    0x5acfa111, 0x5acfb485, 0x5acfc509, 0x5ad00659, 0x5ad01609, 0x5ad02ed9, 0x5ad040da, 0x5ad0538a,
+    0x5ad05685, 0x5ad07fd5, 0x5ad08056, 0x5ad0d0d1, 0x5ad10925, 0x5ad121e5, 0x5ad133e5, 0x5ad184e5,
+    0x5ad1d085, 0x5ad21049, 0x5ad211d9, 0x5ad24ad9, 0x5ad2af45, 0x5ad2c525, 0x5ad2c5c9, 0x5ad2c74a,
+    0x5ad2cb25, 0x5ad2d8a5, 0x5ad33dd5, 0x5ad37aa5, 0x5ad37f26, 0x5ad6071a, 0x5ad6191a, 0x5ad65a5a,
+    0x5ad694da, 0x5ad6d3d6, 0x5ad6fc52, 0x5ad748ca, 0x5ad92ca5, 0x5add5061, 0x5adda151, 0x5addd989,
+    0x5adddb05, 0x5addf0d5, 0x5addf255, 0x5ade0461, 0x5ade04d6, 0x5ade1951, 0x5ade5551, 0x5adeced9,
+    0x5adee0c9, 0x5adee259, 0x5adf43d1, 0x5adf7fc5, 0x5adf82c9, 0x5adf95a1, 0x5adf9649, 0x5adf9ba1,
+    0x5adfa922, 0x5adfd1a1, 0x5ae04b21, 0x5ae04fa1, 0x5ae0b1c5, 0x5ae0b711, 0x5ae0c789, 0x5ae0ca85,
+    0x5ae0db09, 0x5ae0db96, 0x5ae11705, 0x5ae11c59, 0x5ae12c09, 0x5ae13f85, 0x5ae1435a, 0x5ae144d9,
+    0x5ae156da, 0x5ae158d9, 0x5ae1ceca, 0x5ae1d29d, 0x5ae1f74a, 0x5ae1fb1d, 0x5ae20b4a, 0x5ae21f09,
+    0x5ae23285, 0x5ae23655, 0x5ae237d5, 0x5ae249d5, 0x5ae270c9, 0x5ae2731d, 0x5ae273c5, 0x5ae2749d,
+    0x5ae28449, 0x5ae2869d, 0x5ae29ad1, 0x5ae2acc9, 0x5ae2af1d, 0x5ae2d609, 0x5ae2d905, 0x5ae2fd05,
+    0x5ae300da, 0x5ae30255, 0x5ae302d6, 0x5ae33b49, 0x5ae33e45, 0x5ae33f19, 0x5ae34e05, 0x5ae351da,
+    0x5ae35351, 0x5ae363c9, 0x5ae366c5, 0x5ae36799, 0x5ae37749, 0x5ae37999, 0x5ae37a19, 0x5ae37b99,
+    0x5ae3b4ca, 0x5ae3b7c5, 0x5ae405ca, 0x5ae408c5, 0x5ae42cca, 0x5ae44105, 0x5ae444d1, 0x5ae44651,
+    0x5ae456c9, 0x5ae459c5, 0x5ae46a49, 0x5ae46bc5, 0x5ae46c95, 0x5ae46d15, 0x5ae48245, 0x5ae4a645,
+    0x5ae4bb49, 0x5ae4cec5, 0x5ae4f505, 0x5ae4f809, 0x5ae50ad5, 0x5ae50b85, 0x5ae50f5a, 0x5ae510d5,
+    0x5ae51e55, 0x5ae522da, 0x5ae534c9, 0x5ae53659, 0x5ae54845, 0x5ae549c9, 0x5ae54c19, 0x5ae54cc5,
+    0x5ae54d99, 0x5ae55a45, 0x5ae55b19, 0x5ae55d49, 0x5ae56f51, 0x5ae573da, 0x5ae582c5, 0x5ae585c9,
+    0x5ae5acd1, 0x5ae5ad8a, 0x5ae5c34a, 0x5ae5c645, 0x5ae5d3c5, 0x5ae5d495, 0x5ae5e991, 0x5ae5ea49,
+    0x5ae5eec5, 0x5ae5ef91, 0x5ae6000a, 0x5ae60306, 0x5ae61085, 0x5ae612ca, 0x5ae624c5, 0x5ae63b4a,
+    0x5ae660d1, 0x5ae66251, 0x5ae666d1, 0x5ae675c5, 0x5ae678c9, 0x5ae69e45, 0x5ae69f11, 0x5ae6a391,
+    0x5ae6b285, 0x5ae6b4c5, 0x5ae6b589, 0x5ae6b705, 0x5aeaac51, 0x5aeabe49, 0x5aeabfc5, 0x5aeae851,
+    0x5aeafa45, 0x5aeb7255, 0x5aebae45, 0x5aebaf19, 0x5aebb399, 0x5aec5112, 0x5aec6485, 0x5aec6789,
+    0x5aefa81a, 0x5aeffb5a, 0x5af05c0a, 0x5af074d6, 0x5af09d52, 0x5af2b951, 0x5af2cda1, 0x5af43b9a,
+    0x5af440d9, 0x5af4dd8a, 0x5af4e2d1, 0x5af4f34a, 0x5af4f65e, 0x5af506ca, 0x5af52f4a, 0x5af60e19,
+    0x5af6219a, 0x5af626d9, 0x5af638da, 0x5af65fda, 0x5af662da, 0x5af689da, 0x5af69bd9, 0x5af6c38a,
+    0x5af6c8d1, 0x5af6d94a, 0x5af6dc56, 0x5af6ecca, 0x5af701ca, 0x5af704d2, 0x5af728ca, 0x5af73dca,
+    0x5af7514a, 0x5af842d5, 0x5af87ec5, 0x5af87f99, 0x5af92191, 0x5af93505, 0x5af9374a, 0x5afd40ca,
+    0x5b03311a, 0x5b039711, 0x5b03aa96, 0x5b03fce1, 0x5b0424e1, 0x5b060661, 0x5b073a95, 0x5b077509,
+    0x5b082e5e, 0x5b082fde, 0x5b086a5d, 0x5b08e3e5, 0x5b09ae59, 0x5b0bb859, 0x5b0bbcd9, 0x5b107bd6,
+    0x5b16cf05, 0x5b16f861, 0x5b16f8d5, 0x5b170d52, 0x5b170ed2, 0x5b174951, 0x5b179a55, 0x5b17c2d1,
+    0x5b17d645, 0x5b193f21, 0x5b1a7109, 0x5b1aad05, 0x5b1ab0d9, 0x5b1ab259, 0x5b1ac459, 0x5b1ac4d9,
+    0x5b1aecd9, 0x5b1b64de, 0x5b1b7849, 0x5b1b78c9, 0x5b1ba0c9, 0x5b1bdfd5, 0x5b1c1a49, 0x5b1c9305,
+    0x5b1c96d5, 0x5b1c9855, 0x5b1cd15a, 0x5b1cd45a, 0x5b1d0d49, 0x5b1d3505, 0x5b1d38d1, 0x5b1d3a51,
+    0x5b1d4ad6, 0x5b1d4dd6, 0x5b1d5e49, 0x5b1d5fc5, 0x5b1d7652, 0x5b1d9a45, 0x5b1daf49, 0x5b1dc2c5,
+    0x5b1e0049, 0x5b1e3c45, 0x5b1eb455, 0x5b1eb8d5, 0x5b1ef045, 0x5b1ef349, 0x5b1f9311, 0x5b1fa8c5,
+    0x5b22fe55, 0x5b23a051, 0x5b23b3d6, 0x5b23dc52, 0x5b2a1cd6, 0x5b2de8d9, 0x5b2e6255, 0x5b2e9cde,
+    0x5b3070d1, 0x5b30acd2, 0x60a49555, 0x60a53751, 0x60a59ca1, 0x60a59d2a, 0x60a5c521, 0x60a63ea5,
+    0x60a7a6a1, 0x60ab4e99, 0x60ab7719, 0x60abc815, 0x60abc895, 0x60ad5899, 0x60add215, 0x60b1a29a,
+    0x60b21c16, 0x60b24492, 0x60b93a95, 0x60b96336, 0x60bacb36, 0x60bf3e69, 0x60bf66e9, 0x60bf7a69,
+    0x60bf7ae9, 0x60bff3f6, 0x60c01c69, 0x60c14869, 0x60c15bf6, 0x60c18469, 0x60c1fdf6, 0x60c5ce69,
+    0x60c647f6, 0x60c7aff6, 0x60cb439a, 0x60cbbd16, 0x60d27669, 0x60d276ea, 0x60d29ee9, 0x60d48069,
+    0x60dee0c5, 0x60df0a21, 0x60df1f12, 0x60df5b11, 0x60dfd4a5, 0x60e36189, 0x60e36305, 0x60e3751d,
+    0x60e378dd, 0x60e37a5d, 0x60e4bc15, 0x60e4ce09, 0x60e4cf85, 0x60e4e199, 0x60e4e559, 0x60e4e6d9,
+    0x60e58391, 0x60e58751, 0x60e588d1, 0x60e5acc9, 0x60e5ae45, 0x60e5ebe5, 0x60e64ee6, 0x60e65066,
+    0x60e66565, 0x60e702d9, 0x60e70759, 0x60e7a4d1, 0x60e7a951, 0x60e7bb49, 0x60e7bcc5, 0x60e7f5e5,
+    0x60e86f65, 0x60eb1015, 0x60eb4cd9, 0x60ebb211, 0x60ebee12, 0x60ebeed2, 0x60ec3fe5, 0x60ecb965,
+    0x60f03385, 0x60f0495d, 0x60f1a005, 0x60f1b5d9, 0x60f257d1, 0x60f28061, 0x60f2a8e1, 0x60f2bc61,
+    0x60f2bce1, 0x60f2d091, 0x60f335f6, 0x60f35e61, 0x60f47575, 0x60f479f5, 0x60f488c5, 0x60f48d45,
+    0x60f4c661, 0x60f674d5, 0x60f688d5, 0x60f69d51, 0x60f69ef5, 0x60f80605, 0x60f809d1, 0x60f80b75,
+    0x60f81bca, 0x60f830c5, 0x60f88351, 0x60f8bdca, 0x60f8e4c5, 0x60f8e8b5, 0x60f8ea35, 0x60f91135,
+    0x60f924b5, 0x60f92535, 0x60f96155, 0x60f986c5, 0x60f98ab5, 0x60f98c35, 0x60fa2775, 0x60fa2bf5,
+    0x60fa3f45, 0x60fadff5, 0x60fae145, 0x60faf2b5, 0x60faf345, 0x60faf735, 0x60faf8b5, 0x60fb0635,
+    0x60fb0ab5, 0x60fb2eb5, 0x60fba835, 0x60fbacb5, 0x60fe7152, 0x60fe84d9, 0x60ffb555, 0x60ffddf6,
+    0x60fff235, 0x61015eb5, 0x61055311, 0x61058f12, 0x6105b861, 0x6105e0e1, 0x6107c261, 0x610b6a59,
+    0x610be3d5, 0x610e2ab5, 0x6111be5a, 0x611237d6, 0x61126052, 0x6118269a, 0x6118a016, 0x6118c892,
+    0x611e5215, 0x611f5965, 0x611f59e5, 0x611f81e5, 0x611ffb65, 0x61216365, 0x612c29f6, 0x612c5261,
+    0x612ccbf6, 0x6131dbf6, 0x61320459, 0x61325555, 0x6132f755, 0x61349c35, 0x6138a956, 0x6138d1d2,
+    0x6145005a, 0x614579d6, 0x6145a252, 0x66ba54a1, 0x66bbe526, 0x66bff496, 0x66c12465, 0x66c13665,
+    0x66c19de6, 0x66c21095, 0x66c21515, 0x66c24fa6, 0x66c30465, 0x66c308e5, 0x66c317e6, 0x66c31cea,
+    0x66c34065, 0x66c344e5, 0x66c3b9e6, 0x66c3be66, 0x66c6fc91, 0x66c78a65, 0x66c803e6, 0x66cf9755,
+    0x66d43529, 0x66d49855, 0x66d499d6, 0x66d54b96, 0x66d586d9, 0x66d58b59, 0x66d59f6a, 0x66d5c2d9,
+    0x66d5c759, 0x66d63d29, 0x66d67929, 0x66d6b5d6, 0x66d6ba56, 0x66daffd6, 0x66e30ce1, 0x66e8c359,
+    0x66e93cd5, 0x66e97749, 0x66f348a1, 0x66f35c05, 0x66f371d9, 0x66f3fe21, 0x66f413d1, 0x66f43962,
+    0x66f43ae2, 0x66f43c61, 0x66f44f05, 0x66f47861, 0x66f48ca5, 0x66f4f1e6, 0x66f635e5, 0x66f647e5,
+    0x66f64945, 0x66f99e05, 0x66f9c5d1, 0x66f9c765, 0x66f9dac6, 0x66fa16d9, 0x66fa1859, 0x66fa3d09,
+    0x66fa4005, 0x66fa67d5, 0x66fa6955, 0x66faa0c5, 0x66faa4a5, 0x66faa625, 0x66fab8d1, 0x66faba51,
+    0x66facac9, 0x66fadfc5, 0x66fb09e5, 0x66fb0b65, 0x66fb1d65, 0x66fb42e6, 0x66fb46a6, 0x66fb4826,
+    0x66fbe7e5, 0x66fbf9e5, 0x66fbfb45, 0x66fbfcd9, 0x66fbfe66, 0x66fc9be5, 0x66fc9d45, 0x66fcaf45,
+    0x66fcb325, 0x66fcb4a5, 0x66fcc225, 0x66fcc6a5, 0x66fd2755, 0x66fd6425, 0x66fd68a6, 0x6700e452,
+    0x67012051, 0x67017165, 0x670199e6, 0x6701ae26, 0x67031aa5, 0x67073861, 0x67074a4a, 0x67077522,
+    0x67078951, 0x6707b061, 0x6707c485, 0x6707edd6, 0x670802d1, 0x67081721, 0x670829c6, 0x67083ed1,
+    0x67096ad1, 0x67096dc5, 0x67097f21, 0x67097fc5, 0x670983a1, 0x6709bb21, 0x670da095, 0x670da145,
+    0x670dde06, 0x670df245, 0x670e2e51, 0x670e4049, 0x670e4345, 0x670e5545, 0x670e7d0a, 0x670eb845,
+    0x670ef455, 0x670ef505, 0x670ef8d5, 0x670efa56, 0x670f1d86, 0x670f31c5, 0x670f3349, 0x670f3599,
+    0x670f3646, 0x670f6f49, 0x670f9651, 0x670faa95, 0x670facc9, 0x670faf15, 0x670fd311, 0x670fd3c5,
+    0x670fd791, 0x670fe98a, 0x670fec86, 0x67100f11, 0x671024c5, 0x67106256, 0x67109e46, 0x6710a085,
+    0x671495d6, 0x6714a945, 0x6714d1c6, 0x6714e605, 0x67165285, 0x671cbba1, 0x67226d9a, 0x6722e4c9,
+    0x67230f91, 0x672320c5, 0x67232189, 0x67232305, 0x672d8096, 0x672de5e6, 0x673385da, 0x67341155,
+    0x6735a666, 0x673a6556, 0x673a8dd2, 0x6740b896, 0x6740e1d6, 0x6740f6d2, 0x67411dc6, 0x674132d1,
+    0x67472251, 0x67473756, 0x67475fc6, 0x6747eb45, 0x674813c6, 0x674825c6, 0x6d11a725, 0x6d1e77a1,
+    0x6d24cb91,
+};
@@ -0,0 +1,342 @@
+// ------------------------------------------------------ //
+// This file is autogenerated by book_gen; do not edit!  //
+// ------------------------------------------------------ //
+
+#pragma once
+
+#include "pico.h"
+
+#define book5x5_win_length 4
+#define book5x5_plies 6
+#define book5x5_depth 4
+#define book5x5_count 1305
+
+static const uint64_t __in_flash("book5x5") book5x5_entries[] = {
+    0x0000000000000033ull, 0x00000000000000b3ull, 0x00000000000001b3ull, 0x00000000000004b3ull,
+    0x0000000000016cb3ull, 0x00000000000445c7ull, 0x00000000040df89bull, 0x00000000040df99full,
+    0x00000000040dfb9full, 0x00000000040e019full, 0x000000000410d19full, 0x000000000410d21full,
+    0x000000000410d31full, 0x000000000410d61full, 0x000000000410df2full, 0x000000000410fa1full,
+    0x0000000004124246ull, 0x0000000004124823ull, 0x0000000004124a0full, 0x0000000004125a46ull,
+    0x0000000004125c46ull, 0x0000000004129046ull, 0x0000000004133246ull, 0x0000000004133446ull,
+    0x0000000004133a1bull, 0x0000000004134c46ull, 0x0000000004138246ull, 0x0000000004151747ull,
+    0x0000000004151846ull, 0x0000000004151a46ull, 0x0000000004152047ull, 0x0000000004153246ull,
+    0x0000000004156846ull, 0x0000000004160a46ull, 0x000000000416839bull, 0x000000000417f143ull,
+    0x000000000417f34aull, 0x000000000417f94aull, 0x0000000004180b4aull, 0x000000000418414aull,
+    0x000000000418e34aull, 0x0000000004195ea2ull, 0x00000000041961a2ull, 0x00000000041962a2ull,
+    0x0000000004196aa2ull, 0x0000000004196ba2ull, 0x0000000004196ea2ull, 0x00000000041985a2ull,
+    0x00000000041986a2ull, 0x00000000041989a2ull, 0x00000000041992a2ull, 0x000000000419d6afull,
+    0x000000000419d7a3ull, 0x000000000419daa3ull, 0x000000000419feafull, 0x00000000041da243ull,
+    0x0000000004244742ull, 0x0000000004262d42ull, 0x0000000004262dc3ull, 0x0000000004262ec3ull,
+    0x00000000042631c3ull, 0x00000000042655c3ull, 0x000000000428134bull, 0x00000000042cd246ull,
+    0x00000000042eb846ull, 0x0000000004309e9bull, 0x000000000430a29bull, 0x000000000430ab9bull,
+    0x000000000430c6b7ull, 0x00000000048cb1a2ull, 0x00000000048cb2a2ull, 0x00000000048cb5a2ull,
+    0x00000000048cd9a2ull, 0x00000000049aee37ull, 0x0000000004a3799aull, 0x0000000004a37d9aull,
+    0x0000000004a3869aull, 0x0000000004a3a19aull, 0x0000000004f8e846ull, 0x0000000004f8ea46ull,
+    0x0000000004f8f01bull, 0x0000000004f90246ull, 0x0000000004f93846ull, 0x0000000004fbc046ull,
+    0x0000000004fe994aull, 0x000000000509fd42ull, 0x0000000005128846ull, 0x0000000005681236ull,
+    0x0000000005684836ull, 0x0000000005690436ull, 0x0000000005693a36ull, 0x00000000056aea36ull,
+    0x00000000056b2036ull, 0x0000000005708236ull, 0x0000000005717436ull, 0x0000000005735a36ull,
+    0x0000000005735aa2ull, 0x0000000005735ba2ull, 0x0000000005735ea2ull, 0x00000000057382a2ull,
+    0x0000000005819737ull, 0x0000000005819836ull, 0x0000000005828a36ull, 0x0000000005847036ull,
+    0x00000000058a229aull, 0x00000000058a269aull, 0x00000000058a2f9aull, 0x00000000058a4a9aull,
+    0x0000000005b4da36ull, 0x0000000005b5cc36ull, 0x0000000005b7b236ull, 0x00000000064eba1bull,
+    0x00000000064ef01bull, 0x0000000006572a1bull, 0x0000000006684037ull, 0x00000000069b821bull,
+    0x0000000006c37b4aull, 0x0000000006c3b14aull, 0x0000000006c4dac2ull, 0x0000000006c4db8bull,
+    0x0000000006c4dec2ull, 0x0000000006c4f5c2ull, 0x0000000006c502c2ull, 0x0000000006c553c2ull,
+    0x0000000006c56ec2ull, 0x0000000006c65446ull, 0x0000000006c68a46ull, 0x0000000006c91fc2ull,
+    0x0000000006cbeb4aull, 0x0000000006d19dc2ull, 0x0000000006d1aac2ull, 0x0000000006d216c2ull,
+    0x0000000006d74f42ull, 0x0000000006dd014aull, 0x0000000006dfda46ull, 0x0000000006eb3ec2ull,
+    0x0000000006eb4bc2ull, 0x0000000006ebb7c2ull, 0x000000000710434aull, 0x0000000007382ec2ull,
+    0x00000000073849c2ull, 0x000000000744f1c2ull, 0x00000000075e92c2ull, 0x00000000081bf30full,
+    0x00000000081bf607ull, 0x00000000081bf70full, 0x00000000081bff1full, 0x00000000081c0003ull,
+    0x00000000081c0593ull, 0x00000000081c069full, 0x00000000081c129bull, 0x00000000081c1a1full,
+    0x00000000081c21afull, 0x00000000081c298bull, 0x00000000081c2ac7ull, 0x00000000081c6c1full,
+    0x00000000081c6f23ull, 0x00000000081c72bfull, 0x00000000081c782full, 0x00000000081c7aa3ull,
+    0x00000000081c7f9full, 0x00000000081c879bull, 0x00000000081c8b9bull, 0x00000000081c934bull,
+    0x00000000081ca3afull, 0x00000000081cb29bull, 0x00000000081cca9full, 0x00000000081d5e23ull,
+    0x00000000081d5f43ull, 0x00000000081d6223ull, 0x00000000081d659full, 0x00000000081d6b2full,
+    0x00000000081d6dafull, 0x00000000081d72b7ull, 0x00000000081d7a9full, 0x00000000081d7e9full,
+    0x00000000081d8623ull, 0x00000000081d969full, 0x00000000081da5c3ull, 0x00000000081dbdafull,
+    0x0000000008203743ull, 0x000000000820381bull, 0x0000000008203b1bull, 0x0000000008203ea3ull,
+    0x000000000820469bull, 0x0000000008204bafull, 0x00000000082053b7ull, 0x000000000820b01bull,
+    0x000000000821a323ull, 0x000000000823118full, 0x0000000008231487ull, 0x00000000082315caull,
+    0x0000000008231ecaull, 0x00000000082321caull, 0x00000000082339caull, 0x0000000008233ccaull,
+    0x00000000082389afull, 0x0000000008238acaull, 0x0000000008238dcaull, 0x00000000082396caull,
+    0x000000000823b1caull, 0x0000000008248b8bull, 0x0000000008248e87ull, 0x000000000824a6c6ull,
+    0x000000000824a987ull, 0x000000000824f7c6ull, 0x000000000824fb8full, 0x00000000082503c6ull,
+    0x00000000082504c6ull, 0x0000000008251ec6ull, 0x0000000008251fc6ull, 0x000000000825f6c6ull,
+    0x00000000082611c6ull, 0x00000000082612c6ull, 0x00000000082663c6ull, 0x0000000008293b1bull,
+    0x00000000082a2e1full, 0x00000000082b9c8bull, 0x00000000082b9fb7ull, 0x00000000082ba0caull,
+    0x00000000082ba88bull, 0x00000000082baccaull, 0x00000000082bc3afull, 0x00000000082bc4caull,
+    0x00000000082bc7caull, 0x00000000082bd0caull, 0x00000000082c14afull, 0x00000000082c15caull,
+    0x00000000082c18caull, 0x00000000082c21caull, 0x00000000082c3ccaull, 0x00000000082fe0cbull,
+    0x00000000082fe1caull, 0x00000000082fe4caull, 0x00000000082fedcaull, 0x00000000083008caull,
+    0x00000000083059caull, 0x000000000831c7c6ull, 0x000000000832b9c6ull, 0x000000000832bac6ull,
+    0x000000000832bdc7ull, 0x00000000083332c6ull, 0x00000000083610c2ull, 0x00000000083611c2ull,
+    0x0000000008361dc2ull, 0x00000000083638cbull, 0x00000000083778c2ull, 0x00000000083779c2ull,
+    0x0000000008377cc2ull, 0x00000000083785c2ull, 0x000000000837a0c7ull, 0x00000000083a55c2ull,
+    0x00000000083a5ec2ull, 0x00000000083bbdc2ull, 0x000000000842dc1bull, 0x000000000845b5c3ull,
+    0x000000000845b6caull, 0x000000000845b9caull, 0x000000000845c2caull, 0x000000000845ddcaull,
+    0x000000000849facaull, 0x00000000084b68c6ull, 0x00000000085285caull, 0x00000000088f4a23ull,
+    0x00000000088f4dafull, 0x00000000088f531full, 0x00000000088f55a3ull, 0x00000000088f5a9full,
+    0x00000000088f6297ull, 0x00000000088f669bull, 0x00000000088f6e1bull, 0x00000000088f7e9full,
+    0x00000000088f8da3ull, 0x00000000088fa59full, 0x000000000890469full, 0x00000000089061afull,
+    0x000000000892479full, 0x00000000089248caull, 0x0000000008924bcaull, 0x00000000089254caull,
+    0x000000000892c0caull, 0x0000000008938b1bull, 0x0000000008947ec3ull, 0x00000000089664afull,
+    0x00000000089665caull, 0x00000000089668caull, 0x00000000089671caull, 0x0000000008968ccaull,
+    0x000000000896ddcaull, 0x000000000897dec6ull, 0x000000000897dfc6ull, 0x000000000897e287ull,
+    0x000000000897f9c6ull, 0x000000000897fac6ull, 0x00000000089806c6ull, 0x0000000008984bc6ull,
+    0x00000000089857c6ull, 0x0000000008994ac6ull, 0x00000000089c164bull, 0x00000000089d09afull,
+    0x00000000089eefbfull, 0x00000000089ef3caull, 0x00000000089f17caull, 0x00000000089f68caull,
+    0x0000000008a334caull, 0x0000000008a4aec6ull, 0x0000000008a60dc6ull, 0x0000000008a8ebc2ull,
+    0x0000000008a8ecc2ull, 0x0000000008a8f8c2ull, 0x0000000008a913cbull, 0x0000000008a964c2ull,
+    0x0000000008aa53c2ull, 0x0000000008aa57c2ull, 0x0000000008aa7bb7ull, 0x0000000008aaccc2ull,
+    0x0000000008ad30c2ull, 0x0000000008ad39c2ull, 0x0000000008ae98c2ull, 0x0000000008b5b71bull,
+    0x0000000008b6aa9full, 0x0000000008b890c3ull, 0x0000000008b891caull, 0x0000000008b894caull,
+    0x0000000008b89dcaull, 0x0000000008b8b8caull, 0x0000000008b909caull, 0x0000000008bcd5caull,
+    0x0000000008be4fc6ull, 0x0000000008c560caull, 0x0000000008cf5cc2ull, 0x0000000008cfd1c2ull,
+    0x0000000008d0c4c2ull, 0x0000000008d39dc2ull, 0x000000000975fc1full, 0x000000000975fe9full,
+    0x000000000976039full, 0x0000000009760ba3ull, 0x0000000009760f9bull, 0x000000000976174bull,
+    0x000000000976279full, 0x000000000976369bull, 0x0000000009764e9full, 0x000000000978d6caull,
+    0x000000000978d9caull, 0x000000000978f1caull, 0x000000000978f4caull, 0x0000000009794ecaull,
+    0x00000000097969caull, 0x00000000097d0ecaull, 0x00000000097d11caull, 0x00000000097e87c6ull,
+    0x00000000097e88c6ull, 0x00000000097e8b87ull, 0x00000000097ea2c6ull, 0x00000000097ea3c6ull,
+    0x00000000097eafc6ull, 0x00000000097ef4c6ull, 0x00000000097f00c6ull, 0x00000000097ff3c6ull,
+    0x000000000982bf1bull, 0x00000000098598cbull, 0x00000000098599caull, 0x0000000009859ccaull,
+    0x000000000985a5caull, 0x000000000985c0caull, 0x00000000098611caull, 0x000000000989ddcaull,
+    0x00000000098b57c6ull, 0x00000000098cb6c6ull, 0x00000000098f91c2ull, 0x00000000098f94c2ull,
+    0x00000000098f9dc2ull, 0x00000000098fb8c3ull, 0x00000000099009c2ull, 0x0000000009900dc2ull,
+    0x000000000990fcc2ull, 0x00000000099100c2ull, 0x00000000099124c3ull, 0x00000000099175c2ull,
+    0x000000000993d5c2ull, 0x000000000993d9c2ull, 0x000000000993e2bfull, 0x00000000099541c2ull,
+    0x00000000099c601bull, 0x00000000099f39a3ull, 0x00000000099f3acaull, 0x00000000099f3dcaull,
+    0x00000000099f46caull, 0x00000000099f61caull, 0x00000000099fb2caull, 0x0000000009a37ecaull,
+    0x0000000009a4f8c6ull, 0x0000000009ac09caull, 0x0000000009b601c2ull, 0x0000000009b67ac2ull,
+    0x0000000009b76dc2ull, 0x0000000009ba46c2ull, 0x0000000009ec29caull, 0x0000000009ec44caull,
+    0x0000000009f1dbc6ull, 0x0000000009f8eccaull, 0x000000000a02e4c2ull, 0x000000000a02e8c2ull,
+    0x000000000a128dcaull, 0x000000000ad073b6ull, 0x000000000ad074b6ull, 0x000000000ad077b6ull,
+    0x000000000ad08fb6ull, 0x000000000ad09bb6ull, 0x000000000ad166b6ull, 0x000000000ad167b6ull,
+    0x000000000ad16ab6ull, 0x000000000ad18eb6ull, 0x000000000ad1dfb6ull, 0x000000000ad4b8b6ull,
+    0x000000000ad5abb6ull, 0x000000000add37b6ull, 0x000000000add43b6ull, 0x000000000ade36b6ull,
+    0x000000000af6d8b6ull, 0x000000000af6e4b6ull, 0x000000000af7d7b6ull, 0x000000000b43c7bfull,
+    0x000000000b44baa3ull, 0x000000000edde51bull, 0x000000000edde60full, 0x000000000edde907ull,
+    0x000000000eddeccbull, 0x000000000eddf207ull, 0x000000000eddf5cbull, 0x000000000eddf9c7ull,
+    0x000000000ede019full, 0x000000000ede059full, 0x000000000ede0d0full, 0x000000000ede14a3ull,
+    0x000000000ede1da3ull, 0x000000000ede289full, 0x000000000ede299full, 0x000000000ede2c9full,
+    0x000000000ede5e23ull, 0x000000000ede65a3ull, 0x000000000ede6ea3ull, 0x000000000ede7a9full,
+    0x000000000edea1c3ull, 0x000000000edf5123ull, 0x000000000edf58dfull, 0x000000000edf61a3ull,
+    0x000000000edf6d9full, 0x000000000edf949full, 0x000000000ee0bf8full, 0x000000000ee0c2c2ull,
+    0x000000000ee0cbc2ull, 0x000000000ee0e6c2ull, 0x000000000ee137c2ull, 0x000000000ee22a1bull,
+    0x000000000ee2319bull, 0x000000000ee23ac3ull, 0x000000000ee246cfull, 0x000000000ee26d9bull,
+    0x000000000ee503c2ull, 0x000000000ee504cfull, 0x000000000ee507c2ull, 0x000000000ee510c2ull,
+    0x000000000ee52bc2ull, 0x000000000ee57cc2ull, 0x000000000eeab54bull, 0x000000000eeabccbull,
+    0x000000000eeac5cbull, 0x000000000eead19full, 0x000000000eeaf8c3ull, 0x000000000eed8ec2ull,
+    0x000000000ef1d3c2ull, 0x000000000ef7ffc3ull, 0x000000000ef8009full, 0x000000000ef803c3ull,
+    0x000000000ef80cc3ull, 0x000000000ef8279bull, 0x000000000ef8f2b3ull, 0x000000000ef8f3b3ull,
+    0x000000000ef8f6b3ull, 0x000000000ef8ffb3ull, 0x000000000ef91ac7ull, 0x000000000ef96bb3ull,
+    0x000000000efc44c3ull, 0x000000000efd37b3ull, 0x000000000f04561bull, 0x000000000f045dc7ull,
+    0x000000000f0466a3ull, 0x000000000f04729full, 0x000000000f04999full, 0x000000000f072fc2ull,
+    0x000000000f0730d7ull, 0x000000000f0733c2ull, 0x000000000f073cc2ull, 0x000000000f0757c2ull,
+    0x000000000f07a8c2ull, 0x000000000f0b74c2ull, 0x000000000f13ffc2ull, 0x000000000f1e70c3ull,
+    0x000000000f1f63b3ull, 0x000000000f51391bull, 0x000000000f5140c7ull, 0x000000000f5149cbull,
+    0x000000000f51559full, 0x000000000f517c9full, 0x000000000f5412c2ull, 0x000000000f54139full,
+    0x000000000f5416c2ull, 0x000000000f541fc2ull, 0x000000000f543ac2ull, 0x000000000f548bc2ull,
+    0x000000000f5857c2ull, 0x000000000f60e2c2ull, 0x000000000f6b53bfull, 0x000000000f6c46b3ull,
+    0x000000000f7a83c2ull, 0x00000000111edc4bull, 0x0000000011382c2full, 0x00000000116b6e23ull,
+    0x0000000012ebdd1bull, 0x0000000012ebe4c7ull, 0x0000000012ebed9bull, 0x0000000012ebf99full,
+    0x0000000012ec209full, 0x0000000012ec2e23ull, 0x0000000012eeb6c2ull, 0x0000000012eeb7c3ull,
+    0x0000000012eebac2ull, 0x0000000012eec3c2ull, 0x0000000012eedec2ull, 0x0000000012ef2fc2ull,
+    0x0000000012f2fbc2ull, 0x0000000012fb86c2ull, 0x0000000013057e1bull, 0x0000000013057e9full,
+    0x0000000013057f9full, 0x000000001305829full, 0x0000000013058b9full, 0x000000001305a6c7ull,
+    0x000000001305f79full, 0x000000001306eacbull, 0x000000001309c3c7ull, 0x00000000131527c2ull,
+    0x00000000132befc7ull, 0x000000001338c043ull, 0x0000000013620ac2ull, 0x000000001378d2c7ull,
+    0x0000000014b92f23ull, 0x0000000014ba229full, 0x0000000014bc30caull, 0x0000000014c04dcaull,
+    0x0000000014c1bbc6ull, 0x0000000014c1c7c6ull, 0x0000000014d2d0c2ull, 0x0000000014d2d1c2ull,
+    0x0000000014d2d4c2ull, 0x0000000014d2ddc2ull, 0x0000000014d2f89full, 0x0000000014d349c2ull,
+    0x0000000014d43cc2ull, 0x0000000014d715c2ull, 0x0000000014e279caull, 0x0000000014f941c2ull,
+    0x0000000015a2b2caull, 0x0000000015a2b5caull, 0x0000000015a2d9caull, 0x0000000015a32acaull,
+    0x0000000015a864c6ull, 0x0000000015af81caull, 0x0000000015b9f2c2ull, 0x00000000161605caull,
+    0x00000000162ccdc2ull, 0x0000000016fa50a3ull, 0x0000000016fa5ca3ull, 0x0000000016fb4fa3ull,
+    0x000000001a212523ull, 0x000000001a21289full, 0x000000001a21359full, 0x000000001a2141cbull,
+    0x000000001a2144c7ull, 0x000000001a30ceb3ull, 0x000000001a3ac6caull, 0x000000001a3ac7caull,
+    0x000000001a3acacaull, 0x000000001a3ad3dfull, 0x000000001a3aeecaull, 0x000000001a3b3fcaull,
+    0x000000001a3c32caull, 0x000000001a3f0bcaull, 0x000000001a4a6fcbull, 0x000000001a6137caull,
+    0x000000001ceec1caull, 0x000000001ceec2caull, 0x000000001ceec5caull, 0x000000001ceece9full,
+    0x000000001ceee9caull, 0x000000001cef3acaull, 0x000000001cf02dcaull, 0x000000001cf306caull,
+    0x000000001d1532caull, 0x000000001d554542ull, 0x000000001e31f6a3ull, 0x000000001e48becaull,
+    0x000000001ea2721bull, 0x000000001f17334aull, 0x0000000020efeaafull, 0x0000000021098ba3ull,
+    0x000000002109979full, 0x000000002bb5ddc2ull, 0x000000002d0d021full, 0x000000002d0df59full,
+    0x000000002d0fdfcaull, 0x000000002d1003caull, 0x000000002d1420caull, 0x000000002d158dc6ull,
+    0x000000002d158ec6ull, 0x000000002d15919bull, 0x000000002d1606c6ull, 0x000000002d16f9c6ull,
+    0x000000002d271cc2ull, 0x000000002e69d8caull, 0x000000002e6f8ac6ull, 0x0000000033d1cec2ull,
+    0x000000004f4a181bull, 0x0000000071929fa2ull, 0x000000007192baa2ull, 0x00000000719f62c3ull,
+    0x0000000071a0cf4bull, 0x0000000071a95a9aull, 0x0000000071a95e9aull, 0x0000000071a9679aull,
+    0x0000000071a9829aull, 0x0000000071b903c3ull, 0x000000007595341full, 0x00000000759536afull,
+    0x0000000075953b9full, 0x00000000759543b7ull, 0x000000007595479bull, 0x0000000075954f1bull,
+    0x0000000075955f9full, 0x0000000075956e9bull, 0x000000007595869full, 0x000000007595c99full,
+    0x00000000759828afull, 0x00000000759829caull, 0x0000000075982ccaull, 0x00000000759835caull,
+    0x000000007598a1caull, 0x00000000759c6dcaull, 0x00000000759dbfc6ull, 0x00000000759dc0c6ull,
+    0x00000000759dc387ull, 0x00000000759ddac6ull, 0x00000000759ddbc6ull, 0x00000000759de7c6ull,
+    0x00000000759e38c6ull, 0x00000000759f2bc6ull, 0x00000000759f46c6ull, 0x0000000075a1f71full,
+    0x0000000075a2719full, 0x0000000075a4d0afull, 0x0000000075a4d4caull, 0x0000000075a4f8caull,
+    0x0000000075a549caull, 0x0000000075a915caull, 0x0000000075aa82c6ull, 0x0000000075aa83c6ull,
+    0x0000000075aa86c7ull, 0x0000000075aa8fc6ull, 0x0000000075aaaac6ull, 0x0000000075aafbc6ull,
+    0x0000000075abeec6ull, 0x0000000075af45c2ull, 0x0000000075b034c2ull, 0x0000000075b038c2ull,
+    0x0000000075b05cafull, 0x0000000075b0adc2ull, 0x0000000075b311c2ull, 0x0000000075b31aafull,
+    0x0000000075b479c2ull, 0x0000000075bb981bull, 0x0000000075bc12a3ull, 0x0000000075be71c3ull,
+    0x0000000075be72caull, 0x0000000075be75caull, 0x0000000075be7ecaull, 0x0000000075be99caull,
+    0x0000000075beeacaull, 0x0000000075c2b6caull, 0x0000000075c424c6ull, 0x0000000075c430c6ull,
+    0x0000000075c58fc6ull, 0x0000000075cb41caull, 0x0000000075d0f3c6ull, 0x0000000075d5b2c2ull,
+    0x0000000075d6a5c2ull, 0x0000000075d97ec2ull, 0x00000000760996afull, 0x00000000760b7ccaull,
+    0x00000000761113c6ull, 0x0000000076163e9full, 0x00000000761dd6c6ull, 0x00000000762220c2ull,
+    0x00000000762fdfc7ull, 0x000000007631c5caull, 0x0000000076f225caull, 0x0000000076f7bcc6ull,
+    0x0000000076fecdcaull, 0x0000000077047fc6ull, 0x000000007708c5c2ull, 0x0000000077186ecaull,
+    0x0000000078494ab6ull, 0x0000000078494eb6ull, 0x00000000784957b6ull, 0x00000000784d8fb6ull,
+    0x000000007855f2b6ull, 0x000000007855f6b6ull, 0x000000007855ffb6ull, 0x00000000785a37b6ull,
+    0x00000000786f93b6ull, 0x00000000786f97b6ull, 0x00000000786fa0b6ull, 0x000000007873d8b6ull,
+    0x000000007c5721a3ull, 0x000000007c572acbull, 0x000000007c5736cfull, 0x000000007c575dc3ull,
+    0x000000007c59f3c2ull, 0x000000007c5e38c2ull, 0x000000007c7134abull, 0x000000007c7227b3ull,
+    0x000000007c8064c2ull, 0x000000007ccd47c2ull, 0x000000007dbc7ba2ull, 0x000000008067ebc2ull,
+    0x00000000807eb3c7ull, 0x0000000081bf8a9full, 0x0000000081c211caull, 0x0000000081c79cc6ull,
+    0x0000000081c7a8c6ull, 0x0000000081c907c6ull, 0x0000000081d46bc6ull, 0x0000000081d8b5c2ull,
+    0x0000000081d8bec2ull, 0x0000000081d92ac2ull, 0x0000000081da1dc2ull, 0x0000000081e85acaull,
+    0x0000000081ff22c2ull, 0x00000000823357c3ull, 0x00000000824c05c2ull, 0x0000000084730b9bull,
+    0x0000000084730fc3ull, 0x00000000847318a3ull, 0x000000008477509bull, 0x000000008727099full,
+    0x000000008727169full, 0x00000000872722a3ull, 0x00000000872725c7ull, 0x000000008736afc7ull,
+    0x000000008740cfcaull, 0x00000000874120caull, 0x000000008744ec8full, 0x00000000875050cbull,
+    0x0000000087b3fbcaull, 0x0000000089f4a3caull, 0x0000000089f4cacaull, 0x000000008a1b13caull,
+    0x000000008a67f6caull, 0x000000008b37d79full, 0x000000008b4e9fcaull, 0x000000008df5cbaeull,
+    0x000000008e0f6caeull, 0x000000008e0f78aeull, 0x0000000096104ea2ull, 0x0000000098bbbec2ull,
+    0x000000009a135da3ull, 0x000000009a15c0caull, 0x000000009a15e4caull, 0x000000009a1b6fc6ull,
+    0x000000009a1b7bc6ull, 0x000000009a1cdac6ull, 0x000000009a283ec6ull, 0x000000009a2c84c2ull,
+    0x000000009a2cfdc2ull, 0x000000009a30c9c2ull, 0x000000009a3c2dcaull, 0x000000009a5feec7ull,
+    0x000000009a872ac7ull, 0x000000009a8ec2c6ull, 0x000000009b6fb9caull, 0x000000009cc6dec3ull,
+    0x000000009cc6e2c3ull, 0x000000009cc6ebc3ull, 0x000000009ccb239bull, 0x00000000a0d7afc2ull,
+    0x00000000a6566dc2ull, 0x00000000abbe63caull, 0x00000000ae725ecaull, 0x00000000df04c446ull,
+    0x00000000df04fa46ull, 0x00000000df15bf42ull, 0x00000000df1e4a46ull, 0x00000000e05ab236ull,
+    0x00000000e0740236ull, 0x00000000e0a74436ull, 0x00000000e30efeafull, 0x00000000e31ba69full,
+    0x00000000e33547c3ull, 0x00000000e382529bull, 0x00000000e38efa9full, 0x00000000e3a89b9full,
+    0x00000000eb2a9e2eull, 0x00000000eb43ee2eull, 0x00000000ef38bfa3ull, 0x00000000f7610742ull,
+    0x00000001078c929full, 0x000000014c8525a2ull, 0x000000014c933a1bull, 0x000000014c96139eull,
+    0x000000014c96149eull, 0x000000014c96179eull, 0x000000014c96209eull, 0x000000014c963b9eull,
+    0x000000014c968cb7ull, 0x000000014c9a58c7ull, 0x000000014c9bc59aull, 0x000000014c9bc99aull,
+    0x000000014c9bd29aull, 0x000000014c9bed9aull, 0x000000014cbc84b7ull, 0x000000014d09679eull,
+    0x000000014df0109eull, 0x000000014f2de54bull, 0x000000014f473547ull, 0x000000015087ba1bull,
+    0x000000015087ca9full, 0x000000015087d9afull, 0x000000015087f1afull, 0x00000001508a939full,
+    0x00000001508a94caull, 0x00000001508a97caull, 0x00000001508aa0caull, 0x00000001508b0ccaull,
+    0x00000001508ed8caull, 0x00000001509045c6ull, 0x00000001509046c6ull, 0x000000015094621full,
+    0x0000000150973bb7ull, 0x0000000150973ccaull, 0x0000000150973fcaull, 0x00000001509763caull,
+    0x00000001509b80caull, 0x00000001509cedc6ull, 0x00000001509ceec6ull, 0x00000001509cf1afull,
+    0x00000001509cfac6ull, 0x00000001509d15c6ull, 0x00000001509d66c6ull, 0x00000001509e59c6ull,
+    0x0000000150a1b09bull, 0x0000000150a29fafull, 0x0000000150a2a3afull, 0x0000000150a2c7afull,
+    0x0000000150a318afull, 0x0000000150a57ccbull, 0x0000000150a585afull, 0x0000000150a6e4afull,
+    0x0000000150b0dcc7ull, 0x0000000150b0ddcaull, 0x0000000150b0e0caull, 0x0000000150b104caull,
+    0x0000000150b155caull, 0x0000000150b521caull, 0x0000000150b69bc6ull, 0x0000000150bdaccaull,
+    0x0000000150c35ec6ull, 0x0000000150c81dc7ull, 0x0000000150c910afull, 0x0000000150cbe9b7ull,
+    0x0000000150fde7caull, 0x00000001511041c6ull, 0x0000000151148b9bull, 0x00000001512430caull,
+    0x0000000151e490caull, 0x0000000151f6eac6ull, 0x0000000151fb309bull, 0x00000001520ad9caull,
+    0x00000001533bc2b6ull, 0x00000001533d21b6ull, 0x0000000153486ab6ull, 0x00000001534885b6ull,
+    0x0000000153620bb6ull, 0x0000000153636ab6ull, 0x00000001536eceb6ull, 0x0000000157498cc7ull,
+    0x00000001574995cbull, 0x000000015749a19full, 0x000000015749c8b3ull, 0x00000001574c5ecbull,
+    0x000000015750a3c7ull, 0x0000000157639fc7ull, 0x00000001576492c7ull, 0x000000015772cfc7ull,
+    0x0000000157bfb2cbull, 0x0000000158bffc9eull, 0x000000015b5a56a3ull, 0x000000015b711e9full,
+    0x000000015cb454cbull, 0x000000015cb455caull, 0x000000015cb47ccaull, 0x000000015cb899caull,
+    0x000000015cba07c6ull, 0x000000015cc6d6c6ull, 0x000000015ccb209bull, 0x000000015ccb959bull,
+    0x000000015ccc88afull, 0x000000015d27a8caull, 0x000000015d3e709full, 0x000000015e0e51caull,
+    0x000000015f6583cbull, 0x000000015f66e29full, 0x000000015f7246cbull, 0x000000016219749bull,
+    0x000000016219819full, 0x0000000162198d9bull, 0x000000016219909bull, 0x00000001621c4aa3ull,
+    0x00000001621c4ba3ull, 0x00000001621c4e9full, 0x00000001621c579full, 0x00000001621c72cbull,
+    0x00000001621cc3cbull, 0x0000000162208fcbull, 0x0000000162291ab3ull, 0x0000000162333acaull,
+    0x0000000162338bcaull, 0x00000001623757caull, 0x000000016242bbcbull, 0x00000001628f9ecbull,
+    0x0000000162a666caull, 0x0000000164e70ecaull, 0x00000001655a61caull, 0x00000001662a42a3ull,
+    0x0000000166410acaull, 0x0000000168e835aeull, 0x0000000168e836aeull, 0x0000000168e839aeull,
+    0x0000000168e8aeaeull, 0x0000000168e9a1aeull, 0x000000016901d7aeull, 0x00000001695b89c7ull,
+    0x000000017113cf9eull, 0x0000000173ae29a3ull, 0x000000017508279full, 0x00000001750828caull,
+    0x0000000175082bcaull, 0x00000001750834caull, 0x0000000175084fcaull, 0x000000017508a0caull,
+    0x00000001750c6ccaull, 0x00000001750ddac6ull, 0x000000017514f7caull, 0x00000001751eefb7ull,
+    0x00000001751f68c7ull, 0x00000001752e98caull, 0x00000001757b7bcaull, 0x0000000175812dc6ull,
+    0x00000001766224caull, 0x0000000177b956b7ull, 0x0000000177bab5b7ull, 0x000000017bca1acbull,
+    0x00000001813210caull, 0x00000001869a06cbull, 0x0000000186b0cecaull, 0x00000001ba0f489eull,
+    0x00000001be03c8caull, 0x00000001be2a11caull, 0x00000001cf957fcbull, 0x00000001e2815ccaull,
+    0x0000000294e5622full, 0x0000000294e9d046ull, 0x0000000294f50baeull, 0x0000000295032046ull,
+    0x00000002950e84aeull, 0x00000002950e85afull, 0x00000002950e88aeull, 0x00000002950e91aeull,
+    0x00000002950eacaeull, 0x00000002950efdaeull, 0x000000029512c9aeull, 0x00000002951b54aeull,
+    0x000000029581d8aeull, 0x00000002963f8836ull, 0x00000002966881b7ull, 0x0000000297995d9aull,
+    0x0000000297995ec7ull, 0x000000029799619aull, 0x0000000297996a9aull, 0x000000029799d69aull,
+    0x00000002979ac9cbull, 0x00000002979da29aull, 0x0000000297a62d9aull, 0x0000000297bfa69aull,
+    0x0000000297bfce9aull, 0x00000002980cb19aull, 0x0000000298f4c7c7ull, 0x0000000298f4c89full,
+    0x0000000298f7a0a3ull, 0x000000029919a5a2ull, 0x000000029919a8a2ull, 0x000000029919b1a2ull,
+    0x000000029919cccfull, 0x00000002991a1da2ull, 0x00000002991b10a2ull, 0x00000002991b11a2ull,
+    0x00000002991de9a2ull, 0x000000029926749full, 0x000000029966b0cbull, 0x000000029966b39bull,
+    0x0000000299681bc7ull, 0x00000002998cf8a2ull, 0x00000002998cf9a2ull, 0x00000002998cfca2ull,
+    0x00000002998e64a2ull, 0x000000029a4ec4c7ull, 0x000000029a73a1a2ull, 0x000000029a750da2ull,
+    0x000000029ac0acc7ull, 0x00000002a0287a9aull, 0x00000002a0287ba3ull, 0x00000002a0287e9aull,
+    0x00000002a028879aull, 0x00000002a028a29aull, 0x00000002a02cbf9aull, 0x00000002a11eccaeull,
+    0x00000002a1386daeull, 0x00000002a3c31e9aull, 0x00000002a3c31f9bull, 0x00000002a3c3229aull,
+    0x00000002a3c32b9aull, 0x00000002a3c3469aull, 0x00000002a3c7639aull, 0x00000002a51d1da2ull,
+    0x00000002a51d20a2ull, 0x00000002a51d29a2ull, 0x00000002a51d44a3ull, 0x00000002a51d95a2ull,
+    0x00000002a51e88a2ull, 0x00000002a51e89a2ull, 0x00000002a52161a2ull, 0x00000002a529eccbull,
+    0x00000002a5438da2ull, 0x00000002a59070a2ull, 0x00000002a59071a2ull, 0x00000002a59074a2ull,
+    0x00000002a67719a2ull, 0x00000002aa867ea3ull, 0x00000002aa867fc7ull, 0x00000002aa8682c7ull,
+    0x00000002aa868b9full, 0x00000002aa86a6a3ull, 0x00000002aa8ac3a3ull, 0x00000002aa934e9full,
+    0x00000002aaacefa3ull, 0x00000002ae930ac7ull, 0x00000002ae930bc7ull, 0x00000002ae930ec7ull,
+    0x00000002ae93179full, 0x00000002ae9332c7ull, 0x00000002ae974fc7ull, 0x00000002b9729faeull,
+    0x00000002b98c40aeull, 0x00000002bc16f19aull, 0x00000002bc16f29bull, 0x00000002bc16f59aull,
+    0x00000002bc16fe9aull, 0x00000002bc17199aull, 0x00000002bc1b369aull, 0x00000002bd725ba2ull,
+    0x00000002bd725ca2ull, 0x00000002bd725fa2ull, 0x00000002bd7268a2ull, 0x00000002bd72839full,
+    0x00000002bd7534a2ull, 0x00000002bd76a0a2ull, 0x00000002bd7f2b9full, 0x00000002bd9760a2ull,
+    0x00000002bd98cca2ull, 0x00000002bde444a2ull, 0x00000002bde447a2ull, 0x00000002becaeca2ull,
+    0x00000002becaeda2ull, 0x00000002becaf0a2ull, 0x00000002becaf9a2ull, 0x00000002becb14cbull,
+    0x00000002becf31a2ull, 0x00000002c432e29aull, 0x00000002c432e3d7ull, 0x00000002c432e69aull,
+    0x00000002c432ef9aull, 0x00000002c4330a9aull, 0x00000002c437279aull, 0x00000002c99ad8a2ull,
+    0x000000030287b9aeull, 0x000000030512929aull, 0x000000030692d9a2ull, 0x0000000307c68d9full,
+    0x00000003129651a2ull, 0x00000003d94e6ea2ull, 0x00000003d965afb7ull, 0x00000003d9bfdcc3ull,
+    0x00000003d9d88a9aull, 0x00000003d9e6259bull, 0x00000003daa86ba2ull, 0x00000003dabf339aull,
+    0x00000003daceb497ull, 0x00000003e161d4a3ull, 0x00000003e1624dcaull, 0x00000003e167869bull,
+    0x00000003e18896caull, 0x00000003e1d528caull, 0x00000003e1fb71caull, 0x00000003e2bbd1caull,
+    0x00000003e2e21acaull, 0x00000003e4136fb6ull, 0x00000003e439b8b6ull, 0x00000003e5e99dafull,
+    0x00000003e6024b9aull, 0x00000003e6d22ca2ull, 0x00000003e820d69bull, 0x00000003e820e29full,
+    0x00000003e82109c3ull, 0x00000003e83ae0c3ull, 0x00000003e83bd3b3ull, 0x00000003e84a10d7ull,
+    0x00000003fe3d709bull, 0x0000000406586e9bull, 0x0000000446c5bdc3ull, 0x0000000446de6b9aull,
+    0x0000000446ec069bull, 0x000000044edb09caull, 0x000000044f0152caull, 0x0000000453082c9aull,
+    0x000000046b43519bull, 0x000000046b8f41a3ull, 0x00000004b43e79afull, 0x00000004b464c2afull,
+    0x00000004d8bc0dafull, 0x0000000529cd74caull, 0x000000066a22d7afull, 0x000000066a2442b3ull,
+    0x000000066a4920b3ull, 0x000000066a4a8bb7ull, 0x000000066e5165aeull, 0x0000000670dc3e9aull,
+    0x0000000672363d9bull, 0x000000067237a8a3ull, 0x00000006725c85a2ull, 0x00000006725c86a2ull,
+    0x00000006725df1a2ull, 0x0000000672a9909bull, 0x0000000678f82f9aull, 0x000000068ea06bb3ull,
+    0x000000068ea1d6b3ull, 0x0000000696b3d1a2ull, 0x00000006dfaf719bull, 0x00000007b28b24afull,
+    0x00000007b2b16dafull, 0x00000007b34a68b7ull, 0x00000007df92c59eull, 0x00000007df92c69eull,
+    0x00000007df92c9c3ull, 0x00000008200459afull, 0x00000008202aa2afull, 0x00000008205049b7ull,
+    0x000000088d7d159bull, 0x000000088da35ec3ull, 0x000000088deff0a3ull, 0x00000008faf8aab3ull,
+    0x00000008fb1ef3b3ull, 0x00000009030df69eull, 0x000000090333c69eull, 0x000000090333c79eull,
+    0x0000000903343f9eull, 0x000000090335329eull, 0x0000000a436173caull, 0x0000000a4387bccaull,
+    0x0000000a476b25caull, 0x0000000a476b26caull, 0x0000000a476b9ecaull, 0x0000000a476c91caull,
+    0x0000000a4791e7caull, 0x0000000a47de79caull, 0x0000000a67df07caull, 0x0000000ab4e45aafull,
+    0x0000000bfd6c4c9eull, 0x0000000c0160cc9full, 0x0000000c016663c6ull, 0x0000000c01776cc2ull,
+    0x0000000c017779c2ull, 0x0000000c0177949full, 0x0000000c018715c7ull, 0x0000000cd85eb79eull,
+    0x0000000cdc5337c7ull, 0x0000000e20b0dfaeull, 0x0000000e20d728aeull, 0x0000000e24bbffafull,
+    0x0000000e24e248a2ull, 0x0000000e493993a2ull, 0x0000000e9235349full, 0x00000017893218b6ull,
+    0x00000017893219b6ull, 0x0000001789321cb6ull, 0x000000178932259full, 0x00000017893240b6ull,
+    0x00000017893291b6ull, 0x000000178d27119aull, 0x000000178d2add9aull, 0x000000178d334d9aull,
+    0x000000178d33689aull, 0x000000178d4ce1a3ull, 0x000000178d4ce29aull, 0x000000178d4ce59aull,
+    0x000000178d4cee9aull, 0x000000178d4d099aull, 0x000000178d4d5a9aull, 0x000000178e80959aull,
+    0x0000001793e870cfull, 0x0000001793e88b9bull, 0x000000179950669aull, 0x000000179950819aull,
+    0x000000179eb85c9full, 0x000000179eb877a2ull, 0x00000017a16c72a2ull, 0x00000017b1a42ca3ull,
+    0x00000017b1a42d9aull, 0x00000017b1a4309aull, 0x00000017b1a4399aull, 0x00000017b1a4549aull,
+    0x00000018d592389aull, 0x0000002318ef8ea3ull, 0x0000002318f215caull, 0x0000002318f7a0c6ull,
+    0x000000231ba30fb6ull, 0x000000231ba313b6ull, 0x000000231ba31cb6ull, 0x000000238668c39full,
+    0x00000025a9c655a2ull, 0x00000025a9c656a2ull, 0x00000025a9c659a2ull, 0x00000025a9c662a2ull,
+    0x00000025a9c67d9bull, 0x00000067ee274da2ull, 0x00000067ee3e159aull, 0x00000067f229e21full,
+    0x00000067f229f2c7ull, 0x00000067f22a01b7ull, 0x00000067f22a199bull, 0x00000067f22cbfcaull,
+    0x00000067f22cc8caull, 0x00000067f2326dc6ull, 0x00000067f2326ec6ull, 0x00000067f232719bull,
+    0x00000067f2327ac6ull, 0x00000067f232e6c6ull, 0x00000067f233d9c6ull, 0x00000067f2398bcaull,
+    0x00000067f23f3dc6ull, 0x00000067f244efafull, 0x00000067f25308caull, 0x00000067f25311caull,
+    0x00000067f258c3c6ull, 0x00000067f258dec6ull, 0x00000067f2a5c1c6ull, 0x00000067f38c6ac6ull,
+    0x00000067f4ddeab6ull, 0x00000067f4eaadb6ull, 0x00000067f50426b6ull, 0x00000067f5044eb6ull,
+    0x00000067f8ebf0c3ull, 0x00000067fe56a4caull, 0x00000067fe5c56c6ull, 0x000000680107c69bull,
+    0x0000006803d562caull, 0x000000680a7db5aeull, 0x000000680a7db6aeull, 0x000000680a7db9aeull,
+    0x000000680a7e2eaeull, 0x000000680a7f21aeull, 0x000000680aa3ffaeull, 0x000000680af109cbull,
+    0x0000006816aa53caull, 0x0000006816aa5ccaull, 0x0000006816b002c6ull, 0x0000006816c1179full,
+    0x00000068195b719full, 0x0000006a83276cafull, 0x0000007f09bb2c9aull, 0x0000007f09e174b7ull,
+    0x0000007f09e1759aull, 0x0000007f2e38c09aull, 0x0000008a958681caull, 0x0000008a958c33c6ull,
+    0x000000cfd82e2046ull,
+};
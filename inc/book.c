@@ -0,0 +1,141 @@
+#include "book.h"
+
+// Posição de uma célula após cada uma das 8 simetrias do tabuleiro: identidade, rotações de
+// 90/180/270 graus, espelhos horizontal/vertical e as duas diagonais. Calculada em vez de
+// tabelada para que a consulta não leia da flash nada além das entradas do banco.
+static uint8_t book_transform(uint8_t size, uint8_t transform, uint8_t row, uint8_t col) {
+    uint8_t last = size - 1;
+
+    switch (transform) {
+        case 1: return col * size + (last - row);
+        case 2: return (last - row) * size + (last - col);
+        case 3: return (last - col) * size + row;
+        case 4: return row * size + (last - col);
+        case 5: return (last - row) * size + col;
+        case 6: return col * size + row;
+        case 7: return (last - col) * size + (last - row);
+        default: return row * size + col;
+    }
+}
+
+// Simetria inversa (as rotações de 90 e 270 graus se desfazem mutuamente; as demais são involuções)
+static uint8_t book_inverse(uint8_t transform) {
+    return transform == 1 ? 3 : transform == 3 ? 1 : transform;
+}
+
+// Calcula a chave canônica (menor chave entre as 8 simetrias) e a simetria que a produz
+static uint64_t book_canonical(const uint8_t *cells, uint8_t size, uint8_t *transform) {
+    uint64_t best = UINT64_MAX;
+
+    for (uint8_t t = 0; t < BOOK_SYMMETRIES; t++) {
+        uint8_t moved[BOOK5_CELLS];
+        uint64_t key = 0;
+
+        for (uint8_t row = 0; row < size; row++) {
+            for (uint8_t col = 0; col < size; col++) {
+                moved[book_transform(size, t, row, col)] = cells[row * size + col];
+            }
+        }
+        for (int8_t i = size * size - 1; i >= 0; i--) {
+            key = key * 3 + moved[i];
+        }
+
+        if (key < best) {
+            best = key;
+            if (transform) {
+                *transform = t;
+            }
+        }
+    }
+    return best;
+}
+
+// Número de passos da busca binária (bits significativos da quantidade de entradas)
+static uint8_t book_reads(uint32_t count) {
+    uint8_t reads = 0;
+
+    for (; count > 0; count >>= 1) {
+        reads++;
+    }
+    return reads;
+}
+
+uint32_t book_key(const uint8_t cells[BOOK_CELLS], uint8_t *transform) {
+    return (uint32_t)book_canonical(cells, BOOK_SIZE, transform);
+}
+
+// Converte uma jogada do referencial canônico de volta para o tabuleiro original
+uint8_t book_map_move(uint8_t transform, uint8_t canonical_move) {
+    return book_transform(BOOK_SIZE, book_inverse(transform), canonical_move / BOOK_SIZE, canonical_move % BOOK_SIZE);
+}
+
+// Número máximo de entradas lidas da flash por uma consulta (busca binária)
+uint8_t book_max_reads(const book_t *book) {
+    return book_reads(book->count);
+}
+
+// Procura a melhor jogada para a posição; retorna false se ela não estiver no banco
+bool book_lookup(const book_t *book, const uint8_t cells[BOOK_CELLS], book_move_t *move) {
+    uint8_t transform = 0;
+    uint32_t key = book_key(cells, &transform);
+    uint32_t low = 0, high = book->count;
+
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        uint32_t entry = book->entries[mid]; // Única leitura de dados da flash por passo
+        uint32_t entry_key = entry >> BOOK_KEY_SHIFT;
+
+        if (entry_key < key) {
+            low = mid + 1;
+        } else if (entry_key > key) {
+            high = mid;
+        } else {
+            uint8_t cell = book_map_move(transform, (entry >> BOOK_MOVE_SHIFT) & BOOK_MOVE_MASK);
+
+            move->row = cell / BOOK_SIZE;
+            move->col = cell % BOOK_SIZE;
+            move->outcome = (book_outcome_t)(entry & BOOK_OUTCOME_MASK);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t book5_key(const uint8_t cells[BOOK5_CELLS], uint8_t *transform) {
+    return book_canonical(cells, BOOK5_SIZE, transform);
+}
+
+uint8_t book5_map_move(uint8_t transform, uint8_t canonical_move) {
+    return book_transform(BOOK5_SIZE, book_inverse(transform), canonical_move / BOOK5_SIZE, canonical_move % BOOK5_SIZE);
+}
+
+uint8_t book5_max_reads(const book5_t *book) {
+    return book_reads(book->count);
+}
+
+// Mesma busca do 4x4, sobre as entradas de 64 bits do livro de aberturas 5x5
+bool book5_lookup(const book5_t *book, const uint8_t cells[BOOK5_CELLS], book_move_t *move) {
+    uint8_t transform = 0;
+    uint64_t key = book5_key(cells, &transform);
+    uint32_t low = 0, high = book->count;
+
+    while (low < high) {
+        uint32_t mid = low + (high - low) / 2;
+        uint64_t entry = book->entries[mid]; // Única leitura de dados da flash por passo
+        uint64_t entry_key = entry >> BOOK5_KEY_SHIFT;
+
+        if (entry_key < key) {
+            low = mid + 1;
+        } else if (entry_key > key) {
+            high = mid;
+        } else {
+            uint8_t cell = book5_map_move(transform, (entry >> BOOK_MOVE_SHIFT) & BOOK5_MOVE_MASK);
+
+            move->row = cell / BOOK5_SIZE;
+            move->col = cell % BOOK5_SIZE;
+            move->outcome = (book_outcome_t)(entry & BOOK_OUTCOME_MASK);
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,70 @@
+#ifndef BOOK_H
+#define BOOK_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Banco de jogadas resolvidas para o jogo da velha 4x4 (gerado por tools/book_gen.c)
+#define BOOK_SIZE 4
+#define BOOK_CELLS (BOOK_SIZE * BOOK_SIZE)
+#define BOOK_SYMMETRIES 8
+
+// Conteúdo de uma célula (índice = linha * BOOK_SIZE + coluna)
+#define BOOK_EMPTY 0
+#define BOOK_X 1
+#define BOOK_O 2
+
+// Formato de cada entrada (32 bits): [31:6] chave canônica em base 3,
+// [5:2] jogada no referencial canônico, [1:0] resultado para quem joga
+#define BOOK_KEY_SHIFT 6
+#define BOOK_MOVE_SHIFT 2
+#define BOOK_MOVE_MASK 0x0F
+#define BOOK_OUTCOME_MASK 0x03
+
+// Livro de aberturas parcial do 5x5 (primeiros lances); 3^25 posições exigem chaves de 40 bits,
+// então cada entrada tem 64 bits: [63:7] chave canônica, [6:2] jogada, [1:0] resultado
+#define BOOK5_SIZE 5
+#define BOOK5_CELLS (BOOK5_SIZE * BOOK5_SIZE)
+#define BOOK5_KEY_SHIFT 7
+#define BOOK5_MOVE_MASK 0x1F
+
+typedef enum {
+    BOOK_LOSS = 0,
+    BOOK_DRAW = 1,
+    BOOK_WIN = 2,
+    BOOK_UNKNOWN = 3 // Não provado dentro do horizonte da busca (livro 5x5)
+} book_outcome_t;
+
+// Tabela ordenada pela chave; consultada diretamente na flash (XIP), sem cópia para a RAM
+typedef struct {
+    const uint32_t *entries;
+    uint32_t count;
+} book_t;
+
+typedef struct {
+    const uint64_t *entries;
+    uint32_t count;
+} book5_t;
+
+typedef struct {
+    uint8_t row, col;
+    book_outcome_t outcome;
+} book_move_t;
+
+// Banco do 4x4 com 4 em linha gravado na flash (inc/book4x4.c)
+extern const book_t book4x4;
+
+// Livro de aberturas do 5x5 com 4 em linha gravado na flash (inc/book5x5.c)
+extern const book5_t book5x5;
+
+uint32_t book_key(const uint8_t cells[BOOK_CELLS], uint8_t *transform);
+uint8_t book_map_move(uint8_t transform, uint8_t canonical_move);
+uint8_t book_max_reads(const book_t *book);
+bool book_lookup(const book_t *book, const uint8_t cells[BOOK_CELLS], book_move_t *move);
+
+uint64_t book5_key(const uint8_t cells[BOOK5_CELLS], uint8_t *transform);
+uint8_t book5_map_move(uint8_t transform, uint8_t canonical_move);
+uint8_t book5_max_reads(const book5_t *book);
+bool book5_lookup(const book5_t *book, const uint8_t cells[BOOK5_CELLS], book_move_t *move);
+
+#endif
@@ -0,0 +1,5 @@
+#include "book.h"
+#include "generated/book4x4.h"
+
+// Tabela gerada por tools/book_gen.c, lida diretamente da seção .flashdata (XIP)
+const book_t book4x4 = {book4x4_entries, book4x4_count};
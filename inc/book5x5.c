@@ -0,0 +1,5 @@
+#include "book.h"
+#include "generated/book5x5.h"
+
+// Livro de aberturas gerado por tools/book_gen.c (-s 5), lido diretamente da seção .flashdata (XIP)
+const book5_t book5x5 = {book5x5_entries, book5x5_count};
@@ -1,4 +1,4 @@
-static uint8_t font[] = {
+static const uint8_t font[] = {
     0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // Nothing
     0x3e, 0x41, 0x41, 0x49, 0x41, 0x41, 0x3e, 0x00, // 0
     0x00, 0x00, 0x42, 0x7f, 0x40, 0x00, 0x00, 0x00, // 1
@@ -1,5 +1,9 @@
 #include "ssd1306.h"
 #include "font.h"
+#include <string.h>
+
+// Framebuffer estático (byte de controle 0x40 + 1 bit por pixel), alinhado em palavra para o I2C
+static uint8_t ssd1306_buffer[WIDTH * HEIGHT / 8 + 1] __attribute__((aligned(4)));
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
     ssd->width = width;
@@ -8,7 +12,9 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
     ssd->address = address;
     ssd->i2c_port = i2c;
     ssd->bufsize = ssd->pages * ssd->width + 1;
-    ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
+    hard_assert(ssd->bufsize <= sizeof(ssd1306_buffer));
+    ssd->ram_buffer = ssd1306_buffer;
+    memset(ssd->ram_buffer, 0, ssd->bufsize);
     ssd->ram_buffer[0] = 0x40;
     ssd->port_buffer[0] = 0x80;
 }
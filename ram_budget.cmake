@@ -0,0 +1,60 @@
+# Relatório de uso de RAM a partir do mapa do linker
+#
+# Uso: cmake -DMAP_FILE=<arquivo .map> -DRAM_BUDGET=<bytes> -P ram_budget.cmake
+# Soma todas as seções de saída cujo endereço cai na região RAM (.data, .bss, .heap,
+# .tdata/.tbss, .uninitialized_data, .ram_vector_table...) e falha se o total passar
+# do orçamento.
+
+if(NOT MAP_FILE OR NOT EXISTS "${MAP_FILE}")
+    message(FATAL_ERROR "Mapa do linker não encontrado: ${MAP_FILE}")
+endif()
+if(NOT DEFINED RAM_BUDGET OR NOT RAM_BUDGET MATCHES "^[1-9][0-9]*$")
+    message(FATAL_ERROR "RAM_BUDGET deve ser um número positivo de bytes")
+endif()
+
+file(READ "${MAP_FILE}" map)
+
+# Região RAM em "Memory Configuration": "RAM  0x20000000  0x00040000  xrw"
+if(NOT map MATCHES "\nRAM[ \t]+0x([0-9a-fA-F]+)[ \t]+0x([0-9a-fA-F]+)")
+    message(FATAL_ERROR "Região RAM não encontrada em ${MAP_FILE}")
+endif()
+math(EXPR ram_start "0x${CMAKE_MATCH_1}")
+math(EXPR ram_end "0x${CMAKE_MATCH_1} + 0x${CMAKE_MATCH_2}")
+math(EXPR ram_total "0x${CMAKE_MATCH_2}")
+
+# Seções de saída começam na coluna 0; nomes longos quebram o endereço para a linha seguinte
+string(REGEX MATCHALL "\n\\.[A-Za-z0-9_.]+[ \t\r\n]+0x[0-9a-fA-F]+[ \t]+0x[0-9a-fA-F]+" sections "${map}")
+
+set(used 0)
+set(found_data FALSE)
+set(found_bss FALSE)
+foreach(section IN LISTS sections)
+    string(REGEX MATCH "(\\.[A-Za-z0-9_.]+)[ \t\r\n]+0x([0-9a-fA-F]+)[ \t]+0x([0-9a-fA-F]+)" _ "${section}")
+    set(name "${CMAKE_MATCH_1}")
+    math(EXPR address "0x${CMAKE_MATCH_2}")
+    math(EXPR size "0x${CMAKE_MATCH_3}")
+
+    if(name STREQUAL ".data")
+        set(found_data TRUE)
+    elseif(name STREQUAL ".bss")
+        set(found_bss TRUE)
+    endif()
+
+    if(address GREATER_EQUAL ram_start AND address LESS ram_end AND size GREATER 0)
+        math(EXPR used "${used} + ${size}")
+        message(STATUS "RAM ${name}: ${size} bytes")
+    endif()
+endforeach()
+
+# Sem .data ou .bss o formato do mapa mudou e o total não seria confiável (.heap é opcional)
+if(NOT found_data OR NOT found_bss)
+    message(FATAL_ERROR "Seções .data/.bss não encontradas em ${MAP_FILE}; formato do mapa não reconhecido")
+endif()
+
+math(EXPR total_pct "${used} * 100 / ${ram_total}")
+math(EXPR budget_pct "${used} * 100 / ${RAM_BUDGET}")
+message(STATUS "RAM total: ${used} de ${RAM_BUDGET} bytes do orçamento (${budget_pct}%), ${total_pct}% da região RAM")
+
+if(used GREATER RAM_BUDGET)
+    message(FATAL_ERROR "Uso de RAM (${used} bytes) excede o orçamento de ${RAM_BUDGET} bytes")
+endif()
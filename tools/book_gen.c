@@ -0,0 +1,1106 @@
+// Gerador dos bancos de jogadas do jogo da velha 4x4 e 5x5 (executa no computador, não na placa)
+//
+// 4x4: resolve todas as posições alcançáveis com k em linha, extrai a estratégia ótima
+// da placa jogando como X e como O e grava as posições canônicas (com redução por simetria)
+// em uma tabela ordenada de entradas de 32 bits, consultada na flash por busca binária.
+//
+// 5x5: o espaço de estados é grande demais para resolver por completo, então gera um livro de
+// aberturas parcial com as posições dos primeiros lances, escolhendo as jogadas por uma busca
+// alfa-beta de profundidade limitada. O resultado só é gravado quando a busca o prova.
+//
+// Uso: book_gen [-s 4|5] [-k 3..5] [-o generated/book4x4.h] [-b book.bin] [--verify]
+//               [--plies N] [--depth D] (apenas 5x5)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "inc/book.h"
+
+#define NUM_KEYS 43046721u // 3^16 posições possíveis
+#define UNKNOWN INT8_MIN
+#define WIN_SCORE 100
+
+static int win_length = 0;
+static uint32_t pow3[BOOK_CELLS];
+
+// Linhas vencedoras que passam por cada célula
+static uint8_t lines[64][BOOK5_SIZE];
+static int num_lines = 0;
+static uint8_t cell_lines[BOOK_CELLS][64];
+static int cell_num_lines[BOOK_CELLS];
+
+// Pontuação de cada posição para quem joga: 100 - d vence em d lances, -(100 - d) perde, 0 empata
+static int8_t *score;
+
+static uint32_t *entries = NULL;
+static uint32_t num_entries = 0, cap_entries = 0;
+static uint8_t *stored; // Bitmap das chaves canônicas já gravadas
+static uint8_t *visited;
+
+static inline bool bit_get(const uint8_t *bits, uint32_t i) {
+    return bits[i >> 3] & (1u << (i & 7));
+}
+
+static inline void bit_set(uint8_t *bits, uint32_t i) {
+    bits[i >> 3] |= (uint8_t)(1u << (i & 7));
+}
+
+static void init_lines(void) {
+    static const int dirs[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+    pow3[0] = 1;
+    for (int i = 1; i < BOOK_CELLS; i++) {
+        pow3[i] = pow3[i - 1] * 3;
+    }
+
+    for (int r = 0; r < BOOK_SIZE; r++) {
+        for (int c = 0; c < BOOK_SIZE; c++) {
+            for (int d = 0; d < 4; d++) {
+                int er = r + dirs[d][0] * (win_length - 1);
+                int ec = c + dirs[d][1] * (win_length - 1);
+                if (er < 0 || er >= BOOK_SIZE || ec < 0 || ec >= BOOK_SIZE) {
+                    continue;
+                }
+                for (int i = 0; i < win_length; i++) {
+                    uint8_t cell = (r + dirs[d][0] * i) * BOOK_SIZE + c + dirs[d][1] * i;
+                    lines[num_lines][i] = cell;
+                    cell_lines[cell][cell_num_lines[cell]++] = (uint8_t)num_lines;
+                }
+                num_lines++;
+            }
+        }
+    }
+}
+
+// Verifica se a jogada na célula completou alguma linha
+static bool wins_at(const uint8_t cells[BOOK_CELLS], int cell) {
+    for (int l = 0; l < cell_num_lines[cell]; l++) {
+        const uint8_t *line = lines[cell_lines[cell][l]];
+        int i = 0;
+        while (i < win_length && cells[line[i]] == cells[cell]) {
+            i++;
+        }
+        if (i == win_length) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static int player_to_move(const uint8_t cells[BOOK_CELLS], int *empty) {
+    int x = 0, o = 0;
+
+    for (int i = 0; i < BOOK_CELLS; i++) {
+        x += cells[i] == BOOK_X;
+        o += cells[i] == BOOK_O;
+    }
+    if (empty) {
+        *empty = BOOK_CELLS - x - o;
+    }
+    return x == o ? BOOK_X : BOOK_O;
+}
+
+// Negamax completo com memorização pela chave bruta da posição
+static int8_t solve(uint8_t cells[BOOK_CELLS], uint32_t key, int player) {
+    if (score[key] != UNKNOWN) {
+        return score[key];
+    }
+
+    int best = INT8_MIN;
+    bool any = false;
+
+    for (int m = 0; m < BOOK_CELLS; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        any = true;
+        cells[m] = (uint8_t)player;
+
+        int value;
+        if (wins_at(cells, m)) {
+            value = WIN_SCORE - 1;
+        } else {
+            int child = solve(cells, key + player * pow3[m], 3 - player);
+            value = child > 0 ? -child + 1 : child < 0 ? -child - 1 : 0;
+        }
+
+        cells[m] = BOOK_EMPTY;
+        if (value > best) {
+            best = value;
+        }
+    }
+
+    score[key] = (int8_t)(any ? best : 0);
+    return score[key];
+}
+
+static uint32_t raw_key(const uint8_t cells[BOOK_CELLS]) {
+    uint32_t key = 0;
+
+    for (int i = 0; i < BOOK_CELLS; i++) {
+        key += cells[i] * pow3[i];
+    }
+    return key;
+}
+
+static void decode_key(uint32_t key, uint8_t cells[BOOK_CELLS]) {
+    for (int i = 0; i < BOOK_CELLS; i++) {
+        cells[i] = key % 3;
+        key /= 3;
+    }
+}
+
+// Escolhe a jogada de maior pontuação (a de menor índice em caso de empate)
+static int best_move(uint8_t cells[BOOK_CELLS], int player, int *best_value) {
+    uint32_t key = raw_key(cells);
+    int best = INT8_MIN, move = -1;
+
+    for (int m = 0; m < BOOK_CELLS; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        cells[m] = (uint8_t)player;
+
+        int value;
+        if (wins_at(cells, m)) {
+            value = WIN_SCORE - 1;
+        } else {
+            int child = solve(cells, key + player * pow3[m], 3 - player);
+            value = child > 0 ? -child + 1 : child < 0 ? -child - 1 : 0;
+        }
+
+        cells[m] = BOOK_EMPTY;
+        if (value > best) {
+            best = value;
+            move = m;
+        }
+    }
+    *best_value = best;
+    return move;
+}
+
+static void add_entry(uint32_t entry) {
+    if (num_entries == cap_entries) {
+        cap_entries = cap_entries ? cap_entries * 2 : 4096;
+        entries = realloc(entries, cap_entries * sizeof(uint32_t));
+        if (!entries) {
+            fprintf(stderr, "Memória insuficiente\n");
+            exit(1);
+        }
+    }
+    entries[num_entries++] = entry;
+}
+
+// Joga a jogada do banco para o lado da placa (gravando a posição canônica)
+static int book_reply(uint8_t cells[BOOK_CELLS], int player) {
+    uint8_t transform, canonical[BOOK_CELLS];
+    uint32_t key = book_key(cells, &transform);
+    int value;
+
+    decode_key(key, canonical);
+    int move = best_move(canonical, player, &value);
+
+    if (!bit_get(stored, key)) {
+        bit_set(stored, key);
+        book_outcome_t outcome = value > 0 ? BOOK_WIN : value < 0 ? BOOK_LOSS : BOOK_DRAW;
+        add_entry((key << BOOK_KEY_SHIFT) | ((uint32_t)move << BOOK_MOVE_SHIFT) | outcome);
+    }
+    return book_map_move(transform, (uint8_t)move);
+}
+
+// Percorre a árvore: todas as respostas do adversário, apenas a jogada do banco para a placa
+static void extract(uint8_t cells[BOOK_CELLS], int device) {
+    uint32_t key = raw_key(cells);
+    int empty;
+    int player = player_to_move(cells, &empty);
+
+    if (empty == 0 || bit_get(visited, key)) {
+        return;
+    }
+    bit_set(visited, key);
+
+    if (player == device) {
+        int m = book_reply(cells, player);
+        cells[m] = (uint8_t)player;
+        if (!wins_at(cells, m)) {
+            extract(cells, device);
+        }
+        cells[m] = BOOK_EMPTY;
+        return;
+    }
+
+    for (int m = 0; m < BOOK_CELLS; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        cells[m] = (uint8_t)player;
+        if (!wins_at(cells, m)) {
+            extract(cells, device);
+        }
+        cells[m] = BOOK_EMPTY;
+    }
+}
+
+static int compare_entries(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a, y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+// ---------------------------------------------------------------------------
+// Busca de referência: minimax independente (sem simetrias nem tabela de linhas)
+// ---------------------------------------------------------------------------
+
+static int8_t *reference_memo;
+
+static bool reference_has_line(const uint8_t cells[BOOK_CELLS], int player) {
+    for (int r = 0; r < BOOK_SIZE; r++) {
+        for (int c = 0; c < BOOK_SIZE; c++) {
+            int count[4] = {0, 0, 0, 0};
+            for (int i = 0; i < win_length; i++) {
+                if (c + i < BOOK_SIZE && cells[r * BOOK_SIZE + c + i] == player) count[0]++;
+                if (r + i < BOOK_SIZE && cells[(r + i) * BOOK_SIZE + c] == player) count[1]++;
+                if (r + i < BOOK_SIZE && c + i < BOOK_SIZE && cells[(r + i) * BOOK_SIZE + c + i] == player) count[2]++;
+                if (r + i < BOOK_SIZE && c - i >= 0 && cells[(r + i) * BOOK_SIZE + c - i] == player) count[3]++;
+            }
+            for (int d = 0; d < 4; d++) {
+                if (count[d] == win_length) {
+                    return true;
+                }
+            }
+        }
+    }
+    return false;
+}
+
+// Resultado para quem joga: 1 vence, 0 empata, -1 perde
+static int reference_search(uint8_t cells[BOOK_CELLS], int player) {
+    uint32_t key = raw_key(cells);
+
+    if (reference_memo[key] != UNKNOWN) {
+        return reference_memo[key];
+    }
+    if (reference_has_line(cells, 3 - player)) {
+        return reference_memo[key] = -1;
+    }
+
+    int best = -2;
+    for (int m = 0; m < BOOK_CELLS && best < 1; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        cells[m] = (uint8_t)player;
+        int value = -reference_search(cells, 3 - player);
+        cells[m] = BOOK_EMPTY;
+        if (value > best) {
+            best = value;
+        }
+    }
+    return reference_memo[key] = (int8_t)(best == -2 ? 0 : best);
+}
+
+static const int outcome_value[3] = {-1, 0, 1};
+
+// Confere cada entrada contra a busca de referência e percorre o jogo inteiro só com consultas ao banco
+static bool verify_entries(const book_t *book) {
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < book->count; i++) {
+        uint8_t cells[BOOK_CELLS];
+        uint32_t entry = book->entries[i];
+        int move = (entry >> BOOK_MOVE_SHIFT) & BOOK_MOVE_MASK;
+        int expected = outcome_value[entry & BOOK_OUTCOME_MASK];
+
+        decode_key(entry >> BOOK_KEY_SHIFT, cells);
+        int player = player_to_move(cells, NULL);
+
+        if (i > 0 && (book->entries[i - 1] >> BOOK_KEY_SHIFT) >= (entry >> BOOK_KEY_SHIFT)) {
+            fprintf(stderr, "Entrada %u fora de ordem\n", i);
+            errors++;
+        }
+        if (reference_search(cells, player) != expected) {
+            fprintf(stderr, "Entrada %u: resultado %d difere da referência\n", i, expected);
+            errors++;
+        }
+        if (cells[move] != BOOK_EMPTY) {
+            fprintf(stderr, "Entrada %u: jogada em célula ocupada\n", i);
+            errors++;
+            continue;
+        }
+
+        cells[move] = (uint8_t)player;
+        if (-reference_search(cells, 3 - player) != expected) {
+            fprintf(stderr, "Entrada %u: jogada %d não é ótima\n", i, move);
+            errors++;
+        }
+    }
+    return errors == 0;
+}
+
+static bool verify_play(const book_t *book, uint8_t cells[BOOK_CELLS], int device, uint32_t *positions) {
+    int empty;
+    int player = player_to_move(cells, &empty);
+
+    if (empty == 0 || reference_has_line(cells, 3 - player)) {
+        return true;
+    }
+
+    if (player == device) {
+        book_move_t reply;
+        int m;
+
+        (*positions)++;
+        if (!book_lookup(book, cells, &reply)) {
+            fprintf(stderr, "Posição da placa ausente do banco\n");
+            return false;
+        }
+        m = reply.row * BOOK_SIZE + reply.col;
+        if (cells[m] != BOOK_EMPTY || outcome_value[reply.outcome] != reference_search(cells, player)) {
+            fprintf(stderr, "Consulta incorreta para a posição %u\n", raw_key(cells));
+            return false;
+        }
+        cells[m] = (uint8_t)player;
+        bool ok = verify_play(book, cells, device, positions);
+        cells[m] = BOOK_EMPTY;
+        return ok;
+    }
+
+    for (int m = 0; m < BOOK_CELLS; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        cells[m] = (uint8_t)player;
+        bool ok = verify_play(book, cells, device, positions);
+        cells[m] = BOOK_EMPTY;
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Mede o tempo médio de consulta usando as posições do banco em simetrias aleatórias
+static void measure_latency(const book_t *book) {
+    const uint32_t rounds = 1000000;
+    uint8_t (*positions)[BOOK_CELLS] = malloc((size_t)rounds * BOOK_CELLS);
+    uint32_t found = 0;
+
+    srand(1);
+    for (uint32_t i = 0; i < rounds; i++) {
+        uint8_t cells[BOOK_CELLS];
+        uint8_t transform = (uint8_t)(rand() % BOOK_SYMMETRIES);
+
+        decode_key(book->entries[(uint32_t)rand() % book->count] >> BOOK_KEY_SHIFT, cells);
+        for (int c = 0; c < BOOK_CELLS; c++) {
+            positions[i][book_map_move(transform, (uint8_t)c)] = cells[c];
+        }
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < rounds; i++) {
+        book_move_t move;
+        found += book_lookup(book, positions[i], &move);
+    }
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("Consulta: %.1f ns em média no host (%u/%u encontradas), no máximo %u leituras de 4 bytes da tabela na flash\n",
+           elapsed * 1e9 / rounds, found, rounds, book_max_reads(book));
+    free(positions);
+}
+
+static void write_header(const char *path) {
+    FILE *file = fopen(path, "w");
+
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(file, "// ------------------------------------------------------ //\n");
+    fprintf(file, "// This file is autogenerated by book_gen; do not edit!  //\n");
+    fprintf(file, "// ------------------------------------------------------ //\n\n");
+    fprintf(file, "#pragma once\n\n");
+    fprintf(file, "#include \"pico.h\"\n\n");
+    fprintf(file, "#define book4x4_win_length %d\n", win_length);
+    fprintf(file, "#define book4x4_count %u\n\n", num_entries);
+    fprintf(file, "static const uint32_t __in_flash(\"book4x4\") book4x4_entries[] = {\n");
+    for (uint32_t i = 0; i < num_entries; i++) {
+        fprintf(file, "%s0x%08x,%s", i % 8 ? " " : "    ", entries[i], i % 8 == 7 || i + 1 == num_entries ? "\n" : "");
+    }
+    fprintf(file, "};\n");
+    fclose(file);
+}
+
+static void write_binary(const char *path) {
+    FILE *file = fopen(path, "wb");
+
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+    for (uint32_t i = 0; i < num_entries; i++) {
+        uint8_t bytes[4] = {entries[i], entries[i] >> 8, entries[i] >> 16, entries[i] >> 24};
+        fwrite(bytes, 1, sizeof(bytes), file);
+    }
+    fclose(file);
+}
+
+// ---------------------------------------------------------------------------
+// Livro de aberturas parcial do 5x5 (tabuleiro em bitboards, um bit por célula)
+// ---------------------------------------------------------------------------
+
+#define FULL5 ((1u << BOOK5_CELLS) - 1)
+#define WIN5_SCORE 100000
+#define PROVEN5_SCORE (WIN5_SCORE - BOOK5_CELLS)
+#define MEMO5_MIN_BITS 16
+#define MEMO5_MAX_BITS 25 // 32M posições (512 MB); limita --plies e --depth
+#define MAX5_PLIES 10
+#define MAX5_DEPTH 6
+
+static int book5_plies = 6;
+static int book5_depth = 4;
+
+static uint32_t lines5[64];
+static int num_lines5 = 0;
+static uint8_t order5[BOOK5_CELLS]; // Células do centro para as bordas
+
+static uint64_t *entries5 = NULL;
+static uint32_t num_entries5 = 0, cap_entries5 = 0;
+
+// Tabela de dispersão para posições (endereçamento aberto); cresce ao passar de 3/4 de ocupação.
+// Entradas com carimbo diferente do atual estão livres, então limpar a tabela é só trocar o carimbo.
+typedef struct {
+    uint64_t key;
+    int32_t value;
+    uint32_t stamp;
+} slot5_t;
+
+typedef struct {
+    slot5_t *slots;
+    uint32_t bits, used, stamp;
+} memo5_t;
+
+static memo5_t visited5, reference_memo5;
+
+static void memo5_init(memo5_t *memo) {
+    memo->bits = MEMO5_MIN_BITS;
+    memo->used = 0;
+    memo->stamp = 1;
+    memo->slots = calloc(1u << memo->bits, sizeof(slot5_t));
+    if (!memo->slots) {
+        fprintf(stderr, "Memória insuficiente\n");
+        exit(1);
+    }
+}
+
+static void memo5_clear(memo5_t *memo) {
+    memo->stamp++;
+    memo->used = 0;
+}
+
+// Posição da chave na tabela, ou da primeira entrada livre (sempre existe: ocupação < 3/4)
+static slot5_t *memo5_probe(const memo5_t *memo, uint64_t key) {
+    uint32_t mask = (1u << memo->bits) - 1;
+    uint32_t i = (uint32_t)((key * 0x9E3779B97F4A7C15ull) >> (64 - memo->bits));
+
+    while (memo->slots[i].stamp == memo->stamp && memo->slots[i].key != key) {
+        i = (i + 1) & mask;
+    }
+    return &memo->slots[i];
+}
+
+static void memo5_grow(memo5_t *memo) {
+    memo5_t grown = {NULL, memo->bits + 1, memo->used, memo->stamp};
+
+    if (grown.bits > MEMO5_MAX_BITS) {
+        fprintf(stderr, "Tabela de posições cheia (%u entradas); reduza --plies ou --depth\n", memo->used);
+        exit(1);
+    }
+    grown.slots = calloc(1u << grown.bits, sizeof(slot5_t));
+    if (!grown.slots) {
+        fprintf(stderr, "Memória insuficiente\n");
+        exit(1);
+    }
+    for (uint32_t i = 0; i < (1u << memo->bits); i++) {
+        if (memo->slots[i].stamp == memo->stamp) {
+            *memo5_probe(&grown, memo->slots[i].key) = memo->slots[i];
+        }
+    }
+    free(memo->slots);
+    *memo = grown;
+}
+
+static bool memo5_get(const memo5_t *memo, uint64_t key, int32_t *value) {
+    const slot5_t *slot = memo5_probe(memo, key);
+
+    if (slot->stamp != memo->stamp) {
+        return false;
+    }
+    *value = slot->value;
+    return true;
+}
+
+static void memo5_put(memo5_t *memo, uint64_t key, int32_t value) {
+    slot5_t *slot = memo5_probe(memo, key);
+
+    if (slot->stamp != memo->stamp) {
+        if ((uint64_t)(memo->used + 1) * 4 > (3ull << memo->bits)) {
+            memo5_grow(memo);
+            slot = memo5_probe(memo, key);
+        }
+        memo->used++;
+    }
+    slot->key = key;
+    slot->value = value;
+    slot->stamp = memo->stamp;
+}
+
+static void init_lines5(void) {
+    static const int dirs[4][2] = {{0, 1}, {1, 0}, {1, 1}, {1, -1}};
+
+    for (int r = 0; r < BOOK5_SIZE; r++) {
+        for (int c = 0; c < BOOK5_SIZE; c++) {
+            for (int d = 0; d < 4; d++) {
+                int er = r + dirs[d][0] * (win_length - 1);
+                int ec = c + dirs[d][1] * (win_length - 1);
+                if (er < 0 || er >= BOOK5_SIZE || ec < 0 || ec >= BOOK5_SIZE) {
+                    continue;
+                }
+                uint32_t mask = 0;
+                for (int i = 0; i < win_length; i++) {
+                    mask |= 1u << ((r + dirs[d][0] * i) * BOOK5_SIZE + c + dirs[d][1] * i);
+                }
+                lines5[num_lines5++] = mask;
+            }
+        }
+    }
+
+    // Ordena as células pela distância ao centro (melhora os cortes da busca)
+    for (int i = 0; i < BOOK5_CELLS; i++) {
+        order5[i] = (uint8_t)i;
+    }
+    for (int i = 1; i < BOOK5_CELLS; i++) {
+        for (int j = i; j > 0; j--) {
+            int a = order5[j - 1], b = order5[j];
+            int da = abs(a / BOOK5_SIZE - 2) + abs(a % BOOK5_SIZE - 2);
+            int db = abs(b / BOOK5_SIZE - 2) + abs(b % BOOK5_SIZE - 2);
+            if (db >= da) {
+                break;
+            }
+            order5[j - 1] = (uint8_t)b;
+            order5[j] = (uint8_t)a;
+        }
+    }
+}
+
+static bool wins5(uint32_t cells) {
+    for (int l = 0; l < num_lines5; l++) {
+        if ((cells & lines5[l]) == lines5[l]) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Avaliação heurística: linhas ainda abertas, com peso crescente pelo número de peças
+static int evaluate5(uint32_t me, uint32_t op) {
+    static const int weight[6] = {0, 1, 8, 64, 512, 4096};
+    int value = 0;
+
+    for (int l = 0; l < num_lines5; l++) {
+        int mine = __builtin_popcount(me & lines5[l]);
+        int theirs = __builtin_popcount(op & lines5[l]);
+        if (theirs == 0) {
+            value += weight[mine];
+        } else if (mine == 0) {
+            value -= weight[theirs];
+        }
+    }
+    return value;
+}
+
+// Alfa-beta com profundidade limitada; ply conta os lances desde a raiz da busca
+static int search5(uint32_t me, uint32_t op, int depth, int alpha, int beta, int ply) {
+    if ((me | op) == FULL5) {
+        return 0;
+    }
+    if (depth == 0) {
+        return evaluate5(me, op);
+    }
+
+    for (int i = 0; i < BOOK5_CELLS; i++) {
+        uint32_t bit = 1u << order5[i];
+        if ((me | op) & bit) {
+            continue;
+        }
+        uint32_t next = me | bit;
+        int value = wins5(next) ? WIN5_SCORE - ply : -search5(op, next, depth - 1, -beta, -alpha, ply + 1);
+        if (value > alpha) {
+            alpha = value;
+            if (alpha >= beta) {
+                break;
+            }
+        }
+    }
+    return alpha;
+}
+
+// Escolhe a jogada do livro: a primeira (do centro para as bordas) de maior valor
+static int best_move5(uint32_t me, uint32_t op, int *best_value) {
+    int alpha = -WIN5_SCORE - 1, move = -1;
+    const int ply = 1;
+
+    for (int i = 0; i < BOOK5_CELLS; i++) {
+        uint32_t bit = 1u << order5[i];
+        if ((me | op) & bit) {
+            continue;
+        }
+        uint32_t next = me | bit;
+        int value = wins5(next) ? WIN5_SCORE - ply
+                                : -search5(op, next, book5_depth - 1, -WIN5_SCORE - 1, -alpha, ply + 1);
+        if (value > alpha) {
+            alpha = value;
+            move = order5[i];
+        }
+    }
+    *best_value = alpha;
+    return move;
+}
+
+static void cells_to_bits5(const uint8_t cells[BOOK5_CELLS], int player, uint32_t *me, uint32_t *op) {
+    *me = *op = 0;
+    for (int i = 0; i < BOOK5_CELLS; i++) {
+        if (cells[i] == player) {
+            *me |= 1u << i;
+        } else if (cells[i] != BOOK_EMPTY) {
+            *op |= 1u << i;
+        }
+    }
+}
+
+// Peças de um jogador como bitboard
+static uint32_t player_bits5(const uint8_t cells[BOOK5_CELLS], int player) {
+    uint32_t bits = 0;
+
+    for (int i = 0; i < BOOK5_CELLS; i++) {
+        if (cells[i] == player) {
+            bits |= 1u << i;
+        }
+    }
+    return bits;
+}
+
+static void decode_key5(uint64_t key, uint8_t cells[BOOK5_CELLS]) {
+    for (int i = 0; i < BOOK5_CELLS; i++) {
+        cells[i] = key % 3;
+        key /= 3;
+    }
+}
+
+static book_outcome_t outcome5(int value) {
+    return value >= PROVEN5_SCORE ? BOOK_WIN : value <= -PROVEN5_SCORE ? BOOK_LOSS : BOOK_UNKNOWN;
+}
+
+// Jogada do livro para a placa; a busca é feita no referencial canônico e guardada uma vez por posição
+static int book5_reply(const uint8_t cells[BOOK5_CELLS], int player) {
+    uint8_t transform, canonical[BOOK5_CELLS];
+    uint64_t key = book5_key(cells, &transform);
+    int32_t move;
+
+    if (!memo5_get(&visited5, key << 1, &move)) {
+        uint32_t me, op;
+        int value;
+
+        decode_key5(key, canonical);
+        cells_to_bits5(canonical, player, &me, &op);
+        move = best_move5(me, op, &value);
+        memo5_put(&visited5, key << 1, move);
+
+        if (num_entries5 == cap_entries5) {
+            cap_entries5 = cap_entries5 ? cap_entries5 * 2 : 1024;
+            entries5 = realloc(entries5, cap_entries5 * sizeof(uint64_t));
+            if (!entries5) {
+                fprintf(stderr, "Memória insuficiente\n");
+                exit(1);
+            }
+        }
+        entries5[num_entries5++] = (key << BOOK5_KEY_SHIFT) | ((uint64_t)move << BOOK_MOVE_SHIFT) | outcome5(value);
+    }
+    return book5_map_move(transform, (uint8_t)move);
+}
+
+// Percorre os primeiros lances: todas as respostas do adversário, apenas a jogada do livro para a placa
+static void extract5(uint8_t cells[BOOK5_CELLS], int pieces, int device) {
+    int player = pieces % 2 ? BOOK_O : BOOK_X;
+    uint64_t key = 0;
+    int32_t seen;
+
+    if (pieces >= book5_plies) {
+        return;
+    }
+    for (int i = BOOK5_CELLS - 1; i >= 0; i--) {
+        key = key * 3 + cells[i];
+    }
+    key = (key << 2) | (uint64_t)((device - 1) << 1) | 1;
+    if (memo5_get(&visited5, key, &seen)) {
+        return;
+    }
+    memo5_put(&visited5, key, 1);
+
+    if (player == device) {
+        int m = book5_reply(cells, player);
+        cells[m] = (uint8_t)player;
+        if (!wins5(player_bits5(cells, player))) {
+            extract5(cells, pieces + 1, device);
+        }
+        cells[m] = BOOK_EMPTY;
+        return;
+    }
+
+    for (int m = 0; m < BOOK5_CELLS; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        cells[m] = (uint8_t)player;
+        if (!wins5(player_bits5(cells, player))) {
+            extract5(cells, pieces + 1, device);
+        }
+        cells[m] = BOOK_EMPTY;
+    }
+}
+
+static int compare_entries5(const void *a, const void *b) {
+    uint64_t x = *(const uint64_t *)a, y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+// Referência: minimax sem cortes nem ordenação, com memorização por posição, até a mesma profundidade
+static int reference5(uint32_t me, uint32_t op, int depth, int ply) {
+    uint64_t key = ((uint64_t)op << BOOK5_CELLS) | me;
+    int32_t best;
+
+    if (memo5_get(&reference_memo5, key, &best)) {
+        return best;
+    }
+
+    if ((me | op) == FULL5) {
+        best = 0;
+    } else if (depth == 0) {
+        best = evaluate5(me, op);
+    } else {
+        best = INT32_MIN;
+        for (int m = 0; m < BOOK5_CELLS; m++) {
+            uint32_t next = me | (1u << m);
+            if ((me | op) & (1u << m)) {
+                continue;
+            }
+            int value = wins5(next) ? WIN5_SCORE - ply : -reference5(op, next, depth - 1, ply + 1);
+            if (value > best) {
+                best = value;
+            }
+        }
+    }
+
+    memo5_put(&reference_memo5, key, best);
+    return best;
+}
+
+static bool verify_entries5(const book5_t *book) {
+    uint32_t errors = 0;
+
+    for (uint32_t i = 0; i < book->count; i++) {
+        uint8_t cells[BOOK5_CELLS];
+        uint64_t entry = book->entries[i];
+        int move = (entry >> BOOK_MOVE_SHIFT) & BOOK5_MOVE_MASK;
+        int pieces = 0;
+        uint32_t me, op;
+
+        decode_key5(entry >> BOOK5_KEY_SHIFT, cells);
+        for (int c = 0; c < BOOK5_CELLS; c++) {
+            pieces += cells[c] != BOOK_EMPTY;
+        }
+        cells_to_bits5(cells, pieces % 2 ? BOOK_O : BOOK_X, &me, &op);
+
+        if (i > 0 && (book->entries[i - 1] >> BOOK5_KEY_SHIFT) >= (entry >> BOOK5_KEY_SHIFT)) {
+            fprintf(stderr, "Entrada 5x5 %u fora de ordem\n", i);
+            errors++;
+        }
+        if ((me | op) & (1u << move)) {
+            fprintf(stderr, "Entrada 5x5 %u: jogada em célula ocupada\n", i);
+            errors++;
+            continue;
+        }
+
+        memo5_clear(&reference_memo5);
+        int expected = reference5(me, op, book5_depth, 1);
+        uint32_t next = me | (1u << move);
+        int value = wins5(next) ? WIN5_SCORE - 1 : -reference5(op, next, book5_depth - 1, 2);
+        if (value != expected) {
+            fprintf(stderr, "Entrada 5x5 %u: jogada %d vale %d, a referência encontrou %d\n", i, move, value, expected);
+            errors++;
+        }
+        if ((book_outcome_t)(entry & BOOK_OUTCOME_MASK) != outcome5(expected)) {
+            fprintf(stderr, "Entrada 5x5 %u: resultado difere da referência\n", i);
+            errors++;
+        }
+    }
+    return errors == 0;
+}
+
+static bool verify_play5(const book5_t *book, uint8_t cells[BOOK5_CELLS], int pieces, int device, uint32_t *positions) {
+    int player = pieces % 2 ? BOOK_O : BOOK_X;
+
+    if (pieces >= book5_plies) {
+        return true;
+    }
+
+    if (player == device) {
+        book_move_t reply;
+        int m;
+
+        (*positions)++;
+        if (!book5_lookup(book, cells, &reply)) {
+            fprintf(stderr, "Posição 5x5 da placa ausente do livro\n");
+            return false;
+        }
+        m = reply.row * BOOK5_SIZE + reply.col;
+        if (cells[m] != BOOK_EMPTY) {
+            fprintf(stderr, "Consulta 5x5 devolveu célula ocupada\n");
+            return false;
+        }
+        cells[m] = (uint8_t)player;
+        bool ok = wins5(player_bits5(cells, player)) || verify_play5(book, cells, pieces + 1, device, positions);
+        cells[m] = BOOK_EMPTY;
+        return ok;
+    }
+
+    for (int m = 0; m < BOOK5_CELLS; m++) {
+        if (cells[m] != BOOK_EMPTY) {
+            continue;
+        }
+        cells[m] = (uint8_t)player;
+        bool ok = wins5(player_bits5(cells, player)) || verify_play5(book, cells, pieces + 1, device, positions);
+        cells[m] = BOOK_EMPTY;
+        if (!ok) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void measure_latency5(const book5_t *book) {
+    const uint32_t rounds = 1000000;
+    uint8_t (*positions)[BOOK5_CELLS] = malloc((size_t)rounds * BOOK5_CELLS);
+    uint32_t found = 0;
+
+    srand(1);
+    for (uint32_t i = 0; i < rounds; i++) {
+        uint8_t cells[BOOK5_CELLS];
+        uint8_t transform = (uint8_t)(rand() % BOOK_SYMMETRIES);
+
+        decode_key5(book->entries[(uint32_t)rand() % book->count] >> BOOK5_KEY_SHIFT, cells);
+        for (int c = 0; c < BOOK5_CELLS; c++) {
+            positions[i][book5_map_move(transform, (uint8_t)c)] = cells[c];
+        }
+    }
+
+    clock_t start = clock();
+    for (uint32_t i = 0; i < rounds; i++) {
+        book_move_t move;
+        found += book5_lookup(book, positions[i], &move);
+    }
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    printf("Consulta: %.1f ns em média no host (%u/%u encontradas), no máximo %u leituras de 8 bytes da tabela na flash\n",
+           elapsed * 1e9 / rounds, found, rounds, book5_max_reads(book));
+    free(positions);
+}
+
+static void write_header5(const char *path) {
+    FILE *file = fopen(path, "w");
+
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+    fprintf(file, "// ------------------------------------------------------ //\n");
+    fprintf(file, "// This file is autogenerated by book_gen; do not edit!  //\n");
+    fprintf(file, "// ------------------------------------------------------ //\n\n");
+    fprintf(file, "#pragma once\n\n");
+    fprintf(file, "#include \"pico.h\"\n\n");
+    fprintf(file, "#define book5x5_win_length %d\n", win_length);
+    fprintf(file, "#define book5x5_plies %d\n", book5_plies);
+    fprintf(file, "#define book5x5_depth %d\n", book5_depth);
+    fprintf(file, "#define book5x5_count %u\n\n", num_entries5);
+    fprintf(file, "static const uint64_t __in_flash(\"book5x5\") book5x5_entries[] = {\n");
+    for (uint32_t i = 0; i < num_entries5; i++) {
+        fprintf(file, "%s0x%016llxull,%s", i % 4 ? " " : "    ", (unsigned long long)entries5[i],
+                i % 4 == 3 || i + 1 == num_entries5 ? "\n" : "");
+    }
+    fprintf(file, "};\n");
+    fclose(file);
+}
+
+static void write_binary5(const char *path) {
+    FILE *file = fopen(path, "wb");
+
+    if (!file) {
+        perror(path);
+        exit(1);
+    }
+    for (uint32_t i = 0; i < num_entries5; i++) {
+        uint8_t bytes[8];
+        for (int b = 0; b < 8; b++) {
+            bytes[b] = (uint8_t)(entries5[i] >> (8 * b));
+        }
+        fwrite(bytes, 1, sizeof(bytes), file);
+    }
+    fclose(file);
+}
+
+static int run_book5(const char *header_path, const char *binary_path, bool verify) {
+    init_lines5();
+    memo5_init(&visited5);
+    memo5_init(&reference_memo5);
+
+    printf("%dx%d com %d em linha: livro de aberturas dos primeiros %d lances, busca de %d lances\n",
+           BOOK5_SIZE, BOOK5_SIZE, win_length, book5_plies, book5_depth);
+
+    uint8_t cells[BOOK5_CELLS] = {0};
+    for (int device = BOOK_X; device <= BOOK_O; device++) {
+        extract5(cells, 0, device);
+    }
+    qsort(entries5, num_entries5, sizeof(uint64_t), compare_entries5);
+
+    uint32_t proven = 0;
+    for (uint32_t i = 0; i < num_entries5; i++) {
+        proven += (entries5[i] & BOOK_OUTCOME_MASK) != BOOK_UNKNOWN;
+    }
+
+    book5_t book = {entries5, num_entries5};
+    printf("Livro: %u posições (%u com resultado provado), %u bytes na flash\n",
+           num_entries5, proven, num_entries5 * (uint32_t)sizeof(uint64_t));
+    measure_latency5(&book);
+
+    if (verify) {
+        uint32_t positions = 0;
+        bool ok = verify_entries5(&book);
+        for (int device = BOOK_X; device <= BOOK_O && ok; device++) {
+            ok = verify_play5(&book, cells, 0, device, &positions);
+        }
+        if (!ok) {
+            fprintf(stderr, "Verificação falhou\n");
+            return 1;
+        }
+        printf("Verificação: %u entradas e %u posições de jogo conferidas com a busca de referência\n",
+               num_entries5, positions);
+    }
+
+    if (header_path) {
+        write_header5(header_path);
+    }
+    if (binary_path) {
+        write_binary5(binary_path);
+    }
+    return 0;
+}
+
+int main(int argc, char **argv) {
+    const char *header_path = NULL, *binary_path = NULL;
+    bool verify = false;
+    int size = BOOK_SIZE;
+
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-s") && i + 1 < argc) {
+            size = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-k") && i + 1 < argc) {
+            win_length = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-o") && i + 1 < argc) {
+            header_path = argv[++i];
+        } else if (!strcmp(argv[i], "-b") && i + 1 < argc) {
+            binary_path = argv[++i];
+        } else if (!strcmp(argv[i], "--plies") && i + 1 < argc) {
+            book5_plies = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--depth") && i + 1 < argc) {
+            book5_depth = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "--verify")) {
+            verify = true;
+        } else {
+            fprintf(stderr, "Uso: %s [-s 4|5] [-k 3..5] [-o book.h] [-b book.bin] [--verify] [--plies N] [--depth D]\n",
+                    argv[0]);
+            return 2;
+        }
+    }
+    if (size != BOOK_SIZE && size != BOOK5_SIZE) {
+        fprintf(stderr, "Tamanho deve ser %d ou %d\n", BOOK_SIZE, BOOK5_SIZE);
+        return 2;
+    }
+    if (win_length == 0) {
+        win_length = BOOK_SIZE;
+    }
+    if (win_length < 3 || win_length > size) {
+        fprintf(stderr, "k deve estar entre 3 e %d\n", size);
+        return 2;
+    }
+    if (size == BOOK5_SIZE) {
+        if (book5_plies < 1 || book5_plies > MAX5_PLIES || book5_depth < 1 || book5_depth > MAX5_DEPTH) {
+            fprintf(stderr, "--plies deve estar entre 1 e %d e --depth entre 1 e %d\n", MAX5_PLIES, MAX5_DEPTH);
+            return 2;
+        }
+        return run_book5(header_path, binary_path, verify);
+    }
+
+    init_lines();
+    score = malloc(NUM_KEYS);
+    stored = calloc(NUM_KEYS / 8 + 1, 1);
+    visited = calloc(NUM_KEYS / 8 + 1, 1);
+    if (!score || !stored || !visited) {
+        fprintf(stderr, "Memória insuficiente\n");
+        return 1;
+    }
+    memset(score, UNKNOWN, NUM_KEYS);
+
+    uint8_t cells[BOOK_CELLS] = {0};
+    int root = solve(cells, 0, BOOK_X);
+    printf("%dx%d com %d em linha: %s para o X\n", BOOK_SIZE, BOOK_SIZE, win_length,
+           root > 0 ? "vitória" : root < 0 ? "derrota" : "empate");
+
+    // Estratégia da placa jogando como X e como O
+    for (int device = BOOK_X; device <= BOOK_O; device++) {
+        memset(visited, 0, NUM_KEYS / 8 + 1);
+        extract(cells, device);
+    }
+    qsort(entries, num_entries, sizeof(uint32_t), compare_entries);
+
+    book_t book = {entries, num_entries};
+    printf("Banco: %u posições, %u bytes na flash\n", num_entries, num_entries * (uint32_t)sizeof(uint32_t));
+    measure_latency(&book);
+
+    if (verify) {
+        reference_memo = malloc(NUM_KEYS);
+        if (!reference_memo) {
+            fprintf(stderr, "Memória insuficiente\n");
+            return 1;
+        }
+        memset(reference_memo, UNKNOWN, NUM_KEYS);
+
+        uint32_t positions = 0;
+        bool ok = verify_entries(&book);
+        for (int device = BOOK_X; device <= BOOK_O && ok; device++) {
+            ok = verify_play(&book, cells, device, &positions);
+        }
+        if (!ok) {
+            fprintf(stderr, "Verificação falhou\n");
+            return 1;
+        }
+        printf("Verificação: %u entradas e %u posições de jogo conferidas com a busca de referência\n",
+               num_entries, positions);
+    }
+
+    if (header_path) {
+        write_header(header_path);
+    }
+    if (binary_path) {
+        write_binary(binary_path);
+    }
+    return 0;
+}